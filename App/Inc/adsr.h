@@ -63,7 +63,13 @@ class Adsr {
         return _output;
     }
 
+    // Fills out[0..n) a whole segment run at a time: the sample count left in each segment
+    // is worked out up front, so the inner loops carry no state checks. Returns how many
+    // samples the envelope stayed active for, everything after that is zero.
+    uint32_t renderBlock(float* __restrict__ out, uint32_t n) noexcept;
+
     [[nodiscard]] bool isActive() const noexcept { return _state != EnvState::IDLE; }
+    [[nodiscard]] bool isKilled() const noexcept { return _state == EnvState::KILL; }
     [[nodiscard]] float getLevel() const noexcept { return _output; }
     
     // Setters for  parameters
@@ -82,8 +88,12 @@ private:
     float _attackTime{0.01f}, _decayTime{0.1f}, _releaseTime{0.5f};
     float _sustainLevel{0.7f};
     float _attackStep{0.0f}, _decayMult{0.0f}, _releaseMult{0.0f}, _killStep{0.0f};
+    // Samples renderBlock() has left in the DECAY or RELEASE segment. Worked out when the segment
+    // starts or its settings change, so blocks only count down instead of taking logs.
+    uint32_t _segmentLeft{0};
 
     [[nodiscard]] float calcMultiplier(float timeInSeconds) const noexcept;
+    [[nodiscard]] static uint32_t segmentLength(float samples) noexcept;
     void calcDecay() noexcept;
     void calcRelease() noexcept;
 };
@@ -32,8 +32,18 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
 }
 #endif
 
+struct MidiEvent;
+
 void handleParamChange(uint8_t index);
+void dispatchMidi();
+bool dispatchEvent(const MidiEvent& e);
 void handleMidi();
+void handleMidiClock(const MidiEvent& e);
+void handleRpn(const MidiEvent& e);
+void playNote(uint8_t note, uint8_t velocity, uint32_t stamp, uint8_t channel);
+void playPedal(uint8_t controller, uint8_t value, uint32_t stamp);
+void handleSysex(const uint8_t* msg, uint32_t len);
+void serviceTelemetry(uint32_t now);
 void cycleWaveform(uint8_t slot);
 void updateOledView();
 void playStartupSequence();
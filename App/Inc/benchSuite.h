@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+// Per-component microbenchmarks for the DSP core.
+// Runs unchanged on the board (DWT cycles) and on the host (steady_clock ns), see cycleCounter.h.
+namespace Bench {
+    struct Result {
+        const char* name;
+        uint32_t samplesPerBlock;   // Samples produced by one timed block
+        uint32_t blocks;
+        uint64_t totalTicks;
+        uint32_t minBlockTicks;
+        uint32_t maxBlockTicks;
+    };
+
+    using Reporter = void (*)(const Result& result, void* context);
+
+    // Runs every benchmark for the given number of timed blocks and hands each result to report
+    void runAll(uint32_t blocks, Reporter report, void* context = nullptr) noexcept;
+
+    // Reporter that prints one JSON object per line to stdout (context is an optional label string)
+    void printJson(const Result& result, void* context) noexcept;
+}
@@ -2,6 +2,20 @@
 
 #include <math.h>
 
+// Build-time choice of voice render path: 0 = float, 1 = Q15/Q31 fixed point (see dspMath.h)
+#ifndef SYNTH_FIXED_POINT
+#define SYNTH_FIXED_POINT 0
+#endif
+
+// Build-time choice of voice engine: 0 = one Osc per voice, 1 = structure-of-arrays VoiceBank (float only)
+#ifndef SYNTH_SOA_VOICES
+#define SYNTH_SOA_VOICES 0
+#endif
+
+#if SYNTH_SOA_VOICES && SYNTH_FIXED_POINT
+#error "SYNTH_SOA_VOICES is only implemented for the float render path"
+#endif
+
 namespace Constants {
     static constexpr float PI      = 3.14159265358979323846f;
     static constexpr float TWO_PI  = 6.28318530717958647692f;
@@ -14,6 +28,7 @@ namespace Constants {
     static constexpr int BUFFER_SIZE  = 64;
     static constexpr int NUM_FRAMES = BUFFER_SIZE/2;
     static constexpr int CIRCULAR_BUFFER_SIZE = BUFFER_SIZE * 2;
+    static constexpr float BLOCK_PERIOD_US = NUM_FRAMES * 1000000.0f / SAMPLE_RATE; // Half-buffer render deadline
     
     static constexpr int NUM_VOICES = 8;
     static constexpr float VOICE_GAIN_SCALAR = 0.13f; // slightly more than 1/8
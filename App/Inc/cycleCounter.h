@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(STM32F407xx)
+#include "stm32f4xx.h"
+#else
+#include <chrono>
+#endif
+
+// Free-running 32-bit tick source for timing render code.
+// On the board this is the DWT cycle counter, on the host it is steady_clock in nanoseconds.
+// Both wrap, so always measure with unsigned subtraction (end - start).
+namespace CycleCounter {
+#if defined(STM32F407xx)
+    static constexpr const char* UNIT = "cycles";
+
+    inline void init() noexcept {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    __attribute__((always_inline)) inline uint32_t now() noexcept { return DWT->CYCCNT; }
+    inline uint32_t ticksPerSecond() noexcept { return SystemCoreClock; }
+#else
+    static constexpr const char* UNIT = "ns";
+
+    inline void init() noexcept {}
+
+    inline uint32_t now() noexcept {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    inline uint32_t ticksPerSecond() noexcept { return 1000000000u; }
+#endif
+
+    inline float toMicros(uint32_t ticks) noexcept {
+        return static_cast<float>(ticks) * (1000000.0f / static_cast<float>(ticksPerSecond()));
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#endif
+
+// Saturating and multiply-high helpers for the fixed-point render path, plus a table exp2 for
+// block-rate modulation.
+// On the Cortex-M4 these map to single DSP instructions (QADD, SSAT, SMMULR, SMLAD),
+// everywhere else the portable versions give bit-identical results so the path can be
+// checked on the host.
+namespace Dsp {
+    // Saturating 32-bit add
+    __attribute__((always_inline)) inline int32_t qadd(int32_t a, int32_t b) noexcept {
+#if defined(__ARM_FEATURE_DSP)
+        return __qadd(a, b);
+#else
+        const int64_t sum = static_cast<int64_t>(a) + b;
+        if (sum > INT32_MAX) return INT32_MAX;
+        if (sum < INT32_MIN) return INT32_MIN;
+        return static_cast<int32_t>(sum);
+#endif
+    }
+
+    // Saturate to a signed 16-bit range
+    __attribute__((always_inline)) inline int32_t ssat16(int32_t x) noexcept {
+#if defined(__ARM_FEATURE_DSP)
+        return __ssat(x, 16);
+#else
+        if (x > INT16_MAX) return INT16_MAX;
+        if (x < INT16_MIN) return INT16_MIN;
+        return x;
+#endif
+    }
+
+    // Rounded top word of a 32x32 multiply: (a * b + 2^31) >> 32
+    __attribute__((always_inline)) inline int32_t smmulr(int32_t a, int32_t b) noexcept {
+#if defined(__ARM_FEATURE_DSP)
+        int32_t r;
+        __asm__("smmulr %0, %1, %2" : "=r"(r) : "r"(a), "r"(b));
+        return r;
+#else
+        return static_cast<int32_t>((static_cast<int64_t>(a) * b + 0x80000000LL) >> 32);
+#endif
+    }
+
+    // Dual 16-bit multiply-accumulate: acc + x.lo * y.lo + x.hi * y.hi
+    __attribute__((always_inline)) inline int32_t smlad(uint32_t x, uint32_t y, int32_t acc) noexcept {
+#if defined(__ARM_FEATURE_DSP)
+        return __smlad(x, y, acc);
+#else
+        const int32_t lo = static_cast<int16_t>(x & 0xFFFF) * static_cast<int16_t>(y & 0xFFFF);
+        const int32_t hi = static_cast<int16_t>(x >> 16) * static_cast<int16_t>(y >> 16);
+        return acc + lo + hi;
+#endif
+    }
+
+    // Packs two 16-bit values into one word for smlad
+    __attribute__((always_inline)) inline uint32_t pack16(int32_t lo, int32_t hi) noexcept {
+        return (static_cast<uint32_t>(lo) & 0xFFFF) | (static_cast<uint32_t>(hi) << 16);
+    }
+
+    // Float to Q31, saturating at the +1.0 edge that Q31 can't represent
+    inline int32_t floatToQ31(float x) noexcept {
+        if (x >= 1.0f) return INT32_MAX;
+        if (x <= -1.0f) return INT32_MIN;
+        return static_cast<int32_t>(x * 2147483648.0f);
+    }
+
+    // Q15 linear interpolation between a and b with weight frac (0..0x7FFF), one SMLAD
+    __attribute__((always_inline)) inline int32_t lerpQ15(int16_t a, int16_t b, int32_t frac) noexcept {
+        return smlad(pack16(a, b), pack16(0x7FFF - frac, frac), 0) >> 15;
+    }
+
+    namespace detail {
+        // 2^x for 0 <= x <= 1 as a series in x * ln 2, only ever run by the compiler
+        constexpr double exp2Series(double x) {
+            const double y = x * 0.69314718055994530942;
+            double term = 1.0, sum = 1.0;
+            for (int n = 1; n < 24; ++n) {
+                term *= y / n;
+                sum += term;
+            }
+            return sum;
+        }
+
+        struct Exp2Table {
+            static constexpr uint32_t STEPS = 64;
+            float v[STEPS + 1]{};
+            constexpr Exp2Table() {
+                for (uint32_t i = 0; i <= STEPS; ++i) v[i] = static_cast<float>(exp2Series(static_cast<double>(i) / STEPS));
+            }
+        };
+        inline constexpr Exp2Table EXP2_TABLE{};
+    }
+
+    // 2^x without libm: the fraction interpolates a 64-step table (under 0.03 cents off as a
+    // pitch ratio), the integer part goes straight into the float exponent. |x| < 126.
+    inline float exp2(float x) noexcept {
+        int32_t n = static_cast<int32_t>(x);
+        if (static_cast<float>(n) > x) --n;
+        const float pos = (x - static_cast<float>(n)) * detail::Exp2Table::STEPS;
+        // Rounding can land a fraction just under 1 on the last entry
+        const uint32_t idx = std::min(static_cast<uint32_t>(pos), detail::Exp2Table::STEPS - 1);
+        const float* t = detail::EXP2_TABLE.v;
+        const float frac = t[idx] + (t[idx + 1] - t[idx]) * (pos - static_cast<float>(idx));
+
+        const uint32_t bits = static_cast<uint32_t>(n + 127) << 23;
+        float scale;
+        std::memcpy(&scale, &bits, sizeof(scale));
+        return frac * scale;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "constants.h"
+#include "waveforms.h"
+
+// Block-rate LFO: a 32-bit phase accumulator stepped once per audio block, reading its shape
+// from the widest mip level of a wave library table. No transcendental calls at run time.
+class Lfo {
+public:
+    static constexpr uint32_t GLOBAL_COUNT = 2;     // Shared by all voices
+    static constexpr uint32_t VOICE_COUNT = 2;      // One set per voice
+    static constexpr uint32_t COUNT = GLOBAL_COUNT + VOICE_COUNT;
+
+    struct Settings {
+        float rate{Constants::LFO_FREQ};    // Hz, when not synced
+        float beats{1.0f};                  // Cycle length in beats, when synced
+        uint8_t shape{0};                   // waveLibrary index
+        bool sync{false};                   // Rate follows the tempo
+        bool retrigger{false};              // Restart on note on, see VoiceManager::noteOn()
+
+        bool operator==(const Settings& o) const noexcept {
+            return rate == o.rate && beats == o.beats && shape == o.shape && sync == o.sync && retrigger == o.retrigger;
+        }
+        bool operator!=(const Settings& o) const noexcept { return !(*this == o); }
+    };
+
+    using Bank = std::array<Settings, COUNT>;
+
+    // Global LFO 1 is the 5 Hz sine the vibrato always used
+    static Bank defaults() noexcept;
+
+    void configure(const Settings& settings, float bpm) noexcept;
+    void retrigger() noexcept { _phase = 0; }
+    void setPhase(uint32_t phase) noexcept { _phase = phase; }
+    [[nodiscard]] bool retriggers() const noexcept { return _retrigger; }
+
+    // Steps one block and returns the new value, -1..1
+    [[nodiscard]] float tick() noexcept {
+        _phase += _inc;
+        return value();
+    }
+
+    // Where it is now, without stepping
+    [[nodiscard]] float value() const noexcept {
+        static constexpr uint32_t SHIFT = 32 - WaveMip::BASE_BITS;
+        const uint32_t idx1 = _phase >> SHIFT;
+        const uint32_t idx2 = (idx1 + 1) & (WaveMip::BASE_SIZE - 1);
+        const float fraction = static_cast<float>(_phase & ((1u << SHIFT) - 1)) * (1.0f / (1u << SHIFT));
+        return (_table[idx1] + (_table[idx2] - _table[idx1]) * fraction) * WaveMip::Q15_SCALE;
+    }
+
+private:
+    const int16_t* _table{waveLibrary[0]};
+    uint32_t _phase{0};
+    uint32_t _inc{0};
+    bool _retrigger{false};
+};
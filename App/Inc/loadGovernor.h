@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include "constants.h"
+
+// Keeps the audio callback inside its deadline. Fed the measured render time of every block,
+// it steps a degradation level up quickly when the load gets close to the deadline and back
+// down slowly once it has stayed low, so it doesn't flap around a threshold.
+//
+// Levels, each one keeps what the ones below it did:
+//   1  released voices read the nearest sample instead of interpolating, filters keep running
+//   2  all voices read the nearest sample
+//   3+ the voice limit drops by one per level down to MIN_VOICES, the quietest voices fade out
+// The structure-of-arrays bank renders every voice through one kernel, so it has no quality
+// levels and starts at the voice limit.
+class LoadGovernor {
+public:
+    static constexpr float HIGH_LOAD = 0.8f;        // Share of the deadline that steps the level up
+    static constexpr float LOW_LOAD = 0.55f;        // Share the load must stay under to step back down
+    static constexpr uint32_t STEP_BLOCKS = 16;     // Blocks between steps up, lets the average catch up
+    static constexpr uint32_t RECOVER_BLOCKS = 1500;// ~1 s under LOW_LOAD per step back down
+    static constexpr uint32_t MIN_VOICES = 4;
+#if SYNTH_SOA_VOICES
+    static constexpr uint32_t QUALITY_LEVELS = 0;
+#else
+    static constexpr uint32_t QUALITY_LEVELS = 2;
+#endif
+    static constexpr uint32_t MAX_LEVEL = QUALITY_LEVELS + Constants::NUM_VOICES - MIN_VOICES;
+
+    // Deadline of one block in the same ticks update() gets, 0 turns the governor off
+    void setDeadline(uint32_t ticks) noexcept;
+
+    // One block's render time. A block over the deadline steps up right away.
+    void update(uint32_t ticks) noexcept;
+
+    [[nodiscard]] bool isEnabled() const noexcept { return _invDeadline > 0.0f; }
+    [[nodiscard]] uint32_t level() const noexcept { return _level; }
+    [[nodiscard]] float load() const noexcept { return _load; }
+    [[nodiscard]] uint32_t overruns() const noexcept { return _overruns; }
+
+    [[nodiscard]] bool cheapReleased() const noexcept { return QUALITY_LEVELS >= 1 && _level >= 1; }
+    [[nodiscard]] bool cheapAll() const noexcept { return QUALITY_LEVELS >= 2 && _level >= 2; }
+    [[nodiscard]] uint32_t voiceLimit() const noexcept {
+        return (_level > QUALITY_LEVELS) ? Constants::NUM_VOICES - (_level - QUALITY_LEVELS) : Constants::NUM_VOICES;
+    }
+
+private:
+    float _invDeadline{0.0f};
+    float _load{0.0f};          // Moving average of render time over the deadline
+    uint32_t _level{0};
+    uint32_t _cooldown{0};
+    uint32_t _calm{0};          // Blocks in a row under LOW_LOAD
+    uint32_t _overruns{0};
+};
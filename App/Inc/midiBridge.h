@@ -0,0 +1,13 @@
+#pragma once
+#include <cstdint>
+
+// USB-MIDI out on the MIDI IN endpoint. A message of whole 4-byte event packets is copied
+// and sent in 64-byte transfers, each one started from the completion of the last.
+namespace MidiBridge {
+    static constexpr uint32_t TX_SIZE = 512;
+
+    // Main loop side. False while the previous message is still going out, when it doesn't
+    // fit, or when USB isn't configured.
+    bool send(const uint8_t* packets, uint32_t len) noexcept;
+    [[nodiscard]] bool isBusy() noexcept;
+}
@@ -2,35 +2,97 @@
 #include <array>
 #include <atomic>
 #include <cstdint>
+#include <cstring>
 
 struct MidiPacket {
     uint8_t data[4];
+    uint32_t stamp;     // CycleCounter ticks on arrival, see SampleClock
 };
 
+// Single-producer single-consumer ring of USB-MIDI event packets. Indices run free and wrap at
+// 2^32, a slot is index & MASK. Each call loads the other side's index once (acquire) and
+// publishes its own once (release), so a whole USB transfer or a whole batch costs two atomics.
 class MidiBuffer {
-private:
-    static constexpr int SIZE = 128; 
-    std::array<MidiPacket, SIZE> buffer;
-    std::atomic<int> head{0};
-    std::atomic<int> tail{0};
-
 public:
-    // Called by USB Interrupt
-    void push(const uint8_t* raw) {
-        int next = (head.load() + 1) % SIZE;
-        if (next != tail.load()) {
-            for (int i = 0; i < 4; ++i) {
-                buffer[head].data[i] = raw[i];
-            }
-            head.store(next);
+    static constexpr uint32_t SIZE = 128;
+    static_assert((SIZE & (SIZE - 1)) == 0, "MidiBuffer size must be a power of two");
+
+    // Packets handed out by popBatch(), read in place. The slots go back to the producer when
+    // the batch goes out of scope.
+    class Batch {
+    public:
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+        ~Batch() { _owner._tail.store(_tail + _count, std::memory_order_release); }
+
+        [[nodiscard]] const MidiPacket* begin() const noexcept { return _begin; }
+        [[nodiscard]] const MidiPacket* end() const noexcept { return _begin + _count; }
+        [[nodiscard]] uint32_t size() const noexcept { return _count; }
+        [[nodiscard]] bool empty() const noexcept { return _count == 0; }
+
+    private:
+        friend class MidiBuffer;
+        Batch(MidiBuffer& owner, uint32_t tail, uint32_t count) noexcept
+            : _owner(owner), _begin(&owner._buffer[tail & MASK]), _tail(tail), _count(count) {}
+
+        MidiBuffer& _owner;
+        const MidiPacket* _begin;
+        uint32_t _tail;
+        uint32_t _count;
+    };
+
+    // Producer. One USB transfer's worth of 4-byte packets, all with the same stamp. Returns
+    // how many fit, the rest are counted in overflows().
+    uint32_t pushN(const uint8_t* raw, uint32_t count, uint32_t stamp) noexcept {
+        const uint32_t head = _head.load(std::memory_order_relaxed);
+        const uint32_t tail = _tail.load(std::memory_order_acquire);
+        const uint32_t room = SIZE - (head - tail);
+        const uint32_t n = (count < room) ? count : room;
+
+        for (uint32_t i = 0; i < n; ++i) {
+            MidiPacket& p = _buffer[(head + i) & MASK];
+            std::memcpy(p.data, raw + i * 4, 4);
+            p.stamp = stamp;
         }
+        _head.store(head + n, std::memory_order_release);
+
+        // Only the producer writes these, no read-modify-write needed
+        if (n < count) _dropped.store(_dropped.load(std::memory_order_relaxed) + (count - n), std::memory_order_relaxed);
+        const uint32_t used = head + n - tail;
+        if (used > _highWater.load(std::memory_order_relaxed)) _highWater.store(used, std::memory_order_relaxed);
+        return n;
     }
 
-    // Called by Main Loop
-    bool pop(MidiPacket& out) {
-        if (head.load() == tail.load()) return false;
-        out = buffer[tail];
-        tail.store((tail.load() + 1) % SIZE);
+    bool push(const uint8_t* raw, uint32_t stamp) noexcept { return pushN(raw, 1, stamp) == 1; }
+
+    // Consumer
+    bool pop(MidiPacket& out) noexcept {
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) return false;
+        out = _buffer[tail & MASK];
+        _tail.store(tail + 1, std::memory_order_release);
         return true;
     }
+
+    // Consumer. Everything waiting, up to the end of the storage: once a batch comes back
+    // empty the buffer is drained.
+    [[nodiscard]] Batch popBatch() noexcept {
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        const uint32_t waiting = _head.load(std::memory_order_acquire) - tail;
+        const uint32_t contiguous = SIZE - (tail & MASK);
+        return Batch(*this, tail, (waiting < contiguous) ? waiting : contiguous);
+    }
+
+    // Packets pushed into a full buffer, and the most ever waiting at once, since power-up
+    [[nodiscard]] uint32_t overflows() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint32_t highWater() const noexcept { return _highWater.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr uint32_t MASK = SIZE - 1;
+
+    std::array<MidiPacket, SIZE> _buffer;
+    std::atomic<uint32_t> _head{0};     // Written by the producer
+    std::atomic<uint32_t> _tail{0};     // Written by the consumer
+    std::atomic<uint32_t> _dropped{0};
+    std::atomic<uint32_t> _highWater{0};
 };
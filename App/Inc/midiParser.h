@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include "midiBuffer.h"
+
+// One decoded MIDI message. Data bytes are masked to 7 bits, a note on with velocity 0 comes
+// out as NOTE_OFF.
+struct MidiEvent {
+    enum class Type : uint8_t {
+        NONE,
+        NOTE_OFF,           // data1 note, data2 velocity
+        NOTE_ON,
+        POLY_PRESSURE,      // data1 note, data2 pressure
+        CONTROL_CHANGE,     // data1 controller, data2 value
+        PROGRAM_CHANGE,     // data1 program
+        CHANNEL_PRESSURE,   // data1 pressure
+        PITCH_BEND,         // data1 LSB, data2 MSB, see bend()
+        SYSEX,              // Complete message F0 .. F7, see MidiParser::sysex()
+        SYSTEM_COMMON,      // status F1-F6, data1/data2 as sent
+        REALTIME            // status F8-FF: clock, start, continue, stop, ...
+    };
+
+    Type type{Type::NONE};
+    uint8_t cable{0};
+    uint8_t channel{0};     // 0..15, channel messages only
+    uint8_t status{0};
+    uint8_t data1{0};
+    uint8_t data2{0};
+    uint32_t stamp{0};      // From the packet, see SampleClock
+
+    // -8192..8191
+    [[nodiscard]] int16_t bend() const noexcept {
+        return static_cast<int16_t>(((data2 << 7) | data1) - 8192);
+    }
+};
+
+// USB-MIDI 1.0 event packet decoder. The Code Index Number in the low nibble of the packet
+// header says how many bytes follow and what they are, so every packet is decoded with two
+// table lookups and no per-byte state machine. SysEx is reassembled across packets into a
+// bounded buffer, longer messages are dropped whole. One packet completes at most one message.
+class MidiParser {
+public:
+    static constexpr uint32_t SYSEX_CAPACITY = 64;  // Including F0 and F7
+
+    // Only cables set in the mask are decoded, bit n for cable n
+    explicit MidiParser(uint16_t cableMask = 0xFFFF) noexcept : _cableMask(cableMask) {}
+
+    // True when the packet completed a message, written to out
+    bool feed(const MidiPacket& packet, MidiEvent& out) noexcept;
+
+    // The last SYSEX message, valid until the next feed()
+    [[nodiscard]] const uint8_t* sysex() const noexcept { return _sysex; }
+    [[nodiscard]] uint32_t sysexLength() const noexcept { return _sysexLength; }
+
+    // SysEx messages dropped for not fitting the buffer, and malformed packets skipped
+    [[nodiscard]] uint32_t sysexOverflows() const noexcept { return _sysexOverflows; }
+    [[nodiscard]] uint32_t errors() const noexcept { return _errors; }
+
+private:
+    bool feedSysex(const MidiPacket& packet, uint32_t count, MidiEvent& out) noexcept;
+
+    uint16_t _cableMask;
+    uint8_t _sysex[SYSEX_CAPACITY];
+    uint32_t _sysexLength{0};
+    uint8_t _sysexCable{0};
+    bool _inSysex{false};
+    bool _sysexOverflowed{false};
+    uint32_t _sysexOverflows{0};
+    uint32_t _errors{0};
+};
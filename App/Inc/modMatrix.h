@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Control-rate modulation matrix. A fixed number of routes each connect one source to one
+// per-voice destination, optionally scaled by a second "via" source (e.g. LFO to pitch via the
+// mod wheel). VoiceManager evaluates it once per block per voice, so the cost is SLOTS
+// multiply-adds per voice per block no matter how the routes are set.
+class ModMatrix {
+public:
+    static constexpr uint32_t SLOTS = 8;
+
+    enum class Source : uint8_t {
+        NONE,
+        LFO1,       // Global LFOs, -1..1, see Lfo
+        LFO2,
+        VOICE_LFO1, // Per-voice LFOs, -1..1
+        VOICE_LFO2,
+        MOD_ENV,    // Second per-voice envelope, 0..1
+        VELOCITY,   // 0..1
+        NOTE,       // (note - 60) / 64, about -1..1 across the keyboard
+        MOD_WHEEL,  // 0..1
+        AFTERTOUCH, // Channel pressure, 0..1, the voice's own channel in MPE mode
+        PITCH_BEND, // -1..1
+        TIMBRE,     // CC 74, -1..1 around 64, the voice's own channel in MPE mode
+        COUNT
+    };
+
+    // Amounts are in the destination's units at a source value of 1
+    enum class Dest : uint8_t {
+        CUTOFF,     // Octaves
+        RESONANCE,  // Added to the 0..1 knob value
+        MORPH,      // Added to the 0..1 knob value
+        PITCH,      // Semitones
+        AMP,        // Gain scaled by (1 - amount) + amount * source, so amount 1 follows the source
+        COUNT
+    };
+
+    struct Route {
+        Source source{Source::NONE};
+        Dest dest{Dest::CUTOFF};
+        Source via{Source::NONE};   // NONE: not scaled
+        float amount{0.0f};
+
+        bool operator==(const Route& o) const noexcept {
+            return source == o.source && dest == o.dest && via == o.via && amount == o.amount;
+        }
+    };
+
+    using Routes = std::array<Route, SLOTS>;
+    using Sources = std::array<float, static_cast<uint32_t>(Source::COUNT)>;
+
+    // Summed offsets for one voice, AMP is a gain factor starting at 1
+    using Result = std::array<float, static_cast<uint32_t>(Dest::COUNT)>;
+
+    // Vibrato on the mod wheel and velocity to amplitude, what the voices did before the matrix
+    static Routes defaults() noexcept;
+    // The defaults plus pressure to amplitude and timbre to cutoff, for MPE controllers
+    static Routes mpeDefaults() noexcept;
+
+    [[nodiscard]] static Result evaluate(const Routes& routes, const Sources& sources) noexcept;
+
+    [[nodiscard]] static float value(const Sources& sources, Source s) noexcept {
+        return sources[static_cast<uint32_t>(s)];
+    }
+    [[nodiscard]] static float value(const Result& result, Dest d) noexcept {
+        return result[static_cast<uint32_t>(d)];
+    }
+};
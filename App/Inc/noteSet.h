@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// One bit per MIDI note, kept in 32-bit words so combining two sets is four word operations
+struct NoteSet {
+    static constexpr uint32_t WORDS = 128 / 32;
+
+    std::array<uint32_t, WORDS> words{};
+
+    void set(uint8_t note) noexcept { words[(note >> 5) & 3] |= 1u << (note & 31); }
+    void reset(uint8_t note) noexcept { words[(note >> 5) & 3] &= ~(1u << (note & 31)); }
+    [[nodiscard]] bool test(uint8_t note) const noexcept { return (words[(note >> 5) & 3] >> (note & 31)) & 1; }
+    void clear() noexcept { words.fill(0); }
+
+    NoteSet& operator|=(const NoteSet& other) noexcept {
+        for (uint32_t w = 0; w < WORDS; ++w) words[w] |= other.words[w];
+        return *this;
+    }
+
+    // Notes in this set and not in other
+    [[nodiscard]] NoteSet without(const NoteSet& other) const noexcept {
+        NoteSet out;
+        for (uint32_t w = 0; w < WORDS; ++w) out.words[w] = words[w] & ~other.words[w];
+        return out;
+    }
+
+    // Calls fn(note) for every note in the set, lowest first. Skips empty words and visits only
+    // the set bits of the others.
+    template <typename Fn>
+    void forEach(Fn&& fn) const noexcept {
+        for (uint32_t w = 0; w < WORDS; ++w) {
+            for (uint32_t bits = words[w]; bits != 0; bits &= bits - 1) {
+                fn(static_cast<uint8_t>((w << 5) | static_cast<uint32_t>(__builtin_ctz(bits))));
+            }
+        }
+    }
+};
@@ -2,21 +2,36 @@
 
 #include <cstdint>
 #include <algorithm>
+#include <atomic>
 #include "adsr.h"
-#include "SVF.h"
+#include "svf.h"
 #include "constants.h"
+#include "waveforms.h"
+#include "dspMath.h"
 
 class Osc {
 public:
-    static constexpr uint32_t TABLE_SIZE = 4096;
     static constexpr uint32_t MIDI_TABLE_SIZE = 128;
 
     Osc() noexcept = default; 
     ~Osc() = default;
 
     void init() noexcept;
+
+    // Shared wavetable slots and note table, set up once on first use
+    static void initTables() noexcept;
     
-    __attribute__((always_inline)) inline void process(float* __restrict__ buffer) noexcept {
+    using TableSample = int16_t;  // Q15 tables, same format as the library in flash
+#if SYNTH_FIXED_POINT
+    using MixSample = int32_t;    // Q27 mix bus, headroom for all voices
+#else
+    using MixSample = float;
+#endif
+
+    // Renders frames [begin, end) of the block. VoiceManager splits a block at its note events,
+    // every block still starts at frame 0 and ends at NUM_FRAMES.
+    __attribute__((always_inline)) inline void process(MixSample* __restrict__ buffer, uint32_t begin = 0,
+                                                       uint32_t end = Constants::NUM_FRAMES) noexcept {
         // Queue next note if a note is waiting and voice is idle
         if (!_adsr.isActive() && _pending.waiting) {
             executeNoteOn(_pending.midiNote, _pending.velocity);
@@ -25,46 +40,41 @@ public:
         // Dont process if still idle
         if (!_adsr.isActive()) return;
 
-        // Block-rate vibrato calculation
-        const float vibratoMod = 1.0f + (_lfoValue * _modDepth * 0.02f);
-        const uint32_t activeInc = static_cast<uint32_t>(_phaseInc * vibratoMod);
-
-        uint32_t ph = _ph;
-        const float morph = _morph;
-        const float amp = _amp;
-        static constexpr float invFraction = 1.0f / 1048576.0f; 
-
-        for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) {
-            const uint32_t idx1 = ph >> 20;
-            const uint32_t idx2 = (idx1 + 1) & (TABLE_SIZE - 1);
-            const float fraction = static_cast<float>(ph & 0xFFFFF) * invFraction;
-
-            float sample;
-            if (morph <= 0.0f) {
-                sample = _wavetableA[idx1] + (_wavetableA[idx2] - _wavetableA[idx1]) * fraction;
-            } else if (morph >= 1.0f) {
-                sample = _wavetableB[idx1] + (_wavetableB[idx2] - _wavetableB[idx1]) * fraction;
-            } else {
-                const float s1 = _wavetableA[idx1] + (_wavetableA[idx2] - _wavetableA[idx1]) * fraction;
-                const float s2 = _wavetableB[idx1] + (_wavetableB[idx2] - _wavetableB[idx1]) * fraction;
-                sample = s1 + morph * (s2 - s1);
+        // Amplitude and morph ramp from where the last block left them, see rampView().
+        // A note started since then plays the rest of its first block on the current settings.
+        if (begin == 0 || _fresh) {
+            if (_fresh) {
+                _morphPrev = _morph;
+                _ampPrev = _amp;
+                _fresh = false;
             }
+            _ampStep = (_amp - _ampPrev) * (1.0f / Constants::NUM_FRAMES);
+            _ampFrom = _ampPrev;
+            _filter.beginBlock();
+            _filterR.beginBlock();
+        }
 
-            float env = _adsr.getNextSample();
-            if (env <= 0.0f && _pending.waiting) {
-                executeNoteOn(_pending.midiNote, _pending.velocity);
-                env = _adsr.getNextSample(); // Get the first attack sample
-           }
-
-            sample *= amp * env;
-            sample = _filter.process(sample);
+        float env[Constants::NUM_FRAMES];
+        uint32_t start = begin;
+        while (true) {
+            const uint32_t stop = start + _adsr.renderBlock(env + start, end - start);
 
-            buffer[i << 1] += sample;
-            buffer[(i << 1) + 1] += sample;
+            // Kill ramp ran out mid-run with a note waiting, it starts on the very next sample
+            if (stop < end && _pending.waiting) {
+                renderRun(buffer, env, start, stop);
+                executeNoteOn(_pending.midiNote, _pending.velocity);
+                start = stop;
+                continue;
+            }
 
-            ph += activeInc;
+            // Any zero tail still runs through the filter so it rings out
+            renderRun(buffer, env, start, end);
+            if (end == Constants::NUM_FRAMES) {
+                _morphPrev = _morph;
+                _ampPrev = _amp;
+            }
+            return;
         }
-        _ph = ph;
     }
     
     void setAmplitude(float amp) noexcept {_amp = std::clamp(amp, 0.0f, 1.0f);}
@@ -80,54 +90,476 @@ public:
     void setDecay(float seconds) noexcept { _adsr.setDecay(seconds); }
     void setSustain(float value) noexcept { _adsr.setSustain(value); }
     void setRelease(float seconds) noexcept { _adsr.setRelease(seconds); }
-    void setCutoff(float freq) noexcept { _filter.setCutoff(freq); }
-    void setResonance(float res) noexcept { _filter.setResonance(res); }
-    
-    // Mod wheel depth setter
-    void setModWheel(float depth) noexcept { _modDepth = std::clamp(depth, 0.0f, 1.0f); }
+    void setCutoff(float freq) noexcept {
+        _filter.setCutoff(freq);
+        _filterR.setTuning(_filter.getTuning());
+    }
+    void setResonance(float res) noexcept {
+        _filter.setResonance(res);
+        _filterR.setTuning(_filter.getTuning());
+    }
+    void setFilter(const SVF::Tuning& tuning) noexcept {
+        _filter.setTuning(tuning);
+        _filterR.setTuning(tuning);
+    }
+
+    // Unison: 1 to MAX_UNISON copies of the oscillator, the outer ones detuned by +-detune
+    // semitones and panned to +-spread (0 mono, 1 hard left and right)
+    static constexpr uint32_t MAX_UNISON = 7;
+    void setUnison(uint32_t copies, float detune, float spread) noexcept;
+
+    // Pitch modulation for the next block as a frequency ratio, see ModMatrix
+    void setPitchMod(float ratio) noexcept {
+        if (ratio == _pitchMod) return;
+        _pitchMod = ratio;
+        updateMipLevel();
+    }
+
+    // Cheaper kernels the load governor can switch a voice to, see LoadGovernor. The filter
+    // always keeps running, dropping it mid-note would step the output.
+    enum class Quality : uint8_t {
+        FULL,
+        NEAREST         // Nearest table sample, no interpolation
+    };
+    void setQuality(Quality quality) noexcept { _quality = quality; }
+
+    // Fast fade to silence with no note waiting, for shedding voices
+    void kill() noexcept { _adsr.kill(); }
 
     [[nodiscard]] bool isActive() const noexcept { return _adsr.isActive(); }
+    [[nodiscard]] bool isKilled() const noexcept { return _adsr.isKilled(); }
+    [[nodiscard]] bool hasPendingNote() const noexcept { return _pending.waiting; }
     [[nodiscard]] float getAdsrLevel() const noexcept { return _adsr.getLevel(); }
 
     void forceReset() noexcept;
 
     static void getMorphedPreview(float* targetBuffer, uint16_t size, float morph) noexcept;
+    // Length of the crossfade when a slot switches waveform (~10.7 ms), a whole number of blocks
+    static constexpr uint32_t FADE_FRAMES = 512;
+
+    // Points a slot at a library waveform right away, only for setup before audio starts
     static void loadWaveform(uint8_t libraryIdx, uint8_t slot) noexcept;
+    // Main loop side: the audio callback switches the slot at its next block, optionally fading over FADE_FRAMES
+    static void requestWaveform(uint8_t libraryIdx, uint8_t slot, bool crossfade = true) noexcept;
+    // Main loop side: scan a multi-frame set with morph as the position instead of the A/B slots.
+    // Any index past the last set goes back to the slots. Applied at the next block, without a fade.
+    static void requestWavetableSet(uint8_t setIdx) noexcept;
+    [[nodiscard]] static uint8_t getActiveSet() noexcept { return _currentSet; }
+    // Audio side, once per block before any voice renders
+    static void updateSlots() noexcept;
     [[nodiscard]] static uint8_t getActiveIdx(uint8_t slot) noexcept { return _currentIdx[slot]; }
+    static constexpr uint8_t NO_SET = 0xFF;
 
     static void setPitchBend(int16_t bendValue) noexcept;
     void applyPitchBend() noexcept;
-
-    // Global LFO tick
-    static void updateGlobalLFO() noexcept;
     
 private:
+    // The structure-of-arrays engine renders from the same shared tables, LFO and bend state
+    friend class VoiceBank;
+
     float _freq{440.0f};
     float _amp{0.5f};
     float _morph{0.0f};
-    float _modDepth{0.0f};
+    float _pitchMod{1.0f};
+
+    // Block-rate ramps: values at the end of the last block, and this block's start and per-frame step
+    float _morphPrev{0.0f};
+    float _ampPrev{0.5f};
+    float _ampFrom{0.5f}, _ampStep{0.0f};
+    bool _fresh{false};
     
     uint32_t _ph{0};
     uint32_t _phaseInc{0};
+    Quality _quality{Quality::FULL};
+
+    // Band-limited mip level for the current pitch, see WaveMip::levelFor()
+    uint32_t _mipLevel{0};
 
     void executeNoteOn(uint32_t midiNote, float amp) noexcept;
+
+    // Tables a voice reads for one block, see tableView()
+    struct TableView {
+        const TableSample* primary;     // Slot the voice plays (A, or B when morphed fully over)
+        const TableSample* secondary;   // Other slot while crossfading between A and B, else nullptr
+        const TableSample* fadeFrom;    // Old table of primary while a slot switch fades in, else nullptr
+        float weight;                   // Share of secondary before the first frame
+        float weightStep;               // Added per frame, frame i plays weight + weightStep * (i + 1)
+        uint32_t topLevel;              // First mip level the tables store, see FrameMip
+    };
+
+    enum class MorphMode : uint8_t { Single, Crossfade };
+
+    [[nodiscard]] static TableView tableView(float morph) noexcept {
+        if (_set) {
+            // Scanning: morph is the position in the set, only the two frames around it are read
+            const uint32_t last = _set->frames - 1;
+            const float pos = morph * static_cast<float>(last);
+            const uint32_t frame = std::min(static_cast<uint32_t>(pos), last);
+            const TableSample* primary = _set->data + frame * FrameMip::FRAME_SIZE;
+            const float weight = pos - static_cast<float>(frame);
+            if (frame == last || weight <= 0.0f) return {primary, nullptr, nullptr, 0.0f, 0.0f, FrameMip::TOP_LEVEL};
+            return {primary, primary + FrameMip::FRAME_SIZE, nullptr, weight, 0.0f, FrameMip::TOP_LEVEL};
+        }
+
+        const TableSample* fadeA = (_fadeSlot == 0) ? _fadeFrom : nullptr;
+        const TableSample* fadeB = (_fadeSlot == 1) ? _fadeFrom : nullptr;
+        if (morph <= 0.0f) return {_slot[0], nullptr, fadeA, 0.0f, 0.0f, 0};
+        if (morph >= 1.0f) return {_slot[1], nullptr, fadeB, 0.0f, 0.0f, 0};
+        // The fading slot is always primary so a kernel only ever fades one table
+        if (fadeB) return {_slot[1], _slot[0], fadeB, 1.0f - morph, 0.0f, 0};
+        return {_slot[0], _slot[1], fadeA, morph, 0.0f, 0};
+    }
+
+    // tableView(to) with the weight ramping across the block from where morph 'from' had it.
+    // Only ramps while both ends read the same primary table, crossing to another pair steps.
+    [[nodiscard]] static TableView rampView(float from, float to) noexcept {
+        TableView view = tableView(to);
+        if (from == to) return view;
+        const TableView prev = tableView(from);
+        if (prev.primary != view.primary) return view;
+
+        float target = view.weight;
+        if (!view.secondary) {
+            // Ramping out of a crossfade, keep reading the old secondary down to zero
+            if (!prev.secondary) return view;
+            view.secondary = prev.secondary;
+            target = 0.0f;
+        } else if (prev.secondary && prev.secondary != view.secondary) {
+            return view;
+        }
+        view.weight = prev.weight;
+        view.weightStep = (target - prev.weight) * (1.0f / Constants::NUM_FRAMES);
+        return view;
+    }
+
+    // Picks the specialized kernel once per run, nothing in the sample loop branches on it
+    __attribute__((always_inline)) inline void renderRun(MixSample* __restrict__ buffer, const float* __restrict__ env,
+                                                         uint32_t begin, uint32_t end) noexcept {
+        const TableView view = rampView(_morphPrev, _morph);
+        if (_quality == Quality::FULL) renderFilter<true>(view, buffer, env, begin, end);
+        else renderFilter<false>(view, buffer, env, begin, end);
+    }
+
+    template <bool Interp>
+    __attribute__((always_inline)) inline void renderFilter(const TableView& view, MixSample* __restrict__ buffer,
+                                                            const float* __restrict__ env, uint32_t begin, uint32_t end) noexcept {
+        const bool unison = _unison > 1;
+        if (_filter.isBypassed()) {
+            if (unison) renderMorph<false, true, Interp>(view, buffer, env, begin, end);
+            else renderMorph<false, false, Interp>(view, buffer, env, begin, end);
+        } else {
+            if (unison) renderMorph<true, true, Interp>(view, buffer, env, begin, end);
+            else renderMorph<true, false, Interp>(view, buffer, env, begin, end);
+        }
+    }
+
+    template <bool Filter, bool Unison, bool Interp>
+    __attribute__((always_inline)) inline void renderMorph(const TableView& view, MixSample* __restrict__ buffer,
+                                                           const float* __restrict__ env, uint32_t begin, uint32_t end) noexcept {
+        if (view.secondary) {
+            if (view.fadeFrom) render<MorphMode::Crossfade, Filter, true, Unison, Interp>(view, buffer, env, begin, end);
+            else render<MorphMode::Crossfade, Filter, false, Unison, Interp>(view, buffer, env, begin, end);
+        } else {
+            if (view.fadeFrom) render<MorphMode::Single, Filter, true, Unison, Interp>(view, buffer, env, begin, end);
+            else render<MorphMode::Single, Filter, false, Unison, Interp>(view, buffer, env, begin, end);
+        }
+    }
+
+    template <MorphMode Mode, bool Filter, bool Fade, bool Unison, bool Interp>
+    __attribute__((always_inline)) inline void render(const TableView& view, MixSample* __restrict__ buffer,
+                                                      const float* __restrict__ env, uint32_t begin, uint32_t end) noexcept {
+        if constexpr (Unison) renderUnison<Mode, Filter, Fade, Interp>(view, buffer, env, begin, end);
+        else renderKernel<Mode, Filter, Fade, Interp>(view, buffer, env, begin, end);
+    }
+
+    // One table read: linear interpolation, or the sample at or below the phase for the cheap kernels
+#if SYNTH_FIXED_POINT
+    template <bool Interp>
+    [[nodiscard]] __attribute__((always_inline)) static inline int32_t tap(const TableSample* __restrict__ table,
+                                                                         uint32_t idx1, uint32_t idx2, int32_t fraction) noexcept {
+        if constexpr (Interp) return Dsp::lerpQ15(table[idx1], table[idx2], fraction);
+        else return table[idx1];
+    }
+#else
+    template <bool Interp>
+    [[nodiscard]] __attribute__((always_inline)) static inline float tap(const TableSample* __restrict__ table,
+                                                                       uint32_t idx1, uint32_t idx2, float fraction) noexcept {
+        if constexpr (Interp) return table[idx1] + (table[idx2] - table[idx1]) * fraction;
+        else return table[idx1];
+    }
+#endif
+
+    // Oscillator, gain and filter for frames [begin, end) of the block, env holds the envelope
+    template <MorphMode Mode, bool Filter, bool Fade, bool Interp>
+    __attribute__((always_inline)) inline void renderKernel(const TableView& view, MixSample* __restrict__ buffer,
+                                                            const float* __restrict__ env, uint32_t begin, uint32_t end) noexcept {
+        // Block-rate pitch modulation
+        const uint32_t activeInc = static_cast<uint32_t>(_phaseInc * _pitchMod);
+
+        uint32_t ph = _ph;
+        const float ampFrom = _ampFrom;
+        const float ampStep = _ampStep;
+
+        // Mip level was picked from the phase increment, the top bits of the phase index into it
+        const uint32_t level = std::max(_mipLevel, view.topLevel);
+        const uint32_t offset = WaveMip::OFFSETS[level] - WaveMip::OFFSETS[view.topLevel];
+        const uint32_t shift = 32 - WaveMip::sizeBits(level);
+        const uint32_t mask = 0xFFFFFFFFu >> shift;
+        const TableSample* __restrict__ tableA = view.primary + offset;
+        const TableSample* __restrict__ tableB = (Mode == MorphMode::Crossfade) ? view.secondary + offset : nullptr;
+        const TableSample* __restrict__ tableOld = Fade ? view.fadeFrom + offset : nullptr;
+        const uint32_t fadeFrame = _fadeFrame + 1;
+
+#if SYNTH_FIXED_POINT
+        // Q15 weights for the SMLAD interpolations, shift is always > 15 since tables are <= 2048 samples
+        const uint32_t fracShift = shift - 15;
+        const int32_t morphQ15 = static_cast<int32_t>(view.weight * 32767.0f);
+        const int32_t morphEndQ15 = static_cast<int32_t>((view.weight + view.weightStep * Constants::NUM_FRAMES) * 32767.0f);
+        const int32_t morphDeltaQ15 = morphEndQ15 - morphQ15;
+#else
+        const uint32_t fracMask = (1u << shift) - 1;
+        const float invFraction = 1.0f / static_cast<float>(1u << shift);
+        const float morph = view.weight;
+        const float morphStep = view.weightStep;
+#endif
+        MixSample last{};  // Last sample of a bypassed run, see SVF::track()
+
+        for (uint32_t i = begin; i < end; ++i) {
+            const uint32_t idx1 = ph >> shift;
+            const uint32_t idx2 = (idx1 + 1) & mask;
+
+#if SYNTH_FIXED_POINT
+            const int32_t fraction = static_cast<int32_t>((ph >> fracShift) & 0x7FFF);
+
+            int32_t sample = tap<Interp>(tableA, idx1, idx2, fraction); // Q15
+            if constexpr (Fade) {
+                const int32_t old = tap<Interp>(tableOld, idx1, idx2, fraction);
+                const int32_t fadeQ15 = static_cast<int32_t>(((fadeFrame + i) * 0x7FFFu) / FADE_FRAMES);
+                sample = Dsp::lerpQ15(static_cast<int16_t>(old), static_cast<int16_t>(sample), fadeQ15);
+            }
+            if constexpr (Mode == MorphMode::Crossfade) {
+                const int32_t s2 = tap<Interp>(tableB, idx1, idx2, fraction);
+                const int32_t weight = morphQ15 + morphDeltaQ15 * static_cast<int32_t>(i + 1) / static_cast<int32_t>(Constants::NUM_FRAMES);
+                sample = Dsp::lerpQ15(static_cast<int16_t>(sample), static_cast<int16_t>(s2), weight);
+            }
+
+            // Envelope stays float, one VCVT per sample turns amp * env into a Q15 gain
+            const float amp = ampFrom + ampStep * static_cast<float>(i + 1);
+            const int32_t gain = static_cast<int32_t>(amp * 32767.0f * env[i]);
+            int32_t out = (sample * gain) >> 3; // Q30 -> Q27
+            if constexpr (Filter) out = _filter.processQ(out);
+            else last = out;
+
+            buffer[i << 1] = Dsp::qadd(buffer[i << 1], out);
+            buffer[(i << 1) + 1] = Dsp::qadd(buffer[(i << 1) + 1], out);
+#else
+            const float fraction = static_cast<float>(ph & fracMask) * invFraction;
+
+            float sample = tap<Interp>(tableA, idx1, idx2, fraction);
+            if constexpr (Fade) {
+                const float old = tap<Interp>(tableOld, idx1, idx2, fraction);
+                const float fade = static_cast<float>(fadeFrame + i) * (1.0f / FADE_FRAMES);
+                sample = old + fade * (sample - old);
+            }
+            if constexpr (Mode == MorphMode::Crossfade) {
+                const float s2 = tap<Interp>(tableB, idx1, idx2, fraction);
+                sample = sample + (morph + morphStep * static_cast<float>(i + 1)) * (s2 - sample);
+            }
+
+            // Interpolation runs on raw Q15, scaled back here
+            const float amp = ampFrom + ampStep * static_cast<float>(i + 1);
+            sample *= (amp * WaveMip::Q15_SCALE) * env[i];
+            if constexpr (Filter) sample = _filter.process(sample);
+            else last = sample;
+
+            buffer[i << 1] += sample;
+            buffer[(i << 1) + 1] += sample;
+#endif
+
+            ph += activeInc;
+        }
+        _ph = ph;
+
+#if SYNTH_FIXED_POINT
+        if constexpr (!Filter) _filter.trackQ(last);
+#else
+        if constexpr (!Filter) _filter.track(last);
+#endif
+    }
+
+    // Unison version of renderKernel: every copy steps its own phase from _uniPhase and is panned
+    // into a left and right sum, then gain and filter run once per side instead of once per copy
+    template <MorphMode Mode, bool Filter, bool Fade, bool Interp>
+    __attribute__((always_inline)) inline void renderUnison(const TableView& view, MixSample* __restrict__ buffer,
+                                                            const float* __restrict__ env, uint32_t begin, uint32_t end) noexcept {
+        const uint32_t copies = _unison;
+        const uint32_t activeInc = static_cast<uint32_t>(_phaseInc * _pitchMod);
+        uint32_t inc[MAX_UNISON];
+        for (uint32_t c = 0; c < copies; ++c) inc[c] = static_cast<uint32_t>(activeInc * _uniRatio[c]);
+
+        const float ampFrom = _ampFrom;
+        const float ampStep = _ampStep;
+
+        // The last copy is detuned highest, its increment picks the mip level for all of them
+        const uint32_t level = std::max(WaveMip::levelFor(inc[copies - 1]), view.topLevel);
+        const uint32_t offset = WaveMip::OFFSETS[level] - WaveMip::OFFSETS[view.topLevel];
+        const uint32_t shift = 32 - WaveMip::sizeBits(level);
+        const uint32_t mask = 0xFFFFFFFFu >> shift;
+        const TableSample* __restrict__ tableA = view.primary + offset;
+        const TableSample* __restrict__ tableB = (Mode == MorphMode::Crossfade) ? view.secondary + offset : nullptr;
+        const TableSample* __restrict__ tableOld = Fade ? view.fadeFrom + offset : nullptr;
+        const uint32_t fadeFrame = _fadeFrame + 1;
+
+#if SYNTH_FIXED_POINT
+        const uint32_t fracShift = shift - 15;
+        const int32_t morphQ15 = static_cast<int32_t>(view.weight * 32767.0f);
+        const int32_t morphEndQ15 = static_cast<int32_t>((view.weight + view.weightStep * Constants::NUM_FRAMES) * 32767.0f);
+        const int32_t morphDeltaQ15 = morphEndQ15 - morphQ15;
+#else
+        const uint32_t fracMask = (1u << shift) - 1;
+        const float invFraction = 1.0f / static_cast<float>(1u << shift);
+        const float morph = view.weight;
+        const float morphStep = view.weightStep;
+#endif
+        MixSample lastL{}, lastR{};
+
+        for (uint32_t i = begin; i < end; ++i) {
+#if SYNTH_FIXED_POINT
+            const int32_t fadeQ15 = Fade ? static_cast<int32_t>(((fadeFrame + i) * 0x7FFFu) / FADE_FRAMES) : 0;
+            const int32_t weight = (Mode == MorphMode::Crossfade)
+                ? morphQ15 + morphDeltaQ15 * static_cast<int32_t>(i + 1) / static_cast<int32_t>(Constants::NUM_FRAMES) : 0;
+
+            // Copy gains sum to at most sqrt(MAX_UNISON) < 4, Q28 sums leave room for that
+            int32_t left = 0, right = 0;
+            for (uint32_t c = 0; c < copies; ++c) {
+                const uint32_t ph = _uniPhase[c];
+                const uint32_t idx1 = ph >> shift;
+                const uint32_t idx2 = (idx1 + 1) & mask;
+                const int32_t fraction = static_cast<int32_t>((ph >> fracShift) & 0x7FFF);
+
+                int32_t sample = tap<Interp>(tableA, idx1, idx2, fraction);
+                if constexpr (Fade) {
+                    const int32_t old = tap<Interp>(tableOld, idx1, idx2, fraction);
+                    sample = Dsp::lerpQ15(static_cast<int16_t>(old), static_cast<int16_t>(sample), fadeQ15);
+                }
+                if constexpr (Mode == MorphMode::Crossfade) {
+                    const int32_t s2 = tap<Interp>(tableB, idx1, idx2, fraction);
+                    sample = Dsp::lerpQ15(static_cast<int16_t>(sample), static_cast<int16_t>(s2), weight);
+                }
+                left += (sample * _uniGainQ15[c][0]) >> 2;
+                right += (sample * _uniGainQ15[c][1]) >> 2;
+                _uniPhase[c] = ph + inc[c];
+            }
+
+            const float amp = ampFrom + ampStep * static_cast<float>(i + 1);
+            const int32_t gain = static_cast<int32_t>(amp * 32767.0f * env[i]);
+            // Sums can exceed full scale, so they drop to Q14 before the gain: Q29 -> Q27
+            int32_t outL = ((left >> 14) * gain) >> 2;
+            int32_t outR = ((right >> 14) * gain) >> 2;
+            if constexpr (Filter) {
+                outL = _filter.processQ(outL);
+                outR = _filterR.processQ(outR);
+            } else {
+                lastL = outL;
+                lastR = outR;
+            }
+
+            buffer[i << 1] = Dsp::qadd(buffer[i << 1], outL);
+            buffer[(i << 1) + 1] = Dsp::qadd(buffer[(i << 1) + 1], outR);
+#else
+            const float fade = Fade ? static_cast<float>(fadeFrame + i) * (1.0f / FADE_FRAMES) : 0.0f;
+            const float weight = (Mode == MorphMode::Crossfade) ? morph + morphStep * static_cast<float>(i + 1) : 0.0f;
+
+            float left = 0.0f, right = 0.0f;
+            for (uint32_t c = 0; c < copies; ++c) {
+                const uint32_t ph = _uniPhase[c];
+                const uint32_t idx1 = ph >> shift;
+                const uint32_t idx2 = (idx1 + 1) & mask;
+                const float fraction = static_cast<float>(ph & fracMask) * invFraction;
+
+                float sample = tap<Interp>(tableA, idx1, idx2, fraction);
+                if constexpr (Fade) {
+                    const float old = tap<Interp>(tableOld, idx1, idx2, fraction);
+                    sample = old + fade * (sample - old);
+                }
+                if constexpr (Mode == MorphMode::Crossfade) {
+                    const float s2 = tap<Interp>(tableB, idx1, idx2, fraction);
+                    sample = sample + weight * (s2 - sample);
+                }
+                left += sample * _uniGain[c][0];
+                right += sample * _uniGain[c][1];
+                _uniPhase[c] = ph + inc[c];
+            }
+
+            const float amp = ampFrom + ampStep * static_cast<float>(i + 1);
+            const float gain = (amp * WaveMip::Q15_SCALE) * env[i];
+            left *= gain;
+            right *= gain;
+            if constexpr (Filter) {
+                left = _filter.process(left);
+                right = _filterR.process(right);
+            } else {
+                lastL = left;
+                lastR = right;
+            }
+
+            buffer[i << 1] += left;
+            buffer[(i << 1) + 1] += right;
+#endif
+        }
+
+        // The main phase keeps time too, so leaving unison picks up where a single copy would be
+        _ph += activeInc * (end - begin);
+
+#if SYNTH_FIXED_POINT
+        if constexpr (!Filter) {
+            _filter.trackQ(lastL);
+            _filterR.trackQ(lastR);
+        }
+#else
+        if constexpr (!Filter) {
+            _filter.track(lastL);
+            _filterR.track(lastR);
+        }
+#endif
+    }
     
-    static float _wavetableA[TABLE_SIZE] __attribute__((section(".ccmram")));
-    static float _wavetableB[TABLE_SIZE] __attribute__((section(".ccmram")));
+    // Slots point straight at library tables in flash. The main loop posts a request and the
+    // audio callback swaps the pointer at the next block boundary, see updateSlots().
+    static const TableSample* _slot[2];
+    static std::atomic<uint8_t> _requested[2];
+    static constexpr uint8_t NO_REQUEST = 0xFF;
+    static constexpr uint8_t FADE_FLAG = 0x80;
+
+    // One slot switch fades at a time, any other request waits for it to finish
+    static const TableSample* _fadeFrom;
+    static uint8_t _fadeSlot;
+    static uint32_t _fadeFrame;     // Frames of the fade already played at the start of this block
+
+    // Scanning set replacing the two slots when not null, switched the same way as the slots
+    static const WavetableSet* _set;
+    static std::atomic<uint8_t> _requestedSet;
+    static uint8_t _currentSet;
     static float _midiTable[MIDI_TABLE_SIZE] __attribute__((section(".ccmram")));
     
     Adsr _adsr;
     SVF _filter;
+    SVF _filterR;       // Right side in unison, runs off the same tuning as _filter
+
+    // Unison copies, contiguous so one loop steps them all. Set by setUnison(), unused at 1.
+    uint32_t _unison{1};
+    uint32_t _uniPhase[MAX_UNISON]{};
+    float _uniRatio[MAX_UNISON]{};      // Detune as a frequency ratio, ascending
+    float _uniGain[MAX_UNISON][2]{};    // Left and right pan gains, including the 1/sqrt(copies) level
+#if SYNTH_FIXED_POINT
+    int32_t _uniGainQ15[MAX_UNISON][2]{};
+#endif
     void calcPhaseInc() noexcept;
+    void updateMipLevel() noexcept;
 
     static uint8_t _currentIdx[2];
     static float _pitchBendMult;
 
-    // Global LFO members
-    static uint32_t _lfoPhase;
-    static uint32_t _lfoInc;
-    static float _lfoValue;
-
     struct PendingNote {
         uint32_t midiNote;
         float velocity;
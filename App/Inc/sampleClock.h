@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "constants.h"
+
+// Places tick stamps (see CycleCounter) on the sample clock, the frame count VoiceManager::getFrame()
+// reports. The audio callback marks the tick each block starts rendering on and a stamp lands in
+// proportion between marks, so the measured block period absorbs any drift between the CPU and
+// audio clocks.
+class SampleClock {
+public:
+    // Audio callback, before rendering the block that starts at frame
+    void beginBlock(uint32_t ticks, uint32_t frame) noexcept {
+        const uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        _period = ticks - _ticks;
+        _ticks = ticks;
+        _frame = frame;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // Any context. The frame a stamp falls on, stamps from before the last mark come out earlier.
+    // A mark landing mid-read is caught by the sequence count and the read retried.
+    [[nodiscard]] uint32_t toFrame(uint32_t stamp) const noexcept {
+        uint32_t seq, ticks, period, frame;
+        do {
+            seq = _seq.load(std::memory_order_acquire);
+            ticks = _ticks;
+            period = _period;
+            frame = _frame;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        } while ((seq & 1) || seq != _seq.load(std::memory_order_relaxed));
+
+        if (period == 0) return frame;
+        const int64_t offset = static_cast<int64_t>(static_cast<int32_t>(stamp - ticks)) * Constants::NUM_FRAMES / period;
+        return frame + static_cast<uint32_t>(static_cast<int32_t>(offset));
+    }
+
+private:
+    std::atomic<uint32_t> _seq{0};
+    uint32_t _ticks{0};
+    uint32_t _period{0};
+    uint32_t _frame{0};
+};
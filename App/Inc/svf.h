@@ -1,18 +1,72 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <algorithm>
+#include "constants.h"
+#include "dspMath.h"
 
 class SVF {
 public:
+    struct Coefficients {
+        float a1, a2, a3;
+    };
+
+    // Solved coefficients for one (cutoff, resonance) setting. Filters hold a reference to one,
+    // so voices sharing a setting share the tan() and divide, see FilterCache.
+    struct Tuning {
+        float cutoff{-1.0f}, resonance{-1.0f};  // Key, negative until tune() runs
+        float a1{0.0f}, a2{0.0f}, a3{0.0f};
+        bool bypassed{false};
+#if SYNTH_FIXED_POINT
+        int32_t a1q{0}, a2q{0}, a3q{0};
+#endif
+    };
+
+    // Cutoff at or above this with no resonance counts as a fully open filter (the knob tops out at 20 kHz)
+    static constexpr float BYPASS_CUTOFF = 19000.0f;
+
     SVF() = default;
 
     void init() noexcept;
+    void reset() noexcept;
+
+    // Runs off a shared tuning, which must outlive its use here
+    void setTuning(const Tuning& t) noexcept { tuning = &t; }
+    [[nodiscard]] const Tuning& getTuning() const noexcept { return *tuning; }
+
+    // Private tuning for this filter alone, starting from whatever it ran with before
     void setCutoff(float cutoffHz) noexcept;
     void setResonance(float resonance) noexcept;
-    void reset() noexcept;
+
+    // Fully open and flat, the voice can skip the filter entirely
+    [[nodiscard]] bool isBypassed() const noexcept { return tuning->bypassed; }
+
+    // While bypassed the state follows the signal going past, where an open filter settles, so
+    // the filter picks up without a step when the cutoff closes again
+    void track(float output) noexcept { s1 = 0.0f; s2 = output; }
+#if SYNTH_FIXED_POINT
+    void trackQ(int32_t output) noexcept { s1q = 0; s2q = output; }
+#endif
+
+    // Block-rate ramp: over the next block the coefficients move linearly from where the last
+    // block ended to the current tuning, one add each per sample. reset() drops the ramp,
+    // including the rest of one already running this block.
+    void beginBlock() noexcept;
+
+    // Solves t for the setting, skipped when t already holds it
+    static void tune(Tuning& t, float cutoffHz, float resonance) noexcept;
+
+    // Parameter mapping shared with code that runs the filter math outside this class
+    [[nodiscard]] static float cutoffToG(float cutoffHz) noexcept;
+    [[nodiscard]] static float resonanceToK(float resonance) noexcept;
+    [[nodiscard]] static Coefficients solve(float g, float k) noexcept;
 
     [[nodiscard]] __attribute__((always_inline)) inline float process(float input) noexcept {
+        const float a1 = (ramp.a1 += step.a1);
+        const float a2 = (ramp.a2 += step.a2);
+        const float a3 = (ramp.a3 += step.a3);
+
         float v3 = input - s2;
         float v1 = a1 * s1 + a2 * v3;
         float v2 = s2 + a2 * s1 + a3 * v3;
@@ -25,8 +79,26 @@ public:
         return v2;
     }
 
+#if SYNTH_FIXED_POINT
+    // Same topology on Q27 signals with Q31 coefficients, every multiply is one SMMULR
+    [[nodiscard]] __attribute__((always_inline)) inline int32_t processQ(int32_t input) noexcept {
+        const int32_t a1q = (rampQ.a1 += stepQ.a1);
+        const int32_t a2q = (rampQ.a2 += stepQ.a2);
+        const int32_t a3q = (rampQ.a3 += stepQ.a3);
+
+        const int32_t v3 = input - s2q;
+        const int32_t v1 = (Dsp::smmulr(a1q, s1q) + Dsp::smmulr(a2q, v3)) << 1;
+        const int32_t v2 = s2q + ((Dsp::smmulr(a2q, s1q) + Dsp::smmulr(a3q, v3)) << 1);
+
+        s1q = softClipQ27(2 * v1 - s1q);
+        s2q = 2 * v2 - s2q;
+
+        return v2;
+    }
+#endif
+
 private:
-    void updateCoefficients() noexcept;
+    void own() noexcept;
 
     [[nodiscard]] inline float fast_tanh(float x) const noexcept {
         if (x < -3.0f) return -1.0f;
@@ -35,8 +107,56 @@ private:
         return x * (27.0f + x2) / (27.0f + 9.0f * x2);
     }
 
-    float sampleRate;
-    float g{0.0f}, k{2.0f};
-    float a1{0.0f}, a2{0.0f}, a3{0.0f};
+#if SYNTH_FIXED_POINT
+    // Cubic soft clip in place of fast_tanh, no divide: x - 4x^3/27, flat at +-1 beyond +-1.5
+    [[nodiscard]] __attribute__((always_inline)) inline int32_t softClipQ27(int32_t x) const noexcept {
+        static constexpr int32_t ONE = 1 << 27;
+        static constexpr int32_t KNEE = 3 << 26;              // 1.5
+        static constexpr int32_t FOUR_27THS = 318145725;      // 4/27 in Q31
+        if (x > KNEE) return ONE;
+        if (x < -KNEE) return -ONE;
+        const int32_t x30 = x << 3;                           // Q30
+        const int32_t x2 = Dsp::smmulr(x30, x30);             // Q28
+        const int32_t x3 = Dsp::smmulr(x2, x30);              // Q26
+        return x - (Dsp::smmulr(x3, FOUR_27THS) << 2);        // Q25 -> Q27
+    }
+#endif
+
+    Tuning privateTuning;
+    const Tuning* tuning{&privateTuning};
+    Coefficients ramp{}, step{}, last{};    // Value at the current sample, per-sample step, block end
+    bool snap{true};                        // Next block starts on the tuning instead of ramping to it
     float s1{0.0f}, s2{0.0f};
+
+#if SYNTH_FIXED_POINT
+    struct CoefficientsQ {
+        int32_t a1, a2, a3;
+    };
+    CoefficientsQ rampQ{}, stepQ{}, lastQ{};
+    int32_t s1q{0}, s2q{0};
+#endif
+};
+
+// Tunings for the distinct filter settings in use. Every voice asks for its setting once per
+// block, voices asking for the same one get the same entry, so the tan() and divide run once
+// per distinct setting and change rather than once per voice.
+class FilterCache {
+public:
+    // One entry per voice, plus a few for notes that start partway through a block
+    static constexpr uint32_t SIZE = Constants::NUM_VOICES + 4;
+
+    // Entries not asked for since the last beginBlock() may be retuned
+    void beginBlock() noexcept { ++_block; }
+    [[nodiscard]] const SVF::Tuning& get(float cutoffHz, float resonance) noexcept { return *lookup(cutoffHz, resonance, true); }
+
+    // For a voice starting partway through a block, once every voice has asked: null instead of
+    // retuning an entry another voice may still be using this block
+    [[nodiscard]] const SVF::Tuning* tryGet(float cutoffHz, float resonance) noexcept { return lookup(cutoffHz, resonance, false); }
+
+private:
+    const SVF::Tuning* lookup(float cutoffHz, float resonance, bool evictCurrent) noexcept;
+
+    SVF::Tuning _entries[SIZE];
+    uint32_t _lastUsed[SIZE]{};
+    uint32_t _block{1};
 };
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+
+// Render-time statistics for the two I2S callbacks plus a few health counters, reported over
+// USB MIDI as SysEx so load can be watched without a debugger. The audio side records into the
+// current interval, the main loop collects it (with the audio interrupts masked) and starts the
+// next one, so min/max/mean and the histogram cover the time since the last report while the
+// counters run from power-up.
+//
+// Request:  F0 7D 53 <command> F7
+// Report:   F0 7D 53 10 <FIELDS values, 5 bytes each, 7 bits per byte, low bits first> F7
+// Field order follows Report, see encode(). Host/Src/synthTelemetry.cpp decodes it.
+class Telemetry {
+public:
+    static constexpr uint32_t BINS = 16;
+    static constexpr uint32_t BINS_PER_DEADLINE = 12;   // Bins 12 and up are blocks past the deadline
+
+    enum class Callback : uint8_t { HALF, FULL, COUNT };
+    static constexpr uint32_t CALLBACKS = static_cast<uint32_t>(Callback::COUNT);
+
+    struct Timing {
+        uint32_t blocks{0};
+        uint32_t minTicks{0xFFFFFFFFu};
+        uint32_t maxTicks{0};
+        uint64_t sumTicks{0};
+        uint32_t histogram[BINS]{};
+    };
+
+    struct Report {
+        uint32_t tickRateKhz{0};
+        uint32_t deadlineTicks{0};
+        Timing timing[CALLBACKS];
+        uint32_t underruns{0};      // Blocks rendered past the deadline
+        uint32_t midiOverflows{0};  // Packets dropped by a full MIDI buffer
+        uint32_t midiHighWater{0};  // Most packets ever waiting in the USB MIDI buffer
+        uint32_t activeVoices{0};
+        uint32_t governorLevel{0};  // See LoadGovernor
+    };
+
+    // SysEx framing, 0x7D is the non-commercial manufacturer ID
+    static constexpr uint8_t MANUFACTURER = 0x7D;
+    static constexpr uint8_t DEVICE = 0x53;
+    static constexpr uint8_t REPORT = 0x10;
+
+    enum class Command : uint8_t {
+        NONE = 0x00,
+        SEND = 0x01,        // One report
+        STREAM_ON = 0x02,   // A report every STREAM_INTERVAL_MS
+        STREAM_OFF = 0x03
+    };
+    static constexpr uint32_t STREAM_INTERVAL_MS = 250;
+
+    static constexpr uint32_t FIELDS = 2 + CALLBACKS * (4 + BINS) + 5;
+    static constexpr uint32_t FIELD_BYTES = 5;
+    static constexpr uint32_t SYSEX_SIZE = 4 + FIELDS * FIELD_BYTES + 1;
+    static constexpr uint32_t USB_SIZE = ((SYSEX_SIZE + 2) / 3) * 4;
+
+    // Main loop side, before audio starts
+    void setDeadline(uint32_t ticks, uint32_t ticksPerSecond) noexcept;
+
+    // Audio side, the render time of one callback
+    void record(Callback cb, uint32_t ticks) noexcept {
+        Timing& t = _timing[static_cast<uint32_t>(cb)];
+        ++t.blocks;
+        t.sumTicks += ticks;
+        if (ticks < t.minTicks) t.minTicks = ticks;
+        if (ticks > t.maxTicks) t.maxTicks = ticks;
+        if (ticks > _deadline) ++_underruns;
+        const uint32_t bin = ticks / _binTicks;
+        ++t.histogram[(bin < BINS) ? bin : BINS - 1];
+    }
+
+    // Main loop side, must not be preempted by record(). Fills the timings and underruns and
+    // starts a new interval, the caller adds the counters kept elsewhere.
+    void collect(Report& out) noexcept;
+
+    // Writes the report as SysEx, SYSEX_SIZE bytes
+    static uint32_t encode(const Report& report, uint8_t* out) noexcept;
+    [[nodiscard]] static bool decode(const uint8_t* sysex, uint32_t len, Report& out) noexcept;
+    // Command of a request message, NONE for anything else
+    [[nodiscard]] static Command parseRequest(const uint8_t* sysex, uint32_t len) noexcept;
+
+    // Splits SysEx into 4-byte USB-MIDI event packets on cable 0, ((len + 2) / 3) * 4 bytes
+    static uint32_t toUsbPackets(const uint8_t* sysex, uint32_t len, uint8_t* out) noexcept;
+
+private:
+    Timing _timing[CALLBACKS];
+    uint32_t _deadline{0xFFFFFFFFu};
+    uint32_t _binTicks{0xFFFFFFFFu};
+    uint32_t _ticksPerSecond{0};
+    uint32_t _underruns{0};
+};
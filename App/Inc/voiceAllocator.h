@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "constants.h"
+
+// Decides which voice a note plays on. Every voice sits on one of four intrusive lists, each
+// ordered oldest first: FREE (silent), RELEASED (key up, still fading), SUSTAINED (key up, held
+// by a pedal) and HELD. A 128-entry table leads to the voices sounding each note, so note on,
+// note off and stealing cost the same at any polyphony and no call scans all voices or all notes.
+class VoiceAllocator {
+public:
+    static constexpr uint8_t NONE = 0xFF;
+    static constexpr uint8_t ANY_CHANNEL = 0xFF;
+    static_assert(Constants::NUM_VOICES < NONE, "Voice indices must fit in a byte");
+
+    enum class List : uint8_t { FREE, RELEASED, SUSTAINED, HELD, COUNT };
+
+    // Which sounding voice a note takes when none is free. Released voices always go first,
+    // then pedal-held ones, keys still down last.
+    enum class StealPolicy : uint8_t {
+        OLDEST,     // Longest on the first list that isn't empty
+        QUIETEST,   // Lowest envelope level, from the levels passed to allocate()
+        SAME_NOTE   // A released one still sounding the note, otherwise OLDEST
+    };
+
+    VoiceAllocator() noexcept;
+
+    void setPolicy(StealPolicy policy) noexcept { _policy = policy; }
+    [[nodiscard]] StealPolicy policy() const noexcept { return _policy; }
+
+    // A voice on list playing note on channel (or ANY_CHANNEL), NONE if there is none
+    [[nodiscard]] uint8_t find(uint8_t note, uint8_t channel, List list) const noexcept;
+
+    // Voice for a new note, moved to the newest end of HELD. Free voices are skipped when
+    // useFree is false, levels are the voices' envelope levels for QUIETEST. NONE when nothing
+    // is sounding either.
+    uint8_t allocate(uint8_t note, uint8_t channel, bool useFree, const float* levels) noexcept;
+
+    // A held voice played again becomes the newest
+    void retrigger(uint8_t voice) noexcept { moveTo(voice, List::HELD); }
+    void release(uint8_t voice) noexcept { moveTo(voice, List::RELEASED); }
+    void sustain(uint8_t voice) noexcept { moveTo(voice, List::SUSTAINED); }
+    void free(uint8_t voice) noexcept;
+
+    // Oldest voice on a list and the one after it, NONE at the end
+    [[nodiscard]] uint8_t oldest(List list) const noexcept { return _head[index(list)]; }
+    [[nodiscard]] uint8_t next(uint8_t voice) const noexcept { return _next[voice]; }
+    [[nodiscard]] bool empty(List list) const noexcept { return _head[index(list)] == NONE; }
+
+    [[nodiscard]] List list(uint8_t voice) const noexcept { return _list[voice]; }
+    [[nodiscard]] uint8_t note(uint8_t voice) const noexcept { return _note[voice]; }
+    [[nodiscard]] uint8_t channel(uint8_t voice) const noexcept { return _channel[voice]; }
+
+private:
+    static constexpr uint32_t index(List list) noexcept { return static_cast<uint32_t>(list); }
+    static constexpr uint32_t LISTS = static_cast<uint32_t>(List::COUNT);
+
+    void unlink(uint8_t voice) noexcept;
+    void append(uint8_t voice, List list) noexcept;
+    void moveTo(uint8_t voice, List list) noexcept {
+        unlink(voice);
+        append(voice, list);
+    }
+    void unmapNote(uint8_t voice) noexcept;
+    [[nodiscard]] uint8_t steal(uint8_t note, const float* levels) const noexcept;
+    [[nodiscard]] uint8_t quietest(List list, const float* levels) const noexcept;
+    [[nodiscard]] uint8_t firstSounding() const noexcept;
+
+    StealPolicy _policy{StealPolicy::OLDEST};
+
+    std::array<uint8_t, LISTS> _head;
+    std::array<uint8_t, LISTS> _tail;
+    std::array<uint8_t, Constants::NUM_VOICES> _prev;
+    std::array<uint8_t, Constants::NUM_VOICES> _next;
+    std::array<List, Constants::NUM_VOICES> _list;
+
+    // Sounding voices of each note, chained through _sameNote. Chains are as long as the number
+    // of voices sounding one note, normally one.
+    std::array<uint8_t, 128> _noteVoice;
+    std::array<uint8_t, Constants::NUM_VOICES> _sameNote;
+    std::array<uint8_t, Constants::NUM_VOICES> _note;
+    std::array<uint8_t, Constants::NUM_VOICES> _channel;
+};
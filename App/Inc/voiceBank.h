@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include "constants.h"
+#include "adsr.h"
+#include "svf.h"
+#include "osc.h"
+
+// Structure-of-arrays voice engine (SYNTH_SOA_VOICES).
+// Phase, increment, gain and filter state of every voice live in parallel arrays and the
+// per-sample kernel walks all active lanes in lockstep, so the branches Osc::process takes
+// per voice (idle check, pending note) are hoisted to the block.
+// Envelopes are rendered per lane up front into a [frame][lane] buffer.
+//
+// Unlike Osc, a pending note waiting on a stolen voice starts at the next block boundary
+// rather than on the exact sample the kill ramp hits zero (at most one block later).
+class VoiceBank {
+public:
+    static constexpr uint32_t LANES = Constants::NUM_VOICES;
+    static constexpr uint32_t GROUP = 4; // Lanes are processed in groups of 4, the SIMD width on the host
+
+    using MixSample = Osc::MixSample;
+
+    // Per-lane control object with the same interface VoiceManager uses on Osc
+    class Voice {
+    public:
+        void init() noexcept;
+
+        void noteOn(uint32_t midiNote, float amp) noexcept;
+        void noteOff() noexcept;
+
+        void setAmplitude(float amp) noexcept;
+        void setMorph(float morph) noexcept;
+        void setAttack(float seconds) noexcept { _adsr.setAttack(seconds); }
+        void setDecay(float seconds) noexcept { _adsr.setDecay(seconds); }
+        void setSustain(float value) noexcept { _adsr.setSustain(value); }
+        void setRelease(float seconds) noexcept { _adsr.setRelease(seconds); }
+        void setFilter(const SVF::Tuning& tuning) noexcept;
+        void setPitchMod(float ratio) noexcept;
+        // Lanes render in lockstep with one kernel, so shedding voices is all the governor does here
+        void kill() noexcept { _adsr.kill(); }
+
+        [[nodiscard]] bool isActive() const noexcept { return _adsr.isActive(); }
+        [[nodiscard]] bool isKilled() const noexcept { return _adsr.isKilled(); }
+        [[nodiscard]] bool hasPendingNote() const noexcept { return _pending.waiting; }
+        [[nodiscard]] float getAdsrLevel() const noexcept { return _adsr.getLevel(); }
+
+        void applyPitchBend() noexcept { calcPhaseInc(); }
+        void forceReset() noexcept;
+
+    private:
+        friend class VoiceBank;
+
+        void executeNoteOn(uint32_t midiNote, float amp) noexcept;
+        void calcPhaseInc() noexcept;
+        void updateMipLevel() noexcept;
+
+        VoiceBank* _bank{nullptr};
+        uint32_t _lane{0};
+
+        float _freq{440.0f};
+        float _pitchMod{1.0f};
+
+        // Block-rate ramps, the values each lane ended the last block on
+        float _ampTarget{0.5f}, _ampPrev{0.5f};
+        float _morphPrev{0.0f};
+        const SVF::Tuning* _tuning{nullptr};
+        SVF::Coefficients _coefPrev{};
+        bool _snap{true};       // Next block starts on the tuning, like SVF::reset()
+        bool _fresh{false};     // Note started since the last block, amp and morph start on their targets
+
+        Adsr _adsr;
+
+        struct PendingNote {
+            uint32_t midiNote;
+            float velocity;
+            bool waiting = false;
+        } _pending;
+    };
+
+    VoiceBank() noexcept;
+    VoiceBank(const VoiceBank&) = delete;
+    VoiceBank& operator=(const VoiceBank&) = delete;
+
+    Voice& operator[](uint32_t lane) noexcept { return _voices[lane]; }
+    const Voice& operator[](uint32_t lane) const noexcept { return _voices[lane]; }
+    Voice* begin() noexcept { return _voices.data(); }
+    Voice* end() noexcept { return _voices.data() + LANES; }
+
+    // Adds one block of every active voice into the interleaved stereo mix bus
+    void process(MixSample* __restrict__ buffer) noexcept;
+
+private:
+    template <bool Blend, bool Filter, bool Fade>
+    void render(MixSample* __restrict__ buffer, uint32_t lanes) noexcept;
+
+    std::array<Voice, LANES> _voices;
+
+    // Hot per-lane state, one entry per voice
+    alignas(16) uint32_t _phase[LANES]{};
+    alignas(16) uint32_t _inc[LANES]{};         // Block increment including pitch modulation
+    alignas(16) uint32_t _baseInc[LANES]{};     // Note increment including pitch bend
+    alignas(16) uint32_t _mipLevel[LANES]{};    // Level for the note, see WaveMip::levelFor()
+    alignas(16) uint32_t _mipShift[LANES]{};    // Shift for the tables read this block
+    alignas(16) uint32_t _fracMask[LANES]{};
+    alignas(16) float _fracScale[LANES]{};
+    alignas(16) float _amp[LANES]{};            // Gain before the first frame, frame i adds _ampStep * (i + 1)
+    alignas(16) float _ampStep[LANES]{};
+    alignas(16) float _morph[LANES]{};
+    alignas(16) float _weight[LANES]{};         // Share of _tableB this block, see Osc::rampView()
+    alignas(16) float _weightStep[LANES]{};
+    alignas(16) float _a1[LANES]{};             // Coefficients ramping across the block, see SVF::beginBlock()
+    alignas(16) float _a2[LANES]{};
+    alignas(16) float _a3[LANES]{};
+    alignas(16) float _da1[LANES]{};
+    alignas(16) float _da2[LANES]{};
+    alignas(16) float _da3[LANES]{};
+    alignas(16) float _s1[LANES]{};
+    alignas(16) float _s2[LANES]{};
+    bool _bypass[LANES]{};                      // Filter fully open, see SVF::isBypassed()
+    const Osc::TableSample* _tableA[LANES]{};
+    const Osc::TableSample* _tableB[LANES]{};
+    const Osc::TableSample* _tableOld[LANES]{};  // Table fading out after a slot switch
+
+    // Envelope for the whole block, laid out so one frame of all lanes is contiguous
+    alignas(16) float _env[Constants::NUM_FRAMES][LANES]{};
+};
@@ -1,36 +1,217 @@
 #pragma once
 #include "constants.h"
 #include "osc.h"
+#include "adsr.h"
+#include "modMatrix.h"
+#include "lfo.h"
+#include "loadGovernor.h"
+#include "voiceAllocator.h"
+#include "noteSet.h"
+#if SYNTH_SOA_VOICES
+#include "voiceBank.h"
+#endif
 #include <array>
+#include <atomic>
 #include <cstdint>
-#include "app.h"
-#include "constants.h"
 
 class VoiceManager {
+public:
+    // Every setting the main loop can change, handed to the audio callback as one block.
+    // Defaults match what voices start with after init().
+    struct Params {
+        float cutoff{1000.0f};
+        float resonance{0.0f};
+        float morph{0.0f};
+        float attack{0.01f};
+        float decay{0.1f};
+        float sustain{0.7f};
+        float release{0.5f};
+
+        // Second envelope, a modulation source only
+        float modAttack{0.01f};
+        float modDecay{0.1f};
+        float modSustain{0.7f};
+        float modRelease{0.5f};
+
+        ModMatrix::Routes routes{ModMatrix::defaults()};
+
+        Lfo::Bank lfos{Lfo::defaults()};    // Global ones first, then the per-voice ones
+        float bpm{120.0f};                  // For synced LFOs
+
+        // Unison copies per voice, see Osc::setUnison()
+        uint8_t unison{1};
+        float unisonDetune{0.15f};          // Semitones of the outermost copies
+        float unisonSpread{0.7f};           // Stereo width, 0..1
+
+        // MPE lower zone: channel 1 is the master, channels 2 to mpeChannels + 1 each carry
+        // one note with its own bend, pressure and timbre. 0 is off.
+        uint8_t mpeChannels{0};
+        float mpeBendRange{48.0f};          // Semitones of a member channel's full bend
+
+        VoiceAllocator::StealPolicy stealPolicy{VoiceAllocator::StealPolicy::OLDEST};
+    };
+
+    // Performance controls from MIDI. Unlike Params these belong to the audio context, the MIDI
+    // dispatch at the start of the callback sets them and process() picks them up.
+    struct Performance {
+        float modWheel{0.0f};
+        float aftertouch{0.0f};
+        float timbre{0.0f};
+        int16_t pitchBend{0};
+
+        // Per-note expression of the MPE member channels, indexed by channel
+        struct Channel {
+            int16_t bend{0};
+            float pressure{0.0f};
+            float timbre{0.0f};
+        };
+        std::array<Channel, 16> channels;
+    };
+
+    enum class Pedal : uint8_t { NONE, SUSTAIN, SOSTENUTO };
+
+    // A note on (velocity > 0) or off at an absolute frame, see scheduleNote(). Pedals and
+    // all notes off go through the same queue so they keep their order with the notes.
+    struct NoteEvent {
+        enum class Kind : uint8_t { NOTE, PEDAL, ALL_NOTES_OFF };
+
+        uint32_t frame;
+        uint8_t note;
+        uint8_t velocity;           // A pedal's is > 0 for down
+        uint8_t channel;
+        Kind kind{Kind::NOTE};
+        Pedal pedal{Pedal::NONE};
+    };
+    static constexpr uint32_t EVENT_QUEUE_SIZE = 64;    // Power of two
+
+    // Unison copies a voice can stack. Each lane of the SoA bank is a single oscillator.
+#if SYNTH_SOA_VOICES
+    static constexpr uint8_t MAX_UNISON = 1;
+#else
+    static constexpr uint8_t MAX_UNISON = Osc::MAX_UNISON;
+#endif
+
 private:
+#if SYNTH_SOA_VOICES
+    VoiceBank _voices;
+#else
     std::array<Osc, Constants::NUM_VOICES> _voices; 
-    uint8_t _noteMap[Constants::NUM_VOICES];
-    uint32_t _lastUsed[Constants::NUM_VOICES];
-    uint32_t _tickCount = 0;
+#endif
+    VoiceAllocator _alloc;                  // Audio context, like the voices
+
+    // Pedals, audio context. Sostenuto latches the keys down when it goes down, sustain keeps
+    // every key let go while it is down. Pedal up releases them all in one pass over the words.
+    NoteSet _held;                          // Keys down
+    NoteSet _sustained;                     // Let go under the sustain pedal
+    NoteSet _sostenuto;                     // Latched by the sostenuto pedal
+    bool _sustainDown{false};
+    bool _sostenutoDown{false};
     //float _sampleRate = Constants::SAMPLE_RATE;
     //uint16_t _bufferSize;
-    float mixBus[Constants::BUFFER_SIZE];
+    Osc::MixSample mixBus[Constants::BUFFER_SIZE];
+
+    std::array<float, Constants::NUM_VOICES> _voiceLevels{};   // Envelope levels after the last block
 
-    std::array<float, Constants::NUM_VOICES> _voiceLevels;
+    // Double-buffered parameter handoff. The main loop edits _edit and publishes a full copy
+    // into the slot the audio side isn't reading, then flips _published. process() runs in
+    // the I2S callback, which the main loop can never preempt, so the slot it copies from is
+    // never half written and voices only ever see whole parameter sets.
+    Params _edit;
+    Params _snapshot[2];
+    std::atomic<uint32_t> _published{0};    // (sequence << 1) | slot to read
+    uint32_t _applied{0};                   // Last _published value process() picked up
+    Params _current;                        // What the voices currently run with
+
+    Performance _perf;
+    int16_t _appliedBend{0};                // Pitch bend the voices run with
+
+    FilterCache _filters;
+
+    // Per-voice modulation sources, see modulate(). The global ones stay in _sources for the
+    // rest of the block, so a voice starting partway through is evaluated against them too.
+    ModMatrix::Sources _sources{};
+    std::array<Adsr, Constants::NUM_VOICES> _modEnv;
+    std::array<float, Constants::NUM_VOICES> _velocity{};
+
+    std::array<Lfo, Lfo::GLOBAL_COUNT> _lfos;
+    std::array<std::array<Lfo, Lfo::VOICE_COUNT>, Constants::NUM_VOICES> _voiceLfos;
+
+    LoadGovernor _governor;
+
+    // Timestamped notes from the MIDI dispatch. process() splits its block at each one.
+    std::array<NoteEvent, EVENT_QUEUE_SIZE> _events;
+    std::atomic<uint32_t> _eventHead{0};    // Written by schedule()
+    std::atomic<uint32_t> _eventTail{0};    // Written by process()
+    std::atomic<uint32_t> _frame{0};        // First frame of the next block
+
+    void publish() noexcept;
+    void applyParams() noexcept;
+    void modulate() noexcept;
+    void modulateVoice(int i, float lfo1, float lfo2, float modEnv, bool starting) noexcept;
+    void startVoice(uint8_t voice) noexcept;
+    void govern() noexcept;
+    [[nodiscard]] uint32_t soundingVoices() const noexcept;
+    void configureLfos(const Params& next, bool force) noexcept;
+    [[nodiscard]] bool isMember(uint8_t channel) const noexcept {
+        return channel != 0 && channel <= _current.mpeChannels;
+    }
+    // Channel notes are told apart by, channels only count in MPE mode
+    [[nodiscard]] uint8_t noteChannel(uint8_t channel) const noexcept {
+        return _current.mpeChannels ? channel : 0;
+    }
+    void releaseVoice(uint8_t voice) noexcept;
+    void releaseSustained(uint8_t note) noexcept;
+#if !SYNTH_SOA_VOICES
+    void renderVoices(uint32_t begin, uint32_t end) noexcept;
+#endif
+    void playEvent(const NoteEvent& e) noexcept;
+    void schedule(const NoteEvent& e) noexcept;
+    void flushEvents() noexcept;
+    void sustainPedal(bool down) noexcept;
+    void sostenutoPedal(bool down) noexcept;
 
 public:
     VoiceManager(){
         for(int i = 0; i < Constants::NUM_VOICES; i++) {
             _voices[i].init();
-            _noteMap[i] = 255; // 255 = Idle
+            _modEnv[i].init();
+
+            // Free-running voice LFOs start spread out instead of all in phase
+            for(auto& lfo : _voiceLfos[i]) lfo.setPhase(static_cast<uint32_t>(i) * (0xFFFFFFFFu / Constants::NUM_VOICES));
         }
+        configureLfos(_current, true);
     }
 
-    void noteOn(uint8_t note, uint8_t velocity);
-    void noteOff(uint8_t note);
+    // Channels only tell notes apart in MPE mode, see Params::mpeChannels
+    void noteOn(uint8_t note, uint8_t velocity, uint8_t channel = 0);
+    void noteOff(uint8_t note, uint8_t channel = 0);
+    // Releases every voice a key or pedal holds, on all channels, right away. MIDI panics go
+    // through scheduleAllNotesOff() so notes queued before them still go off.
+    void allNotesOff();
     void process(int16_t* buffer);
+
+    // Sample-accurate notes, audio context ahead of process(). Frames count from the first
+    // process() call, see getFrame(), and ones already rendered play at the start of the next
+    // block. Queue them in time order. A full queue plays what it holds straight away to make
+    // room, so events can come early but never out of order.
+    void scheduleNote(uint8_t note, uint8_t velocity, uint32_t frame, uint8_t channel = 0) noexcept {
+        schedule({frame, note, velocity, channel});
+    }
+    void schedulePedal(Pedal pedal, bool down, uint32_t frame) noexcept {
+        schedule({frame, 0, static_cast<uint8_t>(down), 0, NoteEvent::Kind::PEDAL, pedal});
+    }
+    void scheduleAllNotesOff(uint32_t frame) noexcept {
+        schedule({frame, 0, 0, 0, NoteEvent::Kind::ALL_NOTES_OFF});
+    }
+    [[nodiscard]] uint32_t getFrame() const noexcept { return _frame.load(std::memory_order_relaxed); }
+
+    // Load governor, off until a deadline is set. Set it before audio starts, then report the
+    // measured time of every process() call from the audio callback, see LoadGovernor.
+    void setLoadDeadline(uint32_t ticks) noexcept { _governor.setDeadline(ticks); }
+    void reportRenderTime(uint32_t ticks) noexcept { _governor.update(ticks); }
+    [[nodiscard]] const LoadGovernor& getGovernor() const noexcept { return _governor; }
     
-    // Parameter setters
+    // Parameter setters, main loop side. Nothing touches the voices until the next process()
     void setCutoff(float freq);
     void setResonance(float res);
     void setMorph(float morph);
@@ -38,12 +219,32 @@ public:
     void setDecay(float seconds);
     void setSustain(float level);
     void setRelease(float seconds);
+    void setModEnvelope(float attack, float decay, float sustain, float release);
+    void setModRoute(uint8_t slot, const ModMatrix::Route& route);
+    void setLfo(uint8_t idx, const Lfo::Settings& settings);
+    void setTempo(float bpm);
+    void setUnison(uint8_t copies, float detune, float spread);     // Copies past MAX_UNISON clamp
+    // MPE lower zone with this many member channels (the MIDI MPE Configuration Message), 0 turns
+    // it off. Switching mode replaces routes still at the other mode's defaults, empty slots
+    // included, with this mode's, see ModMatrix::mpeDefaults(). Routes set with setModRoute() stay.
+    void setMpe(uint8_t memberChannels);
+    // Which sounding voice a note takes once all are busy
+    void setStealPolicy(VoiceAllocator::StealPolicy policy);
 
     [[nodiscard]] float getVoiceLevel(uint8_t voiceIdx) const noexcept {
         return (voiceIdx < Constants::NUM_VOICES) ? _voiceLevels[voiceIdx] : 0.0f;
     }
 
-    // MIDI CC Controls
-    void setPitchBend(uint8_t lsb, uint8_t msb);
+    // MIDI performance controls, audio context: call them before process() in the same callback.
+    // On an MPE member channel bend, pressure and timbre only reach that channel's note.
+    void setPitchBend(uint8_t lsb, uint8_t msb, uint8_t channel = 0);
     void setModWheel(uint8_t value);
+    void setAftertouch(uint8_t value, uint8_t channel = 0);
+    void setTimbre(uint8_t value, uint8_t channel = 0);     // CC 74
+    void setPedal(Pedal pedal, bool down);                  // CC 64 and 66, or schedulePedal()
+
+    // MIDI CC Controls, main loop side like the parameter setters
+    void setUnisonVoices(uint8_t value);    // 0..127 across 1..7 copies
+    void setUnisonDetune(uint8_t value);    // 0..127 -> 0..1 semitone
+    void setUnisonSpread(uint8_t value);
 };
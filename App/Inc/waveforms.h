@@ -1,16 +1,59 @@
 #pragma once
 #include <cstdint>
+#include <array>
 
-extern const float waveform_Sine[4096];
-extern const float waveform_Saw[4096];
-extern const float waveform_Square[4096];
-extern const float waveform_Rhodes[4096];
-extern const float waveform_Clav[4096];
-extern const float waveform_Choir[4096];
-extern const float waveform_Acid[4096];
-extern const float waveform_Glass[4096];
+// Every waveform is stored as a chain of band-limited mip levels, one per octave.
+// Level 0 holds 2048 samples, each level above halves the harmonic count and the
+// table size (down to a 64 sample floor). Samples are Q15, with each chain peak
+// normalized to full scale. Generated by GenWavetables.py.
+namespace WaveMip {
+    static constexpr uint32_t LEVELS = 11;
+    static constexpr uint32_t BASE_BITS = 11;
+    static constexpr uint32_t MIN_BITS = 6;
 
-static const float* const waveLibrary[] = {
+    constexpr uint32_t sizeBits(uint32_t level) {
+        return (level + MIN_BITS < BASE_BITS) ? BASE_BITS - level : MIN_BITS;
+    }
+    constexpr uint32_t size(uint32_t level) { return 1u << sizeBits(level); }
+    constexpr uint32_t offset(uint32_t level) {
+        uint32_t total = 0;
+        for (uint32_t i = 0; i < level; ++i) total += size(i);
+        return total;
+    }
+
+    static constexpr float Q15_SCALE = 1.0f / 32767.0f;
+
+    static constexpr uint32_t BASE_SIZE = size(0);
+    static constexpr uint32_t TOTAL_SIZE = offset(LEVELS);
+
+    // offset() as a table, for lookups at block rate
+    static constexpr auto OFFSETS = [] {
+        std::array<uint32_t, LEVELS + 1> o{};
+        for (uint32_t i = 0; i < LEVELS; ++i) o[i + 1] = o[i] + size(i);
+        return o;
+    }();
+
+    // Lowest level whose harmonics all stay below Nyquist for this phase increment.
+    // Level L carries 2^(BASE_BITS-1-L) harmonics, so it is safe while inc <= 2^(32-BASE_BITS+L).
+    // Past the top level's limit, a pitch above Nyquist, it stays on the top level.
+    constexpr uint32_t levelFor(uint32_t phaseInc) {
+        if (phaseInc <= (1u << (32 - BASE_BITS))) return 0;
+        const uint32_t ceilLog2 = 32 - static_cast<uint32_t>(__builtin_clz(phaseInc - 1));
+        const uint32_t level = ceilLog2 - (32 - BASE_BITS);
+        return (level < LEVELS) ? level : LEVELS - 1;
+    }
+}
+
+extern const int16_t waveform_Sine[WaveMip::TOTAL_SIZE];
+extern const int16_t waveform_Saw[WaveMip::TOTAL_SIZE];
+extern const int16_t waveform_Square[WaveMip::TOTAL_SIZE];
+extern const int16_t waveform_Rhodes[WaveMip::TOTAL_SIZE];
+extern const int16_t waveform_Clav[WaveMip::TOTAL_SIZE];
+extern const int16_t waveform_Choir[WaveMip::TOTAL_SIZE];
+extern const int16_t waveform_Acid[WaveMip::TOTAL_SIZE];
+extern const int16_t waveform_Glass[WaveMip::TOTAL_SIZE];
+
+static const int16_t* const waveLibrary[] = {
     waveform_Sine,
     waveform_Saw,
     waveform_Square,
@@ -25,3 +68,30 @@ static constexpr uint8_t WAVE_COUNT = sizeof(waveLibrary) / sizeof(waveLibrary[0
 
 extern const char* const waveNames[];
 
+// Frames of a scanning wavetable set keep only the mip levels from TOP_LEVEL up (256 samples
+// and smaller). Notes low enough for a lower level read the TOP_LEVEL table instead, trading
+// harmonics above 127 on bass notes for a 1.5 KB frame. Generated by GenWavetables.py.
+namespace FrameMip {
+    static constexpr uint32_t TOP_LEVEL = 3;
+    static constexpr uint32_t FRAME_SIZE = WaveMip::TOTAL_SIZE - WaveMip::offset(TOP_LEVEL);
+}
+
+struct WavetableSet {
+    const char* name;
+    uint32_t frames;
+    const int16_t* data;    // Frame f starts at data + f * FrameMip::FRAME_SIZE
+};
+
+extern const int16_t wavetableSet_Pulse[16 * FrameMip::FRAME_SIZE];
+extern const int16_t wavetableSet_Sync[32 * FrameMip::FRAME_SIZE];
+extern const int16_t wavetableSet_Vowel[16 * FrameMip::FRAME_SIZE];
+extern const int16_t wavetableSet_Additive[16 * FrameMip::FRAME_SIZE];
+
+static const WavetableSet wavetableSets[] = {
+    {"PULSE ", 16, wavetableSet_Pulse},
+    {"SYNC  ", 32, wavetableSet_Sync},
+    {"VOWEL ", 16, wavetableSet_Vowel},
+    {"ADDTV ", 16, wavetableSet_Additive}
+};
+
+static constexpr uint8_t WAVETABLE_SET_COUNT = sizeof(wavetableSets) / sizeof(wavetableSets[0]);
@@ -2,6 +2,18 @@ import numpy as np
 
 TABLE_SIZE = 4096
 FILE_NAME = "waveforms.cpp"
+SET_FILE_NAME = "wavetableSets.cpp"
+
+# Mip chain layout, must match WaveMip in waveforms.h
+MIP_LEVELS = 11
+MIP_BASE_BITS = 11   # Level 0 is 2048 samples
+MIP_MIN_BITS = 6     # No level is smaller than 64 samples
+
+# Scanning set frames only keep levels from here up (256 samples and smaller), must match FrameMip
+FRAME_TOP_LEVEL = 3
+
+# Tables are stored as Q15. Every chain is peak normalized, so 1.0 maps to full scale.
+Q15_ONE = 32767
 
 def get_t():
     return np.linspace(0, 1, TABLE_SIZE, endpoint=False)
@@ -9,6 +21,50 @@ def get_t():
 def normalize(data):
     return data / np.max(np.abs(data))
 
+def mip_size(level):
+    return 1 << max(MIP_BASE_BITS - level, MIP_MIN_BITS)
+
+def mip_harmonics(level):
+    # One octave per level: level L is played with at most 2^(10-L) harmonics below Nyquist.
+    # A table can hold fewer than half its size without the top bin folding over.
+    return min((1 << (MIP_BASE_BITS - 1)) >> level, mip_size(level) // 2 - 1)
+
+def band_limit(data, first_level=0):
+    # Band-limit by truncating the spectrum of the 4096-sample prototype, then
+    # resynthesize at the smaller size. Phase is preserved so levels line up.
+    spectrum = np.fft.rfft(data) / len(data)
+    levels = []
+    for level in range(first_level, MIP_LEVELS):
+        size = mip_size(level)
+        harmonics = mip_harmonics(level)
+        bins = np.zeros(size // 2 + 1, dtype=complex)
+        bins[:harmonics + 1] = spectrum[:harmonics + 1]
+        levels.append(np.fft.irfft(bins * size, n=size))
+    return levels
+
+def build_mips(data):
+    levels = band_limit(data)
+
+    # One gain for the whole chain so loudness doesn't jump between octaves
+    peak = max(np.max(np.abs(l)) for l in levels)
+    return [l / peak for l in levels]
+
+def build_set(frames):
+    chains = [band_limit(f, FRAME_TOP_LEVEL) for f in frames]
+
+    # One gain for the whole set so loudness doesn't jump while scanning
+    peak = max(np.max(np.abs(l)) for chain in chains for l in chain)
+    return [[l / peak for l in chain] for chain in chains]
+
+def to_q15(data):
+    return np.clip(np.round(data * Q15_ONE), -Q15_ONE, Q15_ONE).astype(int)
+
+def additive(amps, phase_cos=False):
+    # Sum of harmonics 1..len(amps) over one prototype cycle
+    t = get_t()
+    fn = np.cos if phase_cos else np.sin
+    return sum(a * fn(2 * np.pi * n * t) for n, a in enumerate(amps, start=1) if a != 0.0)
+
 def generate_waveforms():
     t = get_t()
     waves = {}
@@ -50,15 +106,69 @@ def generate_waveforms():
 
     write_to_file(waves)
 
+def generate_sets():
+    sets = {}
+    harmonics = np.arange(1, 128)
+
+    # Pulse: width sweeps from square (50%) down to a thin 5% pulse
+    sets["Pulse"] = [additive(np.sin(np.pi * harmonics * w) / harmonics, phase_cos=True)
+                     for w in np.linspace(0.5, 0.05, 16)]
+
+    # Sync: hard-synced saw, slave running 1x to 4x the master
+    t = get_t()
+    sets["Sync"] = [2.0 * ((r * t) % 1.0) - 1.0 for r in np.linspace(1.0, 4.0, 32)]
+
+    # Vowel: formants glide A -> E -> I -> O -> U on a 110 Hz voice
+    vowels = np.array([[800, 1150, 2900], [400, 1600, 2700], [350, 1700, 2700],
+                       [450, 800, 2830], [325, 700, 2530]], dtype=float)
+    gains = np.array([1.0, 0.5, 0.25])
+    widths = np.array([80.0, 90.0, 120.0])
+    frames = []
+    for pos in np.linspace(0, len(vowels) - 1, 16):
+        i = min(int(pos), len(vowels) - 2)
+        formants = vowels[i] + (vowels[i + 1] - vowels[i]) * (pos - i)
+        f = harmonics[:, None] * 110.0
+        amps = np.sum(gains / (1.0 + ((f - formants) / widths) ** 2), axis=1)
+        frames.append(additive(amps))
+    sets["Vowel"] = frames
+
+    # Additive: saw spectrum opening up from a sine to all 127 harmonics
+    sets["Additive"] = [additive(np.clip(count - harmonics + 1, 0, 1) / harmonics)
+                        for count in np.geomspace(1, 127, 16)]
+
+    write_sets_to_file(sets)
+
 def write_to_file(waves):
     with open(FILE_NAME, "w") as f:
         f.write('#include "waveforms.h"\n\n')
+
+        names = ", ".join(f'"{name.upper():<6}"' for name in waves)
+        f.write(f'const char* const waveNames[] = {{\n    {names}\n}};\n\n')
+
         for name, data in waves.items():
-            f.write(f'alignas(4) const float waveform_{name}[{TABLE_SIZE}] = {{\n    ')
-            formatted_data = [f"{v:.8f}f" for v in data]
-            for i in range(0, len(formatted_data), 8):
-                f.write(", ".join(formatted_data[i:i+8]) + ",\n    ")
-            f.write("\n};\n\n")
+            f.write(f'alignas(4) const int16_t waveform_{name}[WaveMip::TOTAL_SIZE] = {{\n')
+            for level, mip in enumerate(build_mips(data)):
+                f.write(f'    // Level {level}: {len(mip)} samples, {mip_harmonics(level)} harmonics\n    ')
+                formatted_data = [f"{v:6d}" for v in to_q15(mip)]
+                for i in range(0, len(formatted_data), 16):
+                    f.write(", ".join(formatted_data[i:i+16]) + ",\n    ")
+                f.write("\n")
+            f.write("};\n\n")
+
+def write_sets_to_file(sets):
+    with open(SET_FILE_NAME, "w") as f:
+        f.write('#include "waveforms.h"\n\n')
+
+        for name, frames in sets.items():
+            f.write(f'alignas(4) const int16_t wavetableSet_{name}[{len(frames)} * FrameMip::FRAME_SIZE] = {{\n')
+            for index, chain in enumerate(build_set(frames)):
+                f.write(f'    // Frame {index}\n    ')
+                formatted_data = [f"{v:6d}" for v in to_q15(np.concatenate(chain))]
+                for i in range(0, len(formatted_data), 16):
+                    f.write(", ".join(formatted_data[i:i+16]) + ",\n    ")
+                f.write("\n")
+            f.write("};\n\n")
 
 if __name__ == "__main__":
     generate_waveforms()
+    generate_sets()
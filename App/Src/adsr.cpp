@@ -36,6 +36,7 @@ void Adsr::setDecay(float seconds) noexcept {
 
 void Adsr::setSustain(float level) noexcept {
     _sustainLevel = std::clamp(level, 0.0f, 1.0f);
+    if (_state == EnvState::DECAY) calcDecay();
 }
 
 void Adsr::setRelease(float seconds) noexcept {
@@ -51,12 +52,121 @@ void Adsr::kill() noexcept {
     }
 }
 
+uint32_t Adsr::segmentLength(float samples) noexcept {
+    // Whole samples until the segment ends, at least one. Also catches inf/NaN, and the negative
+    // counts of a segment starting past its end, like a release gated before the attack moved.
+    static constexpr float LONGEST = 16777216.0f; // ~6 minutes, far longer than any stage
+    if (!(samples < LONGEST)) return static_cast<uint32_t>(LONGEST);
+    if (!(samples > 1.0f)) return 1;
+    return static_cast<uint32_t>(std::ceil(samples));
+}
+
+uint32_t Adsr::renderBlock(float* __restrict__ out, uint32_t n) noexcept {
+    uint32_t i = 0;
+
+    while (i < n && _state != EnvState::IDLE) {
+        const uint32_t remaining = n - i;
+
+        if (_state == EnvState::SUSTAIN) {
+            std::fill(out + i, out + n, _sustainLevel);
+            _output = _sustainLevel;
+            i = n;
+        }
+        else if (_state == EnvState::ATTACK) {
+            // Linear ramp, hits 1.0 on sample ceil((1 - out) / step)
+            const float base = _output;
+            const float samples = (_attackStep > 0.0f) ? (1.0f - base) / _attackStep : 0.0f;
+            const uint32_t total = segmentLength(samples);
+            const uint32_t len = std::min(total, remaining);
+
+            for (uint32_t j = 0; j < len; ++j) out[i + j] = base + _attackStep * static_cast<float>(j + 1);
+            i += len;
+
+            if (len == total) {
+                out[i - 1] = 1.0f;
+                _output = 1.0f;
+                _state = EnvState::DECAY;
+                calcDecay();
+            } else {
+                _output = out[i - 1];
+            }
+        }
+        else if (_state == EnvState::DECAY) {
+            // Distance to sustain shrinks by _decayMult per sample, see calcDecay() for the length
+            float dist = _output - _sustainLevel;
+            const uint32_t len = std::min(_segmentLeft, remaining);
+
+            for (uint32_t j = 0; j < len; ++j) {
+                dist *= _decayMult;
+                out[i + j] = _sustainLevel + dist;
+            }
+            i += len;
+            _segmentLeft -= len;
+
+            if (_segmentLeft == 0) {
+                out[i - 1] = _sustainLevel;
+                _output = _sustainLevel;
+                _state = EnvState::SUSTAIN;
+            } else {
+                _output = out[i - 1];
+            }
+        }
+        else if (_state == EnvState::RELEASE) {
+            // Decays towards -0.01 so it reaches the 0.0001 floor in finite time, see calcRelease()
+            float dist = _output + 0.01f;
+            const uint32_t len = std::min(_segmentLeft, remaining);
+
+            for (uint32_t j = 0; j < len; ++j) {
+                dist *= _releaseMult;
+                out[i + j] = dist - 0.01f;
+            }
+            i += len;
+            _segmentLeft -= len;
+
+            if (_segmentLeft == 0) {
+                _output = 0.0f;
+                _state = EnvState::IDLE;
+            } else {
+                _output = out[i - 1];
+            }
+        }
+        else if (_state == EnvState::KILL) {
+            // Linear ramp to zero, the sample that reaches zero is the first idle one
+            const float base = _output;
+            const float samples = (_killStep > 0.0f) ? base / _killStep : 0.0f;
+            const uint32_t active = segmentLength(samples) - 1;
+            const uint32_t len = std::min(active, remaining);
+
+            for (uint32_t j = 0; j < len; ++j) out[i + j] = base - _killStep * static_cast<float>(j + 1);
+            i += len;
+
+            if (len == active) {
+                _output = 0.0f;
+                _state = EnvState::IDLE;
+            } else {
+                _output = out[i - 1];
+            }
+        }
+    }
+
+    const uint32_t activeSamples = i;
+    std::fill(out + i, out + n, 0.0f);
+    return activeSamples;
+}
+
 void Adsr::calcDecay() noexcept {
     _decayMult = calcMultiplier(_decayTime);
+    // Done on the sample that brings the distance to sustain under 0.0001
+    const float dist = _output - _sustainLevel;
+    const float samples = (dist > 0.0001f) ? std::log(0.0001f / dist) / std::log(_decayMult) : 0.0f;
+    _segmentLeft = segmentLength(std::floor(samples) + 1.0f);
 }
 
 void Adsr::calcRelease() noexcept {
     _releaseMult = calcMultiplier(_releaseTime);
+    // The sample that crosses the 0.0001 floor is the first idle one
+    const float samples = std::log(0.0101f / (_output + 0.01f)) / std::log(_releaseMult);
+    _segmentLeft = segmentLength(samples) - 1;
 }
 
 void Adsr::reset() noexcept {
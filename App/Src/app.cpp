@@ -5,6 +5,7 @@
  *      Author: Ken
  */
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <cstdio>
@@ -17,6 +18,10 @@
 #include "potBank.h"
 #include "tim.h"
 #include "midiBuffer.h"
+#include "midiBridge.h"
+#include "midiParser.h"
+#include "sampleClock.h"
+#include "telemetry.h"
 #include "pwmLed.h"
 #include "voiceManager.h"
 #include "oled.h"
@@ -24,6 +29,10 @@
 #include "adsrVisualizer.h"
 #include "filterVisualizer.h"
 #include "constants.h"
+#include "cycleCounter.h"
+#ifdef SYNTH_BENCH
+#include "benchSuite.h"
+#endif
 
 Codec codec;
 PWMLed ledController;
@@ -37,6 +46,20 @@ PotBank hardwarePots(&hadc1, &hadc2, GPIOE, MUX_A_Pin, GPIOE, MUX_B_Pin);
 
 extern MidiBuffer gMidiBuffer;
 
+// Packets the audio callback leaves to the main loop, see dispatchMidi(). Each side decodes
+// with its own parser.
+MidiBuffer gDeferredMidi;
+MidiParser midiParser;
+MidiParser deferredParser;
+
+// Block start ticks, places the USB interrupt's MIDI stamps on VoiceManager's frame count
+SampleClock sampleClock;
+
+// Render-time statistics, reported as SysEx on request. The flags are set from the I2S callback.
+Telemetry telemetry;
+std::atomic<bool> telemetryStreaming{false};
+std::atomic<bool> telemetryRequested{false};
+
 struct SynthParams {
     float volume;
     float cutoff;
@@ -54,14 +77,21 @@ bool uiNeedsRefresh = false;
 uint8_t lastChangedIndex = 255;
 bool isBooting;
 
-// CPU cycle debug
-volatile uint32_t elapsed_us = 0;
+#ifdef SYNTH_BENCH
+// Route printf to SWO so the benchmark JSON lines can be captured with a debug probe
+extern "C" int __io_putchar(int ch) {
+    return static_cast<int>(ITM_SendChar(static_cast<uint32_t>(ch)));
+}
+#endif
 
 extern "C" void cpp_main() {
     // CPU cycle debug
-    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-    DWT->CYCCNT = 0;
-    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    CycleCounter::init();
+
+#ifdef SYNTH_BENCH
+    // Benchmarks run before the codec starts so nothing else competes for the CPU
+    Bench::runAll(2000, Bench::printJson);
+#endif
 
     // init led controller
     if (ledController.init() != 0) {
@@ -71,6 +101,11 @@ extern "C" void cpp_main() {
     // osc init
     voiceManager.process(buffer);
     voiceManager.process(&buffer[Constants::BUFFER_SIZE]);
+
+    // Governor and telemetry measure against the half-buffer period from here on, the benchmarks ran without them
+    const uint32_t deadline = static_cast<uint32_t>(CycleCounter::ticksPerSecond() * (Constants::BLOCK_PERIOD_US * 1e-6f));
+    voiceManager.setLoadDeadline(deadline);
+    telemetry.setDeadline(deadline, CycleCounter::ticksPerSecond());
     
     if (oled.init() != 0) {
         while(1);
@@ -161,28 +196,37 @@ extern "C" void cpp_main() {
         }
 
         handleMidi();
+        serviceTelemetry(currentTick);
     }
 }
 
 extern "C" void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s) {
+    uint32_t start_cycles = CycleCounter::now();
+
+    sampleClock.beginBlock(start_cycles, voiceManager.getFrame());
+    dispatchMidi();
+
     std::fill(buffer, buffer + Constants::BUFFER_SIZE, 0);
     voiceManager.process(buffer);
+
+    // Render time for the load governor and telemetry
+    uint32_t elapsed_cycles = CycleCounter::now() - start_cycles;
+    voiceManager.reportRenderTime(elapsed_cycles);
+    telemetry.record(Telemetry::Callback::HALF, elapsed_cycles);
 }
 
 extern "C" void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s) {
-    uint32_t start_cycles = DWT->CYCCNT;
+    uint32_t start_cycles = CycleCounter::now();
+
+    sampleClock.beginBlock(start_cycles, voiceManager.getFrame());
+    dispatchMidi();
 
     std::fill(buffer + Constants::BUFFER_SIZE, buffer + (Constants::CIRCULAR_BUFFER_SIZE), 0);
     voiceManager.process(&buffer[Constants::BUFFER_SIZE]);
 
-    // CPU cycle debug
-    uint32_t end_cycles = DWT->CYCCNT;
-    uint32_t elapsed_cycles = end_cycles - start_cycles;
-    
-    // Convert cycles to Microseconds
-    // Formula: (Cycles / SystemCoreClock) * 1,000,000
-    elapsed_us = (elapsed_cycles * 1000000) / SystemCoreClock;
-
+    uint32_t elapsed_cycles = CycleCounter::now() - start_cycles;
+    voiceManager.reportRenderTime(elapsed_cycles);
+    telemetry.record(Telemetry::Callback::FULL, elapsed_cycles);
 }
 
 extern "C" void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc) {
@@ -257,45 +301,205 @@ void handleParamChange(uint8_t index) {
     }
 }
 
+void dispatchMidi() {
+    // Audio callback, ahead of the render. Notes and performance controls play from here so the
+    // main loop's blocking I2C and OLED work never delays them. Anything that edits parameters or
+    // needs the main loop's state goes on to handleMidi().
+    while (true) {
+        const MidiBuffer::Batch batch = gMidiBuffer.popBatch();
+        if (batch.empty()) break;
+
+        for (const MidiPacket& packet : batch) {
+            MidiEvent event;
+            if (!midiParser.feed(packet, event)) continue;
+            if (!dispatchEvent(event)) gDeferredMidi.push(packet.data, packet.stamp);
+        }
+    }
+}
+
+bool dispatchEvent(const MidiEvent& e) {
+    switch (e.type) {
+        case MidiEvent::Type::NOTE_ON:
+            playNote(e.data1, e.data2, e.stamp, e.channel);
+            break;
+
+        case MidiEvent::Type::NOTE_OFF:
+            playNote(e.data1, 0, e.stamp, e.channel);
+            break;
+
+        case MidiEvent::Type::CONTROL_CHANGE:
+            if (e.data1 == 1) { // Mod Wheel
+                voiceManager.setModWheel(e.data2);
+            }
+            else if (e.data1 == 74) { // Timbre, per note in MPE mode
+                voiceManager.setTimbre(e.data2, e.channel);
+            }
+            else if (e.data1 == 64 || e.data1 == 66) { // Sustain, sostenuto
+                playPedal(e.data1, e.data2, e.stamp);
+            }
+            // CC 123 (Panic), queued like the notes so one that came in just before it goes off too
+            else if (e.data1 == 123) {
+                voiceManager.scheduleAllNotesOff(sampleClock.toFrame(e.stamp) + Constants::NUM_FRAMES);
+            }
+            else {
+                return false;
+            }
+            break;
+
+        case MidiEvent::Type::CHANNEL_PRESSURE: // A mod matrix source
+            voiceManager.setAftertouch(e.data1, e.channel);
+            break;
+
+        case MidiEvent::Type::PITCH_BEND:
+            voiceManager.setPitchBend(e.data1, e.data2, e.channel);
+            break;
+
+        case MidiEvent::Type::SYSEX: // Only raises request flags for the main loop
+            handleSysex(midiParser.sysex(), midiParser.sysexLength());
+            break;
+
+        default:
+            return false;
+    }
+    return true;
+}
+
 void handleMidi() {
     MidiPacket packet;
     
-    while (gMidiBuffer.pop(packet)) {
-        uint8_t status   = packet.data[1];
-        uint8_t data1    = packet.data[2];
-        uint8_t data2    = packet.data[3];
-        uint8_t message  = status & 0xF0;
-
-        switch (message) {
-            case 0x90: // Note On
-                if (data2 > 0) {
-                    voiceManager.noteOn(data1, data2);
-                } else {
-                    voiceManager.noteOff(data1);
+    while (gDeferredMidi.pop(packet)) {
+        MidiEvent e;
+        if (!deferredParser.feed(packet, e)) continue;
+
+        switch (e.type) {
+            case MidiEvent::Type::CONTROL_CHANGE:
+                // CC 16-18 (General Purpose 1-3): unison copies, detune and stereo spread
+                if (e.data1 == 16) {
+                    voiceManager.setUnisonVoices(e.data2);
+                }
+                else if (e.data1 == 17) {
+                    voiceManager.setUnisonDetune(e.data2);
+                }
+                else if (e.data1 == 18) {
+                    voiceManager.setUnisonSpread(e.data2);
+                }
+                else {
+                    handleRpn(e);
                 }
                 break;
 
-            case 0x80: // Note Off
-                voiceManager.noteOff(data1);
+            case MidiEvent::Type::PROGRAM_CHANGE: // Selects a scanning wavetable set (past the last one: A/B slots)
+                Osc::requestWavetableSet(e.data1);
                 break;
 
-            case 0xB0: // Control Change (CC)
-                if (data1 == 1) { // Mod Wheel
-                    voiceManager.setModWheel(data2);
-                }
-                // CC 123 (Panic)
-                else if (data1 == 123) {
-                    for(uint8_t i = 0; i < 127; i++) voiceManager.noteOff(i);
-                }
+            case MidiEvent::Type::REALTIME: // Only the clock is used
+                handleMidiClock(e);
                 break;
 
-            case 0xE0: // Pitch Bend
-                voiceManager.setPitchBend(data1, data2);
+            default:
                 break;
         }
     }
 }
 
+void playNote(uint8_t note, uint8_t velocity, uint32_t stamp, uint8_t channel) {
+    // One block after the block it arrived in, which is the block about to render, so every note
+    // gets the same latency
+    const uint32_t frame = sampleClock.toFrame(stamp) + Constants::NUM_FRAMES;
+    voiceManager.scheduleNote(note, velocity, frame, channel);
+}
+
+void playPedal(uint8_t controller, uint8_t value, uint32_t stamp) {
+    // Timed like the notes, so a key let go just before the pedal goes down still gets released
+    const auto pedal = (controller == 64) ? VoiceManager::Pedal::SUSTAIN : VoiceManager::Pedal::SOSTENUTO;
+    const bool down = value >= 64;
+    const uint32_t frame = sampleClock.toFrame(stamp) + Constants::NUM_FRAMES;
+    voiceManager.schedulePedal(pedal, down, frame);
+}
+
+void handleSysex(const uint8_t* msg, uint32_t len) {
+    switch (Telemetry::parseRequest(msg, len)) {
+        case Telemetry::Command::SEND:
+            telemetryRequested.store(true, std::memory_order_relaxed);
+            break;
+        case Telemetry::Command::STREAM_ON:
+            telemetryStreaming.store(true, std::memory_order_relaxed);
+            break;
+        case Telemetry::Command::STREAM_OFF:
+            telemetryStreaming.store(false, std::memory_order_relaxed);
+            break;
+        default:
+            break;
+    }
+}
+
+void serviceTelemetry(uint32_t now) {
+    static uint32_t lastReport = 0;
+    if (MidiBridge::isBusy()) return;
+    const bool due = telemetryStreaming.load(std::memory_order_relaxed) &&
+                     (now - lastReport >= Telemetry::STREAM_INTERVAL_MS);
+    // A request arriving after this is answered by the next call, never lost
+    const bool requested = telemetryRequested.exchange(false, std::memory_order_relaxed);
+    if (!(due || requested)) return;
+    lastReport = now;
+
+    // The I2S callbacks record into the interval being collected, keep them out for the copy
+    Telemetry::Report report;
+    __disable_irq();
+    telemetry.collect(report);
+    __enable_irq();
+
+    report.midiOverflows = gMidiBuffer.overflows() + gDeferredMidi.overflows();
+    report.midiHighWater = gMidiBuffer.highWater();
+    for (uint8_t i = 0; i < Constants::NUM_VOICES; ++i) {
+        if (voiceManager.getVoiceLevel(i) > 0.0f) ++report.activeVoices;
+    }
+    report.governorLevel = voiceManager.getGovernor().level();
+
+    static_assert(Telemetry::USB_SIZE <= MidiBridge::TX_SIZE, "Telemetry report must fit one bridge message");
+    static uint8_t sysex[Telemetry::SYSEX_SIZE];
+    static uint8_t packets[Telemetry::USB_SIZE];
+    const uint32_t length = Telemetry::encode(report, sysex);
+    MidiBridge::send(packets, Telemetry::toUsbPackets(sysex, length, packets));
+}
+
+void handleRpn(const MidiEvent& e) {
+    // Only the MPE Configuration Message is used: RPN 6 on channel 1 sets up the lower zone,
+    // its data entry value is the number of member channels
+    static uint8_t rpnMsb = 0x7F;
+    static uint8_t rpnLsb = 0x7F;
+    if (e.channel != 0) return;
+
+    if (e.data1 == 101) rpnMsb = e.data2;
+    else if (e.data1 == 100) rpnLsb = e.data2;
+    else if (e.data1 == 6 && rpnMsb == 0 && rpnLsb == 6) voiceManager.setMpe(e.data2);
+}
+
+void handleMidiClock(const MidiEvent& e) {
+    // 24 clocks per beat. The tempo for synced LFOs is measured over a whole beat between the
+    // USB arrival stamps, so however late the main loop gets here the timing holds.
+    static uint32_t clocks = 0;
+    static uint32_t beatStart = 0;
+
+    if (e.status == 0xFA || e.status == 0xFC) { // Start, Stop
+        clocks = 0;
+        return;
+    }
+    if (e.status != 0xF8) return;
+
+    const uint32_t now = e.stamp;
+    if (clocks == 0) {
+        beatStart = now;
+    } else if (clocks == 24) {
+        if (now != beatStart) {
+            voiceManager.setTempo(60.0f * static_cast<float>(CycleCounter::ticksPerSecond()) / static_cast<float>(now - beatStart));
+        }
+        beatStart = now;
+        clocks = 0;
+    }
+    clocks++;
+}
+
 
 void cycleWaveform(uint8_t slot) {
     // Determine indices for the dual-slot oscillator system
@@ -307,9 +511,8 @@ void cycleWaveform(uint8_t slot) {
         nextIdx = (nextIdx + 1) % WAVE_COUNT;
     } while (nextIdx == otherIdx);
 
-    __disable_irq();
-    Osc::loadWaveform(nextIdx, slot);
-    __enable_irq();
+    // Picked up by the audio callback at its next block and crossfaded in, no need to mask interrupts
+    Osc::requestWaveform(nextIdx, slot);
 
     currentView = VIEW_WAVETABLE;
     lastInteractionTime = HAL_GetTick();
@@ -0,0 +1,240 @@
+#include "benchSuite.h"
+#include <algorithm>
+#include <cstdio>
+#include "cycleCounter.h"
+#include "constants.h"
+#include "osc.h"
+#include "adsr.h"
+#include "svf.h"
+#include "moogLadder.h"
+#include "voiceManager.h"
+#include "waveforms.h"
+
+namespace {
+    // Keeps the compiler from discarding benchmarked work
+    volatile float sink;
+
+    // Benchmark state lives in static storage so the suite doesn't need a big stack on the board
+    Osc osc;
+    Adsr adsr;
+    SVF svf;
+    MoogLadder moog;
+    VoiceManager voices;
+    Osc::MixSample mixBuffer[Constants::BUFFER_SIZE];
+    float inputBlock[Constants::NUM_FRAMES];
+    int16_t outBuffer[Constants::BUFFER_SIZE];
+
+    // One voice block the way VoiceManager runs it, into a bus cleared first so the sums don't
+    // grow (or saturate, in fixed point) from one iteration to the next
+    void renderVoice() noexcept {
+        std::fill(mixBuffer, mixBuffer + Constants::BUFFER_SIZE, Osc::MixSample{0});
+        osc.process(mixBuffer);
+    }
+
+    template <typename Fn>
+    Bench::Result measure(const char* name, uint32_t samplesPerBlock, uint32_t blocks, Fn&& fn) noexcept {
+        Bench::Result r{name, samplesPerBlock, blocks, 0, 0xFFFFFFFF, 0};
+        fn(); // Warm up caches and flash prefetch
+
+        for (uint32_t b = 0; b < blocks; ++b) {
+            const uint32_t start = CycleCounter::now();
+            fn();
+            const uint32_t ticks = CycleCounter::now() - start;
+
+            r.totalTicks += ticks;
+            if (ticks < r.minBlockTicks) r.minBlockTicks = ticks;
+            if (ticks > r.maxBlockTicks) r.maxBlockTicks = ticks;
+        }
+        return r;
+    }
+}
+
+void Bench::runAll(uint32_t blocks, Reporter report, void* context) noexcept {
+    CycleCounter::init();
+
+    // Sawtooth test signal for the filters
+    for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) {
+        inputBlock[i] = 2.0f * static_cast<float>(i) / Constants::NUM_FRAMES - 1.0f;
+    }
+
+    // Osc::process, one sustained voice rendering into the stereo mix buffer
+    osc.init();
+    osc.setSustain(1.0f);
+    osc.setCutoff(2000.0f);
+    osc.noteOn(60, 1.0f);
+    report(measure("osc_process", Constants::NUM_FRAMES, blocks, [] {
+        renderVoice();
+    }), context);
+
+    // Same voice through the other kernel variants: A/B crossfade, then filter bypassed
+    osc.setMorph(0.5f);
+    report(measure("osc_process_crossfade", Constants::NUM_FRAMES, blocks, [] {
+        renderVoice();
+    }), context);
+
+    // Scanning a wavetable set, two adjacent frames blended like the A/B crossfade
+    Osc::requestWavetableSet(0);
+    Osc::updateSlots();
+    report(measure("osc_process_scan", Constants::NUM_FRAMES, blocks, [] {
+        renderVoice();
+    }), context);
+    Osc::requestWavetableSet(Osc::NO_SET);
+    Osc::updateSlots();
+
+    osc.setMorph(0.0f);
+
+    // The load governor's cheap kernel, nearest sample
+    osc.setQuality(Osc::Quality::NEAREST);
+    report(measure("osc_process_nearest", Constants::NUM_FRAMES, blocks, [] {
+        renderVoice();
+    }), context);
+    osc.setQuality(Osc::Quality::FULL);
+
+    osc.setCutoff(20000.0f);
+    report(measure("osc_process_bypass", Constants::NUM_FRAMES, blocks, [] {
+        renderVoice();
+    }), context);
+
+    // Adsr::getNextSample, cycling through attack/decay/sustain/release once a second
+    adsr.init();
+    adsr.setAttack(0.3f);
+    adsr.setDecay(0.3f);
+    adsr.setSustain(0.5f);
+    adsr.setRelease(0.3f);
+    report(measure("adsr_next_sample", Constants::NUM_FRAMES, blocks, [] {
+        static uint32_t counter = 0;
+        const uint32_t phase = counter++ % 1500;
+        if (phase == 0) adsr.gate(true);
+        else if (phase == 1000) adsr.gate(false);
+
+        float acc = 0.0f;
+        for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) acc += adsr.getNextSample();
+        sink = acc;
+    }), context);
+
+    // Adsr::renderBlock, same gate pattern with the whole block rendered in segment runs
+    adsr.init();
+    report(measure("adsr_render_block", Constants::NUM_FRAMES, blocks, [] {
+        static uint32_t counter = 0;
+        const uint32_t phase = counter++ % 1500;
+        if (phase == 0) adsr.gate(true);
+        else if (phase == 1000) adsr.gate(false);
+
+        float env[Constants::NUM_FRAMES];
+        adsr.renderBlock(env, Constants::NUM_FRAMES);
+        sink = env[Constants::NUM_FRAMES - 1];
+    }), context);
+
+    // SVF::process
+    svf.init();
+    svf.setCutoff(2000.0f);
+    svf.setResonance(0.5f);
+    report(measure("svf_process", Constants::NUM_FRAMES, blocks, [] {
+        svf.beginBlock();
+        float acc = 0.0f;
+        for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) acc += svf.process(inputBlock[i]);
+        sink = acc;
+    }), context);
+
+#if SYNTH_FIXED_POINT
+    // SVF::processQ, the Q27 version the fixed-point voices use
+    report(measure("svf_process_q", Constants::NUM_FRAMES, blocks, [] {
+        svf.beginBlock();
+        int32_t acc = 0;
+        for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) {
+            acc += svf.processQ(static_cast<int32_t>(inputBlock[i] * 134217728.0f));
+        }
+        sink = static_cast<float>(acc);
+    }), context);
+#endif
+
+    // MoogLadder::process
+    moog.init(static_cast<float>(Constants::SAMPLE_RATE));
+    moog.setCutoff(2000.0f);
+    moog.setResonance(0.5f);
+    report(measure("moog_process", Constants::NUM_FRAMES, blocks, [] {
+        float acc = 0.0f;
+        for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) acc += moog.process(inputBlock[i]);
+        sink = acc;
+    }), context);
+
+    // VoiceManager::process with every voice idle: LFO tick, mix bus clear and float to int16 conversion
+    report(measure("voicemanager_mix_convert", Constants::NUM_FRAMES, blocks, [] {
+        voices.process(outBuffer);
+    }), context);
+
+    // VoiceManager::process with all voices sustaining, the real per-block load
+    voices.setSustain(1.0f);
+    voices.setCutoff(2000.0f);
+    for (uint8_t i = 0; i < Constants::NUM_VOICES; ++i) voices.noteOn(48 + i * 5, 100);
+    report(measure("voicemanager_full", Constants::NUM_FRAMES, blocks, [] {
+        voices.process(outBuffer);
+    }), context);
+
+    // Same load with the cutoff moving every block, the filter is retuned once for all voices
+    report(measure("voicemanager_cutoff_sweep", Constants::NUM_FRAMES, blocks, [] {
+        static uint32_t counter = 0;
+        voices.setCutoff(500.0f + static_cast<float>(counter++ % 64) * 50.0f);
+        voices.process(outBuffer);
+    }), context);
+    voices.setCutoff(2000.0f);
+
+    // Same load with every voice modulated differently: the second envelope on cutoff and morph,
+    // note number on cutoff and a per-voice LFO on pitch, so each voice needs its own filter tuning
+    voices.setModRoute(2, {ModMatrix::Source::MOD_ENV, ModMatrix::Dest::CUTOFF, ModMatrix::Source::NONE, 2.0f});
+    voices.setModRoute(3, {ModMatrix::Source::NOTE, ModMatrix::Dest::CUTOFF, ModMatrix::Source::NONE, 1.0f});
+    voices.setModRoute(4, {ModMatrix::Source::MOD_ENV, ModMatrix::Dest::MORPH, ModMatrix::Source::NONE, 0.5f});
+    voices.setModRoute(5, {ModMatrix::Source::VOICE_LFO1, ModMatrix::Dest::PITCH, ModMatrix::Source::NONE, 0.2f});
+    report(measure("voicemanager_modulated", Constants::NUM_FRAMES, blocks, [] {
+        voices.process(outBuffer);
+    }), context);
+    for (uint8_t slot = 2; slot <= 5; ++slot) voices.setModRoute(slot, {});
+
+#if !SYNTH_SOA_VOICES
+    // Same chord with every voice stacking the full unison, panned and filtered per side
+    voices.setUnison(VoiceManager::MAX_UNISON, 0.15f, 0.7f);
+    report(measure("voicemanager_unison", Constants::NUM_FRAMES, blocks, [] {
+        voices.process(outBuffer);
+    }), context);
+    voices.setUnison(1, 0.15f, 0.7f);
+#endif
+    for (uint8_t i = 0; i < Constants::NUM_VOICES; ++i) voices.noteOff(48 + i * 5);
+
+    // Note handling alone, per note: a burst of twice as many notes as voices, so half of them
+    // steal, then the panic releases them all
+    report(measure("voicemanager_note_burst", 2 * Constants::NUM_VOICES, blocks, [] {
+        for (uint8_t i = 0; i < 2 * Constants::NUM_VOICES; ++i) voices.noteOn(36 + i * 3, 100);
+        voices.allNotesOff();
+    }), context);
+
+    // Osc::process while slot A crossfades to a new waveform, a new switch is requested every block
+    // and starts as soon as the previous fade is done
+    const uint8_t savedA = Osc::getActiveIdx(0);
+    const uint8_t savedB = Osc::getActiveIdx(1);
+    osc.setCutoff(2000.0f);
+    report(measure("osc_process_fade", Constants::NUM_FRAMES, blocks, [] {
+        static uint8_t idx = 0;
+        idx = (idx + 1) % WAVE_COUNT;
+        Osc::requestWaveform(idx, 0);
+        Osc::updateSlots();
+        renderVoice();
+    }), context);
+    for (uint32_t i = 0; i < Osc::FADE_FRAMES / Constants::NUM_FRAMES; ++i) Osc::updateSlots();
+    Osc::loadWaveform(savedA, 0);
+    Osc::loadWaveform(savedB, 1);
+}
+
+void Bench::printJson(const Result& r, void* context) noexcept {
+    const char* label = context ? static_cast<const char*>(context) : "";
+    const float ticksPerBlock = static_cast<float>(r.totalTicks) / static_cast<float>(r.blocks);
+    const float usPerBlock = CycleCounter::toMicros(1) * ticksPerBlock;
+
+    std::printf("{\"bench\":\"%s\",\"label\":\"%s\",\"unit\":\"%s\",\"blocks\":%lu,\"samples_per_block\":%lu,"
+                "\"ticks_per_sample\":%.2f,\"ticks_per_block\":%.1f,\"min_block\":%lu,\"max_block\":%lu,"
+                "\"us_per_block\":%.3f,\"budget_pct\":%.2f}\n",
+        r.name, label, CycleCounter::UNIT,
+        static_cast<unsigned long>(r.blocks), static_cast<unsigned long>(r.samplesPerBlock),
+        ticksPerBlock / static_cast<float>(r.samplesPerBlock), ticksPerBlock,
+        static_cast<unsigned long>(r.minBlockTicks), static_cast<unsigned long>(r.maxBlockTicks),
+        usPerBlock, 100.0f * usPerBlock / Constants::BLOCK_PERIOD_US);
+}
@@ -0,0 +1,21 @@
+#include "lfo.h"
+#include <algorithm>
+
+Lfo::Bank Lfo::defaults() noexcept {
+    Bank bank{};
+    bank[0] = {Constants::LFO_FREQ, 1.0f, 0, false, false};    // Sine, vibrato
+    bank[1] = {0.5f, 4.0f, 1, false, false};                   // Slow saw
+    bank[2] = {2.0f, 1.0f, 0, false, true};                    // Per voice sine, restarts with the note
+    bank[3] = {6.0f, 0.25f, 2, false, false};                  // Per voice square
+    return bank;
+}
+
+void Lfo::configure(const Settings& settings, float bpm) noexcept {
+    static constexpr float BLOCK_RATE = static_cast<float>(Constants::SAMPLE_RATE) / Constants::NUM_FRAMES;
+    float hz = settings.sync ? (bpm / 60.0f) / std::max(settings.beats, 1.0f / 16.0f) : settings.rate;
+    // Half the block rate at most so the increment fits, negative and NaN rates stand still
+    hz = (hz > 0.0f) ? std::min(hz, BLOCK_RATE * 0.5f) : 0.0f;
+    _inc = static_cast<uint32_t>((hz * 4294967296.0f) / BLOCK_RATE);
+    _table = waveLibrary[(settings.shape < WAVE_COUNT) ? settings.shape : 0];
+    _retrigger = settings.retrigger;
+}
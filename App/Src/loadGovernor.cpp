@@ -0,0 +1,35 @@
+#include "loadGovernor.h"
+
+void LoadGovernor::setDeadline(uint32_t ticks) noexcept {
+    _invDeadline = (ticks > 0) ? 1.0f / static_cast<float>(ticks) : 0.0f;
+    _load = 0.0f;
+    _level = 0;
+    _cooldown = 0;
+    _calm = 0;
+}
+
+void LoadGovernor::update(uint32_t ticks) noexcept {
+    if (!isEnabled()) return;
+
+    const float load = static_cast<float>(ticks) * _invDeadline;
+    const bool overrun = load > 1.0f;
+    if (overrun) ++_overruns;
+
+    // Average over ~8 blocks, one slow block from an interrupt burst doesn't count for much
+    _load += (load - _load) * 0.125f;
+    if (_cooldown > 0) --_cooldown;
+
+    if ((_load > HIGH_LOAD && _cooldown == 0) || overrun) {
+        if (_level < MAX_LEVEL) ++_level;
+        _cooldown = STEP_BLOCKS;
+        _calm = 0;
+        return;
+    }
+
+    if (_load >= LOW_LOAD) {
+        _calm = 0;
+    } else if (++_calm >= RECOVER_BLOCKS) {
+        if (_level > 0) --_level;
+        _calm = 0;
+    }
+}
@@ -1,10 +1,57 @@
 #include "midiBuffer.h"
+#include "midiBridge.h"
+#include "cycleCounter.h"
+#include <algorithm>
+#include <cstring>
+#include "usbd_audio.h"
+
+extern "C" USBD_HandleTypeDef hUsbDeviceFS;
 
 // Global buffer instance
 MidiBuffer gMidiBuffer;
 
+namespace {
+    uint8_t txBuffer[MidiBridge::TX_SIZE];
+    volatile uint32_t txOffset = 0;
+    volatile uint32_t txLength = 0;     // 0 when idle
+
+    void sendNext() noexcept {
+        const uint32_t start = txOffset;
+        const uint32_t chunk = std::min<uint32_t>(txLength - start, MIDI_PACKET_SIZE);
+        txOffset = start + chunk;
+        if (USBD_MIDI_Transmit(&hUsbDeviceFS, txBuffer + start, static_cast<uint16_t>(chunk)) != USBD_OK) {
+            txLength = 0; // Unplugged or not configured, the message is dropped
+        }
+    }
+}
+
+bool MidiBridge::send(const uint8_t* packets, uint32_t len) noexcept {
+    if (txLength != 0 || len == 0 || len > TX_SIZE) return false;
+    std::memcpy(txBuffer, packets, len);
+    txOffset = 0;
+    txLength = len;
+    sendNext();
+    return txLength != 0;
+}
+
+bool MidiBridge::isBusy() noexcept {
+    return txLength != 0;
+}
+
 extern "C" {
-    void Midi_Push_To_Buffer(uint8_t* raw) {
-        gMidiBuffer.push(raw);
+    // USB interrupt, one OUT transfer of 4-byte packets. Stamped here so nothing downstream
+    // moves the note.
+    void Midi_Push_Packets(uint8_t* raw, uint32_t length) {
+        gMidiBuffer.pushN(raw, length / 4, CycleCounter::now());
+    }
+
+    // USB interrupt, the last transfer went out
+    void Midi_Tx_Complete(void) {
+        if (txLength == 0) return;
+        if (txOffset >= txLength) {
+            txLength = 0;
+            return;
+        }
+        sendNext();
     }
 }
@@ -0,0 +1,132 @@
+#include "midiParser.h"
+
+namespace {
+    enum class Kind : uint8_t {
+        IGNORE,         // Reserved, cable events
+        COMMON,         // Two or three byte System Common
+        SYSEX,          // SysEx bytes, a message ends on its F7
+        SINGLE,         // One byte System Common, or SysEx ending with a lone F7
+        CHANNEL,        // Channel voice message, the CIN is its status nibble
+        BYTE            // Single byte, real-time or a SysEx byte sent one at a time
+    };
+
+    struct Cin {
+        Kind kind;
+        uint8_t size;   // Bytes of the packet in use
+    };
+
+    // Indexed by Code Index Number, USB-MIDI 1.0 table 4-1
+    constexpr Cin CIN_TABLE[16] = {
+        {Kind::IGNORE, 0}, {Kind::IGNORE, 0}, {Kind::COMMON, 2}, {Kind::COMMON, 3},
+        {Kind::SYSEX, 3}, {Kind::SINGLE, 1}, {Kind::SYSEX, 2}, {Kind::SYSEX, 3},
+        {Kind::CHANNEL, 3}, {Kind::CHANNEL, 3}, {Kind::CHANNEL, 3}, {Kind::CHANNEL, 3},
+        {Kind::CHANNEL, 2}, {Kind::CHANNEL, 2}, {Kind::CHANNEL, 3}, {Kind::BYTE, 1},
+    };
+
+    // Status nibbles 0x8-0xE
+    constexpr MidiEvent::Type CHANNEL_TYPE[7] = {
+        MidiEvent::Type::NOTE_OFF, MidiEvent::Type::NOTE_ON, MidiEvent::Type::POLY_PRESSURE,
+        MidiEvent::Type::CONTROL_CHANGE, MidiEvent::Type::PROGRAM_CHANGE,
+        MidiEvent::Type::CHANNEL_PRESSURE, MidiEvent::Type::PITCH_BEND,
+    };
+}
+
+bool MidiParser::feed(const MidiPacket& packet, MidiEvent& out) noexcept {
+    const uint8_t cable = packet.data[0] >> 4;
+    const uint8_t cin = packet.data[0] & 0x0F;
+    if (!((_cableMask >> cable) & 1)) return false;
+
+    const Cin info = CIN_TABLE[cin];
+    const uint8_t status = packet.data[1];
+
+    switch (info.kind) {
+        case Kind::CHANNEL: {
+            if ((status >> 4) != cin) {
+                ++_errors;
+                return false;
+            }
+            out = MidiEvent{};
+            out.type = CHANNEL_TYPE[cin - 0x8];
+            out.cable = cable;
+            out.channel = status & 0x0F;
+            out.status = status;
+            out.data1 = packet.data[2] & 0x7F;
+            out.data2 = (info.size == 3) ? (packet.data[3] & 0x7F) : 0;
+            out.stamp = packet.stamp;
+            if (out.type == MidiEvent::Type::NOTE_ON && out.data2 == 0) out.type = MidiEvent::Type::NOTE_OFF;
+            return true;
+        }
+
+        case Kind::SYSEX:
+            return feedSysex(packet, info.size, out);
+
+        case Kind::SINGLE:
+            if (status == 0xF7) return feedSysex(packet, 1, out);
+            [[fallthrough]];
+
+        case Kind::COMMON:
+            if (status < 0xF0) {
+                ++_errors;
+                return false;
+            }
+            out = MidiEvent{};
+            out.type = MidiEvent::Type::SYSTEM_COMMON;
+            out.cable = cable;
+            out.status = status;
+            out.data1 = (info.size > 1) ? (packet.data[2] & 0x7F) : 0;
+            out.data2 = (info.size > 2) ? (packet.data[3] & 0x7F) : 0;
+            out.stamp = packet.stamp;
+            return true;
+
+        case Kind::BYTE:
+            if (status >= 0xF8) {
+                out = MidiEvent{};
+                out.type = MidiEvent::Type::REALTIME;
+                out.cable = cable;
+                out.status = status;
+                out.stamp = packet.stamp;
+                return true;
+            }
+            return feedSysex(packet, 1, out);
+
+        case Kind::IGNORE:
+            break;
+    }
+    return false;
+}
+
+bool MidiParser::feedSysex(const MidiPacket& packet, uint32_t count, MidiEvent& out) noexcept {
+    const uint8_t cable = packet.data[0] >> 4;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint8_t byte = packet.data[1 + i];
+        if (byte == 0xF0) {
+            _inSysex = true;
+            _sysexOverflowed = false;
+            _sysexCable = cable;
+            _sysexLength = 0;
+        } else if (!_inSysex || cable != _sysexCable) {
+            // A continuation without its start, or interleaved from another cable
+            ++_errors;
+            return false;
+        }
+
+        if (_sysexLength < SYSEX_CAPACITY) _sysex[_sysexLength++] = byte;
+        else _sysexOverflowed = true;
+
+        if (byte == 0xF7) {
+            _inSysex = false;
+            if (_sysexOverflowed) {
+                ++_sysexOverflows;
+                return false;
+            }
+            out = MidiEvent{};
+            out.type = MidiEvent::Type::SYSEX;
+            out.cable = cable;
+            out.status = 0xF0;
+            out.stamp = packet.stamp;
+            return true;
+        }
+    }
+    return false;
+}
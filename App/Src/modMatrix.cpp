@@ -0,0 +1,39 @@
+#include "modMatrix.h"
+#include <algorithm>
+
+ModMatrix::Routes ModMatrix::defaults() noexcept {
+    Routes routes{};
+    // +-2% of pitch at full mod wheel, 12 * log2(1.02) semitones
+    routes[0] = {Source::LFO1, Dest::PITCH, Source::MOD_WHEEL, 0.3428f};
+    routes[1] = {Source::VELOCITY, Dest::AMP, Source::NONE, 1.0f};
+    return routes;
+}
+
+ModMatrix::Routes ModMatrix::mpeDefaults() noexcept {
+    Routes routes = defaults();
+    // Half the level at the strike, full level at full pressure
+    routes[2] = {Source::AFTERTOUCH, Dest::AMP, Source::NONE, 0.5f};
+    routes[3] = {Source::TIMBRE, Dest::CUTOFF, Source::NONE, 3.0f};
+    return routes;
+}
+
+ModMatrix::Result ModMatrix::evaluate(const Routes& routes, const Sources& sources) noexcept {
+    Result result{};
+    result[static_cast<uint32_t>(Dest::AMP)] = 1.0f;
+
+    for (const Route& r : routes) {
+        if (r.source == Source::NONE || r.amount == 0.0f) continue;
+
+        float amount = r.amount;
+        if (r.via != Source::NONE) amount *= value(sources, r.via);
+        const float s = value(sources, r.source);
+
+        float& out = result[static_cast<uint32_t>(r.dest)];
+        if (r.dest == Dest::AMP) {
+            out *= std::clamp((1.0f - amount) + amount * s, 0.0f, 1.0f);
+        } else {
+            out += amount * s;
+        }
+    }
+    return result;
+}
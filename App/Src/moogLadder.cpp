@@ -1,4 +1,4 @@
-#include "MoogLadder.h"
+#include "moogLadder.h"
 #include <algorithm>
 
 static constexpr float PI = 3.1415926535f;
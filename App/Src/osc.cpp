@@ -5,25 +5,31 @@
 #include "waveforms.h"
 #include "constants.h"
 
-float Osc::_wavetableA[Osc::TABLE_SIZE];
-float Osc::_wavetableB[Osc::TABLE_SIZE];
+const Osc::TableSample* Osc::_slot[2] = { waveLibrary[0], waveLibrary[1] };
+std::atomic<uint8_t> Osc::_requested[2] = { {Osc::NO_REQUEST}, {Osc::NO_REQUEST} };
+const Osc::TableSample* Osc::_fadeFrom = nullptr;
+uint8_t Osc::_fadeSlot = 0;
+uint32_t Osc::_fadeFrame = 0;
+const WavetableSet* Osc::_set = nullptr;
+std::atomic<uint8_t> Osc::_requestedSet{Osc::NO_REQUEST};
+uint8_t Osc::_currentSet = Osc::NO_SET;
+
+static_assert(Osc::FADE_FRAMES % Constants::NUM_FRAMES == 0, "Slot fades must end on a block boundary");
 float Osc::_midiTable[Osc::MIDI_TABLE_SIZE];
 
 uint8_t Osc::_currentIdx[2] = { 0, 1 };
 float Osc::_pitchBendMult = 1.0f;
 
-// Global LFO state initialization
-uint32_t Osc::_lfoPhase = 0;
-uint32_t Osc::_lfoInc = 0;
-float Osc::_lfoValue = 0.0f;
-
 void Osc::init() noexcept {
     _filter.init();
+    _filterR.init();
+    _filterR.setTuning(_filter.getTuning());
     _adsr.init();
-    
-    // Set LFO freq
-    _lfoInc = static_cast<uint32_t>((Constants::LFO_FREQ * 4294967296.0f) / (static_cast<float>(Constants::SAMPLE_RATE) / Constants::NUM_FRAMES)); // Adjusted for block rate
+    initTables();
+    calcPhaseInc();
+}
 
+void Osc::initTables() noexcept {
     static bool tablesInitialized = false;
     if (!tablesInitialized) {
         loadWaveform(3, 0); 
@@ -34,18 +40,22 @@ void Osc::init() noexcept {
         }
         tablesInitialized = true;
     }
-    calcPhaseInc();
 }
 
-void Osc::updateGlobalLFO() noexcept {
-    _lfoPhase += _lfoInc;
-    // Fast floating point sine approximation
-    _lfoValue = sinf(static_cast<float>(_lfoPhase) * 1.462918e-09f); // phase * (2PI / 2^32)
-}
     
 void Osc::calcPhaseInc() noexcept {
     float finalFreq = _freq * _pitchBendMult;
     _phaseInc = static_cast<uint32_t>((static_cast<double>(finalFreq) * 4294967296.0) / Constants::SAMPLE_RATE);
+
+    // No headroom is left above the pitch: the level is the lowest one safe for it exactly, so
+    // vibrato and bend pick it again through updateMipLevel() rather than riding on this one
+    updateMipLevel();
+}
+
+void Osc::updateMipLevel() noexcept {
+    // Runs on note start, pitch bend and pitch modulation changes, so the level follows what the kernel plays
+    const uint32_t inc = (_pitchMod == 1.0f) ? _phaseInc : static_cast<uint32_t>(_phaseInc * _pitchMod);
+    _mipLevel = WaveMip::levelFor(inc);
 }
 
 void Osc::setFreq(float freq) noexcept {
@@ -77,38 +87,94 @@ void Osc::noteOn(uint32_t midiNote, float amp) noexcept {
 
 void Osc::executeNoteOn(uint32_t midiNote, float amp) noexcept {
     _ph = 0;             // Clean phase start
+    // Unison copies start spread out by the golden ratio so they don't all peak together
+    for (uint32_t c = 0; c < MAX_UNISON; ++c) _uniPhase[c] = c * 0x9E3779B9u;
     _filter.reset();     // Clear filter energy
+    _filterR.reset();
     setFreq(midiNote);
     setAmplitude(amp);
+    _ampPrev = _ampFrom = _amp; // New notes start on their own level and morph, no ramp from the old ones
+    _ampStep = 0.0f;
+    _fresh = true;
     _adsr.gate(true);    // Standard ADSR start
     _pending.waiting = false;
 }
 
 void Osc::noteOff() noexcept {
+    // Let go before the stolen voice got to start it: the note is dropped and the old one
+    // finishes its kill ramp instead of turning it into a release
+    if (_pending.waiting) {
+        _pending.waiting = false;
+        return;
+    }
     _adsr.gate(false);
 }
 
 void Osc::getMorphedPreview(float* targetBuffer, uint16_t size, float morph) noexcept {
-    float step = static_cast<float>(TABLE_SIZE) / static_cast<float>(size);
+    // Preview draws the widest level the tables store, the scanned frames when a set is active
+    const TableView view = tableView(morph);
+    const uint32_t tableSize = WaveMip::size(view.topLevel);
+    float step = static_cast<float>(tableSize) / static_cast<float>(size);
     for (uint16_t i = 0; i < size; ++i) {
-        uint32_t idx = static_cast<uint32_t>(i * step) & (TABLE_SIZE - 1);
-        float s1 = _wavetableA[idx];
-        float s2 = _wavetableB[idx];
-        targetBuffer[i] = s1 + morph * (s2 - s1);
+        uint32_t idx = static_cast<uint32_t>(i * step) & (tableSize - 1);
+        float s1 = view.primary[idx] * WaveMip::Q15_SCALE;
+        float s2 = view.secondary ? view.secondary[idx] * WaveMip::Q15_SCALE : s1;
+        targetBuffer[i] = s1 + view.weight * (s2 - s1);
     }
 }
 
 void Osc::loadWaveform(uint8_t libraryIdx, uint8_t slot) noexcept {
     if (libraryIdx >= WAVE_COUNT || slot > 1) return;
-    const float* source = waveLibrary[libraryIdx];
-    float* target = (slot == 0) ? _wavetableA : _wavetableB;
-    std::copy(source, source + TABLE_SIZE, target);
+    _slot[slot] = waveLibrary[libraryIdx];
     _currentIdx[slot] = libraryIdx;
 }
 
+void Osc::requestWaveform(uint8_t libraryIdx, uint8_t slot, bool crossfade) noexcept {
+    if (libraryIdx >= WAVE_COUNT || slot > 1) return;
+    // A newer request simply replaces one the audio side hasn't picked up yet
+    _requested[slot].store(libraryIdx | (crossfade ? FADE_FLAG : 0), std::memory_order_release);
+    _currentIdx[slot] = libraryIdx;
+}
+
+void Osc::requestWavetableSet(uint8_t setIdx) noexcept {
+    if (setIdx >= WAVETABLE_SET_COUNT) setIdx = NO_SET;
+    _requestedSet.store(setIdx, std::memory_order_release);
+    _currentSet = setIdx;
+}
+
+void Osc::updateSlots() noexcept {
+    const uint8_t setRequest = _requestedSet.exchange(NO_REQUEST, std::memory_order_acquire);
+    if (setRequest != NO_REQUEST) {
+        _set = (setRequest < WAVETABLE_SET_COUNT) ? &wavetableSets[setRequest] : nullptr;
+    }
+
+    if (_fadeFrom) {
+        _fadeFrame += Constants::NUM_FRAMES;
+        if (_fadeFrame < FADE_FRAMES) return;
+        _fadeFrom = nullptr;
+    }
+
+    for (uint8_t slot = 0; slot < 2; ++slot) {
+        const uint8_t request = _requested[slot].exchange(NO_REQUEST, std::memory_order_acquire);
+        if (request == NO_REQUEST) continue;
+
+        const TableSample* table = waveLibrary[request & ~FADE_FLAG];
+        if (table == _slot[slot]) continue;
+
+        if (request & FADE_FLAG) {
+            _fadeFrom = _slot[slot];
+            _fadeSlot = slot;
+            _fadeFrame = 0;
+        }
+        _slot[slot] = table;
+
+        if (_fadeFrom) return; // A request on the other slot stays queued until this fade is done
+    }
+}
+
 void Osc::setPitchBend(int16_t bendValue) noexcept {
     float normalizedBend = static_cast<float>(bendValue) / 8192.0f;
-    _pitchBendMult = powf(2.0f, (normalizedBend * 2.0f) / 12.0f);
+    _pitchBendMult = Dsp::exp2((normalizedBend * 2.0f) / 12.0f);
 }
 
 void Osc::applyPitchBend() noexcept {
@@ -119,4 +185,26 @@ void Osc::forceReset() noexcept {
     //_ph = 0;
     _adsr.reset();
     _filter.reset();
+    _filterR.reset();
+}
+
+void Osc::setUnison(uint32_t copies, float detune, float spread) noexcept {
+    _unison = std::clamp<uint32_t>(copies, 1, MAX_UNISON);
+    if (_unison == 1) return;
+
+    // Only runs when the settings change, so the exp2 and sqrt stay out of the block loop
+    const float level = 1.0f / std::sqrt(static_cast<float>(_unison));
+    spread = std::clamp(spread, 0.0f, 1.0f);
+    for (uint32_t c = 0; c < _unison; ++c) {
+        const float pos = 2.0f * static_cast<float>(c) / static_cast<float>(_unison - 1) - 1.0f; // -1..1
+        _uniRatio[c] = std::exp2(detune * pos * (1.0f / 12.0f));
+        // Balance law: the centre copy plays at full level on both sides
+        const float pan = spread * pos;
+        _uniGain[c][0] = level * std::min(1.0f, 1.0f - pan);
+        _uniGain[c][1] = level * std::min(1.0f, 1.0f + pan);
+#if SYNTH_FIXED_POINT
+        _uniGainQ15[c][0] = static_cast<int32_t>(_uniGain[c][0] * 32767.0f);
+        _uniGainQ15[c][1] = static_cast<int32_t>(_uniGain[c][1] * 32767.0f);
+#endif
+    }
 }
@@ -1,41 +1,114 @@
-#include "SVF.h"
+#include "svf.h"
 #include "constants.h"
 
-//static constexpr float PI = 3.1415926535f;
-
 void SVF::init() noexcept {
-    sampleRate = Constants::SAMPLE_RATE;
-    s1 = 0.0f;
-    s2 = 0.0f;
-    setCutoff(1000.0f);
-    setResonance(0.0f);
+    reset();
+    tuning = &privateTuning;
+    tune(privateTuning, 1000.0f, 0.0f);
 }
 
-void SVF::setCutoff(float cutoffHz) noexcept {
-    cutoffHz = std::clamp(cutoffHz, 20.0f, sampleRate * 0.49f);
-    g = std::tan(Constants::PI * cutoffHz / sampleRate);
-    updateCoefficients();
+float SVF::cutoffToG(float cutoffHz) noexcept {
+    cutoffHz = std::clamp(cutoffHz, 20.0f, Constants::SAMPLE_RATE * 0.49f);
+    return std::tan(Constants::PI * cutoffHz / Constants::SAMPLE_RATE);
 }
 
-void SVF::setResonance(float resonance) noexcept {
+float SVF::resonanceToK(float resonance) noexcept {
     // Damping k: 2.0 (no res) to 0.01 (self-oscillation)
     resonance = std::clamp(resonance, 0.0f, 1.0f);
-    k = 2.0f * (1.0f - resonance);
-    
-    if (k < 0.01f) k = 0.01f;
-
-    updateCoefficients();
+    return std::max(2.0f * (1.0f - resonance), 0.01f);
 }
 
-void SVF::updateCoefficients() noexcept {
+SVF::Coefficients SVF::solve(float g, float k) noexcept {
     // Solve algebraic loop: D = 1 + g*k + g^2
-    float den = 1.0f / (1.0f + g * (g + k));
-    a1 = den;
-    a2 = g * a1;
-    a3 = g * a2;
+    const float den = 1.0f / (1.0f + g * (g + k));
+    return {den, g * den, g * (g * den)};
+}
+
+void SVF::tune(Tuning& t, float cutoffHz, float resonance) noexcept {
+    if (t.cutoff == cutoffHz && t.resonance == resonance) return;
+    t.cutoff = cutoffHz;
+    t.resonance = resonance;
+
+    const float k = resonanceToK(resonance);
+    const Coefficients c = solve(cutoffToG(cutoffHz), k);
+    t.a1 = c.a1;
+    t.a2 = c.a2;
+    t.a3 = c.a3;
+    t.bypassed = cutoffHz >= BYPASS_CUTOFF && k >= 2.0f;
+
+#if SYNTH_FIXED_POINT
+    // All three are below 1.0 for any cutoff under Nyquist
+    t.a1q = Dsp::floatToQ31(t.a1);
+    t.a2q = Dsp::floatToQ31(t.a2);
+    t.a3q = Dsp::floatToQ31(t.a3);
+#endif
+}
+
+void SVF::own() noexcept {
+    if (tuning != &privateTuning) {
+        privateTuning = *tuning;
+        tuning = &privateTuning;
+    }
+}
+
+void SVF::setCutoff(float cutoffHz) noexcept {
+    own();
+    tune(privateTuning, cutoffHz, privateTuning.resonance);
+}
+
+void SVF::setResonance(float resonance) noexcept {
+    own();
+    tune(privateTuning, privateTuning.cutoff, resonance);
+}
+
+void SVF::beginBlock() noexcept {
+    static constexpr float INV_FRAMES = 1.0f / Constants::NUM_FRAMES;
+    const Tuning& t = *tuning;
+    const Coefficients from = snap ? Coefficients{t.a1, t.a2, t.a3} : last;
+    ramp = from;
+    step = {(t.a1 - from.a1) * INV_FRAMES, (t.a2 - from.a2) * INV_FRAMES, (t.a3 - from.a3) * INV_FRAMES};
+    last = {t.a1, t.a2, t.a3};
+
+#if SYNTH_FIXED_POINT
+    static constexpr int32_t FRAMES = Constants::NUM_FRAMES;
+    const CoefficientsQ fromQ = snap ? CoefficientsQ{t.a1q, t.a2q, t.a3q} : lastQ;
+    rampQ = fromQ;
+    stepQ = {(t.a1q - fromQ.a1) / FRAMES, (t.a2q - fromQ.a2) / FRAMES, (t.a3q - fromQ.a3) / FRAMES};
+    lastQ = {t.a1q, t.a2q, t.a3q};
+#endif
+    snap = false;
 }
 
 void SVF::reset() noexcept {
-    s1 = 0.0f; 
+    // A voice restarting partway through a block holds the current tuning for the rest of it
+    // rather than finishing the ramp beginBlock() set up for the note before
+    const Tuning& t = *tuning;
+    snap = true;
+    ramp = {t.a1, t.a2, t.a3};
+    step = {};
+    s1 = 0.0f;
     s2 = 0.0f;
+#if SYNTH_FIXED_POINT
+    rampQ = {t.a1q, t.a2q, t.a3q};
+    stepQ = {};
+    s1q = 0;
+    s2q = 0;
+#endif
+}
+
+const SVF::Tuning* FilterCache::lookup(float cutoffHz, float resonance, bool evictCurrent) noexcept {
+    uint32_t oldest = 0;
+    for (uint32_t i = 0; i < SIZE; ++i) {
+        if (_entries[i].cutoff == cutoffHz && _entries[i].resonance == resonance) {
+            _lastUsed[i] = _block;
+            return &_entries[i];
+        }
+        if (_lastUsed[i] < _lastUsed[oldest]) oldest = i;
+    }
+
+    // More entries than voices, so from modulate() at least one wasn't asked for this block
+    if (_lastUsed[oldest] == _block && !evictCurrent) return nullptr;
+    _lastUsed[oldest] = _block;
+    SVF::tune(_entries[oldest], cutoffHz, resonance);
+    return &_entries[oldest];
 }
@@ -0,0 +1,103 @@
+#include "telemetry.h"
+#include <algorithm>
+
+namespace {
+    uint8_t* putField(uint8_t* out, uint32_t value) noexcept {
+        for (uint32_t i = 0; i < Telemetry::FIELD_BYTES; ++i) {
+            *out++ = static_cast<uint8_t>(value & 0x7F);
+            value >>= 7;
+        }
+        return out;
+    }
+
+    uint32_t getField(const uint8_t*& in) noexcept {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < Telemetry::FIELD_BYTES; ++i) value |= static_cast<uint32_t>(*in++ & 0x7F) << (7 * i);
+        return value;
+    }
+
+    bool isHeader(const uint8_t* sysex, uint32_t len) noexcept {
+        return len >= 5 && sysex[0] == 0xF0 && sysex[1] == Telemetry::MANUFACTURER &&
+               sysex[2] == Telemetry::DEVICE && sysex[len - 1] == 0xF7;
+    }
+}
+
+void Telemetry::setDeadline(uint32_t ticks, uint32_t ticksPerSecond) noexcept {
+    _deadline = ticks;
+    _binTicks = std::max<uint32_t>(ticks / BINS_PER_DEADLINE, 1);
+    _ticksPerSecond = ticksPerSecond;
+}
+
+void Telemetry::collect(Report& out) noexcept {
+    out.tickRateKhz = _ticksPerSecond / 1000;
+    out.deadlineTicks = _deadline;
+    for (uint32_t i = 0; i < CALLBACKS; ++i) {
+        out.timing[i] = _timing[i];
+        _timing[i] = Timing{};
+    }
+    out.underruns = _underruns;
+}
+
+uint32_t Telemetry::encode(const Report& report, uint8_t* out) noexcept {
+    uint8_t* p = out;
+    *p++ = 0xF0;
+    *p++ = MANUFACTURER;
+    *p++ = DEVICE;
+    *p++ = REPORT;
+    p = putField(p, report.tickRateKhz);
+    p = putField(p, report.deadlineTicks);
+    for (const Timing& t : report.timing) {
+        p = putField(p, t.blocks);
+        p = putField(p, t.blocks ? t.minTicks : 0);
+        p = putField(p, t.maxTicks);
+        p = putField(p, t.blocks ? static_cast<uint32_t>(t.sumTicks / t.blocks) : 0); // Mean
+        for (uint32_t bin : t.histogram) p = putField(p, bin);
+    }
+    p = putField(p, report.underruns);
+    p = putField(p, report.midiOverflows);
+    p = putField(p, report.midiHighWater);
+    p = putField(p, report.activeVoices);
+    p = putField(p, report.governorLevel);
+    *p++ = 0xF7;
+    return static_cast<uint32_t>(p - out);
+}
+
+bool Telemetry::decode(const uint8_t* sysex, uint32_t len, Report& out) noexcept {
+    if (len != SYSEX_SIZE || !isHeader(sysex, len) || sysex[3] != REPORT) return false;
+    const uint8_t* p = sysex + 4;
+    out.tickRateKhz = getField(p);
+    out.deadlineTicks = getField(p);
+    for (Timing& t : out.timing) {
+        t.blocks = getField(p);
+        t.minTicks = getField(p);
+        t.maxTicks = getField(p);
+        t.sumTicks = static_cast<uint64_t>(getField(p)) * t.blocks; // Only the mean is sent
+        for (uint32_t& bin : t.histogram) bin = getField(p);
+    }
+    out.underruns = getField(p);
+    out.midiOverflows = getField(p);
+    out.midiHighWater = getField(p);
+    out.activeVoices = getField(p);
+    out.governorLevel = getField(p);
+    return true;
+}
+
+Telemetry::Command Telemetry::parseRequest(const uint8_t* sysex, uint32_t len) noexcept {
+    if (len != 5 || !isHeader(sysex, len)) return Command::NONE;
+    const uint8_t cmd = sysex[3];
+    if (cmd < static_cast<uint8_t>(Command::SEND) || cmd > static_cast<uint8_t>(Command::STREAM_OFF)) return Command::NONE;
+    return static_cast<Command>(cmd);
+}
+
+uint32_t Telemetry::toUsbPackets(const uint8_t* sysex, uint32_t len, uint8_t* out) noexcept {
+    // CIN 0x4: SysEx starts or continues with 3 bytes, 0x5/0x6/0x7: SysEx ends with 1/2/3 bytes
+    uint32_t written = 0;
+    for (uint32_t i = 0; i < len; i += 3) {
+        const uint32_t n = std::min<uint32_t>(len - i, 3);
+        const bool last = (i + n == len);
+        out[written] = last ? static_cast<uint8_t>(0x4 + n) : 0x4;
+        for (uint32_t j = 0; j < 3; ++j) out[written + 1 + j] = (j < n) ? sysex[i + j] : 0;
+        written += 4;
+    }
+    return written;
+}
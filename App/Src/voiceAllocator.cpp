@@ -0,0 +1,105 @@
+#include "voiceAllocator.h"
+#include <initializer_list>
+
+VoiceAllocator::VoiceAllocator() noexcept {
+    _head.fill(NONE);
+    _tail.fill(NONE);
+    _noteVoice.fill(NONE);
+    for(uint8_t v = 0; v < Constants::NUM_VOICES; ++v) {
+        _note[v] = 0;
+        _channel[v] = 0;
+        _sameNote[v] = NONE;
+        append(v, List::FREE);
+    }
+}
+
+uint8_t VoiceAllocator::find(uint8_t note, uint8_t channel, List list) const noexcept {
+    for(uint8_t v = _noteVoice[note & 0x7F]; v != NONE; v = _sameNote[v]) {
+        if(_list[v] == list && (channel == ANY_CHANNEL || _channel[v] == channel)) return v;
+    }
+    return NONE;
+}
+
+uint8_t VoiceAllocator::allocate(uint8_t note, uint8_t channel, bool useFree, const float* levels) noexcept {
+    note &= 0x7F;
+    const uint8_t v = (useFree && !empty(List::FREE)) ? oldest(List::FREE) : steal(note, levels);
+    if(v == NONE) return NONE;
+
+    if(_list[v] != List::FREE) unmapNote(v);
+    _note[v] = note;
+    _channel[v] = channel;
+    _sameNote[v] = _noteVoice[note];
+    _noteVoice[note] = v;
+    moveTo(v, List::HELD);
+    return v;
+}
+
+void VoiceAllocator::free(uint8_t voice) noexcept {
+    if(_list[voice] == List::FREE) return;
+    unmapNote(voice);
+    moveTo(voice, List::FREE);
+}
+
+uint8_t VoiceAllocator::steal(uint8_t note, const float* levels) const noexcept {
+    switch(_policy) {
+        case StealPolicy::QUIETEST:
+            // Up to NUM_VOICES comparisons where the other policies take one
+            for(List list : {List::RELEASED, List::SUSTAINED, List::HELD}) {
+                const uint8_t v = quietest(list, levels);
+                if(v != NONE) return v;
+            }
+            return NONE;
+
+        case StealPolicy::SAME_NOTE:
+            for(uint8_t v = _noteVoice[note]; v != NONE; v = _sameNote[v]) {
+                if(_list[v] == List::RELEASED) return v;
+            }
+            [[fallthrough]];
+
+        case StealPolicy::OLDEST:
+            break;
+    }
+    return firstSounding();
+}
+
+uint8_t VoiceAllocator::firstSounding() const noexcept {
+    for(List list : {List::RELEASED, List::SUSTAINED, List::HELD}) {
+        if(!empty(list)) return oldest(list);
+    }
+    return NONE;
+}
+
+uint8_t VoiceAllocator::quietest(List list, const float* levels) const noexcept {
+    uint8_t best = NONE;
+    for(uint8_t v = oldest(list); v != NONE; v = _next[v]) {
+        if(best == NONE || levels[v] < levels[best]) best = v;
+    }
+    return best;
+}
+
+void VoiceAllocator::unlink(uint8_t voice) noexcept {
+    const uint32_t l = index(_list[voice]);
+    const uint8_t prev = _prev[voice];
+    const uint8_t next = _next[voice];
+    if(prev != NONE) _next[prev] = next;
+    else _head[l] = next;
+    if(next != NONE) _prev[next] = prev;
+    else _tail[l] = prev;
+}
+
+void VoiceAllocator::append(uint8_t voice, List list) noexcept {
+    const uint32_t l = index(list);
+    _list[voice] = list;
+    _prev[voice] = _tail[l];
+    _next[voice] = NONE;
+    if(_tail[l] != NONE) _next[_tail[l]] = voice;
+    else _head[l] = voice;
+    _tail[l] = voice;
+}
+
+void VoiceAllocator::unmapNote(uint8_t voice) noexcept {
+    uint8_t* link = &_noteVoice[_note[voice]];
+    while(*link != NONE && *link != voice) link = &_sameNote[*link];
+    if(*link == voice) *link = _sameNote[voice];
+    _sameNote[voice] = NONE;
+}
@@ -0,0 +1,265 @@
+#include "voiceBank.h"
+#include <algorithm>
+#include "waveforms.h"
+
+VoiceBank::VoiceBank() noexcept {
+    for (uint32_t i = 0; i < LANES; ++i) {
+        _voices[i]._bank = this;
+        _voices[i]._lane = i;
+    }
+}
+
+void VoiceBank::Voice::init() noexcept {
+    _adsr.init();
+    static SVF::Tuning initial;
+    SVF::tune(initial, 1000.0f, 0.0f);
+    setFilter(initial);
+    _bank->_s1[_lane] = 0.0f;
+    _bank->_s2[_lane] = 0.0f;
+    setAmplitude(0.5f);
+    setMorph(0.0f);
+
+    Osc::initTables();
+    calcPhaseInc();
+}
+
+void VoiceBank::Voice::calcPhaseInc() noexcept {
+    const float finalFreq = _freq * Osc::_pitchBendMult;
+    const uint32_t inc = static_cast<uint32_t>((static_cast<double>(finalFreq) * 4294967296.0) / Constants::SAMPLE_RATE);
+
+    _bank->_baseInc[_lane] = inc;
+    updateMipLevel();
+}
+
+void VoiceBank::Voice::updateMipLevel() noexcept {
+    const uint32_t inc = _bank->_baseInc[_lane];
+    _bank->_mipLevel[_lane] = WaveMip::levelFor((_pitchMod == 1.0f) ? inc : static_cast<uint32_t>(inc * _pitchMod));
+}
+
+void VoiceBank::Voice::setPitchMod(float ratio) noexcept {
+    if (ratio == _pitchMod) return;
+    _pitchMod = ratio;
+    updateMipLevel();
+}
+
+void VoiceBank::Voice::setFilter(const SVF::Tuning& tuning) noexcept {
+    // Read in the next block prologue, which copies the ramp into the lane arrays
+    _tuning = &tuning;
+}
+
+void VoiceBank::Voice::setAmplitude(float amp) noexcept {
+    _ampTarget = std::clamp(amp, 0.0f, 1.0f);
+}
+
+void VoiceBank::Voice::setMorph(float morph) noexcept {
+    _bank->_morph[_lane] = std::clamp(morph, 0.0f, 1.0f);
+}
+
+void VoiceBank::Voice::noteOn(uint32_t midiNote, float amp) noexcept {
+    if (!_adsr.isActive()) {
+        executeNoteOn(midiNote, amp);
+    } else {
+        _pending.midiNote = midiNote;
+        _pending.velocity = amp;
+        _pending.waiting = true;
+
+        _adsr.kill();
+    }
+}
+
+void VoiceBank::Voice::executeNoteOn(uint32_t midiNote, float amp) noexcept {
+    _bank->_phase[_lane] = 0;  // Clean phase start
+    _bank->_s1[_lane] = 0.0f;  // Clear filter energy
+    _bank->_s2[_lane] = 0.0f;
+    _freq = Osc::_midiTable[midiNote & 0x7F];
+    calcPhaseInc();
+    setAmplitude(amp);
+    _fresh = true;  // New notes start on their own level, morph and filter, no ramp
+    _snap = true;
+    _adsr.gate(true);
+    _pending.waiting = false;
+}
+
+void VoiceBank::Voice::noteOff() noexcept {
+    // Same as Osc::noteOff(), a note let go before it started is dropped
+    if (_pending.waiting) {
+        _pending.waiting = false;
+        return;
+    }
+    _adsr.gate(false);
+}
+
+void VoiceBank::Voice::forceReset() noexcept {
+    _adsr.reset();
+    _snap = true;
+    _bank->_s1[_lane] = 0.0f;
+    _bank->_s2[_lane] = 0.0f;
+}
+
+void VoiceBank::process(MixSample* __restrict__ buffer) noexcept {
+    uint32_t lanes = 0;
+    bool blend = false;
+    bool filter = false;
+    bool fade = false;
+
+    // Block prologue, everything that branches per voice
+    for (uint32_t l = 0; l < LANES; ++l) {
+        Voice& v = _voices[l];
+        if (!v._adsr.isActive() && v._pending.waiting) {
+            v.executeNoteOn(v._pending.midiNote, v._pending.velocity);
+        }
+
+        if (v._fresh) {
+            v._morphPrev = _morph[l];
+            v._ampPrev = v._ampTarget;
+            v._fresh = false;
+        }
+
+        // Lanes that don't crossfade or fade point the extra tables at their own, so the blend is exact
+        const Osc::TableView view = Osc::rampView(v._morphPrev, _morph[l]);
+        v._morphPrev = _morph[l];
+        const uint32_t level = std::max(_mipLevel[l], view.topLevel);
+        const uint32_t offset = WaveMip::OFFSETS[level] - WaveMip::OFFSETS[view.topLevel];
+        const uint32_t shift = 32 - WaveMip::sizeBits(level);
+        _mipShift[l] = shift;
+        _fracMask[l] = (1u << shift) - 1;
+        _fracScale[l] = 1.0f / static_cast<float>(1u << shift);
+        _tableA[l] = view.primary + offset;
+        _tableB[l] = (view.secondary ? view.secondary : view.primary) + offset;
+        _tableOld[l] = (view.fadeFrom ? view.fadeFrom : view.primary) + offset;
+        _weight[l] = view.weight;
+        _weightStep[l] = view.weightStep;
+
+        _amp[l] = v._ampPrev;
+        _ampStep[l] = (v._ampTarget - v._ampPrev) * (1.0f / Constants::NUM_FRAMES);
+        v._ampPrev = v._ampTarget;
+
+        // Filter ramp as in SVF::beginBlock()
+        const SVF::Tuning& t = *v._tuning;
+        const SVF::Coefficients to{t.a1, t.a2, t.a3};
+        const SVF::Coefficients from = v._snap ? to : v._coefPrev;
+        _a1[l] = from.a1;
+        _a2[l] = from.a2;
+        _a3[l] = from.a3;
+        _da1[l] = (to.a1 - from.a1) * (1.0f / Constants::NUM_FRAMES);
+        _da2[l] = (to.a2 - from.a2) * (1.0f / Constants::NUM_FRAMES);
+        _da3[l] = (to.a3 - from.a3) * (1.0f / Constants::NUM_FRAMES);
+        v._coefPrev = to;
+        v._snap = false;
+        _bypass[l] = t.bypassed;
+
+        if (!v._adsr.isActive()) {
+            // Idle lanes keep a clean filter, they still read the tables but stay silent
+            _s1[l] = 0.0f;
+            _s2[l] = 0.0f;
+            v._snap = true;
+            for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) _env[i][l] = 0.0f;
+            continue;
+        }
+
+        float env[Constants::NUM_FRAMES];
+        v._adsr.renderBlock(env, Constants::NUM_FRAMES);
+        for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) _env[i][l] = env[i];
+
+        // Block-rate pitch modulation
+        _inc[l] = static_cast<uint32_t>(_baseInc[l] * v._pitchMod);
+
+        if (view.secondary) blend = true;
+        if (view.fadeFrom) fade = true;
+        if (!_bypass[l]) filter = true;
+
+        lanes = l + 1;
+    }
+
+    if (lanes == 0) return;
+
+    // Only walk up to the highest active lane, rounded up to a whole group
+    lanes = std::min((lanes + GROUP - 1) & ~(GROUP - 1), LANES);
+
+    using Kernel = void (VoiceBank::*)(MixSample* __restrict__, uint32_t) noexcept;
+    static constexpr Kernel kernels[8] = {
+        &VoiceBank::render<false, false, false>, &VoiceBank::render<true, false, false>,
+        &VoiceBank::render<false, true, false>,  &VoiceBank::render<true, true, false>,
+        &VoiceBank::render<false, false, true>,  &VoiceBank::render<true, false, true>,
+        &VoiceBank::render<false, true, true>,   &VoiceBank::render<true, true, true>,
+    };
+    (this->*kernels[(blend ? 1 : 0) | (filter ? 2 : 0) | (fade ? 4 : 0)])(buffer, lanes);
+}
+
+template <bool Blend, bool Filter, bool Fade>
+void VoiceBank::render(MixSample* __restrict__ buffer, uint32_t lanes) noexcept {
+    alignas(16) float x[LANES];
+    alignas(16) float out[LANES];
+    const uint32_t fadeFrame = Osc::_fadeFrame + 1;
+
+    for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) {
+        // Table gather, the only per-lane scalar step
+        for (uint32_t l = 0; l < lanes; ++l) {
+            const uint32_t ph = _phase[l];
+            const uint32_t shift = _mipShift[l];
+            const uint32_t idx1 = ph >> shift;
+            const uint32_t idx2 = (idx1 + 1) & (0xFFFFFFFFu >> shift);
+            const float fraction = static_cast<float>(ph & _fracMask[l]) * _fracScale[l];
+
+            const Osc::TableSample* __restrict__ tableA = _tableA[l];
+            float s1 = tableA[idx1] + (tableA[idx2] - tableA[idx1]) * fraction;
+            if constexpr (Fade) {
+                const Osc::TableSample* __restrict__ tableOld = _tableOld[l];
+                const float old = tableOld[idx1] + (tableOld[idx2] - tableOld[idx1]) * fraction;
+                s1 = old + static_cast<float>(fadeFrame + i) * (1.0f / Osc::FADE_FRAMES) * (s1 - old);
+            }
+            if constexpr (Blend) {
+                const Osc::TableSample* __restrict__ tableB = _tableB[l];
+                const float s2 = tableB[idx1] + (tableB[idx2] - tableB[idx1]) * fraction;
+                x[l] = s1 + (_weight[l] + _weightStep[l] * static_cast<float>(i + 1)) * (s2 - s1);
+            } else {
+                x[l] = s1;
+            }
+
+            _phase[l] = ph + _inc[l];
+        }
+
+        // Gain and SVF across all lanes, straight-line code the compiler can vectorize
+        const float* __restrict__ env = _env[i];
+        for (uint32_t l = 0; l < lanes; ++l) {
+            const float amp = _amp[l] + _ampStep[l] * static_cast<float>(i + 1);
+            const float input = x[l] * ((amp * WaveMip::Q15_SCALE) * env[l]);
+            if constexpr (!Filter) {
+                _s1[l] = 0.0f;
+                _s2[l] = input;
+                out[l] = input;
+                continue;
+            }
+
+            const float s1 = _s1[l];
+            const float s2 = _s2[l];
+
+            const float a1 = (_a1[l] += _da1[l]);
+            const float a2 = (_a2[l] += _da2[l]);
+            const float a3 = (_a3[l] += _da3[l]);
+
+            const float v3 = input - s2;
+            const float v1 = a1 * s1 + a2 * v3;
+            const float v2 = s2 + a2 * s1 + a3 * v3;
+
+            // Branchless fast_tanh: clamping to +-3 lands exactly on the Pade curve's +-1
+            const float t = std::clamp(2.0f * v1 - s1, -3.0f, 3.0f);
+            const float t2 = t * t;
+            const float next1 = t * (27.0f + t2) / (27.0f + 9.0f * t2);
+            const float next2 = 2.0f * v2 - s2;
+
+            // Bypassed lanes pass the input and follow it with their state, as in SVF::track()
+            const bool bypass = _bypass[l];
+            _s1[l] = bypass ? 0.0f : next1;
+            _s2[l] = bypass ? input : next2;
+            out[l] = bypass ? input : v2;
+        }
+
+        // Summed in lane order, the same order the per-voice path adds into the bus
+        float mix = 0.0f;
+        for (uint32_t l = 0; l < lanes; ++l) mix += out[l];
+
+        buffer[i << 1] += mix;
+        buffer[(i << 1) + 1] += mix;
+    }
+}
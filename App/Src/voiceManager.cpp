@@ -1,83 +1,218 @@
 #include "voiceManager.h"
-#include "app.h"
+#include <algorithm>
+#include <initializer_list>
 
-void VoiceManager::noteOn(uint8_t note, uint8_t velocity) {
-    _tickCount++;
-    int bestVoice = -1;
-    uint32_t oldestTime = 0xFFFFFFFF;
-    bool foundReleased = false;
+void VoiceManager::noteOn(uint8_t note, uint8_t velocity, uint8_t channel) {
+    // Key sync: global LFOs restart on the first note after all keys were let go
+    if(_alloc.empty(VoiceAllocator::List::HELD)) {
+        for(auto& lfo : _lfos) if(lfo.retriggers()) lfo.retrigger();
+    }
 
-    float velGain = static_cast<float>(velocity) / 127.0f;
+    const float velGain = static_cast<float>(velocity) / 127.0f;
+    channel = noteChannel(channel);
 
-    // Re-trigger check
-    for(int i = 0; i < Constants::NUM_VOICES; i++) {
-        if(_noteMap[i] == note) {
-            _voices[i].noteOn(note, velGain);
-            _lastUsed[i] = _tickCount;
-            return;
-        }
+    // Re-trigger check, a key struck again under the pedal takes its voice back
+    uint8_t v = _alloc.find(note, channel, VoiceAllocator::List::HELD);
+    if(v == VoiceAllocator::NONE && !_alloc.empty(VoiceAllocator::List::SUSTAINED)) {
+        v = _alloc.find(note, channel, VoiceAllocator::List::SUSTAINED);
+    }
+    if(v != VoiceAllocator::NONE) {
+        _alloc.retrigger(v);
+    } else {
+        // Under the load governor's voice limit idle voices stay idle, a sounding one is stolen instead
+        const uint32_t limit = _governor.voiceLimit();
+        const bool atLimit = limit < Constants::NUM_VOICES && soundingVoices() >= limit;
+        v = _alloc.allocate(note, channel, !atLimit, _voiceLevels.data());
+        if(v == VoiceAllocator::NONE) return;
     }
 
-    // Find best voice: Idle > Released > Active
-    for(int i = 0; i < Constants::NUM_VOICES; i++) {
-        // Absolute priority: Grab a silent voice
-        if(!_voices[i].isActive()) {
-            bestVoice = i;
-            break; 
-        }
+    _held.set(note & 0x7F);
+    _velocity[v] = velGain;
+    _modEnv[v].gate(true);
+    for(auto& lfo : _voiceLfos[v]) if(lfo.retriggers()) lfo.retrigger();
 
-        // Grab the oldest released voice
-        bool isReleasing = (_noteMap[i] == 255); 
-        
-        if (isReleasing && !foundReleased) {
-            foundReleased = true;
-            oldestTime = _lastUsed[i];
-            bestVoice = i;
-        } 
-        else if (isReleasing == foundReleased) {
-            // If both are same status, take oldest
-            if (_lastUsed[i] < oldestTime) {
-                oldestTime = _lastUsed[i];
-                bestVoice = i;
-            }
+    // Osc internally handles re-trigger, immediate start and soft-kill
+    _voices[v].noteOn(note, velGain);
+    if(!_voices[v].hasPendingNote()) startVoice(v);
+}
+
+void VoiceManager::noteOff(uint8_t note, uint8_t channel) {
+    note &= 0x7F;
+    const uint8_t v = _alloc.find(note, noteChannel(channel), VoiceAllocator::List::HELD);
+
+    if(v != VoiceAllocator::NONE) {
+        // Under a pedal the key goes up but the voice keeps sounding
+        if(_sustainDown || _sostenuto.test(note)) {
+            if(_sustainDown) _sustained.set(note);
+            _alloc.sustain(v);
+        } else {
+            releaseVoice(v);
         }
     }
+    // The key is up even when its voice was stolen or shed. MPE can have the same note down on
+    // another channel.
+    if(_current.mpeChannels == 0 || _alloc.find(note, VoiceAllocator::ANY_CHANNEL, VoiceAllocator::List::HELD) == VoiceAllocator::NONE) {
+        _held.reset(note);
+    }
+}
+
+void VoiceManager::allNotesOff() {
+    // Pedals let go of their notes too
+    for(auto list : {VoiceAllocator::List::HELD, VoiceAllocator::List::SUSTAINED}) {
+        while(!_alloc.empty(list)) releaseVoice(_alloc.oldest(list));
+    }
+    _held.clear();
+    _sustained.clear();
+    _sostenuto.clear();
+}
+
+void VoiceManager::setPedal(Pedal pedal, bool down) {
+    if(pedal == Pedal::SUSTAIN) sustainPedal(down);
+    else if(pedal == Pedal::SOSTENUTO) sostenutoPedal(down);
+}
+
+void VoiceManager::sustainPedal(bool down) noexcept {
+    if(down == _sustainDown) return;
+    _sustainDown = down;
+    if(down) return;
 
-    // Dispatch note
-    if(bestVoice != -1) {
-        _noteMap[bestVoice] = note;
-        _lastUsed[bestVoice] = _tickCount;
-        
-        // Osc internally handles immediate start vs soft-kill
-        _voices[bestVoice].noteOn(note, velGain);
+    // Everything the pedal kept, except what sostenuto still latches
+    _sustained.without(_sostenuto).forEach([this](uint8_t note) { releaseSustained(note); });
+    _sustained.clear();
+}
+
+void VoiceManager::sostenutoPedal(bool down) noexcept {
+    if(down == _sostenutoDown) return;
+    _sostenutoDown = down;
+    if(down) {
+        // Latches the keys down right now, later ones aren't held
+        _sostenuto = _held;
+        return;
     }
+
+    // Latched notes whose keys are up, handed to the sustain pedal if that is still down
+    const NoteSet released = _sostenuto.without(_held);
+    if(_sustainDown) _sustained |= released;
+    else released.forEach([this](uint8_t note) { releaseSustained(note); });
+    _sostenuto.clear();
 }
 
-void VoiceManager::noteOff(uint8_t note) {
+void VoiceManager::releaseSustained(uint8_t note) noexcept {
+    // Every pedal-held voice of the note, whatever its channel
+    uint8_t v;
+    while((v = _alloc.find(note, VoiceAllocator::ANY_CHANNEL, VoiceAllocator::List::SUSTAINED)) != VoiceAllocator::NONE) {
+        releaseVoice(v);
+    }
+}
+
+void VoiceManager::releaseVoice(uint8_t voice) noexcept {
+    _voices[voice].noteOff();
+    _modEnv[voice].gate(false);
+    _alloc.release(voice);
+}
+
+uint32_t VoiceManager::soundingVoices() const noexcept {
+    // Voices fading out on a kill ramp are on their way out and don't count
+    uint32_t sounding = 0;
     for(int i = 0; i < Constants::NUM_VOICES; i++) {
-        if(_noteMap[i] == note) {
-            _voices[i].noteOff();
-            _noteMap[i] = 255; 
+        if(_voices[i].isActive() && !_voices[i].isKilled()) ++sounding;
+    }
+    return sounding;
+}
+
+void VoiceManager::govern() noexcept {
+#if !SYNTH_SOA_VOICES
+    // Kernel quality for this block: released voices go cheap first since they are fading anyway
+    for(int i = 0; i < Constants::NUM_VOICES; i++) {
+        const bool released = (_alloc.list(i) == VoiceAllocator::List::RELEASED);
+        const bool cheap = _governor.cheapAll() || (released && _governor.cheapReleased());
+        _voices[i].setQuality(cheap ? Osc::Quality::NEAREST : Osc::Quality::FULL);
+    }
+#endif
+
+    // Over the voice limit the quietest voices fade out on a kill ramp instead of cutting off
+    uint32_t sounding = soundingVoices();
+    while(sounding > _governor.voiceLimit()) {
+        int quietest = -1;
+        float lowest = 2.0f;
+        for(int i = 0; i < Constants::NUM_VOICES; i++) {
+            const auto& v = _voices[i];
+            if(!v.isActive() || v.isKilled()) continue;
+            if(v.getAdsrLevel() < lowest) {
+                lowest = v.getAdsrLevel();
+                quietest = i;
+            }
         }
+        if(quietest < 0) break;
+        _voices[quietest].kill();
+        _modEnv[quietest].gate(false);
+        if(_alloc.list(quietest) != VoiceAllocator::List::RELEASED) _alloc.release(quietest);
+        --sounding;
     }
 }
 
 void VoiceManager::process(int16_t* buffer) {
-    // Tick global LFO once per block
-    Osc::updateGlobalLFO();
+    applyParams();
 
-    std::fill(mixBus, mixBus + Constants::BUFFER_SIZE, 0.0f);
+    // However many bend messages came in, the voices retune once per block
+    if (_perf.pitchBend != _appliedBend) {
+        _appliedBend = _perf.pitchBend;
+        Osc::setPitchBend(_appliedBend);
+        for(auto& v : _voices) v.applyPitchBend();
+    }
 
-    for(int i = 0; i < Constants::NUM_VOICES; ++i) {
-        auto& v = _voices[i];
-        if(v.isActive()) {
-            v.process(mixBus);
-            _voiceLevels[i] = v.getAdsrLevel();
-        } else {
-            _voiceLevels[i] = 0.0f;
-        }
+    govern();
+
+    // Pick up wavetable switches once per block, LFOs tick in modulate()
+    Osc::updateSlots();
+
+    modulate();
+
+    std::fill(mixBus, mixBus + Constants::BUFFER_SIZE, Osc::MixSample{0});
+
+    // Notes due in this block, late ones play on its first frame
+    const uint32_t blockStart = _frame.load(std::memory_order_relaxed);
+    const uint32_t head = _eventHead.load(std::memory_order_acquire);
+    uint32_t tail = _eventTail.load(std::memory_order_relaxed);
+    auto nextEvent = [&]() -> uint32_t {
+        if (tail == head) return Constants::NUM_FRAMES;
+        const int32_t offset = static_cast<int32_t>(_events[tail & (EVENT_QUEUE_SIZE - 1)].frame - blockStart);
+        return static_cast<uint32_t>(std::clamp<int32_t>(offset, 0, Constants::NUM_FRAMES));
+    };
+
+#if SYNTH_SOA_VOICES
+    // Lanes render the block in lockstep, so notes land on its first frame
+    while(nextEvent() < Constants::NUM_FRAMES) playEvent(_events[tail++ & (EVENT_QUEUE_SIZE - 1)]);
+    _voices.process(mixBus);
+#else
+    // Render up to each note, play it on its frame and carry on from there
+    uint32_t begin = 0;
+    while(true) {
+        const uint32_t end = std::max(nextEvent(), begin);
+        if(end > begin) renderVoices(begin, end);
+        if(end == Constants::NUM_FRAMES) break;
+        playEvent(_events[tail++ & (EVENT_QUEUE_SIZE - 1)]);
+        begin = end;
     }
+#endif
+    _eventTail.store(tail, std::memory_order_release);
+    _frame.store(blockStart + Constants::NUM_FRAMES, std::memory_order_relaxed);
 
+    // Voices done fading go back on the free list, a stolen one waiting for its note is not done
+    for(uint8_t i = 0; i < Constants::NUM_VOICES; ++i) {
+        const auto& v = _voices[i];
+        _voiceLevels[i] = v.isActive() ? v.getAdsrLevel() : 0.0f;
+        if(!v.isActive() && !v.hasPendingNote()) _alloc.free(i);
+    }
+
+#if SYNTH_FIXED_POINT
+    // Q27 * Q31 gain -> Q26, then down to Q15 and saturate
+    static constexpr int32_t masterGainQ31 = static_cast<int32_t>(Constants::VOICE_GAIN_SCALAR * 2147483648.0);
+
+    for(int i = 0; i < Constants::BUFFER_SIZE; i++) {
+        buffer[i] = static_cast<int16_t>(Dsp::ssat16(Dsp::smmulr(mixBus[i], masterGainQ31) >> 11));
+    }
+#else
     const float masterGain = Constants::VOICE_GAIN_SCALAR * 32767.0f;
 
     for(int i = 0; i < Constants::BUFFER_SIZE; i++) {
@@ -85,43 +220,283 @@ void VoiceManager::process(int16_t* buffer) {
         out = std::clamp(out, -32767.0f, 32767.0f);
         buffer[i] = static_cast<int16_t>(out);
     }
+#endif
+}
+
+#if !SYNTH_SOA_VOICES
+void VoiceManager::renderVoices(uint32_t begin, uint32_t end) noexcept {
+    for(auto& v : _voices) {
+        if(v.isActive()) v.process(mixBus, begin, end);
+    }
 }
+#endif
 
-void VoiceManager::setPitchBend(uint8_t lsb, uint8_t msb) {
-    int16_t bend = (static_cast<int16_t>(msb) << 7 | lsb) - 8192;
-    Osc::setPitchBend(bend);
-    for(auto& v : _voices) v.applyPitchBend();
+void VoiceManager::playEvent(const NoteEvent& e) noexcept {
+    switch(e.kind) {
+        case NoteEvent::Kind::NOTE:
+            if(e.velocity > 0) noteOn(e.note, e.velocity, e.channel);
+            else noteOff(e.note, e.channel);
+            break;
+        case NoteEvent::Kind::PEDAL:
+            setPedal(e.pedal, e.velocity > 0);
+            break;
+        case NoteEvent::Kind::ALL_NOTES_OFF:
+            allNotesOff();
+            break;
+    }
+}
+
+void VoiceManager::schedule(const NoteEvent& e) noexcept {
+    // Playing this one now could put a note off ahead of its own note on, so the queue goes first
+    if(_eventHead.load(std::memory_order_relaxed) - _eventTail.load(std::memory_order_acquire) >= EVENT_QUEUE_SIZE) {
+        flushEvents();
+    }
+    const uint32_t head = _eventHead.load(std::memory_order_relaxed);
+    _events[head & (EVENT_QUEUE_SIZE - 1)] = e;
+    _eventHead.store(head + 1, std::memory_order_release);
+}
+
+void VoiceManager::flushEvents() noexcept {
+    const uint32_t head = _eventHead.load(std::memory_order_acquire);
+    uint32_t tail = _eventTail.load(std::memory_order_relaxed);
+    while(tail != head) playEvent(_events[tail++ & (EVENT_QUEUE_SIZE - 1)]);
+    _eventTail.store(tail, std::memory_order_release);
+}
+
+void VoiceManager::publish() noexcept {
+    const uint32_t published = _published.load(std::memory_order_relaxed);
+    const uint32_t slot = (published & 1) ^ 1;
+    _snapshot[slot] = _edit;
+    _published.store((((published >> 1) + 1) << 1) | slot, std::memory_order_release);
+}
+
+void VoiceManager::modulate() noexcept {
+    auto set = [this](ModMatrix::Source s, float value) { _sources[static_cast<uint32_t>(s)] = value; };
+    set(ModMatrix::Source::LFO1, _lfos[0].tick());
+    set(ModMatrix::Source::LFO2, _lfos[1].tick());
+    set(ModMatrix::Source::MOD_WHEEL, _perf.modWheel);
+    set(ModMatrix::Source::PITCH_BEND, static_cast<float>(_perf.pitchBend) * (1.0f / 8192.0f));
+
+    // Voices whose filter setting works out the same share one cache entry, idle ones take the
+    // knob setting. At most NUM_VOICES distinct settings are asked for, all fit in the cache.
+    _filters.beginBlock();
+
+    for(int i = 0; i < Constants::NUM_VOICES; ++i) {
+        auto& v = _voices[i];
+
+        // Only the last frame is used, but the envelope has to advance a whole block
+        float modEnv = 0.0f;
+        if(_modEnv[i].isActive()) {
+            float envBlock[Constants::NUM_FRAMES];
+            _modEnv[i].renderBlock(envBlock, Constants::NUM_FRAMES);
+            modEnv = envBlock[Constants::NUM_FRAMES - 1];
+        }
+
+        // A stolen voice waiting for its kill ramp starts the new note in this block, so it is
+        // set up for that note even once the old one has gone quiet
+        if(!v.isActive() && !v.hasPendingNote()) {
+            v.setFilter(_filters.get(_current.cutoff, _current.resonance));
+            continue;
+        }
+
+        modulateVoice(i, _voiceLfos[i][0].tick(), _voiceLfos[i][1].tick(), modEnv, false);
+    }
+}
+
+void VoiceManager::startVoice(uint8_t voice) noexcept {
+    // The rest of this block renders with what the new note's own sources give, not with what
+    // the voice's last note left behind. LFOs and the envelope are read where they are.
+    const auto& lfos = _voiceLfos[voice];
+    modulateVoice(voice, lfos[0].value(), lfos[1].value(), _modEnv[voice].getLevel(), true);
+}
+
+void VoiceManager::modulateVoice(int i, float lfo1, float lfo2, float modEnv, bool starting) noexcept {
+    auto& v = _voices[i];
+    auto set = [this](ModMatrix::Source s, float value) { _sources[static_cast<uint32_t>(s)] = value; };
+    set(ModMatrix::Source::VOICE_LFO1, lfo1);
+    set(ModMatrix::Source::VOICE_LFO2, lfo2);
+    set(ModMatrix::Source::MOD_ENV, modEnv);
+    set(ModMatrix::Source::VELOCITY, _velocity[i]);
+    set(ModMatrix::Source::NOTE, (static_cast<float>(_alloc.note(i)) - 60.0f) * (1.0f / 64.0f));
+
+    // MPE member channels bring their own pressure, timbre and bend
+    const uint8_t channel = _alloc.channel(i);
+    const bool member = isMember(channel);
+    const Performance::Channel& expr = _perf.channels[channel];
+    set(ModMatrix::Source::AFTERTOUCH, member ? expr.pressure : _perf.aftertouch);
+    set(ModMatrix::Source::TIMBRE, member ? expr.timbre : _perf.timbre);
+    const ModMatrix::Result mod = ModMatrix::evaluate(_current.routes, _sources);
+
+    const float octaves = ModMatrix::value(mod, ModMatrix::Dest::CUTOFF);
+    float semitones = ModMatrix::value(mod, ModMatrix::Dest::PITCH);
+    if(member) semitones += static_cast<float>(expr.bend) * (1.0f / 8192.0f) * _current.mpeBendRange;
+    const float cutoff = (octaves != 0.0f) ? _current.cutoff * Dsp::exp2(octaves) : _current.cutoff;
+    const float resonance = std::clamp(_current.resonance + ModMatrix::value(mod, ModMatrix::Dest::RESONANCE), 0.0f, 1.0f);
+
+    // Mid-block the other voices already hold their entries, a full cache keeps this block's tuning
+    if(!starting) v.setFilter(_filters.get(cutoff, resonance));
+    else if(const SVF::Tuning* tuning = _filters.tryGet(cutoff, resonance)) v.setFilter(*tuning);
+    v.setMorph(_current.morph + ModMatrix::value(mod, ModMatrix::Dest::MORPH));
+    v.setPitchMod((semitones != 0.0f) ? Dsp::exp2(semitones * (1.0f / 12.0f)) : 1.0f);
+    // A stolen voice keeps the old note's level through its kill ramp, the new one sets its own on start
+    if(!v.hasPendingNote()) v.setAmplitude(ModMatrix::value(mod, ModMatrix::Dest::AMP));
+}
+
+void VoiceManager::configureLfos(const Params& next, bool force) noexcept {
+    const bool tempo = force || next.bpm != _current.bpm;
+    for(uint32_t i = 0; i < Lfo::COUNT; ++i) {
+        if(!tempo && next.lfos[i] == _current.lfos[i]) continue;
+        if(i < Lfo::GLOBAL_COUNT) {
+            _lfos[i].configure(next.lfos[i], next.bpm);
+        } else {
+            for(auto& lfos : _voiceLfos) lfos[i - Lfo::GLOBAL_COUNT].configure(next.lfos[i], next.bpm);
+        }
+    }
+}
+
+void VoiceManager::applyParams() noexcept {
+    const uint32_t published = _published.load(std::memory_order_acquire);
+    if (published == _applied) return;
+    _applied = published;
+
+    // Only what changed is pushed into the voices, filter and morph go through modulate()
+    const Params next = _snapshot[published & 1];
+    if (next.attack != _current.attack) for(auto& v : _voices) v.setAttack(next.attack);
+    if (next.decay != _current.decay) for(auto& v : _voices) v.setDecay(next.decay);
+    if (next.sustain != _current.sustain) for(auto& v : _voices) v.setSustain(next.sustain);
+    if (next.release != _current.release) for(auto& v : _voices) v.setRelease(next.release);
+    if (next.stealPolicy != _current.stealPolicy) _alloc.setPolicy(next.stealPolicy);
+    if (next.modAttack != _current.modAttack) for(auto& e : _modEnv) e.setAttack(next.modAttack);
+    if (next.modDecay != _current.modDecay) for(auto& e : _modEnv) e.setDecay(next.modDecay);
+    if (next.modSustain != _current.modSustain) for(auto& e : _modEnv) e.setSustain(next.modSustain);
+    if (next.modRelease != _current.modRelease) for(auto& e : _modEnv) e.setRelease(next.modRelease);
+    configureLfos(next, false);
+#if !SYNTH_SOA_VOICES
+    if (next.unison != _current.unison || next.unisonDetune != _current.unisonDetune || next.unisonSpread != _current.unisonSpread) {
+        for(auto& v : _voices) v.setUnison(next.unison, next.unisonDetune, next.unisonSpread);
+    }
+#endif
+    _current = next;
+}
+
+void VoiceManager::setPitchBend(uint8_t lsb, uint8_t msb, uint8_t channel) {
+    const int16_t bend = static_cast<int16_t>((static_cast<int16_t>(msb) << 7 | lsb) - 8192);
+    // Every channel keeps its own, so notes of a zone set up after the message still see it
+    _perf.channels[channel & 0x0F].bend = bend;
+    if(!isMember(channel)) _perf.pitchBend = bend;
 }
 
 void VoiceManager::setModWheel(uint8_t value) {
-    float mod = static_cast<float>(value) / 127.0f;
-    for(auto& v : _voices) v.setModWheel(mod);
+    _perf.modWheel = static_cast<float>(value) / 127.0f;
+}
+
+void VoiceManager::setAftertouch(uint8_t value, uint8_t channel) {
+    const float pressure = static_cast<float>(value) / 127.0f;
+    _perf.channels[channel & 0x0F].pressure = pressure;
+    if(!isMember(channel)) _perf.aftertouch = pressure;
+}
+
+void VoiceManager::setTimbre(uint8_t value, uint8_t channel) {
+    const float timbre = (static_cast<float>(value) - 64.0f) * (1.0f / 64.0f);
+    _perf.channels[channel & 0x0F].timbre = timbre;
+    if(!isMember(channel)) _perf.timbre = timbre;
+}
+
+void VoiceManager::setUnisonVoices(uint8_t value) {
+    setUnison(static_cast<uint8_t>(1 + (value * MAX_UNISON) / 128), _edit.unisonDetune, _edit.unisonSpread);
+}
+
+void VoiceManager::setUnisonDetune(uint8_t value) {
+    setUnison(_edit.unison, static_cast<float>(value) / 127.0f, _edit.unisonSpread);
+}
+
+void VoiceManager::setUnisonSpread(uint8_t value) {
+    setUnison(_edit.unison, _edit.unisonDetune, static_cast<float>(value) / 127.0f);
 }
 
 void VoiceManager::setCutoff(float freq) {
-    for(auto& v : _voices) v.setCutoff(freq);
+    _edit.cutoff = freq;
+    publish();
 }
 
 void VoiceManager::setResonance(float res) {
-    for(auto& v : _voices) v.setResonance(res);
+    _edit.resonance = res;
+    publish();
 }
 
 void VoiceManager::setMorph(float morph) {
-    for(auto& v : _voices) v.setMorph(morph);
+    _edit.morph = morph;
+    publish();
 }
 
 void VoiceManager::setAttack(float seconds) {
-    for(auto& v : _voices) v.setAttack(seconds);
+    _edit.attack = seconds;
+    publish();
 }
 
 void VoiceManager::setDecay(float seconds) {
-    for(auto& v : _voices) v.setDecay(seconds);
+    _edit.decay = seconds;
+    publish();
 }
 
 void VoiceManager::setSustain(float level) {
-    for(auto& v : _voices) v.setSustain(level);
+    _edit.sustain = level;
+    publish();
 }
 
 void VoiceManager::setRelease(float seconds) {
-    for(auto& v : _voices) v.setRelease(seconds);
+    _edit.release = seconds;
+    publish();
+}
+
+void VoiceManager::setModEnvelope(float attack, float decay, float sustain, float release) {
+    _edit.modAttack = attack;
+    _edit.modDecay = decay;
+    _edit.modSustain = sustain;
+    _edit.modRelease = release;
+    publish();
+}
+
+void VoiceManager::setModRoute(uint8_t slot, const ModMatrix::Route& route) {
+    if(slot >= ModMatrix::SLOTS) return;
+    _edit.routes[slot] = route;
+    publish();
+}
+
+void VoiceManager::setLfo(uint8_t idx, const Lfo::Settings& settings) {
+    if(idx >= Lfo::COUNT) return;
+    _edit.lfos[idx] = settings;
+    publish();
+}
+
+void VoiceManager::setTempo(float bpm) {
+    _edit.bpm = std::clamp(bpm, 20.0f, 300.0f);
+    publish();
+}
+
+void VoiceManager::setMpe(uint8_t memberChannels) {
+    const bool wasMpe = _edit.mpeChannels != 0;
+    _edit.mpeChannels = std::min<uint8_t>(memberChannels, 15);
+    const bool mpe = _edit.mpeChannels != 0;
+
+    if(mpe != wasMpe) {
+        const ModMatrix::Routes from = wasMpe ? ModMatrix::mpeDefaults() : ModMatrix::defaults();
+        const ModMatrix::Routes to = mpe ? ModMatrix::mpeDefaults() : ModMatrix::defaults();
+        for(uint32_t s = 0; s < ModMatrix::SLOTS; ++s) {
+            if(_edit.routes[s] == from[s]) _edit.routes[s] = to[s];
+        }
+    }
+    publish();
+}
+
+void VoiceManager::setStealPolicy(VoiceAllocator::StealPolicy policy) {
+    _edit.stealPolicy = policy;
+    publish();
+}
+
+void VoiceManager::setUnison(uint8_t copies, float detune, float spread) {
+    _edit.unison = std::clamp<uint8_t>(copies, 1, MAX_UNISON);
+    _edit.unisonDetune = std::clamp(detune, 0.0f, 12.0f);
+    _edit.unisonSpread = std::clamp(spread, 0.0f, 1.0f);
+    publish();
 }
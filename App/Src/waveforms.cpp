@@ -1,4135 +1,2382 @@
 #include "waveforms.h"
 
 const char* const waveNames[] = {
-    "SINE  ", "SAW   ", "SQUARE", "RHODES", 
-    "CLAV  ", "CHOIR ", "ACID  ", "GLASS "
+    "SINE  ", "SAW   ", "SQUARE", "RHODES", "CLAV  ", "CHOIR ", "ACID  ", "GLASS "
 };
 
-alignas(4) const float waveform_Sine[4096] = {
-    0.00000000f, 0.00153398f, 0.00306796f, 0.00460193f, 0.00613588f, 0.00766983f, 0.00920375f, 0.01073766f,
-    0.01227154f, 0.01380539f, 0.01533921f, 0.01687299f, 0.01840673f, 0.01994043f, 0.02147408f, 0.02300768f,
-    0.02454123f, 0.02607472f, 0.02760815f, 0.02914151f, 0.03067480f, 0.03220803f, 0.03374117f, 0.03527424f,
-    0.03680722f, 0.03834012f, 0.03987293f, 0.04140564f, 0.04293826f, 0.04447077f, 0.04600318f, 0.04753548f,
-    0.04906767f, 0.05059975f, 0.05213170f, 0.05366354f, 0.05519524f, 0.05672682f, 0.05825826f, 0.05978957f,
-    0.06132074f, 0.06285176f, 0.06438263f, 0.06591335f, 0.06744392f, 0.06897433f, 0.07050457f, 0.07203465f,
-    0.07356456f, 0.07509430f, 0.07662386f, 0.07815324f, 0.07968244f, 0.08121145f, 0.08274026f, 0.08426889f,
-    0.08579731f, 0.08732554f, 0.08885355f, 0.09038136f, 0.09190896f, 0.09343634f, 0.09496350f, 0.09649043f,
-    0.09801714f, 0.09954362f, 0.10106986f, 0.10259587f, 0.10412163f, 0.10564715f, 0.10717242f, 0.10869744f,
-    0.11022221f, 0.11174671f, 0.11327095f, 0.11479493f, 0.11631863f, 0.11784206f, 0.11936521f, 0.12088809f,
-    0.12241068f, 0.12393298f, 0.12545498f, 0.12697670f, 0.12849811f, 0.13001922f, 0.13154003f, 0.13306053f,
-    0.13458071f, 0.13610058f, 0.13762012f, 0.13913934f, 0.14065824f, 0.14217680f, 0.14369503f, 0.14521292f,
-    0.14673047f, 0.14824768f, 0.14976453f, 0.15128104f, 0.15279719f, 0.15431297f, 0.15582840f, 0.15734346f,
-    0.15885814f, 0.16037246f, 0.16188639f, 0.16339995f, 0.16491312f, 0.16642590f, 0.16793829f, 0.16945029f,
-    0.17096189f, 0.17247308f, 0.17398387f, 0.17549425f, 0.17700422f, 0.17851377f, 0.18002290f, 0.18153161f,
-    0.18303989f, 0.18454774f, 0.18605515f, 0.18756213f, 0.18906866f, 0.19057475f, 0.19208040f, 0.19358559f,
-    0.19509032f, 0.19659460f, 0.19809841f, 0.19960176f, 0.20110463f, 0.20260704f, 0.20410897f, 0.20561041f,
-    0.20711138f, 0.20861185f, 0.21011184f, 0.21161133f, 0.21311032f, 0.21460881f, 0.21610680f, 0.21760427f,
-    0.21910124f, 0.22059769f, 0.22209362f, 0.22358903f, 0.22508391f, 0.22657826f, 0.22807208f, 0.22956537f,
-    0.23105811f, 0.23255031f, 0.23404196f, 0.23553306f, 0.23702361f, 0.23851359f, 0.24000302f, 0.24149189f,
-    0.24298018f, 0.24446790f, 0.24595505f, 0.24744162f, 0.24892761f, 0.25041301f, 0.25189782f, 0.25338204f,
-    0.25486566f, 0.25634868f, 0.25783110f, 0.25931292f, 0.26079412f, 0.26227471f, 0.26375468f, 0.26523403f,
-    0.26671276f, 0.26819086f, 0.26966833f, 0.27114516f, 0.27262136f, 0.27409691f, 0.27557182f, 0.27704608f,
-    0.27851969f, 0.27999264f, 0.28146494f, 0.28293657f, 0.28440754f, 0.28587783f, 0.28734746f, 0.28881641f,
-    0.29028468f, 0.29175226f, 0.29321916f, 0.29468537f, 0.29615089f, 0.29761571f, 0.29907983f, 0.30054324f,
-    0.30200595f, 0.30346795f, 0.30492923f, 0.30638980f, 0.30784964f, 0.30930876f, 0.31076715f, 0.31222481f,
-    0.31368174f, 0.31513793f, 0.31659338f, 0.31804808f, 0.31950203f, 0.32095523f, 0.32240768f, 0.32385937f,
-    0.32531029f, 0.32676045f, 0.32820984f, 0.32965846f, 0.33110631f, 0.33255337f, 0.33399965f, 0.33544515f,
-    0.33688985f, 0.33833377f, 0.33977688f, 0.34121920f, 0.34266072f, 0.34410143f, 0.34554132f, 0.34698041f,
-    0.34841868f, 0.34985613f, 0.35129276f, 0.35272856f, 0.35416353f, 0.35559766f, 0.35703096f, 0.35846342f,
-    0.35989504f, 0.36132581f, 0.36275572f, 0.36418479f, 0.36561300f, 0.36704035f, 0.36846683f, 0.36989245f,
-    0.37131719f, 0.37274107f, 0.37416406f, 0.37558618f, 0.37700741f, 0.37842775f, 0.37984721f, 0.38126577f,
-    0.38268343f, 0.38410020f, 0.38551605f, 0.38693101f, 0.38834505f, 0.38975817f, 0.39117038f, 0.39258167f,
-    0.39399204f, 0.39540148f, 0.39680999f, 0.39821756f, 0.39962420f, 0.40102990f, 0.40243465f, 0.40383846f,
-    0.40524131f, 0.40664322f, 0.40804416f, 0.40944415f, 0.41084317f, 0.41224123f, 0.41363831f, 0.41503442f,
-    0.41642956f, 0.41782372f, 0.41921689f, 0.42060907f, 0.42200027f, 0.42339047f, 0.42477968f, 0.42616789f,
-    0.42755509f, 0.42894129f, 0.43032648f, 0.43171066f, 0.43309382f, 0.43447596f, 0.43585708f, 0.43723717f,
-    0.43861624f, 0.43999427f, 0.44137127f, 0.44274723f, 0.44412214f, 0.44549602f, 0.44686884f, 0.44824061f,
-    0.44961133f, 0.45098099f, 0.45234959f, 0.45371712f, 0.45508359f, 0.45644898f, 0.45781330f, 0.45917655f,
-    0.46053871f, 0.46189979f, 0.46325978f, 0.46461869f, 0.46597650f, 0.46733321f, 0.46868882f, 0.47004333f,
-    0.47139674f, 0.47274903f, 0.47410021f, 0.47545028f, 0.47679923f, 0.47814706f, 0.47949376f, 0.48083933f,
-    0.48218377f, 0.48352708f, 0.48486925f, 0.48621028f, 0.48755016f, 0.48888890f, 0.49022648f, 0.49156292f,
-    0.49289819f, 0.49423231f, 0.49556526f, 0.49689705f, 0.49822767f, 0.49955711f, 0.50088538f, 0.50221247f,
-    0.50353838f, 0.50486311f, 0.50618665f, 0.50750899f, 0.50883014f, 0.51015010f, 0.51146885f, 0.51278640f,
-    0.51410274f, 0.51541788f, 0.51673180f, 0.51804450f, 0.51935599f, 0.52066625f, 0.52197529f, 0.52328310f,
-    0.52458968f, 0.52589503f, 0.52719913f, 0.52850200f, 0.52980362f, 0.53110400f, 0.53240313f, 0.53370100f,
-    0.53499762f, 0.53629298f, 0.53758708f, 0.53887991f, 0.54017147f, 0.54146177f, 0.54275078f, 0.54403853f,
-    0.54532499f, 0.54661017f, 0.54789406f, 0.54917666f, 0.55045797f, 0.55173799f, 0.55301671f, 0.55429412f,
-    0.55557023f, 0.55684504f, 0.55811853f, 0.55939071f, 0.56066158f, 0.56193112f, 0.56319934f, 0.56446624f,
-    0.56573181f, 0.56699605f, 0.56825895f, 0.56952052f, 0.57078075f, 0.57203963f, 0.57329717f, 0.57455336f,
-    0.57580819f, 0.57706167f, 0.57831380f, 0.57956456f, 0.58081396f, 0.58206199f, 0.58330865f, 0.58455394f,
-    0.58579786f, 0.58704039f, 0.58828155f, 0.58952132f, 0.59075970f, 0.59199669f, 0.59323230f, 0.59446650f,
-    0.59569930f, 0.59693071f, 0.59816071f, 0.59938930f, 0.60061648f, 0.60184225f, 0.60306660f, 0.60428953f,
-    0.60551104f, 0.60673113f, 0.60794978f, 0.60916701f, 0.61038281f, 0.61159716f, 0.61281008f, 0.61402156f,
-    0.61523159f, 0.61644017f, 0.61764731f, 0.61885299f, 0.62005721f, 0.62125998f, 0.62246128f, 0.62366112f,
-    0.62485949f, 0.62605639f, 0.62725182f, 0.62844577f, 0.62963824f, 0.63082923f, 0.63201874f, 0.63320676f,
-    0.63439328f, 0.63557832f, 0.63676186f, 0.63794390f, 0.63912444f, 0.64030348f, 0.64148101f, 0.64265703f,
-    0.64383154f, 0.64500454f, 0.64617601f, 0.64734597f, 0.64851440f, 0.64968131f, 0.65084668f, 0.65201053f,
-    0.65317284f, 0.65433362f, 0.65549285f, 0.65665055f, 0.65780669f, 0.65896129f, 0.66011434f, 0.66126584f,
-    0.66241578f, 0.66356416f, 0.66471098f, 0.66585623f, 0.66699992f, 0.66814204f, 0.66928259f, 0.67042156f,
-    0.67155895f, 0.67269477f, 0.67382900f, 0.67496165f, 0.67609270f, 0.67722217f, 0.67835004f, 0.67947632f,
-    0.68060100f, 0.68172407f, 0.68284555f, 0.68396541f, 0.68508367f, 0.68620031f, 0.68731534f, 0.68842875f,
-    0.68954054f, 0.69065071f, 0.69175926f, 0.69286617f, 0.69397146f, 0.69507511f, 0.69617713f, 0.69727751f,
-    0.69837625f, 0.69947334f, 0.70056879f, 0.70166259f, 0.70275474f, 0.70384524f, 0.70493408f, 0.70602126f,
-    0.70710678f, 0.70819064f, 0.70927283f, 0.71035335f, 0.71143220f, 0.71250937f, 0.71358487f, 0.71465869f,
-    0.71573083f, 0.71680128f, 0.71787005f, 0.71893712f, 0.72000251f, 0.72106620f, 0.72212819f, 0.72318849f,
-    0.72424708f, 0.72530397f, 0.72635916f, 0.72741263f, 0.72846439f, 0.72951444f, 0.73056277f, 0.73160938f,
-    0.73265427f, 0.73369744f, 0.73473888f, 0.73577859f, 0.73681657f, 0.73785281f, 0.73888732f, 0.73992010f,
-    0.74095113f, 0.74198041f, 0.74300795f, 0.74403374f, 0.74505779f, 0.74608007f, 0.74710061f, 0.74811938f,
-    0.74913639f, 0.75015165f, 0.75116513f, 0.75217685f, 0.75318680f, 0.75419498f, 0.75520138f, 0.75620600f,
-    0.75720885f, 0.75820991f, 0.75920919f, 0.76020668f, 0.76120239f, 0.76219630f, 0.76318842f, 0.76417874f,
-    0.76516727f, 0.76615399f, 0.76713891f, 0.76812203f, 0.76910334f, 0.77008284f, 0.77106052f, 0.77203640f,
-    0.77301045f, 0.77398269f, 0.77495311f, 0.77592170f, 0.77688847f, 0.77785340f, 0.77881651f, 0.77977779f,
-    0.78073723f, 0.78169483f, 0.78265060f, 0.78360452f, 0.78455660f, 0.78550683f, 0.78645521f, 0.78740175f,
-    0.78834643f, 0.78928925f, 0.79023022f, 0.79116933f, 0.79210658f, 0.79304196f, 0.79397548f, 0.79490713f,
-    0.79583690f, 0.79676481f, 0.79769084f, 0.79861499f, 0.79953727f, 0.80045766f, 0.80137617f, 0.80229280f,
-    0.80320753f, 0.80412038f, 0.80503133f, 0.80594039f, 0.80684755f, 0.80775282f, 0.80865618f, 0.80955764f,
-    0.81045720f, 0.81135485f, 0.81225059f, 0.81314441f, 0.81403633f, 0.81492633f, 0.81581441f, 0.81670057f,
-    0.81758481f, 0.81846713f, 0.81934752f, 0.82022598f, 0.82110251f, 0.82197712f, 0.82284978f, 0.82372051f,
-    0.82458930f, 0.82545615f, 0.82632106f, 0.82718403f, 0.82804505f, 0.82890411f, 0.82976123f, 0.83061640f,
-    0.83146961f, 0.83232087f, 0.83317016f, 0.83401750f, 0.83486287f, 0.83570628f, 0.83654773f, 0.83738720f,
-    0.83822471f, 0.83906024f, 0.83989379f, 0.84072537f, 0.84155498f, 0.84238260f, 0.84320824f, 0.84403190f,
-    0.84485357f, 0.84567325f, 0.84649094f, 0.84730664f, 0.84812034f, 0.84893206f, 0.84974177f, 0.85054948f,
-    0.85135519f, 0.85215890f, 0.85296060f, 0.85376030f, 0.85455799f, 0.85535366f, 0.85614733f, 0.85693898f,
-    0.85772861f, 0.85851622f, 0.85930182f, 0.86008539f, 0.86086694f, 0.86164646f, 0.86242396f, 0.86319942f,
-    0.86397286f, 0.86474426f, 0.86551362f, 0.86628095f, 0.86704625f, 0.86780950f, 0.86857071f, 0.86932987f,
-    0.87008699f, 0.87084206f, 0.87159509f, 0.87234606f, 0.87309498f, 0.87384184f, 0.87458665f, 0.87532940f,
-    0.87607009f, 0.87680872f, 0.87754529f, 0.87827979f, 0.87901223f, 0.87974259f, 0.88047089f, 0.88119711f,
-    0.88192126f, 0.88264334f, 0.88336334f, 0.88408126f, 0.88479710f, 0.88551086f, 0.88622253f, 0.88693212f,
-    0.88763962f, 0.88834503f, 0.88904836f, 0.88974959f, 0.89044872f, 0.89114576f, 0.89184071f, 0.89253356f,
-    0.89322430f, 0.89391295f, 0.89459949f, 0.89528392f, 0.89596625f, 0.89664647f, 0.89732458f, 0.89800058f,
-    0.89867447f, 0.89934624f, 0.90001589f, 0.90068343f, 0.90134885f, 0.90201214f, 0.90267332f, 0.90333237f,
-    0.90398929f, 0.90464409f, 0.90529676f, 0.90594730f, 0.90659570f, 0.90724198f, 0.90788612f, 0.90852812f,
-    0.90916798f, 0.90980571f, 0.91044129f, 0.91107473f, 0.91170603f, 0.91233518f, 0.91296219f, 0.91358705f,
-    0.91420976f, 0.91483031f, 0.91544872f, 0.91606497f, 0.91667906f, 0.91729100f, 0.91790078f, 0.91850839f,
-    0.91911385f, 0.91971715f, 0.92031828f, 0.92091724f, 0.92151404f, 0.92210867f, 0.92270113f, 0.92329142f,
-    0.92387953f, 0.92446547f, 0.92504924f, 0.92563083f, 0.92621024f, 0.92678747f, 0.92736253f, 0.92793539f,
-    0.92850608f, 0.92907458f, 0.92964090f, 0.93020502f, 0.93076696f, 0.93132671f, 0.93188427f, 0.93243963f,
-    0.93299280f, 0.93354377f, 0.93409255f, 0.93463913f, 0.93518351f, 0.93572569f, 0.93626567f, 0.93680344f,
-    0.93733901f, 0.93787238f, 0.93840353f, 0.93893248f, 0.93945922f, 0.93998375f, 0.94050607f, 0.94102618f,
-    0.94154407f, 0.94205974f, 0.94257320f, 0.94308444f, 0.94359346f, 0.94410026f, 0.94460484f, 0.94510719f,
-    0.94560733f, 0.94610523f, 0.94660091f, 0.94709437f, 0.94758559f, 0.94807459f, 0.94856135f, 0.94904588f,
-    0.94952818f, 0.95000825f, 0.95048607f, 0.95096167f, 0.95143502f, 0.95190614f, 0.95237501f, 0.95284165f,
-    0.95330604f, 0.95376819f, 0.95422810f, 0.95468575f, 0.95514117f, 0.95559433f, 0.95604525f, 0.95649392f,
-    0.95694034f, 0.95738450f, 0.95782641f, 0.95826607f, 0.95870347f, 0.95913862f, 0.95957151f, 0.96000215f,
-    0.96043052f, 0.96085663f, 0.96128049f, 0.96170208f, 0.96212140f, 0.96253847f, 0.96295327f, 0.96336580f,
-    0.96377607f, 0.96418406f, 0.96458979f, 0.96499325f, 0.96539444f, 0.96579336f, 0.96619000f, 0.96658437f,
-    0.96697647f, 0.96736629f, 0.96775384f, 0.96813910f, 0.96852209f, 0.96890280f, 0.96928124f, 0.96965739f,
-    0.97003125f, 0.97040284f, 0.97077214f, 0.97113916f, 0.97150389f, 0.97186634f, 0.97222650f, 0.97258437f,
-    0.97293995f, 0.97329325f, 0.97364425f, 0.97399296f, 0.97433938f, 0.97468351f, 0.97502535f, 0.97536489f,
-    0.97570213f, 0.97603708f, 0.97636973f, 0.97670009f, 0.97702814f, 0.97735390f, 0.97767736f, 0.97799851f,
-    0.97831737f, 0.97863392f, 0.97894818f, 0.97926012f, 0.97956977f, 0.97987710f, 0.98018214f, 0.98048486f,
-    0.98078528f, 0.98108339f, 0.98137919f, 0.98167269f, 0.98196387f, 0.98225274f, 0.98253930f, 0.98282355f,
-    0.98310549f, 0.98338511f, 0.98366242f, 0.98393741f, 0.98421009f, 0.98448046f, 0.98474850f, 0.98501423f,
-    0.98527764f, 0.98553874f, 0.98579751f, 0.98605396f, 0.98630810f, 0.98655991f, 0.98680940f, 0.98705657f,
-    0.98730142f, 0.98754394f, 0.98778414f, 0.98802202f, 0.98825757f, 0.98849079f, 0.98872169f, 0.98895026f,
-    0.98917651f, 0.98940043f, 0.98962202f, 0.98984128f, 0.99005821f, 0.99027281f, 0.99048508f, 0.99069503f,
-    0.99090264f, 0.99110791f, 0.99131086f, 0.99151147f, 0.99170975f, 0.99190570f, 0.99209931f, 0.99229059f,
-    0.99247953f, 0.99266614f, 0.99285041f, 0.99303235f, 0.99321195f, 0.99338921f, 0.99356414f, 0.99373672f,
-    0.99390697f, 0.99407488f, 0.99424045f, 0.99440368f, 0.99456457f, 0.99472312f, 0.99487933f, 0.99503320f,
-    0.99518473f, 0.99533391f, 0.99548076f, 0.99562526f, 0.99576741f, 0.99590723f, 0.99604470f, 0.99617983f,
-    0.99631261f, 0.99644305f, 0.99657115f, 0.99669690f, 0.99682030f, 0.99694136f, 0.99706007f, 0.99717644f,
-    0.99729046f, 0.99740213f, 0.99751146f, 0.99761844f, 0.99772307f, 0.99782535f, 0.99792529f, 0.99802287f,
-    0.99811811f, 0.99821100f, 0.99830154f, 0.99838974f, 0.99847558f, 0.99855907f, 0.99864022f, 0.99871901f,
-    0.99879546f, 0.99886955f, 0.99894129f, 0.99901069f, 0.99907773f, 0.99914242f, 0.99920476f, 0.99926475f,
-    0.99932238f, 0.99937767f, 0.99943060f, 0.99948119f, 0.99952942f, 0.99957530f, 0.99961882f, 0.99966000f,
-    0.99969882f, 0.99973529f, 0.99976941f, 0.99980117f, 0.99983058f, 0.99985764f, 0.99988235f, 0.99990470f,
-    0.99992470f, 0.99994235f, 0.99995764f, 0.99997059f, 0.99998118f, 0.99998941f, 0.99999529f, 0.99999882f,
-    1.00000000f, 0.99999882f, 0.99999529f, 0.99998941f, 0.99998118f, 0.99997059f, 0.99995764f, 0.99994235f,
-    0.99992470f, 0.99990470f, 0.99988235f, 0.99985764f, 0.99983058f, 0.99980117f, 0.99976941f, 0.99973529f,
-    0.99969882f, 0.99966000f, 0.99961882f, 0.99957530f, 0.99952942f, 0.99948119f, 0.99943060f, 0.99937767f,
-    0.99932238f, 0.99926475f, 0.99920476f, 0.99914242f, 0.99907773f, 0.99901069f, 0.99894129f, 0.99886955f,
-    0.99879546f, 0.99871901f, 0.99864022f, 0.99855907f, 0.99847558f, 0.99838974f, 0.99830154f, 0.99821100f,
-    0.99811811f, 0.99802287f, 0.99792529f, 0.99782535f, 0.99772307f, 0.99761844f, 0.99751146f, 0.99740213f,
-    0.99729046f, 0.99717644f, 0.99706007f, 0.99694136f, 0.99682030f, 0.99669690f, 0.99657115f, 0.99644305f,
-    0.99631261f, 0.99617983f, 0.99604470f, 0.99590723f, 0.99576741f, 0.99562526f, 0.99548076f, 0.99533391f,
-    0.99518473f, 0.99503320f, 0.99487933f, 0.99472312f, 0.99456457f, 0.99440368f, 0.99424045f, 0.99407488f,
-    0.99390697f, 0.99373672f, 0.99356414f, 0.99338921f, 0.99321195f, 0.99303235f, 0.99285041f, 0.99266614f,
-    0.99247953f, 0.99229059f, 0.99209931f, 0.99190570f, 0.99170975f, 0.99151147f, 0.99131086f, 0.99110791f,
-    0.99090264f, 0.99069503f, 0.99048508f, 0.99027281f, 0.99005821f, 0.98984128f, 0.98962202f, 0.98940043f,
-    0.98917651f, 0.98895026f, 0.98872169f, 0.98849079f, 0.98825757f, 0.98802202f, 0.98778414f, 0.98754394f,
-    0.98730142f, 0.98705657f, 0.98680940f, 0.98655991f, 0.98630810f, 0.98605396f, 0.98579751f, 0.98553874f,
-    0.98527764f, 0.98501423f, 0.98474850f, 0.98448046f, 0.98421009f, 0.98393741f, 0.98366242f, 0.98338511f,
-    0.98310549f, 0.98282355f, 0.98253930f, 0.98225274f, 0.98196387f, 0.98167269f, 0.98137919f, 0.98108339f,
-    0.98078528f, 0.98048486f, 0.98018214f, 0.97987710f, 0.97956977f, 0.97926012f, 0.97894818f, 0.97863392f,
-    0.97831737f, 0.97799851f, 0.97767736f, 0.97735390f, 0.97702814f, 0.97670009f, 0.97636973f, 0.97603708f,
-    0.97570213f, 0.97536489f, 0.97502535f, 0.97468351f, 0.97433938f, 0.97399296f, 0.97364425f, 0.97329325f,
-    0.97293995f, 0.97258437f, 0.97222650f, 0.97186634f, 0.97150389f, 0.97113916f, 0.97077214f, 0.97040284f,
-    0.97003125f, 0.96965739f, 0.96928124f, 0.96890280f, 0.96852209f, 0.96813910f, 0.96775384f, 0.96736629f,
-    0.96697647f, 0.96658437f, 0.96619000f, 0.96579336f, 0.96539444f, 0.96499325f, 0.96458979f, 0.96418406f,
-    0.96377607f, 0.96336580f, 0.96295327f, 0.96253847f, 0.96212140f, 0.96170208f, 0.96128049f, 0.96085663f,
-    0.96043052f, 0.96000215f, 0.95957151f, 0.95913862f, 0.95870347f, 0.95826607f, 0.95782641f, 0.95738450f,
-    0.95694034f, 0.95649392f, 0.95604525f, 0.95559433f, 0.95514117f, 0.95468575f, 0.95422810f, 0.95376819f,
-    0.95330604f, 0.95284165f, 0.95237501f, 0.95190614f, 0.95143502f, 0.95096167f, 0.95048607f, 0.95000825f,
-    0.94952818f, 0.94904588f, 0.94856135f, 0.94807459f, 0.94758559f, 0.94709437f, 0.94660091f, 0.94610523f,
-    0.94560733f, 0.94510719f, 0.94460484f, 0.94410026f, 0.94359346f, 0.94308444f, 0.94257320f, 0.94205974f,
-    0.94154407f, 0.94102618f, 0.94050607f, 0.93998375f, 0.93945922f, 0.93893248f, 0.93840353f, 0.93787238f,
-    0.93733901f, 0.93680344f, 0.93626567f, 0.93572569f, 0.93518351f, 0.93463913f, 0.93409255f, 0.93354377f,
-    0.93299280f, 0.93243963f, 0.93188427f, 0.93132671f, 0.93076696f, 0.93020502f, 0.92964090f, 0.92907458f,
-    0.92850608f, 0.92793539f, 0.92736253f, 0.92678747f, 0.92621024f, 0.92563083f, 0.92504924f, 0.92446547f,
-    0.92387953f, 0.92329142f, 0.92270113f, 0.92210867f, 0.92151404f, 0.92091724f, 0.92031828f, 0.91971715f,
-    0.91911385f, 0.91850839f, 0.91790078f, 0.91729100f, 0.91667906f, 0.91606497f, 0.91544872f, 0.91483031f,
-    0.91420976f, 0.91358705f, 0.91296219f, 0.91233518f, 0.91170603f, 0.91107473f, 0.91044129f, 0.90980571f,
-    0.90916798f, 0.90852812f, 0.90788612f, 0.90724198f, 0.90659570f, 0.90594730f, 0.90529676f, 0.90464409f,
-    0.90398929f, 0.90333237f, 0.90267332f, 0.90201214f, 0.90134885f, 0.90068343f, 0.90001589f, 0.89934624f,
-    0.89867447f, 0.89800058f, 0.89732458f, 0.89664647f, 0.89596625f, 0.89528392f, 0.89459949f, 0.89391295f,
-    0.89322430f, 0.89253356f, 0.89184071f, 0.89114576f, 0.89044872f, 0.88974959f, 0.88904836f, 0.88834503f,
-    0.88763962f, 0.88693212f, 0.88622253f, 0.88551086f, 0.88479710f, 0.88408126f, 0.88336334f, 0.88264334f,
-    0.88192126f, 0.88119711f, 0.88047089f, 0.87974259f, 0.87901223f, 0.87827979f, 0.87754529f, 0.87680872f,
-    0.87607009f, 0.87532940f, 0.87458665f, 0.87384184f, 0.87309498f, 0.87234606f, 0.87159509f, 0.87084206f,
-    0.87008699f, 0.86932987f, 0.86857071f, 0.86780950f, 0.86704625f, 0.86628095f, 0.86551362f, 0.86474426f,
-    0.86397286f, 0.86319942f, 0.86242396f, 0.86164646f, 0.86086694f, 0.86008539f, 0.85930182f, 0.85851622f,
-    0.85772861f, 0.85693898f, 0.85614733f, 0.85535366f, 0.85455799f, 0.85376030f, 0.85296060f, 0.85215890f,
-    0.85135519f, 0.85054948f, 0.84974177f, 0.84893206f, 0.84812034f, 0.84730664f, 0.84649094f, 0.84567325f,
-    0.84485357f, 0.84403190f, 0.84320824f, 0.84238260f, 0.84155498f, 0.84072537f, 0.83989379f, 0.83906024f,
-    0.83822471f, 0.83738720f, 0.83654773f, 0.83570628f, 0.83486287f, 0.83401750f, 0.83317016f, 0.83232087f,
-    0.83146961f, 0.83061640f, 0.82976123f, 0.82890411f, 0.82804505f, 0.82718403f, 0.82632106f, 0.82545615f,
-    0.82458930f, 0.82372051f, 0.82284978f, 0.82197712f, 0.82110251f, 0.82022598f, 0.81934752f, 0.81846713f,
-    0.81758481f, 0.81670057f, 0.81581441f, 0.81492633f, 0.81403633f, 0.81314441f, 0.81225059f, 0.81135485f,
-    0.81045720f, 0.80955764f, 0.80865618f, 0.80775282f, 0.80684755f, 0.80594039f, 0.80503133f, 0.80412038f,
-    0.80320753f, 0.80229280f, 0.80137617f, 0.80045766f, 0.79953727f, 0.79861499f, 0.79769084f, 0.79676481f,
-    0.79583690f, 0.79490713f, 0.79397548f, 0.79304196f, 0.79210658f, 0.79116933f, 0.79023022f, 0.78928925f,
-    0.78834643f, 0.78740175f, 0.78645521f, 0.78550683f, 0.78455660f, 0.78360452f, 0.78265060f, 0.78169483f,
-    0.78073723f, 0.77977779f, 0.77881651f, 0.77785340f, 0.77688847f, 0.77592170f, 0.77495311f, 0.77398269f,
-    0.77301045f, 0.77203640f, 0.77106052f, 0.77008284f, 0.76910334f, 0.76812203f, 0.76713891f, 0.76615399f,
-    0.76516727f, 0.76417874f, 0.76318842f, 0.76219630f, 0.76120239f, 0.76020668f, 0.75920919f, 0.75820991f,
-    0.75720885f, 0.75620600f, 0.75520138f, 0.75419498f, 0.75318680f, 0.75217685f, 0.75116513f, 0.75015165f,
-    0.74913639f, 0.74811938f, 0.74710061f, 0.74608007f, 0.74505779f, 0.74403374f, 0.74300795f, 0.74198041f,
-    0.74095113f, 0.73992010f, 0.73888732f, 0.73785281f, 0.73681657f, 0.73577859f, 0.73473888f, 0.73369744f,
-    0.73265427f, 0.73160938f, 0.73056277f, 0.72951444f, 0.72846439f, 0.72741263f, 0.72635916f, 0.72530397f,
-    0.72424708f, 0.72318849f, 0.72212819f, 0.72106620f, 0.72000251f, 0.71893712f, 0.71787005f, 0.71680128f,
-    0.71573083f, 0.71465869f, 0.71358487f, 0.71250937f, 0.71143220f, 0.71035335f, 0.70927283f, 0.70819064f,
-    0.70710678f, 0.70602126f, 0.70493408f, 0.70384524f, 0.70275474f, 0.70166259f, 0.70056879f, 0.69947334f,
-    0.69837625f, 0.69727751f, 0.69617713f, 0.69507511f, 0.69397146f, 0.69286617f, 0.69175926f, 0.69065071f,
-    0.68954054f, 0.68842875f, 0.68731534f, 0.68620031f, 0.68508367f, 0.68396541f, 0.68284555f, 0.68172407f,
-    0.68060100f, 0.67947632f, 0.67835004f, 0.67722217f, 0.67609270f, 0.67496165f, 0.67382900f, 0.67269477f,
-    0.67155895f, 0.67042156f, 0.66928259f, 0.66814204f, 0.66699992f, 0.66585623f, 0.66471098f, 0.66356416f,
-    0.66241578f, 0.66126584f, 0.66011434f, 0.65896129f, 0.65780669f, 0.65665055f, 0.65549285f, 0.65433362f,
-    0.65317284f, 0.65201053f, 0.65084668f, 0.64968131f, 0.64851440f, 0.64734597f, 0.64617601f, 0.64500454f,
-    0.64383154f, 0.64265703f, 0.64148101f, 0.64030348f, 0.63912444f, 0.63794390f, 0.63676186f, 0.63557832f,
-    0.63439328f, 0.63320676f, 0.63201874f, 0.63082923f, 0.62963824f, 0.62844577f, 0.62725182f, 0.62605639f,
-    0.62485949f, 0.62366112f, 0.62246128f, 0.62125998f, 0.62005721f, 0.61885299f, 0.61764731f, 0.61644017f,
-    0.61523159f, 0.61402156f, 0.61281008f, 0.61159716f, 0.61038281f, 0.60916701f, 0.60794978f, 0.60673113f,
-    0.60551104f, 0.60428953f, 0.60306660f, 0.60184225f, 0.60061648f, 0.59938930f, 0.59816071f, 0.59693071f,
-    0.59569930f, 0.59446650f, 0.59323230f, 0.59199669f, 0.59075970f, 0.58952132f, 0.58828155f, 0.58704039f,
-    0.58579786f, 0.58455394f, 0.58330865f, 0.58206199f, 0.58081396f, 0.57956456f, 0.57831380f, 0.57706167f,
-    0.57580819f, 0.57455336f, 0.57329717f, 0.57203963f, 0.57078075f, 0.56952052f, 0.56825895f, 0.56699605f,
-    0.56573181f, 0.56446624f, 0.56319934f, 0.56193112f, 0.56066158f, 0.55939071f, 0.55811853f, 0.55684504f,
-    0.55557023f, 0.55429412f, 0.55301671f, 0.55173799f, 0.55045797f, 0.54917666f, 0.54789406f, 0.54661017f,
-    0.54532499f, 0.54403853f, 0.54275078f, 0.54146177f, 0.54017147f, 0.53887991f, 0.53758708f, 0.53629298f,
-    0.53499762f, 0.53370100f, 0.53240313f, 0.53110400f, 0.52980362f, 0.52850200f, 0.52719913f, 0.52589503f,
-    0.52458968f, 0.52328310f, 0.52197529f, 0.52066625f, 0.51935599f, 0.51804450f, 0.51673180f, 0.51541788f,
-    0.51410274f, 0.51278640f, 0.51146885f, 0.51015010f, 0.50883014f, 0.50750899f, 0.50618665f, 0.50486311f,
-    0.50353838f, 0.50221247f, 0.50088538f, 0.49955711f, 0.49822767f, 0.49689705f, 0.49556526f, 0.49423231f,
-    0.49289819f, 0.49156292f, 0.49022648f, 0.48888890f, 0.48755016f, 0.48621028f, 0.48486925f, 0.48352708f,
-    0.48218377f, 0.48083933f, 0.47949376f, 0.47814706f, 0.47679923f, 0.47545028f, 0.47410021f, 0.47274903f,
-    0.47139674f, 0.47004333f, 0.46868882f, 0.46733321f, 0.46597650f, 0.46461869f, 0.46325978f, 0.46189979f,
-    0.46053871f, 0.45917655f, 0.45781330f, 0.45644898f, 0.45508359f, 0.45371712f, 0.45234959f, 0.45098099f,
-    0.44961133f, 0.44824061f, 0.44686884f, 0.44549602f, 0.44412214f, 0.44274723f, 0.44137127f, 0.43999427f,
-    0.43861624f, 0.43723717f, 0.43585708f, 0.43447596f, 0.43309382f, 0.43171066f, 0.43032648f, 0.42894129f,
-    0.42755509f, 0.42616789f, 0.42477968f, 0.42339047f, 0.42200027f, 0.42060907f, 0.41921689f, 0.41782372f,
-    0.41642956f, 0.41503442f, 0.41363831f, 0.41224123f, 0.41084317f, 0.40944415f, 0.40804416f, 0.40664322f,
-    0.40524131f, 0.40383846f, 0.40243465f, 0.40102990f, 0.39962420f, 0.39821756f, 0.39680999f, 0.39540148f,
-    0.39399204f, 0.39258167f, 0.39117038f, 0.38975817f, 0.38834505f, 0.38693101f, 0.38551605f, 0.38410020f,
-    0.38268343f, 0.38126577f, 0.37984721f, 0.37842775f, 0.37700741f, 0.37558618f, 0.37416406f, 0.37274107f,
-    0.37131719f, 0.36989245f, 0.36846683f, 0.36704035f, 0.36561300f, 0.36418479f, 0.36275572f, 0.36132581f,
-    0.35989504f, 0.35846342f, 0.35703096f, 0.35559766f, 0.35416353f, 0.35272856f, 0.35129276f, 0.34985613f,
-    0.34841868f, 0.34698041f, 0.34554132f, 0.34410143f, 0.34266072f, 0.34121920f, 0.33977688f, 0.33833377f,
-    0.33688985f, 0.33544515f, 0.33399965f, 0.33255337f, 0.33110631f, 0.32965846f, 0.32820984f, 0.32676045f,
-    0.32531029f, 0.32385937f, 0.32240768f, 0.32095523f, 0.31950203f, 0.31804808f, 0.31659338f, 0.31513793f,
-    0.31368174f, 0.31222481f, 0.31076715f, 0.30930876f, 0.30784964f, 0.30638980f, 0.30492923f, 0.30346795f,
-    0.30200595f, 0.30054324f, 0.29907983f, 0.29761571f, 0.29615089f, 0.29468537f, 0.29321916f, 0.29175226f,
-    0.29028468f, 0.28881641f, 0.28734746f, 0.28587783f, 0.28440754f, 0.28293657f, 0.28146494f, 0.27999264f,
-    0.27851969f, 0.27704608f, 0.27557182f, 0.27409691f, 0.27262136f, 0.27114516f, 0.26966833f, 0.26819086f,
-    0.26671276f, 0.26523403f, 0.26375468f, 0.26227471f, 0.26079412f, 0.25931292f, 0.25783110f, 0.25634868f,
-    0.25486566f, 0.25338204f, 0.25189782f, 0.25041301f, 0.24892761f, 0.24744162f, 0.24595505f, 0.24446790f,
-    0.24298018f, 0.24149189f, 0.24000302f, 0.23851359f, 0.23702361f, 0.23553306f, 0.23404196f, 0.23255031f,
-    0.23105811f, 0.22956537f, 0.22807208f, 0.22657826f, 0.22508391f, 0.22358903f, 0.22209362f, 0.22059769f,
-    0.21910124f, 0.21760427f, 0.21610680f, 0.21460881f, 0.21311032f, 0.21161133f, 0.21011184f, 0.20861185f,
-    0.20711138f, 0.20561041f, 0.20410897f, 0.20260704f, 0.20110463f, 0.19960176f, 0.19809841f, 0.19659460f,
-    0.19509032f, 0.19358559f, 0.19208040f, 0.19057475f, 0.18906866f, 0.18756213f, 0.18605515f, 0.18454774f,
-    0.18303989f, 0.18153161f, 0.18002290f, 0.17851377f, 0.17700422f, 0.17549425f, 0.17398387f, 0.17247308f,
-    0.17096189f, 0.16945029f, 0.16793829f, 0.16642590f, 0.16491312f, 0.16339995f, 0.16188639f, 0.16037246f,
-    0.15885814f, 0.15734346f, 0.15582840f, 0.15431297f, 0.15279719f, 0.15128104f, 0.14976453f, 0.14824768f,
-    0.14673047f, 0.14521292f, 0.14369503f, 0.14217680f, 0.14065824f, 0.13913934f, 0.13762012f, 0.13610058f,
-    0.13458071f, 0.13306053f, 0.13154003f, 0.13001922f, 0.12849811f, 0.12697670f, 0.12545498f, 0.12393298f,
-    0.12241068f, 0.12088809f, 0.11936521f, 0.11784206f, 0.11631863f, 0.11479493f, 0.11327095f, 0.11174671f,
-    0.11022221f, 0.10869744f, 0.10717242f, 0.10564715f, 0.10412163f, 0.10259587f, 0.10106986f, 0.09954362f,
-    0.09801714f, 0.09649043f, 0.09496350f, 0.09343634f, 0.09190896f, 0.09038136f, 0.08885355f, 0.08732554f,
-    0.08579731f, 0.08426889f, 0.08274026f, 0.08121145f, 0.07968244f, 0.07815324f, 0.07662386f, 0.07509430f,
-    0.07356456f, 0.07203465f, 0.07050457f, 0.06897433f, 0.06744392f, 0.06591335f, 0.06438263f, 0.06285176f,
-    0.06132074f, 0.05978957f, 0.05825826f, 0.05672682f, 0.05519524f, 0.05366354f, 0.05213170f, 0.05059975f,
-    0.04906767f, 0.04753548f, 0.04600318f, 0.04447077f, 0.04293826f, 0.04140564f, 0.03987293f, 0.03834012f,
-    0.03680722f, 0.03527424f, 0.03374117f, 0.03220803f, 0.03067480f, 0.02914151f, 0.02760815f, 0.02607472f,
-    0.02454123f, 0.02300768f, 0.02147408f, 0.01994043f, 0.01840673f, 0.01687299f, 0.01533921f, 0.01380539f,
-    0.01227154f, 0.01073766f, 0.00920375f, 0.00766983f, 0.00613588f, 0.00460193f, 0.00306796f, 0.00153398f,
-    0.00000000f, -0.00153398f, -0.00306796f, -0.00460193f, -0.00613588f, -0.00766983f, -0.00920375f, -0.01073766f,
-    -0.01227154f, -0.01380539f, -0.01533921f, -0.01687299f, -0.01840673f, -0.01994043f, -0.02147408f, -0.02300768f,
-    -0.02454123f, -0.02607472f, -0.02760815f, -0.02914151f, -0.03067480f, -0.03220803f, -0.03374117f, -0.03527424f,
-    -0.03680722f, -0.03834012f, -0.03987293f, -0.04140564f, -0.04293826f, -0.04447077f, -0.04600318f, -0.04753548f,
-    -0.04906767f, -0.05059975f, -0.05213170f, -0.05366354f, -0.05519524f, -0.05672682f, -0.05825826f, -0.05978957f,
-    -0.06132074f, -0.06285176f, -0.06438263f, -0.06591335f, -0.06744392f, -0.06897433f, -0.07050457f, -0.07203465f,
-    -0.07356456f, -0.07509430f, -0.07662386f, -0.07815324f, -0.07968244f, -0.08121145f, -0.08274026f, -0.08426889f,
-    -0.08579731f, -0.08732554f, -0.08885355f, -0.09038136f, -0.09190896f, -0.09343634f, -0.09496350f, -0.09649043f,
-    -0.09801714f, -0.09954362f, -0.10106986f, -0.10259587f, -0.10412163f, -0.10564715f, -0.10717242f, -0.10869744f,
-    -0.11022221f, -0.11174671f, -0.11327095f, -0.11479493f, -0.11631863f, -0.11784206f, -0.11936521f, -0.12088809f,
-    -0.12241068f, -0.12393298f, -0.12545498f, -0.12697670f, -0.12849811f, -0.13001922f, -0.13154003f, -0.13306053f,
-    -0.13458071f, -0.13610058f, -0.13762012f, -0.13913934f, -0.14065824f, -0.14217680f, -0.14369503f, -0.14521292f,
-    -0.14673047f, -0.14824768f, -0.14976453f, -0.15128104f, -0.15279719f, -0.15431297f, -0.15582840f, -0.15734346f,
-    -0.15885814f, -0.16037246f, -0.16188639f, -0.16339995f, -0.16491312f, -0.16642590f, -0.16793829f, -0.16945029f,
-    -0.17096189f, -0.17247308f, -0.17398387f, -0.17549425f, -0.17700422f, -0.17851377f, -0.18002290f, -0.18153161f,
-    -0.18303989f, -0.18454774f, -0.18605515f, -0.18756213f, -0.18906866f, -0.19057475f, -0.19208040f, -0.19358559f,
-    -0.19509032f, -0.19659460f, -0.19809841f, -0.19960176f, -0.20110463f, -0.20260704f, -0.20410897f, -0.20561041f,
-    -0.20711138f, -0.20861185f, -0.21011184f, -0.21161133f, -0.21311032f, -0.21460881f, -0.21610680f, -0.21760427f,
-    -0.21910124f, -0.22059769f, -0.22209362f, -0.22358903f, -0.22508391f, -0.22657826f, -0.22807208f, -0.22956537f,
-    -0.23105811f, -0.23255031f, -0.23404196f, -0.23553306f, -0.23702361f, -0.23851359f, -0.24000302f, -0.24149189f,
-    -0.24298018f, -0.24446790f, -0.24595505f, -0.24744162f, -0.24892761f, -0.25041301f, -0.25189782f, -0.25338204f,
-    -0.25486566f, -0.25634868f, -0.25783110f, -0.25931292f, -0.26079412f, -0.26227471f, -0.26375468f, -0.26523403f,
-    -0.26671276f, -0.26819086f, -0.26966833f, -0.27114516f, -0.27262136f, -0.27409691f, -0.27557182f, -0.27704608f,
-    -0.27851969f, -0.27999264f, -0.28146494f, -0.28293657f, -0.28440754f, -0.28587783f, -0.28734746f, -0.28881641f,
-    -0.29028468f, -0.29175226f, -0.29321916f, -0.29468537f, -0.29615089f, -0.29761571f, -0.29907983f, -0.30054324f,
-    -0.30200595f, -0.30346795f, -0.30492923f, -0.30638980f, -0.30784964f, -0.30930876f, -0.31076715f, -0.31222481f,
-    -0.31368174f, -0.31513793f, -0.31659338f, -0.31804808f, -0.31950203f, -0.32095523f, -0.32240768f, -0.32385937f,
-    -0.32531029f, -0.32676045f, -0.32820984f, -0.32965846f, -0.33110631f, -0.33255337f, -0.33399965f, -0.33544515f,
-    -0.33688985f, -0.33833377f, -0.33977688f, -0.34121920f, -0.34266072f, -0.34410143f, -0.34554132f, -0.34698041f,
-    -0.34841868f, -0.34985613f, -0.35129276f, -0.35272856f, -0.35416353f, -0.35559766f, -0.35703096f, -0.35846342f,
-    -0.35989504f, -0.36132581f, -0.36275572f, -0.36418479f, -0.36561300f, -0.36704035f, -0.36846683f, -0.36989245f,
-    -0.37131719f, -0.37274107f, -0.37416406f, -0.37558618f, -0.37700741f, -0.37842775f, -0.37984721f, -0.38126577f,
-    -0.38268343f, -0.38410020f, -0.38551605f, -0.38693101f, -0.38834505f, -0.38975817f, -0.39117038f, -0.39258167f,
-    -0.39399204f, -0.39540148f, -0.39680999f, -0.39821756f, -0.39962420f, -0.40102990f, -0.40243465f, -0.40383846f,
-    -0.40524131f, -0.40664322f, -0.40804416f, -0.40944415f, -0.41084317f, -0.41224123f, -0.41363831f, -0.41503442f,
-    -0.41642956f, -0.41782372f, -0.41921689f, -0.42060907f, -0.42200027f, -0.42339047f, -0.42477968f, -0.42616789f,
-    -0.42755509f, -0.42894129f, -0.43032648f, -0.43171066f, -0.43309382f, -0.43447596f, -0.43585708f, -0.43723717f,
-    -0.43861624f, -0.43999427f, -0.44137127f, -0.44274723f, -0.44412214f, -0.44549602f, -0.44686884f, -0.44824061f,
-    -0.44961133f, -0.45098099f, -0.45234959f, -0.45371712f, -0.45508359f, -0.45644898f, -0.45781330f, -0.45917655f,
-    -0.46053871f, -0.46189979f, -0.46325978f, -0.46461869f, -0.46597650f, -0.46733321f, -0.46868882f, -0.47004333f,
-    -0.47139674f, -0.47274903f, -0.47410021f, -0.47545028f, -0.47679923f, -0.47814706f, -0.47949376f, -0.48083933f,
-    -0.48218377f, -0.48352708f, -0.48486925f, -0.48621028f, -0.48755016f, -0.48888890f, -0.49022648f, -0.49156292f,
-    -0.49289819f, -0.49423231f, -0.49556526f, -0.49689705f, -0.49822767f, -0.49955711f, -0.50088538f, -0.50221247f,
-    -0.50353838f, -0.50486311f, -0.50618665f, -0.50750899f, -0.50883014f, -0.51015010f, -0.51146885f, -0.51278640f,
-    -0.51410274f, -0.51541788f, -0.51673180f, -0.51804450f, -0.51935599f, -0.52066625f, -0.52197529f, -0.52328310f,
-    -0.52458968f, -0.52589503f, -0.52719913f, -0.52850200f, -0.52980362f, -0.53110400f, -0.53240313f, -0.53370100f,
-    -0.53499762f, -0.53629298f, -0.53758708f, -0.53887991f, -0.54017147f, -0.54146177f, -0.54275078f, -0.54403853f,
-    -0.54532499f, -0.54661017f, -0.54789406f, -0.54917666f, -0.55045797f, -0.55173799f, -0.55301671f, -0.55429412f,
-    -0.55557023f, -0.55684504f, -0.55811853f, -0.55939071f, -0.56066158f, -0.56193112f, -0.56319934f, -0.56446624f,
-    -0.56573181f, -0.56699605f, -0.56825895f, -0.56952052f, -0.57078075f, -0.57203963f, -0.57329717f, -0.57455336f,
-    -0.57580819f, -0.57706167f, -0.57831380f, -0.57956456f, -0.58081396f, -0.58206199f, -0.58330865f, -0.58455394f,
-    -0.58579786f, -0.58704039f, -0.58828155f, -0.58952132f, -0.59075970f, -0.59199669f, -0.59323230f, -0.59446650f,
-    -0.59569930f, -0.59693071f, -0.59816071f, -0.59938930f, -0.60061648f, -0.60184225f, -0.60306660f, -0.60428953f,
-    -0.60551104f, -0.60673113f, -0.60794978f, -0.60916701f, -0.61038281f, -0.61159716f, -0.61281008f, -0.61402156f,
-    -0.61523159f, -0.61644017f, -0.61764731f, -0.61885299f, -0.62005721f, -0.62125998f, -0.62246128f, -0.62366112f,
-    -0.62485949f, -0.62605639f, -0.62725182f, -0.62844577f, -0.62963824f, -0.63082923f, -0.63201874f, -0.63320676f,
-    -0.63439328f, -0.63557832f, -0.63676186f, -0.63794390f, -0.63912444f, -0.64030348f, -0.64148101f, -0.64265703f,
-    -0.64383154f, -0.64500454f, -0.64617601f, -0.64734597f, -0.64851440f, -0.64968131f, -0.65084668f, -0.65201053f,
-    -0.65317284f, -0.65433362f, -0.65549285f, -0.65665055f, -0.65780669f, -0.65896129f, -0.66011434f, -0.66126584f,
-    -0.66241578f, -0.66356416f, -0.66471098f, -0.66585623f, -0.66699992f, -0.66814204f, -0.66928259f, -0.67042156f,
-    -0.67155895f, -0.67269477f, -0.67382900f, -0.67496165f, -0.67609270f, -0.67722217f, -0.67835004f, -0.67947632f,
-    -0.68060100f, -0.68172407f, -0.68284555f, -0.68396541f, -0.68508367f, -0.68620031f, -0.68731534f, -0.68842875f,
-    -0.68954054f, -0.69065071f, -0.69175926f, -0.69286617f, -0.69397146f, -0.69507511f, -0.69617713f, -0.69727751f,
-    -0.69837625f, -0.69947334f, -0.70056879f, -0.70166259f, -0.70275474f, -0.70384524f, -0.70493408f, -0.70602126f,
-    -0.70710678f, -0.70819064f, -0.70927283f, -0.71035335f, -0.71143220f, -0.71250937f, -0.71358487f, -0.71465869f,
-    -0.71573083f, -0.71680128f, -0.71787005f, -0.71893712f, -0.72000251f, -0.72106620f, -0.72212819f, -0.72318849f,
-    -0.72424708f, -0.72530397f, -0.72635916f, -0.72741263f, -0.72846439f, -0.72951444f, -0.73056277f, -0.73160938f,
-    -0.73265427f, -0.73369744f, -0.73473888f, -0.73577859f, -0.73681657f, -0.73785281f, -0.73888732f, -0.73992010f,
-    -0.74095113f, -0.74198041f, -0.74300795f, -0.74403374f, -0.74505779f, -0.74608007f, -0.74710061f, -0.74811938f,
-    -0.74913639f, -0.75015165f, -0.75116513f, -0.75217685f, -0.75318680f, -0.75419498f, -0.75520138f, -0.75620600f,
-    -0.75720885f, -0.75820991f, -0.75920919f, -0.76020668f, -0.76120239f, -0.76219630f, -0.76318842f, -0.76417874f,
-    -0.76516727f, -0.76615399f, -0.76713891f, -0.76812203f, -0.76910334f, -0.77008284f, -0.77106052f, -0.77203640f,
-    -0.77301045f, -0.77398269f, -0.77495311f, -0.77592170f, -0.77688847f, -0.77785340f, -0.77881651f, -0.77977779f,
-    -0.78073723f, -0.78169483f, -0.78265060f, -0.78360452f, -0.78455660f, -0.78550683f, -0.78645521f, -0.78740175f,
-    -0.78834643f, -0.78928925f, -0.79023022f, -0.79116933f, -0.79210658f, -0.79304196f, -0.79397548f, -0.79490713f,
-    -0.79583690f, -0.79676481f, -0.79769084f, -0.79861499f, -0.79953727f, -0.80045766f, -0.80137617f, -0.80229280f,
-    -0.80320753f, -0.80412038f, -0.80503133f, -0.80594039f, -0.80684755f, -0.80775282f, -0.80865618f, -0.80955764f,
-    -0.81045720f, -0.81135485f, -0.81225059f, -0.81314441f, -0.81403633f, -0.81492633f, -0.81581441f, -0.81670057f,
-    -0.81758481f, -0.81846713f, -0.81934752f, -0.82022598f, -0.82110251f, -0.82197712f, -0.82284978f, -0.82372051f,
-    -0.82458930f, -0.82545615f, -0.82632106f, -0.82718403f, -0.82804505f, -0.82890411f, -0.82976123f, -0.83061640f,
-    -0.83146961f, -0.83232087f, -0.83317016f, -0.83401750f, -0.83486287f, -0.83570628f, -0.83654773f, -0.83738720f,
-    -0.83822471f, -0.83906024f, -0.83989379f, -0.84072537f, -0.84155498f, -0.84238260f, -0.84320824f, -0.84403190f,
-    -0.84485357f, -0.84567325f, -0.84649094f, -0.84730664f, -0.84812034f, -0.84893206f, -0.84974177f, -0.85054948f,
-    -0.85135519f, -0.85215890f, -0.85296060f, -0.85376030f, -0.85455799f, -0.85535366f, -0.85614733f, -0.85693898f,
-    -0.85772861f, -0.85851622f, -0.85930182f, -0.86008539f, -0.86086694f, -0.86164646f, -0.86242396f, -0.86319942f,
-    -0.86397286f, -0.86474426f, -0.86551362f, -0.86628095f, -0.86704625f, -0.86780950f, -0.86857071f, -0.86932987f,
-    -0.87008699f, -0.87084206f, -0.87159509f, -0.87234606f, -0.87309498f, -0.87384184f, -0.87458665f, -0.87532940f,
-    -0.87607009f, -0.87680872f, -0.87754529f, -0.87827979f, -0.87901223f, -0.87974259f, -0.88047089f, -0.88119711f,
-    -0.88192126f, -0.88264334f, -0.88336334f, -0.88408126f, -0.88479710f, -0.88551086f, -0.88622253f, -0.88693212f,
-    -0.88763962f, -0.88834503f, -0.88904836f, -0.88974959f, -0.89044872f, -0.89114576f, -0.89184071f, -0.89253356f,
-    -0.89322430f, -0.89391295f, -0.89459949f, -0.89528392f, -0.89596625f, -0.89664647f, -0.89732458f, -0.89800058f,
-    -0.89867447f, -0.89934624f, -0.90001589f, -0.90068343f, -0.90134885f, -0.90201214f, -0.90267332f, -0.90333237f,
-    -0.90398929f, -0.90464409f, -0.90529676f, -0.90594730f, -0.90659570f, -0.90724198f, -0.90788612f, -0.90852812f,
-    -0.90916798f, -0.90980571f, -0.91044129f, -0.91107473f, -0.91170603f, -0.91233518f, -0.91296219f, -0.91358705f,
-    -0.91420976f, -0.91483031f, -0.91544872f, -0.91606497f, -0.91667906f, -0.91729100f, -0.91790078f, -0.91850839f,
-    -0.91911385f, -0.91971715f, -0.92031828f, -0.92091724f, -0.92151404f, -0.92210867f, -0.92270113f, -0.92329142f,
-    -0.92387953f, -0.92446547f, -0.92504924f, -0.92563083f, -0.92621024f, -0.92678747f, -0.92736253f, -0.92793539f,
-    -0.92850608f, -0.92907458f, -0.92964090f, -0.93020502f, -0.93076696f, -0.93132671f, -0.93188427f, -0.93243963f,
-    -0.93299280f, -0.93354377f, -0.93409255f, -0.93463913f, -0.93518351f, -0.93572569f, -0.93626567f, -0.93680344f,
-    -0.93733901f, -0.93787238f, -0.93840353f, -0.93893248f, -0.93945922f, -0.93998375f, -0.94050607f, -0.94102618f,
-    -0.94154407f, -0.94205974f, -0.94257320f, -0.94308444f, -0.94359346f, -0.94410026f, -0.94460484f, -0.94510719f,
-    -0.94560733f, -0.94610523f, -0.94660091f, -0.94709437f, -0.94758559f, -0.94807459f, -0.94856135f, -0.94904588f,
-    -0.94952818f, -0.95000825f, -0.95048607f, -0.95096167f, -0.95143502f, -0.95190614f, -0.95237501f, -0.95284165f,
-    -0.95330604f, -0.95376819f, -0.95422810f, -0.95468575f, -0.95514117f, -0.95559433f, -0.95604525f, -0.95649392f,
-    -0.95694034f, -0.95738450f, -0.95782641f, -0.95826607f, -0.95870347f, -0.95913862f, -0.95957151f, -0.96000215f,
-    -0.96043052f, -0.96085663f, -0.96128049f, -0.96170208f, -0.96212140f, -0.96253847f, -0.96295327f, -0.96336580f,
-    -0.96377607f, -0.96418406f, -0.96458979f, -0.96499325f, -0.96539444f, -0.96579336f, -0.96619000f, -0.96658437f,
-    -0.96697647f, -0.96736629f, -0.96775384f, -0.96813910f, -0.96852209f, -0.96890280f, -0.96928124f, -0.96965739f,
-    -0.97003125f, -0.97040284f, -0.97077214f, -0.97113916f, -0.97150389f, -0.97186634f, -0.97222650f, -0.97258437f,
-    -0.97293995f, -0.97329325f, -0.97364425f, -0.97399296f, -0.97433938f, -0.97468351f, -0.97502535f, -0.97536489f,
-    -0.97570213f, -0.97603708f, -0.97636973f, -0.97670009f, -0.97702814f, -0.97735390f, -0.97767736f, -0.97799851f,
-    -0.97831737f, -0.97863392f, -0.97894818f, -0.97926012f, -0.97956977f, -0.97987710f, -0.98018214f, -0.98048486f,
-    -0.98078528f, -0.98108339f, -0.98137919f, -0.98167269f, -0.98196387f, -0.98225274f, -0.98253930f, -0.98282355f,
-    -0.98310549f, -0.98338511f, -0.98366242f, -0.98393741f, -0.98421009f, -0.98448046f, -0.98474850f, -0.98501423f,
-    -0.98527764f, -0.98553874f, -0.98579751f, -0.98605396f, -0.98630810f, -0.98655991f, -0.98680940f, -0.98705657f,
-    -0.98730142f, -0.98754394f, -0.98778414f, -0.98802202f, -0.98825757f, -0.98849079f, -0.98872169f, -0.98895026f,
-    -0.98917651f, -0.98940043f, -0.98962202f, -0.98984128f, -0.99005821f, -0.99027281f, -0.99048508f, -0.99069503f,
-    -0.99090264f, -0.99110791f, -0.99131086f, -0.99151147f, -0.99170975f, -0.99190570f, -0.99209931f, -0.99229059f,
-    -0.99247953f, -0.99266614f, -0.99285041f, -0.99303235f, -0.99321195f, -0.99338921f, -0.99356414f, -0.99373672f,
-    -0.99390697f, -0.99407488f, -0.99424045f, -0.99440368f, -0.99456457f, -0.99472312f, -0.99487933f, -0.99503320f,
-    -0.99518473f, -0.99533391f, -0.99548076f, -0.99562526f, -0.99576741f, -0.99590723f, -0.99604470f, -0.99617983f,
-    -0.99631261f, -0.99644305f, -0.99657115f, -0.99669690f, -0.99682030f, -0.99694136f, -0.99706007f, -0.99717644f,
-    -0.99729046f, -0.99740213f, -0.99751146f, -0.99761844f, -0.99772307f, -0.99782535f, -0.99792529f, -0.99802287f,
-    -0.99811811f, -0.99821100f, -0.99830154f, -0.99838974f, -0.99847558f, -0.99855907f, -0.99864022f, -0.99871901f,
-    -0.99879546f, -0.99886955f, -0.99894129f, -0.99901069f, -0.99907773f, -0.99914242f, -0.99920476f, -0.99926475f,
-    -0.99932238f, -0.99937767f, -0.99943060f, -0.99948119f, -0.99952942f, -0.99957530f, -0.99961882f, -0.99966000f,
-    -0.99969882f, -0.99973529f, -0.99976941f, -0.99980117f, -0.99983058f, -0.99985764f, -0.99988235f, -0.99990470f,
-    -0.99992470f, -0.99994235f, -0.99995764f, -0.99997059f, -0.99998118f, -0.99998941f, -0.99999529f, -0.99999882f,
-    -1.00000000f, -0.99999882f, -0.99999529f, -0.99998941f, -0.99998118f, -0.99997059f, -0.99995764f, -0.99994235f,
-    -0.99992470f, -0.99990470f, -0.99988235f, -0.99985764f, -0.99983058f, -0.99980117f, -0.99976941f, -0.99973529f,
-    -0.99969882f, -0.99966000f, -0.99961882f, -0.99957530f, -0.99952942f, -0.99948119f, -0.99943060f, -0.99937767f,
-    -0.99932238f, -0.99926475f, -0.99920476f, -0.99914242f, -0.99907773f, -0.99901069f, -0.99894129f, -0.99886955f,
-    -0.99879546f, -0.99871901f, -0.99864022f, -0.99855907f, -0.99847558f, -0.99838974f, -0.99830154f, -0.99821100f,
-    -0.99811811f, -0.99802287f, -0.99792529f, -0.99782535f, -0.99772307f, -0.99761844f, -0.99751146f, -0.99740213f,
-    -0.99729046f, -0.99717644f, -0.99706007f, -0.99694136f, -0.99682030f, -0.99669690f, -0.99657115f, -0.99644305f,
-    -0.99631261f, -0.99617983f, -0.99604470f, -0.99590723f, -0.99576741f, -0.99562526f, -0.99548076f, -0.99533391f,
-    -0.99518473f, -0.99503320f, -0.99487933f, -0.99472312f, -0.99456457f, -0.99440368f, -0.99424045f, -0.99407488f,
-    -0.99390697f, -0.99373672f, -0.99356414f, -0.99338921f, -0.99321195f, -0.99303235f, -0.99285041f, -0.99266614f,
-    -0.99247953f, -0.99229059f, -0.99209931f, -0.99190570f, -0.99170975f, -0.99151147f, -0.99131086f, -0.99110791f,
-    -0.99090264f, -0.99069503f, -0.99048508f, -0.99027281f, -0.99005821f, -0.98984128f, -0.98962202f, -0.98940043f,
-    -0.98917651f, -0.98895026f, -0.98872169f, -0.98849079f, -0.98825757f, -0.98802202f, -0.98778414f, -0.98754394f,
-    -0.98730142f, -0.98705657f, -0.98680940f, -0.98655991f, -0.98630810f, -0.98605396f, -0.98579751f, -0.98553874f,
-    -0.98527764f, -0.98501423f, -0.98474850f, -0.98448046f, -0.98421009f, -0.98393741f, -0.98366242f, -0.98338511f,
-    -0.98310549f, -0.98282355f, -0.98253930f, -0.98225274f, -0.98196387f, -0.98167269f, -0.98137919f, -0.98108339f,
-    -0.98078528f, -0.98048486f, -0.98018214f, -0.97987710f, -0.97956977f, -0.97926012f, -0.97894818f, -0.97863392f,
-    -0.97831737f, -0.97799851f, -0.97767736f, -0.97735390f, -0.97702814f, -0.97670009f, -0.97636973f, -0.97603708f,
-    -0.97570213f, -0.97536489f, -0.97502535f, -0.97468351f, -0.97433938f, -0.97399296f, -0.97364425f, -0.97329325f,
-    -0.97293995f, -0.97258437f, -0.97222650f, -0.97186634f, -0.97150389f, -0.97113916f, -0.97077214f, -0.97040284f,
-    -0.97003125f, -0.96965739f, -0.96928124f, -0.96890280f, -0.96852209f, -0.96813910f, -0.96775384f, -0.96736629f,
-    -0.96697647f, -0.96658437f, -0.96619000f, -0.96579336f, -0.96539444f, -0.96499325f, -0.96458979f, -0.96418406f,
-    -0.96377607f, -0.96336580f, -0.96295327f, -0.96253847f, -0.96212140f, -0.96170208f, -0.96128049f, -0.96085663f,
-    -0.96043052f, -0.96000215f, -0.95957151f, -0.95913862f, -0.95870347f, -0.95826607f, -0.95782641f, -0.95738450f,
-    -0.95694034f, -0.95649392f, -0.95604525f, -0.95559433f, -0.95514117f, -0.95468575f, -0.95422810f, -0.95376819f,
-    -0.95330604f, -0.95284165f, -0.95237501f, -0.95190614f, -0.95143502f, -0.95096167f, -0.95048607f, -0.95000825f,
-    -0.94952818f, -0.94904588f, -0.94856135f, -0.94807459f, -0.94758559f, -0.94709437f, -0.94660091f, -0.94610523f,
-    -0.94560733f, -0.94510719f, -0.94460484f, -0.94410026f, -0.94359346f, -0.94308444f, -0.94257320f, -0.94205974f,
-    -0.94154407f, -0.94102618f, -0.94050607f, -0.93998375f, -0.93945922f, -0.93893248f, -0.93840353f, -0.93787238f,
-    -0.93733901f, -0.93680344f, -0.93626567f, -0.93572569f, -0.93518351f, -0.93463913f, -0.93409255f, -0.93354377f,
-    -0.93299280f, -0.93243963f, -0.93188427f, -0.93132671f, -0.93076696f, -0.93020502f, -0.92964090f, -0.92907458f,
-    -0.92850608f, -0.92793539f, -0.92736253f, -0.92678747f, -0.92621024f, -0.92563083f, -0.92504924f, -0.92446547f,
-    -0.92387953f, -0.92329142f, -0.92270113f, -0.92210867f, -0.92151404f, -0.92091724f, -0.92031828f, -0.91971715f,
-    -0.91911385f, -0.91850839f, -0.91790078f, -0.91729100f, -0.91667906f, -0.91606497f, -0.91544872f, -0.91483031f,
-    -0.91420976f, -0.91358705f, -0.91296219f, -0.91233518f, -0.91170603f, -0.91107473f, -0.91044129f, -0.90980571f,
-    -0.90916798f, -0.90852812f, -0.90788612f, -0.90724198f, -0.90659570f, -0.90594730f, -0.90529676f, -0.90464409f,
-    -0.90398929f, -0.90333237f, -0.90267332f, -0.90201214f, -0.90134885f, -0.90068343f, -0.90001589f, -0.89934624f,
-    -0.89867447f, -0.89800058f, -0.89732458f, -0.89664647f, -0.89596625f, -0.89528392f, -0.89459949f, -0.89391295f,
-    -0.89322430f, -0.89253356f, -0.89184071f, -0.89114576f, -0.89044872f, -0.88974959f, -0.88904836f, -0.88834503f,
-    -0.88763962f, -0.88693212f, -0.88622253f, -0.88551086f, -0.88479710f, -0.88408126f, -0.88336334f, -0.88264334f,
-    -0.88192126f, -0.88119711f, -0.88047089f, -0.87974259f, -0.87901223f, -0.87827979f, -0.87754529f, -0.87680872f,
-    -0.87607009f, -0.87532940f, -0.87458665f, -0.87384184f, -0.87309498f, -0.87234606f, -0.87159509f, -0.87084206f,
-    -0.87008699f, -0.86932987f, -0.86857071f, -0.86780950f, -0.86704625f, -0.86628095f, -0.86551362f, -0.86474426f,
-    -0.86397286f, -0.86319942f, -0.86242396f, -0.86164646f, -0.86086694f, -0.86008539f, -0.85930182f, -0.85851622f,
-    -0.85772861f, -0.85693898f, -0.85614733f, -0.85535366f, -0.85455799f, -0.85376030f, -0.85296060f, -0.85215890f,
-    -0.85135519f, -0.85054948f, -0.84974177f, -0.84893206f, -0.84812034f, -0.84730664f, -0.84649094f, -0.84567325f,
-    -0.84485357f, -0.84403190f, -0.84320824f, -0.84238260f, -0.84155498f, -0.84072537f, -0.83989379f, -0.83906024f,
-    -0.83822471f, -0.83738720f, -0.83654773f, -0.83570628f, -0.83486287f, -0.83401750f, -0.83317016f, -0.83232087f,
-    -0.83146961f, -0.83061640f, -0.82976123f, -0.82890411f, -0.82804505f, -0.82718403f, -0.82632106f, -0.82545615f,
-    -0.82458930f, -0.82372051f, -0.82284978f, -0.82197712f, -0.82110251f, -0.82022598f, -0.81934752f, -0.81846713f,
-    -0.81758481f, -0.81670057f, -0.81581441f, -0.81492633f, -0.81403633f, -0.81314441f, -0.81225059f, -0.81135485f,
-    -0.81045720f, -0.80955764f, -0.80865618f, -0.80775282f, -0.80684755f, -0.80594039f, -0.80503133f, -0.80412038f,
-    -0.80320753f, -0.80229280f, -0.80137617f, -0.80045766f, -0.79953727f, -0.79861499f, -0.79769084f, -0.79676481f,
-    -0.79583690f, -0.79490713f, -0.79397548f, -0.79304196f, -0.79210658f, -0.79116933f, -0.79023022f, -0.78928925f,
-    -0.78834643f, -0.78740175f, -0.78645521f, -0.78550683f, -0.78455660f, -0.78360452f, -0.78265060f, -0.78169483f,
-    -0.78073723f, -0.77977779f, -0.77881651f, -0.77785340f, -0.77688847f, -0.77592170f, -0.77495311f, -0.77398269f,
-    -0.77301045f, -0.77203640f, -0.77106052f, -0.77008284f, -0.76910334f, -0.76812203f, -0.76713891f, -0.76615399f,
-    -0.76516727f, -0.76417874f, -0.76318842f, -0.76219630f, -0.76120239f, -0.76020668f, -0.75920919f, -0.75820991f,
-    -0.75720885f, -0.75620600f, -0.75520138f, -0.75419498f, -0.75318680f, -0.75217685f, -0.75116513f, -0.75015165f,
-    -0.74913639f, -0.74811938f, -0.74710061f, -0.74608007f, -0.74505779f, -0.74403374f, -0.74300795f, -0.74198041f,
-    -0.74095113f, -0.73992010f, -0.73888732f, -0.73785281f, -0.73681657f, -0.73577859f, -0.73473888f, -0.73369744f,
-    -0.73265427f, -0.73160938f, -0.73056277f, -0.72951444f, -0.72846439f, -0.72741263f, -0.72635916f, -0.72530397f,
-    -0.72424708f, -0.72318849f, -0.72212819f, -0.72106620f, -0.72000251f, -0.71893712f, -0.71787005f, -0.71680128f,
-    -0.71573083f, -0.71465869f, -0.71358487f, -0.71250937f, -0.71143220f, -0.71035335f, -0.70927283f, -0.70819064f,
-    -0.70710678f, -0.70602126f, -0.70493408f, -0.70384524f, -0.70275474f, -0.70166259f, -0.70056879f, -0.69947334f,
-    -0.69837625f, -0.69727751f, -0.69617713f, -0.69507511f, -0.69397146f, -0.69286617f, -0.69175926f, -0.69065071f,
-    -0.68954054f, -0.68842875f, -0.68731534f, -0.68620031f, -0.68508367f, -0.68396541f, -0.68284555f, -0.68172407f,
-    -0.68060100f, -0.67947632f, -0.67835004f, -0.67722217f, -0.67609270f, -0.67496165f, -0.67382900f, -0.67269477f,
-    -0.67155895f, -0.67042156f, -0.66928259f, -0.66814204f, -0.66699992f, -0.66585623f, -0.66471098f, -0.66356416f,
-    -0.66241578f, -0.66126584f, -0.66011434f, -0.65896129f, -0.65780669f, -0.65665055f, -0.65549285f, -0.65433362f,
-    -0.65317284f, -0.65201053f, -0.65084668f, -0.64968131f, -0.64851440f, -0.64734597f, -0.64617601f, -0.64500454f,
-    -0.64383154f, -0.64265703f, -0.64148101f, -0.64030348f, -0.63912444f, -0.63794390f, -0.63676186f, -0.63557832f,
-    -0.63439328f, -0.63320676f, -0.63201874f, -0.63082923f, -0.62963824f, -0.62844577f, -0.62725182f, -0.62605639f,
-    -0.62485949f, -0.62366112f, -0.62246128f, -0.62125998f, -0.62005721f, -0.61885299f, -0.61764731f, -0.61644017f,
-    -0.61523159f, -0.61402156f, -0.61281008f, -0.61159716f, -0.61038281f, -0.60916701f, -0.60794978f, -0.60673113f,
-    -0.60551104f, -0.60428953f, -0.60306660f, -0.60184225f, -0.60061648f, -0.59938930f, -0.59816071f, -0.59693071f,
-    -0.59569930f, -0.59446650f, -0.59323230f, -0.59199669f, -0.59075970f, -0.58952132f, -0.58828155f, -0.58704039f,
-    -0.58579786f, -0.58455394f, -0.58330865f, -0.58206199f, -0.58081396f, -0.57956456f, -0.57831380f, -0.57706167f,
-    -0.57580819f, -0.57455336f, -0.57329717f, -0.57203963f, -0.57078075f, -0.56952052f, -0.56825895f, -0.56699605f,
-    -0.56573181f, -0.56446624f, -0.56319934f, -0.56193112f, -0.56066158f, -0.55939071f, -0.55811853f, -0.55684504f,
-    -0.55557023f, -0.55429412f, -0.55301671f, -0.55173799f, -0.55045797f, -0.54917666f, -0.54789406f, -0.54661017f,
-    -0.54532499f, -0.54403853f, -0.54275078f, -0.54146177f, -0.54017147f, -0.53887991f, -0.53758708f, -0.53629298f,
-    -0.53499762f, -0.53370100f, -0.53240313f, -0.53110400f, -0.52980362f, -0.52850200f, -0.52719913f, -0.52589503f,
-    -0.52458968f, -0.52328310f, -0.52197529f, -0.52066625f, -0.51935599f, -0.51804450f, -0.51673180f, -0.51541788f,
-    -0.51410274f, -0.51278640f, -0.51146885f, -0.51015010f, -0.50883014f, -0.50750899f, -0.50618665f, -0.50486311f,
-    -0.50353838f, -0.50221247f, -0.50088538f, -0.49955711f, -0.49822767f, -0.49689705f, -0.49556526f, -0.49423231f,
-    -0.49289819f, -0.49156292f, -0.49022648f, -0.48888890f, -0.48755016f, -0.48621028f, -0.48486925f, -0.48352708f,
-    -0.48218377f, -0.48083933f, -0.47949376f, -0.47814706f, -0.47679923f, -0.47545028f, -0.47410021f, -0.47274903f,
-    -0.47139674f, -0.47004333f, -0.46868882f, -0.46733321f, -0.46597650f, -0.46461869f, -0.46325978f, -0.46189979f,
-    -0.46053871f, -0.45917655f, -0.45781330f, -0.45644898f, -0.45508359f, -0.45371712f, -0.45234959f, -0.45098099f,
-    -0.44961133f, -0.44824061f, -0.44686884f, -0.44549602f, -0.44412214f, -0.44274723f, -0.44137127f, -0.43999427f,
-    -0.43861624f, -0.43723717f, -0.43585708f, -0.43447596f, -0.43309382f, -0.43171066f, -0.43032648f, -0.42894129f,
-    -0.42755509f, -0.42616789f, -0.42477968f, -0.42339047f, -0.42200027f, -0.42060907f, -0.41921689f, -0.41782372f,
-    -0.41642956f, -0.41503442f, -0.41363831f, -0.41224123f, -0.41084317f, -0.40944415f, -0.40804416f, -0.40664322f,
-    -0.40524131f, -0.40383846f, -0.40243465f, -0.40102990f, -0.39962420f, -0.39821756f, -0.39680999f, -0.39540148f,
-    -0.39399204f, -0.39258167f, -0.39117038f, -0.38975817f, -0.38834505f, -0.38693101f, -0.38551605f, -0.38410020f,
-    -0.38268343f, -0.38126577f, -0.37984721f, -0.37842775f, -0.37700741f, -0.37558618f, -0.37416406f, -0.37274107f,
-    -0.37131719f, -0.36989245f, -0.36846683f, -0.36704035f, -0.36561300f, -0.36418479f, -0.36275572f, -0.36132581f,
-    -0.35989504f, -0.35846342f, -0.35703096f, -0.35559766f, -0.35416353f, -0.35272856f, -0.35129276f, -0.34985613f,
-    -0.34841868f, -0.34698041f, -0.34554132f, -0.34410143f, -0.34266072f, -0.34121920f, -0.33977688f, -0.33833377f,
-    -0.33688985f, -0.33544515f, -0.33399965f, -0.33255337f, -0.33110631f, -0.32965846f, -0.32820984f, -0.32676045f,
-    -0.32531029f, -0.32385937f, -0.32240768f, -0.32095523f, -0.31950203f, -0.31804808f, -0.31659338f, -0.31513793f,
-    -0.31368174f, -0.31222481f, -0.31076715f, -0.30930876f, -0.30784964f, -0.30638980f, -0.30492923f, -0.30346795f,
-    -0.30200595f, -0.30054324f, -0.29907983f, -0.29761571f, -0.29615089f, -0.29468537f, -0.29321916f, -0.29175226f,
-    -0.29028468f, -0.28881641f, -0.28734746f, -0.28587783f, -0.28440754f, -0.28293657f, -0.28146494f, -0.27999264f,
-    -0.27851969f, -0.27704608f, -0.27557182f, -0.27409691f, -0.27262136f, -0.27114516f, -0.26966833f, -0.26819086f,
-    -0.26671276f, -0.26523403f, -0.26375468f, -0.26227471f, -0.26079412f, -0.25931292f, -0.25783110f, -0.25634868f,
-    -0.25486566f, -0.25338204f, -0.25189782f, -0.25041301f, -0.24892761f, -0.24744162f, -0.24595505f, -0.24446790f,
-    -0.24298018f, -0.24149189f, -0.24000302f, -0.23851359f, -0.23702361f, -0.23553306f, -0.23404196f, -0.23255031f,
-    -0.23105811f, -0.22956537f, -0.22807208f, -0.22657826f, -0.22508391f, -0.22358903f, -0.22209362f, -0.22059769f,
-    -0.21910124f, -0.21760427f, -0.21610680f, -0.21460881f, -0.21311032f, -0.21161133f, -0.21011184f, -0.20861185f,
-    -0.20711138f, -0.20561041f, -0.20410897f, -0.20260704f, -0.20110463f, -0.19960176f, -0.19809841f, -0.19659460f,
-    -0.19509032f, -0.19358559f, -0.19208040f, -0.19057475f, -0.18906866f, -0.18756213f, -0.18605515f, -0.18454774f,
-    -0.18303989f, -0.18153161f, -0.18002290f, -0.17851377f, -0.17700422f, -0.17549425f, -0.17398387f, -0.17247308f,
-    -0.17096189f, -0.16945029f, -0.16793829f, -0.16642590f, -0.16491312f, -0.16339995f, -0.16188639f, -0.16037246f,
-    -0.15885814f, -0.15734346f, -0.15582840f, -0.15431297f, -0.15279719f, -0.15128104f, -0.14976453f, -0.14824768f,
-    -0.14673047f, -0.14521292f, -0.14369503f, -0.14217680f, -0.14065824f, -0.13913934f, -0.13762012f, -0.13610058f,
-    -0.13458071f, -0.13306053f, -0.13154003f, -0.13001922f, -0.12849811f, -0.12697670f, -0.12545498f, -0.12393298f,
-    -0.12241068f, -0.12088809f, -0.11936521f, -0.11784206f, -0.11631863f, -0.11479493f, -0.11327095f, -0.11174671f,
-    -0.11022221f, -0.10869744f, -0.10717242f, -0.10564715f, -0.10412163f, -0.10259587f, -0.10106986f, -0.09954362f,
-    -0.09801714f, -0.09649043f, -0.09496350f, -0.09343634f, -0.09190896f, -0.09038136f, -0.08885355f, -0.08732554f,
-    -0.08579731f, -0.08426889f, -0.08274026f, -0.08121145f, -0.07968244f, -0.07815324f, -0.07662386f, -0.07509430f,
-    -0.07356456f, -0.07203465f, -0.07050457f, -0.06897433f, -0.06744392f, -0.06591335f, -0.06438263f, -0.06285176f,
-    -0.06132074f, -0.05978957f, -0.05825826f, -0.05672682f, -0.05519524f, -0.05366354f, -0.05213170f, -0.05059975f,
-    -0.04906767f, -0.04753548f, -0.04600318f, -0.04447077f, -0.04293826f, -0.04140564f, -0.03987293f, -0.03834012f,
-    -0.03680722f, -0.03527424f, -0.03374117f, -0.03220803f, -0.03067480f, -0.02914151f, -0.02760815f, -0.02607472f,
-    -0.02454123f, -0.02300768f, -0.02147408f, -0.01994043f, -0.01840673f, -0.01687299f, -0.01533921f, -0.01380539f,
-    -0.01227154f, -0.01073766f, -0.00920375f, -0.00766983f, -0.00613588f, -0.00460193f, -0.00306796f, -0.00153398f,
+alignas(4) const int16_t waveform_Sine[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+         0,    101,    201,    302,    402,    503,    603,    704,    804,    905,   1005,   1106,   1206,   1307,   1407,   1507,
+      1608,   1708,   1809,   1909,   2009,   2110,   2210,   2310,   2410,   2511,   2611,   2711,   2811,   2911,   3012,   3112,
+      3212,   3312,   3412,   3512,   3612,   3712,   3811,   3911,   4011,   4111,   4210,   4310,   4410,   4509,   4609,   4708,
+      4808,   4907,   5007,   5106,   5205,   5305,   5404,   5503,   5602,   5701,   5800,   5899,   5998,   6096,   6195,   6294,
+      6393,   6491,   6590,   6688,   6786,   6885,   6983,   7081,   7179,   7277,   7375,   7473,   7571,   7669,   7767,   7864,
+      7962,   8059,   8157,   8254,   8351,   8448,   8545,   8642,   8739,   8836,   8933,   9030,   9126,   9223,   9319,   9416,
+      9512,   9608,   9704,   9800,   9896,   9992,  10087,  10183,  10278,  10374,  10469,  10564,  10659,  10754,  10849,  10944,
+     11039,  11133,  11228,  11322,  11417,  11511,  11605,  11699,  11793,  11886,  11980,  12074,  12167,  12260,  12353,  12446,
+     12539,  12632,  12725,  12817,  12910,  13002,  13094,  13187,  13279,  13370,  13462,  13554,  13645,  13736,  13828,  13919,
+     14010,  14101,  14191,  14282,  14372,  14462,  14553,  14643,  14732,  14822,  14912,  15001,  15090,  15180,  15269,  15358,
+     15446,  15535,  15623,  15712,  15800,  15888,  15976,  16063,  16151,  16238,  16325,  16413,  16499,  16586,  16673,  16759,
+     16846,  16932,  17018,  17104,  17189,  17275,  17360,  17445,  17530,  17615,  17700,  17784,  17869,  17953,  18037,  18121,
+     18204,  18288,  18371,  18454,  18537,  18620,  18703,  18785,  18868,  18950,  19032,  19113,  19195,  19276,  19357,  19438,
+     19519,  19600,  19680,  19761,  19841,  19921,  20000,  20080,  20159,  20238,  20317,  20396,  20475,  20553,  20631,  20709,
+     20787,  20865,  20942,  21019,  21096,  21173,  21250,  21326,  21403,  21479,  21554,  21630,  21705,  21781,  21856,  21930,
+     22005,  22079,  22154,  22227,  22301,  22375,  22448,  22521,  22594,  22667,  22739,  22812,  22884,  22956,  23027,  23099,
+     23170,  23241,  23311,  23382,  23452,  23522,  23592,  23662,  23731,  23801,  23870,  23938,  24007,  24075,  24143,  24211,
+     24279,  24346,  24413,  24480,  24547,  24613,  24680,  24746,  24811,  24877,  24942,  25007,  25072,  25137,  25201,  25265,
+     25329,  25393,  25456,  25519,  25582,  25645,  25708,  25770,  25832,  25893,  25955,  26016,  26077,  26138,  26198,  26259,
+     26319,  26378,  26438,  26497,  26556,  26615,  26674,  26732,  26790,  26848,  26905,  26962,  27019,  27076,  27133,  27189,
+     27245,  27300,  27356,  27411,  27466,  27521,  27575,  27629,  27683,  27737,  27790,  27843,  27896,  27949,  28001,  28053,
+     28105,  28157,  28208,  28259,  28310,  28360,  28411,  28460,  28510,  28560,  28609,  28658,  28706,  28755,  28803,  28850,
+     28898,  28945,  28992,  29039,  29085,  29131,  29177,  29223,  29268,  29313,  29358,  29403,  29447,  29491,  29534,  29578,
+     29621,  29664,  29706,  29749,  29791,  29832,  29874,  29915,  29956,  29997,  30037,  30077,  30117,  30156,  30195,  30234,
+     30273,  30311,  30349,  30387,  30424,  30462,  30498,  30535,  30571,  30607,  30643,  30679,  30714,  30749,  30783,  30818,
+     30852,  30885,  30919,  30952,  30985,  31017,  31050,  31082,  31113,  31145,  31176,  31206,  31237,  31267,  31297,  31327,
+     31356,  31385,  31414,  31442,  31470,  31498,  31526,  31553,  31580,  31607,  31633,  31659,  31685,  31710,  31736,  31760,
+     31785,  31809,  31833,  31857,  31880,  31903,  31926,  31949,  31971,  31993,  32014,  32036,  32057,  32077,  32098,  32118,
+     32137,  32157,  32176,  32195,  32213,  32232,  32250,  32267,  32285,  32302,  32318,  32335,  32351,  32367,  32382,  32397,
+     32412,  32427,  32441,  32455,  32469,  32482,  32495,  32508,  32521,  32533,  32545,  32556,  32567,  32578,  32589,  32599,
+     32609,  32619,  32628,  32637,  32646,  32655,  32663,  32671,  32678,  32685,  32692,  32699,  32705,  32711,  32717,  32722,
+     32728,  32732,  32737,  32741,  32745,  32748,  32752,  32755,  32757,  32759,  32761,  32763,  32765,  32766,  32766,  32767,
+     32767,  32767,  32766,  32766,  32765,  32763,  32761,  32759,  32757,  32755,  32752,  32748,  32745,  32741,  32737,  32732,
+     32728,  32722,  32717,  32711,  32705,  32699,  32692,  32685,  32678,  32671,  32663,  32655,  32646,  32637,  32628,  32619,
+     32609,  32599,  32589,  32578,  32567,  32556,  32545,  32533,  32521,  32508,  32495,  32482,  32469,  32455,  32441,  32427,
+     32412,  32397,  32382,  32367,  32351,  32335,  32318,  32302,  32285,  32267,  32250,  32232,  32213,  32195,  32176,  32157,
+     32137,  32118,  32098,  32077,  32057,  32036,  32014,  31993,  31971,  31949,  31926,  31903,  31880,  31857,  31833,  31809,
+     31785,  31760,  31736,  31710,  31685,  31659,  31633,  31607,  31580,  31553,  31526,  31498,  31470,  31442,  31414,  31385,
+     31356,  31327,  31297,  31267,  31237,  31206,  31176,  31145,  31113,  31082,  31050,  31017,  30985,  30952,  30919,  30885,
+     30852,  30818,  30783,  30749,  30714,  30679,  30643,  30607,  30571,  30535,  30498,  30462,  30424,  30387,  30349,  30311,
+     30273,  30234,  30195,  30156,  30117,  30077,  30037,  29997,  29956,  29915,  29874,  29832,  29791,  29749,  29706,  29664,
+     29621,  29578,  29534,  29491,  29447,  29403,  29358,  29313,  29268,  29223,  29177,  29131,  29085,  29039,  28992,  28945,
+     28898,  28850,  28803,  28755,  28706,  28658,  28609,  28560,  28510,  28460,  28411,  28360,  28310,  28259,  28208,  28157,
+     28105,  28053,  28001,  27949,  27896,  27843,  27790,  27737,  27683,  27629,  27575,  27521,  27466,  27411,  27356,  27300,
+     27245,  27189,  27133,  27076,  27019,  26962,  26905,  26848,  26790,  26732,  26674,  26615,  26556,  26497,  26438,  26378,
+     26319,  26259,  26198,  26138,  26077,  26016,  25955,  25893,  25832,  25770,  25708,  25645,  25582,  25519,  25456,  25393,
+     25329,  25265,  25201,  25137,  25072,  25007,  24942,  24877,  24811,  24746,  24680,  24613,  24547,  24480,  24413,  24346,
+     24279,  24211,  24143,  24075,  24007,  23938,  23870,  23801,  23731,  23662,  23592,  23522,  23452,  23382,  23311,  23241,
+     23170,  23099,  23027,  22956,  22884,  22812,  22739,  22667,  22594,  22521,  22448,  22375,  22301,  22227,  22154,  22079,
+     22005,  21930,  21856,  21781,  21705,  21630,  21554,  21479,  21403,  21326,  21250,  21173,  21096,  21019,  20942,  20865,
+     20787,  20709,  20631,  20553,  20475,  20396,  20317,  20238,  20159,  20080,  20000,  19921,  19841,  19761,  19680,  19600,
+     19519,  19438,  19357,  19276,  19195,  19113,  19032,  18950,  18868,  18785,  18703,  18620,  18537,  18454,  18371,  18288,
+     18204,  18121,  18037,  17953,  17869,  17784,  17700,  17615,  17530,  17445,  17360,  17275,  17189,  17104,  17018,  16932,
+     16846,  16759,  16673,  16586,  16499,  16413,  16325,  16238,  16151,  16063,  15976,  15888,  15800,  15712,  15623,  15535,
+     15446,  15358,  15269,  15180,  15090,  15001,  14912,  14822,  14732,  14643,  14553,  14462,  14372,  14282,  14191,  14101,
+     14010,  13919,  13828,  13736,  13645,  13554,  13462,  13370,  13279,  13187,  13094,  13002,  12910,  12817,  12725,  12632,
+     12539,  12446,  12353,  12260,  12167,  12074,  11980,  11886,  11793,  11699,  11605,  11511,  11417,  11322,  11228,  11133,
+     11039,  10944,  10849,  10754,  10659,  10564,  10469,  10374,  10278,  10183,  10087,   9992,   9896,   9800,   9704,   9608,
+      9512,   9416,   9319,   9223,   9126,   9030,   8933,   8836,   8739,   8642,   8545,   8448,   8351,   8254,   8157,   8059,
+      7962,   7864,   7767,   7669,   7571,   7473,   7375,   7277,   7179,   7081,   6983,   6885,   6786,   6688,   6590,   6491,
+      6393,   6294,   6195,   6096,   5998,   5899,   5800,   5701,   5602,   5503,   5404,   5305,   5205,   5106,   5007,   4907,
+      4808,   4708,   4609,   4509,   4410,   4310,   4210,   4111,   4011,   3911,   3811,   3712,   3612,   3512,   3412,   3312,
+      3212,   3112,   3012,   2911,   2811,   2711,   2611,   2511,   2410,   2310,   2210,   2110,   2009,   1909,   1809,   1708,
+      1608,   1507,   1407,   1307,   1206,   1106,   1005,    905,    804,    704,    603,    503,    402,    302,    201,    101,
+         0,   -101,   -201,   -302,   -402,   -503,   -603,   -704,   -804,   -905,  -1005,  -1106,  -1206,  -1307,  -1407,  -1507,
+     -1608,  -1708,  -1809,  -1909,  -2009,  -2110,  -2210,  -2310,  -2410,  -2511,  -2611,  -2711,  -2811,  -2911,  -3012,  -3112,
+     -3212,  -3312,  -3412,  -3512,  -3612,  -3712,  -3811,  -3911,  -4011,  -4111,  -4210,  -4310,  -4410,  -4509,  -4609,  -4708,
+     -4808,  -4907,  -5007,  -5106,  -5205,  -5305,  -5404,  -5503,  -5602,  -5701,  -5800,  -5899,  -5998,  -6096,  -6195,  -6294,
+     -6393,  -6491,  -6590,  -6688,  -6786,  -6885,  -6983,  -7081,  -7179,  -7277,  -7375,  -7473,  -7571,  -7669,  -7767,  -7864,
+     -7962,  -8059,  -8157,  -8254,  -8351,  -8448,  -8545,  -8642,  -8739,  -8836,  -8933,  -9030,  -9126,  -9223,  -9319,  -9416,
+     -9512,  -9608,  -9704,  -9800,  -9896,  -9992, -10087, -10183, -10278, -10374, -10469, -10564, -10659, -10754, -10849, -10944,
+    -11039, -11133, -11228, -11322, -11417, -11511, -11605, -11699, -11793, -11886, -11980, -12074, -12167, -12260, -12353, -12446,
+    -12539, -12632, -12725, -12817, -12910, -13002, -13094, -13187, -13279, -13370, -13462, -13554, -13645, -13736, -13828, -13919,
+    -14010, -14101, -14191, -14282, -14372, -14462, -14553, -14643, -14732, -14822, -14912, -15001, -15090, -15180, -15269, -15358,
+    -15446, -15535, -15623, -15712, -15800, -15888, -15976, -16063, -16151, -16238, -16325, -16413, -16499, -16586, -16673, -16759,
+    -16846, -16932, -17018, -17104, -17189, -17275, -17360, -17445, -17530, -17615, -17700, -17784, -17869, -17953, -18037, -18121,
+    -18204, -18288, -18371, -18454, -18537, -18620, -18703, -18785, -18868, -18950, -19032, -19113, -19195, -19276, -19357, -19438,
+    -19519, -19600, -19680, -19761, -19841, -19921, -20000, -20080, -20159, -20238, -20317, -20396, -20475, -20553, -20631, -20709,
+    -20787, -20865, -20942, -21019, -21096, -21173, -21250, -21326, -21403, -21479, -21554, -21630, -21705, -21781, -21856, -21930,
+    -22005, -22079, -22154, -22227, -22301, -22375, -22448, -22521, -22594, -22667, -22739, -22812, -22884, -22956, -23027, -23099,
+    -23170, -23241, -23311, -23382, -23452, -23522, -23592, -23662, -23731, -23801, -23870, -23938, -24007, -24075, -24143, -24211,
+    -24279, -24346, -24413, -24480, -24547, -24613, -24680, -24746, -24811, -24877, -24942, -25007, -25072, -25137, -25201, -25265,
+    -25329, -25393, -25456, -25519, -25582, -25645, -25708, -25770, -25832, -25893, -25955, -26016, -26077, -26138, -26198, -26259,
+    -26319, -26378, -26438, -26497, -26556, -26615, -26674, -26732, -26790, -26848, -26905, -26962, -27019, -27076, -27133, -27189,
+    -27245, -27300, -27356, -27411, -27466, -27521, -27575, -27629, -27683, -27737, -27790, -27843, -27896, -27949, -28001, -28053,
+    -28105, -28157, -28208, -28259, -28310, -28360, -28411, -28460, -28510, -28560, -28609, -28658, -28706, -28755, -28803, -28850,
+    -28898, -28945, -28992, -29039, -29085, -29131, -29177, -29223, -29268, -29313, -29358, -29403, -29447, -29491, -29534, -29578,
+    -29621, -29664, -29706, -29749, -29791, -29832, -29874, -29915, -29956, -29997, -30037, -30077, -30117, -30156, -30195, -30234,
+    -30273, -30311, -30349, -30387, -30424, -30462, -30498, -30535, -30571, -30607, -30643, -30679, -30714, -30749, -30783, -30818,
+    -30852, -30885, -30919, -30952, -30985, -31017, -31050, -31082, -31113, -31145, -31176, -31206, -31237, -31267, -31297, -31327,
+    -31356, -31385, -31414, -31442, -31470, -31498, -31526, -31553, -31580, -31607, -31633, -31659, -31685, -31710, -31736, -31760,
+    -31785, -31809, -31833, -31857, -31880, -31903, -31926, -31949, -31971, -31993, -32014, -32036, -32057, -32077, -32098, -32118,
+    -32137, -32157, -32176, -32195, -32213, -32232, -32250, -32267, -32285, -32302, -32318, -32335, -32351, -32367, -32382, -32397,
+    -32412, -32427, -32441, -32455, -32469, -32482, -32495, -32508, -32521, -32533, -32545, -32556, -32567, -32578, -32589, -32599,
+    -32609, -32619, -32628, -32637, -32646, -32655, -32663, -32671, -32678, -32685, -32692, -32699, -32705, -32711, -32717, -32722,
+    -32728, -32732, -32737, -32741, -32745, -32748, -32752, -32755, -32757, -32759, -32761, -32763, -32765, -32766, -32766, -32767,
+    -32767, -32767, -32766, -32766, -32765, -32763, -32761, -32759, -32757, -32755, -32752, -32748, -32745, -32741, -32737, -32732,
+    -32728, -32722, -32717, -32711, -32705, -32699, -32692, -32685, -32678, -32671, -32663, -32655, -32646, -32637, -32628, -32619,
+    -32609, -32599, -32589, -32578, -32567, -32556, -32545, -32533, -32521, -32508, -32495, -32482, -32469, -32455, -32441, -32427,
+    -32412, -32397, -32382, -32367, -32351, -32335, -32318, -32302, -32285, -32267, -32250, -32232, -32213, -32195, -32176, -32157,
+    -32137, -32118, -32098, -32077, -32057, -32036, -32014, -31993, -31971, -31949, -31926, -31903, -31880, -31857, -31833, -31809,
+    -31785, -31760, -31736, -31710, -31685, -31659, -31633, -31607, -31580, -31553, -31526, -31498, -31470, -31442, -31414, -31385,
+    -31356, -31327, -31297, -31267, -31237, -31206, -31176, -31145, -31113, -31082, -31050, -31017, -30985, -30952, -30919, -30885,
+    -30852, -30818, -30783, -30749, -30714, -30679, -30643, -30607, -30571, -30535, -30498, -30462, -30424, -30387, -30349, -30311,
+    -30273, -30234, -30195, -30156, -30117, -30077, -30037, -29997, -29956, -29915, -29874, -29832, -29791, -29749, -29706, -29664,
+    -29621, -29578, -29534, -29491, -29447, -29403, -29358, -29313, -29268, -29223, -29177, -29131, -29085, -29039, -28992, -28945,
+    -28898, -28850, -28803, -28755, -28706, -28658, -28609, -28560, -28510, -28460, -28411, -28360, -28310, -28259, -28208, -28157,
+    -28105, -28053, -28001, -27949, -27896, -27843, -27790, -27737, -27683, -27629, -27575, -27521, -27466, -27411, -27356, -27300,
+    -27245, -27189, -27133, -27076, -27019, -26962, -26905, -26848, -26790, -26732, -26674, -26615, -26556, -26497, -26438, -26378,
+    -26319, -26259, -26198, -26138, -26077, -26016, -25955, -25893, -25832, -25770, -25708, -25645, -25582, -25519, -25456, -25393,
+    -25329, -25265, -25201, -25137, -25072, -25007, -24942, -24877, -24811, -24746, -24680, -24613, -24547, -24480, -24413, -24346,
+    -24279, -24211, -24143, -24075, -24007, -23938, -23870, -23801, -23731, -23662, -23592, -23522, -23452, -23382, -23311, -23241,
+    -23170, -23099, -23027, -22956, -22884, -22812, -22739, -22667, -22594, -22521, -22448, -22375, -22301, -22227, -22154, -22079,
+    -22005, -21930, -21856, -21781, -21705, -21630, -21554, -21479, -21403, -21326, -21250, -21173, -21096, -21019, -20942, -20865,
+    -20787, -20709, -20631, -20553, -20475, -20396, -20317, -20238, -20159, -20080, -20000, -19921, -19841, -19761, -19680, -19600,
+    -19519, -19438, -19357, -19276, -19195, -19113, -19032, -18950, -18868, -18785, -18703, -18620, -18537, -18454, -18371, -18288,
+    -18204, -18121, -18037, -17953, -17869, -17784, -17700, -17615, -17530, -17445, -17360, -17275, -17189, -17104, -17018, -16932,
+    -16846, -16759, -16673, -16586, -16499, -16413, -16325, -16238, -16151, -16063, -15976, -15888, -15800, -15712, -15623, -15535,
+    -15446, -15358, -15269, -15180, -15090, -15001, -14912, -14822, -14732, -14643, -14553, -14462, -14372, -14282, -14191, -14101,
+    -14010, -13919, -13828, -13736, -13645, -13554, -13462, -13370, -13279, -13187, -13094, -13002, -12910, -12817, -12725, -12632,
+    -12539, -12446, -12353, -12260, -12167, -12074, -11980, -11886, -11793, -11699, -11605, -11511, -11417, -11322, -11228, -11133,
+    -11039, -10944, -10849, -10754, -10659, -10564, -10469, -10374, -10278, -10183, -10087,  -9992,  -9896,  -9800,  -9704,  -9608,
+     -9512,  -9416,  -9319,  -9223,  -9126,  -9030,  -8933,  -8836,  -8739,  -8642,  -8545,  -8448,  -8351,  -8254,  -8157,  -8059,
+     -7962,  -7864,  -7767,  -7669,  -7571,  -7473,  -7375,  -7277,  -7179,  -7081,  -6983,  -6885,  -6786,  -6688,  -6590,  -6491,
+     -6393,  -6294,  -6195,  -6096,  -5998,  -5899,  -5800,  -5701,  -5602,  -5503,  -5404,  -5305,  -5205,  -5106,  -5007,  -4907,
+     -4808,  -4708,  -4609,  -4509,  -4410,  -4310,  -4210,  -4111,  -4011,  -3911,  -3811,  -3712,  -3612,  -3512,  -3412,  -3312,
+     -3212,  -3112,  -3012,  -2911,  -2811,  -2711,  -2611,  -2511,  -2410,  -2310,  -2210,  -2110,  -2009,  -1909,  -1809,  -1708,
+     -1608,  -1507,  -1407,  -1307,  -1206,  -1106,  -1005,   -905,   -804,   -704,   -603,   -503,   -402,   -302,   -201,   -101,
+    
+    // Level 1: 1024 samples, 511 harmonics
+         0,    201,    402,    603,    804,   1005,   1206,   1407,   1608,   1809,   2009,   2210,   2410,   2611,   2811,   3012,
+      3212,   3412,   3612,   3811,   4011,   4210,   4410,   4609,   4808,   5007,   5205,   5404,   5602,   5800,   5998,   6195,
+      6393,   6590,   6786,   6983,   7179,   7375,   7571,   7767,   7962,   8157,   8351,   8545,   8739,   8933,   9126,   9319,
+      9512,   9704,   9896,  10087,  10278,  10469,  10659,  10849,  11039,  11228,  11417,  11605,  11793,  11980,  12167,  12353,
+     12539,  12725,  12910,  13094,  13279,  13462,  13645,  13828,  14010,  14191,  14372,  14553,  14732,  14912,  15090,  15269,
+     15446,  15623,  15800,  15976,  16151,  16325,  16499,  16673,  16846,  17018,  17189,  17360,  17530,  17700,  17869,  18037,
+     18204,  18371,  18537,  18703,  18868,  19032,  19195,  19357,  19519,  19680,  19841,  20000,  20159,  20317,  20475,  20631,
+     20787,  20942,  21096,  21250,  21403,  21554,  21705,  21856,  22005,  22154,  22301,  22448,  22594,  22739,  22884,  23027,
+     23170,  23311,  23452,  23592,  23731,  23870,  24007,  24143,  24279,  24413,  24547,  24680,  24811,  24942,  25072,  25201,
+     25329,  25456,  25582,  25708,  25832,  25955,  26077,  26198,  26319,  26438,  26556,  26674,  26790,  26905,  27019,  27133,
+     27245,  27356,  27466,  27575,  27683,  27790,  27896,  28001,  28105,  28208,  28310,  28411,  28510,  28609,  28706,  28803,
+     28898,  28992,  29085,  29177,  29268,  29358,  29447,  29534,  29621,  29706,  29791,  29874,  29956,  30037,  30117,  30195,
+     30273,  30349,  30424,  30498,  30571,  30643,  30714,  30783,  30852,  30919,  30985,  31050,  31113,  31176,  31237,  31297,
+     31356,  31414,  31470,  31526,  31580,  31633,  31685,  31736,  31785,  31833,  31880,  31926,  31971,  32014,  32057,  32098,
+     32137,  32176,  32213,  32250,  32285,  32318,  32351,  32382,  32412,  32441,  32469,  32495,  32521,  32545,  32567,  32589,
+     32609,  32628,  32646,  32663,  32678,  32692,  32705,  32717,  32728,  32737,  32745,  32752,  32757,  32761,  32765,  32766,
+     32767,  32766,  32765,  32761,  32757,  32752,  32745,  32737,  32728,  32717,  32705,  32692,  32678,  32663,  32646,  32628,
+     32609,  32589,  32567,  32545,  32521,  32495,  32469,  32441,  32412,  32382,  32351,  32318,  32285,  32250,  32213,  32176,
+     32137,  32098,  32057,  32014,  31971,  31926,  31880,  31833,  31785,  31736,  31685,  31633,  31580,  31526,  31470,  31414,
+     31356,  31297,  31237,  31176,  31113,  31050,  30985,  30919,  30852,  30783,  30714,  30643,  30571,  30498,  30424,  30349,
+     30273,  30195,  30117,  30037,  29956,  29874,  29791,  29706,  29621,  29534,  29447,  29358,  29268,  29177,  29085,  28992,
+     28898,  28803,  28706,  28609,  28510,  28411,  28310,  28208,  28105,  28001,  27896,  27790,  27683,  27575,  27466,  27356,
+     27245,  27133,  27019,  26905,  26790,  26674,  26556,  26438,  26319,  26198,  26077,  25955,  25832,  25708,  25582,  25456,
+     25329,  25201,  25072,  24942,  24811,  24680,  24547,  24413,  24279,  24143,  24007,  23870,  23731,  23592,  23452,  23311,
+     23170,  23027,  22884,  22739,  22594,  22448,  22301,  22154,  22005,  21856,  21705,  21554,  21403,  21250,  21096,  20942,
+     20787,  20631,  20475,  20317,  20159,  20000,  19841,  19680,  19519,  19357,  19195,  19032,  18868,  18703,  18537,  18371,
+     18204,  18037,  17869,  17700,  17530,  17360,  17189,  17018,  16846,  16673,  16499,  16325,  16151,  15976,  15800,  15623,
+     15446,  15269,  15090,  14912,  14732,  14553,  14372,  14191,  14010,  13828,  13645,  13462,  13279,  13094,  12910,  12725,
+     12539,  12353,  12167,  11980,  11793,  11605,  11417,  11228,  11039,  10849,  10659,  10469,  10278,  10087,   9896,   9704,
+      9512,   9319,   9126,   8933,   8739,   8545,   8351,   8157,   7962,   7767,   7571,   7375,   7179,   6983,   6786,   6590,
+      6393,   6195,   5998,   5800,   5602,   5404,   5205,   5007,   4808,   4609,   4410,   4210,   4011,   3811,   3612,   3412,
+      3212,   3012,   2811,   2611,   2410,   2210,   2009,   1809,   1608,   1407,   1206,   1005,    804,    603,    402,    201,
+         0,   -201,   -402,   -603,   -804,  -1005,  -1206,  -1407,  -1608,  -1809,  -2009,  -2210,  -2410,  -2611,  -2811,  -3012,
+     -3212,  -3412,  -3612,  -3811,  -4011,  -4210,  -4410,  -4609,  -4808,  -5007,  -5205,  -5404,  -5602,  -5800,  -5998,  -6195,
+     -6393,  -6590,  -6786,  -6983,  -7179,  -7375,  -7571,  -7767,  -7962,  -8157,  -8351,  -8545,  -8739,  -8933,  -9126,  -9319,
+     -9512,  -9704,  -9896, -10087, -10278, -10469, -10659, -10849, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+    -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828, -14010, -14191, -14372, -14553, -14732, -14912, -15090, -15269,
+    -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673, -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037,
+    -18204, -18371, -18537, -18703, -18868, -19032, -19195, -19357, -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631,
+    -20787, -20942, -21096, -21250, -21403, -21554, -21705, -21856, -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027,
+    -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143, -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201,
+    -25329, -25456, -25582, -25708, -25832, -25955, -26077, -26198, -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+    -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001, -28105, -28208, -28310, -28411, -28510, -28609, -28706, -28803,
+    -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534, -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195,
+    -30273, -30349, -30424, -30498, -30571, -30643, -30714, -30783, -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+    -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736, -31785, -31833, -31880, -31926, -31971, -32014, -32057, -32098,
+    -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382, -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589,
+    -32609, -32628, -32646, -32663, -32678, -32692, -32705, -32717, -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766,
+    -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737, -32728, -32717, -32705, -32692, -32678, -32663, -32646, -32628,
+    -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441, -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176,
+    -32137, -32098, -32057, -32014, -31971, -31926, -31880, -31833, -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+    -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919, -30852, -30783, -30714, -30643, -30571, -30498, -30424, -30349,
+    -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706, -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992,
+    -28898, -28803, -28706, -28609, -28510, -28411, -28310, -28208, -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356,
+    -27245, -27133, -27019, -26905, -26790, -26674, -26556, -26438, -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456,
+    -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413, -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311,
+    -23170, -23027, -22884, -22739, -22594, -22448, -22301, -22154, -22005, -21856, -21705, -21554, -21403, -21250, -21096, -20942,
+    -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680, -19519, -19357, -19195, -19032, -18868, -18703, -18537, -18371,
+    -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018, -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623,
+    -15446, -15269, -15090, -14912, -14732, -14553, -14372, -14191, -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+    -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228, -11039, -10849, -10659, -10469, -10278, -10087,  -9896,  -9704,
+     -9512,  -9319,  -9126,  -8933,  -8739,  -8545,  -8351,  -8157,  -7962,  -7767,  -7571,  -7375,  -7179,  -6983,  -6786,  -6590,
+     -6393,  -6195,  -5998,  -5800,  -5602,  -5404,  -5205,  -5007,  -4808,  -4609,  -4410,  -4210,  -4011,  -3811,  -3612,  -3412,
+     -3212,  -3012,  -2811,  -2611,  -2410,  -2210,  -2009,  -1809,  -1608,  -1407,  -1206,  -1005,   -804,   -603,   -402,   -201,
+    
+    // Level 2: 512 samples, 255 harmonics
+         0,    402,    804,   1206,   1608,   2009,   2410,   2811,   3212,   3612,   4011,   4410,   4808,   5205,   5602,   5998,
+      6393,   6786,   7179,   7571,   7962,   8351,   8739,   9126,   9512,   9896,  10278,  10659,  11039,  11417,  11793,  12167,
+     12539,  12910,  13279,  13645,  14010,  14372,  14732,  15090,  15446,  15800,  16151,  16499,  16846,  17189,  17530,  17869,
+     18204,  18537,  18868,  19195,  19519,  19841,  20159,  20475,  20787,  21096,  21403,  21705,  22005,  22301,  22594,  22884,
+     23170,  23452,  23731,  24007,  24279,  24547,  24811,  25072,  25329,  25582,  25832,  26077,  26319,  26556,  26790,  27019,
+     27245,  27466,  27683,  27896,  28105,  28310,  28510,  28706,  28898,  29085,  29268,  29447,  29621,  29791,  29956,  30117,
+     30273,  30424,  30571,  30714,  30852,  30985,  31113,  31237,  31356,  31470,  31580,  31685,  31785,  31880,  31971,  32057,
+     32137,  32213,  32285,  32351,  32412,  32469,  32521,  32567,  32609,  32646,  32678,  32705,  32728,  32745,  32757,  32765,
+     32767,  32765,  32757,  32745,  32728,  32705,  32678,  32646,  32609,  32567,  32521,  32469,  32412,  32351,  32285,  32213,
+     32137,  32057,  31971,  31880,  31785,  31685,  31580,  31470,  31356,  31237,  31113,  30985,  30852,  30714,  30571,  30424,
+     30273,  30117,  29956,  29791,  29621,  29447,  29268,  29085,  28898,  28706,  28510,  28310,  28105,  27896,  27683,  27466,
+     27245,  27019,  26790,  26556,  26319,  26077,  25832,  25582,  25329,  25072,  24811,  24547,  24279,  24007,  23731,  23452,
+     23170,  22884,  22594,  22301,  22005,  21705,  21403,  21096,  20787,  20475,  20159,  19841,  19519,  19195,  18868,  18537,
+     18204,  17869,  17530,  17189,  16846,  16499,  16151,  15800,  15446,  15090,  14732,  14372,  14010,  13645,  13279,  12910,
+     12539,  12167,  11793,  11417,  11039,  10659,  10278,   9896,   9512,   9126,   8739,   8351,   7962,   7571,   7179,   6786,
+      6393,   5998,   5602,   5205,   4808,   4410,   4011,   3612,   3212,   2811,   2410,   2009,   1608,   1206,    804,    402,
+         0,   -402,   -804,  -1206,  -1608,  -2009,  -2410,  -2811,  -3212,  -3612,  -4011,  -4410,  -4808,  -5205,  -5602,  -5998,
+     -6393,  -6786,  -7179,  -7571,  -7962,  -8351,  -8739,  -9126,  -9512,  -9896, -10278, -10659, -11039, -11417, -11793, -12167,
+    -12539, -12910, -13279, -13645, -14010, -14372, -14732, -15090, -15446, -15800, -16151, -16499, -16846, -17189, -17530, -17869,
+    -18204, -18537, -18868, -19195, -19519, -19841, -20159, -20475, -20787, -21096, -21403, -21705, -22005, -22301, -22594, -22884,
+    -23170, -23452, -23731, -24007, -24279, -24547, -24811, -25072, -25329, -25582, -25832, -26077, -26319, -26556, -26790, -27019,
+    -27245, -27466, -27683, -27896, -28105, -28310, -28510, -28706, -28898, -29085, -29268, -29447, -29621, -29791, -29956, -30117,
+    -30273, -30424, -30571, -30714, -30852, -30985, -31113, -31237, -31356, -31470, -31580, -31685, -31785, -31880, -31971, -32057,
+    -32137, -32213, -32285, -32351, -32412, -32469, -32521, -32567, -32609, -32646, -32678, -32705, -32728, -32745, -32757, -32765,
+    -32767, -32765, -32757, -32745, -32728, -32705, -32678, -32646, -32609, -32567, -32521, -32469, -32412, -32351, -32285, -32213,
+    -32137, -32057, -31971, -31880, -31785, -31685, -31580, -31470, -31356, -31237, -31113, -30985, -30852, -30714, -30571, -30424,
+    -30273, -30117, -29956, -29791, -29621, -29447, -29268, -29085, -28898, -28706, -28510, -28310, -28105, -27896, -27683, -27466,
+    -27245, -27019, -26790, -26556, -26319, -26077, -25832, -25582, -25329, -25072, -24811, -24547, -24279, -24007, -23731, -23452,
+    -23170, -22884, -22594, -22301, -22005, -21705, -21403, -21096, -20787, -20475, -20159, -19841, -19519, -19195, -18868, -18537,
+    -18204, -17869, -17530, -17189, -16846, -16499, -16151, -15800, -15446, -15090, -14732, -14372, -14010, -13645, -13279, -12910,
+    -12539, -12167, -11793, -11417, -11039, -10659, -10278,  -9896,  -9512,  -9126,  -8739,  -8351,  -7962,  -7571,  -7179,  -6786,
+     -6393,  -5998,  -5602,  -5205,  -4808,  -4410,  -4011,  -3612,  -3212,  -2811,  -2410,  -2009,  -1608,  -1206,   -804,   -402,
+    
+    // Level 3: 256 samples, 127 harmonics
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,  18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,  32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,   6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+    
+    // Level 4: 128 samples, 63 harmonics
+         0,   1608,   3212,   4808,   6393,   7962,   9512,  11039,  12539,  14010,  15446,  16846,  18204,  19519,  20787,  22005,
+     23170,  24279,  25329,  26319,  27245,  28105,  28898,  29621,  30273,  30852,  31356,  31785,  32137,  32412,  32609,  32728,
+     32767,  32728,  32609,  32412,  32137,  31785,  31356,  30852,  30273,  29621,  28898,  28105,  27245,  26319,  25329,  24279,
+     23170,  22005,  20787,  19519,  18204,  16846,  15446,  14010,  12539,  11039,   9512,   7962,   6393,   4808,   3212,   1608,
+         0,  -1608,  -3212,  -4808,  -6393,  -7962,  -9512, -11039, -12539, -14010, -15446, -16846, -18204, -19519, -20787, -22005,
+    -23170, -24279, -25329, -26319, -27245, -28105, -28898, -29621, -30273, -30852, -31356, -31785, -32137, -32412, -32609, -32728,
+    -32767, -32728, -32609, -32412, -32137, -31785, -31356, -30852, -30273, -29621, -28898, -28105, -27245, -26319, -25329, -24279,
+    -23170, -22005, -20787, -19519, -18204, -16846, -15446, -14010, -12539, -11039,  -9512,  -7962,  -6393,  -4808,  -3212,  -1608,
+    
+    // Level 5: 64 samples, 31 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
+    
+    // Level 6: 64 samples, 16 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
+    
+    // Level 7: 64 samples, 8 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
+    
+    // Level 8: 64 samples, 4 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
+    
+    // Level 9: 64 samples, 2 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
+    
+    // Level 10: 64 samples, 1 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
     
 };
 
-alignas(4) const float waveform_Saw[4096] = {
-    0.00000000f, 0.02472141f, 0.04942566f, 0.07409562f, 0.09871418f, 0.12326433f, 0.14772912f, 0.17209169f,
-    0.19633534f, 0.22044349f, 0.24439973f, 0.26818786f, 0.29179184f, 0.31519590f, 0.33838449f, 0.36134233f,
-    0.38405441f, 0.40650603f, 0.42868281f, 0.45057069f, 0.47215598f, 0.49342533f, 0.51436580f, 0.53496482f,
-    0.55521025f, 0.57509036f, 0.59459388f, 0.61370996f, 0.63242824f, 0.65073881f, 0.66863227f, 0.68609969f,
-    0.70313266f, 0.71972327f, 0.73586413f, 0.75154839f, 0.76676971f, 0.78152232f, 0.79580095f, 0.80960091f,
-    0.82291804f, 0.83574876f, 0.84809000f, 0.85993929f, 0.87129468f, 0.88215479f, 0.89251879f, 0.90238640f,
-    0.91175789f, 0.92063406f, 0.92901626f, 0.93690638f, 0.94430682f, 0.95122052f, 0.95765091f, 0.96360196f,
-    0.96907810f, 0.97408426f, 0.97862587f, 0.98270880f, 0.98633938f, 0.98952438f, 0.99227103f, 0.99458694f,
-    0.99648015f, 0.99795908f, 0.99903254f, 0.99970967f, 1.00000000f, 0.99991336f, 0.99945990f, 0.99865008f,
-    0.99749462f, 0.99600453f, 0.99419106f, 0.99206567f, 0.98964005f, 0.98692608f, 0.98393582f, 0.98068147f,
-    0.97717540f, 0.97343008f, 0.96945807f, 0.96527204f, 0.96088471f, 0.95630885f, 0.95155726f, 0.94664275f,
-    0.94157812f, 0.93637614f, 0.93104955f, 0.92561101f, 0.92007311f, 0.91444836f, 0.90874912f, 0.90298766f,
-    0.89717608f, 0.89132633f, 0.88545018f, 0.87955920f, 0.87366476f, 0.86777802f, 0.86190989f, 0.85607103f,
-    0.85027187f, 0.84452252f, 0.83883285f, 0.83321240f, 0.82767042f, 0.82221585f, 0.81685729f, 0.81160301f,
-    0.80646094f, 0.80143865f, 0.79654337f, 0.79178195f, 0.78716087f, 0.78268625f, 0.77836382f, 0.77419891f,
-    0.77019649f, 0.76636114f, 0.76269702f, 0.75920792f, 0.75589724f, 0.75276798f, 0.74982273f, 0.74706373f,
-    0.74449278f, 0.74211133f, 0.73992044f, 0.73792077f, 0.73611263f, 0.73449594f, 0.73307025f, 0.73183478f,
-    0.73078836f, 0.72992950f, 0.72925636f, 0.72876676f, 0.72845822f, 0.72832793f, 0.72837277f, 0.72858934f,
-    0.72897394f, 0.72952263f, 0.73023116f, 0.73109505f, 0.73210959f, 0.73326982f, 0.73457059f, 0.73600651f,
-    0.73757202f, 0.73926139f, 0.74106870f, 0.74298789f, 0.74501276f, 0.74713698f, 0.74935411f, 0.75165760f,
-    0.75404082f, 0.75649708f, 0.75901960f, 0.76160157f, 0.76423615f, 0.76691649f, 0.76963570f, 0.77238692f,
-    0.77516331f, 0.77795806f, 0.78076439f, 0.78357559f, 0.78638502f, 0.78918611f, 0.79197239f, 0.79473748f,
-    0.79747515f, 0.80017924f, 0.80284378f, 0.80546290f, 0.80803092f, 0.81054229f, 0.81299166f, 0.81537386f,
-    0.81768388f, 0.81991694f, 0.82206845f, 0.82413402f, 0.82610950f, 0.82799094f, 0.82977463f, 0.83145710f,
-    0.83303508f, 0.83450559f, 0.83586586f, 0.83711338f, 0.83824589f, 0.83926137f, 0.84015806f, 0.84093446f,
-    0.84158931f, 0.84212161f, 0.84253063f, 0.84281585f, 0.84297706f, 0.84301424f, 0.84292765f, 0.84271780f,
-    0.84238541f, 0.84193146f, 0.84135716f, 0.84066394f, 0.83985346f, 0.83892761f, 0.83788846f, 0.83673831f,
-    0.83547966f, 0.83411521f, 0.83264781f, 0.83108053f, 0.82941660f, 0.82765941f, 0.82581249f, 0.82387955f,
-    0.82186442f, 0.81977106f, 0.81760355f, 0.81536610f, 0.81306299f, 0.81069864f, 0.80827750f, 0.80580414f,
-    0.80328318f, 0.80071929f, 0.79811718f, 0.79548163f, 0.79281740f, 0.79012931f, 0.78742216f, 0.78470076f,
-    0.78196991f, 0.77923437f, 0.77649891f, 0.77376821f, 0.77104695f, 0.76833973f, 0.76565107f, 0.76298545f,
-    0.76034724f, 0.75774075f, 0.75517015f, 0.75263955f, 0.75015291f, 0.74771409f, 0.74532683f, 0.74299471f,
-    0.74072122f, 0.73850964f, 0.73636316f, 0.73428478f, 0.73227736f, 0.73034358f, 0.72848595f, 0.72670683f,
-    0.72500838f, 0.72339261f, 0.72186131f, 0.72041612f, 0.71905848f, 0.71778964f, 0.71661068f, 0.71552248f,
-    0.71452573f, 0.71362092f, 0.71280837f, 0.71208821f, 0.71146038f, 0.71092463f, 0.71048052f, 0.71012745f,
-    0.70986463f, 0.70969109f, 0.70960568f, 0.70960710f, 0.70969388f, 0.70986438f, 0.71011679f, 0.71044918f,
-    0.71085945f, 0.71134537f, 0.71190455f, 0.71253449f, 0.71323257f, 0.71399602f, 0.71482198f, 0.71570748f,
-    0.71664945f, 0.71764472f, 0.71869005f, 0.71978209f, 0.72091745f, 0.72209265f, 0.72330417f, 0.72454843f,
-    0.72582181f, 0.72712066f, 0.72844128f, 0.72977999f, 0.73113306f, 0.73249677f, 0.73386739f, 0.73524123f,
-    0.73661459f, 0.73798379f, 0.73934520f, 0.74069523f, 0.74203031f, 0.74334694f, 0.74464169f, 0.74591118f,
-    0.74715209f, 0.74836121f, 0.74953539f, 0.75067158f, 0.75176681f, 0.75281824f, 0.75382310f, 0.75477876f,
-    0.75568269f, 0.75653249f, 0.75732586f, 0.75806067f, 0.75873488f, 0.75934660f, 0.75989409f, 0.76037572f,
-    0.76079004f, 0.76113572f, 0.76141157f, 0.76161658f, 0.76174985f, 0.76181066f, 0.76179844f, 0.76171274f,
-    0.76155330f, 0.76131999f, 0.76101283f, 0.76063199f, 0.76017780f, 0.75965073f, 0.75905138f, 0.75838051f,
-    0.75763903f, 0.75682795f, 0.75594846f, 0.75500185f, 0.75398956f, 0.75291314f, 0.75177426f, 0.75057473f,
-    0.74931645f, 0.74800143f, 0.74663180f, 0.74520977f, 0.74373765f, 0.74221786f, 0.74065288f, 0.73904527f,
-    0.73739766f, 0.73571277f, 0.73399336f, 0.73224225f, 0.73046231f, 0.72865646f, 0.72682764f, 0.72497885f,
-    0.72311307f, 0.72123336f, 0.71934273f, 0.71744425f, 0.71554095f, 0.71363587f, 0.71173204f, 0.70983248f,
-    0.70794017f, 0.70605806f, 0.70418908f, 0.70233610f, 0.70050197f, 0.69868945f, 0.69690128f, 0.69514010f,
-    0.69340852f, 0.69170906f, 0.69004414f, 0.68841614f, 0.68682733f, 0.68527988f, 0.68377589f, 0.68231734f,
-    0.68090612f, 0.67954402f, 0.67823271f, 0.67697375f, 0.67576858f, 0.67461855f, 0.67352487f, 0.67248863f,
-    0.67151081f, 0.67059225f, 0.66973368f, 0.66893569f, 0.66819878f, 0.66752327f, 0.66690941f, 0.66635727f,
-    0.66586683f, 0.66543793f, 0.66507030f, 0.66476353f, 0.66451711f, 0.66433037f, 0.66420257f, 0.66413282f,
-    0.66412013f, 0.66416340f, 0.66426141f, 0.66441285f, 0.66461629f, 0.66487022f, 0.66517301f, 0.66552297f,
-    0.66591829f, 0.66635710f, 0.66683743f, 0.66735725f, 0.66791445f, 0.66850687f, 0.66913225f, 0.66978832f,
-    0.67047273f, 0.67118308f, 0.67191694f, 0.67267183f, 0.67344526f, 0.67423470f, 0.67503759f, 0.67585136f,
-    0.67667343f, 0.67750122f, 0.67833215f, 0.67916363f, 0.67999309f, 0.68081797f, 0.68163574f, 0.68244389f,
-    0.68323993f, 0.68402142f, 0.68478596f, 0.68553118f, 0.68625477f, 0.68695447f, 0.68762809f, 0.68827348f,
-    0.68888856f, 0.68947135f, 0.69001990f, 0.69053238f, 0.69100700f, 0.69144209f, 0.69183604f, 0.69218735f,
-    0.69249460f, 0.69275647f, 0.69297174f, 0.69313929f, 0.69325809f, 0.69332723f, 0.69334589f, 0.69331337f,
-    0.69322907f, 0.69309249f, 0.69290324f, 0.69266106f, 0.69236578f, 0.69201733f, 0.69161576f, 0.69116124f,
-    0.69065403f, 0.69009451f, 0.68948313f, 0.68882049f, 0.68810727f, 0.68734425f, 0.68653230f, 0.68567242f,
-    0.68476565f, 0.68381317f, 0.68281623f, 0.68177616f, 0.68069438f, 0.67957239f, 0.67841176f, 0.67721413f,
-    0.67598123f, 0.67471483f, 0.67341678f, 0.67208898f, 0.67073337f, 0.66935196f, 0.66794680f, 0.66651998f,
-    0.66507362f, 0.66360988f, 0.66213094f, 0.66063901f, 0.65913631f, 0.65762508f, 0.65610757f, 0.65458604f,
-    0.65306273f, 0.65153989f, 0.65001976f, 0.64850457f, 0.64699652f, 0.64549780f, 0.64401057f, 0.64253694f,
-    0.64107902f, 0.63963885f, 0.63821845f, 0.63681977f, 0.63544472f, 0.63409516f, 0.63277289f, 0.63147963f,
-    0.63021706f, 0.62898678f, 0.62779032f, 0.62662913f, 0.62550459f, 0.62441801f, 0.62337059f, 0.62236347f,
-    0.62139770f, 0.62047424f, 0.61959395f, 0.61875762f, 0.61796594f, 0.61721949f, 0.61651877f, 0.61586420f,
-    0.61525608f, 0.61469462f, 0.61417994f, 0.61371207f, 0.61329092f, 0.61291634f, 0.61258805f, 0.61230571f,
-    0.61206887f, 0.61187698f, 0.61172942f, 0.61162546f, 0.61156432f, 0.61154509f, 0.61156680f, 0.61162842f,
-    0.61172880f, 0.61186674f, 0.61204098f, 0.61225015f, 0.61249285f, 0.61276760f, 0.61307287f, 0.61340705f,
-    0.61376851f, 0.61415555f, 0.61456641f, 0.61499931f, 0.61545243f, 0.61592390f, 0.61641183f, 0.61691430f,
-    0.61742936f, 0.61795505f, 0.61848939f, 0.61903039f, 0.61957606f, 0.62012438f, 0.62067337f, 0.62122102f,
-    0.62176535f, 0.62230438f, 0.62283617f, 0.62335877f, 0.62387028f, 0.62436881f, 0.62485251f, 0.62531958f,
-    0.62576822f, 0.62619672f, 0.62660339f, 0.62698660f, 0.62734475f, 0.62767634f, 0.62797988f, 0.62825397f,
-    0.62849727f, 0.62870851f, 0.62888649f, 0.62903005f, 0.62913816f, 0.62920981f, 0.62924411f, 0.62924023f,
-    0.62919741f, 0.62911499f, 0.62899239f, 0.62882910f, 0.62862471f, 0.62837889f, 0.62809139f, 0.62776205f,
-    0.62739079f, 0.62697764f, 0.62652268f, 0.62602610f, 0.62548817f, 0.62490922f, 0.62428971f, 0.62363013f,
-    0.62293108f, 0.62219323f, 0.62141734f, 0.62060423f, 0.61975480f, 0.61887001f, 0.61795091f, 0.61699861f,
-    0.61601426f, 0.61499911f, 0.61395445f, 0.61288162f, 0.61178203f, 0.61065713f, 0.60950842f, 0.60833745f,
-    0.60714579f, 0.60593508f, 0.60470696f, 0.60346313f, 0.60220530f, 0.60093521f, 0.59965463f, 0.59836532f,
-    0.59706907f, 0.59576768f, 0.59446296f, 0.59315671f, 0.59185073f, 0.59054682f, 0.58924677f, 0.58795235f,
-    0.58666532f, 0.58538743f, 0.58412038f, 0.58286587f, 0.58162555f, 0.58040105f, 0.57919396f, 0.57800583f,
-    0.57683816f, 0.57569241f, 0.57457000f, 0.57347228f, 0.57240056f, 0.57135610f, 0.57034007f, 0.56935361f,
-    0.56839779f, 0.56747361f, 0.56658199f, 0.56572381f, 0.56489986f, 0.56411086f, 0.56335746f, 0.56264023f,
-    0.56195968f, 0.56131623f, 0.56071022f, 0.56014192f, 0.55961153f, 0.55911916f, 0.55866484f, 0.55824853f,
-    0.55787012f, 0.55752940f, 0.55722611f, 0.55695990f, 0.55673034f, 0.55653693f, 0.55637912f, 0.55625625f,
-    0.55616762f, 0.55611245f, 0.55608990f, 0.55609906f, 0.55613895f, 0.55620855f, 0.55630677f, 0.55643246f,
-    0.55658442f, 0.55676141f, 0.55696213f, 0.55718523f, 0.55742935f, 0.55769304f, 0.55797485f, 0.55827330f,
-    0.55858685f, 0.55891396f, 0.55925305f, 0.55960252f, 0.55996078f, 0.56032618f, 0.56069710f, 0.56107189f,
-    0.56144891f, 0.56182650f, 0.56220303f, 0.56257684f, 0.56294632f, 0.56330985f, 0.56366583f, 0.56401268f,
-    0.56434883f, 0.56467276f, 0.56498296f, 0.56527796f, 0.56555632f, 0.56581664f, 0.56605756f, 0.56627776f,
-    0.56647597f, 0.56665097f, 0.56680159f, 0.56692669f, 0.56702522f, 0.56709616f, 0.56713857f, 0.56715155f,
-    0.56713427f, 0.56708597f, 0.56700596f, 0.56689359f, 0.56674830f, 0.56656959f, 0.56635703f, 0.56611028f,
-    0.56582903f, 0.56551308f, 0.56516227f, 0.56477654f, 0.56435588f, 0.56390037f, 0.56341013f, 0.56288539f,
-    0.56232643f, 0.56173358f, 0.56110728f, 0.56044800f, 0.55975630f, 0.55903280f, 0.55827817f, 0.55749316f,
-    0.55667857f, 0.55583526f, 0.55496415f, 0.55406620f, 0.55314246f, 0.55219398f, 0.55122190f, 0.55022737f,
-    0.54921163f, 0.54817591f, 0.54712150f, 0.54604974f, 0.54496199f, 0.54385962f, 0.54274406f, 0.54161674f,
-    0.54047912f, 0.53933268f, 0.53817891f, 0.53701932f, 0.53585541f, 0.53468871f, 0.53352073f, 0.53235300f,
-    0.53118702f, 0.53002432f, 0.52886638f, 0.52771469f, 0.52657072f, 0.52543593f, 0.52431173f, 0.52319954f,
-    0.52210074f, 0.52101666f, 0.51994862f, 0.51889791f, 0.51786575f, 0.51685335f, 0.51586186f, 0.51489240f,
-    0.51394603f, 0.51302376f, 0.51212656f, 0.51125534f, 0.51041095f, 0.50959419f, 0.50880580f, 0.50804646f,
-    0.50731679f, 0.50661735f, 0.50594864f, 0.50531108f, 0.50470505f, 0.50413084f, 0.50358869f, 0.50307877f,
-    0.50260119f, 0.50215599f, 0.50174313f, 0.50136252f, 0.50101401f, 0.50069736f, 0.50041229f, 0.50015844f,
-    0.49993541f, 0.49974270f, 0.49957978f, 0.49944605f, 0.49934086f, 0.49926349f, 0.49921316f, 0.49918906f,
-    0.49919031f, 0.49921599f, 0.49926511f, 0.49933667f, 0.49942960f, 0.49954280f, 0.49967511f, 0.49982537f,
-    0.49999235f, 0.50017482f, 0.50037149f, 0.50058106f, 0.50080220f, 0.50103358f, 0.50127382f, 0.50152155f,
-    0.50177537f, 0.50203387f, 0.50229566f, 0.50255931f, 0.50282342f, 0.50308656f, 0.50334733f, 0.50360434f,
-    0.50385618f, 0.50410149f, 0.50433890f, 0.50456708f, 0.50478469f, 0.50499046f, 0.50518309f, 0.50536136f,
-    0.50552406f, 0.50567001f, 0.50579807f, 0.50590715f, 0.50599618f, 0.50606415f, 0.50611009f, 0.50613308f,
-    0.50613224f, 0.50610674f, 0.50605582f, 0.50597875f, 0.50587486f, 0.50574356f, 0.50558428f, 0.50539654f,
-    0.50517990f, 0.50493398f, 0.50465847f, 0.50435312f, 0.50401773f, 0.50365218f, 0.50325640f, 0.50283038f,
-    0.50237417f, 0.50188790f, 0.50137174f, 0.50082593f, 0.50025076f, 0.49964661f, 0.49901387f, 0.49835304f,
-    0.49766464f, 0.49694925f, 0.49620752f, 0.49544013f, 0.49464784f, 0.49383144f, 0.49299177f, 0.49212971f,
-    0.49124619f, 0.49034220f, 0.48941874f, 0.48847687f, 0.48751767f, 0.48654227f, 0.48555181f, 0.48454748f,
-    0.48353049f, 0.48250205f, 0.48146344f, 0.48041591f, 0.47936075f, 0.47829926f, 0.47723276f, 0.47616256f,
-    0.47508998f, 0.47401635f, 0.47294299f, 0.47187124f, 0.47080240f, 0.46973778f, 0.46867868f, 0.46762640f,
-    0.46658219f, 0.46554730f, 0.46452297f, 0.46351039f, 0.46251075f, 0.46152520f, 0.46055486f, 0.45960081f,
-    0.45866410f, 0.45774576f, 0.45684675f, 0.45596800f, 0.45511041f, 0.45427483f, 0.45346205f, 0.45267283f,
-    0.45190787f, 0.45116781f, 0.45045327f, 0.44976478f, 0.44910284f, 0.44846788f, 0.44786029f, 0.44728040f,
-    0.44672846f, 0.44620469f, 0.44570925f, 0.44524222f, 0.44480364f, 0.44439349f, 0.44401170f, 0.44365812f,
-    0.44333255f, 0.44303475f, 0.44276440f, 0.44252115f, 0.44230457f, 0.44211419f, 0.44194949f, 0.44180988f,
-    0.44169474f, 0.44160340f, 0.44153513f, 0.44148917f, 0.44146469f, 0.44146084f, 0.44147672f, 0.44151140f,
-    0.44156390f, 0.44163322f, 0.44171832f, 0.44181812f, 0.44193152f, 0.44205740f, 0.44219462f, 0.44234199f,
-    0.44249833f, 0.44266244f, 0.44283309f, 0.44300905f, 0.44318909f, 0.44337195f, 0.44355639f, 0.44374116f,
-    0.44392499f, 0.44410666f, 0.44428491f, 0.44445852f, 0.44462627f, 0.44478695f, 0.44493937f, 0.44508236f,
-    0.44521477f, 0.44533548f, 0.44544339f, 0.44553741f, 0.44561652f, 0.44567969f, 0.44572596f, 0.44575437f,
-    0.44576404f, 0.44575409f, 0.44572371f, 0.44567211f, 0.44559857f, 0.44550239f, 0.44538293f, 0.44523961f,
-    0.44507187f, 0.44487924f, 0.44466126f, 0.44441754f, 0.44414777f, 0.44385164f, 0.44352895f, 0.44317951f,
-    0.44280321f, 0.44239998f, 0.44196982f, 0.44151278f, 0.44102896f, 0.44051852f, 0.43998167f, 0.43941867f,
-    0.43882985f, 0.43821557f, 0.43757626f, 0.43691238f, 0.43622447f, 0.43551308f, 0.43477885f, 0.43402243f,
-    0.43324452f, 0.43244589f, 0.43162732f, 0.43078964f, 0.42993373f, 0.42906048f, 0.42817085f, 0.42726579f,
-    0.42634631f, 0.42541344f, 0.42446823f, 0.42351177f, 0.42254516f, 0.42156951f, 0.42058596f, 0.41959567f,
-    0.41859979f, 0.41759950f, 0.41659598f, 0.41559041f, 0.41458399f, 0.41357789f, 0.41257331f, 0.41157143f,
-    0.41057342f, 0.40958044f, 0.40859364f, 0.40761418f, 0.40664315f, 0.40568167f, 0.40473083f, 0.40379166f,
-    0.40286522f, 0.40195250f, 0.40105449f, 0.40017212f, 0.39930630f, 0.39845792f, 0.39762781f, 0.39681678f,
-    0.39602557f, 0.39525492f, 0.39450550f, 0.39377794f, 0.39307283f, 0.39239070f, 0.39173206f, 0.39109733f,
-    0.39048693f, 0.38990118f, 0.38934038f, 0.38880478f, 0.38829457f, 0.38780987f, 0.38735078f, 0.38691733f,
-    0.38650950f, 0.38612721f, 0.38577035f, 0.38543874f, 0.38513214f, 0.38485029f, 0.38459285f, 0.38435945f,
-    0.38414965f, 0.38396299f, 0.38379894f, 0.38365695f, 0.38353639f, 0.38343661f, 0.38335692f, 0.38329659f,
-    0.38325484f, 0.38323085f, 0.38322379f, 0.38323277f, 0.38325688f, 0.38329519f, 0.38334671f, 0.38341047f,
-    0.38348543f, 0.38357057f, 0.38366481f, 0.38376709f, 0.38387631f, 0.38399137f, 0.38411115f, 0.38423454f,
-    0.38436039f, 0.38448759f, 0.38461499f, 0.38474146f, 0.38486587f, 0.38498711f, 0.38510405f, 0.38521558f,
-    0.38532062f, 0.38541808f, 0.38550691f, 0.38558605f, 0.38565450f, 0.38571125f, 0.38575532f, 0.38578577f,
-    0.38580169f, 0.38580218f, 0.38578640f, 0.38575352f, 0.38570276f, 0.38563337f, 0.38554465f, 0.38543593f,
-    0.38530659f, 0.38515603f, 0.38498373f, 0.38478920f, 0.38457198f, 0.38433167f, 0.38406793f, 0.38378044f,
-    0.38346896f, 0.38313328f, 0.38277324f, 0.38238873f, 0.38197971f, 0.38154615f, 0.38108812f, 0.38060570f,
-    0.38009904f, 0.37956833f, 0.37901381f, 0.37843577f, 0.37783455f, 0.37721055f, 0.37656418f, 0.37589593f,
-    0.37520631f, 0.37449590f, 0.37376529f, 0.37301513f, 0.37224611f, 0.37145896f, 0.37065442f, 0.36983330f,
-    0.36899643f, 0.36814465f, 0.36727886f, 0.36639997f, 0.36550893f, 0.36460670f, 0.36369427f, 0.36277264f,
-    0.36184283f, 0.36090589f, 0.35996287f, 0.35901484f, 0.35806285f, 0.35710801f, 0.35615138f, 0.35519407f,
-    0.35423714f, 0.35328170f, 0.35232882f, 0.35137957f, 0.35043502f, 0.34949623f, 0.34856423f, 0.34764006f,
-    0.34672472f, 0.34581921f, 0.34492449f, 0.34404151f, 0.34317120f, 0.34231444f, 0.34147209f, 0.34064501f,
-    0.33983398f, 0.33903979f, 0.33826315f, 0.33750477f, 0.33676532f, 0.33604540f, 0.33534560f, 0.33466645f,
-    0.33400846f, 0.33337206f, 0.33275768f, 0.33216566f, 0.33159632f, 0.33104993f, 0.33052672f, 0.33002685f,
-    0.32955045f, 0.32909759f, 0.32866831f, 0.32826259f, 0.32788036f, 0.32752150f, 0.32718585f, 0.32687321f,
-    0.32658330f, 0.32631584f, 0.32607047f, 0.32584680f, 0.32564438f, 0.32546275f, 0.32530138f, 0.32515970f,
-    0.32503711f, 0.32493297f, 0.32484660f, 0.32477729f, 0.32472428f, 0.32468681f, 0.32466405f, 0.32465517f,
-    0.32465930f, 0.32467554f, 0.32470298f, 0.32474067f, 0.32478766f, 0.32484296f, 0.32490560f, 0.32497454f,
-    0.32504879f, 0.32512730f, 0.32520905f, 0.32529298f, 0.32537805f, 0.32546322f, 0.32554744f, 0.32562966f,
-    0.32570885f, 0.32578398f, 0.32585401f, 0.32591796f, 0.32597481f, 0.32602358f, 0.32606332f, 0.32609307f,
-    0.32611192f, 0.32611896f, 0.32611333f, 0.32609416f, 0.32606065f, 0.32601200f, 0.32594746f, 0.32586630f,
-    0.32576783f, 0.32565140f, 0.32551639f, 0.32536223f, 0.32518837f, 0.32499432f, 0.32477962f, 0.32454387f,
-    0.32428669f, 0.32400775f, 0.32370678f, 0.32338354f, 0.32303785f, 0.32266955f, 0.32227855f, 0.32186481f,
-    0.32142831f, 0.32096911f, 0.32048728f, 0.31998297f, 0.31945635f, 0.31890766f, 0.31833716f, 0.31774517f,
-    0.31713205f, 0.31649820f, 0.31584407f, 0.31517014f, 0.31447693f, 0.31376501f, 0.31303499f, 0.31228749f,
-    0.31152320f, 0.31074282f, 0.30994709f, 0.30913679f, 0.30831270f, 0.30747566f, 0.30662652f, 0.30576615f,
-    0.30489545f, 0.30401535f, 0.30312678f, 0.30223069f, 0.30132806f, 0.30041985f, 0.29950707f, 0.29859071f,
-    0.29767178f, 0.29675128f, 0.29583024f, 0.29490966f, 0.29399055f, 0.29307393f, 0.29216079f, 0.29125213f,
-    0.29034892f, 0.28945214f, 0.28856275f, 0.28768169f, 0.28680987f, 0.28594821f, 0.28509759f, 0.28425885f,
-    0.28343285f, 0.28262038f, 0.28182222f, 0.28103912f, 0.28027179f, 0.27952093f, 0.27878718f, 0.27807115f,
-    0.27737343f, 0.27669454f, 0.27603500f, 0.27539526f, 0.27477575f, 0.27417683f, 0.27359885f, 0.27304209f,
-    0.27250681f, 0.27199322f, 0.27150146f, 0.27103166f, 0.27058389f, 0.27015817f, 0.26975448f, 0.26937276f,
-    0.26901289f, 0.26867473f, 0.26835808f, 0.26806268f, 0.26778827f, 0.26753450f, 0.26730100f, 0.26708738f,
-    0.26689317f, 0.26671788f, 0.26656099f, 0.26642193f, 0.26630009f, 0.26619484f, 0.26610551f, 0.26603140f,
-    0.26597177f, 0.26592585f, 0.26589287f, 0.26587201f, 0.26586242f, 0.26586325f, 0.26587361f, 0.26589260f,
-    0.26591930f, 0.26595278f, 0.26599210f, 0.26603630f, 0.26608440f, 0.26613544f, 0.26618844f, 0.26624242f,
-    0.26629638f, 0.26634936f, 0.26640036f, 0.26644842f, 0.26649257f, 0.26653184f, 0.26656529f, 0.26659199f,
-    0.26661100f, 0.26662143f, 0.26662239f, 0.26661301f, 0.26659245f, 0.26655989f, 0.26651452f, 0.26645558f,
-    0.26638234f, 0.26629407f, 0.26619010f, 0.26606977f, 0.26593249f, 0.26577766f, 0.26560475f, 0.26541326f,
-    0.26520271f, 0.26497267f, 0.26472277f, 0.26445266f, 0.26416203f, 0.26385061f, 0.26351820f, 0.26316462f,
-    0.26278972f, 0.26239343f, 0.26197569f, 0.26153651f, 0.26107593f, 0.26059403f, 0.26009094f, 0.25956685f,
-    0.25902195f, 0.25845651f, 0.25787084f, 0.25726526f, 0.25664017f, 0.25599598f, 0.25533315f, 0.25465219f,
-    0.25395362f, 0.25323801f, 0.25250598f, 0.25175815f, 0.25099520f, 0.25021782f, 0.24942675f, 0.24862274f,
-    0.24780657f, 0.24697905f, 0.24614101f, 0.24529330f, 0.24443679f, 0.24357236f, 0.24270092f, 0.24182338f,
-    0.24094067f, 0.24005373f, 0.23916350f, 0.23827093f, 0.23737699f, 0.23648262f, 0.23558879f, 0.23469646f,
-    0.23380656f, 0.23292006f, 0.23203789f, 0.23116099f, 0.23029026f, 0.22942661f, 0.22857095f, 0.22772413f,
-    0.22688701f, 0.22606043f, 0.22524519f, 0.22444209f, 0.22365190f, 0.22287534f, 0.22211312f, 0.22136592f,
-    0.22063439f, 0.21991913f, 0.21922075f, 0.21853976f, 0.21787670f, 0.21723202f, 0.21660617f, 0.21599954f,
-    0.21541249f, 0.21484533f, 0.21429833f, 0.21377174f, 0.21326574f, 0.21278048f, 0.21231607f, 0.21187258f,
-    0.21145003f, 0.21104839f, 0.21066760f, 0.21030755f, 0.20996811f, 0.20964906f, 0.20935019f, 0.20907122f,
-    0.20881183f, 0.20857168f, 0.20835036f, 0.20814745f, 0.20796247f, 0.20779493f, 0.20764428f, 0.20750995f,
-    0.20739133f, 0.20728778f, 0.20719863f, 0.20712318f, 0.20706071f, 0.20701047f, 0.20697166f, 0.20694351f,
-    0.20692518f, 0.20691583f, 0.20691461f, 0.20692065f, 0.20693304f, 0.20695089f, 0.20697330f, 0.20699933f,
-    0.20702806f, 0.20705855f, 0.20708988f, 0.20712111f, 0.20715129f, 0.20717949f, 0.20720480f, 0.20722627f,
-    0.20724301f, 0.20725410f, 0.20725866f, 0.20725581f, 0.20724468f, 0.20722443f, 0.20719423f, 0.20715329f,
-    0.20710081f, 0.20703604f, 0.20695825f, 0.20686673f, 0.20676080f, 0.20663982f, 0.20650318f, 0.20635028f,
-    0.20618057f, 0.20599355f, 0.20578873f, 0.20556567f, 0.20532397f, 0.20506325f, 0.20478318f, 0.20448349f,
-    0.20416392f, 0.20382427f, 0.20346436f, 0.20308408f, 0.20268334f, 0.20226210f, 0.20182036f, 0.20135816f,
-    0.20087560f, 0.20037279f, 0.19984990f, 0.19930715f, 0.19874477f, 0.19816307f, 0.19756236f, 0.19694303f,
-    0.19630546f, 0.19565010f, 0.19497744f, 0.19428798f, 0.19358228f, 0.19286091f, 0.19212448f, 0.19137364f,
-    0.19060906f, 0.18983144f, 0.18904151f, 0.18824001f, 0.18742772f, 0.18660543f, 0.18577397f, 0.18493416f,
-    0.18408685f, 0.18323292f, 0.18237323f, 0.18150869f, 0.18064018f, 0.17976862f, 0.17889491f, 0.17801998f,
-    0.17714474f, 0.17627012f, 0.17539702f, 0.17452637f, 0.17365906f, 0.17279601f, 0.17193811f, 0.17108622f,
-    0.17024123f, 0.16940399f, 0.16857532f, 0.16775606f, 0.16694700f, 0.16614892f, 0.16536258f, 0.16458870f,
-    0.16382799f, 0.16308113f, 0.16234877f, 0.16163153f, 0.16092999f, 0.16024472f, 0.15957622f, 0.15892500f,
-    0.15829151f, 0.15767615f, 0.15707931f, 0.15650133f, 0.15594251f, 0.15540311f, 0.15488335f, 0.15438342f,
-    0.15390345f, 0.15344356f, 0.15300379f, 0.15258417f, 0.15218467f, 0.15180522f, 0.15144574f, 0.15110606f,
-    0.15078600f, 0.15048533f, 0.15020380f, 0.14994109f, 0.14969686f, 0.14947073f, 0.14926229f, 0.14907107f,
-    0.14889659f, 0.14873833f, 0.14859573f, 0.14846821f, 0.14835514f, 0.14825589f, 0.14816976f, 0.14809607f,
-    0.14803408f, 0.14798305f, 0.14794220f, 0.14791073f, 0.14788785f, 0.14787271f, 0.14786447f, 0.14786228f,
-    0.14786526f, 0.14787253f, 0.14788321f, 0.14789640f, 0.14791119f, 0.14792669f, 0.14794199f, 0.14795619f,
-    0.14796838f, 0.14797767f, 0.14798317f, 0.14798400f, 0.14797928f, 0.14796816f, 0.14794978f, 0.14792332f,
-    0.14788796f, 0.14784291f, 0.14778738f, 0.14772063f, 0.14764192f, 0.14755055f, 0.14744583f, 0.14732712f,
-    0.14719378f, 0.14704523f, 0.14688090f, 0.14670027f, 0.14650283f, 0.14628813f, 0.14605574f, 0.14580526f,
-    0.14553635f, 0.14524869f, 0.14494201f, 0.14461606f, 0.14427066f, 0.14390563f, 0.14352087f, 0.14311629f,
-    0.14269186f, 0.14224758f, 0.14178350f, 0.14129970f, 0.14079631f, 0.14027349f, 0.13973144f, 0.13917042f,
-    0.13859069f, 0.13799259f, 0.13737648f, 0.13674273f, 0.13609180f, 0.13542414f, 0.13474026f, 0.13404068f,
-    0.13332597f, 0.13259673f, 0.13185358f, 0.13109718f, 0.13032820f, 0.12954736f, 0.12875537f, 0.12795300f,
-    0.12714102f, 0.12632022f, 0.12549140f, 0.12465541f, 0.12381307f, 0.12296524f, 0.12211279f, 0.12125658f,
-    0.12039751f, 0.11953646f, 0.11867431f, 0.11781196f, 0.11695030f, 0.11609023f, 0.11523263f, 0.11437838f,
-    0.11352836f, 0.11268343f, 0.11184445f, 0.11101226f, 0.11018769f, 0.10937155f, 0.10856463f, 0.10776772f,
-    0.10698157f, 0.10620691f, 0.10544445f, 0.10469488f, 0.10395885f, 0.10323699f, 0.10252990f, 0.10183816f,
-    0.10116230f, 0.10050283f, 0.09986021f, 0.09923490f, 0.09862728f, 0.09803773f, 0.09746657f, 0.09691410f,
-    0.09638056f, 0.09586618f, 0.09537112f, 0.09489553f, 0.09443949f, 0.09400306f, 0.09358626f, 0.09318906f,
-    0.09281140f, 0.09245317f, 0.09211422f, 0.09179438f, 0.09149342f, 0.09121108f, 0.09094705f, 0.09070100f,
-    0.09047256f, 0.09026132f, 0.09006683f, 0.08988861f, 0.08972616f, 0.08957892f, 0.08944632f, 0.08932776f,
-    0.08922260f, 0.08913019f, 0.08904983f, 0.08898081f, 0.08892241f, 0.08887386f, 0.08883439f, 0.08880320f,
-    0.08877949f, 0.08876243f, 0.08875118f, 0.08874488f, 0.08874269f, 0.08874372f, 0.08874710f, 0.08875196f,
-    0.08875741f, 0.08876257f, 0.08876655f, 0.08876847f, 0.08876747f, 0.08876266f, 0.08875318f, 0.08873820f,
-    0.08871685f, 0.08868833f, 0.08865180f, 0.08860649f, 0.08855161f, 0.08848640f, 0.08841013f, 0.08832208f,
-    0.08822157f, 0.08810792f, 0.08798051f, 0.08783872f, 0.08768198f, 0.08750973f, 0.08732147f, 0.08711670f,
-    0.08689498f, 0.08665589f, 0.08639905f, 0.08612413f, 0.08583080f, 0.08551882f, 0.08518793f, 0.08483797f,
-    0.08446876f, 0.08408021f, 0.08367223f, 0.08324480f, 0.08279791f, 0.08233162f, 0.08184601f, 0.08134121f,
-    0.08081738f, 0.08027473f, 0.07971349f, 0.07913394f, 0.07853641f, 0.07792125f, 0.07728885f, 0.07663963f,
-    0.07597405f, 0.07529260f, 0.07459582f, 0.07388425f, 0.07315849f, 0.07241915f, 0.07166687f, 0.07090232f,
-    0.07012619f, 0.06933921f, 0.06854212f, 0.06773567f, 0.06692065f, 0.06609785f, 0.06526808f, 0.06443218f,
-    0.06359098f, 0.06274533f, 0.06189609f, 0.06104413f, 0.06019031f, 0.05933552f, 0.05848064f, 0.05762653f,
-    0.05677407f, 0.05592414f, 0.05507761f, 0.05423532f, 0.05339814f, 0.05256690f, 0.05174243f, 0.05092555f,
-    0.05011705f, 0.04931772f, 0.04852831f, 0.04774957f, 0.04698222f, 0.04622695f, 0.04548444f, 0.04475533f,
-    0.04404024f, 0.04333976f, 0.04265444f, 0.04198482f, 0.04133139f, 0.04069462f, 0.04007493f, 0.03947271f,
-    0.03888833f, 0.03832210f, 0.03777432f, 0.03724521f, 0.03673501f, 0.03624386f, 0.03577191f, 0.03531924f,
-    0.03488591f, 0.03447193f, 0.03407726f, 0.03370185f, 0.03334559f, 0.03300833f, 0.03268988f, 0.03239003f,
-    0.03210851f, 0.03184503f, 0.03159925f, 0.03137079f, 0.03115926f, 0.03096421f, 0.03078516f, 0.03062160f,
-    0.03047301f, 0.03033880f, 0.03021839f, 0.03011113f, 0.03001638f, 0.02993346f, 0.02986166f, 0.02980026f,
-    0.02974850f, 0.02970563f, 0.02967085f, 0.02964337f, 0.02962237f, 0.02960701f, 0.02959645f, 0.02958985f,
-    0.02958634f, 0.02958507f, 0.02958515f, 0.02958572f, 0.02958589f, 0.02958481f, 0.02958160f, 0.02957540f,
-    0.02956533f, 0.02955056f, 0.02953024f, 0.02950354f, 0.02946964f, 0.02942774f, 0.02937706f, 0.02931682f,
-    0.02924628f, 0.02916470f, 0.02907140f, 0.02896567f, 0.02884688f, 0.02871439f, 0.02856759f, 0.02840593f,
-    0.02822885f, 0.02803585f, 0.02782645f, 0.02760021f, 0.02735673f, 0.02709561f, 0.02681654f, 0.02651921f,
-    0.02620336f, 0.02586876f, 0.02551522f, 0.02514260f, 0.02475078f, 0.02433971f, 0.02390934f, 0.02345969f,
-    0.02299080f, 0.02250277f, 0.02199571f, 0.02146981f, 0.02092525f, 0.02036229f, 0.01978120f, 0.01918231f,
-    0.01856596f, 0.01793254f, 0.01728249f, 0.01661625f, 0.01593432f, 0.01523722f, 0.01452551f, 0.01379978f,
-    0.01306063f, 0.01230870f, 0.01154467f, 0.01076922f, 0.00998307f, 0.00918696f, 0.00838164f, 0.00756789f,
-    0.00674650f, 0.00591829f, 0.00508406f, 0.00424467f, 0.00340095f, 0.00255376f, 0.00170396f, 0.00085242f,
-    0.00000000f, -0.00085242f, -0.00170396f, -0.00255376f, -0.00340095f, -0.00424467f, -0.00508406f, -0.00591829f,
-    -0.00674650f, -0.00756789f, -0.00838164f, -0.00918696f, -0.00998307f, -0.01076922f, -0.01154467f, -0.01230870f,
-    -0.01306063f, -0.01379978f, -0.01452551f, -0.01523722f, -0.01593432f, -0.01661625f, -0.01728249f, -0.01793254f,
-    -0.01856596f, -0.01918231f, -0.01978120f, -0.02036229f, -0.02092525f, -0.02146981f, -0.02199571f, -0.02250277f,
-    -0.02299080f, -0.02345969f, -0.02390934f, -0.02433971f, -0.02475078f, -0.02514260f, -0.02551522f, -0.02586876f,
-    -0.02620336f, -0.02651921f, -0.02681654f, -0.02709561f, -0.02735673f, -0.02760021f, -0.02782645f, -0.02803585f,
-    -0.02822885f, -0.02840593f, -0.02856759f, -0.02871439f, -0.02884688f, -0.02896567f, -0.02907140f, -0.02916470f,
-    -0.02924628f, -0.02931682f, -0.02937706f, -0.02942774f, -0.02946964f, -0.02950354f, -0.02953024f, -0.02955056f,
-    -0.02956533f, -0.02957540f, -0.02958160f, -0.02958481f, -0.02958589f, -0.02958572f, -0.02958515f, -0.02958507f,
-    -0.02958634f, -0.02958985f, -0.02959645f, -0.02960701f, -0.02962237f, -0.02964337f, -0.02967085f, -0.02970563f,
-    -0.02974850f, -0.02980026f, -0.02986166f, -0.02993346f, -0.03001638f, -0.03011113f, -0.03021839f, -0.03033880f,
-    -0.03047301f, -0.03062160f, -0.03078516f, -0.03096421f, -0.03115926f, -0.03137079f, -0.03159925f, -0.03184503f,
-    -0.03210851f, -0.03239003f, -0.03268988f, -0.03300833f, -0.03334559f, -0.03370185f, -0.03407726f, -0.03447193f,
-    -0.03488591f, -0.03531924f, -0.03577191f, -0.03624386f, -0.03673501f, -0.03724521f, -0.03777432f, -0.03832210f,
-    -0.03888833f, -0.03947271f, -0.04007493f, -0.04069462f, -0.04133139f, -0.04198482f, -0.04265444f, -0.04333976f,
-    -0.04404024f, -0.04475533f, -0.04548444f, -0.04622695f, -0.04698222f, -0.04774957f, -0.04852831f, -0.04931772f,
-    -0.05011705f, -0.05092555f, -0.05174243f, -0.05256690f, -0.05339814f, -0.05423532f, -0.05507761f, -0.05592414f,
-    -0.05677407f, -0.05762653f, -0.05848064f, -0.05933552f, -0.06019031f, -0.06104413f, -0.06189609f, -0.06274533f,
-    -0.06359098f, -0.06443218f, -0.06526808f, -0.06609785f, -0.06692065f, -0.06773567f, -0.06854212f, -0.06933921f,
-    -0.07012619f, -0.07090232f, -0.07166687f, -0.07241915f, -0.07315849f, -0.07388425f, -0.07459582f, -0.07529260f,
-    -0.07597405f, -0.07663963f, -0.07728885f, -0.07792125f, -0.07853641f, -0.07913394f, -0.07971349f, -0.08027473f,
-    -0.08081738f, -0.08134121f, -0.08184601f, -0.08233162f, -0.08279791f, -0.08324480f, -0.08367223f, -0.08408021f,
-    -0.08446876f, -0.08483797f, -0.08518793f, -0.08551882f, -0.08583080f, -0.08612413f, -0.08639905f, -0.08665589f,
-    -0.08689498f, -0.08711670f, -0.08732147f, -0.08750973f, -0.08768198f, -0.08783872f, -0.08798051f, -0.08810792f,
-    -0.08822157f, -0.08832208f, -0.08841013f, -0.08848640f, -0.08855161f, -0.08860649f, -0.08865180f, -0.08868833f,
-    -0.08871685f, -0.08873820f, -0.08875318f, -0.08876266f, -0.08876747f, -0.08876847f, -0.08876655f, -0.08876257f,
-    -0.08875741f, -0.08875196f, -0.08874710f, -0.08874372f, -0.08874269f, -0.08874488f, -0.08875118f, -0.08876243f,
-    -0.08877949f, -0.08880320f, -0.08883439f, -0.08887386f, -0.08892241f, -0.08898081f, -0.08904983f, -0.08913019f,
-    -0.08922260f, -0.08932776f, -0.08944632f, -0.08957892f, -0.08972616f, -0.08988861f, -0.09006683f, -0.09026132f,
-    -0.09047256f, -0.09070100f, -0.09094705f, -0.09121108f, -0.09149342f, -0.09179438f, -0.09211422f, -0.09245317f,
-    -0.09281140f, -0.09318906f, -0.09358626f, -0.09400306f, -0.09443949f, -0.09489553f, -0.09537112f, -0.09586618f,
-    -0.09638056f, -0.09691410f, -0.09746657f, -0.09803773f, -0.09862728f, -0.09923490f, -0.09986021f, -0.10050283f,
-    -0.10116230f, -0.10183816f, -0.10252990f, -0.10323699f, -0.10395885f, -0.10469488f, -0.10544445f, -0.10620691f,
-    -0.10698157f, -0.10776772f, -0.10856463f, -0.10937155f, -0.11018769f, -0.11101226f, -0.11184445f, -0.11268343f,
-    -0.11352836f, -0.11437838f, -0.11523263f, -0.11609023f, -0.11695030f, -0.11781196f, -0.11867431f, -0.11953646f,
-    -0.12039751f, -0.12125658f, -0.12211279f, -0.12296524f, -0.12381307f, -0.12465541f, -0.12549140f, -0.12632022f,
-    -0.12714102f, -0.12795300f, -0.12875537f, -0.12954736f, -0.13032820f, -0.13109718f, -0.13185358f, -0.13259673f,
-    -0.13332597f, -0.13404068f, -0.13474026f, -0.13542414f, -0.13609180f, -0.13674273f, -0.13737648f, -0.13799259f,
-    -0.13859069f, -0.13917042f, -0.13973144f, -0.14027349f, -0.14079631f, -0.14129970f, -0.14178350f, -0.14224758f,
-    -0.14269186f, -0.14311629f, -0.14352087f, -0.14390563f, -0.14427066f, -0.14461606f, -0.14494201f, -0.14524869f,
-    -0.14553635f, -0.14580526f, -0.14605574f, -0.14628813f, -0.14650283f, -0.14670027f, -0.14688090f, -0.14704523f,
-    -0.14719378f, -0.14732712f, -0.14744583f, -0.14755055f, -0.14764192f, -0.14772063f, -0.14778738f, -0.14784291f,
-    -0.14788796f, -0.14792332f, -0.14794978f, -0.14796816f, -0.14797928f, -0.14798400f, -0.14798317f, -0.14797767f,
-    -0.14796838f, -0.14795619f, -0.14794199f, -0.14792669f, -0.14791119f, -0.14789640f, -0.14788321f, -0.14787253f,
-    -0.14786526f, -0.14786228f, -0.14786447f, -0.14787271f, -0.14788785f, -0.14791073f, -0.14794220f, -0.14798305f,
-    -0.14803408f, -0.14809607f, -0.14816976f, -0.14825589f, -0.14835514f, -0.14846821f, -0.14859573f, -0.14873833f,
-    -0.14889659f, -0.14907107f, -0.14926229f, -0.14947073f, -0.14969686f, -0.14994109f, -0.15020380f, -0.15048533f,
-    -0.15078600f, -0.15110606f, -0.15144574f, -0.15180522f, -0.15218467f, -0.15258417f, -0.15300379f, -0.15344356f,
-    -0.15390345f, -0.15438342f, -0.15488335f, -0.15540311f, -0.15594251f, -0.15650133f, -0.15707931f, -0.15767615f,
-    -0.15829151f, -0.15892500f, -0.15957622f, -0.16024472f, -0.16092999f, -0.16163153f, -0.16234877f, -0.16308113f,
-    -0.16382799f, -0.16458870f, -0.16536258f, -0.16614892f, -0.16694700f, -0.16775606f, -0.16857532f, -0.16940399f,
-    -0.17024123f, -0.17108622f, -0.17193811f, -0.17279601f, -0.17365906f, -0.17452637f, -0.17539702f, -0.17627012f,
-    -0.17714474f, -0.17801998f, -0.17889491f, -0.17976862f, -0.18064018f, -0.18150869f, -0.18237323f, -0.18323292f,
-    -0.18408685f, -0.18493416f, -0.18577397f, -0.18660543f, -0.18742772f, -0.18824001f, -0.18904151f, -0.18983144f,
-    -0.19060906f, -0.19137364f, -0.19212448f, -0.19286091f, -0.19358228f, -0.19428798f, -0.19497744f, -0.19565010f,
-    -0.19630546f, -0.19694303f, -0.19756236f, -0.19816307f, -0.19874477f, -0.19930715f, -0.19984990f, -0.20037279f,
-    -0.20087560f, -0.20135816f, -0.20182036f, -0.20226210f, -0.20268334f, -0.20308408f, -0.20346436f, -0.20382427f,
-    -0.20416392f, -0.20448349f, -0.20478318f, -0.20506325f, -0.20532397f, -0.20556567f, -0.20578873f, -0.20599355f,
-    -0.20618057f, -0.20635028f, -0.20650318f, -0.20663982f, -0.20676080f, -0.20686673f, -0.20695825f, -0.20703604f,
-    -0.20710081f, -0.20715329f, -0.20719423f, -0.20722443f, -0.20724468f, -0.20725581f, -0.20725866f, -0.20725410f,
-    -0.20724301f, -0.20722627f, -0.20720480f, -0.20717949f, -0.20715129f, -0.20712111f, -0.20708988f, -0.20705855f,
-    -0.20702806f, -0.20699933f, -0.20697330f, -0.20695089f, -0.20693304f, -0.20692065f, -0.20691461f, -0.20691583f,
-    -0.20692518f, -0.20694351f, -0.20697166f, -0.20701047f, -0.20706071f, -0.20712318f, -0.20719863f, -0.20728778f,
-    -0.20739133f, -0.20750995f, -0.20764428f, -0.20779493f, -0.20796247f, -0.20814745f, -0.20835036f, -0.20857168f,
-    -0.20881183f, -0.20907122f, -0.20935019f, -0.20964906f, -0.20996811f, -0.21030755f, -0.21066760f, -0.21104839f,
-    -0.21145003f, -0.21187258f, -0.21231607f, -0.21278048f, -0.21326574f, -0.21377174f, -0.21429833f, -0.21484533f,
-    -0.21541249f, -0.21599954f, -0.21660617f, -0.21723202f, -0.21787670f, -0.21853976f, -0.21922075f, -0.21991913f,
-    -0.22063439f, -0.22136592f, -0.22211312f, -0.22287534f, -0.22365190f, -0.22444209f, -0.22524519f, -0.22606043f,
-    -0.22688701f, -0.22772413f, -0.22857095f, -0.22942661f, -0.23029026f, -0.23116099f, -0.23203789f, -0.23292006f,
-    -0.23380656f, -0.23469646f, -0.23558879f, -0.23648262f, -0.23737699f, -0.23827093f, -0.23916350f, -0.24005373f,
-    -0.24094067f, -0.24182338f, -0.24270092f, -0.24357236f, -0.24443679f, -0.24529330f, -0.24614101f, -0.24697905f,
-    -0.24780657f, -0.24862274f, -0.24942675f, -0.25021782f, -0.25099520f, -0.25175815f, -0.25250598f, -0.25323801f,
-    -0.25395362f, -0.25465219f, -0.25533315f, -0.25599598f, -0.25664017f, -0.25726526f, -0.25787084f, -0.25845651f,
-    -0.25902195f, -0.25956685f, -0.26009094f, -0.26059403f, -0.26107593f, -0.26153651f, -0.26197569f, -0.26239343f,
-    -0.26278972f, -0.26316462f, -0.26351820f, -0.26385061f, -0.26416203f, -0.26445266f, -0.26472277f, -0.26497267f,
-    -0.26520271f, -0.26541326f, -0.26560475f, -0.26577766f, -0.26593249f, -0.26606977f, -0.26619010f, -0.26629407f,
-    -0.26638234f, -0.26645558f, -0.26651452f, -0.26655989f, -0.26659245f, -0.26661301f, -0.26662239f, -0.26662143f,
-    -0.26661100f, -0.26659199f, -0.26656529f, -0.26653184f, -0.26649257f, -0.26644842f, -0.26640036f, -0.26634936f,
-    -0.26629638f, -0.26624242f, -0.26618844f, -0.26613544f, -0.26608440f, -0.26603630f, -0.26599210f, -0.26595278f,
-    -0.26591930f, -0.26589260f, -0.26587361f, -0.26586325f, -0.26586242f, -0.26587201f, -0.26589287f, -0.26592585f,
-    -0.26597177f, -0.26603140f, -0.26610551f, -0.26619484f, -0.26630009f, -0.26642193f, -0.26656099f, -0.26671788f,
-    -0.26689317f, -0.26708738f, -0.26730100f, -0.26753450f, -0.26778827f, -0.26806268f, -0.26835808f, -0.26867473f,
-    -0.26901289f, -0.26937276f, -0.26975448f, -0.27015817f, -0.27058389f, -0.27103166f, -0.27150146f, -0.27199322f,
-    -0.27250681f, -0.27304209f, -0.27359885f, -0.27417683f, -0.27477575f, -0.27539526f, -0.27603500f, -0.27669454f,
-    -0.27737343f, -0.27807115f, -0.27878718f, -0.27952093f, -0.28027179f, -0.28103912f, -0.28182222f, -0.28262038f,
-    -0.28343285f, -0.28425885f, -0.28509759f, -0.28594821f, -0.28680987f, -0.28768169f, -0.28856275f, -0.28945214f,
-    -0.29034892f, -0.29125213f, -0.29216079f, -0.29307393f, -0.29399055f, -0.29490966f, -0.29583024f, -0.29675128f,
-    -0.29767178f, -0.29859071f, -0.29950707f, -0.30041985f, -0.30132806f, -0.30223069f, -0.30312678f, -0.30401535f,
-    -0.30489545f, -0.30576615f, -0.30662652f, -0.30747566f, -0.30831270f, -0.30913679f, -0.30994709f, -0.31074282f,
-    -0.31152320f, -0.31228749f, -0.31303499f, -0.31376501f, -0.31447693f, -0.31517014f, -0.31584407f, -0.31649820f,
-    -0.31713205f, -0.31774517f, -0.31833716f, -0.31890766f, -0.31945635f, -0.31998297f, -0.32048728f, -0.32096911f,
-    -0.32142831f, -0.32186481f, -0.32227855f, -0.32266955f, -0.32303785f, -0.32338354f, -0.32370678f, -0.32400775f,
-    -0.32428669f, -0.32454387f, -0.32477962f, -0.32499432f, -0.32518837f, -0.32536223f, -0.32551639f, -0.32565140f,
-    -0.32576783f, -0.32586630f, -0.32594746f, -0.32601200f, -0.32606065f, -0.32609416f, -0.32611333f, -0.32611896f,
-    -0.32611192f, -0.32609307f, -0.32606332f, -0.32602358f, -0.32597481f, -0.32591796f, -0.32585401f, -0.32578398f,
-    -0.32570885f, -0.32562966f, -0.32554744f, -0.32546322f, -0.32537805f, -0.32529298f, -0.32520905f, -0.32512730f,
-    -0.32504879f, -0.32497454f, -0.32490560f, -0.32484296f, -0.32478766f, -0.32474067f, -0.32470298f, -0.32467554f,
-    -0.32465930f, -0.32465517f, -0.32466405f, -0.32468681f, -0.32472428f, -0.32477729f, -0.32484660f, -0.32493297f,
-    -0.32503711f, -0.32515970f, -0.32530138f, -0.32546275f, -0.32564438f, -0.32584680f, -0.32607047f, -0.32631584f,
-    -0.32658330f, -0.32687321f, -0.32718585f, -0.32752150f, -0.32788036f, -0.32826259f, -0.32866831f, -0.32909759f,
-    -0.32955045f, -0.33002685f, -0.33052672f, -0.33104993f, -0.33159632f, -0.33216566f, -0.33275768f, -0.33337206f,
-    -0.33400846f, -0.33466645f, -0.33534560f, -0.33604540f, -0.33676532f, -0.33750477f, -0.33826315f, -0.33903979f,
-    -0.33983398f, -0.34064501f, -0.34147209f, -0.34231444f, -0.34317120f, -0.34404151f, -0.34492449f, -0.34581921f,
-    -0.34672472f, -0.34764006f, -0.34856423f, -0.34949623f, -0.35043502f, -0.35137957f, -0.35232882f, -0.35328170f,
-    -0.35423714f, -0.35519407f, -0.35615138f, -0.35710801f, -0.35806285f, -0.35901484f, -0.35996287f, -0.36090589f,
-    -0.36184283f, -0.36277264f, -0.36369427f, -0.36460670f, -0.36550893f, -0.36639997f, -0.36727886f, -0.36814465f,
-    -0.36899643f, -0.36983330f, -0.37065442f, -0.37145896f, -0.37224611f, -0.37301513f, -0.37376529f, -0.37449590f,
-    -0.37520631f, -0.37589593f, -0.37656418f, -0.37721055f, -0.37783455f, -0.37843577f, -0.37901381f, -0.37956833f,
-    -0.38009904f, -0.38060570f, -0.38108812f, -0.38154615f, -0.38197971f, -0.38238873f, -0.38277324f, -0.38313328f,
-    -0.38346896f, -0.38378044f, -0.38406793f, -0.38433167f, -0.38457198f, -0.38478920f, -0.38498373f, -0.38515603f,
-    -0.38530659f, -0.38543593f, -0.38554465f, -0.38563337f, -0.38570276f, -0.38575352f, -0.38578640f, -0.38580218f,
-    -0.38580169f, -0.38578577f, -0.38575532f, -0.38571125f, -0.38565450f, -0.38558605f, -0.38550691f, -0.38541808f,
-    -0.38532062f, -0.38521558f, -0.38510405f, -0.38498711f, -0.38486587f, -0.38474146f, -0.38461499f, -0.38448759f,
-    -0.38436039f, -0.38423454f, -0.38411115f, -0.38399137f, -0.38387631f, -0.38376709f, -0.38366481f, -0.38357057f,
-    -0.38348543f, -0.38341047f, -0.38334671f, -0.38329519f, -0.38325688f, -0.38323277f, -0.38322379f, -0.38323085f,
-    -0.38325484f, -0.38329659f, -0.38335692f, -0.38343661f, -0.38353639f, -0.38365695f, -0.38379894f, -0.38396299f,
-    -0.38414965f, -0.38435945f, -0.38459285f, -0.38485029f, -0.38513214f, -0.38543874f, -0.38577035f, -0.38612721f,
-    -0.38650950f, -0.38691733f, -0.38735078f, -0.38780987f, -0.38829457f, -0.38880478f, -0.38934038f, -0.38990118f,
-    -0.39048693f, -0.39109733f, -0.39173206f, -0.39239070f, -0.39307283f, -0.39377794f, -0.39450550f, -0.39525492f,
-    -0.39602557f, -0.39681678f, -0.39762781f, -0.39845792f, -0.39930630f, -0.40017212f, -0.40105449f, -0.40195250f,
-    -0.40286522f, -0.40379166f, -0.40473083f, -0.40568167f, -0.40664315f, -0.40761418f, -0.40859364f, -0.40958044f,
-    -0.41057342f, -0.41157143f, -0.41257331f, -0.41357789f, -0.41458399f, -0.41559041f, -0.41659598f, -0.41759950f,
-    -0.41859979f, -0.41959567f, -0.42058596f, -0.42156951f, -0.42254516f, -0.42351177f, -0.42446823f, -0.42541344f,
-    -0.42634631f, -0.42726579f, -0.42817085f, -0.42906048f, -0.42993373f, -0.43078964f, -0.43162732f, -0.43244589f,
-    -0.43324452f, -0.43402243f, -0.43477885f, -0.43551308f, -0.43622447f, -0.43691238f, -0.43757626f, -0.43821557f,
-    -0.43882985f, -0.43941867f, -0.43998167f, -0.44051852f, -0.44102896f, -0.44151278f, -0.44196982f, -0.44239998f,
-    -0.44280321f, -0.44317951f, -0.44352895f, -0.44385164f, -0.44414777f, -0.44441754f, -0.44466126f, -0.44487924f,
-    -0.44507187f, -0.44523961f, -0.44538293f, -0.44550239f, -0.44559857f, -0.44567211f, -0.44572371f, -0.44575409f,
-    -0.44576404f, -0.44575437f, -0.44572596f, -0.44567969f, -0.44561652f, -0.44553741f, -0.44544339f, -0.44533548f,
-    -0.44521477f, -0.44508236f, -0.44493937f, -0.44478695f, -0.44462627f, -0.44445852f, -0.44428491f, -0.44410666f,
-    -0.44392499f, -0.44374116f, -0.44355639f, -0.44337195f, -0.44318909f, -0.44300905f, -0.44283309f, -0.44266244f,
-    -0.44249833f, -0.44234199f, -0.44219462f, -0.44205740f, -0.44193152f, -0.44181812f, -0.44171832f, -0.44163322f,
-    -0.44156390f, -0.44151140f, -0.44147672f, -0.44146084f, -0.44146469f, -0.44148917f, -0.44153513f, -0.44160340f,
-    -0.44169474f, -0.44180988f, -0.44194949f, -0.44211419f, -0.44230457f, -0.44252115f, -0.44276440f, -0.44303475f,
-    -0.44333255f, -0.44365812f, -0.44401170f, -0.44439349f, -0.44480364f, -0.44524222f, -0.44570925f, -0.44620469f,
-    -0.44672846f, -0.44728040f, -0.44786029f, -0.44846788f, -0.44910284f, -0.44976478f, -0.45045327f, -0.45116781f,
-    -0.45190787f, -0.45267283f, -0.45346205f, -0.45427483f, -0.45511041f, -0.45596800f, -0.45684675f, -0.45774576f,
-    -0.45866410f, -0.45960081f, -0.46055486f, -0.46152520f, -0.46251075f, -0.46351039f, -0.46452297f, -0.46554730f,
-    -0.46658219f, -0.46762640f, -0.46867868f, -0.46973778f, -0.47080240f, -0.47187124f, -0.47294299f, -0.47401635f,
-    -0.47508998f, -0.47616256f, -0.47723276f, -0.47829926f, -0.47936075f, -0.48041591f, -0.48146344f, -0.48250205f,
-    -0.48353049f, -0.48454748f, -0.48555181f, -0.48654227f, -0.48751767f, -0.48847687f, -0.48941874f, -0.49034220f,
-    -0.49124619f, -0.49212971f, -0.49299177f, -0.49383144f, -0.49464784f, -0.49544013f, -0.49620752f, -0.49694925f,
-    -0.49766464f, -0.49835304f, -0.49901387f, -0.49964661f, -0.50025076f, -0.50082593f, -0.50137174f, -0.50188790f,
-    -0.50237417f, -0.50283038f, -0.50325640f, -0.50365218f, -0.50401773f, -0.50435312f, -0.50465847f, -0.50493398f,
-    -0.50517990f, -0.50539654f, -0.50558428f, -0.50574356f, -0.50587486f, -0.50597875f, -0.50605582f, -0.50610674f,
-    -0.50613224f, -0.50613308f, -0.50611009f, -0.50606415f, -0.50599618f, -0.50590715f, -0.50579807f, -0.50567001f,
-    -0.50552406f, -0.50536136f, -0.50518309f, -0.50499046f, -0.50478469f, -0.50456708f, -0.50433890f, -0.50410149f,
-    -0.50385618f, -0.50360434f, -0.50334733f, -0.50308656f, -0.50282342f, -0.50255931f, -0.50229566f, -0.50203387f,
-    -0.50177537f, -0.50152155f, -0.50127382f, -0.50103358f, -0.50080220f, -0.50058106f, -0.50037149f, -0.50017482f,
-    -0.49999235f, -0.49982537f, -0.49967511f, -0.49954280f, -0.49942960f, -0.49933667f, -0.49926511f, -0.49921599f,
-    -0.49919031f, -0.49918906f, -0.49921316f, -0.49926349f, -0.49934086f, -0.49944605f, -0.49957978f, -0.49974270f,
-    -0.49993541f, -0.50015844f, -0.50041229f, -0.50069736f, -0.50101401f, -0.50136252f, -0.50174313f, -0.50215599f,
-    -0.50260119f, -0.50307877f, -0.50358869f, -0.50413084f, -0.50470505f, -0.50531108f, -0.50594864f, -0.50661735f,
-    -0.50731679f, -0.50804646f, -0.50880580f, -0.50959419f, -0.51041095f, -0.51125534f, -0.51212656f, -0.51302376f,
-    -0.51394603f, -0.51489240f, -0.51586186f, -0.51685335f, -0.51786575f, -0.51889791f, -0.51994862f, -0.52101666f,
-    -0.52210074f, -0.52319954f, -0.52431173f, -0.52543593f, -0.52657072f, -0.52771469f, -0.52886638f, -0.53002432f,
-    -0.53118702f, -0.53235300f, -0.53352073f, -0.53468871f, -0.53585541f, -0.53701932f, -0.53817891f, -0.53933268f,
-    -0.54047912f, -0.54161674f, -0.54274406f, -0.54385962f, -0.54496199f, -0.54604974f, -0.54712150f, -0.54817591f,
-    -0.54921163f, -0.55022737f, -0.55122190f, -0.55219398f, -0.55314246f, -0.55406620f, -0.55496415f, -0.55583526f,
-    -0.55667857f, -0.55749316f, -0.55827817f, -0.55903280f, -0.55975630f, -0.56044800f, -0.56110728f, -0.56173358f,
-    -0.56232643f, -0.56288539f, -0.56341013f, -0.56390037f, -0.56435588f, -0.56477654f, -0.56516227f, -0.56551308f,
-    -0.56582903f, -0.56611028f, -0.56635703f, -0.56656959f, -0.56674830f, -0.56689359f, -0.56700596f, -0.56708597f,
-    -0.56713427f, -0.56715155f, -0.56713857f, -0.56709616f, -0.56702522f, -0.56692669f, -0.56680159f, -0.56665097f,
-    -0.56647597f, -0.56627776f, -0.56605756f, -0.56581664f, -0.56555632f, -0.56527796f, -0.56498296f, -0.56467276f,
-    -0.56434883f, -0.56401268f, -0.56366583f, -0.56330985f, -0.56294632f, -0.56257684f, -0.56220303f, -0.56182650f,
-    -0.56144891f, -0.56107189f, -0.56069710f, -0.56032618f, -0.55996078f, -0.55960252f, -0.55925305f, -0.55891396f,
-    -0.55858685f, -0.55827330f, -0.55797485f, -0.55769304f, -0.55742935f, -0.55718523f, -0.55696213f, -0.55676141f,
-    -0.55658442f, -0.55643246f, -0.55630677f, -0.55620855f, -0.55613895f, -0.55609906f, -0.55608990f, -0.55611245f,
-    -0.55616762f, -0.55625625f, -0.55637912f, -0.55653693f, -0.55673034f, -0.55695990f, -0.55722611f, -0.55752940f,
-    -0.55787012f, -0.55824853f, -0.55866484f, -0.55911916f, -0.55961153f, -0.56014192f, -0.56071022f, -0.56131623f,
-    -0.56195968f, -0.56264023f, -0.56335746f, -0.56411086f, -0.56489986f, -0.56572381f, -0.56658199f, -0.56747361f,
-    -0.56839779f, -0.56935361f, -0.57034007f, -0.57135610f, -0.57240056f, -0.57347228f, -0.57457000f, -0.57569241f,
-    -0.57683816f, -0.57800583f, -0.57919396f, -0.58040105f, -0.58162555f, -0.58286587f, -0.58412038f, -0.58538743f,
-    -0.58666532f, -0.58795235f, -0.58924677f, -0.59054682f, -0.59185073f, -0.59315671f, -0.59446296f, -0.59576768f,
-    -0.59706907f, -0.59836532f, -0.59965463f, -0.60093521f, -0.60220530f, -0.60346313f, -0.60470696f, -0.60593508f,
-    -0.60714579f, -0.60833745f, -0.60950842f, -0.61065713f, -0.61178203f, -0.61288162f, -0.61395445f, -0.61499911f,
-    -0.61601426f, -0.61699861f, -0.61795091f, -0.61887001f, -0.61975480f, -0.62060423f, -0.62141734f, -0.62219323f,
-    -0.62293108f, -0.62363013f, -0.62428971f, -0.62490922f, -0.62548817f, -0.62602610f, -0.62652268f, -0.62697764f,
-    -0.62739079f, -0.62776205f, -0.62809139f, -0.62837889f, -0.62862471f, -0.62882910f, -0.62899239f, -0.62911499f,
-    -0.62919741f, -0.62924023f, -0.62924411f, -0.62920981f, -0.62913816f, -0.62903005f, -0.62888649f, -0.62870851f,
-    -0.62849727f, -0.62825397f, -0.62797988f, -0.62767634f, -0.62734475f, -0.62698660f, -0.62660339f, -0.62619672f,
-    -0.62576822f, -0.62531958f, -0.62485251f, -0.62436881f, -0.62387028f, -0.62335877f, -0.62283617f, -0.62230438f,
-    -0.62176535f, -0.62122102f, -0.62067337f, -0.62012438f, -0.61957606f, -0.61903039f, -0.61848939f, -0.61795505f,
-    -0.61742936f, -0.61691430f, -0.61641183f, -0.61592390f, -0.61545243f, -0.61499931f, -0.61456641f, -0.61415555f,
-    -0.61376851f, -0.61340705f, -0.61307287f, -0.61276760f, -0.61249285f, -0.61225015f, -0.61204098f, -0.61186674f,
-    -0.61172880f, -0.61162842f, -0.61156680f, -0.61154509f, -0.61156432f, -0.61162546f, -0.61172942f, -0.61187698f,
-    -0.61206887f, -0.61230571f, -0.61258805f, -0.61291634f, -0.61329092f, -0.61371207f, -0.61417994f, -0.61469462f,
-    -0.61525608f, -0.61586420f, -0.61651877f, -0.61721949f, -0.61796594f, -0.61875762f, -0.61959395f, -0.62047424f,
-    -0.62139770f, -0.62236347f, -0.62337059f, -0.62441801f, -0.62550459f, -0.62662913f, -0.62779032f, -0.62898678f,
-    -0.63021706f, -0.63147963f, -0.63277289f, -0.63409516f, -0.63544472f, -0.63681977f, -0.63821845f, -0.63963885f,
-    -0.64107902f, -0.64253694f, -0.64401057f, -0.64549780f, -0.64699652f, -0.64850457f, -0.65001976f, -0.65153989f,
-    -0.65306273f, -0.65458604f, -0.65610757f, -0.65762508f, -0.65913631f, -0.66063901f, -0.66213094f, -0.66360988f,
-    -0.66507362f, -0.66651998f, -0.66794680f, -0.66935196f, -0.67073337f, -0.67208898f, -0.67341678f, -0.67471483f,
-    -0.67598123f, -0.67721413f, -0.67841176f, -0.67957239f, -0.68069438f, -0.68177616f, -0.68281623f, -0.68381317f,
-    -0.68476565f, -0.68567242f, -0.68653230f, -0.68734425f, -0.68810727f, -0.68882049f, -0.68948313f, -0.69009451f,
-    -0.69065403f, -0.69116124f, -0.69161576f, -0.69201733f, -0.69236578f, -0.69266106f, -0.69290324f, -0.69309249f,
-    -0.69322907f, -0.69331337f, -0.69334589f, -0.69332723f, -0.69325809f, -0.69313929f, -0.69297174f, -0.69275647f,
-    -0.69249460f, -0.69218735f, -0.69183604f, -0.69144209f, -0.69100700f, -0.69053238f, -0.69001990f, -0.68947135f,
-    -0.68888856f, -0.68827348f, -0.68762809f, -0.68695447f, -0.68625477f, -0.68553118f, -0.68478596f, -0.68402142f,
-    -0.68323993f, -0.68244389f, -0.68163574f, -0.68081797f, -0.67999309f, -0.67916363f, -0.67833215f, -0.67750122f,
-    -0.67667343f, -0.67585136f, -0.67503759f, -0.67423470f, -0.67344526f, -0.67267183f, -0.67191694f, -0.67118308f,
-    -0.67047273f, -0.66978832f, -0.66913225f, -0.66850687f, -0.66791445f, -0.66735725f, -0.66683743f, -0.66635710f,
-    -0.66591829f, -0.66552297f, -0.66517301f, -0.66487022f, -0.66461629f, -0.66441285f, -0.66426141f, -0.66416340f,
-    -0.66412013f, -0.66413282f, -0.66420257f, -0.66433037f, -0.66451711f, -0.66476353f, -0.66507030f, -0.66543793f,
-    -0.66586683f, -0.66635727f, -0.66690941f, -0.66752327f, -0.66819878f, -0.66893569f, -0.66973368f, -0.67059225f,
-    -0.67151081f, -0.67248863f, -0.67352487f, -0.67461855f, -0.67576858f, -0.67697375f, -0.67823271f, -0.67954402f,
-    -0.68090612f, -0.68231734f, -0.68377589f, -0.68527988f, -0.68682733f, -0.68841614f, -0.69004414f, -0.69170906f,
-    -0.69340852f, -0.69514010f, -0.69690128f, -0.69868945f, -0.70050197f, -0.70233610f, -0.70418908f, -0.70605806f,
-    -0.70794017f, -0.70983248f, -0.71173204f, -0.71363587f, -0.71554095f, -0.71744425f, -0.71934273f, -0.72123336f,
-    -0.72311307f, -0.72497885f, -0.72682764f, -0.72865646f, -0.73046231f, -0.73224225f, -0.73399336f, -0.73571277f,
-    -0.73739766f, -0.73904527f, -0.74065288f, -0.74221786f, -0.74373765f, -0.74520977f, -0.74663180f, -0.74800143f,
-    -0.74931645f, -0.75057473f, -0.75177426f, -0.75291314f, -0.75398956f, -0.75500185f, -0.75594846f, -0.75682795f,
-    -0.75763903f, -0.75838051f, -0.75905138f, -0.75965073f, -0.76017780f, -0.76063199f, -0.76101283f, -0.76131999f,
-    -0.76155330f, -0.76171274f, -0.76179844f, -0.76181066f, -0.76174985f, -0.76161658f, -0.76141157f, -0.76113572f,
-    -0.76079004f, -0.76037572f, -0.75989409f, -0.75934660f, -0.75873488f, -0.75806067f, -0.75732586f, -0.75653249f,
-    -0.75568269f, -0.75477876f, -0.75382310f, -0.75281824f, -0.75176681f, -0.75067158f, -0.74953539f, -0.74836121f,
-    -0.74715209f, -0.74591118f, -0.74464169f, -0.74334694f, -0.74203031f, -0.74069523f, -0.73934520f, -0.73798379f,
-    -0.73661459f, -0.73524123f, -0.73386739f, -0.73249677f, -0.73113306f, -0.72977999f, -0.72844128f, -0.72712066f,
-    -0.72582181f, -0.72454843f, -0.72330417f, -0.72209265f, -0.72091745f, -0.71978209f, -0.71869005f, -0.71764472f,
-    -0.71664945f, -0.71570748f, -0.71482198f, -0.71399602f, -0.71323257f, -0.71253449f, -0.71190455f, -0.71134537f,
-    -0.71085945f, -0.71044918f, -0.71011679f, -0.70986438f, -0.70969388f, -0.70960710f, -0.70960568f, -0.70969109f,
-    -0.70986463f, -0.71012745f, -0.71048052f, -0.71092463f, -0.71146038f, -0.71208821f, -0.71280837f, -0.71362092f,
-    -0.71452573f, -0.71552248f, -0.71661068f, -0.71778964f, -0.71905848f, -0.72041612f, -0.72186131f, -0.72339261f,
-    -0.72500838f, -0.72670683f, -0.72848595f, -0.73034358f, -0.73227736f, -0.73428478f, -0.73636316f, -0.73850964f,
-    -0.74072122f, -0.74299471f, -0.74532683f, -0.74771409f, -0.75015291f, -0.75263955f, -0.75517015f, -0.75774075f,
-    -0.76034724f, -0.76298545f, -0.76565107f, -0.76833973f, -0.77104695f, -0.77376821f, -0.77649891f, -0.77923437f,
-    -0.78196991f, -0.78470076f, -0.78742216f, -0.79012931f, -0.79281740f, -0.79548163f, -0.79811718f, -0.80071929f,
-    -0.80328318f, -0.80580414f, -0.80827750f, -0.81069864f, -0.81306299f, -0.81536610f, -0.81760355f, -0.81977106f,
-    -0.82186442f, -0.82387955f, -0.82581249f, -0.82765941f, -0.82941660f, -0.83108053f, -0.83264781f, -0.83411521f,
-    -0.83547966f, -0.83673831f, -0.83788846f, -0.83892761f, -0.83985346f, -0.84066394f, -0.84135716f, -0.84193146f,
-    -0.84238541f, -0.84271780f, -0.84292765f, -0.84301424f, -0.84297706f, -0.84281585f, -0.84253063f, -0.84212161f,
-    -0.84158931f, -0.84093446f, -0.84015806f, -0.83926137f, -0.83824589f, -0.83711338f, -0.83586586f, -0.83450559f,
-    -0.83303508f, -0.83145710f, -0.82977463f, -0.82799094f, -0.82610950f, -0.82413402f, -0.82206845f, -0.81991694f,
-    -0.81768388f, -0.81537386f, -0.81299166f, -0.81054229f, -0.80803092f, -0.80546290f, -0.80284378f, -0.80017924f,
-    -0.79747515f, -0.79473748f, -0.79197239f, -0.78918611f, -0.78638502f, -0.78357559f, -0.78076439f, -0.77795806f,
-    -0.77516331f, -0.77238692f, -0.76963570f, -0.76691649f, -0.76423615f, -0.76160157f, -0.75901960f, -0.75649708f,
-    -0.75404082f, -0.75165760f, -0.74935411f, -0.74713698f, -0.74501276f, -0.74298789f, -0.74106870f, -0.73926139f,
-    -0.73757202f, -0.73600651f, -0.73457059f, -0.73326982f, -0.73210959f, -0.73109505f, -0.73023116f, -0.72952263f,
-    -0.72897394f, -0.72858934f, -0.72837277f, -0.72832793f, -0.72845822f, -0.72876676f, -0.72925636f, -0.72992950f,
-    -0.73078836f, -0.73183478f, -0.73307025f, -0.73449594f, -0.73611263f, -0.73792077f, -0.73992044f, -0.74211133f,
-    -0.74449278f, -0.74706373f, -0.74982273f, -0.75276798f, -0.75589724f, -0.75920792f, -0.76269702f, -0.76636114f,
-    -0.77019649f, -0.77419891f, -0.77836382f, -0.78268625f, -0.78716087f, -0.79178195f, -0.79654337f, -0.80143865f,
-    -0.80646094f, -0.81160301f, -0.81685729f, -0.82221585f, -0.82767042f, -0.83321240f, -0.83883285f, -0.84452252f,
-    -0.85027187f, -0.85607103f, -0.86190989f, -0.86777802f, -0.87366476f, -0.87955920f, -0.88545018f, -0.89132633f,
-    -0.89717608f, -0.90298766f, -0.90874912f, -0.91444836f, -0.92007311f, -0.92561101f, -0.93104955f, -0.93637614f,
-    -0.94157812f, -0.94664275f, -0.95155726f, -0.95630885f, -0.96088471f, -0.96527204f, -0.96945807f, -0.97343008f,
-    -0.97717540f, -0.98068147f, -0.98393582f, -0.98692608f, -0.98964005f, -0.99206567f, -0.99419106f, -0.99600453f,
-    -0.99749462f, -0.99865008f, -0.99945990f, -0.99991336f, -1.00000000f, -0.99970967f, -0.99903254f, -0.99795908f,
-    -0.99648015f, -0.99458694f, -0.99227103f, -0.98952438f, -0.98633938f, -0.98270880f, -0.97862587f, -0.97408426f,
-    -0.96907810f, -0.96360196f, -0.95765091f, -0.95122052f, -0.94430682f, -0.93690638f, -0.92901626f, -0.92063406f,
-    -0.91175789f, -0.90238640f, -0.89251879f, -0.88215479f, -0.87129468f, -0.85993929f, -0.84809000f, -0.83574876f,
-    -0.82291804f, -0.80960091f, -0.79580095f, -0.78152232f, -0.76676971f, -0.75154839f, -0.73586413f, -0.71972327f,
-    -0.70313266f, -0.68609969f, -0.66863227f, -0.65073881f, -0.63242824f, -0.61370996f, -0.59459388f, -0.57509036f,
-    -0.55521025f, -0.53496482f, -0.51436580f, -0.49342533f, -0.47215598f, -0.45057069f, -0.42868281f, -0.40650603f,
-    -0.38405441f, -0.36134233f, -0.33838449f, -0.31519590f, -0.29179184f, -0.26818786f, -0.24439973f, -0.22044349f,
-    -0.19633534f, -0.17209169f, -0.14772912f, -0.12326433f, -0.09871418f, -0.07409562f, -0.04942566f, -0.02472141f,
+alignas(4) const int16_t waveform_Saw[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+         0,   1620,   3235,   4841,   6433,   8008,   9561,  11088,  12584,  14047,  15471,  16854,  18193,  19483,  20723,  21909,
+     23040,  24112,  25125,  26076,  26965,  27789,  28550,  29245,  29876,  30441,  30942,  31379,  31754,  32067,  32319,  32514,
+     32652,  32735,  32767,  32749,  32685,  32577,  32428,  32241,  32019,  31766,  31485,  31180,  30853,  30508,  30148,  29777,
+     29398,  29014,  28627,  28242,  27861,  27486,  27120,  26766,  26425,  26100,  25793,  25505,  25237,  24991,  24768,  24569,
+     24395,  24245,  24120,  24021,  23946,  23896,  23869,  23867,  23886,  23927,  23989,  24070,  24168,  24283,  24412,  24554,
+     24708,  24871,  25042,  25219,  25400,  25583,  25767,  25951,  26131,  26307,  26477,  26639,  26793,  26937,  27069,  27189,
+     27296,  27389,  27467,  27529,  27576,  27607,  27622,  27620,  27602,  27569,  27519,  27455,  27376,  27283,  27177,  27059,
+     26930,  26790,  26642,  26485,  26321,  26152,  25978,  25801,  25623,  25444,  25265,  25088,  24914,  24745,  24580,  24422,
+     24271,  24128,  23995,  23870,  23756,  23653,  23561,  23481,  23413,  23357,  23312,  23280,  23260,  23252,  23255,  23268,
+     23293,  23327,  23370,  23423,  23482,  23549,  23622,  23701,  23783,  23869,  23957,  24047,  24137,  24226,  24314,  24400,
+     24482,  24560,  24633,  24701,  24761,  24815,  24861,  24899,  24929,  24949,  24960,  24962,  24954,  24936,  24909,  24872,
+     24826,  24770,  24706,  24633,  24553,  24465,  24370,  24269,  24162,  24051,  23935,  23816,  23694,  23571,  23446,  23321,
+     23197,  23074,  22953,  22835,  22721,  22611,  22505,  22405,  22311,  22224,  22143,  22069,  22003,  21945,  21895,  21853,
+     21818,  21792,  21774,  21764,  21761,  21766,  21777,  21796,  21820,  21850,  21886,  21925,  21969,  22017,  22067,  22119,
+     22173,  22227,  22281,  22335,  22388,  22438,  22487,  22532,  22573,  22610,  22642,  22669,  22691,  22707,  22716,  22719,
+     22715,  22704,  22687,  22662,  22631,  22592,  22547,  22496,  22438,  22374,  22304,  22230,  22150,  22066,  21978,  21887,
+     21792,  21696,  21598,  21499,  21399,  21299,  21200,  21102,  21006,  20913,  20822,  20734,  20650,  20571,  20496,  20426,
+     20361,  20302,  20249,  20201,  20160,  20125,  20096,  20073,  20056,  20045,  20039,  20039,  20045,  20055,  20070,  20089,
+     20111,  20137,  20167,  20198,  20231,  20266,  20302,  20338,  20373,  20408,  20442,  20475,  20505,  20532,  20556,  20577,
+     20594,  20607,  20615,  20618,  20617,  20610,  20598,  20581,  20558,  20529,  20495,  20456,  20412,  20362,  20308,  20248,
+     20185,  20117,  20046,  19972,  19894,  19814,  19732,  19649,  19564,  19479,  19393,  19308,  19223,  19140,  19058,  18978,
+     18901,  18827,  18756,  18688,  18625,  18565,  18510,  18460,  18414,  18373,  18337,  18306,  18280,  18259,  18242,  18231,
+     18224,  18221,  18223,  18229,  18238,  18250,  18265,  18283,  18303,  18325,  18348,  18372,  18397,  18422,  18446,  18470,
+     18492,  18513,  18532,  18548,  18562,  18572,  18580,  18583,  18583,  18579,  18571,  18558,  18541,  18519,  18492,  18461,
+     18426,  18386,  18342,  18293,  18241,  18185,  18125,  18062,  17996,  17928,  17857,  17784,  17710,  17635,  17558,  17482,
+     17405,  17329,  17254,  17180,  17108,  17037,  16969,  16903,  16840,  16781,  16725,  16672,  16623,  16578,  16538,  16501,
+     16469,  16441,  16417,  16397,  16381,  16370,  16362,  16358,  16357,  16359,  16365,  16373,  16383,  16396,  16410,  16425,
+     16442,  16459,  16476,  16493,  16510,  16526,  16540,  16553,  16565,  16573,  16580,  16584,  16584,  16582,  16576,  16566,
+     16553,  16536,  16515,  16490,  16461,  16428,  16392,  16351,  16307,  16259,  16208,  16154,  16097,  16037,  15974,  15910,
+     15844,  15776,  15707,  15637,  15567,  15497,  15427,  15357,  15288,  15221,  15155,  15091,  15029,  14969,  14913,  14859,
+     14808,  14760,  14716,  14675,  14638,  14605,  14575,  14549,  14527,  14508,  14493,  14481,  14473,  14468,  14465,  14466,
+     14469,  14474,  14481,  14489,  14499,  14510,  14522,  14534,  14546,  14558,  14569,  14579,  14588,  14596,  14602,  14605,
+     14606,  14605,  14601,  14594,  14584,  14570,  14553,  14533,  14509,  14482,  14451,  14417,  14379,  14338,  14294,  14246,
+     14196,  14143,  14088,  14030,  13970,  13909,  13846,  13781,  13716,  13651,  13585,  13519,  13453,  13388,  13324,  13262,
+     13201,  13141,  13084,  13029,  12977,  12927,  12880,  12836,  12795,  12758,  12723,  12692,  12665,  12641,  12620,  12602,
+     12587,  12576,  12567,  12561,  12558,  12557,  12558,  12561,  12566,  12572,  12578,  12586,  12594,  12603,  12611,  12619,
+     12626,  12632,  12637,  12640,  12642,  12641,  12638,  12633,  12625,  12615,  12601,  12585,  12565,  12542,  12516,  12487,
+     12455,  12419,  12381,  12339,  12294,  12247,  12197,  12145,  12091,  12035,  11977,  11917,  11857,  11795,  11733,  11670,
+     11607,  11545,  11483,  11421,  11361,  11302,  11245,  11189,  11135,  11084,  11035,  10988,  10944,  10903,  10865,  10830,
+     10798,  10769,  10744,  10721,  10701,  10684,  10670,  10659,  10650,  10644,  10640,  10638,  10638,  10640,  10642,  10646,
+     10651,  10656,  10662,  10667,  10673,  10677,  10681,  10684,  10686,  10686,  10684,  10680,  10674,  10666,  10655,  10642,
+     10626,  10607,  10585,  10560,  10532,  10501,  10468,  10431,  10391,  10349,  10304,  10257,  10208,  10156,  10102,  10047,
+      9991,   9933,   9874,   9814,   9754,   9693,   9633,   9573,   9514,   9455,   9398,   9342,   9287,   9234,   9184,   9135,
+      9089,   9045,   9004,   8965,   8929,   8896,   8866,   8839,   8815,   8793,   8775,   8759,   8745,   8734,   8726,   8719,
+      8715,   8713,   8712,   8712,   8713,   8716,   8719,   8722,   8726,   8729,   8732,   8735,   8736,   8736,   8735,   8733,
+      8729,   8722,   8714,   8703,   8690,   8674,   8656,   8635,   8611,   8584,   8555,   8522,   8487,   8450,   8409,   8367,
+      8321,   8274,   8224,   8173,   8120,   8065,   8009,   7953,   7895,   7837,   7778,   7720,   7661,   7603,   7546,   7490,
+      7434,   7381,   7328,   7278,   7230,   7183,   7139,   7098,   7058,   7022,   6988,   6957,   6929,   6903,   6880,   6860,
+      6842,   6827,   6814,   6804,   6796,   6789,   6785,   6782,   6780,   6780,   6781,   6782,   6784,   6786,   6788,   6789,
+      6791,   6791,   6791,   6789,   6786,   6781,   6775,   6766,   6756,   6743,   6728,   6710,   6690,   6667,   6641,   6613,
+      6582,   6548,   6512,   6474,   6432,   6389,   6343,   6295,   6246,   6194,   6141,   6087,   6032,   5976,   5919,   5862,
+      5805,   5747,   5690,   5634,   5578,   5524,   5470,   5418,   5368,   5320,   5273,   5229,   5187,   5147,   5110,   5075,
+      5043,   5013,   4987,   4962,   4941,   4922,   4905,   4891,   4879,   4869,   4861,   4855,   4851,   4848,   4846,   4845,
+      4845,   4846,   4847,   4848,   4848,   4849,   4849,   4848,   4846,   4843,   4838,   4831,   4823,   4813,   4800,   4786,
+      4769,   4749,   4727,   4703,   4676,   4646,   4613,   4579,   4541,   4501,   4459,   4415,   4369,   4320,   4270,   4219,
+      4166,   4112,   4057,   4001,   3945,   3889,   3832,   3776,   3720,   3665,   3611,   3557,   3505,   3455,   3406,   3360,
+      3315,   3272,   3232,   3194,   3158,   3125,   3094,   3067,   3041,   3018,   2998,   2980,   2965,   2951,   2940,   2931,
+      2924,   2918,   2914,   2911,   2909,   2908,   2908,   2908,   2908,   2909,   2909,   2908,   2907,   2905,   2902,   2897,
+      2891,   2883,   2873,   2861,   2847,   2831,   2812,   2791,   2768,   2742,   2713,   2682,   2648,   2612,   2573,   2533,
+      2489,   2444,   2397,   2348,   2298,   2246,   2193,   2139,   2084,   2028,   1972,   1916,   1860,   1805,   1750,   1695,
+      1642,   1590,   1539,   1490,   1443,   1398,   1354,   1313,   1274,   1238,   1204,   1172,   1143,   1117,   1093,   1071,
+      1052,   1035,   1021,   1009,    999,    990,    984,    978,    975,    972,    971,    970,    969,    969,    969,    969,
+       969,    968,    966,    963,    958,    953,    945,    936,    925,    912,    896,    879,    859,    836,    811,    783,
+       753,    721,    686,    648,    608,    566,    522,    476,    428,    378,    327,    275,    221,    167,    111,     56,
+         0,    -56,   -111,   -167,   -221,   -275,   -327,   -378,   -428,   -476,   -522,   -566,   -608,   -648,   -686,   -721,
+      -753,   -783,   -811,   -836,   -859,   -879,   -896,   -912,   -925,   -936,   -945,   -953,   -958,   -963,   -966,   -968,
+      -969,   -969,   -969,   -969,   -969,   -970,   -971,   -972,   -975,   -978,   -984,   -990,   -999,  -1009,  -1021,  -1035,
+     -1052,  -1071,  -1093,  -1117,  -1143,  -1172,  -1204,  -1238,  -1274,  -1313,  -1354,  -1398,  -1443,  -1490,  -1539,  -1590,
+     -1642,  -1695,  -1750,  -1805,  -1860,  -1916,  -1972,  -2028,  -2084,  -2139,  -2193,  -2246,  -2298,  -2348,  -2397,  -2444,
+     -2489,  -2533,  -2573,  -2612,  -2648,  -2682,  -2713,  -2742,  -2768,  -2791,  -2812,  -2831,  -2847,  -2861,  -2873,  -2883,
+     -2891,  -2897,  -2902,  -2905,  -2907,  -2908,  -2909,  -2909,  -2908,  -2908,  -2908,  -2908,  -2909,  -2911,  -2914,  -2918,
+     -2924,  -2931,  -2940,  -2951,  -2965,  -2980,  -2998,  -3018,  -3041,  -3067,  -3094,  -3125,  -3158,  -3194,  -3232,  -3272,
+     -3315,  -3360,  -3406,  -3455,  -3505,  -3557,  -3611,  -3665,  -3720,  -3776,  -3832,  -3889,  -3945,  -4001,  -4057,  -4112,
+     -4166,  -4219,  -4270,  -4320,  -4369,  -4415,  -4459,  -4501,  -4541,  -4579,  -4613,  -4646,  -4676,  -4703,  -4727,  -4749,
+     -4769,  -4786,  -4800,  -4813,  -4823,  -4831,  -4838,  -4843,  -4846,  -4848,  -4849,  -4849,  -4848,  -4848,  -4847,  -4846,
+     -4845,  -4845,  -4846,  -4848,  -4851,  -4855,  -4861,  -4869,  -4879,  -4891,  -4905,  -4922,  -4941,  -4962,  -4987,  -5013,
+     -5043,  -5075,  -5110,  -5147,  -5187,  -5229,  -5273,  -5320,  -5368,  -5418,  -5470,  -5524,  -5578,  -5634,  -5690,  -5747,
+     -5805,  -5862,  -5919,  -5976,  -6032,  -6087,  -6141,  -6194,  -6246,  -6295,  -6343,  -6389,  -6432,  -6474,  -6512,  -6548,
+     -6582,  -6613,  -6641,  -6667,  -6690,  -6710,  -6728,  -6743,  -6756,  -6766,  -6775,  -6781,  -6786,  -6789,  -6791,  -6791,
+     -6791,  -6789,  -6788,  -6786,  -6784,  -6782,  -6781,  -6780,  -6780,  -6782,  -6785,  -6789,  -6796,  -6804,  -6814,  -6827,
+     -6842,  -6860,  -6880,  -6903,  -6929,  -6957,  -6988,  -7022,  -7058,  -7098,  -7139,  -7183,  -7230,  -7278,  -7328,  -7381,
+     -7434,  -7490,  -7546,  -7603,  -7661,  -7720,  -7778,  -7837,  -7895,  -7953,  -8009,  -8065,  -8120,  -8173,  -8224,  -8274,
+     -8321,  -8367,  -8409,  -8450,  -8487,  -8522,  -8555,  -8584,  -8611,  -8635,  -8656,  -8674,  -8690,  -8703,  -8714,  -8722,
+     -8729,  -8733,  -8735,  -8736,  -8736,  -8735,  -8732,  -8729,  -8726,  -8722,  -8719,  -8716,  -8713,  -8712,  -8712,  -8713,
+     -8715,  -8719,  -8726,  -8734,  -8745,  -8759,  -8775,  -8793,  -8815,  -8839,  -8866,  -8896,  -8929,  -8965,  -9004,  -9045,
+     -9089,  -9135,  -9184,  -9234,  -9287,  -9342,  -9398,  -9455,  -9514,  -9573,  -9633,  -9693,  -9754,  -9814,  -9874,  -9933,
+     -9991, -10047, -10102, -10156, -10208, -10257, -10304, -10349, -10391, -10431, -10468, -10501, -10532, -10560, -10585, -10607,
+    -10626, -10642, -10655, -10666, -10674, -10680, -10684, -10686, -10686, -10684, -10681, -10677, -10673, -10667, -10662, -10656,
+    -10651, -10646, -10642, -10640, -10638, -10638, -10640, -10644, -10650, -10659, -10670, -10684, -10701, -10721, -10744, -10769,
+    -10798, -10830, -10865, -10903, -10944, -10988, -11035, -11084, -11135, -11189, -11245, -11302, -11361, -11421, -11483, -11545,
+    -11607, -11670, -11733, -11795, -11857, -11917, -11977, -12035, -12091, -12145, -12197, -12247, -12294, -12339, -12381, -12419,
+    -12455, -12487, -12516, -12542, -12565, -12585, -12601, -12615, -12625, -12633, -12638, -12641, -12642, -12640, -12637, -12632,
+    -12626, -12619, -12611, -12603, -12594, -12586, -12578, -12572, -12566, -12561, -12558, -12557, -12558, -12561, -12567, -12576,
+    -12587, -12602, -12620, -12641, -12665, -12692, -12723, -12758, -12795, -12836, -12880, -12927, -12977, -13029, -13084, -13141,
+    -13201, -13262, -13324, -13388, -13453, -13519, -13585, -13651, -13716, -13781, -13846, -13909, -13970, -14030, -14088, -14143,
+    -14196, -14246, -14294, -14338, -14379, -14417, -14451, -14482, -14509, -14533, -14553, -14570, -14584, -14594, -14601, -14605,
+    -14606, -14605, -14602, -14596, -14588, -14579, -14569, -14558, -14546, -14534, -14522, -14510, -14499, -14489, -14481, -14474,
+    -14469, -14466, -14465, -14468, -14473, -14481, -14493, -14508, -14527, -14549, -14575, -14605, -14638, -14675, -14716, -14760,
+    -14808, -14859, -14913, -14969, -15029, -15091, -15155, -15221, -15288, -15357, -15427, -15497, -15567, -15637, -15707, -15776,
+    -15844, -15910, -15974, -16037, -16097, -16154, -16208, -16259, -16307, -16351, -16392, -16428, -16461, -16490, -16515, -16536,
+    -16553, -16566, -16576, -16582, -16584, -16584, -16580, -16573, -16565, -16553, -16540, -16526, -16510, -16493, -16476, -16459,
+    -16442, -16425, -16410, -16396, -16383, -16373, -16365, -16359, -16357, -16358, -16362, -16370, -16381, -16397, -16417, -16441,
+    -16469, -16501, -16538, -16578, -16623, -16672, -16725, -16781, -16840, -16903, -16969, -17037, -17108, -17180, -17254, -17329,
+    -17405, -17482, -17558, -17635, -17710, -17784, -17857, -17928, -17996, -18062, -18125, -18185, -18241, -18293, -18342, -18386,
+    -18426, -18461, -18492, -18519, -18541, -18558, -18571, -18579, -18583, -18583, -18580, -18572, -18562, -18548, -18532, -18513,
+    -18492, -18470, -18446, -18422, -18397, -18372, -18348, -18325, -18303, -18283, -18265, -18250, -18238, -18229, -18223, -18221,
+    -18224, -18231, -18242, -18259, -18280, -18306, -18337, -18373, -18414, -18460, -18510, -18565, -18625, -18688, -18756, -18827,
+    -18901, -18978, -19058, -19140, -19223, -19308, -19393, -19479, -19564, -19649, -19732, -19814, -19894, -19972, -20046, -20117,
+    -20185, -20248, -20308, -20362, -20412, -20456, -20495, -20529, -20558, -20581, -20598, -20610, -20617, -20618, -20615, -20607,
+    -20594, -20577, -20556, -20532, -20505, -20475, -20442, -20408, -20373, -20338, -20302, -20266, -20231, -20198, -20167, -20137,
+    -20111, -20089, -20070, -20055, -20045, -20039, -20039, -20045, -20056, -20073, -20096, -20125, -20160, -20201, -20249, -20302,
+    -20361, -20426, -20496, -20571, -20650, -20734, -20822, -20913, -21006, -21102, -21200, -21299, -21399, -21499, -21598, -21696,
+    -21792, -21887, -21978, -22066, -22150, -22230, -22304, -22374, -22438, -22496, -22547, -22592, -22631, -22662, -22687, -22704,
+    -22715, -22719, -22716, -22707, -22691, -22669, -22642, -22610, -22573, -22532, -22487, -22438, -22388, -22335, -22281, -22227,
+    -22173, -22119, -22067, -22017, -21969, -21925, -21886, -21850, -21820, -21796, -21777, -21766, -21761, -21764, -21774, -21792,
+    -21818, -21853, -21895, -21945, -22003, -22069, -22143, -22224, -22311, -22405, -22505, -22611, -22721, -22835, -22953, -23074,
+    -23197, -23321, -23446, -23571, -23694, -23816, -23935, -24051, -24162, -24269, -24370, -24465, -24553, -24633, -24706, -24770,
+    -24826, -24872, -24909, -24936, -24954, -24962, -24960, -24949, -24929, -24899, -24861, -24815, -24761, -24701, -24633, -24560,
+    -24482, -24400, -24314, -24226, -24137, -24047, -23957, -23869, -23783, -23701, -23622, -23549, -23482, -23423, -23370, -23327,
+    -23293, -23268, -23255, -23252, -23260, -23280, -23312, -23357, -23413, -23481, -23561, -23653, -23756, -23870, -23995, -24128,
+    -24271, -24422, -24580, -24745, -24914, -25088, -25265, -25444, -25623, -25801, -25978, -26152, -26321, -26485, -26642, -26790,
+    -26930, -27059, -27177, -27283, -27376, -27455, -27519, -27569, -27602, -27620, -27622, -27607, -27576, -27529, -27467, -27389,
+    -27296, -27189, -27069, -26937, -26793, -26639, -26477, -26307, -26131, -25951, -25767, -25583, -25400, -25219, -25042, -24871,
+    -24708, -24554, -24412, -24283, -24168, -24070, -23989, -23927, -23886, -23867, -23869, -23896, -23946, -24021, -24120, -24245,
+    -24395, -24569, -24768, -24991, -25237, -25505, -25793, -26100, -26425, -26766, -27120, -27486, -27861, -28242, -28627, -29014,
+    -29398, -29777, -30148, -30508, -30853, -31180, -31485, -31766, -32019, -32241, -32428, -32577, -32685, -32749, -32767, -32735,
+    -32652, -32514, -32319, -32067, -31754, -31379, -30942, -30441, -29876, -29245, -28550, -27789, -26965, -26076, -25125, -24112,
+    -23040, -21909, -20723, -19483, -18193, -16854, -15471, -14047, -12584, -11088,  -9561,  -8008,  -6433,  -4841,  -3235,  -1620,
+    
+    // Level 1: 1024 samples, 511 harmonics
+         0,   3235,   6433,   9561,  12584,  15471,  18193,  20723,  23040,  25125,  26965,  28550,  29876,  30942,  31754,  32319,
+     32652,  32767,  32685,  32428,  32019,  31485,  30853,  30148,  29398,  28627,  27861,  27120,  26425,  25793,  25237,  24768,
+     24395,  24120,  23946,  23869,  23886,  23989,  24168,  24412,  24708,  25042,  25400,  25767,  26131,  26477,  26793,  27069,
+     27296,  27467,  27576,  27622,  27602,  27519,  27376,  27177,  26930,  26642,  26321,  25978,  25623,  25265,  24914,  24580,
+     24271,  23995,  23756,  23561,  23413,  23312,  23260,  23255,  23293,  23370,  23482,  23622,  23783,  23957,  24137,  24314,
+     24482,  24633,  24761,  24861,  24929,  24960,  24954,  24909,  24826,  24706,  24553,  24370,  24162,  23935,  23694,  23446,
+     23197,  22953,  22721,  22505,  22311,  22143,  22003,  21895,  21818,  21774,  21761,  21777,  21820,  21886,  21969,  22067,
+     22173,  22281,  22388,  22487,  22573,  22642,  22691,  22716,  22715,  22687,  22631,  22547,  22438,  22304,  22150,  21978,
+     21792,  21598,  21399,  21200,  21006,  20822,  20650,  20496,  20361,  20249,  20160,  20096,  20056,  20039,  20045,  20070,
+     20111,  20167,  20231,  20302,  20373,  20442,  20505,  20556,  20594,  20615,  20617,  20598,  20558,  20495,  20412,  20308,
+     20185,  20046,  19894,  19732,  19564,  19393,  19223,  19058,  18901,  18756,  18625,  18510,  18414,  18337,  18280,  18242,
+     18224,  18223,  18238,  18265,  18303,  18348,  18397,  18446,  18492,  18532,  18562,  18580,  18583,  18571,  18541,  18492,
+     18426,  18342,  18241,  18125,  17996,  17857,  17710,  17558,  17405,  17254,  17108,  16969,  16840,  16725,  16623,  16538,
+     16469,  16417,  16381,  16362,  16357,  16365,  16383,  16410,  16442,  16476,  16510,  16540,  16565,  16580,  16584,  16576,
+     16553,  16515,  16461,  16392,  16307,  16208,  16097,  15974,  15844,  15707,  15567,  15427,  15288,  15155,  15029,  14913,
+     14808,  14716,  14638,  14575,  14527,  14493,  14473,  14465,  14469,  14481,  14499,  14522,  14546,  14569,  14588,  14602,
+     14606,  14601,  14584,  14553,  14509,  14451,  14379,  14294,  14196,  14088,  13970,  13846,  13716,  13585,  13453,  13324,
+     13201,  13084,  12977,  12880,  12795,  12723,  12665,  12620,  12587,  12567,  12558,  12558,  12566,  12578,  12594,  12611,
+     12626,  12637,  12642,  12638,  12625,  12601,  12565,  12516,  12455,  12381,  12294,  12197,  12091,  11977,  11857,  11733,
+     11607,  11483,  11361,  11245,  11135,  11035,  10944,  10865,  10798,  10744,  10701,  10670,  10650,  10640,  10638,  10642,
+     10651,  10662,  10673,  10681,  10686,  10684,  10674,  10655,  10626,  10585,  10532,  10468,  10391,  10304,  10208,  10102,
+      9991,   9874,   9754,   9633,   9514,   9398,   9287,   9184,   9089,   9004,   8929,   8866,   8815,   8775,   8745,   8726,
+      8715,   8712,   8713,   8719,   8726,   8732,   8736,   8735,   8729,   8714,   8690,   8656,   8611,   8555,   8487,   8409,
+      8321,   8224,   8120,   8009,   7895,   7778,   7661,   7546,   7434,   7328,   7230,   7139,   7058,   6988,   6929,   6880,
+      6842,   6814,   6796,   6785,   6780,   6781,   6784,   6788,   6791,   6791,   6786,   6775,   6756,   6728,   6690,   6641,
+      6582,   6512,   6432,   6343,   6246,   6141,   6032,   5919,   5805,   5690,   5578,   5470,   5368,   5273,   5187,   5110,
+      5043,   4987,   4941,   4905,   4879,   4861,   4851,   4846,   4845,   4847,   4848,   4849,   4846,   4838,   4823,   4800,
+      4769,   4727,   4676,   4613,   4541,   4459,   4369,   4270,   4166,   4057,   3945,   3832,   3720,   3611,   3505,   3406,
+      3315,   3232,   3158,   3094,   3041,   2998,   2965,   2940,   2924,   2914,   2909,   2908,   2908,   2909,   2907,   2902,
+      2891,   2873,   2847,   2812,   2768,   2713,   2648,   2573,   2489,   2397,   2298,   2193,   2084,   1972,   1860,   1750,
+      1642,   1539,   1443,   1354,   1274,   1204,   1143,   1093,   1052,   1021,    999,    984,    975,    971,    969,    969,
+       969,    966,    958,    945,    925,    896,    859,    811,    753,    686,    608,    522,    428,    327,    221,    111,
+         0,   -111,   -221,   -327,   -428,   -522,   -608,   -686,   -753,   -811,   -859,   -896,   -925,   -945,   -958,   -966,
+      -969,   -969,   -969,   -971,   -975,   -984,   -999,  -1021,  -1052,  -1093,  -1143,  -1204,  -1274,  -1354,  -1443,  -1539,
+     -1642,  -1750,  -1860,  -1972,  -2084,  -2193,  -2298,  -2397,  -2489,  -2573,  -2648,  -2713,  -2768,  -2812,  -2847,  -2873,
+     -2891,  -2902,  -2907,  -2909,  -2908,  -2908,  -2909,  -2914,  -2924,  -2940,  -2965,  -2998,  -3041,  -3094,  -3158,  -3232,
+     -3315,  -3406,  -3505,  -3611,  -3720,  -3832,  -3945,  -4057,  -4166,  -4270,  -4369,  -4459,  -4541,  -4613,  -4676,  -4727,
+     -4769,  -4800,  -4823,  -4838,  -4846,  -4849,  -4848,  -4847,  -4845,  -4846,  -4851,  -4861,  -4879,  -4905,  -4941,  -4987,
+     -5043,  -5110,  -5187,  -5273,  -5368,  -5470,  -5578,  -5690,  -5805,  -5919,  -6032,  -6141,  -6246,  -6343,  -6432,  -6512,
+     -6582,  -6641,  -6690,  -6728,  -6756,  -6775,  -6786,  -6791,  -6791,  -6788,  -6784,  -6781,  -6780,  -6785,  -6796,  -6814,
+     -6842,  -6880,  -6929,  -6988,  -7058,  -7139,  -7230,  -7328,  -7434,  -7546,  -7661,  -7778,  -7895,  -8009,  -8120,  -8224,
+     -8321,  -8409,  -8487,  -8555,  -8611,  -8656,  -8690,  -8714,  -8729,  -8735,  -8736,  -8732,  -8726,  -8719,  -8713,  -8712,
+     -8715,  -8726,  -8745,  -8775,  -8815,  -8866,  -8929,  -9004,  -9089,  -9184,  -9287,  -9398,  -9514,  -9633,  -9754,  -9874,
+     -9991, -10102, -10208, -10304, -10391, -10468, -10532, -10585, -10626, -10655, -10674, -10684, -10686, -10681, -10673, -10662,
+    -10651, -10642, -10638, -10640, -10650, -10670, -10701, -10744, -10798, -10865, -10944, -11035, -11135, -11245, -11361, -11483,
+    -11607, -11733, -11857, -11977, -12091, -12197, -12294, -12381, -12455, -12516, -12565, -12601, -12625, -12638, -12642, -12637,
+    -12626, -12611, -12594, -12578, -12566, -12558, -12558, -12567, -12587, -12620, -12665, -12723, -12795, -12880, -12977, -13084,
+    -13201, -13324, -13453, -13585, -13716, -13846, -13970, -14088, -14196, -14294, -14379, -14451, -14509, -14553, -14584, -14601,
+    -14606, -14602, -14588, -14569, -14546, -14522, -14499, -14481, -14469, -14465, -14473, -14493, -14527, -14575, -14638, -14716,
+    -14808, -14913, -15029, -15155, -15288, -15427, -15567, -15707, -15844, -15974, -16097, -16208, -16307, -16392, -16461, -16515,
+    -16553, -16576, -16584, -16580, -16565, -16540, -16510, -16476, -16442, -16410, -16383, -16365, -16357, -16362, -16381, -16417,
+    -16469, -16538, -16623, -16725, -16840, -16969, -17108, -17254, -17405, -17558, -17710, -17857, -17996, -18125, -18241, -18342,
+    -18426, -18492, -18541, -18571, -18583, -18580, -18562, -18532, -18492, -18446, -18397, -18348, -18303, -18265, -18238, -18223,
+    -18224, -18242, -18280, -18337, -18414, -18510, -18625, -18756, -18901, -19058, -19223, -19393, -19564, -19732, -19894, -20046,
+    -20185, -20308, -20412, -20495, -20558, -20598, -20617, -20615, -20594, -20556, -20505, -20442, -20373, -20302, -20231, -20167,
+    -20111, -20070, -20045, -20039, -20056, -20096, -20160, -20249, -20361, -20496, -20650, -20822, -21006, -21200, -21399, -21598,
+    -21792, -21978, -22150, -22304, -22438, -22547, -22631, -22687, -22715, -22716, -22691, -22642, -22573, -22487, -22388, -22281,
+    -22173, -22067, -21969, -21886, -21820, -21777, -21761, -21774, -21818, -21895, -22003, -22143, -22311, -22505, -22721, -22953,
+    -23197, -23446, -23694, -23935, -24162, -24370, -24553, -24706, -24826, -24909, -24954, -24960, -24929, -24861, -24761, -24633,
+    -24482, -24314, -24137, -23957, -23783, -23622, -23482, -23370, -23293, -23255, -23260, -23312, -23413, -23561, -23756, -23995,
+    -24271, -24580, -24914, -25265, -25623, -25978, -26321, -26642, -26930, -27177, -27376, -27519, -27602, -27622, -27576, -27467,
+    -27296, -27069, -26793, -26477, -26131, -25767, -25400, -25042, -24708, -24412, -24168, -23989, -23886, -23869, -23946, -24120,
+    -24395, -24768, -25237, -25793, -26425, -27120, -27861, -28627, -29398, -30148, -30853, -31485, -32019, -32428, -32685, -32767,
+    -32652, -32319, -31754, -30942, -29876, -28550, -26965, -25125, -23040, -20723, -18193, -15471, -12584,  -9561,  -6433,  -3235,
+    
+    // Level 2: 512 samples, 255 harmonics
+         0,   6433,  12584,  18193,  23040,  26965,  29876,  31754,  32652,  32685,  32019,  30853,  29398,  27861,  26425,  25237,
+     24395,  23946,  23886,  24168,  24708,  25400,  26131,  26793,  27296,  27576,  27602,  27376,  26930,  26321,  25623,  24914,
+     24271,  23756,  23413,  23260,  23293,  23482,  23783,  24137,  24482,  24761,  24929,  24954,  24826,  24553,  24162,  23694,
+     23197,  22721,  22311,  22003,  21818,  21761,  21820,  21969,  22173,  22388,  22573,  22691,  22715,  22631,  22438,  22150,
+     21792,  21399,  21006,  20650,  20361,  20160,  20056,  20045,  20111,  20231,  20373,  20505,  20594,  20617,  20558,  20412,
+     20185,  19894,  19564,  19223,  18901,  18625,  18414,  18280,  18224,  18238,  18303,  18397,  18492,  18562,  18583,  18541,
+     18426,  18241,  17996,  17710,  17405,  17108,  16840,  16623,  16469,  16381,  16357,  16383,  16442,  16510,  16565,  16584,
+     16553,  16461,  16307,  16097,  15844,  15567,  15288,  15029,  14808,  14638,  14527,  14473,  14469,  14499,  14546,  14588,
+     14606,  14584,  14509,  14379,  14196,  13970,  13716,  13453,  13201,  12977,  12795,  12665,  12587,  12558,  12566,  12594,
+     12626,  12642,  12625,  12565,  12455,  12294,  12091,  11857,  11607,  11361,  11135,  10944,  10798,  10701,  10650,  10638,
+     10651,  10673,  10686,  10674,  10626,  10532,  10391,  10208,   9991,   9754,   9514,   9287,   9089,   8929,   8815,   8745,
+      8715,   8713,   8726,   8736,   8729,   8690,   8611,   8487,   8321,   8120,   7895,   7661,   7434,   7230,   7058,   6929,
+      6842,   6796,   6780,   6784,   6791,   6786,   6756,   6690,   6582,   6432,   6246,   6032,   5805,   5578,   5368,   5187,
+      5043,   4941,   4879,   4851,   4845,   4848,   4846,   4823,   4769,   4676,   4541,   4369,   4166,   3945,   3720,   3505,
+      3315,   3158,   3041,   2965,   2924,   2909,   2908,   2907,   2891,   2847,   2768,   2648,   2489,   2298,   2084,   1860,
+      1642,   1443,   1274,   1143,   1052,    999,    975,    969,    969,    958,    925,    859,    753,    608,    428,    221,
+         0,   -221,   -428,   -608,   -753,   -859,   -925,   -958,   -969,   -969,   -975,   -999,  -1052,  -1143,  -1274,  -1443,
+     -1642,  -1860,  -2084,  -2298,  -2489,  -2648,  -2768,  -2847,  -2891,  -2907,  -2908,  -2909,  -2924,  -2965,  -3041,  -3158,
+     -3315,  -3505,  -3720,  -3945,  -4166,  -4369,  -4541,  -4676,  -4769,  -4823,  -4846,  -4848,  -4845,  -4851,  -4879,  -4941,
+     -5043,  -5187,  -5368,  -5578,  -5805,  -6032,  -6246,  -6432,  -6582,  -6690,  -6756,  -6786,  -6791,  -6784,  -6780,  -6796,
+     -6842,  -6929,  -7058,  -7230,  -7434,  -7661,  -7895,  -8120,  -8321,  -8487,  -8611,  -8690,  -8729,  -8736,  -8726,  -8713,
+     -8715,  -8745,  -8815,  -8929,  -9089,  -9287,  -9514,  -9754,  -9991, -10208, -10391, -10532, -10626, -10674, -10686, -10673,
+    -10651, -10638, -10650, -10701, -10798, -10944, -11135, -11361, -11607, -11857, -12091, -12294, -12455, -12565, -12625, -12642,
+    -12626, -12594, -12566, -12558, -12587, -12665, -12795, -12977, -13201, -13453, -13716, -13970, -14196, -14379, -14509, -14584,
+    -14606, -14588, -14546, -14499, -14469, -14473, -14527, -14638, -14808, -15029, -15288, -15567, -15844, -16097, -16307, -16461,
+    -16553, -16584, -16565, -16510, -16442, -16383, -16357, -16381, -16469, -16623, -16840, -17108, -17405, -17710, -17996, -18241,
+    -18426, -18541, -18583, -18562, -18492, -18397, -18303, -18238, -18224, -18280, -18414, -18625, -18901, -19223, -19564, -19894,
+    -20185, -20412, -20558, -20617, -20594, -20505, -20373, -20231, -20111, -20045, -20056, -20160, -20361, -20650, -21006, -21399,
+    -21792, -22150, -22438, -22631, -22715, -22691, -22573, -22388, -22173, -21969, -21820, -21761, -21818, -22003, -22311, -22721,
+    -23197, -23694, -24162, -24553, -24826, -24954, -24929, -24761, -24482, -24137, -23783, -23482, -23293, -23260, -23413, -23756,
+    -24271, -24914, -25623, -26321, -26930, -27376, -27602, -27576, -27296, -26793, -26131, -25400, -24708, -24168, -23886, -23946,
+    -24395, -25237, -26425, -27861, -29398, -30853, -32019, -32685, -32652, -31754, -29876, -26965, -23040, -18193, -12584,  -6433,
+    
+    // Level 3: 256 samples, 127 harmonics
+         0,  12584,  23040,  29876,  32652,  32019,  29398,  26425,  24395,  23886,  24708,  26131,  27296,  27602,  26930,  25623,
+     24271,  23413,  23293,  23783,  24482,  24929,  24826,  24162,  23197,  22311,  21818,  21820,  22173,  22573,  22715,  22438,
+     21792,  21006,  20361,  20056,  20111,  20373,  20594,  20558,  20185,  19564,  18901,  18414,  18224,  18303,  18492,  18583,
+     18426,  17996,  17405,  16840,  16469,  16357,  16442,  16565,  16553,  16307,  15844,  15288,  14808,  14527,  14469,  14546,
+     14606,  14509,  14196,  13716,  13201,  12795,  12587,  12566,  12626,  12625,  12455,  12091,  11607,  11135,  10798,  10650,
+     10651,  10686,  10626,  10391,   9991,   9514,   9089,   8815,   8715,   8726,   8729,   8611,   8321,   7895,   7434,   7058,
+      6842,   6780,   6791,   6756,   6582,   6246,   5805,   5368,   5043,   4879,   4845,   4846,   4769,   4541,   4166,   3720,
+      3315,   3041,   2924,   2908,   2891,   2768,   2489,   2084,   1642,   1274,   1052,    975,    969,    925,    753,    428,
+         0,   -428,   -753,   -925,   -969,   -975,  -1052,  -1274,  -1642,  -2084,  -2489,  -2768,  -2891,  -2908,  -2924,  -3041,
+     -3315,  -3720,  -4166,  -4541,  -4769,  -4846,  -4845,  -4879,  -5043,  -5368,  -5805,  -6246,  -6582,  -6756,  -6791,  -6780,
+     -6842,  -7058,  -7434,  -7895,  -8321,  -8611,  -8729,  -8726,  -8715,  -8815,  -9089,  -9514,  -9991, -10391, -10626, -10686,
+    -10651, -10650, -10798, -11135, -11607, -12091, -12455, -12625, -12626, -12566, -12587, -12795, -13201, -13716, -14196, -14509,
+    -14606, -14546, -14469, -14527, -14808, -15288, -15844, -16307, -16553, -16565, -16442, -16357, -16469, -16840, -17405, -17996,
+    -18426, -18583, -18492, -18303, -18224, -18414, -18901, -19564, -20185, -20558, -20594, -20373, -20111, -20056, -20361, -21006,
+    -21792, -22438, -22715, -22573, -22173, -21820, -21818, -22311, -23197, -24162, -24826, -24929, -24482, -23783, -23293, -23413,
+    -24271, -25623, -26930, -27602, -27296, -26131, -24708, -23886, -24395, -26425, -29398, -32019, -32652, -29876, -23040, -12584,
+    
+    // Level 4: 128 samples, 63 harmonics
+         0,  23040,  32652,  29398,  24395,  24708,  27296,  26930,  24271,  23293,  24482,  24826,  23197,  21818,  22173,  22715,
+     21792,  20361,  20111,  20594,  20185,  18901,  18224,  18492,  18426,  17405,  16469,  16442,  16553,  15844,  14808,  14469,
+     14606,  14196,  13201,  12587,  12626,  12455,  11607,  10798,  10651,  10626,   9991,   9089,   8715,   8729,   8321,   7434,
+      6842,   6791,   6582,   5805,   5043,   4845,   4769,   4166,   3315,   2924,   2891,   2489,   1642,   1052,    969,    753,
+         0,   -753,   -969,  -1052,  -1642,  -2489,  -2891,  -2924,  -3315,  -4166,  -4769,  -4845,  -5043,  -5805,  -6582,  -6791,
+     -6842,  -7434,  -8321,  -8729,  -8715,  -9089,  -9991, -10626, -10651, -10798, -11607, -12455, -12626, -12587, -13201, -14196,
+    -14606, -14469, -14808, -15844, -16553, -16442, -16469, -17405, -18426, -18492, -18224, -18901, -20185, -20594, -20111, -20361,
+    -21792, -22715, -22173, -21818, -23197, -24826, -24482, -23293, -24271, -26930, -27296, -24708, -24395, -29398, -32652, -23040,
+    
+    // Level 5: 64 samples, 31 harmonics
+         0,  32652,  24395,  27296,  24271,  24482,  23197,  22173,  21792,  20111,  20185,  18224,  18426,  16469,  16553,  14808,
+     14606,  13201,  12626,  11607,  10651,   9991,   8715,   8321,   6842,   6582,   5043,   4769,   3315,   2891,   1642,    969,
+         0,   -969,  -1642,  -2891,  -3315,  -4769,  -5043,  -6582,  -6842,  -8321,  -8715,  -9991, -10651, -11607, -12626, -13201,
+    -14606, -14808, -16553, -16469, -18426, -18224, -20185, -20111, -21792, -22173, -23197, -24482, -24271, -27296, -24395, -32652,
+    
+    // Level 6: 64 samples, 16 harmonics
+         0,  24633,  31920,  26046,  22288,  24427,  25080,  21930,  20098,  21035,  20723,  18270,  17032,  17505,  16781,  14667,
+     13736,  13946,  12981,  11080,  10348,  10378,   9243,   7498,   6916,   6807,   5536,   3919,   3463,   3233,   1844,    343,
+         0,   -343,  -1844,  -3233,  -3463,  -3919,  -5536,  -6807,  -6916,  -7498,  -9243, -10378, -10348, -11080, -12981, -13946,
+    -13736, -14667, -16781, -17505, -17032, -18270, -20723, -21035, -20098, -21930, -25080, -24427, -22288, -26046, -31920, -24633,
+    
+    // Level 7: 64 samples, 8 harmonics
+         0,  13729,  24290,  29750,  30076,  26941,  22813,  19800,  18825,  19473,  20508,  20707,  19544,  17379,  15123,  13626,
+     13182,  13405,  13537,  12940,  11480,   9573,   7891,   6924,   6684,   6721,   6425,   5422,   3800,   2046,    721,    100,
+         0,   -100,   -721,  -2046,  -3800,  -5422,  -6425,  -6721,  -6684,  -6924,  -7891,  -9573, -11480, -12940, -13537, -13405,
+    -13182, -13626, -15123, -17379, -19544, -20707, -20508, -19473, -18825, -19800, -22813, -26941, -30076, -29750, -24290, -13729,
+    
+    // Level 8: 64 samples, 4 harmonics
+         0,   7066,  13629,  19244,  23569,  26403,  27703,  27580,  26276,  24128,  21520,  18831,  16388,  14429,  13079,  12349,
+     12141,  12280,  12549,  12724,  12616,  12101,  11133,   9751,   8064,   6234,   4440,   2849,   1586,    714,    221,     28,
+         0,    -28,   -221,   -714,  -1586,  -2849,  -4440,  -6234,  -8064,  -9751, -11133, -12101, -12616, -12724, -12549, -12280,
+    -12141, -12349, -13079, -14429, -16388, -18831, -21520, -24128, -26276, -27580, -27703, -26403, -23569, -19244, -13629,  -7066,
+    
+    // Level 9: 64 samples, 2 harmonics
+         0,   3561,   7037,  10345,  13408,  16156,  18530,  20484,  21983,  23008,  23555,  23632,  23264,  22486,  21346,  19900,
+     18211,  16347,  14377,  12368,  10386,   8490,   6730,   5147,   3772,   2622,   1705,   1014,    530,    228,     68,      9,
+         0,     -9,    -68,   -228,   -530,  -1014,  -1705,  -2622,  -3772,  -5147,  -6730,  -8490, -10386, -12368, -14377, -16347,
+    -18211, -19900, -21346, -22486, -23264, -23632, -23555, -23008, -21983, -20484, -18530, -16156, -13408, -10345,  -7037,  -3561,
+    
+    // Level 10: 64 samples, 1 harmonics
+         0,   1785,   3553,   5286,   6969,   8585,  10118,  11553,  12877,  14078,  15142,  16061,  16825,  17427,  17861,  18124,
+     18211,  18124,  17861,  17427,  16825,  16061,  15142,  14078,  12877,  11553,  10118,   8585,   6969,   5286,   3553,   1785,
+         0,  -1785,  -3553,  -5286,  -6969,  -8585, -10118, -11553, -12877, -14078, -15142, -16061, -16825, -17427, -17861, -18124,
+    -18211, -18124, -17861, -17427, -16825, -16061, -15142, -14078, -12877, -11553, -10118,  -8585,  -6969,  -5286,  -3553,  -1785,
     
 };
 
-alignas(4) const float waveform_Square[4096] = {
-    0.00000000f, 0.03312011f, 0.06619870f, 0.09919433f, 0.13206576f, 0.16477203f, 0.19727255f, 0.22952718f,
-    0.26149635f, 0.29314112f, 0.32442330f, 0.35530548f, 0.38575117f, 0.41572485f, 0.44519205f, 0.47411943f,
-    0.50247484f, 0.53022742f, 0.55734762f, 0.58380730f, 0.60957977f, 0.63463985f, 0.65896391f, 0.68252993f,
-    0.70531753f, 0.72730802f, 0.74848442f, 0.76883149f, 0.78833576f, 0.80698557f, 0.82477104f, 0.84168410f,
-    0.85771851f, 0.87286984f, 0.88713550f, 0.90051467f, 0.91300835f, 0.92461931f, 0.93535207f, 0.94521288f,
-    0.95420970f, 0.96235214f, 0.96965142f, 0.97612038f, 0.98177337f, 0.98662621f, 0.99069618f, 0.99400192f,
-    0.99656338f, 0.99840177f, 0.99953947f, 1.00000000f, 0.99980790f, 0.99898870f, 0.99756881f, 0.99557547f,
-    0.99303668f, 0.98998106f, 0.98643786f, 0.98243679f, 0.97800802f, 0.97318202f, 0.96798954f, 0.96246149f,
-    0.95662887f, 0.95052271f, 0.94417394f, 0.93761337f, 0.93087156f, 0.92397878f, 0.91696491f, 0.90985938f,
-    0.90269110f, 0.89548840f, 0.88827893f, 0.88108962f, 0.87394663f, 0.86687528f, 0.85989998f, 0.85304421f,
-    0.84633042f, 0.83978006f, 0.83341348f, 0.82724989f, 0.82130738f, 0.81560282f, 0.81015189f, 0.80496903f,
-    0.80006742f, 0.79545896f, 0.79115430f, 0.78716277f, 0.78349243f, 0.78015002f, 0.77714103f, 0.77446964f,
-    0.77213878f, 0.77015011f, 0.76850407f, 0.76719988f, 0.76623559f, 0.76560807f, 0.76531307f, 0.76534525f,
-    0.76569823f, 0.76636461f, 0.76733600f, 0.76860311f, 0.77015576f, 0.77198296f, 0.77407291f, 0.77641313f,
-    0.77899043f, 0.78179104f, 0.78480061f, 0.78800432f, 0.79138687f, 0.79493264f, 0.79862562f, 0.80244961f,
-    0.80638815f, 0.81042469f, 0.81454255f, 0.81872508f, 0.82295562f, 0.82721762f, 0.83149469f, 0.83577063f,
-    0.84002950f, 0.84425566f, 0.84843383f, 0.85254915f, 0.85658719f, 0.86053403f, 0.86437628f, 0.86810113f,
-    0.87169638f, 0.87515046f, 0.87845252f, 0.88159237f, 0.88456059f, 0.88734848f, 0.88994815f, 0.89235249f,
-    0.89455519f, 0.89655078f, 0.89833459f, 0.89990280f, 0.90125243f, 0.90238133f, 0.90328819f, 0.90397251f,
-    0.90443462f, 0.90467566f, 0.90469756f, 0.90450301f, 0.90409548f, 0.90347915f, 0.90265895f, 0.90164044f,
-    0.90042989f, 0.89903415f, 0.89746070f, 0.89571756f, 0.89381328f, 0.89175689f, 0.88955790f, 0.88722619f,
-    0.88477204f, 0.88220604f, 0.87953909f, 0.87678230f, 0.87394703f, 0.87104475f, 0.86808709f, 0.86508572f,
-    0.86205235f, 0.85899869f, 0.85593639f, 0.85287698f, 0.84983190f, 0.84681237f, 0.84382941f, 0.84089380f,
-    0.83801602f, 0.83520622f, 0.83247421f, 0.82982939f, 0.82728076f, 0.82483686f, 0.82250577f, 0.82029505f,
-    0.81821176f, 0.81626241f, 0.81445295f, 0.81278875f, 0.81127461f, 0.80991470f, 0.80871261f, 0.80767130f,
-    0.80679309f, 0.80607970f, 0.80553221f, 0.80515110f, 0.80493619f, 0.80488673f, 0.80500135f, 0.80527807f,
-    0.80571436f, 0.80630709f, 0.80705261f, 0.80794672f, 0.80898473f, 0.81016143f, 0.81147117f, 0.81290785f,
-    0.81446495f, 0.81613556f, 0.81791244f, 0.81978799f, 0.82175431f, 0.82380325f, 0.82592643f, 0.82811524f,
-    0.83036093f, 0.83265460f, 0.83498725f, 0.83734981f, 0.83973318f, 0.84212825f, 0.84452597f, 0.84691732f,
-    0.84929340f, 0.85164544f, 0.85396482f, 0.85624312f, 0.85847214f, 0.86064393f, 0.86275081f, 0.86478541f,
-    0.86674068f, 0.86860992f, 0.87038682f, 0.87206545f, 0.87364028f, 0.87510622f, 0.87645862f, 0.87769330f,
-    0.87880653f, 0.87979508f, 0.88065619f, 0.88138760f, 0.88198754f, 0.88245477f, 0.88278853f, 0.88298855f,
-    0.88305509f, 0.88298888f, 0.88279115f, 0.88246360f, 0.88200840f, 0.88142820f, 0.88072607f, 0.87990552f,
-    0.87897048f, 0.87792526f, 0.87677458f, 0.87552349f, 0.87417738f, 0.87274198f, 0.87122329f, 0.86962757f,
-    0.86796136f, 0.86623137f, 0.86444453f, 0.86260794f, 0.86072881f, 0.85881448f, 0.85687236f, 0.85490992f,
-    0.85293466f, 0.85095406f, 0.84897559f, 0.84700664f, 0.84505455f, 0.84312651f, 0.84122959f, 0.83937071f,
-    0.83755658f, 0.83579373f, 0.83408841f, 0.83244667f, 0.83087425f, 0.82937660f, 0.82795886f, 0.82662585f,
-    0.82538203f, 0.82423149f, 0.82317798f, 0.82222483f, 0.82137501f, 0.82063105f, 0.81999510f, 0.81946887f,
-    0.81905367f, 0.81875039f, 0.81855947f, 0.81848096f, 0.81851448f, 0.81865922f, 0.81891398f, 0.81927715f,
-    0.81974672f, 0.82032031f, 0.82099515f, 0.82176812f, 0.82263575f, 0.82359422f, 0.82463942f, 0.82576694f,
-    0.82697205f, 0.82824981f, 0.82959500f, 0.83100219f, 0.83246575f, 0.83397989f, 0.83553862f, 0.83713586f,
-    0.83876540f, 0.84042094f, 0.84209614f, 0.84378459f, 0.84547990f, 0.84717567f, 0.84886552f, 0.85054317f,
-    0.85220237f, 0.85383701f, 0.85544108f, 0.85700874f, 0.85853429f, 0.86001224f, 0.86143730f, 0.86280439f,
-    0.86410871f, 0.86534568f, 0.86651102f, 0.86760072f, 0.86861110f, 0.86953878f, 0.87038070f, 0.87113414f,
-    0.87179674f, 0.87236647f, 0.87284166f, 0.87322103f, 0.87350361f, 0.87368885f, 0.87377655f, 0.87376684f,
-    0.87366027f, 0.87345772f, 0.87316041f, 0.87276993f, 0.87228821f, 0.87171750f, 0.87106038f, 0.87031973f,
-    0.86949875f, 0.86860089f, 0.86762990f, 0.86658978f, 0.86548476f, 0.86431929f, 0.86309804f, 0.86182585f,
-    0.86050775f, 0.85914888f, 0.85775455f, 0.85633014f, 0.85488115f, 0.85341314f, 0.85193168f, 0.85044242f,
-    0.84895096f, 0.84746293f, 0.84598388f, 0.84451933f, 0.84307470f, 0.84165534f, 0.84026645f, 0.83891310f,
-    0.83760023f, 0.83633256f, 0.83511467f, 0.83395090f, 0.83284537f, 0.83180198f, 0.83082438f, 0.82991594f,
-    0.82907977f, 0.82831869f, 0.82763525f, 0.82703165f, 0.82650984f, 0.82607140f, 0.82571764f, 0.82544951f,
-    0.82526767f, 0.82517242f, 0.82516376f, 0.82524135f, 0.82540455f, 0.82565237f, 0.82598355f, 0.82639648f,
-    0.82688928f, 0.82745976f, 0.82810547f, 0.82882368f, 0.82961138f, 0.83046535f, 0.83138210f, 0.83235794f,
-    0.83338896f, 0.83447108f, 0.83560003f, 0.83677138f, 0.83798056f, 0.83922289f, 0.84049356f, 0.84178771f,
-    0.84310037f, 0.84442654f, 0.84576120f, 0.84709931f, 0.84843581f, 0.84976571f, 0.85108404f, 0.85238589f,
-    0.85366643f, 0.85492095f, 0.85614483f, 0.85733359f, 0.85848290f, 0.85958860f, 0.86064670f, 0.86165342f,
-    0.86260515f, 0.86349853f, 0.86433043f, 0.86509795f, 0.86579846f, 0.86642955f, 0.86698913f, 0.86747535f,
-    0.86788665f, 0.86822177f, 0.86847972f, 0.86865982f, 0.86876167f, 0.86878516f, 0.86873049f, 0.86859815f,
-    0.86838891f, 0.86810383f, 0.86774425f, 0.86731178f, 0.86680830f, 0.86623595f, 0.86559713f, 0.86489446f,
-    0.86413080f, 0.86330924f, 0.86243305f, 0.86150572f, 0.86053091f, 0.85951243f, 0.85845426f, 0.85736051f,
-    0.85623541f, 0.85508329f, 0.85390856f, 0.85271572f, 0.85150930f, 0.85029388f, 0.84907405f, 0.84785441f,
-    0.84663953f, 0.84543397f, 0.84424222f, 0.84306872f, 0.84191779f, 0.84079371f, 0.83970059f, 0.83864245f,
-    0.83762314f, 0.83664638f, 0.83571568f, 0.83483440f, 0.83400568f, 0.83323248f, 0.83251753f, 0.83186331f,
-    0.83127210f, 0.83074592f, 0.83028655f, 0.82989549f, 0.82957400f, 0.82932308f, 0.82914345f, 0.82903557f,
-    0.82899961f, 0.82903549f, 0.82914287f, 0.82932110f, 0.82956933f, 0.82988639f, 0.83027088f, 0.83072117f,
-    0.83123537f, 0.83181134f, 0.83244674f, 0.83313902f, 0.83388540f, 0.83468291f, 0.83552841f, 0.83641859f,
-    0.83734997f, 0.83831893f, 0.83932173f, 0.84035449f, 0.84141325f, 0.84249397f, 0.84359251f, 0.84470471f,
-    0.84582634f, 0.84695316f, 0.84808093f, 0.84920541f, 0.85032239f, 0.85142768f, 0.85251718f, 0.85358683f,
-    0.85463267f, 0.85565084f, 0.85663759f, 0.85758930f, 0.85850249f, 0.85937384f, 0.86020019f, 0.86097856f,
-    0.86170616f, 0.86238038f, 0.86299885f, 0.86355939f, 0.86406005f, 0.86449910f, 0.86487507f, 0.86518671f,
-    0.86543302f, 0.86561325f, 0.86572690f, 0.86577370f, 0.86575368f, 0.86566706f, 0.86551436f, 0.86529631f,
-    0.86501391f, 0.86466838f, 0.86426119f, 0.86379401f, 0.86326877f, 0.86268757f, 0.86205276f, 0.86136684f,
-    0.86063252f, 0.85985269f, 0.85903038f, 0.85816880f, 0.85727127f, 0.85634127f, 0.85538235f, 0.85439821f,
-    0.85339259f, 0.85236932f, 0.85133231f, 0.85028546f, 0.84923275f, 0.84817813f, 0.84712558f, 0.84607905f,
-    0.84504245f, 0.84401966f, 0.84301448f, 0.84203064f, 0.84107180f, 0.84014150f, 0.83924316f, 0.83838009f,
-    0.83755544f, 0.83677222f, 0.83603328f, 0.83534130f, 0.83469875f, 0.83410796f, 0.83357100f, 0.83308979f,
-    0.83266599f, 0.83230108f, 0.83199628f, 0.83175262f, 0.83157085f, 0.83145154f, 0.83139498f, 0.83140126f,
-    0.83147020f, 0.83160141f, 0.83179425f, 0.83204788f, 0.83236119f, 0.83273289f, 0.83316144f, 0.83364512f,
-    0.83418199f, 0.83476991f, 0.83540657f, 0.83608947f, 0.83681595f, 0.83758318f, 0.83838819f, 0.83922787f,
-    0.84009901f, 0.84099826f, 0.84192218f, 0.84286724f, 0.84382987f, 0.84480639f, 0.84579311f, 0.84678631f,
-    0.84778223f, 0.84877714f, 0.84976728f, 0.85074897f, 0.85171851f, 0.85267229f, 0.85360677f, 0.85451846f,
-    0.85540399f, 0.85626009f, 0.85708358f, 0.85787145f, 0.85862081f, 0.85932891f, 0.85999317f, 0.86061119f,
-    0.86118073f, 0.86169975f, 0.86216639f, 0.86257900f, 0.86293613f, 0.86323656f, 0.86347925f, 0.86366341f,
-    0.86378845f, 0.86385402f, 0.86385999f, 0.86380643f, 0.86369368f, 0.86352225f, 0.86329290f, 0.86300661f,
-    0.86266455f, 0.86226811f, 0.86181888f, 0.86131865f, 0.86076938f, 0.86017324f, 0.85953254f, 0.85884978f,
-    0.85812759f, 0.85736876f, 0.85657621f, 0.85575298f, 0.85490221f, 0.85402715f, 0.85313114f, 0.85221756f,
-    0.85128990f, 0.85035166f, 0.84940638f, 0.84845763f, 0.84750898f, 0.84656399f, 0.84562622f, 0.84469917f,
-    0.84378631f, 0.84289105f, 0.84201671f, 0.84116656f, 0.84034374f, 0.83955131f, 0.83879219f, 0.83806917f,
-    0.83738493f, 0.83674195f, 0.83614260f, 0.83558906f, 0.83508333f, 0.83462723f, 0.83422240f, 0.83387028f,
-    0.83357211f, 0.83332891f, 0.83314153f, 0.83301057f, 0.83293644f, 0.83291933f, 0.83295921f, 0.83305584f,
-    0.83320877f, 0.83341735f, 0.83368069f, 0.83399774f, 0.83436721f, 0.83478763f, 0.83525735f, 0.83577453f,
-    0.83633715f, 0.83694302f, 0.83758982f, 0.83827504f, 0.83899606f, 0.83975011f, 0.84053430f, 0.84134565f,
-    0.84218107f, 0.84303737f, 0.84391133f, 0.84479961f, 0.84569887f, 0.84660570f, 0.84751669f, 0.84842841f,
-    0.84933743f, 0.85024034f, 0.85113374f, 0.85201431f, 0.85287874f, 0.85372381f, 0.85454636f, 0.85534334f,
-    0.85611179f, 0.85684886f, 0.85755181f, 0.85821806f, 0.85884514f, 0.85943076f, 0.85997276f, 0.86046917f,
-    0.86091819f, 0.86131818f, 0.86166770f, 0.86196552f, 0.86221057f, 0.86240200f, 0.86253917f, 0.86262163f,
-    0.86264914f, 0.86262165f, 0.86253936f, 0.86240263f, 0.86221205f, 0.86196840f, 0.86167267f, 0.86132602f,
-    0.86092983f, 0.86048565f, 0.85999520f, 0.85946039f, 0.85888327f, 0.85826607f, 0.85761117f, 0.85692105f,
-    0.85619837f, 0.85544587f, 0.85466643f, 0.85386299f, 0.85303862f, 0.85219643f, 0.85133961f, 0.85047139f,
-    0.84959507f, 0.84871393f, 0.84783130f, 0.84695049f, 0.84607482f, 0.84520758f, 0.84435200f, 0.84351130f,
-    0.84268862f, 0.84188704f, 0.84110953f, 0.84035901f, 0.83963826f, 0.83894996f, 0.83829666f, 0.83768078f,
-    0.83710460f, 0.83657025f, 0.83607967f, 0.83563468f, 0.83523691f, 0.83488778f, 0.83458858f, 0.83434037f,
-    0.83414403f, 0.83400025f, 0.83390951f, 0.83387211f, 0.83388813f, 0.83395746f, 0.83407979f, 0.83425459f,
-    0.83448117f, 0.83475863f, 0.83508586f, 0.83546159f, 0.83588436f, 0.83635254f, 0.83686433f, 0.83741775f,
-    0.83801070f, 0.83864089f, 0.83930594f, 0.84000330f, 0.84073033f, 0.84148426f, 0.84226224f, 0.84306132f,
-    0.84387847f, 0.84471061f, 0.84555460f, 0.84640724f, 0.84726534f, 0.84812565f, 0.84898495f, 0.84983999f,
-    0.85068758f, 0.85152452f, 0.85234769f, 0.85315399f, 0.85394042f, 0.85470403f, 0.85544196f, 0.85615147f,
-    0.85682991f, 0.85747475f, 0.85808360f, 0.85865420f, 0.85918443f, 0.85967233f, 0.86011610f, 0.86051410f,
-    0.86086487f, 0.86116714f, 0.86141980f, 0.86162194f, 0.86177284f, 0.86187196f, 0.86191898f, 0.86191376f,
-    0.86185635f, 0.86174701f, 0.86158619f, 0.86137452f, 0.86111285f, 0.86080219f, 0.86044374f, 0.86003889f,
-    0.85958919f, 0.85909636f, 0.85856228f, 0.85798899f, 0.85737868f, 0.85673365f, 0.85605637f, 0.85534940f,
-    0.85461542f, 0.85385720f, 0.85307761f, 0.85227959f, 0.85146617f, 0.85064040f, 0.84980540f, 0.84896432f,
-    0.84812032f, 0.84727658f, 0.84643627f, 0.84560254f, 0.84477853f, 0.84396734f, 0.84317200f, 0.84239550f,
-    0.84164074f, 0.84091055f, 0.84020766f, 0.83953471f, 0.83889419f, 0.83828852f, 0.83771993f, 0.83719056f,
-    0.83670236f, 0.83625717f, 0.83585661f, 0.83550219f, 0.83519520f, 0.83493678f, 0.83472787f, 0.83456924f,
-    0.83446146f, 0.83440490f, 0.83439975f, 0.83444601f, 0.83454349f, 0.83469178f, 0.83489031f, 0.83513830f,
-    0.83543480f, 0.83577868f, 0.83616862f, 0.83660313f, 0.83708056f, 0.83759910f, 0.83815677f, 0.83875146f,
-    0.83938093f, 0.84004278f, 0.84073452f, 0.84145353f, 0.84219710f, 0.84296243f, 0.84374661f, 0.84454671f,
-    0.84535970f, 0.84618251f, 0.84701207f, 0.84784523f, 0.84867887f, 0.84950985f, 0.85033505f, 0.85115136f,
-    0.85195572f, 0.85274511f, 0.85351656f, 0.85426718f, 0.85499415f, 0.85569475f, 0.85636635f, 0.85700643f,
-    0.85761260f, 0.85818258f, 0.85871425f, 0.85920561f, 0.85965483f, 0.86006023f, 0.86042030f, 0.86073370f,
-    0.86099926f, 0.86121600f, 0.86138310f, 0.86149997f, 0.86156617f, 0.86158146f, 0.86154579f, 0.86145933f,
-    0.86132239f, 0.86113552f, 0.86089942f, 0.86061499f, 0.86028331f, 0.85990564f, 0.85948340f, 0.85901821f,
-    0.85851181f, 0.85796611f, 0.85738318f, 0.85676522f, 0.85611455f, 0.85543363f, 0.85472502f, 0.85399140f,
-    0.85323553f, 0.85246025f, 0.85166848f, 0.85086321f, 0.85004746f, 0.84922430f, 0.84839683f, 0.84756817f,
-    0.84674142f, 0.84591971f, 0.84510611f, 0.84430370f, 0.84351547f, 0.84274441f, 0.84199341f, 0.84126528f,
-    0.84056277f, 0.83988852f, 0.83924506f, 0.83863481f, 0.83806007f, 0.83752299f, 0.83702558f, 0.83656973f,
-    0.83615714f, 0.83578936f, 0.83546778f, 0.83519360f, 0.83496785f, 0.83479138f, 0.83466486f, 0.83458875f,
-    0.83456335f, 0.83458875f, 0.83466486f, 0.83479138f, 0.83496785f, 0.83519360f, 0.83546778f, 0.83578936f,
-    0.83615714f, 0.83656973f, 0.83702558f, 0.83752299f, 0.83806007f, 0.83863481f, 0.83924506f, 0.83988852f,
-    0.84056277f, 0.84126528f, 0.84199341f, 0.84274441f, 0.84351547f, 0.84430370f, 0.84510611f, 0.84591971f,
-    0.84674142f, 0.84756817f, 0.84839683f, 0.84922430f, 0.85004746f, 0.85086321f, 0.85166848f, 0.85246025f,
-    0.85323553f, 0.85399140f, 0.85472502f, 0.85543363f, 0.85611455f, 0.85676522f, 0.85738318f, 0.85796611f,
-    0.85851181f, 0.85901821f, 0.85948340f, 0.85990564f, 0.86028331f, 0.86061499f, 0.86089942f, 0.86113552f,
-    0.86132239f, 0.86145933f, 0.86154579f, 0.86158146f, 0.86156617f, 0.86149997f, 0.86138310f, 0.86121600f,
-    0.86099926f, 0.86073370f, 0.86042030f, 0.86006023f, 0.85965483f, 0.85920561f, 0.85871425f, 0.85818258f,
-    0.85761260f, 0.85700643f, 0.85636635f, 0.85569475f, 0.85499415f, 0.85426718f, 0.85351656f, 0.85274511f,
-    0.85195572f, 0.85115136f, 0.85033505f, 0.84950985f, 0.84867887f, 0.84784523f, 0.84701207f, 0.84618251f,
-    0.84535970f, 0.84454671f, 0.84374661f, 0.84296243f, 0.84219710f, 0.84145353f, 0.84073452f, 0.84004278f,
-    0.83938093f, 0.83875146f, 0.83815677f, 0.83759910f, 0.83708056f, 0.83660313f, 0.83616862f, 0.83577868f,
-    0.83543480f, 0.83513830f, 0.83489031f, 0.83469178f, 0.83454349f, 0.83444601f, 0.83439975f, 0.83440490f,
-    0.83446146f, 0.83456924f, 0.83472787f, 0.83493678f, 0.83519520f, 0.83550219f, 0.83585661f, 0.83625717f,
-    0.83670236f, 0.83719056f, 0.83771993f, 0.83828852f, 0.83889419f, 0.83953471f, 0.84020766f, 0.84091055f,
-    0.84164074f, 0.84239550f, 0.84317200f, 0.84396734f, 0.84477853f, 0.84560254f, 0.84643627f, 0.84727658f,
-    0.84812032f, 0.84896432f, 0.84980540f, 0.85064040f, 0.85146617f, 0.85227959f, 0.85307761f, 0.85385720f,
-    0.85461542f, 0.85534940f, 0.85605637f, 0.85673365f, 0.85737868f, 0.85798899f, 0.85856228f, 0.85909636f,
-    0.85958919f, 0.86003889f, 0.86044374f, 0.86080219f, 0.86111285f, 0.86137452f, 0.86158619f, 0.86174701f,
-    0.86185635f, 0.86191376f, 0.86191898f, 0.86187196f, 0.86177284f, 0.86162194f, 0.86141980f, 0.86116714f,
-    0.86086487f, 0.86051410f, 0.86011610f, 0.85967233f, 0.85918443f, 0.85865420f, 0.85808360f, 0.85747475f,
-    0.85682991f, 0.85615147f, 0.85544196f, 0.85470403f, 0.85394042f, 0.85315399f, 0.85234769f, 0.85152452f,
-    0.85068758f, 0.84983999f, 0.84898495f, 0.84812565f, 0.84726534f, 0.84640724f, 0.84555460f, 0.84471061f,
-    0.84387847f, 0.84306132f, 0.84226224f, 0.84148426f, 0.84073033f, 0.84000330f, 0.83930594f, 0.83864089f,
-    0.83801070f, 0.83741775f, 0.83686433f, 0.83635254f, 0.83588436f, 0.83546159f, 0.83508586f, 0.83475863f,
-    0.83448117f, 0.83425459f, 0.83407979f, 0.83395746f, 0.83388813f, 0.83387211f, 0.83390951f, 0.83400025f,
-    0.83414403f, 0.83434037f, 0.83458858f, 0.83488778f, 0.83523691f, 0.83563468f, 0.83607967f, 0.83657025f,
-    0.83710460f, 0.83768078f, 0.83829666f, 0.83894996f, 0.83963826f, 0.84035901f, 0.84110953f, 0.84188704f,
-    0.84268862f, 0.84351130f, 0.84435200f, 0.84520758f, 0.84607482f, 0.84695049f, 0.84783130f, 0.84871393f,
-    0.84959507f, 0.85047139f, 0.85133961f, 0.85219643f, 0.85303862f, 0.85386299f, 0.85466643f, 0.85544587f,
-    0.85619837f, 0.85692105f, 0.85761117f, 0.85826607f, 0.85888327f, 0.85946039f, 0.85999520f, 0.86048565f,
-    0.86092983f, 0.86132602f, 0.86167267f, 0.86196840f, 0.86221205f, 0.86240263f, 0.86253936f, 0.86262165f,
-    0.86264914f, 0.86262163f, 0.86253917f, 0.86240200f, 0.86221057f, 0.86196552f, 0.86166770f, 0.86131818f,
-    0.86091819f, 0.86046917f, 0.85997276f, 0.85943076f, 0.85884514f, 0.85821806f, 0.85755181f, 0.85684886f,
-    0.85611179f, 0.85534334f, 0.85454636f, 0.85372381f, 0.85287874f, 0.85201431f, 0.85113374f, 0.85024034f,
-    0.84933743f, 0.84842841f, 0.84751669f, 0.84660570f, 0.84569887f, 0.84479961f, 0.84391133f, 0.84303737f,
-    0.84218107f, 0.84134565f, 0.84053430f, 0.83975011f, 0.83899606f, 0.83827504f, 0.83758982f, 0.83694302f,
-    0.83633715f, 0.83577453f, 0.83525735f, 0.83478763f, 0.83436721f, 0.83399774f, 0.83368069f, 0.83341735f,
-    0.83320877f, 0.83305584f, 0.83295921f, 0.83291933f, 0.83293644f, 0.83301057f, 0.83314153f, 0.83332891f,
-    0.83357211f, 0.83387028f, 0.83422240f, 0.83462723f, 0.83508333f, 0.83558906f, 0.83614260f, 0.83674195f,
-    0.83738493f, 0.83806917f, 0.83879219f, 0.83955131f, 0.84034374f, 0.84116656f, 0.84201671f, 0.84289105f,
-    0.84378631f, 0.84469917f, 0.84562622f, 0.84656399f, 0.84750898f, 0.84845763f, 0.84940638f, 0.85035166f,
-    0.85128990f, 0.85221756f, 0.85313114f, 0.85402715f, 0.85490221f, 0.85575298f, 0.85657621f, 0.85736876f,
-    0.85812759f, 0.85884978f, 0.85953254f, 0.86017324f, 0.86076938f, 0.86131865f, 0.86181888f, 0.86226811f,
-    0.86266455f, 0.86300661f, 0.86329290f, 0.86352225f, 0.86369368f, 0.86380643f, 0.86385999f, 0.86385402f,
-    0.86378845f, 0.86366341f, 0.86347925f, 0.86323656f, 0.86293613f, 0.86257900f, 0.86216639f, 0.86169975f,
-    0.86118073f, 0.86061119f, 0.85999317f, 0.85932891f, 0.85862081f, 0.85787145f, 0.85708358f, 0.85626009f,
-    0.85540399f, 0.85451846f, 0.85360677f, 0.85267229f, 0.85171851f, 0.85074897f, 0.84976728f, 0.84877714f,
-    0.84778223f, 0.84678631f, 0.84579311f, 0.84480639f, 0.84382987f, 0.84286724f, 0.84192218f, 0.84099826f,
-    0.84009901f, 0.83922787f, 0.83838819f, 0.83758318f, 0.83681595f, 0.83608947f, 0.83540657f, 0.83476991f,
-    0.83418199f, 0.83364512f, 0.83316144f, 0.83273289f, 0.83236119f, 0.83204788f, 0.83179425f, 0.83160141f,
-    0.83147020f, 0.83140126f, 0.83139498f, 0.83145154f, 0.83157085f, 0.83175262f, 0.83199628f, 0.83230108f,
-    0.83266599f, 0.83308979f, 0.83357100f, 0.83410796f, 0.83469875f, 0.83534130f, 0.83603328f, 0.83677222f,
-    0.83755544f, 0.83838009f, 0.83924316f, 0.84014150f, 0.84107180f, 0.84203064f, 0.84301448f, 0.84401966f,
-    0.84504245f, 0.84607905f, 0.84712558f, 0.84817813f, 0.84923275f, 0.85028546f, 0.85133231f, 0.85236932f,
-    0.85339259f, 0.85439821f, 0.85538235f, 0.85634127f, 0.85727127f, 0.85816880f, 0.85903038f, 0.85985269f,
-    0.86063252f, 0.86136684f, 0.86205276f, 0.86268757f, 0.86326877f, 0.86379401f, 0.86426119f, 0.86466838f,
-    0.86501391f, 0.86529631f, 0.86551436f, 0.86566706f, 0.86575368f, 0.86577370f, 0.86572690f, 0.86561325f,
-    0.86543302f, 0.86518671f, 0.86487507f, 0.86449910f, 0.86406005f, 0.86355939f, 0.86299885f, 0.86238038f,
-    0.86170616f, 0.86097856f, 0.86020019f, 0.85937384f, 0.85850249f, 0.85758930f, 0.85663759f, 0.85565084f,
-    0.85463267f, 0.85358683f, 0.85251718f, 0.85142768f, 0.85032239f, 0.84920541f, 0.84808093f, 0.84695316f,
-    0.84582634f, 0.84470471f, 0.84359251f, 0.84249397f, 0.84141325f, 0.84035449f, 0.83932173f, 0.83831893f,
-    0.83734997f, 0.83641859f, 0.83552841f, 0.83468291f, 0.83388540f, 0.83313902f, 0.83244674f, 0.83181134f,
-    0.83123537f, 0.83072117f, 0.83027088f, 0.82988639f, 0.82956933f, 0.82932110f, 0.82914287f, 0.82903549f,
-    0.82899961f, 0.82903557f, 0.82914345f, 0.82932308f, 0.82957400f, 0.82989549f, 0.83028655f, 0.83074592f,
-    0.83127210f, 0.83186331f, 0.83251753f, 0.83323248f, 0.83400568f, 0.83483440f, 0.83571568f, 0.83664638f,
-    0.83762314f, 0.83864245f, 0.83970059f, 0.84079371f, 0.84191779f, 0.84306872f, 0.84424222f, 0.84543397f,
-    0.84663953f, 0.84785441f, 0.84907405f, 0.85029388f, 0.85150930f, 0.85271572f, 0.85390856f, 0.85508329f,
-    0.85623541f, 0.85736051f, 0.85845426f, 0.85951243f, 0.86053091f, 0.86150572f, 0.86243305f, 0.86330924f,
-    0.86413080f, 0.86489446f, 0.86559713f, 0.86623595f, 0.86680830f, 0.86731178f, 0.86774425f, 0.86810383f,
-    0.86838891f, 0.86859815f, 0.86873049f, 0.86878516f, 0.86876167f, 0.86865982f, 0.86847972f, 0.86822177f,
-    0.86788665f, 0.86747535f, 0.86698913f, 0.86642955f, 0.86579846f, 0.86509795f, 0.86433043f, 0.86349853f,
-    0.86260515f, 0.86165342f, 0.86064670f, 0.85958860f, 0.85848290f, 0.85733359f, 0.85614483f, 0.85492095f,
-    0.85366643f, 0.85238589f, 0.85108404f, 0.84976571f, 0.84843581f, 0.84709931f, 0.84576120f, 0.84442654f,
-    0.84310037f, 0.84178771f, 0.84049356f, 0.83922289f, 0.83798056f, 0.83677138f, 0.83560003f, 0.83447108f,
-    0.83338896f, 0.83235794f, 0.83138210f, 0.83046535f, 0.82961138f, 0.82882368f, 0.82810547f, 0.82745976f,
-    0.82688928f, 0.82639648f, 0.82598355f, 0.82565237f, 0.82540455f, 0.82524135f, 0.82516376f, 0.82517242f,
-    0.82526767f, 0.82544951f, 0.82571764f, 0.82607140f, 0.82650984f, 0.82703165f, 0.82763525f, 0.82831869f,
-    0.82907977f, 0.82991594f, 0.83082438f, 0.83180198f, 0.83284537f, 0.83395090f, 0.83511467f, 0.83633256f,
-    0.83760023f, 0.83891310f, 0.84026645f, 0.84165534f, 0.84307470f, 0.84451933f, 0.84598388f, 0.84746293f,
-    0.84895096f, 0.85044242f, 0.85193168f, 0.85341314f, 0.85488115f, 0.85633014f, 0.85775455f, 0.85914888f,
-    0.86050775f, 0.86182585f, 0.86309804f, 0.86431929f, 0.86548476f, 0.86658978f, 0.86762990f, 0.86860089f,
-    0.86949875f, 0.87031973f, 0.87106038f, 0.87171750f, 0.87228821f, 0.87276993f, 0.87316041f, 0.87345772f,
-    0.87366027f, 0.87376684f, 0.87377655f, 0.87368885f, 0.87350361f, 0.87322103f, 0.87284166f, 0.87236647f,
-    0.87179674f, 0.87113414f, 0.87038070f, 0.86953878f, 0.86861110f, 0.86760072f, 0.86651102f, 0.86534568f,
-    0.86410871f, 0.86280439f, 0.86143730f, 0.86001224f, 0.85853429f, 0.85700874f, 0.85544108f, 0.85383701f,
-    0.85220237f, 0.85054317f, 0.84886552f, 0.84717567f, 0.84547990f, 0.84378459f, 0.84209614f, 0.84042094f,
-    0.83876540f, 0.83713586f, 0.83553862f, 0.83397989f, 0.83246575f, 0.83100219f, 0.82959500f, 0.82824981f,
-    0.82697205f, 0.82576694f, 0.82463942f, 0.82359422f, 0.82263575f, 0.82176812f, 0.82099515f, 0.82032031f,
-    0.81974672f, 0.81927715f, 0.81891398f, 0.81865922f, 0.81851448f, 0.81848096f, 0.81855947f, 0.81875039f,
-    0.81905367f, 0.81946887f, 0.81999510f, 0.82063105f, 0.82137501f, 0.82222483f, 0.82317798f, 0.82423149f,
-    0.82538203f, 0.82662585f, 0.82795886f, 0.82937660f, 0.83087425f, 0.83244667f, 0.83408841f, 0.83579373f,
-    0.83755658f, 0.83937071f, 0.84122959f, 0.84312651f, 0.84505455f, 0.84700664f, 0.84897559f, 0.85095406f,
-    0.85293466f, 0.85490992f, 0.85687236f, 0.85881448f, 0.86072881f, 0.86260794f, 0.86444453f, 0.86623137f,
-    0.86796136f, 0.86962757f, 0.87122329f, 0.87274198f, 0.87417738f, 0.87552349f, 0.87677458f, 0.87792526f,
-    0.87897048f, 0.87990552f, 0.88072607f, 0.88142820f, 0.88200840f, 0.88246360f, 0.88279115f, 0.88298888f,
-    0.88305509f, 0.88298855f, 0.88278853f, 0.88245477f, 0.88198754f, 0.88138760f, 0.88065619f, 0.87979508f,
-    0.87880653f, 0.87769330f, 0.87645862f, 0.87510622f, 0.87364028f, 0.87206545f, 0.87038682f, 0.86860992f,
-    0.86674068f, 0.86478541f, 0.86275081f, 0.86064393f, 0.85847214f, 0.85624312f, 0.85396482f, 0.85164544f,
-    0.84929340f, 0.84691732f, 0.84452597f, 0.84212825f, 0.83973318f, 0.83734981f, 0.83498725f, 0.83265460f,
-    0.83036093f, 0.82811524f, 0.82592643f, 0.82380325f, 0.82175431f, 0.81978799f, 0.81791244f, 0.81613556f,
-    0.81446495f, 0.81290785f, 0.81147117f, 0.81016143f, 0.80898473f, 0.80794672f, 0.80705261f, 0.80630709f,
-    0.80571436f, 0.80527807f, 0.80500135f, 0.80488673f, 0.80493619f, 0.80515110f, 0.80553221f, 0.80607970f,
-    0.80679309f, 0.80767130f, 0.80871261f, 0.80991470f, 0.81127461f, 0.81278875f, 0.81445295f, 0.81626241f,
-    0.81821176f, 0.82029505f, 0.82250577f, 0.82483686f, 0.82728076f, 0.82982939f, 0.83247421f, 0.83520622f,
-    0.83801602f, 0.84089380f, 0.84382941f, 0.84681237f, 0.84983190f, 0.85287698f, 0.85593639f, 0.85899869f,
-    0.86205235f, 0.86508572f, 0.86808709f, 0.87104475f, 0.87394703f, 0.87678230f, 0.87953909f, 0.88220604f,
-    0.88477204f, 0.88722619f, 0.88955790f, 0.89175689f, 0.89381328f, 0.89571756f, 0.89746070f, 0.89903415f,
-    0.90042989f, 0.90164044f, 0.90265895f, 0.90347915f, 0.90409548f, 0.90450301f, 0.90469756f, 0.90467566f,
-    0.90443462f, 0.90397251f, 0.90328819f, 0.90238133f, 0.90125243f, 0.89990280f, 0.89833459f, 0.89655078f,
-    0.89455519f, 0.89235249f, 0.88994815f, 0.88734848f, 0.88456059f, 0.88159237f, 0.87845252f, 0.87515046f,
-    0.87169638f, 0.86810113f, 0.86437628f, 0.86053403f, 0.85658719f, 0.85254915f, 0.84843383f, 0.84425566f,
-    0.84002950f, 0.83577063f, 0.83149469f, 0.82721762f, 0.82295562f, 0.81872508f, 0.81454255f, 0.81042469f,
-    0.80638815f, 0.80244961f, 0.79862562f, 0.79493264f, 0.79138687f, 0.78800432f, 0.78480061f, 0.78179104f,
-    0.77899043f, 0.77641313f, 0.77407291f, 0.77198296f, 0.77015576f, 0.76860311f, 0.76733600f, 0.76636461f,
-    0.76569823f, 0.76534525f, 0.76531307f, 0.76560807f, 0.76623559f, 0.76719988f, 0.76850407f, 0.77015011f,
-    0.77213878f, 0.77446964f, 0.77714103f, 0.78015002f, 0.78349243f, 0.78716277f, 0.79115430f, 0.79545896f,
-    0.80006742f, 0.80496903f, 0.81015189f, 0.81560282f, 0.82130738f, 0.82724989f, 0.83341348f, 0.83978006f,
-    0.84633042f, 0.85304421f, 0.85989998f, 0.86687528f, 0.87394663f, 0.88108962f, 0.88827893f, 0.89548840f,
-    0.90269110f, 0.90985938f, 0.91696491f, 0.92397878f, 0.93087156f, 0.93761337f, 0.94417394f, 0.95052271f,
-    0.95662887f, 0.96246149f, 0.96798954f, 0.97318202f, 0.97800802f, 0.98243679f, 0.98643786f, 0.98998106f,
-    0.99303668f, 0.99557547f, 0.99756881f, 0.99898870f, 0.99980790f, 1.00000000f, 0.99953947f, 0.99840177f,
-    0.99656338f, 0.99400192f, 0.99069618f, 0.98662621f, 0.98177337f, 0.97612038f, 0.96965142f, 0.96235214f,
-    0.95420970f, 0.94521288f, 0.93535207f, 0.92461931f, 0.91300835f, 0.90051467f, 0.88713550f, 0.87286984f,
-    0.85771851f, 0.84168410f, 0.82477104f, 0.80698557f, 0.78833576f, 0.76883149f, 0.74848442f, 0.72730802f,
-    0.70531753f, 0.68252993f, 0.65896391f, 0.63463985f, 0.60957977f, 0.58380730f, 0.55734762f, 0.53022742f,
-    0.50247484f, 0.47411943f, 0.44519205f, 0.41572485f, 0.38575117f, 0.35530548f, 0.32442330f, 0.29314112f,
-    0.26149635f, 0.22952718f, 0.19727255f, 0.16477203f, 0.13206576f, 0.09919433f, 0.06619870f, 0.03312011f,
-    0.00000000f, -0.03312011f, -0.06619870f, -0.09919433f, -0.13206576f, -0.16477203f, -0.19727255f, -0.22952718f,
-    -0.26149635f, -0.29314112f, -0.32442330f, -0.35530548f, -0.38575117f, -0.41572485f, -0.44519205f, -0.47411943f,
-    -0.50247484f, -0.53022742f, -0.55734762f, -0.58380730f, -0.60957977f, -0.63463985f, -0.65896391f, -0.68252993f,
-    -0.70531753f, -0.72730802f, -0.74848442f, -0.76883149f, -0.78833576f, -0.80698557f, -0.82477104f, -0.84168410f,
-    -0.85771851f, -0.87286984f, -0.88713550f, -0.90051467f, -0.91300835f, -0.92461931f, -0.93535207f, -0.94521288f,
-    -0.95420970f, -0.96235214f, -0.96965142f, -0.97612038f, -0.98177337f, -0.98662621f, -0.99069618f, -0.99400192f,
-    -0.99656338f, -0.99840177f, -0.99953947f, -1.00000000f, -0.99980790f, -0.99898870f, -0.99756881f, -0.99557547f,
-    -0.99303668f, -0.98998106f, -0.98643786f, -0.98243679f, -0.97800802f, -0.97318202f, -0.96798954f, -0.96246149f,
-    -0.95662887f, -0.95052271f, -0.94417394f, -0.93761337f, -0.93087156f, -0.92397878f, -0.91696491f, -0.90985938f,
-    -0.90269110f, -0.89548840f, -0.88827893f, -0.88108962f, -0.87394663f, -0.86687528f, -0.85989998f, -0.85304421f,
-    -0.84633042f, -0.83978006f, -0.83341348f, -0.82724989f, -0.82130738f, -0.81560282f, -0.81015189f, -0.80496903f,
-    -0.80006742f, -0.79545896f, -0.79115430f, -0.78716277f, -0.78349243f, -0.78015002f, -0.77714103f, -0.77446964f,
-    -0.77213878f, -0.77015011f, -0.76850407f, -0.76719988f, -0.76623559f, -0.76560807f, -0.76531307f, -0.76534525f,
-    -0.76569823f, -0.76636461f, -0.76733600f, -0.76860311f, -0.77015576f, -0.77198296f, -0.77407291f, -0.77641313f,
-    -0.77899043f, -0.78179104f, -0.78480061f, -0.78800432f, -0.79138687f, -0.79493264f, -0.79862562f, -0.80244961f,
-    -0.80638815f, -0.81042469f, -0.81454255f, -0.81872508f, -0.82295562f, -0.82721762f, -0.83149469f, -0.83577063f,
-    -0.84002950f, -0.84425566f, -0.84843383f, -0.85254915f, -0.85658719f, -0.86053403f, -0.86437628f, -0.86810113f,
-    -0.87169638f, -0.87515046f, -0.87845252f, -0.88159237f, -0.88456059f, -0.88734848f, -0.88994815f, -0.89235249f,
-    -0.89455519f, -0.89655078f, -0.89833459f, -0.89990280f, -0.90125243f, -0.90238133f, -0.90328819f, -0.90397251f,
-    -0.90443462f, -0.90467566f, -0.90469756f, -0.90450301f, -0.90409548f, -0.90347915f, -0.90265895f, -0.90164044f,
-    -0.90042989f, -0.89903415f, -0.89746070f, -0.89571756f, -0.89381328f, -0.89175689f, -0.88955790f, -0.88722619f,
-    -0.88477204f, -0.88220604f, -0.87953909f, -0.87678230f, -0.87394703f, -0.87104475f, -0.86808709f, -0.86508572f,
-    -0.86205235f, -0.85899869f, -0.85593639f, -0.85287698f, -0.84983190f, -0.84681237f, -0.84382941f, -0.84089380f,
-    -0.83801602f, -0.83520622f, -0.83247421f, -0.82982939f, -0.82728076f, -0.82483686f, -0.82250577f, -0.82029505f,
-    -0.81821176f, -0.81626241f, -0.81445295f, -0.81278875f, -0.81127461f, -0.80991470f, -0.80871261f, -0.80767130f,
-    -0.80679309f, -0.80607970f, -0.80553221f, -0.80515110f, -0.80493619f, -0.80488673f, -0.80500135f, -0.80527807f,
-    -0.80571436f, -0.80630709f, -0.80705261f, -0.80794672f, -0.80898473f, -0.81016143f, -0.81147117f, -0.81290785f,
-    -0.81446495f, -0.81613556f, -0.81791244f, -0.81978799f, -0.82175431f, -0.82380325f, -0.82592643f, -0.82811524f,
-    -0.83036093f, -0.83265460f, -0.83498725f, -0.83734981f, -0.83973318f, -0.84212825f, -0.84452597f, -0.84691732f,
-    -0.84929340f, -0.85164544f, -0.85396482f, -0.85624312f, -0.85847214f, -0.86064393f, -0.86275081f, -0.86478541f,
-    -0.86674068f, -0.86860992f, -0.87038682f, -0.87206545f, -0.87364028f, -0.87510622f, -0.87645862f, -0.87769330f,
-    -0.87880653f, -0.87979508f, -0.88065619f, -0.88138760f, -0.88198754f, -0.88245477f, -0.88278853f, -0.88298855f,
-    -0.88305509f, -0.88298888f, -0.88279115f, -0.88246360f, -0.88200840f, -0.88142820f, -0.88072607f, -0.87990552f,
-    -0.87897048f, -0.87792526f, -0.87677458f, -0.87552349f, -0.87417738f, -0.87274198f, -0.87122329f, -0.86962757f,
-    -0.86796136f, -0.86623137f, -0.86444453f, -0.86260794f, -0.86072881f, -0.85881448f, -0.85687236f, -0.85490992f,
-    -0.85293466f, -0.85095406f, -0.84897559f, -0.84700664f, -0.84505455f, -0.84312651f, -0.84122959f, -0.83937071f,
-    -0.83755658f, -0.83579373f, -0.83408841f, -0.83244667f, -0.83087425f, -0.82937660f, -0.82795886f, -0.82662585f,
-    -0.82538203f, -0.82423149f, -0.82317798f, -0.82222483f, -0.82137501f, -0.82063105f, -0.81999510f, -0.81946887f,
-    -0.81905367f, -0.81875039f, -0.81855947f, -0.81848096f, -0.81851448f, -0.81865922f, -0.81891398f, -0.81927715f,
-    -0.81974672f, -0.82032031f, -0.82099515f, -0.82176812f, -0.82263575f, -0.82359422f, -0.82463942f, -0.82576694f,
-    -0.82697205f, -0.82824981f, -0.82959500f, -0.83100219f, -0.83246575f, -0.83397989f, -0.83553862f, -0.83713586f,
-    -0.83876540f, -0.84042094f, -0.84209614f, -0.84378459f, -0.84547990f, -0.84717567f, -0.84886552f, -0.85054317f,
-    -0.85220237f, -0.85383701f, -0.85544108f, -0.85700874f, -0.85853429f, -0.86001224f, -0.86143730f, -0.86280439f,
-    -0.86410871f, -0.86534568f, -0.86651102f, -0.86760072f, -0.86861110f, -0.86953878f, -0.87038070f, -0.87113414f,
-    -0.87179674f, -0.87236647f, -0.87284166f, -0.87322103f, -0.87350361f, -0.87368885f, -0.87377655f, -0.87376684f,
-    -0.87366027f, -0.87345772f, -0.87316041f, -0.87276993f, -0.87228821f, -0.87171750f, -0.87106038f, -0.87031973f,
-    -0.86949875f, -0.86860089f, -0.86762990f, -0.86658978f, -0.86548476f, -0.86431929f, -0.86309804f, -0.86182585f,
-    -0.86050775f, -0.85914888f, -0.85775455f, -0.85633014f, -0.85488115f, -0.85341314f, -0.85193168f, -0.85044242f,
-    -0.84895096f, -0.84746293f, -0.84598388f, -0.84451933f, -0.84307470f, -0.84165534f, -0.84026645f, -0.83891310f,
-    -0.83760023f, -0.83633256f, -0.83511467f, -0.83395090f, -0.83284537f, -0.83180198f, -0.83082438f, -0.82991594f,
-    -0.82907977f, -0.82831869f, -0.82763525f, -0.82703165f, -0.82650984f, -0.82607140f, -0.82571764f, -0.82544951f,
-    -0.82526767f, -0.82517242f, -0.82516376f, -0.82524135f, -0.82540455f, -0.82565237f, -0.82598355f, -0.82639648f,
-    -0.82688928f, -0.82745976f, -0.82810547f, -0.82882368f, -0.82961138f, -0.83046535f, -0.83138210f, -0.83235794f,
-    -0.83338896f, -0.83447108f, -0.83560003f, -0.83677138f, -0.83798056f, -0.83922289f, -0.84049356f, -0.84178771f,
-    -0.84310037f, -0.84442654f, -0.84576120f, -0.84709931f, -0.84843581f, -0.84976571f, -0.85108404f, -0.85238589f,
-    -0.85366643f, -0.85492095f, -0.85614483f, -0.85733359f, -0.85848290f, -0.85958860f, -0.86064670f, -0.86165342f,
-    -0.86260515f, -0.86349853f, -0.86433043f, -0.86509795f, -0.86579846f, -0.86642955f, -0.86698913f, -0.86747535f,
-    -0.86788665f, -0.86822177f, -0.86847972f, -0.86865982f, -0.86876167f, -0.86878516f, -0.86873049f, -0.86859815f,
-    -0.86838891f, -0.86810383f, -0.86774425f, -0.86731178f, -0.86680830f, -0.86623595f, -0.86559713f, -0.86489446f,
-    -0.86413080f, -0.86330924f, -0.86243305f, -0.86150572f, -0.86053091f, -0.85951243f, -0.85845426f, -0.85736051f,
-    -0.85623541f, -0.85508329f, -0.85390856f, -0.85271572f, -0.85150930f, -0.85029388f, -0.84907405f, -0.84785441f,
-    -0.84663953f, -0.84543397f, -0.84424222f, -0.84306872f, -0.84191779f, -0.84079371f, -0.83970059f, -0.83864245f,
-    -0.83762314f, -0.83664638f, -0.83571568f, -0.83483440f, -0.83400568f, -0.83323248f, -0.83251753f, -0.83186331f,
-    -0.83127210f, -0.83074592f, -0.83028655f, -0.82989549f, -0.82957400f, -0.82932308f, -0.82914345f, -0.82903557f,
-    -0.82899961f, -0.82903549f, -0.82914287f, -0.82932110f, -0.82956933f, -0.82988639f, -0.83027088f, -0.83072117f,
-    -0.83123537f, -0.83181134f, -0.83244674f, -0.83313902f, -0.83388540f, -0.83468291f, -0.83552841f, -0.83641859f,
-    -0.83734997f, -0.83831893f, -0.83932173f, -0.84035449f, -0.84141325f, -0.84249397f, -0.84359251f, -0.84470471f,
-    -0.84582634f, -0.84695316f, -0.84808093f, -0.84920541f, -0.85032239f, -0.85142768f, -0.85251718f, -0.85358683f,
-    -0.85463267f, -0.85565084f, -0.85663759f, -0.85758930f, -0.85850249f, -0.85937384f, -0.86020019f, -0.86097856f,
-    -0.86170616f, -0.86238038f, -0.86299885f, -0.86355939f, -0.86406005f, -0.86449910f, -0.86487507f, -0.86518671f,
-    -0.86543302f, -0.86561325f, -0.86572690f, -0.86577370f, -0.86575368f, -0.86566706f, -0.86551436f, -0.86529631f,
-    -0.86501391f, -0.86466838f, -0.86426119f, -0.86379401f, -0.86326877f, -0.86268757f, -0.86205276f, -0.86136684f,
-    -0.86063252f, -0.85985269f, -0.85903038f, -0.85816880f, -0.85727127f, -0.85634127f, -0.85538235f, -0.85439821f,
-    -0.85339259f, -0.85236932f, -0.85133231f, -0.85028546f, -0.84923275f, -0.84817813f, -0.84712558f, -0.84607905f,
-    -0.84504245f, -0.84401966f, -0.84301448f, -0.84203064f, -0.84107180f, -0.84014150f, -0.83924316f, -0.83838009f,
-    -0.83755544f, -0.83677222f, -0.83603328f, -0.83534130f, -0.83469875f, -0.83410796f, -0.83357100f, -0.83308979f,
-    -0.83266599f, -0.83230108f, -0.83199628f, -0.83175262f, -0.83157085f, -0.83145154f, -0.83139498f, -0.83140126f,
-    -0.83147020f, -0.83160141f, -0.83179425f, -0.83204788f, -0.83236119f, -0.83273289f, -0.83316144f, -0.83364512f,
-    -0.83418199f, -0.83476991f, -0.83540657f, -0.83608947f, -0.83681595f, -0.83758318f, -0.83838819f, -0.83922787f,
-    -0.84009901f, -0.84099826f, -0.84192218f, -0.84286724f, -0.84382987f, -0.84480639f, -0.84579311f, -0.84678631f,
-    -0.84778223f, -0.84877714f, -0.84976728f, -0.85074897f, -0.85171851f, -0.85267229f, -0.85360677f, -0.85451846f,
-    -0.85540399f, -0.85626009f, -0.85708358f, -0.85787145f, -0.85862081f, -0.85932891f, -0.85999317f, -0.86061119f,
-    -0.86118073f, -0.86169975f, -0.86216639f, -0.86257900f, -0.86293613f, -0.86323656f, -0.86347925f, -0.86366341f,
-    -0.86378845f, -0.86385402f, -0.86385999f, -0.86380643f, -0.86369368f, -0.86352225f, -0.86329290f, -0.86300661f,
-    -0.86266455f, -0.86226811f, -0.86181888f, -0.86131865f, -0.86076938f, -0.86017324f, -0.85953254f, -0.85884978f,
-    -0.85812759f, -0.85736876f, -0.85657621f, -0.85575298f, -0.85490221f, -0.85402715f, -0.85313114f, -0.85221756f,
-    -0.85128990f, -0.85035166f, -0.84940638f, -0.84845763f, -0.84750898f, -0.84656399f, -0.84562622f, -0.84469917f,
-    -0.84378631f, -0.84289105f, -0.84201671f, -0.84116656f, -0.84034374f, -0.83955131f, -0.83879219f, -0.83806917f,
-    -0.83738493f, -0.83674195f, -0.83614260f, -0.83558906f, -0.83508333f, -0.83462723f, -0.83422240f, -0.83387028f,
-    -0.83357211f, -0.83332891f, -0.83314153f, -0.83301057f, -0.83293644f, -0.83291933f, -0.83295921f, -0.83305584f,
-    -0.83320877f, -0.83341735f, -0.83368069f, -0.83399774f, -0.83436721f, -0.83478763f, -0.83525735f, -0.83577453f,
-    -0.83633715f, -0.83694302f, -0.83758982f, -0.83827504f, -0.83899606f, -0.83975011f, -0.84053430f, -0.84134565f,
-    -0.84218107f, -0.84303737f, -0.84391133f, -0.84479961f, -0.84569887f, -0.84660570f, -0.84751669f, -0.84842841f,
-    -0.84933743f, -0.85024034f, -0.85113374f, -0.85201431f, -0.85287874f, -0.85372381f, -0.85454636f, -0.85534334f,
-    -0.85611179f, -0.85684886f, -0.85755181f, -0.85821806f, -0.85884514f, -0.85943076f, -0.85997276f, -0.86046917f,
-    -0.86091819f, -0.86131818f, -0.86166770f, -0.86196552f, -0.86221057f, -0.86240200f, -0.86253917f, -0.86262163f,
-    -0.86264914f, -0.86262165f, -0.86253936f, -0.86240263f, -0.86221205f, -0.86196840f, -0.86167267f, -0.86132602f,
-    -0.86092983f, -0.86048565f, -0.85999520f, -0.85946039f, -0.85888327f, -0.85826607f, -0.85761117f, -0.85692105f,
-    -0.85619837f, -0.85544587f, -0.85466643f, -0.85386299f, -0.85303862f, -0.85219643f, -0.85133961f, -0.85047139f,
-    -0.84959507f, -0.84871393f, -0.84783130f, -0.84695049f, -0.84607482f, -0.84520758f, -0.84435200f, -0.84351130f,
-    -0.84268862f, -0.84188704f, -0.84110953f, -0.84035901f, -0.83963826f, -0.83894996f, -0.83829666f, -0.83768078f,
-    -0.83710460f, -0.83657025f, -0.83607967f, -0.83563468f, -0.83523691f, -0.83488778f, -0.83458858f, -0.83434037f,
-    -0.83414403f, -0.83400025f, -0.83390951f, -0.83387211f, -0.83388813f, -0.83395746f, -0.83407979f, -0.83425459f,
-    -0.83448117f, -0.83475863f, -0.83508586f, -0.83546159f, -0.83588436f, -0.83635254f, -0.83686433f, -0.83741775f,
-    -0.83801070f, -0.83864089f, -0.83930594f, -0.84000330f, -0.84073033f, -0.84148426f, -0.84226224f, -0.84306132f,
-    -0.84387847f, -0.84471061f, -0.84555460f, -0.84640724f, -0.84726534f, -0.84812565f, -0.84898495f, -0.84983999f,
-    -0.85068758f, -0.85152452f, -0.85234769f, -0.85315399f, -0.85394042f, -0.85470403f, -0.85544196f, -0.85615147f,
-    -0.85682991f, -0.85747475f, -0.85808360f, -0.85865420f, -0.85918443f, -0.85967233f, -0.86011610f, -0.86051410f,
-    -0.86086487f, -0.86116714f, -0.86141980f, -0.86162194f, -0.86177284f, -0.86187196f, -0.86191898f, -0.86191376f,
-    -0.86185635f, -0.86174701f, -0.86158619f, -0.86137452f, -0.86111285f, -0.86080219f, -0.86044374f, -0.86003889f,
-    -0.85958919f, -0.85909636f, -0.85856228f, -0.85798899f, -0.85737868f, -0.85673365f, -0.85605637f, -0.85534940f,
-    -0.85461542f, -0.85385720f, -0.85307761f, -0.85227959f, -0.85146617f, -0.85064040f, -0.84980540f, -0.84896432f,
-    -0.84812032f, -0.84727658f, -0.84643627f, -0.84560254f, -0.84477853f, -0.84396734f, -0.84317200f, -0.84239550f,
-    -0.84164074f, -0.84091055f, -0.84020766f, -0.83953471f, -0.83889419f, -0.83828852f, -0.83771993f, -0.83719056f,
-    -0.83670236f, -0.83625717f, -0.83585661f, -0.83550219f, -0.83519520f, -0.83493678f, -0.83472787f, -0.83456924f,
-    -0.83446146f, -0.83440490f, -0.83439975f, -0.83444601f, -0.83454349f, -0.83469178f, -0.83489031f, -0.83513830f,
-    -0.83543480f, -0.83577868f, -0.83616862f, -0.83660313f, -0.83708056f, -0.83759910f, -0.83815677f, -0.83875146f,
-    -0.83938093f, -0.84004278f, -0.84073452f, -0.84145353f, -0.84219710f, -0.84296243f, -0.84374661f, -0.84454671f,
-    -0.84535970f, -0.84618251f, -0.84701207f, -0.84784523f, -0.84867887f, -0.84950985f, -0.85033505f, -0.85115136f,
-    -0.85195572f, -0.85274511f, -0.85351656f, -0.85426718f, -0.85499415f, -0.85569475f, -0.85636635f, -0.85700643f,
-    -0.85761260f, -0.85818258f, -0.85871425f, -0.85920561f, -0.85965483f, -0.86006023f, -0.86042030f, -0.86073370f,
-    -0.86099926f, -0.86121600f, -0.86138310f, -0.86149997f, -0.86156617f, -0.86158146f, -0.86154579f, -0.86145933f,
-    -0.86132239f, -0.86113552f, -0.86089942f, -0.86061499f, -0.86028331f, -0.85990564f, -0.85948340f, -0.85901821f,
-    -0.85851181f, -0.85796611f, -0.85738318f, -0.85676522f, -0.85611455f, -0.85543363f, -0.85472502f, -0.85399140f,
-    -0.85323553f, -0.85246025f, -0.85166848f, -0.85086321f, -0.85004746f, -0.84922430f, -0.84839683f, -0.84756817f,
-    -0.84674142f, -0.84591971f, -0.84510611f, -0.84430370f, -0.84351547f, -0.84274441f, -0.84199341f, -0.84126528f,
-    -0.84056277f, -0.83988852f, -0.83924506f, -0.83863481f, -0.83806007f, -0.83752299f, -0.83702558f, -0.83656973f,
-    -0.83615714f, -0.83578936f, -0.83546778f, -0.83519360f, -0.83496785f, -0.83479138f, -0.83466486f, -0.83458875f,
-    -0.83456335f, -0.83458875f, -0.83466486f, -0.83479138f, -0.83496785f, -0.83519360f, -0.83546778f, -0.83578936f,
-    -0.83615714f, -0.83656973f, -0.83702558f, -0.83752299f, -0.83806007f, -0.83863481f, -0.83924506f, -0.83988852f,
-    -0.84056277f, -0.84126528f, -0.84199341f, -0.84274441f, -0.84351547f, -0.84430370f, -0.84510611f, -0.84591971f,
-    -0.84674142f, -0.84756817f, -0.84839683f, -0.84922430f, -0.85004746f, -0.85086321f, -0.85166848f, -0.85246025f,
-    -0.85323553f, -0.85399140f, -0.85472502f, -0.85543363f, -0.85611455f, -0.85676522f, -0.85738318f, -0.85796611f,
-    -0.85851181f, -0.85901821f, -0.85948340f, -0.85990564f, -0.86028331f, -0.86061499f, -0.86089942f, -0.86113552f,
-    -0.86132239f, -0.86145933f, -0.86154579f, -0.86158146f, -0.86156617f, -0.86149997f, -0.86138310f, -0.86121600f,
-    -0.86099926f, -0.86073370f, -0.86042030f, -0.86006023f, -0.85965483f, -0.85920561f, -0.85871425f, -0.85818258f,
-    -0.85761260f, -0.85700643f, -0.85636635f, -0.85569475f, -0.85499415f, -0.85426718f, -0.85351656f, -0.85274511f,
-    -0.85195572f, -0.85115136f, -0.85033505f, -0.84950985f, -0.84867887f, -0.84784523f, -0.84701207f, -0.84618251f,
-    -0.84535970f, -0.84454671f, -0.84374661f, -0.84296243f, -0.84219710f, -0.84145353f, -0.84073452f, -0.84004278f,
-    -0.83938093f, -0.83875146f, -0.83815677f, -0.83759910f, -0.83708056f, -0.83660313f, -0.83616862f, -0.83577868f,
-    -0.83543480f, -0.83513830f, -0.83489031f, -0.83469178f, -0.83454349f, -0.83444601f, -0.83439975f, -0.83440490f,
-    -0.83446146f, -0.83456924f, -0.83472787f, -0.83493678f, -0.83519520f, -0.83550219f, -0.83585661f, -0.83625717f,
-    -0.83670236f, -0.83719056f, -0.83771993f, -0.83828852f, -0.83889419f, -0.83953471f, -0.84020766f, -0.84091055f,
-    -0.84164074f, -0.84239550f, -0.84317200f, -0.84396734f, -0.84477853f, -0.84560254f, -0.84643627f, -0.84727658f,
-    -0.84812032f, -0.84896432f, -0.84980540f, -0.85064040f, -0.85146617f, -0.85227959f, -0.85307761f, -0.85385720f,
-    -0.85461542f, -0.85534940f, -0.85605637f, -0.85673365f, -0.85737868f, -0.85798899f, -0.85856228f, -0.85909636f,
-    -0.85958919f, -0.86003889f, -0.86044374f, -0.86080219f, -0.86111285f, -0.86137452f, -0.86158619f, -0.86174701f,
-    -0.86185635f, -0.86191376f, -0.86191898f, -0.86187196f, -0.86177284f, -0.86162194f, -0.86141980f, -0.86116714f,
-    -0.86086487f, -0.86051410f, -0.86011610f, -0.85967233f, -0.85918443f, -0.85865420f, -0.85808360f, -0.85747475f,
-    -0.85682991f, -0.85615147f, -0.85544196f, -0.85470403f, -0.85394042f, -0.85315399f, -0.85234769f, -0.85152452f,
-    -0.85068758f, -0.84983999f, -0.84898495f, -0.84812565f, -0.84726534f, -0.84640724f, -0.84555460f, -0.84471061f,
-    -0.84387847f, -0.84306132f, -0.84226224f, -0.84148426f, -0.84073033f, -0.84000330f, -0.83930594f, -0.83864089f,
-    -0.83801070f, -0.83741775f, -0.83686433f, -0.83635254f, -0.83588436f, -0.83546159f, -0.83508586f, -0.83475863f,
-    -0.83448117f, -0.83425459f, -0.83407979f, -0.83395746f, -0.83388813f, -0.83387211f, -0.83390951f, -0.83400025f,
-    -0.83414403f, -0.83434037f, -0.83458858f, -0.83488778f, -0.83523691f, -0.83563468f, -0.83607967f, -0.83657025f,
-    -0.83710460f, -0.83768078f, -0.83829666f, -0.83894996f, -0.83963826f, -0.84035901f, -0.84110953f, -0.84188704f,
-    -0.84268862f, -0.84351130f, -0.84435200f, -0.84520758f, -0.84607482f, -0.84695049f, -0.84783130f, -0.84871393f,
-    -0.84959507f, -0.85047139f, -0.85133961f, -0.85219643f, -0.85303862f, -0.85386299f, -0.85466643f, -0.85544587f,
-    -0.85619837f, -0.85692105f, -0.85761117f, -0.85826607f, -0.85888327f, -0.85946039f, -0.85999520f, -0.86048565f,
-    -0.86092983f, -0.86132602f, -0.86167267f, -0.86196840f, -0.86221205f, -0.86240263f, -0.86253936f, -0.86262165f,
-    -0.86264914f, -0.86262163f, -0.86253917f, -0.86240200f, -0.86221057f, -0.86196552f, -0.86166770f, -0.86131818f,
-    -0.86091819f, -0.86046917f, -0.85997276f, -0.85943076f, -0.85884514f, -0.85821806f, -0.85755181f, -0.85684886f,
-    -0.85611179f, -0.85534334f, -0.85454636f, -0.85372381f, -0.85287874f, -0.85201431f, -0.85113374f, -0.85024034f,
-    -0.84933743f, -0.84842841f, -0.84751669f, -0.84660570f, -0.84569887f, -0.84479961f, -0.84391133f, -0.84303737f,
-    -0.84218107f, -0.84134565f, -0.84053430f, -0.83975011f, -0.83899606f, -0.83827504f, -0.83758982f, -0.83694302f,
-    -0.83633715f, -0.83577453f, -0.83525735f, -0.83478763f, -0.83436721f, -0.83399774f, -0.83368069f, -0.83341735f,
-    -0.83320877f, -0.83305584f, -0.83295921f, -0.83291933f, -0.83293644f, -0.83301057f, -0.83314153f, -0.83332891f,
-    -0.83357211f, -0.83387028f, -0.83422240f, -0.83462723f, -0.83508333f, -0.83558906f, -0.83614260f, -0.83674195f,
-    -0.83738493f, -0.83806917f, -0.83879219f, -0.83955131f, -0.84034374f, -0.84116656f, -0.84201671f, -0.84289105f,
-    -0.84378631f, -0.84469917f, -0.84562622f, -0.84656399f, -0.84750898f, -0.84845763f, -0.84940638f, -0.85035166f,
-    -0.85128990f, -0.85221756f, -0.85313114f, -0.85402715f, -0.85490221f, -0.85575298f, -0.85657621f, -0.85736876f,
-    -0.85812759f, -0.85884978f, -0.85953254f, -0.86017324f, -0.86076938f, -0.86131865f, -0.86181888f, -0.86226811f,
-    -0.86266455f, -0.86300661f, -0.86329290f, -0.86352225f, -0.86369368f, -0.86380643f, -0.86385999f, -0.86385402f,
-    -0.86378845f, -0.86366341f, -0.86347925f, -0.86323656f, -0.86293613f, -0.86257900f, -0.86216639f, -0.86169975f,
-    -0.86118073f, -0.86061119f, -0.85999317f, -0.85932891f, -0.85862081f, -0.85787145f, -0.85708358f, -0.85626009f,
-    -0.85540399f, -0.85451846f, -0.85360677f, -0.85267229f, -0.85171851f, -0.85074897f, -0.84976728f, -0.84877714f,
-    -0.84778223f, -0.84678631f, -0.84579311f, -0.84480639f, -0.84382987f, -0.84286724f, -0.84192218f, -0.84099826f,
-    -0.84009901f, -0.83922787f, -0.83838819f, -0.83758318f, -0.83681595f, -0.83608947f, -0.83540657f, -0.83476991f,
-    -0.83418199f, -0.83364512f, -0.83316144f, -0.83273289f, -0.83236119f, -0.83204788f, -0.83179425f, -0.83160141f,
-    -0.83147020f, -0.83140126f, -0.83139498f, -0.83145154f, -0.83157085f, -0.83175262f, -0.83199628f, -0.83230108f,
-    -0.83266599f, -0.83308979f, -0.83357100f, -0.83410796f, -0.83469875f, -0.83534130f, -0.83603328f, -0.83677222f,
-    -0.83755544f, -0.83838009f, -0.83924316f, -0.84014150f, -0.84107180f, -0.84203064f, -0.84301448f, -0.84401966f,
-    -0.84504245f, -0.84607905f, -0.84712558f, -0.84817813f, -0.84923275f, -0.85028546f, -0.85133231f, -0.85236932f,
-    -0.85339259f, -0.85439821f, -0.85538235f, -0.85634127f, -0.85727127f, -0.85816880f, -0.85903038f, -0.85985269f,
-    -0.86063252f, -0.86136684f, -0.86205276f, -0.86268757f, -0.86326877f, -0.86379401f, -0.86426119f, -0.86466838f,
-    -0.86501391f, -0.86529631f, -0.86551436f, -0.86566706f, -0.86575368f, -0.86577370f, -0.86572690f, -0.86561325f,
-    -0.86543302f, -0.86518671f, -0.86487507f, -0.86449910f, -0.86406005f, -0.86355939f, -0.86299885f, -0.86238038f,
-    -0.86170616f, -0.86097856f, -0.86020019f, -0.85937384f, -0.85850249f, -0.85758930f, -0.85663759f, -0.85565084f,
-    -0.85463267f, -0.85358683f, -0.85251718f, -0.85142768f, -0.85032239f, -0.84920541f, -0.84808093f, -0.84695316f,
-    -0.84582634f, -0.84470471f, -0.84359251f, -0.84249397f, -0.84141325f, -0.84035449f, -0.83932173f, -0.83831893f,
-    -0.83734997f, -0.83641859f, -0.83552841f, -0.83468291f, -0.83388540f, -0.83313902f, -0.83244674f, -0.83181134f,
-    -0.83123537f, -0.83072117f, -0.83027088f, -0.82988639f, -0.82956933f, -0.82932110f, -0.82914287f, -0.82903549f,
-    -0.82899961f, -0.82903557f, -0.82914345f, -0.82932308f, -0.82957400f, -0.82989549f, -0.83028655f, -0.83074592f,
-    -0.83127210f, -0.83186331f, -0.83251753f, -0.83323248f, -0.83400568f, -0.83483440f, -0.83571568f, -0.83664638f,
-    -0.83762314f, -0.83864245f, -0.83970059f, -0.84079371f, -0.84191779f, -0.84306872f, -0.84424222f, -0.84543397f,
-    -0.84663953f, -0.84785441f, -0.84907405f, -0.85029388f, -0.85150930f, -0.85271572f, -0.85390856f, -0.85508329f,
-    -0.85623541f, -0.85736051f, -0.85845426f, -0.85951243f, -0.86053091f, -0.86150572f, -0.86243305f, -0.86330924f,
-    -0.86413080f, -0.86489446f, -0.86559713f, -0.86623595f, -0.86680830f, -0.86731178f, -0.86774425f, -0.86810383f,
-    -0.86838891f, -0.86859815f, -0.86873049f, -0.86878516f, -0.86876167f, -0.86865982f, -0.86847972f, -0.86822177f,
-    -0.86788665f, -0.86747535f, -0.86698913f, -0.86642955f, -0.86579846f, -0.86509795f, -0.86433043f, -0.86349853f,
-    -0.86260515f, -0.86165342f, -0.86064670f, -0.85958860f, -0.85848290f, -0.85733359f, -0.85614483f, -0.85492095f,
-    -0.85366643f, -0.85238589f, -0.85108404f, -0.84976571f, -0.84843581f, -0.84709931f, -0.84576120f, -0.84442654f,
-    -0.84310037f, -0.84178771f, -0.84049356f, -0.83922289f, -0.83798056f, -0.83677138f, -0.83560003f, -0.83447108f,
-    -0.83338896f, -0.83235794f, -0.83138210f, -0.83046535f, -0.82961138f, -0.82882368f, -0.82810547f, -0.82745976f,
-    -0.82688928f, -0.82639648f, -0.82598355f, -0.82565237f, -0.82540455f, -0.82524135f, -0.82516376f, -0.82517242f,
-    -0.82526767f, -0.82544951f, -0.82571764f, -0.82607140f, -0.82650984f, -0.82703165f, -0.82763525f, -0.82831869f,
-    -0.82907977f, -0.82991594f, -0.83082438f, -0.83180198f, -0.83284537f, -0.83395090f, -0.83511467f, -0.83633256f,
-    -0.83760023f, -0.83891310f, -0.84026645f, -0.84165534f, -0.84307470f, -0.84451933f, -0.84598388f, -0.84746293f,
-    -0.84895096f, -0.85044242f, -0.85193168f, -0.85341314f, -0.85488115f, -0.85633014f, -0.85775455f, -0.85914888f,
-    -0.86050775f, -0.86182585f, -0.86309804f, -0.86431929f, -0.86548476f, -0.86658978f, -0.86762990f, -0.86860089f,
-    -0.86949875f, -0.87031973f, -0.87106038f, -0.87171750f, -0.87228821f, -0.87276993f, -0.87316041f, -0.87345772f,
-    -0.87366027f, -0.87376684f, -0.87377655f, -0.87368885f, -0.87350361f, -0.87322103f, -0.87284166f, -0.87236647f,
-    -0.87179674f, -0.87113414f, -0.87038070f, -0.86953878f, -0.86861110f, -0.86760072f, -0.86651102f, -0.86534568f,
-    -0.86410871f, -0.86280439f, -0.86143730f, -0.86001224f, -0.85853429f, -0.85700874f, -0.85544108f, -0.85383701f,
-    -0.85220237f, -0.85054317f, -0.84886552f, -0.84717567f, -0.84547990f, -0.84378459f, -0.84209614f, -0.84042094f,
-    -0.83876540f, -0.83713586f, -0.83553862f, -0.83397989f, -0.83246575f, -0.83100219f, -0.82959500f, -0.82824981f,
-    -0.82697205f, -0.82576694f, -0.82463942f, -0.82359422f, -0.82263575f, -0.82176812f, -0.82099515f, -0.82032031f,
-    -0.81974672f, -0.81927715f, -0.81891398f, -0.81865922f, -0.81851448f, -0.81848096f, -0.81855947f, -0.81875039f,
-    -0.81905367f, -0.81946887f, -0.81999510f, -0.82063105f, -0.82137501f, -0.82222483f, -0.82317798f, -0.82423149f,
-    -0.82538203f, -0.82662585f, -0.82795886f, -0.82937660f, -0.83087425f, -0.83244667f, -0.83408841f, -0.83579373f,
-    -0.83755658f, -0.83937071f, -0.84122959f, -0.84312651f, -0.84505455f, -0.84700664f, -0.84897559f, -0.85095406f,
-    -0.85293466f, -0.85490992f, -0.85687236f, -0.85881448f, -0.86072881f, -0.86260794f, -0.86444453f, -0.86623137f,
-    -0.86796136f, -0.86962757f, -0.87122329f, -0.87274198f, -0.87417738f, -0.87552349f, -0.87677458f, -0.87792526f,
-    -0.87897048f, -0.87990552f, -0.88072607f, -0.88142820f, -0.88200840f, -0.88246360f, -0.88279115f, -0.88298888f,
-    -0.88305509f, -0.88298855f, -0.88278853f, -0.88245477f, -0.88198754f, -0.88138760f, -0.88065619f, -0.87979508f,
-    -0.87880653f, -0.87769330f, -0.87645862f, -0.87510622f, -0.87364028f, -0.87206545f, -0.87038682f, -0.86860992f,
-    -0.86674068f, -0.86478541f, -0.86275081f, -0.86064393f, -0.85847214f, -0.85624312f, -0.85396482f, -0.85164544f,
-    -0.84929340f, -0.84691732f, -0.84452597f, -0.84212825f, -0.83973318f, -0.83734981f, -0.83498725f, -0.83265460f,
-    -0.83036093f, -0.82811524f, -0.82592643f, -0.82380325f, -0.82175431f, -0.81978799f, -0.81791244f, -0.81613556f,
-    -0.81446495f, -0.81290785f, -0.81147117f, -0.81016143f, -0.80898473f, -0.80794672f, -0.80705261f, -0.80630709f,
-    -0.80571436f, -0.80527807f, -0.80500135f, -0.80488673f, -0.80493619f, -0.80515110f, -0.80553221f, -0.80607970f,
-    -0.80679309f, -0.80767130f, -0.80871261f, -0.80991470f, -0.81127461f, -0.81278875f, -0.81445295f, -0.81626241f,
-    -0.81821176f, -0.82029505f, -0.82250577f, -0.82483686f, -0.82728076f, -0.82982939f, -0.83247421f, -0.83520622f,
-    -0.83801602f, -0.84089380f, -0.84382941f, -0.84681237f, -0.84983190f, -0.85287698f, -0.85593639f, -0.85899869f,
-    -0.86205235f, -0.86508572f, -0.86808709f, -0.87104475f, -0.87394703f, -0.87678230f, -0.87953909f, -0.88220604f,
-    -0.88477204f, -0.88722619f, -0.88955790f, -0.89175689f, -0.89381328f, -0.89571756f, -0.89746070f, -0.89903415f,
-    -0.90042989f, -0.90164044f, -0.90265895f, -0.90347915f, -0.90409548f, -0.90450301f, -0.90469756f, -0.90467566f,
-    -0.90443462f, -0.90397251f, -0.90328819f, -0.90238133f, -0.90125243f, -0.89990280f, -0.89833459f, -0.89655078f,
-    -0.89455519f, -0.89235249f, -0.88994815f, -0.88734848f, -0.88456059f, -0.88159237f, -0.87845252f, -0.87515046f,
-    -0.87169638f, -0.86810113f, -0.86437628f, -0.86053403f, -0.85658719f, -0.85254915f, -0.84843383f, -0.84425566f,
-    -0.84002950f, -0.83577063f, -0.83149469f, -0.82721762f, -0.82295562f, -0.81872508f, -0.81454255f, -0.81042469f,
-    -0.80638815f, -0.80244961f, -0.79862562f, -0.79493264f, -0.79138687f, -0.78800432f, -0.78480061f, -0.78179104f,
-    -0.77899043f, -0.77641313f, -0.77407291f, -0.77198296f, -0.77015576f, -0.76860311f, -0.76733600f, -0.76636461f,
-    -0.76569823f, -0.76534525f, -0.76531307f, -0.76560807f, -0.76623559f, -0.76719988f, -0.76850407f, -0.77015011f,
-    -0.77213878f, -0.77446964f, -0.77714103f, -0.78015002f, -0.78349243f, -0.78716277f, -0.79115430f, -0.79545896f,
-    -0.80006742f, -0.80496903f, -0.81015189f, -0.81560282f, -0.82130738f, -0.82724989f, -0.83341348f, -0.83978006f,
-    -0.84633042f, -0.85304421f, -0.85989998f, -0.86687528f, -0.87394663f, -0.88108962f, -0.88827893f, -0.89548840f,
-    -0.90269110f, -0.90985938f, -0.91696491f, -0.92397878f, -0.93087156f, -0.93761337f, -0.94417394f, -0.95052271f,
-    -0.95662887f, -0.96246149f, -0.96798954f, -0.97318202f, -0.97800802f, -0.98243679f, -0.98643786f, -0.98998106f,
-    -0.99303668f, -0.99557547f, -0.99756881f, -0.99898870f, -0.99980790f, -1.00000000f, -0.99953947f, -0.99840177f,
-    -0.99656338f, -0.99400192f, -0.99069618f, -0.98662621f, -0.98177337f, -0.97612038f, -0.96965142f, -0.96235214f,
-    -0.95420970f, -0.94521288f, -0.93535207f, -0.92461931f, -0.91300835f, -0.90051467f, -0.88713550f, -0.87286984f,
-    -0.85771851f, -0.84168410f, -0.82477104f, -0.80698557f, -0.78833576f, -0.76883149f, -0.74848442f, -0.72730802f,
-    -0.70531753f, -0.68252993f, -0.65896391f, -0.63463985f, -0.60957977f, -0.58380730f, -0.55734762f, -0.53022742f,
-    -0.50247484f, -0.47411943f, -0.44519205f, -0.41572485f, -0.38575117f, -0.35530548f, -0.32442330f, -0.29314112f,
-    -0.26149635f, -0.22952718f, -0.19727255f, -0.16477203f, -0.13206576f, -0.09919433f, -0.06619870f, -0.03312011f,
+alignas(4) const int16_t waveform_Square[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+         0,   2009,   4008,   5986,   7935,   9845,  11706,  13510,  15248,  16913,  18498,  19997,  21404,  22714,  23923,  25029,
+     26028,  26921,  27706,  28384,  28957,  29425,  29793,  30064,  30242,  30332,  30340,  30272,  30135,  29935,  29679,  29375,
+     29030,  28652,  28248,  27826,  27393,  26956,  26521,  26095,  25683,  25291,  24924,  24585,  24279,  24009,  23776,  23583,
+     23431,  23321,  23252,  23224,  23236,  23286,  23371,  23490,  23639,  23816,  24016,  24235,  24471,  24718,  24974,  25233,
+     25492,  25747,  25994,  26231,  26453,  26658,  26843,  27007,  27146,  27261,  27350,  27411,  27446,  27454,  27436,  27392,
+     27325,  27235,  27124,  26995,  26849,  26691,  26521,  26343,  26160,  25974,  25789,  25607,  25431,  25262,  25105,  24960,
+     24830,  24716,  24619,  24541,  24483,  24445,  24427,  24429,  24450,  24491,  24550,  24625,  24716,  24821,  24937,  25064,
+     25198,  25339,  25483,  25628,  25773,  25915,  26051,  26181,  26302,  26413,  26512,  26597,  26668,  26725,  26765,  26789,
+     26797,  26789,  26766,  26727,  26673,  26607,  26528,  26438,  26339,  26233,  26120,  26003,  25883,  25763,  25644,  25528,
+     25417,  25311,  25214,  25125,  25047,  24980,  24926,  24884,  24855,  24840,  24839,  24851,  24876,  24914,  24964,  25025,
+     25095,  25175,  25262,  25355,  25453,  25554,  25657,  25760,  25861,  25959,  26053,  26141,  26222,  26295,  26359,  26413,
+     26456,  26487,  26507,  26516,  26512,  26497,  26471,  26433,  26386,  26329,  26264,  26192,  26113,  26030,  25942,  25853,
+     25762,  25672,  25584,  25499,  25418,  25343,  25274,  25212,  25159,  25116,  25081,  25057,  25044,  25041,  25048,  25065,
+     25093,  25130,  25176,  25229,  25290,  25357,  25430,  25506,  25585,  25666,  25747,  25827,  25906,  25981,  26052,  26117,
+     26177,  26229,  26274,  26310,  26337,  26355,  26364,  26363,  26352,  26333,  26304,  26268,  26223,  26172,  26114,  26051,
+     25983,  25913,  25840,  25766,  25692,  25620,  25549,  25482,  25419,  25361,  25309,  25264,  25226,  25196,  25174,  25161,
+     25157,  25161,  25174,  25196,  25225,  25262,  25305,  25355,  25410,  25470,  25534,  25600,  25668,  25736,  25804,  25871,
+     25935,  25996,  26052,  26104,  26149,  26189,  26221,  26246,  26263,  26272,  26272,  26265,  26250,  26227,  26197,  26160,
+     26117,  26068,  26015,  25958,  25897,  25835,  25771,  25707,  25644,  25582,  25523,  25468,  25417,  25370,  25330,  25296,
+     25268,  25248,  25235,  25230,  25232,  25242,  25259,  25283,  25314,  25351,  25394,  25442,  25494,  25549,  25607,  25667,
+     25727,  25787,  25846,  25904,  25958,  26009,  26056,  26098,  26134,  26163,  26187,  26203,  26213,  26215,  26210,  26198,
+     26179,  26153,  26121,  26084,  26041,  25994,  25943,  25889,  25833,  25776,  25719,  25662,  25606,  25552,  25501,  25454,
+     25411,  25374,  25342,  25315,  25296,  25283,  25276,  25277,  25285,  25299,  25320,  25347,  25380,  25418,  25460,  25507,
+     25557,  25609,  25664,  25719,  25774,  25829,  25882,  25932,  25980,  26023,  26063,  26097,  26126,  26148,  26165,  26175,
+     26178,  26175,  26165,  26148,  26126,  26098,  26064,  26025,  25982,  25936,  25886,  25835,  25782,  25728,  25675,  25623,
+     25572,  25524,  25480,  25439,  25403,  25372,  25346,  25327,  25313,  25306,  25305,  25311,  25323,  25342,  25366,  25396,
+     25430,  25470,  25513,  25559,  25608,  25659,  25711,  25763,  25815,  25865,  25914,  25959,  26002,  26040,  26073,  26101,
+     26124,  26141,  26152,  26156,  26154,  26146,  26131,  26111,  26085,  26054,  26018,  25978,  25934,  25888,  25839,  25788,
+     25737,  25686,  25636,  25587,  25541,  25497,  25457,  25422,  25391,  25365,  25345,  25331,  25323,  25321,  25325,  25336,
+     25352,  25375,  25402,  25435,  25472,  25513,  25557,  25604,  25653,  25704,  25754,  25804,  25854,  25901,  25946,  25987,
+     26025,  26059,  26087,  26110,  26128,  26140,  26145,  26145,  26138,  26125,  26106,  26082,  26053,  26018,  25980,  25938,
+     25892,  25845,  25796,  25746,  25695,  25646,  25597,  25551,  25508,  25468,  25432,  25401,  25374,  25353,  25338,  25329,
+     25326,  25329,  25338,  25353,  25374,  25401,  25432,  25468,  25508,  25551,  25597,  25646,  25695,  25746,  25796,  25845,
+     25892,  25938,  25980,  26018,  26053,  26082,  26106,  26125,  26138,  26145,  26145,  26140,  26128,  26110,  26087,  26059,
+     26025,  25987,  25946,  25901,  25854,  25804,  25754,  25704,  25653,  25604,  25557,  25513,  25472,  25435,  25402,  25375,
+     25352,  25336,  25325,  25321,  25323,  25331,  25345,  25365,  25391,  25422,  25457,  25497,  25541,  25587,  25636,  25686,
+     25737,  25788,  25839,  25888,  25934,  25978,  26018,  26054,  26085,  26111,  26131,  26146,  26154,  26156,  26152,  26141,
+     26124,  26101,  26073,  26040,  26002,  25959,  25914,  25865,  25815,  25763,  25711,  25659,  25608,  25559,  25513,  25470,
+     25430,  25396,  25366,  25342,  25323,  25311,  25305,  25306,  25313,  25327,  25346,  25372,  25403,  25439,  25480,  25524,
+     25572,  25623,  25675,  25728,  25782,  25835,  25886,  25936,  25982,  26025,  26064,  26098,  26126,  26148,  26165,  26175,
+     26178,  26175,  26165,  26148,  26126,  26097,  26063,  26023,  25980,  25932,  25882,  25829,  25774,  25719,  25664,  25609,
+     25557,  25507,  25460,  25418,  25380,  25347,  25320,  25299,  25285,  25277,  25276,  25283,  25296,  25315,  25342,  25374,
+     25411,  25454,  25501,  25552,  25606,  25662,  25719,  25776,  25833,  25889,  25943,  25994,  26041,  26084,  26121,  26153,
+     26179,  26198,  26210,  26215,  26213,  26203,  26187,  26163,  26134,  26098,  26056,  26009,  25958,  25904,  25846,  25787,
+     25727,  25667,  25607,  25549,  25494,  25442,  25394,  25351,  25314,  25283,  25259,  25242,  25232,  25230,  25235,  25248,
+     25268,  25296,  25330,  25370,  25417,  25468,  25523,  25582,  25644,  25707,  25771,  25835,  25897,  25958,  26015,  26068,
+     26117,  26160,  26197,  26227,  26250,  26265,  26272,  26272,  26263,  26246,  26221,  26189,  26149,  26104,  26052,  25996,
+     25935,  25871,  25804,  25736,  25668,  25600,  25534,  25470,  25410,  25355,  25305,  25262,  25225,  25196,  25174,  25161,
+     25157,  25161,  25174,  25196,  25226,  25264,  25309,  25361,  25419,  25482,  25549,  25620,  25692,  25766,  25840,  25913,
+     25983,  26051,  26114,  26172,  26223,  26268,  26304,  26333,  26352,  26363,  26364,  26355,  26337,  26310,  26274,  26229,
+     26177,  26117,  26052,  25981,  25906,  25827,  25747,  25666,  25585,  25506,  25430,  25357,  25290,  25229,  25176,  25130,
+     25093,  25065,  25048,  25041,  25044,  25057,  25081,  25116,  25159,  25212,  25274,  25343,  25418,  25499,  25584,  25672,
+     25762,  25853,  25942,  26030,  26113,  26192,  26264,  26329,  26386,  26433,  26471,  26497,  26512,  26516,  26507,  26487,
+     26456,  26413,  26359,  26295,  26222,  26141,  26053,  25959,  25861,  25760,  25657,  25554,  25453,  25355,  25262,  25175,
+     25095,  25025,  24964,  24914,  24876,  24851,  24839,  24840,  24855,  24884,  24926,  24980,  25047,  25125,  25214,  25311,
+     25417,  25528,  25644,  25763,  25883,  26003,  26120,  26233,  26339,  26438,  26528,  26607,  26673,  26727,  26766,  26789,
+     26797,  26789,  26765,  26725,  26668,  26597,  26512,  26413,  26302,  26181,  26051,  25915,  25773,  25628,  25483,  25339,
+     25198,  25064,  24937,  24821,  24716,  24625,  24550,  24491,  24450,  24429,  24427,  24445,  24483,  24541,  24619,  24716,
+     24830,  24960,  25105,  25262,  25431,  25607,  25789,  25974,  26160,  26343,  26521,  26691,  26849,  26995,  27124,  27235,
+     27325,  27392,  27436,  27454,  27446,  27411,  27350,  27261,  27146,  27007,  26843,  26658,  26453,  26231,  25994,  25747,
+     25492,  25233,  24974,  24718,  24471,  24235,  24016,  23816,  23639,  23490,  23371,  23286,  23236,  23224,  23252,  23321,
+     23431,  23583,  23776,  24009,  24279,  24585,  24924,  25291,  25683,  26095,  26521,  26956,  27393,  27826,  28248,  28652,
+     29030,  29375,  29679,  29935,  30135,  30272,  30340,  30332,  30242,  30064,  29793,  29425,  28957,  28384,  27706,  26921,
+     26028,  25029,  23923,  22714,  21404,  19997,  18498,  16913,  15248,  13510,  11706,   9845,   7935,   5986,   4008,   2009,
+         0,  -2009,  -4008,  -5986,  -7935,  -9845, -11706, -13510, -15248, -16913, -18498, -19997, -21404, -22714, -23923, -25029,
+    -26028, -26921, -27706, -28384, -28957, -29425, -29793, -30064, -30242, -30332, -30340, -30272, -30135, -29935, -29679, -29375,
+    -29030, -28652, -28248, -27826, -27393, -26956, -26521, -26095, -25683, -25291, -24924, -24585, -24279, -24009, -23776, -23583,
+    -23431, -23321, -23252, -23224, -23236, -23286, -23371, -23490, -23639, -23816, -24016, -24235, -24471, -24718, -24974, -25233,
+    -25492, -25747, -25994, -26231, -26453, -26658, -26843, -27007, -27146, -27261, -27350, -27411, -27446, -27454, -27436, -27392,
+    -27325, -27235, -27124, -26995, -26849, -26691, -26521, -26343, -26160, -25974, -25789, -25607, -25431, -25262, -25105, -24960,
+    -24830, -24716, -24619, -24541, -24483, -24445, -24427, -24429, -24450, -24491, -24550, -24625, -24716, -24821, -24937, -25064,
+    -25198, -25339, -25483, -25628, -25773, -25915, -26051, -26181, -26302, -26413, -26512, -26597, -26668, -26725, -26765, -26789,
+    -26797, -26789, -26766, -26727, -26673, -26607, -26528, -26438, -26339, -26233, -26120, -26003, -25883, -25763, -25644, -25528,
+    -25417, -25311, -25214, -25125, -25047, -24980, -24926, -24884, -24855, -24840, -24839, -24851, -24876, -24914, -24964, -25025,
+    -25095, -25175, -25262, -25355, -25453, -25554, -25657, -25760, -25861, -25959, -26053, -26141, -26222, -26295, -26359, -26413,
+    -26456, -26487, -26507, -26516, -26512, -26497, -26471, -26433, -26386, -26329, -26264, -26192, -26113, -26030, -25942, -25853,
+    -25762, -25672, -25584, -25499, -25418, -25343, -25274, -25212, -25159, -25116, -25081, -25057, -25044, -25041, -25048, -25065,
+    -25093, -25130, -25176, -25229, -25290, -25357, -25430, -25506, -25585, -25666, -25747, -25827, -25906, -25981, -26052, -26117,
+    -26177, -26229, -26274, -26310, -26337, -26355, -26364, -26363, -26352, -26333, -26304, -26268, -26223, -26172, -26114, -26051,
+    -25983, -25913, -25840, -25766, -25692, -25620, -25549, -25482, -25419, -25361, -25309, -25264, -25226, -25196, -25174, -25161,
+    -25157, -25161, -25174, -25196, -25225, -25262, -25305, -25355, -25410, -25470, -25534, -25600, -25668, -25736, -25804, -25871,
+    -25935, -25996, -26052, -26104, -26149, -26189, -26221, -26246, -26263, -26272, -26272, -26265, -26250, -26227, -26197, -26160,
+    -26117, -26068, -26015, -25958, -25897, -25835, -25771, -25707, -25644, -25582, -25523, -25468, -25417, -25370, -25330, -25296,
+    -25268, -25248, -25235, -25230, -25232, -25242, -25259, -25283, -25314, -25351, -25394, -25442, -25494, -25549, -25607, -25667,
+    -25727, -25787, -25846, -25904, -25958, -26009, -26056, -26098, -26134, -26163, -26187, -26203, -26213, -26215, -26210, -26198,
+    -26179, -26153, -26121, -26084, -26041, -25994, -25943, -25889, -25833, -25776, -25719, -25662, -25606, -25552, -25501, -25454,
+    -25411, -25374, -25342, -25315, -25296, -25283, -25276, -25277, -25285, -25299, -25320, -25347, -25380, -25418, -25460, -25507,
+    -25557, -25609, -25664, -25719, -25774, -25829, -25882, -25932, -25980, -26023, -26063, -26097, -26126, -26148, -26165, -26175,
+    -26178, -26175, -26165, -26148, -26126, -26098, -26064, -26025, -25982, -25936, -25886, -25835, -25782, -25728, -25675, -25623,
+    -25572, -25524, -25480, -25439, -25403, -25372, -25346, -25327, -25313, -25306, -25305, -25311, -25323, -25342, -25366, -25396,
+    -25430, -25470, -25513, -25559, -25608, -25659, -25711, -25763, -25815, -25865, -25914, -25959, -26002, -26040, -26073, -26101,
+    -26124, -26141, -26152, -26156, -26154, -26146, -26131, -26111, -26085, -26054, -26018, -25978, -25934, -25888, -25839, -25788,
+    -25737, -25686, -25636, -25587, -25541, -25497, -25457, -25422, -25391, -25365, -25345, -25331, -25323, -25321, -25325, -25336,
+    -25352, -25375, -25402, -25435, -25472, -25513, -25557, -25604, -25653, -25704, -25754, -25804, -25854, -25901, -25946, -25987,
+    -26025, -26059, -26087, -26110, -26128, -26140, -26145, -26145, -26138, -26125, -26106, -26082, -26053, -26018, -25980, -25938,
+    -25892, -25845, -25796, -25746, -25695, -25646, -25597, -25551, -25508, -25468, -25432, -25401, -25374, -25353, -25338, -25329,
+    -25326, -25329, -25338, -25353, -25374, -25401, -25432, -25468, -25508, -25551, -25597, -25646, -25695, -25746, -25796, -25845,
+    -25892, -25938, -25980, -26018, -26053, -26082, -26106, -26125, -26138, -26145, -26145, -26140, -26128, -26110, -26087, -26059,
+    -26025, -25987, -25946, -25901, -25854, -25804, -25754, -25704, -25653, -25604, -25557, -25513, -25472, -25435, -25402, -25375,
+    -25352, -25336, -25325, -25321, -25323, -25331, -25345, -25365, -25391, -25422, -25457, -25497, -25541, -25587, -25636, -25686,
+    -25737, -25788, -25839, -25888, -25934, -25978, -26018, -26054, -26085, -26111, -26131, -26146, -26154, -26156, -26152, -26141,
+    -26124, -26101, -26073, -26040, -26002, -25959, -25914, -25865, -25815, -25763, -25711, -25659, -25608, -25559, -25513, -25470,
+    -25430, -25396, -25366, -25342, -25323, -25311, -25305, -25306, -25313, -25327, -25346, -25372, -25403, -25439, -25480, -25524,
+    -25572, -25623, -25675, -25728, -25782, -25835, -25886, -25936, -25982, -26025, -26064, -26098, -26126, -26148, -26165, -26175,
+    -26178, -26175, -26165, -26148, -26126, -26097, -26063, -26023, -25980, -25932, -25882, -25829, -25774, -25719, -25664, -25609,
+    -25557, -25507, -25460, -25418, -25380, -25347, -25320, -25299, -25285, -25277, -25276, -25283, -25296, -25315, -25342, -25374,
+    -25411, -25454, -25501, -25552, -25606, -25662, -25719, -25776, -25833, -25889, -25943, -25994, -26041, -26084, -26121, -26153,
+    -26179, -26198, -26210, -26215, -26213, -26203, -26187, -26163, -26134, -26098, -26056, -26009, -25958, -25904, -25846, -25787,
+    -25727, -25667, -25607, -25549, -25494, -25442, -25394, -25351, -25314, -25283, -25259, -25242, -25232, -25230, -25235, -25248,
+    -25268, -25296, -25330, -25370, -25417, -25468, -25523, -25582, -25644, -25707, -25771, -25835, -25897, -25958, -26015, -26068,
+    -26117, -26160, -26197, -26227, -26250, -26265, -26272, -26272, -26263, -26246, -26221, -26189, -26149, -26104, -26052, -25996,
+    -25935, -25871, -25804, -25736, -25668, -25600, -25534, -25470, -25410, -25355, -25305, -25262, -25225, -25196, -25174, -25161,
+    -25157, -25161, -25174, -25196, -25226, -25264, -25309, -25361, -25419, -25482, -25549, -25620, -25692, -25766, -25840, -25913,
+    -25983, -26051, -26114, -26172, -26223, -26268, -26304, -26333, -26352, -26363, -26364, -26355, -26337, -26310, -26274, -26229,
+    -26177, -26117, -26052, -25981, -25906, -25827, -25747, -25666, -25585, -25506, -25430, -25357, -25290, -25229, -25176, -25130,
+    -25093, -25065, -25048, -25041, -25044, -25057, -25081, -25116, -25159, -25212, -25274, -25343, -25418, -25499, -25584, -25672,
+    -25762, -25853, -25942, -26030, -26113, -26192, -26264, -26329, -26386, -26433, -26471, -26497, -26512, -26516, -26507, -26487,
+    -26456, -26413, -26359, -26295, -26222, -26141, -26053, -25959, -25861, -25760, -25657, -25554, -25453, -25355, -25262, -25175,
+    -25095, -25025, -24964, -24914, -24876, -24851, -24839, -24840, -24855, -24884, -24926, -24980, -25047, -25125, -25214, -25311,
+    -25417, -25528, -25644, -25763, -25883, -26003, -26120, -26233, -26339, -26438, -26528, -26607, -26673, -26727, -26766, -26789,
+    -26797, -26789, -26765, -26725, -26668, -26597, -26512, -26413, -26302, -26181, -26051, -25915, -25773, -25628, -25483, -25339,
+    -25198, -25064, -24937, -24821, -24716, -24625, -24550, -24491, -24450, -24429, -24427, -24445, -24483, -24541, -24619, -24716,
+    -24830, -24960, -25105, -25262, -25431, -25607, -25789, -25974, -26160, -26343, -26521, -26691, -26849, -26995, -27124, -27235,
+    -27325, -27392, -27436, -27454, -27446, -27411, -27350, -27261, -27146, -27007, -26843, -26658, -26453, -26231, -25994, -25747,
+    -25492, -25233, -24974, -24718, -24471, -24235, -24016, -23816, -23639, -23490, -23371, -23286, -23236, -23224, -23252, -23321,
+    -23431, -23583, -23776, -24009, -24279, -24585, -24924, -25291, -25683, -26095, -26521, -26956, -27393, -27826, -28248, -28652,
+    -29030, -29375, -29679, -29935, -30135, -30272, -30340, -30332, -30242, -30064, -29793, -29425, -28957, -28384, -27706, -26921,
+    -26028, -25029, -23923, -22714, -21404, -19997, -18498, -16913, -15248, -13510, -11706,  -9845,  -7935,  -5986,  -4008,  -2009,
+    
+    // Level 1: 1024 samples, 511 harmonics
+         0,   4008,   7935,  11706,  15248,  18498,  21404,  23923,  26028,  27706,  28957,  29793,  30242,  30340,  30135,  29679,
+     29030,  28248,  27393,  26521,  25683,  24924,  24279,  23776,  23431,  23252,  23236,  23371,  23639,  24016,  24471,  24974,
+     25492,  25994,  26453,  26843,  27146,  27350,  27446,  27436,  27325,  27124,  26849,  26521,  26160,  25789,  25431,  25105,
+     24830,  24619,  24483,  24427,  24450,  24550,  24716,  24937,  25198,  25483,  25773,  26051,  26302,  26512,  26668,  26765,
+     26797,  26766,  26673,  26528,  26339,  26120,  25883,  25644,  25417,  25214,  25047,  24926,  24855,  24839,  24876,  24964,
+     25095,  25262,  25453,  25657,  25861,  26053,  26222,  26359,  26456,  26507,  26512,  26471,  26386,  26264,  26113,  25942,
+     25762,  25584,  25418,  25274,  25159,  25081,  25044,  25048,  25093,  25176,  25290,  25430,  25585,  25747,  25906,  26052,
+     26177,  26274,  26337,  26364,  26352,  26304,  26223,  26114,  25983,  25840,  25692,  25549,  25419,  25309,  25226,  25174,
+     25157,  25174,  25225,  25305,  25410,  25534,  25668,  25804,  25935,  26052,  26149,  26221,  26263,  26272,  26250,  26197,
+     26117,  26015,  25897,  25771,  25644,  25523,  25417,  25330,  25268,  25235,  25232,  25259,  25314,  25394,  25494,  25607,
+     25727,  25846,  25958,  26056,  26134,  26187,  26213,  26210,  26179,  26121,  26041,  25943,  25833,  25719,  25606,  25501,
+     25411,  25342,  25296,  25276,  25285,  25320,  25380,  25460,  25557,  25664,  25774,  25882,  25980,  26063,  26126,  26165,
+     26178,  26165,  26126,  26064,  25982,  25886,  25782,  25675,  25572,  25480,  25403,  25346,  25313,  25305,  25323,  25366,
+     25430,  25513,  25608,  25711,  25815,  25914,  26002,  26073,  26124,  26152,  26154,  26131,  26085,  26018,  25934,  25839,
+     25737,  25636,  25541,  25457,  25391,  25345,  25323,  25325,  25352,  25402,  25472,  25557,  25653,  25754,  25854,  25946,
+     26025,  26087,  26128,  26145,  26138,  26106,  26053,  25980,  25892,  25796,  25695,  25597,  25508,  25432,  25374,  25338,
+     25326,  25338,  25374,  25432,  25508,  25597,  25695,  25796,  25892,  25980,  26053,  26106,  26138,  26145,  26128,  26087,
+     26025,  25946,  25854,  25754,  25653,  25557,  25472,  25402,  25352,  25325,  25323,  25345,  25391,  25457,  25541,  25636,
+     25737,  25839,  25934,  26018,  26085,  26131,  26154,  26152,  26124,  26073,  26002,  25914,  25815,  25711,  25608,  25513,
+     25430,  25366,  25323,  25305,  25313,  25346,  25403,  25480,  25572,  25675,  25782,  25886,  25982,  26064,  26126,  26165,
+     26178,  26165,  26126,  26063,  25980,  25882,  25774,  25664,  25557,  25460,  25380,  25320,  25285,  25276,  25296,  25342,
+     25411,  25501,  25606,  25719,  25833,  25943,  26041,  26121,  26179,  26210,  26213,  26187,  26134,  26056,  25958,  25846,
+     25727,  25607,  25494,  25394,  25314,  25259,  25232,  25235,  25268,  25330,  25417,  25523,  25644,  25771,  25897,  26015,
+     26117,  26197,  26250,  26272,  26263,  26221,  26149,  26052,  25935,  25804,  25668,  25534,  25410,  25305,  25225,  25174,
+     25157,  25174,  25226,  25309,  25419,  25549,  25692,  25840,  25983,  26114,  26223,  26304,  26352,  26364,  26337,  26274,
+     26177,  26052,  25906,  25747,  25585,  25430,  25290,  25176,  25093,  25048,  25044,  25081,  25159,  25274,  25418,  25584,
+     25762,  25942,  26113,  26264,  26386,  26471,  26512,  26507,  26456,  26359,  26222,  26053,  25861,  25657,  25453,  25262,
+     25095,  24964,  24876,  24839,  24855,  24926,  25047,  25214,  25417,  25644,  25883,  26120,  26339,  26528,  26673,  26766,
+     26797,  26765,  26668,  26512,  26302,  26051,  25773,  25483,  25198,  24937,  24716,  24550,  24450,  24427,  24483,  24619,
+     24830,  25105,  25431,  25789,  26160,  26521,  26849,  27124,  27325,  27436,  27446,  27350,  27146,  26843,  26453,  25994,
+     25492,  24974,  24471,  24016,  23639,  23371,  23236,  23252,  23431,  23776,  24279,  24924,  25683,  26521,  27393,  28248,
+     29030,  29679,  30135,  30340,  30242,  29793,  28957,  27706,  26028,  23923,  21404,  18498,  15248,  11706,   7935,   4008,
+         0,  -4008,  -7935, -11706, -15248, -18498, -21404, -23923, -26028, -27706, -28957, -29793, -30242, -30340, -30135, -29679,
+    -29030, -28248, -27393, -26521, -25683, -24924, -24279, -23776, -23431, -23252, -23236, -23371, -23639, -24016, -24471, -24974,
+    -25492, -25994, -26453, -26843, -27146, -27350, -27446, -27436, -27325, -27124, -26849, -26521, -26160, -25789, -25431, -25105,
+    -24830, -24619, -24483, -24427, -24450, -24550, -24716, -24937, -25198, -25483, -25773, -26051, -26302, -26512, -26668, -26765,
+    -26797, -26766, -26673, -26528, -26339, -26120, -25883, -25644, -25417, -25214, -25047, -24926, -24855, -24839, -24876, -24964,
+    -25095, -25262, -25453, -25657, -25861, -26053, -26222, -26359, -26456, -26507, -26512, -26471, -26386, -26264, -26113, -25942,
+    -25762, -25584, -25418, -25274, -25159, -25081, -25044, -25048, -25093, -25176, -25290, -25430, -25585, -25747, -25906, -26052,
+    -26177, -26274, -26337, -26364, -26352, -26304, -26223, -26114, -25983, -25840, -25692, -25549, -25419, -25309, -25226, -25174,
+    -25157, -25174, -25225, -25305, -25410, -25534, -25668, -25804, -25935, -26052, -26149, -26221, -26263, -26272, -26250, -26197,
+    -26117, -26015, -25897, -25771, -25644, -25523, -25417, -25330, -25268, -25235, -25232, -25259, -25314, -25394, -25494, -25607,
+    -25727, -25846, -25958, -26056, -26134, -26187, -26213, -26210, -26179, -26121, -26041, -25943, -25833, -25719, -25606, -25501,
+    -25411, -25342, -25296, -25276, -25285, -25320, -25380, -25460, -25557, -25664, -25774, -25882, -25980, -26063, -26126, -26165,
+    -26178, -26165, -26126, -26064, -25982, -25886, -25782, -25675, -25572, -25480, -25403, -25346, -25313, -25305, -25323, -25366,
+    -25430, -25513, -25608, -25711, -25815, -25914, -26002, -26073, -26124, -26152, -26154, -26131, -26085, -26018, -25934, -25839,
+    -25737, -25636, -25541, -25457, -25391, -25345, -25323, -25325, -25352, -25402, -25472, -25557, -25653, -25754, -25854, -25946,
+    -26025, -26087, -26128, -26145, -26138, -26106, -26053, -25980, -25892, -25796, -25695, -25597, -25508, -25432, -25374, -25338,
+    -25326, -25338, -25374, -25432, -25508, -25597, -25695, -25796, -25892, -25980, -26053, -26106, -26138, -26145, -26128, -26087,
+    -26025, -25946, -25854, -25754, -25653, -25557, -25472, -25402, -25352, -25325, -25323, -25345, -25391, -25457, -25541, -25636,
+    -25737, -25839, -25934, -26018, -26085, -26131, -26154, -26152, -26124, -26073, -26002, -25914, -25815, -25711, -25608, -25513,
+    -25430, -25366, -25323, -25305, -25313, -25346, -25403, -25480, -25572, -25675, -25782, -25886, -25982, -26064, -26126, -26165,
+    -26178, -26165, -26126, -26063, -25980, -25882, -25774, -25664, -25557, -25460, -25380, -25320, -25285, -25276, -25296, -25342,
+    -25411, -25501, -25606, -25719, -25833, -25943, -26041, -26121, -26179, -26210, -26213, -26187, -26134, -26056, -25958, -25846,
+    -25727, -25607, -25494, -25394, -25314, -25259, -25232, -25235, -25268, -25330, -25417, -25523, -25644, -25771, -25897, -26015,
+    -26117, -26197, -26250, -26272, -26263, -26221, -26149, -26052, -25935, -25804, -25668, -25534, -25410, -25305, -25225, -25174,
+    -25157, -25174, -25226, -25309, -25419, -25549, -25692, -25840, -25983, -26114, -26223, -26304, -26352, -26364, -26337, -26274,
+    -26177, -26052, -25906, -25747, -25585, -25430, -25290, -25176, -25093, -25048, -25044, -25081, -25159, -25274, -25418, -25584,
+    -25762, -25942, -26113, -26264, -26386, -26471, -26512, -26507, -26456, -26359, -26222, -26053, -25861, -25657, -25453, -25262,
+    -25095, -24964, -24876, -24839, -24855, -24926, -25047, -25214, -25417, -25644, -25883, -26120, -26339, -26528, -26673, -26766,
+    -26797, -26765, -26668, -26512, -26302, -26051, -25773, -25483, -25198, -24937, -24716, -24550, -24450, -24427, -24483, -24619,
+    -24830, -25105, -25431, -25789, -26160, -26521, -26849, -27124, -27325, -27436, -27446, -27350, -27146, -26843, -26453, -25994,
+    -25492, -24974, -24471, -24016, -23639, -23371, -23236, -23252, -23431, -23776, -24279, -24924, -25683, -26521, -27393, -28248,
+    -29030, -29679, -30135, -30340, -30242, -29793, -28957, -27706, -26028, -23923, -21404, -18498, -15248, -11706,  -7935,  -4008,
+    
+    // Level 2: 512 samples, 255 harmonics
+         0,   7935,  15248,  21404,  26028,  28957,  30242,  30135,  29030,  27393,  25683,  24279,  23431,  23236,  23639,  24471,
+     25492,  26453,  27146,  27446,  27325,  26849,  26160,  25431,  24830,  24483,  24450,  24716,  25198,  25773,  26302,  26668,
+     26797,  26673,  26339,  25883,  25417,  25047,  24855,  24876,  25095,  25453,  25861,  26222,  26456,  26512,  26386,  26113,
+     25762,  25418,  25159,  25044,  25093,  25290,  25585,  25906,  26177,  26337,  26352,  26223,  25983,  25692,  25419,  25226,
+     25157,  25225,  25410,  25668,  25935,  26149,  26263,  26250,  26117,  25897,  25644,  25417,  25268,  25232,  25314,  25494,
+     25727,  25958,  26134,  26213,  26179,  26041,  25833,  25606,  25411,  25296,  25285,  25380,  25557,  25774,  25980,  26126,
+     26178,  26126,  25982,  25782,  25572,  25403,  25313,  25323,  25430,  25608,  25815,  26002,  26124,  26154,  26085,  25934,
+     25737,  25541,  25391,  25323,  25352,  25472,  25653,  25854,  26025,  26128,  26138,  26053,  25892,  25695,  25508,  25374,
+     25326,  25374,  25508,  25695,  25892,  26053,  26138,  26128,  26025,  25854,  25653,  25472,  25352,  25323,  25391,  25541,
+     25737,  25934,  26085,  26154,  26124,  26002,  25815,  25608,  25430,  25323,  25313,  25403,  25572,  25782,  25982,  26126,
+     26178,  26126,  25980,  25774,  25557,  25380,  25285,  25296,  25411,  25606,  25833,  26041,  26179,  26213,  26134,  25958,
+     25727,  25494,  25314,  25232,  25268,  25417,  25644,  25897,  26117,  26250,  26263,  26149,  25935,  25668,  25410,  25225,
+     25157,  25226,  25419,  25692,  25983,  26223,  26352,  26337,  26177,  25906,  25585,  25290,  25093,  25044,  25159,  25418,
+     25762,  26113,  26386,  26512,  26456,  26222,  25861,  25453,  25095,  24876,  24855,  25047,  25417,  25883,  26339,  26673,
+     26797,  26668,  26302,  25773,  25198,  24716,  24450,  24483,  24830,  25431,  26160,  26849,  27325,  27446,  27146,  26453,
+     25492,  24471,  23639,  23236,  23431,  24279,  25683,  27393,  29030,  30135,  30242,  28957,  26028,  21404,  15248,   7935,
+         0,  -7935, -15248, -21404, -26028, -28957, -30242, -30135, -29030, -27393, -25683, -24279, -23431, -23236, -23639, -24471,
+    -25492, -26453, -27146, -27446, -27325, -26849, -26160, -25431, -24830, -24483, -24450, -24716, -25198, -25773, -26302, -26668,
+    -26797, -26673, -26339, -25883, -25417, -25047, -24855, -24876, -25095, -25453, -25861, -26222, -26456, -26512, -26386, -26113,
+    -25762, -25418, -25159, -25044, -25093, -25290, -25585, -25906, -26177, -26337, -26352, -26223, -25983, -25692, -25419, -25226,
+    -25157, -25225, -25410, -25668, -25935, -26149, -26263, -26250, -26117, -25897, -25644, -25417, -25268, -25232, -25314, -25494,
+    -25727, -25958, -26134, -26213, -26179, -26041, -25833, -25606, -25411, -25296, -25285, -25380, -25557, -25774, -25980, -26126,
+    -26178, -26126, -25982, -25782, -25572, -25403, -25313, -25323, -25430, -25608, -25815, -26002, -26124, -26154, -26085, -25934,
+    -25737, -25541, -25391, -25323, -25352, -25472, -25653, -25854, -26025, -26128, -26138, -26053, -25892, -25695, -25508, -25374,
+    -25326, -25374, -25508, -25695, -25892, -26053, -26138, -26128, -26025, -25854, -25653, -25472, -25352, -25323, -25391, -25541,
+    -25737, -25934, -26085, -26154, -26124, -26002, -25815, -25608, -25430, -25323, -25313, -25403, -25572, -25782, -25982, -26126,
+    -26178, -26126, -25980, -25774, -25557, -25380, -25285, -25296, -25411, -25606, -25833, -26041, -26179, -26213, -26134, -25958,
+    -25727, -25494, -25314, -25232, -25268, -25417, -25644, -25897, -26117, -26250, -26263, -26149, -25935, -25668, -25410, -25225,
+    -25157, -25226, -25419, -25692, -25983, -26223, -26352, -26337, -26177, -25906, -25585, -25290, -25093, -25044, -25159, -25418,
+    -25762, -26113, -26386, -26512, -26456, -26222, -25861, -25453, -25095, -24876, -24855, -25047, -25417, -25883, -26339, -26673,
+    -26797, -26668, -26302, -25773, -25198, -24716, -24450, -24483, -24830, -25431, -26160, -26849, -27325, -27446, -27146, -26453,
+    -25492, -24471, -23639, -23236, -23431, -24279, -25683, -27393, -29030, -30135, -30242, -28957, -26028, -21404, -15248,  -7935,
+    
+    // Level 3: 256 samples, 127 harmonics
+         0,  15248,  26028,  30242,  29030,  25683,  23431,  23639,  25492,  27146,  27325,  26160,  24830,  24450,  25198,  26302,
+     26797,  26339,  25417,  24855,  25095,  25861,  26456,  26386,  25762,  25159,  25093,  25585,  26177,  26352,  25983,  25419,
+     25157,  25410,  25935,  26263,  26117,  25644,  25268,  25314,  25727,  26134,  26179,  25833,  25411,  25285,  25557,  25980,
+     26178,  25982,  25572,  25313,  25430,  25815,  26124,  26085,  25737,  25391,  25352,  25653,  26025,  26138,  25892,  25508,
+     25326,  25508,  25892,  26138,  26025,  25653,  25352,  25391,  25737,  26085,  26124,  25815,  25430,  25313,  25572,  25982,
+     26178,  25980,  25557,  25285,  25411,  25833,  26179,  26134,  25727,  25314,  25268,  25644,  26117,  26263,  25935,  25410,
+     25157,  25419,  25983,  26352,  26177,  25585,  25093,  25159,  25762,  26386,  26456,  25861,  25095,  24855,  25417,  26339,
+     26797,  26302,  25198,  24450,  24830,  26160,  27325,  27146,  25492,  23639,  23431,  25683,  29030,  30242,  26028,  15248,
+         0, -15248, -26028, -30242, -29030, -25683, -23431, -23639, -25492, -27146, -27325, -26160, -24830, -24450, -25198, -26302,
+    -26797, -26339, -25417, -24855, -25095, -25861, -26456, -26386, -25762, -25159, -25093, -25585, -26177, -26352, -25983, -25419,
+    -25157, -25410, -25935, -26263, -26117, -25644, -25268, -25314, -25727, -26134, -26179, -25833, -25411, -25285, -25557, -25980,
+    -26178, -25982, -25572, -25313, -25430, -25815, -26124, -26085, -25737, -25391, -25352, -25653, -26025, -26138, -25892, -25508,
+    -25326, -25508, -25892, -26138, -26025, -25653, -25352, -25391, -25737, -26085, -26124, -25815, -25430, -25313, -25572, -25982,
+    -26178, -25980, -25557, -25285, -25411, -25833, -26179, -26134, -25727, -25314, -25268, -25644, -26117, -26263, -25935, -25410,
+    -25157, -25419, -25983, -26352, -26177, -25585, -25093, -25159, -25762, -26386, -26456, -25861, -25095, -24855, -25417, -26339,
+    -26797, -26302, -25198, -24450, -24830, -26160, -27325, -27146, -25492, -23639, -23431, -25683, -29030, -30242, -26028, -15248,
+    
+    // Level 4: 128 samples, 63 harmonics
+         0,  26028,  29030,  23431,  25492,  27325,  24830,  25198,  26797,  25417,  25095,  26456,  25762,  25093,  26177,  25983,
+     25157,  25935,  26117,  25268,  25727,  26179,  25411,  25557,  26178,  25572,  25430,  26124,  25737,  25352,  26025,  25892,
+     25326,  25892,  26025,  25352,  25737,  26124,  25430,  25572,  26178,  25557,  25411,  26179,  25727,  25268,  26117,  25935,
+     25157,  25983,  26177,  25093,  25762,  26456,  25095,  25417,  26797,  25198,  24830,  27325,  25492,  23431,  29030,  26028,
+         0, -26028, -29030, -23431, -25492, -27325, -24830, -25198, -26797, -25417, -25095, -26456, -25762, -25093, -26177, -25983,
+    -25157, -25935, -26117, -25268, -25727, -26179, -25411, -25557, -26178, -25572, -25430, -26124, -25737, -25352, -26025, -25892,
+    -25326, -25892, -26025, -25352, -25737, -26124, -25430, -25572, -26178, -25557, -25411, -26179, -25727, -25268, -26117, -25935,
+    -25157, -25983, -26177, -25093, -25762, -26456, -25095, -25417, -26797, -25198, -24830, -27325, -25492, -23431, -29030, -26028,
+    
+    // Level 5: 64 samples, 31 harmonics
+         0,  30350,  23217,  27464,  24413,  26813,  24818,  26539,  25013,  26396,  25121,  26315,  25182,  26270,  25214,  26249,
+     25224,  26249,  25214,  26270,  25182,  26315,  25121,  26396,  25013,  26539,  24818,  26813,  24413,  27464,  23217,  30350,
+         0, -30350, -23217, -27464, -24413, -26813, -24818, -26539, -25013, -26396, -25121, -26315, -25182, -26270, -25214, -26249,
+    -25224, -26249, -25214, -26270, -25182, -26315, -25121, -26396, -25013, -26539, -24818, -26813, -24413, -27464, -23217, -30350,
+    
+    // Level 6: 64 samples, 16 harmonics
+         0,  22469,  30375,  26340,  23166,  25502,  27543,  25852,  24303,  25669,  26958,  25773,  24632,  25715,  26775,  25741,
+     24715,  25741,  26775,  25715,  24632,  25773,  26958,  25669,  24303,  25852,  27543,  25502,  23166,  26340,  30375,  22469,
+         0, -22469, -30375, -26340, -23166, -25502, -27543, -25852, -24303, -25669, -26958, -25773, -24632, -25715, -26775, -25741,
+    -24715, -25741, -26775, -25715, -24632, -25773, -26958, -25669, -24303, -25852, -27543, -25502, -23166, -26340, -30375, -22469,
+    
+    // Level 7: 64 samples, 8 harmonics
+         0,  12441,  22501,  28605,  30476,  29115,  26303,  23859,  22949,  23748,  25549,  27241,  27910,  27276,  25783,  24318,
+     23717,  24318,  25783,  27276,  27910,  27241,  25549,  23748,  22949,  23859,  26303,  29115,  30476,  28605,  22501,  12441,
+         0, -12441, -22501, -28605, -30476, -29115, -26303, -23859, -22949, -23748, -25549, -27241, -27910, -27276, -25783, -24318,
+    -23717, -24318, -25783, -27276, -27910, -27241, -25549, -23748, -22949, -23859, -26303, -29115, -30476, -28605, -22501, -12441,
+    
+    // Level 8: 64 samples, 4 harmonics
+         0,   6382,  12461,  17955,  22630,  26316,  28917,  30420,  30893,  30478,  29376,  27827,  26093,  24427,  23056,  22157,
+     21845,  22157,  23056,  24427,  26093,  27827,  29376,  30478,  30893,  30420,  28917,  26316,  22630,  17955,  12461,   6382,
+         0,  -6382, -12461, -17955, -22630, -26316, -28917, -30420, -30893, -30478, -29376, -27827, -26093, -24427, -23056, -22157,
+    -21845, -22157, -23056, -24427, -26093, -27827, -29376, -30478, -30893, -30420, -28917, -26316, -22630, -17955, -12461,  -6382,
+    
+    // Level 9: 64 samples, 2 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
+    
+    // Level 10: 64 samples, 1 harmonics
+         0,   3212,   6393,   9512,  12539,  15446,  18204,  20787,  23170,  25329,  27245,  28898,  30273,  31356,  32137,  32609,
+     32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,  20787,  18204,  15446,  12539,   9512,   6393,   3212,
+         0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273, -31356, -32137, -32609,
+    -32767, -32609, -32137, -31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,  -9512,  -6393,  -3212,
     
 };
 
-alignas(4) const float waveform_Rhodes[4096] = {
-    0.00000000f, 0.00373096f, 0.00746163f, 0.01119172f, 0.01492092f, 0.01864897f, 0.02237555f, 0.02610038f,
-    0.02982316f, 0.03354362f, 0.03726145f, 0.04097636f, 0.04468807f, 0.04839629f, 0.05210073f, 0.05580110f,
-    0.05949711f, 0.06318847f, 0.06687491f, 0.07055613f, 0.07423185f, 0.07790179f, 0.08156566f, 0.08522318f,
-    0.08887407f, 0.09251806f, 0.09615485f, 0.09978418f, 0.10340577f, 0.10701934f, 0.11062461f, 0.11422132f,
-    0.11780920f, 0.12138796f, 0.12495736f, 0.12851710f, 0.13206694f, 0.13560660f, 0.13913583f, 0.14265436f,
-    0.14616193f, 0.14965828f, 0.15314317f, 0.15661632f, 0.16007749f, 0.16352644f, 0.16696290f, 0.17038664f,
-    0.17379740f, 0.17719495f, 0.18057904f, 0.18394944f, 0.18730590f, 0.19064819f, 0.19397608f, 0.19728934f,
-    0.20058774f, 0.20387105f, 0.20713905f, 0.21039152f, 0.21362824f, 0.21684899f, 0.22005356f, 0.22324173f,
-    0.22641330f, 0.22956806f, 0.23270580f, 0.23582633f, 0.23892944f, 0.24201494f, 0.24508263f, 0.24813233f,
-    0.25116384f, 0.25417698f, 0.25717156f, 0.26014742f, 0.26310436f, 0.26604221f, 0.26896081f, 0.27185998f,
-    0.27473957f, 0.27759940f, 0.28043931f, 0.28325916f, 0.28605879f, 0.28883804f, 0.29159677f, 0.29433484f,
-    0.29705210f, 0.29974842f, 0.30242366f, 0.30507770f, 0.30771039f, 0.31032162f, 0.31291127f, 0.31547921f,
-    0.31802533f, 0.32054952f, 0.32305168f, 0.32553169f, 0.32798945f, 0.33042487f, 0.33283784f, 0.33522828f,
-    0.33759611f, 0.33994122f, 0.34226355f, 0.34456302f, 0.34683954f, 0.34909305f, 0.35132348f, 0.35353077f,
-    0.35571485f, 0.35787567f, 0.36001317f, 0.36212731f, 0.36421803f, 0.36628530f, 0.36832908f, 0.37034931f,
-    0.37234599f, 0.37431907f, 0.37626853f, 0.37819435f, 0.38009651f, 0.38197499f, 0.38382978f, 0.38566089f,
-    0.38746829f, 0.38925199f, 0.39101199f, 0.39274831f, 0.39446094f, 0.39614991f, 0.39781522f, 0.39945691f,
-    0.40107499f, 0.40266949f, 0.40424044f, 0.40578788f, 0.40731185f, 0.40881238f, 0.41028952f, 0.41174332f,
-    0.41317384f, 0.41458112f, 0.41596523f, 0.41732623f, 0.41866419f, 0.41997916f, 0.42127124f, 0.42254048f,
-    0.42378698f, 0.42501081f, 0.42621206f, 0.42739082f, 0.42854719f, 0.42968125f, 0.43079311f, 0.43188287f,
-    0.43295064f, 0.43399652f, 0.43502063f, 0.43602309f, 0.43700400f, 0.43796350f, 0.43890170f, 0.43981875f,
-    0.44071476f, 0.44158987f, 0.44244422f, 0.44327794f, 0.44409119f, 0.44488411f, 0.44565685f, 0.44640956f,
-    0.44714239f, 0.44785550f, 0.44854906f, 0.44922322f, 0.44987816f, 0.45051404f, 0.45113103f, 0.45172931f,
-    0.45230906f, 0.45287045f, 0.45341368f, 0.45393891f, 0.45444635f, 0.45493617f, 0.45540858f, 0.45586377f,
-    0.45630193f, 0.45672328f, 0.45712800f, 0.45751630f, 0.45788839f, 0.45824448f, 0.45858479f, 0.45890952f,
-    0.45921888f, 0.45951311f, 0.45979241f, 0.46005702f, 0.46030715f, 0.46054303f, 0.46076489f, 0.46097295f,
-    0.46116746f, 0.46134864f, 0.46151673f, 0.46167197f, 0.46181459f, 0.46194483f, 0.46206295f, 0.46216918f,
-    0.46226376f, 0.46234695f, 0.46241899f, 0.46248013f, 0.46253062f, 0.46257072f, 0.46260068f, 0.46262076f,
-    0.46263120f, 0.46263227f, 0.46262423f, 0.46260734f, 0.46258186f, 0.46254804f, 0.46250615f, 0.46245647f,
-    0.46239924f, 0.46233474f, 0.46226323f, 0.46218497f, 0.46210025f, 0.46200932f, 0.46191246f, 0.46180993f,
-    0.46170200f, 0.46158895f, 0.46147104f, 0.46134855f, 0.46122176f, 0.46109092f, 0.46095631f, 0.46081822f,
-    0.46067690f, 0.46053263f, 0.46038569f, 0.46023635f, 0.46008488f, 0.45993156f, 0.45977665f, 0.45962044f,
-    0.45946319f, 0.45930517f, 0.45914667f, 0.45898794f, 0.45882927f, 0.45867092f, 0.45851317f, 0.45835628f,
-    0.45820052f, 0.45804617f, 0.45789349f, 0.45774275f, 0.45759422f, 0.45744817f, 0.45730485f, 0.45716454f,
-    0.45702750f, 0.45689399f, 0.45676427f, 0.45663861f, 0.45651726f, 0.45640049f, 0.45628856f, 0.45618171f,
-    0.45608021f, 0.45598430f, 0.45589425f, 0.45581030f, 0.45573271f, 0.45566172f, 0.45559758f, 0.45554054f,
-    0.45549083f, 0.45544872f, 0.45541442f, 0.45538819f, 0.45537026f, 0.45536088f, 0.45536026f, 0.45536865f,
-    0.45538627f, 0.45541336f, 0.45545014f, 0.45549684f, 0.45555367f, 0.45562087f, 0.45569864f, 0.45578721f,
-    0.45588680f, 0.45599760f, 0.45611983f, 0.45625371f, 0.45639943f, 0.45655721f, 0.45672723f, 0.45690970f,
-    0.45710482f, 0.45731278f, 0.45753376f, 0.45776797f, 0.45801558f, 0.45827678f, 0.45855176f, 0.45884068f,
-    0.45914372f, 0.45946106f, 0.45979287f, 0.46013932f, 0.46050056f, 0.46087677f, 0.46126810f, 0.46167471f,
-    0.46209675f, 0.46253437f, 0.46298773f, 0.46345695f, 0.46394220f, 0.46444360f, 0.46496129f, 0.46549540f,
-    0.46604607f, 0.46661342f, 0.46719757f, 0.46779865f, 0.46841676f, 0.46905203f, 0.46970457f, 0.47037448f,
-    0.47106187f, 0.47176684f, 0.47248949f, 0.47322991f, 0.47398819f, 0.47476442f, 0.47555869f, 0.47637108f,
-    0.47720166f, 0.47805051f, 0.47891770f, 0.47980330f, 0.48070738f, 0.48162999f, 0.48257120f, 0.48353105f,
-    0.48450960f, 0.48550689f, 0.48652297f, 0.48755789f, 0.48861167f, 0.48968434f, 0.49077596f, 0.49188652f,
-    0.49301607f, 0.49416462f, 0.49533218f, 0.49651877f, 0.49772439f, 0.49894906f, 0.50019278f, 0.50145553f,
-    0.50273733f, 0.50403815f, 0.50535800f, 0.50669684f, 0.50805467f, 0.50943146f, 0.51082718f, 0.51224181f,
-    0.51367530f, 0.51512764f, 0.51659877f, 0.51808865f, 0.51959723f, 0.52112447f, 0.52267031f, 0.52423469f,
-    0.52581755f, 0.52741883f, 0.52903846f, 0.53067636f, 0.53233247f, 0.53400671f, 0.53569899f, 0.53740923f,
-    0.53913735f, 0.54088324f, 0.54264682f, 0.54442798f, 0.54622663f, 0.54804267f, 0.54987597f, 0.55172644f,
-    0.55359395f, 0.55547840f, 0.55737965f, 0.55929759f, 0.56123209f, 0.56318301f, 0.56515023f, 0.56713360f,
-    0.56913299f, 0.57114826f, 0.57317925f, 0.57522582f, 0.57728782f, 0.57936510f, 0.58145749f, 0.58356483f,
-    0.58568696f, 0.58782372f, 0.58997493f, 0.59214043f, 0.59432003f, 0.59651356f, 0.59872084f, 0.60094169f,
-    0.60317592f, 0.60542334f, 0.60768376f, 0.60995699f, 0.61224282f, 0.61454107f, 0.61685153f, 0.61917399f,
-    0.62150825f, 0.62385411f, 0.62621134f, 0.62857974f, 0.63095909f, 0.63334917f, 0.63574976f, 0.63816064f,
-    0.64058159f, 0.64301238f, 0.64545277f, 0.64790254f, 0.65036145f, 0.65282928f, 0.65530577f, 0.65779070f,
-    0.66028382f, 0.66278489f, 0.66529367f, 0.66780990f, 0.67033335f, 0.67286375f, 0.67540087f, 0.67794444f,
-    0.68049421f, 0.68304993f, 0.68561133f, 0.68817816f, 0.69075017f, 0.69332707f, 0.69590862f, 0.69849455f,
-    0.70108459f, 0.70367847f, 0.70627594f, 0.70887671f, 0.71148051f, 0.71408708f, 0.71669615f, 0.71930743f,
-    0.72192066f, 0.72453556f, 0.72715186f, 0.72976927f, 0.73238752f, 0.73500633f, 0.73762542f, 0.74024452f,
-    0.74286333f, 0.74548159f, 0.74809901f, 0.75071531f, 0.75333020f, 0.75594341f, 0.75855465f, 0.76116364f,
-    0.76377009f, 0.76637373f, 0.76897426f, 0.77157141f, 0.77416489f, 0.77675442f, 0.77933972f, 0.78192049f,
-    0.78449646f, 0.78706735f, 0.78963287f, 0.79219274f, 0.79474667f, 0.79729439f, 0.79983561f, 0.80237006f,
-    0.80489744f, 0.80741749f, 0.80992992f, 0.81243445f, 0.81493081f, 0.81741872f, 0.81989789f, 0.82236806f,
-    0.82482895f, 0.82728029f, 0.82972180f, 0.83215321f, 0.83457425f, 0.83698464f, 0.83938413f, 0.84177244f,
-    0.84414930f, 0.84651445f, 0.84886763f, 0.85120857f, 0.85353701f, 0.85585269f, 0.85815535f, 0.86044474f,
-    0.86272059f, 0.86498266f, 0.86723069f, 0.86946443f, 0.87168364f, 0.87388805f, 0.87607743f, 0.87825154f,
-    0.88041013f, 0.88255296f, 0.88467979f, 0.88679039f, 0.88888452f, 0.89096195f, 0.89302244f, 0.89506578f,
-    0.89709173f, 0.89910008f, 0.90109058f, 0.90306304f, 0.90501723f, 0.90695294f, 0.90886994f, 0.91076804f,
-    0.91264703f, 0.91450670f, 0.91634684f, 0.91816725f, 0.91996775f, 0.92174813f, 0.92350819f, 0.92524776f,
-    0.92696664f, 0.92866464f, 0.93034159f, 0.93199730f, 0.93363160f, 0.93524432f, 0.93683528f, 0.93840431f,
-    0.93995126f, 0.94147595f, 0.94297823f, 0.94445795f, 0.94591494f, 0.94734905f, 0.94876015f, 0.95014808f,
-    0.95151271f, 0.95285390f, 0.95417150f, 0.95546539f, 0.95673545f, 0.95798153f, 0.95920353f, 0.96040132f,
-    0.96157479f, 0.96272382f, 0.96384831f, 0.96494814f, 0.96602322f, 0.96707345f, 0.96809872f, 0.96909895f,
-    0.97007405f, 0.97102393f, 0.97194851f, 0.97284771f, 0.97372145f, 0.97456966f, 0.97539228f, 0.97618923f,
-    0.97696046f, 0.97770590f, 0.97842551f, 0.97911922f, 0.97978700f, 0.98042879f, 0.98104456f, 0.98163427f,
-    0.98219788f, 0.98273537f, 0.98324670f, 0.98373187f, 0.98419083f, 0.98462358f, 0.98503012f, 0.98541041f,
-    0.98576447f, 0.98609229f, 0.98639387f, 0.98666922f, 0.98691834f, 0.98714125f, 0.98733797f, 0.98750850f,
-    0.98765289f, 0.98777115f, 0.98786331f, 0.98792941f, 0.98796948f, 0.98798356f, 0.98797171f, 0.98793396f,
-    0.98787038f, 0.98778100f, 0.98766590f, 0.98752513f, 0.98735876f, 0.98716686f, 0.98694949f, 0.98670675f,
-    0.98643869f, 0.98614542f, 0.98582701f, 0.98548355f, 0.98511514f, 0.98472186f, 0.98430383f, 0.98386115f,
-    0.98339391f, 0.98290223f, 0.98238623f, 0.98184601f, 0.98128170f, 0.98069343f, 0.98008130f, 0.97944546f,
-    0.97878604f, 0.97810317f, 0.97739700f, 0.97666765f, 0.97591528f, 0.97514003f, 0.97434206f, 0.97352152f,
-    0.97267856f, 0.97181335f, 0.97092604f, 0.97001681f, 0.96908582f, 0.96813325f, 0.96715926f, 0.96616403f,
-    0.96514775f, 0.96411060f, 0.96305276f, 0.96197441f, 0.96087576f, 0.95975700f, 0.95861831f, 0.95745990f,
-    0.95628197f, 0.95508472f, 0.95386837f, 0.95263311f, 0.95137916f, 0.95010673f, 0.94881604f, 0.94750730f,
-    0.94618075f, 0.94483659f, 0.94347505f, 0.94209637f, 0.94070076f, 0.93928847f, 0.93785972f, 0.93641475f,
-    0.93495380f, 0.93347710f, 0.93198490f, 0.93047745f, 0.92895498f, 0.92741774f, 0.92586599f, 0.92429997f,
-    0.92271993f, 0.92112613f, 0.91951882f, 0.91789827f, 0.91626472f, 0.91461845f, 0.91295970f, 0.91128875f,
-    0.90960585f, 0.90791128f, 0.90620530f, 0.90448818f, 0.90276019f, 0.90102159f, 0.89927267f, 0.89751369f,
-    0.89574492f, 0.89396665f, 0.89217914f, 0.89038268f, 0.88857754f, 0.88676401f, 0.88494235f, 0.88311285f,
-    0.88127579f, 0.87943145f, 0.87758012f, 0.87572207f, 0.87385759f, 0.87198696f, 0.87011047f, 0.86822840f,
-    0.86634103f, 0.86444865f, 0.86255155f, 0.86065001f, 0.85874432f, 0.85683476f, 0.85492162f, 0.85300518f,
-    0.85108573f, 0.84916355f, 0.84723894f, 0.84531217f, 0.84338353f, 0.84145331f, 0.83952179f, 0.83758926f,
-    0.83565600f, 0.83372229f, 0.83178842f, 0.82985467f, 0.82792133f, 0.82598866f, 0.82405696f, 0.82212651f,
-    0.82019758f, 0.81827045f, 0.81634541f, 0.81442272f, 0.81250267f, 0.81058553f, 0.80867158f, 0.80676108f,
-    0.80485432f, 0.80295155f, 0.80105306f, 0.79915911f, 0.79726997f, 0.79538590f, 0.79350717f, 0.79163405f,
-    0.78976679f, 0.78790566f, 0.78605091f, 0.78420281f, 0.78236161f, 0.78052756f, 0.77870092f, 0.77688194f,
-    0.77507087f, 0.77326796f, 0.77147345f, 0.76968759f, 0.76791061f, 0.76614277f, 0.76438430f, 0.76263543f,
-    0.76089640f, 0.75916745f, 0.75744880f, 0.75574068f, 0.75404332f, 0.75235694f, 0.75068176f, 0.74901801f,
-    0.74736590f, 0.74572564f, 0.74409745f, 0.74248153f, 0.74087811f, 0.73928737f, 0.73770952f, 0.73614477f,
-    0.73459331f, 0.73305534f, 0.73153104f, 0.73002061f, 0.72852424f, 0.72704211f, 0.72557440f, 0.72412128f,
-    0.72268295f, 0.72125956f, 0.71985130f, 0.71845832f, 0.71708079f, 0.71571888f, 0.71437274f, 0.71304253f,
-    0.71172840f, 0.71043051f, 0.70914899f, 0.70788399f, 0.70663566f, 0.70540413f, 0.70418953f, 0.70299200f,
-    0.70181166f, 0.70064865f, 0.69950307f, 0.69837506f, 0.69726471f, 0.69617216f, 0.69509750f, 0.69404085f,
-    0.69300229f, 0.69198195f, 0.69097989f, 0.68999623f, 0.68903105f, 0.68808443f, 0.68715646f, 0.68624722f,
-    0.68535677f, 0.68448520f, 0.68363257f, 0.68279895f, 0.68198439f, 0.68118896f, 0.68041271f, 0.67965569f,
-    0.67891794f, 0.67819953f, 0.67750047f, 0.67682082f, 0.67616060f, 0.67551984f, 0.67489858f, 0.67429683f,
-    0.67371462f, 0.67315195f, 0.67260885f, 0.67208532f, 0.67158137f, 0.67109699f, 0.67063220f, 0.67018697f,
-    0.66976131f, 0.66935520f, 0.66896863f, 0.66860158f, 0.66825402f, 0.66792592f, 0.66761727f, 0.66732802f,
-    0.66705814f, 0.66680758f, 0.66657632f, 0.66636429f, 0.66617145f, 0.66599774f, 0.66584310f, 0.66570749f,
-    0.66559082f, 0.66549304f, 0.66541407f, 0.66535383f, 0.66531226f, 0.66528927f, 0.66528477f, 0.66529867f,
-    0.66533089f, 0.66538134f, 0.66544990f, 0.66553649f, 0.66564100f, 0.66576332f, 0.66590334f, 0.66606094f,
-    0.66623602f, 0.66642844f, 0.66663809f, 0.66686483f, 0.66710855f, 0.66736911f, 0.66764636f, 0.66794018f,
-    0.66825042f, 0.66857694f, 0.66891959f, 0.66927821f, 0.66965266f, 0.67004278f, 0.67044841f, 0.67086938f,
-    0.67130554f, 0.67175672f, 0.67222274f, 0.67270343f, 0.67319861f, 0.67370812f, 0.67423176f, 0.67476935f,
-    0.67532071f, 0.67588565f, 0.67646398f, 0.67705550f, 0.67766002f, 0.67827733f, 0.67890724f, 0.67954955f,
-    0.68020404f, 0.68087052f, 0.68154876f, 0.68223857f, 0.68293971f, 0.68365198f, 0.68437517f, 0.68510903f,
-    0.68585336f, 0.68660793f, 0.68737252f, 0.68814688f, 0.68893080f, 0.68972404f, 0.69052636f, 0.69133754f,
-    0.69215732f, 0.69298548f, 0.69382177f, 0.69466594f, 0.69551776f, 0.69637697f, 0.69724334f, 0.69811661f,
-    0.69899652f, 0.69988284f, 0.70077530f, 0.70167365f, 0.70257764f, 0.70348700f, 0.70440149f, 0.70532083f,
-    0.70624478f, 0.70717307f, 0.70810544f, 0.70904162f, 0.70998135f, 0.71092436f, 0.71187039f, 0.71281918f,
-    0.71377045f, 0.71472394f, 0.71567938f, 0.71663649f, 0.71759501f, 0.71855467f, 0.71951520f, 0.72047632f,
-    0.72143777f, 0.72239927f, 0.72336055f, 0.72432133f, 0.72528135f, 0.72624033f, 0.72719800f, 0.72815407f,
-    0.72910829f, 0.73006038f, 0.73101006f, 0.73195706f, 0.73290111f, 0.73384193f, 0.73477926f, 0.73571281f,
-    0.73664232f, 0.73756752f, 0.73848813f, 0.73940388f, 0.74031451f, 0.74121974f, 0.74211930f, 0.74301293f,
-    0.74390035f, 0.74478131f, 0.74565553f, 0.74652274f, 0.74738269f, 0.74823511f, 0.74907973f, 0.74991630f,
-    0.75074454f, 0.75156422f, 0.75237505f, 0.75317679f, 0.75396918f, 0.75475196f, 0.75552488f, 0.75628769f,
-    0.75704014f, 0.75778197f, 0.75851293f, 0.75923279f, 0.75994129f, 0.76063818f, 0.76132324f, 0.76199621f,
-    0.76265686f, 0.76330495f, 0.76394024f, 0.76456250f, 0.76517150f, 0.76576700f, 0.76634879f, 0.76691662f,
-    0.76747029f, 0.76800956f, 0.76853421f, 0.76904403f, 0.76953880f, 0.77001831f, 0.77048234f, 0.77093069f,
-    0.77136314f, 0.77177950f, 0.77217956f, 0.77256311f, 0.77292997f, 0.77327993f, 0.77361280f, 0.77392840f,
-    0.77422652f, 0.77450700f, 0.77476964f, 0.77501427f, 0.77524070f, 0.77544876f, 0.77563829f, 0.77580910f,
-    0.77596104f, 0.77609393f, 0.77620763f, 0.77630196f, 0.77637677f, 0.77643192f, 0.77646725f, 0.77648261f,
-    0.77647786f, 0.77645286f, 0.77640747f, 0.77634156f, 0.77625500f, 0.77614765f, 0.77601939f, 0.77587010f,
-    0.77569965f, 0.77550795f, 0.77529486f, 0.77506028f, 0.77480410f, 0.77452623f, 0.77422655f, 0.77390498f,
-    0.77356142f, 0.77319578f, 0.77280797f, 0.77239791f, 0.77196552f, 0.77151072f, 0.77103344f, 0.77053361f,
-    0.77001117f, 0.76946604f, 0.76889817f, 0.76830750f, 0.76769399f, 0.76705757f, 0.76639821f, 0.76571587f,
-    0.76501049f, 0.76428206f, 0.76353053f, 0.76275587f, 0.76195807f, 0.76113710f, 0.76029295f, 0.75942559f,
-    0.75853502f, 0.75762123f, 0.75668421f, 0.75572398f, 0.75474052f, 0.75373384f, 0.75270397f, 0.75165090f,
-    0.75057466f, 0.74947527f, 0.74835275f, 0.74720713f, 0.74603845f, 0.74484673f, 0.74363202f, 0.74239435f,
-    0.74113378f, 0.73985035f, 0.73854411f, 0.73721513f, 0.73586346f, 0.73448916f, 0.73309230f, 0.73167295f,
-    0.73023118f, 0.72876707f, 0.72728070f, 0.72577216f, 0.72424152f, 0.72268889f, 0.72111435f, 0.71951800f,
-    0.71789995f, 0.71626029f, 0.71459913f, 0.71291659f, 0.71121278f, 0.70948781f, 0.70774180f, 0.70597488f,
-    0.70418718f, 0.70237882f, 0.70054993f, 0.69870067f, 0.69683115f, 0.69494153f, 0.69303195f, 0.69110256f,
-    0.68915351f, 0.68718495f, 0.68519705f, 0.68318996f, 0.68116386f, 0.67911889f, 0.67705524f, 0.67497307f,
-    0.67287257f, 0.67075390f, 0.66861725f, 0.66646281f, 0.66429076f, 0.66210128f, 0.65989458f, 0.65767084f,
-    0.65543026f, 0.65317304f, 0.65089939f, 0.64860950f, 0.64630359f, 0.64398187f, 0.64164454f, 0.63929182f,
-    0.63692394f, 0.63454110f, 0.63214353f, 0.62973145f, 0.62730509f, 0.62486468f, 0.62241045f, 0.61994262f,
-    0.61746145f, 0.61496715f, 0.61245998f, 0.60994017f, 0.60740796f, 0.60486360f, 0.60230734f, 0.59973942f,
-    0.59716009f, 0.59456961f, 0.59196823f, 0.58935621f, 0.58673379f, 0.58410125f, 0.58145884f, 0.57880682f,
-    0.57614546f, 0.57347502f, 0.57079576f, 0.56810796f, 0.56541188f, 0.56270780f, 0.55999598f, 0.55727669f,
-    0.55455022f, 0.55181683f, 0.54907680f, 0.54633041f, 0.54357794f, 0.54081966f, 0.53805585f, 0.53528680f,
-    0.53251278f, 0.52973409f, 0.52695099f, 0.52416378f, 0.52137274f, 0.51857815f, 0.51578031f, 0.51297948f,
-    0.51017597f, 0.50737006f, 0.50456203f, 0.50175218f, 0.49894079f, 0.49612814f, 0.49331453f, 0.49050025f,
-    0.48768558f, 0.48487082f, 0.48205625f, 0.47924215f, 0.47642883f, 0.47361656f, 0.47080563f, 0.46799634f,
-    0.46518897f, 0.46238381f, 0.45958114f, 0.45678126f, 0.45398444f, 0.45119098f, 0.44840116f, 0.44561526f,
-    0.44283358f, 0.44005638f, 0.43728396f, 0.43451660f, 0.43175458f, 0.42899817f, 0.42624767f, 0.42350334f,
-    0.42076547f, 0.41803434f, 0.41531021f, 0.41259336f, 0.40988408f, 0.40718262f, 0.40448926f, 0.40180428f,
-    0.39912793f, 0.39646049f, 0.39380223f, 0.39115340f, 0.38851428f, 0.38588512f, 0.38326618f, 0.38065772f,
-    0.37806000f, 0.37547328f, 0.37289780f, 0.37033382f, 0.36778159f, 0.36524136f, 0.36271338f, 0.36019788f,
-    0.35769512f, 0.35520533f, 0.35272875f, 0.35026562f, 0.34781617f, 0.34538064f, 0.34295926f, 0.34055224f,
-    0.33815983f, 0.33578224f, 0.33341970f, 0.33107242f, 0.32874062f, 0.32642452f, 0.32412433f, 0.32184025f,
-    0.31957250f, 0.31732128f, 0.31508678f, 0.31286922f, 0.31066879f, 0.30848567f, 0.30632007f, 0.30417218f,
-    0.30204217f, 0.29993023f, 0.29783654f, 0.29576128f, 0.29370463f, 0.29166676f, 0.28964783f, 0.28764801f,
-    0.28566747f, 0.28370637f, 0.28176486f, 0.27984310f, 0.27794123f, 0.27605942f, 0.27419779f, 0.27235651f,
-    0.27053569f, 0.26873549f, 0.26695603f, 0.26519744f, 0.26345985f, 0.26174338f, 0.26004815f, 0.25837428f,
-    0.25672188f, 0.25509106f, 0.25348193f, 0.25189459f, 0.25032914f, 0.24878567f, 0.24726429f, 0.24576508f,
-    0.24428813f, 0.24283351f, 0.24140132f, 0.23999162f, 0.23860449f, 0.23724000f, 0.23589821f, 0.23457919f,
-    0.23328299f, 0.23200967f, 0.23075928f, 0.22953188f, 0.22832750f, 0.22714618f, 0.22598797f, 0.22485290f,
-    0.22374100f, 0.22265229f, 0.22158680f, 0.22054455f, 0.21952556f, 0.21852983f, 0.21755739f, 0.21660823f,
-    0.21568235f, 0.21477976f, 0.21390045f, 0.21304441f, 0.21221163f, 0.21140209f, 0.21061578f, 0.20985267f,
-    0.20911273f, 0.20839594f, 0.20770227f, 0.20703167f, 0.20638411f, 0.20575953f, 0.20515791f, 0.20457917f,
-    0.20402328f, 0.20349017f, 0.20297978f, 0.20249204f, 0.20202689f, 0.20158426f, 0.20116407f, 0.20076624f,
-    0.20039070f, 0.20003735f, 0.19970610f, 0.19939687f, 0.19910957f, 0.19884408f, 0.19860031f, 0.19837816f,
-    0.19817752f, 0.19799827f, 0.19784030f, 0.19770349f, 0.19758772f, 0.19749286f, 0.19741880f, 0.19736539f,
-    0.19733251f, 0.19732001f, 0.19732776f, 0.19735561f, 0.19740342f, 0.19747104f, 0.19755831f, 0.19766509f,
-    0.19779121f, 0.19793651f, 0.19810082f, 0.19828400f, 0.19848585f, 0.19870621f, 0.19894491f, 0.19920176f,
-    0.19947660f, 0.19976922f, 0.20007946f, 0.20040711f, 0.20075200f, 0.20111392f, 0.20149267f, 0.20188807f,
-    0.20229991f, 0.20272799f, 0.20317209f, 0.20363202f, 0.20410756f, 0.20459850f, 0.20510462f, 0.20562571f,
-    0.20616155f, 0.20671191f, 0.20727657f, 0.20785531f, 0.20844790f, 0.20905410f, 0.20967370f, 0.21030644f,
-    0.21095210f, 0.21161044f, 0.21228121f, 0.21296419f, 0.21365912f, 0.21436576f, 0.21508386f, 0.21581318f,
-    0.21655347f, 0.21730447f, 0.21806594f, 0.21883761f, 0.21961924f, 0.22041056f, 0.22121132f, 0.22202126f,
-    0.22284011f, 0.22366762f, 0.22450352f, 0.22534755f, 0.22619944f, 0.22705893f, 0.22792574f, 0.22879962f,
-    0.22968028f, 0.23056746f, 0.23146089f, 0.23236030f, 0.23326541f, 0.23417595f, 0.23509165f, 0.23601222f,
-    0.23693741f, 0.23786692f, 0.23880049f, 0.23973783f, 0.24067868f, 0.24162274f, 0.24256975f, 0.24351943f,
-    0.24447150f, 0.24542567f, 0.24638167f, 0.24733923f, 0.24829806f, 0.24925788f, 0.25021842f, 0.25117940f,
-    0.25214054f, 0.25310155f, 0.25406217f, 0.25502211f, 0.25598110f, 0.25693885f, 0.25789510f, 0.25884957f,
-    0.25980197f, 0.26075204f, 0.26169950f, 0.26264408f, 0.26358550f, 0.26452349f, 0.26545778f, 0.26638809f,
-    0.26731416f, 0.26823571f, 0.26915248f, 0.27006421f, 0.27097061f, 0.27187144f, 0.27276642f, 0.27365529f,
-    0.27453778f, 0.27541365f, 0.27628262f, 0.27714443f, 0.27799885f, 0.27884559f, 0.27968442f, 0.28051508f,
-    0.28133732f, 0.28215088f, 0.28295552f, 0.28375100f, 0.28453707f, 0.28531348f, 0.28607999f, 0.28683637f,
-    0.28758238f, 0.28831777f, 0.28904233f, 0.28975580f, 0.29045798f, 0.29114861f, 0.29182749f, 0.29249438f,
-    0.29314907f, 0.29379133f, 0.29442094f, 0.29503770f, 0.29564139f, 0.29623179f, 0.29680870f, 0.29737191f,
-    0.29792123f, 0.29845643f, 0.29897734f, 0.29948375f, 0.29997547f, 0.30045230f, 0.30091406f, 0.30136056f,
-    0.30179162f, 0.30220706f, 0.30260669f, 0.30299035f, 0.30335786f, 0.30370905f, 0.30404375f, 0.30436180f,
-    0.30466304f, 0.30494731f, 0.30521445f, 0.30546431f, 0.30569674f, 0.30591159f, 0.30610873f, 0.30628800f,
-    0.30644928f, 0.30659242f, 0.30671729f, 0.30682378f, 0.30691174f, 0.30698106f, 0.30703163f, 0.30706331f,
-    0.30707601f, 0.30706961f, 0.30704401f, 0.30699910f, 0.30693478f, 0.30685096f, 0.30674754f, 0.30662444f,
-    0.30648156f, 0.30631883f, 0.30613617f, 0.30593349f, 0.30571074f, 0.30546782f, 0.30520469f, 0.30492128f,
-    0.30461752f, 0.30429337f, 0.30394877f, 0.30358367f, 0.30319803f, 0.30279181f, 0.30236496f, 0.30191745f,
-    0.30144925f, 0.30096033f, 0.30045067f, 0.29992025f, 0.29936904f, 0.29879705f, 0.29820424f, 0.29759063f,
-    0.29695620f, 0.29630095f, 0.29562490f, 0.29492804f, 0.29421038f, 0.29347195f, 0.29271275f, 0.29193282f,
-    0.29113217f, 0.29031083f, 0.28946884f, 0.28860622f, 0.28772303f, 0.28681930f, 0.28589507f, 0.28495040f,
-    0.28398533f, 0.28299993f, 0.28199426f, 0.28096837f, 0.27992233f, 0.27885622f, 0.27777010f, 0.27666406f,
-    0.27553817f, 0.27439252f, 0.27322718f, 0.27204226f, 0.27083785f, 0.26961404f, 0.26837093f, 0.26710863f,
-    0.26582723f, 0.26452687f, 0.26320763f, 0.26186965f, 0.26051303f, 0.25913791f, 0.25774441f, 0.25633266f,
-    0.25490278f, 0.25345492f, 0.25198921f, 0.25050579f, 0.24900481f, 0.24748641f, 0.24595075f, 0.24439798f,
-    0.24282825f, 0.24124172f, 0.23963856f, 0.23801892f, 0.23638298f, 0.23473091f, 0.23306288f, 0.23137906f,
-    0.22967963f, 0.22796478f, 0.22623469f, 0.22448954f, 0.22272953f, 0.22095484f, 0.21916568f, 0.21736222f,
-    0.21554469f, 0.21371327f, 0.21186817f, 0.21000960f, 0.20813777f, 0.20625288f, 0.20435516f, 0.20244481f,
-    0.20052205f, 0.19858711f, 0.19664021f, 0.19468156f, 0.19271140f, 0.19072996f, 0.18873746f, 0.18673414f,
-    0.18472023f, 0.18269597f, 0.18066160f, 0.17861735f, 0.17656347f, 0.17450020f, 0.17242778f, 0.17034647f,
-    0.16825651f, 0.16615814f, 0.16405163f, 0.16193723f, 0.15981518f, 0.15768575f, 0.15554919f, 0.15340576f,
-    0.15125572f, 0.14909933f, 0.14693686f, 0.14476856f, 0.14259471f, 0.14041556f, 0.13823138f, 0.13604245f,
-    0.13384903f, 0.13165139f, 0.12944979f, 0.12724452f, 0.12503585f, 0.12282404f, 0.12060936f, 0.11839211f,
-    0.11617254f, 0.11395094f, 0.11172758f, 0.10950273f, 0.10727668f, 0.10504970f, 0.10282206f, 0.10059406f,
-    0.09836595f, 0.09613803f, 0.09391057f, 0.09168385f, 0.08945815f, 0.08723375f, 0.08501092f, 0.08278995f,
-    0.08057111f, 0.07835468f, 0.07614094f, 0.07393017f, 0.07172265f, 0.06951865f, 0.06731845f, 0.06512233f,
-    0.06293056f, 0.06074342f, 0.05856118f, 0.05638413f, 0.05421253f, 0.05204665f, 0.04988677f, 0.04773317f,
-    0.04558610f, 0.04344585f, 0.04131268f, 0.03918687f, 0.03706867f, 0.03495835f, 0.03285618f, 0.03076243f,
-    0.02867735f, 0.02660122f, 0.02453428f, 0.02247680f, 0.02042904f, 0.01839125f, 0.01636370f, 0.01434662f,
-    0.01234029f, 0.01034494f, 0.00836082f, 0.00638819f, 0.00442730f, 0.00247837f, 0.00054167f, -0.00138258f,
-    -0.00329413f, -0.00519274f, -0.00707818f, -0.00895021f, -0.01080861f, -0.01265314f, -0.01448358f, -0.01629969f,
-    -0.01810127f, -0.01988807f, -0.02165990f, -0.02341652f, -0.02515772f, -0.02688329f, -0.02859303f, -0.03028671f,
-    -0.03196415f, -0.03362512f, -0.03526944f, -0.03689691f, -0.03850732f, -0.04010048f, -0.04167621f, -0.04323432f,
-    -0.04477462f, -0.04629692f, -0.04780105f, -0.04928683f, -0.05075409f, -0.05220264f, -0.05363233f, -0.05504299f,
-    -0.05643445f, -0.05780656f, -0.05915915f, -0.06049207f, -0.06180516f, -0.06309829f, -0.06437130f, -0.06562405f,
-    -0.06685640f, -0.06806821f, -0.06925936f, -0.07042970f, -0.07157911f, -0.07270747f, -0.07381466f, -0.07490056f,
-    -0.07596505f, -0.07700802f, -0.07802936f, -0.07902897f, -0.08000675f, -0.08096260f, -0.08189642f, -0.08280812f,
-    -0.08369762f, -0.08456482f, -0.08540965f, -0.08623203f, -0.08703188f, -0.08780913f, -0.08856371f, -0.08929557f,
-    -0.09000463f, -0.09069084f, -0.09135415f, -0.09199450f, -0.09261185f, -0.09320616f, -0.09377738f, -0.09432547f,
-    -0.09485041f, -0.09535217f, -0.09583071f, -0.09628602f, -0.09671807f, -0.09712685f, -0.09751236f, -0.09787457f,
-    -0.09821349f, -0.09852911f, -0.09882143f, -0.09909047f, -0.09933623f, -0.09955873f, -0.09975797f, -0.09993399f,
-    -0.10008680f, -0.10021642f, -0.10032290f, -0.10040627f, -0.10046656f, -0.10050381f, -0.10051807f, -0.10050939f,
-    -0.10047781f, -0.10042340f, -0.10034622f, -0.10024631f, -0.10012376f, -0.09997863f, -0.09981098f, -0.09962091f,
-    -0.09940848f, -0.09917378f, -0.09891690f, -0.09863793f, -0.09833695f, -0.09801407f, -0.09766938f, -0.09730299f,
-    -0.09691501f, -0.09650554f, -0.09607469f, -0.09562259f, -0.09514935f, -0.09465510f, -0.09413996f, -0.09360406f,
-    -0.09304753f, -0.09247051f, -0.09187313f, -0.09125555f, -0.09061790f, -0.08996032f, -0.08928298f, -0.08858603f,
-    -0.08786962f, -0.08713391f, -0.08637907f, -0.08560526f, -0.08481265f, -0.08400141f, -0.08317171f, -0.08232374f,
-    -0.08145768f, -0.08057369f, -0.07967199f, -0.07875274f, -0.07781614f, -0.07686239f, -0.07589167f, -0.07490420f,
-    -0.07390017f, -0.07287978f, -0.07184325f, -0.07079077f, -0.06972256f, -0.06863884f, -0.06753983f, -0.06642573f,
-    -0.06529677f, -0.06415317f, -0.06299517f, -0.06182298f, -0.06063683f, -0.05943696f, -0.05822360f, -0.05699699f,
-    -0.05575737f, -0.05450496f, -0.05324003f, -0.05196280f, -0.05067353f, -0.04937246f, -0.04805985f, -0.04673593f,
-    -0.04540098f, -0.04405523f, -0.04269895f, -0.04133239f, -0.03995581f, -0.03856948f, -0.03717365f, -0.03576860f,
-    -0.03435457f, -0.03293185f, -0.03150069f, -0.03006137f, -0.02861416f, -0.02715932f, -0.02569714f, -0.02422788f,
-    -0.02275181f, -0.02126922f, -0.01978039f, -0.01828558f, -0.01678507f, -0.01527916f, -0.01376811f, -0.01225220f,
-    -0.01073173f, -0.00920696f, -0.00767819f, -0.00614569f, -0.00460976f, -0.00307067f, -0.00152871f, 0.00001583f,
-    0.00156268f, 0.00311153f, 0.00466211f, 0.00621414f, 0.00776731f, 0.00932136f, 0.01087598f, 0.01243090f,
-    0.01398582f, 0.01554046f, 0.01709454f, 0.01864776f, 0.02019983f, 0.02175049f, 0.02329942f, 0.02484636f,
-    0.02639102f, 0.02793310f, 0.02947233f, 0.03100843f, 0.03254110f, 0.03407007f, 0.03559505f, 0.03711576f,
-    0.03863192f, 0.04014325f, 0.04164947f, 0.04315031f, 0.04464547f, 0.04613470f, 0.04761771f, 0.04909422f,
-    0.05056397f, 0.05202667f, 0.05348207f, 0.05492988f, 0.05636984f, 0.05780169f, 0.05922514f, 0.06063995f,
-    0.06204584f, 0.06344256f, 0.06482983f, 0.06620741f, 0.06757503f, 0.06893244f, 0.07027939f, 0.07161561f,
-    0.07294086f, 0.07425489f, 0.07555745f, 0.07684830f, 0.07812718f, 0.07939387f, 0.08064811f, 0.08188967f,
-    0.08311832f, 0.08433381f, 0.08553593f, 0.08672443f, 0.08789908f, 0.08905967f, 0.09020597f, 0.09133776f,
-    0.09245482f, 0.09355692f, 0.09464387f, 0.09571544f, 0.09677143f, 0.09781163f, 0.09883583f, 0.09984384f,
-    0.10083545f, 0.10181046f, 0.10276869f, 0.10370994f, 0.10463401f, 0.10554074f, 0.10642992f, 0.10730139f,
-    0.10815496f, 0.10899045f, 0.10980770f, 0.11060654f, 0.11138679f, 0.11214830f, 0.11289091f, 0.11361445f,
-    0.11431877f, 0.11500372f, 0.11566916f, 0.11631493f, 0.11694089f, 0.11754691f, 0.11813284f, 0.11869856f,
-    0.11924393f, 0.11976883f, 0.12027313f, 0.12075672f, 0.12121947f, 0.12166127f, 0.12208201f, 0.12248159f,
-    0.12285990f, 0.12321684f, 0.12355230f, 0.12386621f, 0.12415846f, 0.12442898f, 0.12467767f, 0.12490445f,
-    0.12510925f, 0.12529200f, 0.12545263f, 0.12559106f, 0.12570723f, 0.12580109f, 0.12587258f, 0.12592165f,
-    0.12594824f, 0.12595231f, 0.12593383f, 0.12589274f, 0.12582901f, 0.12574262f, 0.12563354f, 0.12550173f,
-    0.12534719f, 0.12516988f, 0.12496980f, 0.12474694f, 0.12450129f, 0.12423285f, 0.12394161f, 0.12362759f,
-    0.12329078f, 0.12293120f, 0.12254886f, 0.12214379f, 0.12171599f, 0.12126550f, 0.12079235f, 0.12029657f,
-    0.11977819f, 0.11923725f, 0.11867379f, 0.11808787f, 0.11747952f, 0.11684881f, 0.11619579f, 0.11552052f,
-    0.11482306f, 0.11410347f, 0.11336184f, 0.11259823f, 0.11181272f, 0.11100539f, 0.11017632f, 0.10932561f,
-    0.10845333f, 0.10755959f, 0.10664448f, 0.10570811f, 0.10475057f, 0.10377197f, 0.10277243f, 0.10175205f,
-    0.10071096f, 0.09964927f, 0.09856710f, 0.09746459f, 0.09634185f, 0.09519904f, 0.09403627f, 0.09285368f,
-    0.09165143f, 0.09042965f, 0.08918849f, 0.08792810f, 0.08664864f, 0.08535025f, 0.08403311f, 0.08269737f,
-    0.08134320f, 0.07997076f, 0.07858023f, 0.07717178f, 0.07574558f, 0.07430182f, 0.07284068f, 0.07136233f,
-    0.06986697f, 0.06835478f, 0.06682597f, 0.06528071f, 0.06371922f, 0.06214168f, 0.06054830f, 0.05893928f,
-    0.05731484f, 0.05567518f, 0.05402050f, 0.05235103f, 0.05066698f, 0.04896857f, 0.04725602f, 0.04552954f,
-    0.04378937f, 0.04203573f, 0.04026884f, 0.03848895f, 0.03669627f, 0.03489105f, 0.03307353f, 0.03124393f,
-    0.02940249f, 0.02754947f, 0.02568510f, 0.02380962f, 0.02192329f, 0.02002635f, 0.01811905f, 0.01620165f,
-    0.01427438f, 0.01233752f, 0.01039130f, 0.00843600f, 0.00647187f, 0.00449916f, 0.00251814f, 0.00052906f,
-    -0.00146780f, -0.00347218f, -0.00548383f, -0.00750246f, -0.00952783f, -0.01155966f, -0.01359767f, -0.01564161f,
-    -0.01769119f, -0.01974616f, -0.02180623f, -0.02387114f, -0.02594061f, -0.02801437f, -0.03009215f, -0.03217366f,
-    -0.03425864f, -0.03634681f, -0.03843789f, -0.04053161f, -0.04262769f, -0.04472585f, -0.04682582f, -0.04892731f,
-    -0.05103006f, -0.05313379f, -0.05523822f, -0.05734306f, -0.05944805f, -0.06155291f, -0.06365735f, -0.06576111f,
-    -0.06786391f, -0.06996547f, -0.07206552f, -0.07416378f, -0.07625997f, -0.07835382f, -0.08044506f, -0.08253342f,
-    -0.08461862f, -0.08670039f, -0.08877846f, -0.09085255f, -0.09292241f, -0.09498775f, -0.09704832f, -0.09910384f,
-    -0.10115405f, -0.10319868f, -0.10523748f, -0.10727017f, -0.10929649f, -0.11131619f, -0.11332901f, -0.11533467f,
-    -0.11733294f, -0.11932356f, -0.12130626f, -0.12328080f, -0.12524693f, -0.12720439f, -0.12915294f, -0.13109233f,
-    -0.13302231f, -0.13494265f, -0.13685310f, -0.13875342f, -0.14064338f, -0.14252273f, -0.14439124f, -0.14624868f,
-    -0.14809482f, -0.14992943f, -0.15175228f, -0.15356315f, -0.15536182f, -0.15714806f, -0.15892166f, -0.16068240f,
-    -0.16243006f, -0.16416444f, -0.16588533f, -0.16759251f, -0.16928579f, -0.17096496f, -0.17262982f, -0.17428018f,
-    -0.17591583f, -0.17753659f, -0.17914227f, -0.18073267f, -0.18230762f, -0.18386693f, -0.18541042f, -0.18693792f,
-    -0.18844925f, -0.18994424f, -0.19142272f, -0.19288453f, -0.19432950f, -0.19575747f, -0.19716828f, -0.19856179f,
-    -0.19993784f, -0.20129627f, -0.20263695f, -0.20395974f, -0.20526449f, -0.20655107f, -0.20781934f, -0.20906917f,
-    -0.21030044f, -0.21151302f, -0.21270680f, -0.21388164f, -0.21503745f, -0.21617411f, -0.21729150f, -0.21838953f,
-    -0.21946810f, -0.22052710f, -0.22156644f, -0.22258603f, -0.22358578f, -0.22456561f, -0.22552542f, -0.22646516f,
-    -0.22738474f, -0.22828408f, -0.22916313f, -0.23002181f, -0.23086007f, -0.23167784f, -0.23247508f, -0.23325173f,
-    -0.23400775f, -0.23474308f, -0.23545770f, -0.23615155f, -0.23682462f, -0.23747687f, -0.23810827f, -0.23871880f,
-    -0.23930844f, -0.23987717f, -0.24042498f, -0.24095187f, -0.24145783f, -0.24194285f, -0.24240693f, -0.24285009f,
-    -0.24327233f, -0.24367366f, -0.24405410f, -0.24441366f, -0.24475238f, -0.24507027f, -0.24536737f, -0.24564370f,
-    -0.24589932f, -0.24613424f, -0.24634853f, -0.24654222f, -0.24671537f, -0.24686804f, -0.24700027f, -0.24711213f,
-    -0.24720368f, -0.24727500f, -0.24732615f, -0.24735720f, -0.24736824f, -0.24735935f, -0.24733062f, -0.24728212f,
-    -0.24721395f, -0.24712621f, -0.24701900f, -0.24689241f, -0.24674655f, -0.24658153f, -0.24639745f, -0.24619445f,
-    -0.24597262f, -0.24573210f, -0.24547301f, -0.24519547f, -0.24489961f, -0.24458557f, -0.24425349f, -0.24390350f,
-    -0.24353575f, -0.24315037f, -0.24274753f, -0.24232738f, -0.24189006f, -0.24143573f, -0.24096456f, -0.24047671f,
-    -0.23997235f, -0.23945164f, -0.23891475f, -0.23836187f, -0.23779316f, -0.23720881f, -0.23660900f, -0.23599392f,
-    -0.23536376f, -0.23471870f, -0.23405894f, -0.23338467f, -0.23269609f, -0.23199341f, -0.23127683f, -0.23054655f,
-    -0.22980278f, -0.22904574f, -0.22827562f, -0.22749266f, -0.22669706f, -0.22588905f, -0.22506885f, -0.22423668f,
-    -0.22339277f, -0.22253735f, -0.22167064f, -0.22079288f, -0.21990430f, -0.21900515f, -0.21809565f, -0.21717604f,
-    -0.21624658f, -0.21530750f, -0.21435904f, -0.21340146f, -0.21243500f, -0.21145991f, -0.21047645f, -0.20948487f,
-    -0.20848542f, -0.20747836f, -0.20646394f, -0.20544243f, -0.20441409f, -0.20337918f, -0.20233796f, -0.20129069f,
-    -0.20023764f, -0.19917909f, -0.19811529f, -0.19704651f, -0.19597302f, -0.19489511f, -0.19381302f, -0.19272705f,
-    -0.19163746f, -0.19054452f, -0.18944852f, -0.18834972f, -0.18724841f, -0.18614486f, -0.18503934f, -0.18393214f,
-    -0.18282354f, -0.18171381f, -0.18060323f, -0.17949209f, -0.17838065f, -0.17726921f, -0.17615805f, -0.17504743f,
-    -0.17393766f, -0.17282900f, -0.17172173f, -0.17061615f, -0.16951252f, -0.16841113f, -0.16731227f, -0.16621620f,
-    -0.16512322f, -0.16403360f, -0.16294762f, -0.16186556f, -0.16078770f, -0.15971432f, -0.15864570f, -0.15758211f,
-    -0.15652383f, -0.15547114f, -0.15442432f, -0.15338363f, -0.15234936f, -0.15132177f, -0.15030114f, -0.14928774f,
-    -0.14828184f, -0.14728372f, -0.14629363f, -0.14531186f, -0.14433865f, -0.14337429f, -0.14241903f, -0.14147314f,
-    -0.14053689f, -0.13961052f, -0.13869430f, -0.13778849f, -0.13689334f, -0.13600911f, -0.13513606f, -0.13427443f,
-    -0.13342448f, -0.13258644f, -0.13176058f, -0.13094714f, -0.13014636f, -0.12935847f, -0.12858373f, -0.12782237f,
-    -0.12707463f, -0.12634073f, -0.12562092f, -0.12491542f, -0.12422447f, -0.12354828f, -0.12288708f, -0.12224109f,
-    -0.12161054f, -0.12099564f, -0.12039660f, -0.11981364f, -0.11924698f, -0.11869681f, -0.11816334f, -0.11764678f,
-    -0.11714733f, -0.11666518f, -0.11620054f, -0.11575359f, -0.11532453f, -0.11491354f, -0.11452081f, -0.11414653f,
-    -0.11379086f, -0.11345400f, -0.11313612f, -0.11283738f, -0.11255795f, -0.11229801f, -0.11205771f, -0.11183722f,
-    -0.11163670f, -0.11145629f, -0.11129615f, -0.11115642f, -0.11103726f, -0.11093881f, -0.11086120f, -0.11080458f,
-    -0.11076907f, -0.11075480f, -0.11076190f, -0.11079050f, -0.11084072f, -0.11091267f, -0.11100647f, -0.11112223f,
-    -0.11126005f, -0.11142004f, -0.11160230f, -0.11180694f, -0.11203403f, -0.11228368f, -0.11255597f, -0.11285099f,
-    -0.11316881f, -0.11350952f, -0.11387318f, -0.11425988f, -0.11466967f, -0.11510262f, -0.11555879f, -0.11603823f,
-    -0.11654101f, -0.11706716f, -0.11761674f, -0.11818979f, -0.11878634f, -0.11940644f, -0.12005011f, -0.12071739f,
-    -0.12140829f, -0.12212285f, -0.12286107f, -0.12362298f, -0.12440858f, -0.12521788f, -0.12605088f, -0.12690759f,
-    -0.12778800f, -0.12869211f, -0.12961990f, -0.13057135f, -0.13154646f, -0.13254520f, -0.13356755f, -0.13461348f,
-    -0.13568295f, -0.13677593f, -0.13789238f, -0.13903226f, -0.14019553f, -0.14138213f, -0.14259201f, -0.14382511f,
-    -0.14508138f, -0.14636075f, -0.14766315f, -0.14898852f, -0.15033677f, -0.15170784f, -0.15310164f, -0.15451809f,
-    -0.15595709f, -0.15741857f, -0.15890242f, -0.16040855f, -0.16193685f, -0.16348722f, -0.16505956f, -0.16665375f,
-    -0.16826968f, -0.16990722f, -0.17156627f, -0.17324670f, -0.17494837f, -0.17667116f, -0.17841493f, -0.18017956f,
-    -0.18196489f, -0.18377078f, -0.18559709f, -0.18744368f, -0.18931038f, -0.19119704f, -0.19310350f, -0.19502961f,
-    -0.19697520f, -0.19894009f, -0.20092413f, -0.20292714f, -0.20494894f, -0.20698936f, -0.20904820f, -0.21112530f,
-    -0.21322046f, -0.21533349f, -0.21746420f, -0.21961240f, -0.22177789f, -0.22396046f, -0.22615992f, -0.22837606f,
-    -0.23060868f, -0.23285755f, -0.23512248f, -0.23740325f, -0.23969963f, -0.24201142f, -0.24433838f, -0.24668029f,
-    -0.24903694f, -0.25140808f, -0.25379349f, -0.25619293f, -0.25860618f, -0.26103299f, -0.26347313f, -0.26592635f,
-    -0.26839241f, -0.27087107f, -0.27336209f, -0.27586520f, -0.27838017f, -0.28090673f, -0.28344465f, -0.28599365f,
-    -0.28855350f, -0.29112391f, -0.29370465f, -0.29629544f, -0.29889603f, -0.30150614f, -0.30412551f, -0.30675389f,
-    -0.30939099f, -0.31203654f, -0.31469029f, -0.31735195f, -0.32002125f, -0.32269792f, -0.32538169f, -0.32807227f,
-    -0.33076939f, -0.33347277f, -0.33618214f, -0.33889721f, -0.34161770f, -0.34434333f, -0.34707382f, -0.34980889f,
-    -0.35254826f, -0.35529163f, -0.35803873f, -0.36078927f, -0.36354296f, -0.36629953f, -0.36905868f, -0.37182013f,
-    -0.37458359f, -0.37734877f, -0.38011539f, -0.38288316f, -0.38565180f, -0.38842101f, -0.39119051f, -0.39396002f,
-    -0.39672924f, -0.39949789f, -0.40226568f, -0.40503233f, -0.40779755f, -0.41056105f, -0.41332255f, -0.41608176f,
-    -0.41883841f, -0.42159220f, -0.42434285f, -0.42709008f, -0.42983360f, -0.43257315f, -0.43530842f, -0.43803915f,
-    -0.44076506f, -0.44348586f, -0.44620128f, -0.44891105f, -0.45161488f, -0.45431250f, -0.45700364f, -0.45968803f,
-    -0.46236540f, -0.46503547f, -0.46769797f, -0.47035265f, -0.47299922f, -0.47563744f, -0.47826702f, -0.48088772f,
-    -0.48349928f, -0.48610142f, -0.48869390f, -0.49127646f, -0.49384884f, -0.49641080f, -0.49896207f, -0.50150242f,
-    -0.50403159f, -0.50654935f, -0.50905544f, -0.51154962f, -0.51403166f, -0.51650131f, -0.51895835f, -0.52140253f,
-    -0.52383363f, -0.52625142f, -0.52865566f, -0.53104614f, -0.53342263f, -0.53578491f, -0.53813276f, -0.54046597f,
-    -0.54278432f, -0.54508761f, -0.54737561f, -0.54964813f, -0.55190497f, -0.55414591f, -0.55637077f, -0.55857934f,
-    -0.56077144f, -0.56294687f, -0.56510544f, -0.56724697f, -0.56937128f, -0.57147818f, -0.57356750f, -0.57563907f,
-    -0.57769271f, -0.57972825f, -0.58174553f, -0.58374438f, -0.58572465f, -0.58768618f, -0.58962882f, -0.59155240f,
-    -0.59345680f, -0.59534185f, -0.59720742f, -0.59905338f, -0.60087958f, -0.60268589f, -0.60447218f, -0.60623833f,
-    -0.60798422f, -0.60970972f, -0.61141472f, -0.61309911f, -0.61476277f, -0.61640561f, -0.61802751f, -0.61962837f,
-    -0.62120811f, -0.62276662f, -0.62430382f, -0.62581961f, -0.62731393f, -0.62878668f, -0.63023780f, -0.63166720f,
-    -0.63307483f, -0.63446060f, -0.63582447f, -0.63716637f, -0.63848624f, -0.63978404f, -0.64105972f, -0.64231323f,
-    -0.64354452f, -0.64475357f, -0.64594033f, -0.64710478f, -0.64824688f, -0.64936662f, -0.65046397f, -0.65153892f,
-    -0.65259145f, -0.65362156f, -0.65462923f, -0.65561446f, -0.65657726f, -0.65751763f, -0.65843558f, -0.65933111f,
-    -0.66020424f, -0.66105500f, -0.66188340f, -0.66268946f, -0.66347322f, -0.66423472f, -0.66497397f, -0.66569103f,
-    -0.66638594f, -0.66705874f, -0.66770948f, -0.66833822f, -0.66894502f, -0.66952992f, -0.67009300f, -0.67063432f,
-    -0.67115396f, -0.67165198f, -0.67212847f, -0.67258350f, -0.67301716f, -0.67342954f, -0.67382072f, -0.67419079f,
-    -0.67453987f, -0.67486804f, -0.67517541f, -0.67546209f, -0.67572818f, -0.67597380f, -0.67619907f, -0.67640410f,
-    -0.67658903f, -0.67675396f, -0.67689904f, -0.67702439f, -0.67713015f, -0.67721646f, -0.67728345f, -0.67733128f,
-    -0.67736009f, -0.67737002f, -0.67736124f, -0.67733390f, -0.67728815f, -0.67722416f, -0.67714209f, -0.67704211f,
-    -0.67692438f, -0.67678909f, -0.67663640f, -0.67646650f, -0.67627956f, -0.67607576f, -0.67585530f, -0.67561836f,
-    -0.67536513f, -0.67509581f, -0.67481059f, -0.67450966f, -0.67419323f, -0.67386151f, -0.67351469f, -0.67315298f,
-    -0.67277660f, -0.67238575f, -0.67198066f, -0.67156153f, -0.67112858f, -0.67068204f, -0.67022212f, -0.66974905f,
-    -0.66926307f, -0.66876439f, -0.66825324f, -0.66772987f, -0.66719449f, -0.66664736f, -0.66608870f, -0.66551875f,
-    -0.66493776f, -0.66434597f, -0.66374362f, -0.66313096f, -0.66250823f, -0.66187569f, -0.66123358f, -0.66058216f,
-    -0.65992167f, -0.65925237f, -0.65857452f, -0.65788837f, -0.65719419f, -0.65649222f, -0.65578273f, -0.65506599f,
-    -0.65434225f, -0.65361177f, -0.65287482f, -0.65213167f, -0.65138257f, -0.65062780f, -0.64986763f, -0.64910231f,
-    -0.64833213f, -0.64755734f, -0.64677823f, -0.64599505f, -0.64520808f, -0.64441759f, -0.64362385f, -0.64282714f,
-    -0.64202772f, -0.64122588f, -0.64042187f, -0.63961598f, -0.63880848f, -0.63799963f, -0.63718972f, -0.63637902f,
-    -0.63556780f, -0.63475633f, -0.63394488f, -0.63313374f, -0.63232317f, -0.63151344f, -0.63070482f, -0.62989760f,
-    -0.62909203f, -0.62828839f, -0.62748695f, -0.62668798f, -0.62589174f, -0.62509852f, -0.62430857f, -0.62352216f,
-    -0.62273956f, -0.62196103f, -0.62118684f, -0.62041725f, -0.61965253f, -0.61889294f, -0.61813874f, -0.61739018f,
-    -0.61664754f, -0.61591105f, -0.61518099f, -0.61445761f, -0.61374116f, -0.61303189f, -0.61233006f, -0.61163591f,
-    -0.61094970f, -0.61027167f, -0.60960207f, -0.60894114f, -0.60828912f, -0.60764626f, -0.60701279f, -0.60638896f,
-    -0.60577499f, -0.60517112f, -0.60457759f, -0.60399462f, -0.60342244f, -0.60286128f, -0.60231137f, -0.60177292f,
-    -0.60124616f, -0.60073131f, -0.60022858f, -0.59973818f, -0.59926033f, -0.59879524f, -0.59834311f, -0.59790416f,
-    -0.59747857f, -0.59706656f, -0.59666833f, -0.59628406f, -0.59591395f, -0.59555819f, -0.59521698f, -0.59489049f,
-    -0.59457891f, -0.59428242f, -0.59400120f, -0.59373542f, -0.59348525f, -0.59325087f, -0.59303245f, -0.59283014f,
-    -0.59264411f, -0.59247451f, -0.59232151f, -0.59218525f, -0.59206590f, -0.59196358f, -0.59187845f, -0.59181065f,
-    -0.59176031f, -0.59172758f, -0.59171258f, -0.59171544f, -0.59173629f, -0.59177525f, -0.59183244f, -0.59190798f,
-    -0.59200198f, -0.59211455f, -0.59224580f, -0.59239583f, -0.59256474f, -0.59275263f, -0.59295959f, -0.59318571f,
-    -0.59343108f, -0.59369579f, -0.59397991f, -0.59428353f, -0.59460671f, -0.59494952f, -0.59531204f, -0.59569432f,
-    -0.59609643f, -0.59651842f, -0.59696035f, -0.59742227f, -0.59790421f, -0.59840624f, -0.59892838f, -0.59947067f,
-    -0.60003314f, -0.60061583f, -0.60121875f, -0.60184193f, -0.60248539f, -0.60314915f, -0.60383320f, -0.60453757f,
-    -0.60526226f, -0.60600726f, -0.60677258f, -0.60755821f, -0.60836413f, -0.60919034f, -0.61003682f, -0.61090355f,
-    -0.61179050f, -0.61269764f, -0.61362495f, -0.61457240f, -0.61553993f, -0.61652752f, -0.61753511f, -0.61856266f,
-    -0.61961012f, -0.62067742f, -0.62176452f, -0.62287135f, -0.62399784f, -0.62514392f, -0.62630953f, -0.62749457f,
-    -0.62869899f, -0.62992268f, -0.63116558f, -0.63242757f, -0.63370858f, -0.63500851f, -0.63632725f, -0.63766471f,
-    -0.63902077f, -0.64039532f, -0.64178826f, -0.64319947f, -0.64462883f, -0.64607621f, -0.64754149f, -0.64902453f,
-    -0.65052522f, -0.65204340f, -0.65357895f, -0.65513172f, -0.65670156f, -0.65828834f, -0.65989189f, -0.66151206f,
-    -0.66314870f, -0.66480164f, -0.66647073f, -0.66815579f, -0.66985666f, -0.67157317f, -0.67330514f, -0.67505240f,
-    -0.67681476f, -0.67859204f, -0.68038406f, -0.68219062f, -0.68401154f, -0.68584663f, -0.68769568f, -0.68955850f,
-    -0.69143488f, -0.69332463f, -0.69522753f, -0.69714338f, -0.69907196f, -0.70101306f, -0.70296647f, -0.70493197f,
-    -0.70690933f, -0.70889834f, -0.71089876f, -0.71291037f, -0.71493294f, -0.71696624f, -0.71901003f, -0.72106409f,
-    -0.72312816f, -0.72520201f, -0.72728540f, -0.72937808f, -0.73147981f, -0.73359034f, -0.73570942f, -0.73783680f,
-    -0.73997223f, -0.74211545f, -0.74426620f, -0.74642423f, -0.74858929f, -0.75076109f, -0.75293940f, -0.75512393f,
-    -0.75731443f, -0.75951063f, -0.76171227f, -0.76391906f, -0.76613074f, -0.76834704f, -0.77056769f, -0.77279242f,
-    -0.77502094f, -0.77725298f, -0.77948826f, -0.78172651f, -0.78396745f, -0.78621080f, -0.78845627f, -0.79070359f,
-    -0.79295247f, -0.79520264f, -0.79745380f, -0.79970567f, -0.80195797f, -0.80421041f, -0.80646272f, -0.80871459f,
-    -0.81096575f, -0.81321591f, -0.81546478f, -0.81771207f, -0.81995750f, -0.82220078f, -0.82444163f, -0.82667974f,
-    -0.82891485f, -0.83114665f, -0.83337486f, -0.83559920f, -0.83781937f, -0.84003509f, -0.84224607f, -0.84445203f,
-    -0.84665267f, -0.84884772f, -0.85103688f, -0.85321988f, -0.85539643f, -0.85756624f, -0.85972902f, -0.86188451f,
-    -0.86403241f, -0.86617245f, -0.86830434f, -0.87042780f, -0.87254256f, -0.87464833f, -0.87674485f, -0.87883182f,
-    -0.88090899f, -0.88297607f, -0.88503280f, -0.88707889f, -0.88911409f, -0.89113812f, -0.89315071f, -0.89515159f,
-    -0.89714051f, -0.89911720f, -0.90108139f, -0.90303282f, -0.90497124f, -0.90689639f, -0.90880801f, -0.91070585f,
-    -0.91258965f, -0.91445917f, -0.91631414f, -0.91815434f, -0.91997950f, -0.92178940f, -0.92358378f, -0.92536240f,
-    -0.92712503f, -0.92887144f, -0.93060138f, -0.93231463f, -0.93401096f, -0.93569013f, -0.93735194f, -0.93899614f,
-    -0.94062253f, -0.94223087f, -0.94382097f, -0.94539260f, -0.94694556f, -0.94847963f, -0.94999460f, -0.95149028f,
-    -0.95296647f, -0.95442296f, -0.95585956f, -0.95727608f, -0.95867232f, -0.96004810f, -0.96140323f, -0.96273753f,
-    -0.96405082f, -0.96534293f, -0.96661367f, -0.96786289f, -0.96909040f, -0.97029605f, -0.97147968f, -0.97264111f,
-    -0.97378021f, -0.97489680f, -0.97599076f, -0.97706191f, -0.97811013f, -0.97913527f, -0.98013719f, -0.98111577f,
-    -0.98207085f, -0.98300233f, -0.98391007f, -0.98479395f, -0.98565385f, -0.98648966f, -0.98730127f, -0.98808855f,
-    -0.98885142f, -0.98958977f, -0.99030350f, -0.99099251f, -0.99165671f, -0.99229601f, -0.99291033f, -0.99349959f,
-    -0.99406370f, -0.99460260f, -0.99511621f, -0.99560445f, -0.99606728f, -0.99650462f, -0.99691642f, -0.99730262f,
-    -0.99766318f, -0.99799805f, -0.99830717f, -0.99859052f, -0.99884806f, -0.99907975f, -0.99928556f, -0.99946548f,
-    -0.99961946f, -0.99974751f, -0.99984959f, -0.99992571f, -0.99997585f, -1.00000000f, -0.99999817f, -0.99997036f,
-    -0.99991657f, -0.99983682f, -0.99973112f, -0.99959948f, -0.99944193f, -0.99925848f, -0.99904917f, -0.99881403f,
-    -0.99855309f, -0.99826639f, -0.99795397f, -0.99761588f, -0.99725217f, -0.99686288f, -0.99644807f, -0.99600781f,
-    -0.99554215f, -0.99505116f, -0.99453491f, -0.99399347f, -0.99342693f, -0.99283535f, -0.99221882f, -0.99157743f,
-    -0.99091127f, -0.99022043f, -0.98950501f, -0.98876511f, -0.98800083f, -0.98721228f, -0.98639956f, -0.98556280f,
-    -0.98470210f, -0.98381759f, -0.98290939f, -0.98197762f, -0.98102242f, -0.98004391f, -0.97904224f, -0.97801753f,
-    -0.97696994f, -0.97589960f, -0.97480667f, -0.97369129f, -0.97255362f, -0.97139382f, -0.97021203f, -0.96900844f,
-    -0.96778319f, -0.96653647f, -0.96526844f, -0.96397927f, -0.96266914f, -0.96133823f, -0.95998672f, -0.95861480f,
-    -0.95722265f, -0.95581047f, -0.95437844f, -0.95292677f, -0.95145564f, -0.94996527f, -0.94845584f, -0.94692757f,
-    -0.94538067f, -0.94381534f, -0.94223179f, -0.94063025f, -0.93901092f, -0.93737403f, -0.93571980f, -0.93404845f,
-    -0.93236020f, -0.93065529f, -0.92893394f, -0.92719639f, -0.92544286f, -0.92367360f, -0.92188884f, -0.92008883f,
-    -0.91827379f, -0.91644398f, -0.91459963f, -0.91274101f, -0.91086835f, -0.90898190f, -0.90708192f, -0.90516865f,
-    -0.90324236f, -0.90130330f, -0.89935172f, -0.89738789f, -0.89541206f, -0.89342450f, -0.89142546f, -0.88941522f,
-    -0.88739404f, -0.88536218f, -0.88331991f, -0.88126750f, -0.87920523f, -0.87713335f, -0.87505214f, -0.87296187f,
-    -0.87086283f, -0.86875527f, -0.86663947f, -0.86451572f, -0.86238428f, -0.86024544f, -0.85809946f, -0.85594663f,
-    -0.85378723f, -0.85162154f, -0.84944982f, -0.84727238f, -0.84508947f, -0.84290139f, -0.84070841f, -0.83851081f,
-    -0.83630889f, -0.83410290f, -0.83189314f, -0.82967989f, -0.82746343f, -0.82524404f, -0.82302199f, -0.82079758f,
-    -0.81857107f, -0.81634276f, -0.81411291f, -0.81188182f, -0.80964975f, -0.80741699f, -0.80518381f, -0.80295049f,
-    -0.80071731f, -0.79848455f, -0.79625248f, -0.79402137f, -0.79179150f, -0.78956314f, -0.78733657f, -0.78511206f,
-    -0.78288988f, -0.78067029f, -0.77845357f, -0.77623998f, -0.77402980f, -0.77182328f, -0.76962070f, -0.76742230f,
-    -0.76522837f, -0.76303915f, -0.76085491f, -0.75867590f, -0.75650238f, -0.75433461f, -0.75217283f, -0.75001731f,
-    -0.74786829f, -0.74572602f, -0.74359075f, -0.74146273f, -0.73934218f, -0.73722937f, -0.73512453f, -0.73302790f,
-    -0.73093971f, -0.72886019f, -0.72678959f, -0.72472813f, -0.72267604f, -0.72063355f, -0.71860088f, -0.71657825f,
-    -0.71456588f, -0.71256400f, -0.71057281f, -0.70859253f, -0.70662338f, -0.70466555f, -0.70271926f, -0.70078470f,
-    -0.69886209f, -0.69695162f, -0.69505348f, -0.69316788f, -0.69129499f, -0.68943502f, -0.68758814f, -0.68575455f,
-    -0.68393441f, -0.68212791f, -0.68033523f, -0.67855653f, -0.67679198f, -0.67504177f, -0.67330603f, -0.67158495f,
-    -0.66987867f, -0.66818736f, -0.66651116f, -0.66485022f, -0.66320469f, -0.66157472f, -0.65996044f, -0.65836199f,
-    -0.65677951f, -0.65521313f, -0.65366297f, -0.65212916f, -0.65061182f, -0.64911107f, -0.64762702f, -0.64615980f,
-    -0.64470950f, -0.64327623f, -0.64186009f, -0.64046119f, -0.63907961f, -0.63771546f, -0.63636882f, -0.63503977f,
-    -0.63372840f, -0.63243479f, -0.63115902f, -0.62990114f, -0.62866124f, -0.62743939f, -0.62623563f, -0.62505003f,
-    -0.62388265f, -0.62273353f, -0.62160273f, -0.62049029f, -0.61939624f, -0.61832064f, -0.61726351f, -0.61622488f,
-    -0.61520479f, -0.61420325f, -0.61322028f, -0.61225590f, -0.61131013f, -0.61038298f, -0.60947444f, -0.60858453f,
-    -0.60771324f, -0.60686057f, -0.60602651f, -0.60521105f, -0.60441417f, -0.60363586f, -0.60287609f, -0.60213485f,
-    -0.60141209f, -0.60070779f, -0.60002191f, -0.59935441f, -0.59870526f, -0.59807440f, -0.59746178f, -0.59686735f,
-    -0.59629106f, -0.59573284f, -0.59519263f, -0.59467037f, -0.59416598f, -0.59367939f, -0.59321053f, -0.59275930f,
-    -0.59232564f, -0.59190945f, -0.59151064f, -0.59112913f, -0.59076480f, -0.59041756f, -0.59008732f, -0.58977395f,
-    -0.58947736f, -0.58919742f, -0.58893403f, -0.58868706f, -0.58845639f, -0.58824190f, -0.58804345f, -0.58786091f,
-    -0.58769416f, -0.58754304f, -0.58740743f, -0.58728717f, -0.58718212f, -0.58709213f, -0.58701704f, -0.58695671f,
-    -0.58691097f, -0.58687966f, -0.58686261f, -0.58685967f, -0.58687065f, -0.58689539f, -0.58693371f, -0.58698544f,
-    -0.58705039f, -0.58712837f, -0.58721921f, -0.58732272f, -0.58743870f, -0.58756696f, -0.58770730f, -0.58785954f,
-    -0.58802345f, -0.58819885f, -0.58838553f, -0.58858327f, -0.58879188f, -0.58901113f, -0.58924081f, -0.58948071f,
-    -0.58973060f, -0.58999027f, -0.59025949f, -0.59053804f, -0.59082569f, -0.59112221f, -0.59142737f, -0.59174094f,
-    -0.59206268f, -0.59239235f, -0.59272973f, -0.59307456f, -0.59342660f, -0.59378562f, -0.59415137f, -0.59452360f,
-    -0.59490206f, -0.59528650f, -0.59567668f, -0.59607233f, -0.59647322f, -0.59687907f, -0.59728964f, -0.59770466f,
-    -0.59812388f, -0.59854704f, -0.59897387f, -0.59940412f, -0.59983752f, -0.60027381f, -0.60071272f, -0.60115398f,
-    -0.60159733f, -0.60204250f, -0.60248922f, -0.60293722f, -0.60338623f, -0.60383598f, -0.60428621f, -0.60473663f,
-    -0.60518697f, -0.60563697f, -0.60608634f, -0.60653482f, -0.60698213f, -0.60742799f, -0.60787214f, -0.60831429f,
-    -0.60875417f, -0.60919151f, -0.60962603f, -0.61005746f, -0.61048551f, -0.61090992f, -0.61133041f, -0.61174670f,
-    -0.61215853f, -0.61256560f, -0.61296766f, -0.61336443f, -0.61375562f, -0.61414098f, -0.61452023f, -0.61489308f,
-    -0.61525928f, -0.61561856f, -0.61597063f, -0.61631524f, -0.61665210f, -0.61698097f, -0.61730155f, -0.61761360f,
-    -0.61791684f, -0.61821101f, -0.61849584f, -0.61877107f, -0.61903645f, -0.61929170f, -0.61953657f, -0.61977080f,
-    -0.61999414f, -0.62020633f, -0.62040710f, -0.62059622f, -0.62077343f, -0.62093847f, -0.62109110f, -0.62123107f,
-    -0.62135814f, -0.62147206f, -0.62157259f, -0.62165948f, -0.62173251f, -0.62179142f, -0.62183599f, -0.62186598f,
-    -0.62188116f, -0.62188129f, -0.62186616f, -0.62183553f, -0.62178919f, -0.62172690f, -0.62164845f, -0.62155362f,
-    -0.62144219f, -0.62131396f, -0.62116870f, -0.62100622f, -0.62082630f, -0.62062874f, -0.62041334f, -0.62017990f,
-    -0.61992821f, -0.61965810f, -0.61936936f, -0.61906180f, -0.61873524f, -0.61838949f, -0.61802437f, -0.61763971f,
-    -0.61723532f, -0.61681103f, -0.61636667f, -0.61590208f, -0.61541708f, -0.61491151f, -0.61438522f, -0.61383804f,
-    -0.61326983f, -0.61268042f, -0.61206969f, -0.61143746f, -0.61078362f, -0.61010801f, -0.60941050f, -0.60869096f,
-    -0.60794926f, -0.60718527f, -0.60639886f, -0.60558992f, -0.60475833f, -0.60390398f, -0.60302674f, -0.60212653f,
-    -0.60120322f, -0.60025673f, -0.59928695f, -0.59829378f, -0.59727715f, -0.59623695f, -0.59517310f, -0.59408553f,
-    -0.59297415f, -0.59183889f, -0.59067969f, -0.58949646f, -0.58828915f, -0.58705770f, -0.58580205f, -0.58452214f,
-    -0.58321793f, -0.58188937f, -0.58053641f, -0.57915902f, -0.57775715f, -0.57633078f, -0.57487988f, -0.57340442f,
-    -0.57190438f, -0.57037974f, -0.56883048f, -0.56725660f, -0.56565808f, -0.56403492f, -0.56238713f, -0.56071469f,
-    -0.55901762f, -0.55729593f, -0.55554963f, -0.55377874f, -0.55198328f, -0.55016327f, -0.54831874f, -0.54644972f,
-    -0.54455625f, -0.54263836f, -0.54069610f, -0.53872950f, -0.53673863f, -0.53472352f, -0.53268425f, -0.53062086f,
-    -0.52853341f, -0.52642199f, -0.52428665f, -0.52212746f, -0.51994451f, -0.51773788f, -0.51550764f, -0.51325389f,
-    -0.51097671f, -0.50867620f, -0.50635246f, -0.50400559f, -0.50163569f, -0.49924286f, -0.49682722f, -0.49438889f,
-    -0.49192797f, -0.48944459f, -0.48693888f, -0.48441095f, -0.48186095f, -0.47928900f, -0.47669524f, -0.47407981f,
-    -0.47144285f, -0.46878451f, -0.46610493f, -0.46340428f, -0.46068270f, -0.45794035f, -0.45517740f, -0.45239401f,
-    -0.44959034f, -0.44676656f, -0.44392286f, -0.44105939f, -0.43817636f, -0.43527392f, -0.43235227f, -0.42941160f,
-    -0.42645210f, -0.42347395f, -0.42047736f, -0.41746252f, -0.41442963f, -0.41137889f, -0.40831052f, -0.40522471f,
-    -0.40212168f, -0.39900165f, -0.39586483f, -0.39271143f, -0.38954168f, -0.38635580f, -0.38315401f, -0.37993655f,
-    -0.37670364f, -0.37345551f, -0.37019240f, -0.36691455f, -0.36362219f, -0.36031556f, -0.35699490f, -0.35366046f,
-    -0.35031249f, -0.34695124f, -0.34357694f, -0.34018986f, -0.33679025f, -0.33337837f, -0.32995447f, -0.32651880f,
-    -0.32307164f, -0.31961324f, -0.31614387f, -0.31266379f, -0.30917327f, -0.30567258f, -0.30216198f, -0.29864175f,
-    -0.29511216f, -0.29157348f, -0.28802599f, -0.28446996f, -0.28090567f, -0.27733340f, -0.27375343f, -0.27016604f,
-    -0.26657151f, -0.26297011f, -0.25936215f, -0.25574789f, -0.25212762f, -0.24850163f, -0.24487021f, -0.24123364f,
-    -0.23759220f, -0.23394620f, -0.23029591f, -0.22664162f, -0.22298364f, -0.21932223f, -0.21565770f, -0.21199034f,
-    -0.20832043f, -0.20464827f, -0.20097415f, -0.19729836f, -0.19362119f, -0.18994294f, -0.18626390f, -0.18258435f,
-    -0.17890459f, -0.17522491f, -0.17154561f, -0.16786696f, -0.16418928f, -0.16051283f, -0.15683793f, -0.15316484f,
-    -0.14949388f, -0.14582531f, -0.14215944f, -0.13849654f, -0.13483692f, -0.13118085f, -0.12752861f, -0.12388050f,
-    -0.12023680f, -0.11659779f, -0.11296376f, -0.10933498f, -0.10571175f, -0.10209432f, -0.09848300f, -0.09487805f,
-    -0.09127975f, -0.08768837f, -0.08410420f, -0.08052750f, -0.07695854f, -0.07339759f, -0.06984494f, -0.06630083f,
-    -0.06276554f, -0.05923933f, -0.05572246f, -0.05221520f, -0.04871781f, -0.04523054f, -0.04175366f, -0.03828740f,
-    -0.03483204f, -0.03138781f, -0.02795498f, -0.02453378f, -0.02112446f, -0.01772726f, -0.01434243f, -0.01097021f,
-    -0.00761083f, -0.00426453f, -0.00093154f, 0.00238791f, 0.00569359f, 0.00898527f, 0.01226272f, 0.01552574f,
-    0.01877409f, 0.02200756f, 0.02522594f, 0.02842901f, 0.03161656f, 0.03478839f, 0.03794429f, 0.04108406f,
-    0.04420750f, 0.04731442f, 0.05040461f, 0.05347788f, 0.05653406f, 0.05957295f, 0.06259437f, 0.06559813f,
-    0.06858407f, 0.07155201f, 0.07450176f, 0.07743318f, 0.08034608f, 0.08324031f, 0.08611571f, 0.08897211f,
-    0.09180937f, 0.09462734f, 0.09742586f, 0.10020479f, 0.10296399f, 0.10570333f, 0.10842266f, 0.11112185f,
-    0.11380078f, 0.11645932f, 0.11909734f, 0.12171474f, 0.12431138f, 0.12688716f, 0.12944197f, 0.13197571f,
+alignas(4) const int16_t waveform_Rhodes[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+      1109,    -58,    656,    618,   1064,   1151,   1523,   1657,   1994,   2152,   2468,   2640,   2942,   3123,   3414,   3601,
+      3883,   4073,   4347,   4540,   4807,   5001,   5262,   5455,   5710,   5902,   6151,   6342,   6586,   6774,   7012,   7198,
+      7430,   7614,   7840,   8020,   8240,   8416,   8631,   8803,   9011,   9180,   9382,   9546,   9742,   9901,  10091,  10245,
+     10428,  10577,  10754,  10898,  11069,  11207,  11372,  11505,  11662,  11789,  11941,  12062,  12207,  12323,  12460,  12570,
+     12702,  12806,  12931,  13029,  13147,  13240,  13351,  13438,  13543,  13624,  13723,  13798,  13891,  13960,  14047,  14110,
+     14191,  14249,  14324,  14376,  14445,  14492,  14556,  14598,  14656,  14693,  14745,  14777,  14825,  14852,  14895,  14918,
+     14955,  14974,  15007,  15022,  15051,  15062,  15086,  15093,  15114,  15118,  15136,  15136,  15150,  15148,  15159,  15154,
+     15162,  15155,  15161,  15151,  15154,  15143,  15145,  15132,  15132,  15117,  15116,  15100,  15098,  15082,  15078,  15062,
+     15058,  15041,  15037,  15020,  15017,  15000,  14997,  14981,  14978,  14963,  14961,  14948,  14947,  14935,  14935,  14925,
+     14928,  14919,  14924,  14917,  14924,  14920,  14929,  14929,  14940,  14942,  14957,  14962,  14980,  14989,  15010,  15022,
+     15047,  15063,  15091,  15111,  15144,  15168,  15204,  15232,  15273,  15306,  15351,  15388,  15437,  15479,  15533,  15580,
+     15638,  15690,  15753,  15809,  15878,  15939,  16012,  16078,  16157,  16228,  16311,  16387,  16475,  16556,  16649,  16735,
+     16833,  16925,  17027,  17123,  17231,  17332,  17445,  17550,  17668,  17778,  17900,  18015,  18141,  18261,  18391,  18516,
+     18650,  18779,  18918,  19050,  19193,  19329,  19476,  19616,  19766,  19909,  20063,  20210,  20366,  20516,  20676,  20829,
+     20991,  21147,  21312,  21470,  21637,  21797,  21966,  22128,  22299,  22463,  22635,  22800,  22974,  23140,  23314,  23481,
+     23656,  23824,  23999,  24167,  24343,  24510,  24685,  24853,  25028,  25194,  25368,  25534,  25707,  25871,  26042,  26206,
+     26375,  26536,  26704,  26863,  27028,  27185,  27347,  27501,  27661,  27812,  27969,  28116,  28270,  28414,  28563,  28704,
+     28849,  28986,  29127,  29259,  29396,  29523,  29655,  29778,  29905,  30023,  30145,  30258,  30375,  30482,  30593,  30695,
+     30800,  30896,  30995,  31085,  31179,  31263,  31350,  31428,  31509,  31580,  31654,  31719,  31787,  31845,  31907,  31958,
+     32013,  32057,  32105,  32143,  32184,  32215,  32250,  32274,  32301,  32319,  32339,  32349,  32363,  32367,  32373,  32370,
+     32370,  32360,  32353,  32337,  32323,  32300,  32280,  32250,  32223,  32187,  32154,  32112,  32072,  32024,  31978,  31924,
+     31872,  31812,  31754,  31688,  31625,  31554,  31485,  31409,  31335,  31253,  31174,  31087,  31004,  30912,  30824,  30728,
+     30636,  30536,  30440,  30335,  30235,  30127,  30024,  29913,  29806,  29691,  29581,  29464,  29351,  29232,  29116,  28995,
+     28877,  28753,  28634,  28509,  28388,  28261,  28139,  28011,  27888,  27759,  27636,  27506,  27382,  27253,  27129,  27000,
+     26876,  26747,  26624,  26496,  26373,  26246,  26125,  25999,  25879,  25754,  25636,  25514,  25397,  25277,  25163,  25044,
+     24933,  24817,  24708,  24595,  24489,  24380,  24277,  24170,  24071,  23968,  23872,  23773,  23681,  23585,  23497,  23406,
+     23322,  23235,  23155,  23072,  22997,  22919,  22848,  22774,  22708,  22639,  22578,  22514,  22458,  22399,  22347,  22293,
+     22247,  22198,  22156,  22112,  22076,  22037,  22006,  21973,  21947,  21918,  21897,  21874,  21858,  21840,  21829,  21816,
+     21810,  21802,  21801,  21797,  21801,  21803,  21812,  21818,  21831,  21842,  21860,  21875,  21897,  21917,  21943,  21967,
+     21997,  22025,  22059,  22091,  22129,  22164,  22205,  22244,  22289,  22330,  22378,  22423,  22474,  22521,  22575,  22625,
+     22680,  22733,  22790,  22845,  22904,  22960,  23022,  23079,  23142,  23201,  23264,  23324,  23388,  23449,  23514,  23574,
+     23640,  23700,  23766,  23826,  23891,  23951,  24015,  24075,  24138,  24196,  24258,  24315,  24376,  24431,  24490,  24543,
+     24600,  24651,  24706,  24754,  24806,  24852,  24901,  24944,  24990,  25030,  25073,  25109,  25148,  25181,  25216,  25245,
+     25275,  25300,  25327,  25347,  25369,  25385,  25403,  25413,  25426,  25432,  25440,  25441,  25443,  25439,  25436,  25426,
+     25418,  25402,  25388,  25367,  25347,  25321,  25295,  25263,  25231,  25193,  25155,  25111,  25067,  25017,  24967,  24911,
+     24855,  24792,  24731,  24662,  24594,  24519,  24446,  24365,  24285,  24198,  24112,  24019,  23928,  23829,  23731,  23627,
+     23524,  23414,  23305,  23189,  23074,  22953,  22833,  22707,  22582,  22450,  22320,  22183,  22048,  21907,  21767,  21621,
+     21477,  21326,  21178,  21023,  20870,  20712,  20555,  20393,  20233,  20067,  19903,  19734,  19567,  19395,  19226,  19051,
+     18879,  18702,  18527,  18348,  18171,  17990,  17812,  17629,  17449,  17265,  17084,  16899,  16717,  16532,  16349,  16163,
+     15980,  15794,  15612,  15425,  15243,  15058,  14876,  14691,  14511,  14327,  14148,  13965,  13788,  13607,  13431,  13253,
+     13079,  12902,  12731,  12557,  12388,  12217,  12052,  11884,  11721,  11557,  11397,  11236,  11081,  10924,  10772,  10619,
+     10472,  10323,  10180,  10036,   9898,   9758,   9624,   9490,   9361,   9231,   9108,   8983,   8865,   8746,   8633,   8520,
+      8413,   8305,   8203,   8101,   8005,   7909,   7819,   7729,   7645,   7560,   7482,   7404,   7332,   7260,   7194,   7128,
+      7068,   7008,   6954,   6900,   6853,   6805,   6763,   6721,   6686,   6650,   6620,   6590,   6567,   6543,   6525,   6506,
+      6494,   6482,   6475,   6468,   6467,   6465,   6469,   6472,   6482,   6490,   6504,   6518,   6537,   6555,   6579,   6601,
+      6629,   6656,   6689,   6720,   6756,   6791,   6831,   6869,   6913,   6955,   7002,   7047,   7096,   7144,   7197,   7247,
+      7302,   7355,   7412,   7467,   7526,   7583,   7644,   7702,   7764,   7824,   7887,   7947,   8011,   8072,   8137,   8198,
+      8262,   8324,   8388,   8449,   8513,   8574,   8637,   8697,   8760,   8818,   8879,   8937,   8996,   9052,   9110,   9163,
+      9219,   9271,   9324,   9373,   9424,   9470,   9518,   9561,   9606,   9646,   9688,   9724,   9762,   9796,   9830,   9859,
+      9889,   9914,   9941,   9962,   9983,  10000,  10017,  10029,  10042,  10049,  10057,  10059,  10062,  10060,  10058,  10050,
+     10043,  10030,  10018,  10000,   9982,   9958,   9935,   9907,   9878,   9844,   9810,   9770,   9731,   9686,   9641,   9590,
+      9540,   9484,   9428,   9367,   9306,   9239,   9173,   9101,   9029,   8952,   8875,   8793,   8711,   8624,   8537,   8445,
+      8353,   8256,   8160,   8058,   7957,   7851,   7746,   7636,   7526,   7412,   7299,   7180,   7063,   6941,   6821,   6695,
+      6571,   6442,   6315,   6183,   6053,   5919,   5786,   5649,   5514,   5375,   5237,   5096,   4957,   4814,   4673,   4529,
+      4386,   4241,   4098,   3951,   3807,   3660,   3516,   3368,   3224,   3076,   2932,   2785,   2641,   2494,   2351,   2205,
+      2063,   1918,   1777,   1634,   1494,   1353,   1215,   1076,    940,    803,    670,    536,    405,    273,    146,     17,
+      -107,   -233,   -354,   -475,   -592,   -710,   -824,   -938,  -1047,  -1156,  -1261,  -1366,  -1466,  -1567,  -1662,  -1758,
+     -1848,  -1939,  -2024,  -2110,  -2190,  -2270,  -2345,  -2419,  -2488,  -2557,  -2621,  -2684,  -2742,  -2799,  -2851,  -2902,
+     -2948,  -2994,  -3034,  -3073,  -3107,  -3141,  -3168,  -3196,  -3217,  -3239,  -3254,  -3269,  -3279,  -3288,  -3291,  -3294,
+     -3292,  -3289,  -3280,  -3271,  -3257,  -3242,  -3221,  -3201,  -3175,  -3149,  -3117,  -3085,  -3048,  -3011,  -2969,  -2926,
+     -2879,  -2831,  -2778,  -2726,  -2668,  -2611,  -2549,  -2487,  -2421,  -2355,  -2284,  -2214,  -2139,  -2065,  -1986,  -1908,
+     -1826,  -1745,  -1660,  -1575,  -1487,  -1400,  -1309,  -1219,  -1125,  -1033,   -937,   -843,   -745,   -649,   -549,   -452,
+      -351,   -252,   -150,    -51,     52,    152,    255,    356,    459,    560,    662,    763,    865,    965,   1067,   1166,
+      1266,   1364,   1463,   1560,   1657,   1752,   1848,   1940,   2034,   2124,   2215,   2302,   2391,   2475,   2560,   2642,
+      2724,   2802,   2881,   2955,   3030,   3101,   3171,   3238,   3305,   3367,   3429,   3487,   3544,   3597,   3650,   3698,
+      3746,   3789,   3832,   3870,   3908,   3940,   3972,   4000,   4026,   4048,   4069,   4085,   4100,   4110,   4119,   4124,
+      4127,   4126,   4123,   4116,   4108,   4094,   4080,   4061,   4040,   4015,   3989,   3957,   3925,   3888,   3850,   3807,
+      3763,   3714,   3664,   3610,   3554,   3494,   3433,   3367,   3300,   3229,   3157,   3081,   3004,   2922,   2840,   2753,
+      2666,   2574,   2482,   2386,   2290,   2189,   2088,   1983,   1878,   1770,   1661,   1548,   1435,   1319,   1203,   1083,
+       964,    841,    719,    593,    468,    340,    213,     82,    -48,   -180,   -312,   -446,   -579,   -715,   -850,   -986,
+     -1122,  -1260,  -1396,  -1535,  -1672,  -1810,  -1947,  -2086,  -2223,  -2362,  -2498,  -2636,  -2772,  -2909,  -3044,  -3180,
+     -3314,  -3449,  -3581,  -3714,  -3844,  -3975,  -4103,  -4232,  -4358,  -4485,  -4608,  -4732,  -4852,  -4973,  -5090,  -5208,
+     -5322,  -5436,  -5546,  -5657,  -5764,  -5870,  -5973,  -6076,  -6174,  -6273,  -6367,  -6461,  -6551,  -6640,  -6725,  -6810,
+     -6890,  -6970,  -7045,  -7120,  -7191,  -7260,  -7326,  -7390,  -7450,  -7509,  -7564,  -7618,  -7667,  -7715,  -7759,  -7802,
+     -7841,  -7878,  -7911,  -7943,  -7971,  -7997,  -8019,  -8040,  -8057,  -8072,  -8083,  -8094,  -8099,  -8104,  -8105,  -8104,
+     -8100,  -8094,  -8084,  -8074,  -8059,  -8044,  -8024,  -8004,  -7979,  -7954,  -7925,  -7896,  -7863,  -7829,  -7791,  -7753,
+     -7712,  -7670,  -7624,  -7578,  -7529,  -7480,  -7428,  -7375,  -7319,  -7264,  -7205,  -7146,  -7085,  -7024,  -6960,  -6897,
+     -6831,  -6765,  -6697,  -6630,  -6561,  -6492,  -6421,  -6351,  -6279,  -6208,  -6135,  -6063,  -5990,  -5918,  -5844,  -5772,
+     -5699,  -5627,  -5554,  -5482,  -5410,  -5339,  -5268,  -5199,  -5128,  -5060,  -4992,  -4925,  -4858,  -4794,  -4729,  -4667,
+     -4604,  -4545,  -4485,  -4428,  -4371,  -4318,  -4264,  -4213,  -4163,  -4116,  -4070,  -4027,  -3984,  -3945,  -3907,  -3872,
+     -3838,  -3808,  -3778,  -3753,  -3728,  -3707,  -3688,  -3672,  -3658,  -3647,  -3638,  -3633,  -3629,  -3630,  -3631,  -3638,
+     -3645,  -3657,  -3671,  -3688,  -3708,  -3731,  -3757,  -3787,  -3818,  -3854,  -3892,  -3934,  -3978,  -4026,  -4076,  -4130,
+     -4187,  -4247,  -4310,  -4377,  -4445,  -4518,  -4593,  -4672,  -4753,  -4839,  -4926,  -5017,  -5110,  -5207,  -5306,  -5409,
+     -5513,  -5622,  -5732,  -5846,  -5962,  -6082,  -6203,  -6327,  -6454,  -6584,  -6715,  -6850,  -6986,  -7126,  -7267,  -7411,
+     -7556,  -7704,  -7854,  -8006,  -8160,  -8316,  -8473,  -8633,  -8794,  -8957,  -9121,  -9288,  -9454,  -9624,  -9793,  -9965,
+    -10137, -10311, -10486, -10662, -10838, -11016, -11193, -11372, -11551, -11732, -11912, -12093, -12273, -12455, -12636, -12818,
+    -12999, -13181, -13362, -13543, -13723, -13904, -14084, -14264, -14442, -14620, -14797, -14974, -15150, -15325, -15498, -15671,
+    -15842, -16013, -16181, -16349, -16515, -16680, -16843, -17004, -17164, -17322, -17478, -17633, -17785, -17935, -18084, -18230,
+    -18374, -18516, -18656, -18794, -18928, -19062, -19192, -19320, -19445, -19568, -19688, -19806, -19921, -20034, -20143, -20250,
+    -20354, -20456, -20554, -20650, -20743, -20834, -20920, -21005, -21086, -21165, -21240, -21313, -21383, -21450, -21513, -21574,
+    -21632, -21687, -21739, -21789, -21835, -21878, -21918, -21956, -21991, -22023, -22052, -22079, -22102, -22123, -22141, -22156,
+    -22169, -22179, -22187, -22192, -22194, -22194, -22192, -22187, -22180, -22171, -22159, -22145, -22129, -22111, -22090, -22068,
+    -22044, -22018, -21990, -21961, -21929, -21896, -21861, -21825, -21787, -21748, -21708, -21666, -21623, -21579, -21534, -21487,
+    -21440, -21392, -21343, -21294, -21243, -21192, -21141, -21089, -21037, -20984, -20931, -20878, -20825, -20772, -20719, -20666,
+    -20613, -20560, -20508, -20456, -20405, -20354, -20303, -20254, -20205, -20157, -20110, -20064, -20018, -19974, -19931, -19889,
+    -19849, -19810, -19772, -19735, -19700, -19667, -19635, -19605, -19577, -19550, -19526, -19503, -19482, -19463, -19446, -19431,
+    -19419, -19408, -19400, -19393, -19390, -19388, -19389, -19392, -19398, -19405, -19416, -19429, -19444, -19462, -19483, -19506,
+    -19532, -19560, -19591, -19624, -19661, -19699, -19741, -19785, -19832, -19881, -19934, -19988, -20046, -20106, -20169, -20234,
+    -20302, -20373, -20446, -20522, -20600, -20681, -20764, -20850, -20938, -21029, -21122, -21217, -21315, -21415, -21518, -21622,
+    -21729, -21837, -21949, -22061, -22177, -22293, -22412, -22533, -22656, -22780, -22906, -23033, -23163, -23293, -23426, -23559,
+    -23694, -23830, -23968, -24106, -24246, -24386, -24528, -24671, -24814, -24958, -25103, -25248, -25394, -25541, -25688, -25834,
+    -25982, -26129, -26277, -26424, -26572, -26719, -26867, -27013, -27160, -27306, -27452, -27597, -27742, -27885, -28028, -28170,
+    -28311, -28451, -28590, -28727, -28864, -28999, -29133, -29265, -29396, -29525, -29652, -29778, -29902, -30024, -30144, -30262,
+    -30378, -30492, -30604, -30713, -30821, -30925, -31028, -31127, -31225, -31319, -31412, -31501, -31588, -31672, -31753, -31831,
+    -31907, -31979, -32049, -32115, -32179, -32238, -32296, -32350, -32401, -32448, -32493, -32533, -32572, -32606, -32637, -32665,
+    -32690, -32710, -32729, -32742, -32754, -32761, -32765, -32766, -32764, -32757, -32748, -32734, -32719, -32699, -32676, -32649,
+    -32620, -32587, -32551, -32511, -32469, -32422, -32373, -32320, -32265, -32206, -32145, -32079, -32012, -31940, -31867, -31790,
+    -31711, -31628, -31543, -31454, -31365, -31271, -31176, -31077, -30977, -30873, -30768, -30659, -30550, -30437, -30323, -30206,
+    -30089, -29967, -29846, -29721, -29596, -29468, -29340, -29208, -29077, -28942, -28808, -28671, -28535, -28396, -28257, -28116,
+    -27976, -27832, -27691, -27546, -27403, -27257, -27113, -26967, -26822, -26675, -26530, -26382, -26237, -26089, -25944, -25797,
+    -25653, -25506, -25362, -25217, -25074, -24930, -24788, -24645, -24505, -24364, -24226, -24086, -23951, -23813, -23680, -23545,
+    -23414, -23282, -23154, -23025, -22900, -22773, -22652, -22529, -22410, -22291, -22176, -22061, -21950, -21838, -21731, -21623,
+    -21521, -21417, -21319, -21219, -21125, -21030, -20941, -20850, -20766, -20680, -20599, -20518, -20443, -20367, -20296, -20224,
+    -20159, -20092, -20031, -19969, -19913, -19856, -19805, -19753, -19707, -19659, -19618, -19575, -19539, -19501, -19469, -19436,
+    -19409, -19380, -19358, -19334, -19316, -19296, -19282, -19267, -19257, -19246, -19241, -19233, -19232, -19228, -19230, -19230,
+    -19236, -19240, -19249, -19256, -19268, -19278, -19293, -19306, -19324, -19339, -19360, -19377, -19401, -19420, -19445, -19467,
+    -19494, -19517, -19545, -19569, -19599, -19625, -19656, -19682, -19713, -19740, -19772, -19799, -19831, -19858, -19890, -19916,
+    -19948, -19974, -20005, -20029, -20059, -20083, -20112, -20134, -20161, -20181, -20207, -20225, -20248, -20264, -20285, -20298,
+    -20316, -20327, -20342, -20349, -20361, -20365, -20373, -20373, -20378, -20374, -20375, -20367, -20364, -20351, -20344, -20327,
+    -20314, -20292, -20275, -20248, -20226, -20194, -20167, -20129, -20096, -20053, -20015, -19966, -19922, -19867, -19818, -19757,
+    -19701, -19634, -19573, -19499, -19432, -19352, -19278, -19192, -19112, -19019, -18933, -18834, -18741, -18636, -18537, -18425,
+    -18319, -18201, -18089, -17964, -17846, -17714, -17589, -17451, -17321, -17176, -17039, -16888, -16746, -16588, -16440, -16276,
+    -16122, -15952, -15792, -15616, -15451, -15269, -15098, -14911, -14735, -14542, -14361, -14163, -13977, -13774, -13583, -13375,
+    -13180, -12967, -12768, -12550, -12347, -12126, -11919, -11693, -11483, -11253, -11040, -10807, -10590, -10354, -10135,  -9896,
+     -9675,  -9432,  -9209,  -8965,  -8740,  -8493,  -8267,  -8018,  -7791,  -7540,  -7312,  -7060,  -6832,  -6579,  -6351,  -6097,
+     -5869,  -5614,  -5387,  -5132,  -4906,  -4650,  -4426,  -4171,  -3948,  -3693,  -3472,  -3218,  -3000,  -2746,  -2531,  -2278,
+     -2067,  -1815,  -1607,  -1357,  -1153,   -904,   -705,   -456,   -263,    -16,    171,    418,    598,    844,   1017,   1263,
+      1427,   1674,   1828,   2077,   2219,   2472,   2598,   2860,   2965,   3242,   3316,   3621,   3643,   4016,   3907,   4541,
+    
+    // Level 1: 1024 samples, 511 harmonics
+      1669,    115,   1181,   1325,   2055,   2348,   2983,   3327,   3913,   4280,   4832,   5206,   5730,   6104,   6603,   6971,
+      7446,   7803,   8254,   8598,   9024,   9352,   9753,  10063,  10439,  10729,  11078,  11348,  11671,  11919,  12215,  12440,
+     12710,  12912,  13155,  13333,  13550,  13706,  13897,  14030,  14197,  14308,  14451,  14541,  14661,  14731,  14830,  14881,
+     14960,  14994,  15056,  15074,  15119,  15123,  15155,  15147,  15167,  15149,  15159,  15133,  15136,  15105,  15102,  15068,
+     15062,  15027,  15020,  14987,  14982,  14952,  14950,  14926,  14931,  14914,  14927,  14921,  14944,  14948,  14983,  15002,
+     15050,  15083,  15147,  15196,  15276,  15343,  15440,  15525,  15641,  15746,  15881,  16005,  16159,  16303,  16478,  16642,
+     16836,  17020,  17234,  17438,  17670,  17893,  18144,  18385,  18653,  18911,  19195,  19469,  19768,  20056,  20369,  20670,
+     20993,  21306,  21639,  21960,  22301,  22629,  22976,  23308,  23658,  23993,  24344,  24680,  25029,  25362,  25709,  26037,
+     26377,  26698,  27030,  27342,  27663,  27963,  28271,  28558,  28851,  29122,  29397,  29650,  29907,  30140,  30376,  30588,
+     30802,  30991,  31180,  31345,  31510,  31649,  31789,  31902,  32014,  32101,  32186,  32245,  32303,  32334,  32364,  32369,
+     32371,  32349,  32325,  32275,  32225,  32150,  32074,  31974,  31874,  31750,  31627,  31481,  31336,  31170,  31005,  30820,
+     30637,  30435,  30236,  30020,  29807,  29577,  29353,  29112,  28878,  28630,  28389,  28135,  27889,  27632,  27384,  27125,
+     26877,  26620,  26374,  26121,  25880,  25632,  25398,  25159,  24934,  24705,  24491,  24273,  24072,  23868,  23682,  23494,
+     23323,  23151,  22998,  22844,  22709,  22575,  22459,  22344,  22248,  22153,  22077,  22003,  21948,  21894,  21859,  21826,
+     21811,  21797,  21802,  21808,  21832,  21856,  21898,  21940,  21998,  22056,  22130,  22202,  22290,  22375,  22475,  22571,
+     22681,  22787,  22905,  23019,  23143,  23261,  23389,  23511,  23641,  23763,  23892,  24012,  24139,  24255,  24376,  24487,
+     24601,  24703,  24807,  24898,  24991,  25070,  25149,  25213,  25276,  25324,  25370,  25400,  25427,  25437,  25444,  25433,
+     25418,  25385,  25348,  25292,  25232,  25153,  25068,  24965,  24856,  24728,  24595,  24443,  24286,  24110,  23928,  23729,
+     23524,  23302,  23075,  22831,  22582,  22317,  22049,  21765,  21477,  21175,  20871,  20553,  20233,  19901,  19568,  19223,
+     18879,  18525,  18172,  17809,  17450,  17082,  16718,  16347,  15981,  15609,  15244,  14874,  14511,  14145,  13788,  13429,
+     13079,  12729,  12389,  12049,  11722,  11395,  11082,  10770,  10472,  10178,   9898,   9622,   9362,   9106,   8866,   8631,
+      8413,   8201,   8006,   7817,   7645,   7480,   7332,   7192,   7068,   6952,   6853,   6761,   6686,   6618,   6567,   6523,
+      6495,   6473,   6467,   6467,   6482,   6502,   6537,   6577,   6630,   6687,   6756,   6829,   6913,   7000,   7097,   7195,
+      7303,   7410,   7527,   7642,   7765,   7885,   8011,   8135,   8263,   8386,   8514,   8636,   8760,   8878,   8997,   9108,
+      9219,   9322,   9424,   9516,   9606,   9686,   9763,   9828,   9890,   9939,   9984,  10015,  10042,  10055,  10063,  10056,
+     10043,  10016,   9982,   9934,   9878,   9808,   9731,   9639,   9540,   9427,   9306,   9171,   9029,   8873,   8711,   8535,
+      8353,   8158,   7957,   7744,   7527,   7297,   7063,   6819,   6571,   6313,   6053,   5784,   5514,   5236,   4957,   4671,
+      4387,   4096,   3807,   3514,   3224,   2930,   2641,   2349,   2063,   1775,   1495,   1214,    940,    669,    405,    144,
+      -107,   -355,   -592,   -825,  -1047,  -1263,  -1466,  -1664,  -1848,  -2026,  -2190,  -2346,  -2488,  -2622,  -2742,  -2852,
+     -2948,  -3035,  -3107,  -3170,  -3217,  -3256,  -3279,  -3293,  -3292,  -3281,  -3257,  -3223,  -3175,  -3118,  -3048,  -2970,
+     -2878,  -2780,  -2668,  -2550,  -2421,  -2285,  -2139,  -1987,  -1826,  -1661,  -1487,  -1310,  -1125,   -938,   -745,   -551,
+      -351,   -152,     52,    254,    459,    661,    865,   1066,   1266,   1462,   1657,   1846,   2034,   2214,   2391,   2559,
+      2724,   2880,   3030,   3170,   3305,   3428,   3544,   3649,   3746,   3831,   3908,   3971,   4026,   4068,   4100,   4118,
+      4127,   4122,   4108,   4079,   4040,   3988,   3925,   3849,   3763,   3663,   3554,   3432,   3300,   3156,   3003,   2839,
+      2666,   2481,   2290,   2087,   1878,   1660,   1435,   1202,    964,    718,    468,    212,    -48,   -313,   -579,   -850,
+     -1122,  -1397,  -1672,  -1948,  -2223,  -2499,  -2772,  -3045,  -3314,  -3582,  -3844,  -4104,  -4358,  -4609,  -4852,  -5091,
+     -5322,  -5547,  -5764,  -5974,  -6174,  -6368,  -6551,  -6726,  -6890,  -7046,  -7191,  -7326,  -7450,  -7565,  -7667,  -7760,
+     -7841,  -7912,  -7971,  -8020,  -8057,  -8084,  -8100,  -8105,  -8100,  -8085,  -8059,  -8025,  -7980,  -7926,  -7863,  -7792,
+     -7712,  -7625,  -7530,  -7428,  -7320,  -7206,  -7085,  -6961,  -6831,  -6698,  -6561,  -6421,  -6279,  -6135,  -5990,  -5845,
+     -5699,  -5554,  -5410,  -5268,  -5129,  -4992,  -4859,  -4729,  -4605,  -4485,  -4372,  -4264,  -4164,  -4070,  -3985,  -3907,
+     -3838,  -3779,  -3728,  -3688,  -3658,  -3638,  -3629,  -3632,  -3646,  -3671,  -3708,  -3757,  -3819,  -3892,  -3978,  -4076,
+     -4187,  -4310,  -4446,  -4594,  -4754,  -4926,  -5110,  -5306,  -5514,  -5732,  -5962,  -6203,  -6454,  -6715,  -6986,  -7267,
+     -7556,  -7854,  -8160,  -8473,  -8794,  -9121,  -9455,  -9793, -10138, -10486, -10838, -11193, -11552, -11912, -12274, -12636,
+    -12999, -13362, -13724, -14084, -14442, -14797, -15150, -15498, -15843, -16181, -16515, -16842, -17164, -17478, -17785, -18083,
+    -18375, -18656, -18929, -19191, -19446, -19688, -19922, -20143, -20355, -20554, -20744, -20920, -21087, -21240, -21383, -21513,
+    -21633, -21739, -21835, -21918, -21991, -22052, -22102, -22140, -22170, -22186, -22195, -22192, -22181, -22158, -22129, -22090,
+    -22045, -21990, -21930, -21861, -21788, -21707, -21624, -21533, -21441, -21343, -21244, -21140, -21037, -20931, -20826, -20718,
+    -20613, -20507, -20405, -20303, -20206, -20109, -20019, -19930, -19849, -19771, -19701, -19635, -19578, -19525, -19483, -19445,
+    -19419, -19399, -19390, -19388, -19398, -19415, -19445, -19482, -19532, -19590, -19661, -19740, -19833, -19933, -20047, -20168,
+    -20303, -20445, -20601, -20763, -20939, -21121, -21316, -21517, -21730, -21948, -22177, -22411, -22657, -22905, -23164, -23424,
+    -23695, -23967, -24247, -24527, -24815, -25102, -25395, -25686, -25983, -26276, -26573, -26866, -27161, -27451, -27743, -28027,
+    -28312, -28588, -28865, -29131, -29397, -29651, -29903, -30143, -30379, -30602, -30822, -31026, -31226, -31410, -31589, -31752,
+    -31908, -32047, -32180, -32294, -32402, -32491, -32573, -32636, -32691, -32727, -32755, -32764, -32765, -32746, -32720, -32674,
+    -32621, -32549, -32470, -32371, -32266, -32142, -32013, -31865, -31712, -31541, -31366, -31174, -30978, -30766, -30552, -30321,
+    -30090, -29844, -29598, -29337, -29078, -28806, -28537, -28255, -27977, -27688, -27405, -27111, -26823, -26527, -26238, -25942,
+    -25654, -25360, -25076, -24785, -24507, -24223, -23952, -23677, -23416, -23151, -22901, -22648, -22412, -22173, -21952, -21728,
+    -21523, -21315, -21127, -20937, -20767, -20596, -20445, -20292, -20161, -20027, -19915, -19801, -19709, -19614, -19541, -19465,
+    -19411, -19354, -19318, -19278, -19260, -19236, -19234, -19226, -19239, -19245, -19271, -19289, -19327, -19355, -19403, -19441,
+    -19496, -19540, -19602, -19650, -19716, -19767, -19834, -19884, -19951, -19999, -20062, -20106, -20164, -20201, -20251, -20279,
+    -20319, -20336, -20364, -20367, -20381, -20369, -20367, -20337, -20318, -20268, -20230, -20159, -20100, -20007, -19926, -19810,
+    -19705, -19564, -19436, -19270, -19116, -18924, -18746, -18528, -18324, -18079, -17850, -17579, -17325, -17029, -16750, -16429,
+    -16127, -15780, -15456, -15086, -14740, -14348, -13983, -13569, -13186, -12753, -12354, -11904, -11489, -11024, -10598, -10118,
+     -9682,  -9191,  -8748,  -8247,  -7799,  -7291,  -6842,  -6328,  -5879,  -5362,  -4917,  -4398,  -3960,  -3442,  -3014,  -2497,
+     -2082,  -1569,  -1171,   -660,   -284,    224,    573,   1082,   1396,   1912,   2178,   2716,   2904,   3511,   3527,   4442,
+    
+    // Level 2: 512 samples, 255 harmonics
+      1961,    584,   2163,   2767,   3970,   4701,   5769,   6509,   7474,   8180,   9047,   9693,  10458,  11027,  11687,  12170,
+     12724,  13115,  13563,  13862,  14209,  14419,  14672,  14801,  14970,  15029,  15128,  15130,  15175,  15135,  15143,  15080,
+     15069,  15000,  14988,  14931,  14937,  14909,  14950,  14966,  15056,  15130,  15281,  15424,  15646,  15865,  16164,  16463,
+     16841,  17220,  17674,  18130,  18657,  19182,  19772,  20356,  20997,  21627,  22305,  22964,  23662,  24333,  25033,  25698,
+     26380,  27019,  27666,  28261,  28854,  29387,  29910,  30367,  30805,  31171,  31513,  31779,  32017,  32177,  32305,  32356,
+     32374,  32316,  32227,  32065,  31876,  31619,  31339,  30997,  30640,  30229,  29809,  29345,  28881,  28382,  27891,  27376,
+     26879,  26367,  25882,  25391,  24936,  24484,  24074,  23675,  23325,  22991,  22711,  22452,  22249,  22071,  21949,  21853,
+     21813,  21796,  21834,  21892,  22000,  22124,  22291,  22469,  22683,  22900,  23144,  23384,  23642,  23887,  24140,  24371,
+     24602,  24802,  24992,  25144,  25278,  25365,  25428,  25439,  25420,  25343,  25233,  25063,  24857,  24590,  24287,  23924,
+     23525,  23071,  22584,  22045,  21479,  20867,  20234,  19564,  18881,  18168,  17451,  16714,  15982,  15240,  14512,  13784,
+     13080,  12385,  11723,  11078,  10473,   9894,   9362,   8862,   8414,   8002,   7646,   7329,   7069,   6850,   6687,   6564,
+      6496,   6464,   6483,   6534,   6631,   6753,   6914,   7094,   7303,   7524,   7765,   8009,   8263,   8511,   8761,   8994,
+      9220,   9421,   9607,   9760,   9890,   9981,  10043,  10060,  10044,   9980,   9879,   9729,   9541,   9304,   9030,   8709,
+      8354,   7955,   7527,   7061,   6572,   6051,   5514,   4955,   4387,   3805,   3224,   2639,   2063,   1492,    941,    403,
+      -107,   -594,  -1046,  -1468,  -1848,  -2192,  -2488,  -2743,  -2948,  -3109,  -3217,  -3280,  -3291,  -3258,  -3175,  -3050,
+     -2878,  -2670,  -2421,  -2140,  -1826,  -1488,  -1125,   -746,   -351,     50,    459,    864,   1266,   1656,   2034,   2389,
+      2724,   3029,   3305,   3543,   3746,   3907,   4026,   4099,   4127,   4107,   4040,   3924,   3763,   3553,   3300,   3003,
+      2666,   2289,   1878,   1435,    964,    467,    -48,   -580,  -1122,  -1672,  -2223,  -2773,  -3314,  -3845,  -4359,  -4853,
+     -5322,  -5764,  -6175,  -6551,  -6891,  -7191,  -7451,  -7667,  -7841,  -7971,  -8057,  -8100,  -8100,  -8059,  -7980,  -7863,
+     -7712,  -7529,  -7320,  -7085,  -6832,  -6561,  -6280,  -5990,  -5700,  -5410,  -5129,  -4858,  -4605,  -4371,  -4164,  -3984,
+     -3839,  -3728,  -3658,  -3629,  -3646,  -3707,  -3819,  -3977,  -4188,  -4445,  -4754,  -5109,  -5514,  -5961,  -6455,  -6986,
+     -7557,  -8159,  -8795,  -9454, -10138, -10837, -11553, -12273, -13000, -13723, -14443, -15149, -15843, -16514, -17165, -17784,
+    -18375, -18927, -19446, -19920, -20356, -20742, -21088, -21381, -21634, -21833, -21992, -22100, -22171, -22193, -22182, -22127,
+    -22046, -21927, -21789, -21621, -21442, -21241, -21038, -20823, -20615, -20403, -20207, -20016, -19851, -19698, -19579, -19480,
+    -19421, -19387, -19400, -19442, -19534, -19658, -19834, -20044, -20304, -20597, -20941, -21313, -21731, -22174, -22658, -23160,
+    -23697, -24243, -24817, -25391, -25985, -26569, -27163, -27738, -28314, -28861, -29399, -29899, -30381, -30817, -31228, -31585,
+    -31910, -32175, -32404, -32568, -32693, -32750, -32767, -32715, -32624, -32464, -32269, -32007, -31715, -31360, -30981, -30545,
+    -30093, -29591, -29081, -28530, -27980, -27398, -26826, -26231, -25657, -25068, -24510, -23945, -23419, -22893, -22415, -21943,
+    -21526, -21118, -20771, -20436, -20164, -19906, -19713, -19531, -19415, -19308, -19264, -19223, -19243, -19259, -19331, -19391,
+    -19501, -19590, -19721, -19821, -19956, -20049, -20169, -20237, -20325, -20349, -20387, -20351, -20324, -20212, -20107, -19907,
+    -19712, -19416, -19124, -18725, -18332, -17827, -17334, -16726, -16136, -15429, -14751, -13953, -13197, -12321, -11502, -10561,
+     -9696,  -8706,  -7816,  -6793,  -5898,  -4859,  -3983,  -2943,  -2111,  -1079,   -322,    702,   1341,   2390,   2799,   4113,
+    
+    // Level 3: 256 samples, 127 harmonics
+      2132,   1547,   4078,   5547,   7531,   8912,  10495,  11591,  12752,  13488,  14231,  14610,  14989,  15076,  15191,  15098,
+     15083,  14948,  14950,  14914,  15067,  15249,  15657,  16134,  16850,  17647,  18666,  19747,  21005,  22281,  23669,  25011,
+     26387,  27646,  28861,  29891,  30811,  31495,  32023,  32288,  32380,  32211,  31881,  31323,  30645,  29794,  28885,  27877,
+     26884,  25869,  24940,  24061,  23329,  22699,  22253,  21938,  21816,  21823,  22003,  22281,  22686,  23134,  23645,  24130,
+     24605,  24983,  25280,  25419,  25422,  25224,  24860,  24279,  23528,  22576,  21481,  20227,  18883,  17444,  15984,  14505,
+     13082,  11716,  10475,   9356,   8416,   7640,   7071,   6681,   6497,   6477,   6632,   6909,   7305,   7760,   8265,   8756,
+      9221,   9602,   9891,  10038,  10045,   9875,   9542,   9026,   8355,   7523,   6573,   5511,   4388,   3221,   2064,    938,
+      -106,  -1049,  -1847,  -2491,  -2947,  -3220,  -3291,  -3177,  -2878,  -2423,  -1826,  -1127,   -351,    457,   1267,   2032,
+      2724,   3303,   3746,   4025,   4127,   4039,   3763,   3300,   2666,   1878,    964,    -48,  -1123,  -2224,  -3315,  -4358,
+     -5322,  -6174,  -6891,  -7450,  -7842,  -8056,  -8101,  -7979,  -7713,  -7319,  -6832,  -6278,  -5700,  -5127,  -4606,  -4162,
+     -3840,  -3656,  -3647,  -3817,  -4189,  -4752,  -5515,  -6452,  -7558,  -8792, -10140, -11549, -13002, -14440, -15845, -17161,
+    -18377, -19442, -20358, -21083, -21635, -21988, -22173, -22176, -22048, -21783, -21444, -21033, -20617, -20201, -19853, -19572,
+    -19423, -19393, -19537, -19827, -20307, -20933, -21734, -22650, -23700, -24808, -25988, -27154, -28317, -29389, -30385, -31218,
+    -31914, -32393, -32697, -32755, -32628, -32256, -31719, -30967, -30098, -29067, -27985, -26811, -25663, -24493, -23425, -22398,
+    -21532, -20752, -20171, -19692, -19423, -19241, -19251, -19307, -19510, -19694, -19965, -20140, -20336, -20354, -20336, -20069,
+    -19726, -19081, -18347, -17285, -16155, -14692, -13219, -11430,  -9724,  -7723,  -5935,  -3852,  -2165,   -106,   1238,   3394,
+    
+    // Level 4: 128 samples, 63 harmonics
+      2267,   3445,   7642,  10268,  12811,  14094,  15028,  15093,  15113,  14873,  15090,  15594,  16869,  18613,  21022,  23624,
+     26402,  28821,  30824,  31987,  32391,  31849,  30655,  28857,  26893,  24914,  23337,  22230,  21824,  21981,  22693,  23625,
+     24612,  25262,  25428,  24843,  23533,  21466,  18888,  15970,  13087,  10462,   8420,   7059,   6501,   6621,   7308,   8255,
+      9224,   9883,  10048,   9534,   8357,   6566,   4390,   2058,   -104,  -1853,  -2946,  -3295,  -2876,  -1829,   -349,   1264,
+      2725,   3744,   4128,   3762,   2666,    963,  -1123,  -3314,  -5323,  -6890,  -7842,  -8099,  -7714,  -6829,  -5702,  -4602,
+     -3841,  -3642,  -4191,  -5510,  -7560, -10133, -13004, -15837, -18380, -20348, -21639, -22162, -22052, -21432, -20621, -19840,
+    -19428, -19522, -20313, -21717, -23706, -25969, -28324, -30364, -31922, -32673, -32637, -31692, -30107, -27955, -25674, -23390,
+    -21545, -20131, -19437, -19203, -19527, -19908, -20357, -20265, -19753, -18255, -16191, -13089,  -9778,  -5719,  -2266,   1830,
+    
+    // Level 5: 64 samples, 31 harmonics
+      2441,   6969,  12938,  14786,  15179,  14944,  16914,  20918,  26435,  30743,  32418,  30590,  26915,  23284,  21843,  22648,
+     24627,  25390,  23547,  18855,  13099,   8393,   6511,   7285,   9233,  10029,   8364,   4375,    -98,  -2958,  -2872,   -358,
+      2729,   4123,   2668,  -1124,  -5322,  -7840,  -7714,  -5696,  -3843,  -4181,  -7564, -12990, -18385, -21620, -22058, -20597,
+    -19437, -20282, -23717, -28285, -31936, -32586, -30126, -25608, -21570, -19349, -19563, -20229, -19807, -15975,  -9879,  -1683,
+    
+    // Level 6: 64 samples, 16 harmonics
+      2741,   7563,  12159,  15031,  15336,  14949,  16650,  21083,  26500,  30709,  32275,  30719,  26945,  23240,  21756,  22756,
+     24639,  25343,  23494,  18949,  13097,   8343,   6482,   7368,   9222,   9978,   8355,   4447,   -117,  -3009,  -2864,   -294,
+      2703,   4072,   2692,  -1070,  -5355,  -7892,  -7673,  -5651,  -3883,  -4232,  -7504, -12957, -18434, -21670, -21976, -20579,
+    -19496, -20330, -23604, -28290, -32011, -32632, -29965, -25654, -21670, -19384, -19303, -20378, -19957, -15964,  -9261,  -2592,
+    
+    // Level 7: 64 samples, 8 harmonics
+      4121,  10343,  13422,  13786,  13244,  13921,  17032,  22190,  27641,  31271,  31807,  29512,  25997,  23264,  22555,  23671,
+     25148,  25173,  22691,  18052,  12820,   8878,   7340,   7938,   9214,   9416,   7547,   3958,    131,  -2217,  -2163,   -147,
+      2278,   3340,   2083,  -1096,  -4701,  -7052,  -7303,  -5963,  -4602,  -4926,  -7751, -12497, -17508, -21002, -22106, -21352,
+    -20339, -20755, -23327, -27339, -30992, -32432, -30825, -26854, -22342, -19193, -18271, -18876, -19124, -17043, -11744,  -3999,
+    
+    // Level 8: 64 samples, 4 harmonics
+       622,   4753,   8743,  12504,  15958,  19043,  21707,  23915,  25646,  26889,  27646,  27928,  27755,  27157,  26169,  24836,
+     23209,  21345,  19307,  17160,  14974,  12812,  10736,   8801,   7048,   5508,   4195,   3108,   2231,   1535,    979,    514,
+        87,   -356,   -867,  -1490,  -2263,  -3211,  -4353,  -5692,  -7225,  -8936, -10802, -12793, -14868, -16984, -19087, -21121,
+    -23023, -24728, -26168, -27275, -27985, -28240, -27993, -27209, -25871, -23981, -21560, -18649, -15310, -11619,  -7666,  -3552,
+    
+    // Level 9: 64 samples, 2 harmonics
+       318,   4404,   8392,  12194,  15728,  18918,  21701,  24027,  25858,  27172,  27964,  28240,  28024,  27352,  26271,  24838,
+     23119,  21181,  19096,  16933,  14760,  12638,  10620,   8749,   7059,   5569,   4288,   3213,   2328,   1609,   1021,    522,
+        68,   -391,   -901,  -1507,  -2251,  -3165,  -4273,  -5588,  -7112,  -8836, -10736, -12778, -14918, -17100, -19263, -21339,
+    -23258, -24948, -26341, -27374, -27990, -28144, -27802, -26942, -25558, -23659, -21269, -18428, -15188, -11614,  -7782,  -3775,
+    
+    // Level 10: 64 samples, 1 harmonics
+       187,   2459,   4708,   6912,   9051,  11103,  13048,  14869,  16547,  18066,  19411,  20571,  21533,  22288,  22829,  23150,
+     23250,  23126,  22780,  22215,  21437,  20453,  19272,  17907,  16370,  14675,  12840,  10882,   8820,   6673,   4463,   2210,
+       -63,  -2336,  -4585,  -6789,  -8928, -10980, -12925, -14746, -16423, -17942, -19288, -20448, -21409, -22164, -22705, -23027,
+    -23127, -23003, -22657, -22092, -21314, -20330, -19149, -17784, -16247, -14552, -12717, -10759,  -8697,  -6550,  -4340,  -2087,
     
 };
 
-alignas(4) const float waveform_Clav[4096] = {
-    0.95700611f, 0.95693582f, 0.95672509f, 0.95637432f, 0.95588423f, 0.95525576f, 0.95449017f, 0.95358896f,
-    0.95255391f, 0.95138708f, 0.95009077f, 0.94866754f, 0.94712021f, 0.94545185f, 0.94366577f, 0.94176551f,
-    0.93975484f, 0.93763777f, 0.93541850f, 0.93310146f, 0.93069128f, 0.92819276f, 0.92561091f, 0.92295090f,
-    0.92021806f, 0.91741789f, 0.91455603f, 0.91163825f, 0.90867046f, 0.90565865f, 0.90260895f, 0.89952757f,
-    0.89642079f, 0.89329498f, 0.89015653f, 0.88701192f, 0.88386764f, 0.88073020f, 0.87760613f, 0.87450194f,
-    0.87142416f, 0.86837924f, 0.86537365f, 0.86241377f, 0.85950592f, 0.85665636f, 0.85387126f, 0.85115668f,
-    0.84851858f, 0.84596279f, 0.84349502f, 0.84112083f, 0.83884562f, 0.83667463f, 0.83461292f, 0.83266536f,
-    0.83083664f, 0.82913123f, 0.82755340f, 0.82610717f, 0.82479635f, 0.82362451f, 0.82259496f, 0.82171075f,
-    0.82097470f, 0.82038933f, 0.81995688f, 0.81967933f, 0.81955837f, 0.81959539f, 0.81979149f, 0.82014747f,
-    0.82066381f, 0.82134072f, 0.82217808f, 0.82317545f, 0.82433210f, 0.82564697f, 0.82711869f, 0.82874560f,
-    0.83052569f, 0.83245666f, 0.83453591f, 0.83676051f, 0.83912724f, 0.84163257f, 0.84427268f, 0.84704345f,
-    0.84994047f, 0.85295905f, 0.85609423f, 0.85934075f, 0.86269310f, 0.86614553f, 0.86969200f, 0.87332625f,
-    0.87704178f, 0.88083187f, 0.88468956f, 0.88860770f, 0.89257893f, 0.89659571f, 0.90065031f, 0.90473484f,
-    0.90884125f, 0.91296135f, 0.91708680f, 0.92120915f, 0.92531985f, 0.92941021f, 0.93347151f, 0.93749491f,
-    0.94147153f, 0.94539244f, 0.94924867f, 0.95303124f, 0.95673115f, 0.96033940f, 0.96384702f, 0.96724507f,
-    0.97052464f, 0.97367689f, 0.97669304f, 0.97956441f, 0.98228239f, 0.98483851f, 0.98722440f, 0.98943182f,
-    0.99145270f, 0.99327910f, 0.99490328f, 0.99631767f, 0.99751487f, 0.99848773f, 0.99922928f, 0.99973280f,
-    0.99999179f, 1.00000000f, 0.99975145f, 0.99924042f, 0.99846146f, 0.99740940f, 0.99607937f, 0.99446681f,
-    0.99256744f, 0.99037732f, 0.98789282f, 0.98511062f, 0.98202777f, 0.97864161f, 0.97494987f, 0.97095059f,
-    0.96664217f, 0.96202337f, 0.95709329f, 0.95185140f, 0.94629753f, 0.94043185f, 0.93425492f, 0.92776763f,
-    0.92097125f, 0.91386741f, 0.90645808f, 0.89874561f, 0.89073269f, 0.88242234f, 0.87381797f, 0.86492330f,
-    0.85574239f, 0.84627966f, 0.83653983f, 0.82652795f, 0.81624939f, 0.80570983f, 0.79491525f, 0.78387193f,
-    0.77258642f, 0.76106556f, 0.74931648f, 0.73734652f, 0.72516333f, 0.71277475f, 0.70018890f, 0.68741407f,
-    0.67445880f, 0.66133182f, 0.64804203f, 0.63459853f, 0.62101058f, 0.60728758f, 0.59343909f, 0.57947478f,
-    0.56540446f, 0.55123802f, 0.53698545f, 0.52265683f, 0.50826229f, 0.49381203f, 0.47931628f, 0.46478529f,
-    0.45022935f, 0.43565871f, 0.42108366f, 0.40651443f, 0.39196123f, 0.37743421f, 0.36294347f, 0.34849902f,
-    0.33411081f, 0.31978867f, 0.30554232f, 0.29138138f, 0.27731531f, 0.26335344f, 0.24950496f, 0.23577885f,
-    0.22218397f, 0.20872895f, 0.19542223f, 0.18227208f, 0.16928651f, 0.15647333f, 0.14384012f, 0.13139420f,
-    0.11914267f, 0.10709235f, 0.09524982f, 0.08362136f, 0.07221301f, 0.06103050f, 0.05007931f, 0.03936458f,
-    0.02889120f, 0.01866373f, 0.00868645f, -0.00103669f, -0.01050203f, -0.01970622f, -0.02864625f, -0.03731938f,
-    -0.04572323f, -0.05385570f, -0.06171503f, -0.06929977f, -0.07660878f, -0.08364122f, -0.09039660f, -0.09687469f,
-    -0.10307561f, -0.10899975f, -0.11464783f, -0.12002084f, -0.12512009f, -0.12994716f, -0.13450390f, -0.13879248f,
-    -0.14281529f, -0.14657503f, -0.15007465f, -0.15331733f, -0.15630651f, -0.15904589f, -0.16153938f, -0.16379111f,
-    -0.16580545f, -0.16758694f, -0.16914037f, -0.17047067f, -0.17158300f, -0.17248265f, -0.17317510f, -0.17366597f,
-    -0.17396105f, -0.17406624f, -0.17398757f, -0.17373120f, -0.17330338f, -0.17271046f, -0.17195890f, -0.17105519f,
-    -0.17000594f, -0.16881776f, -0.16749736f, -0.16605146f, -0.16448681f, -0.16281016f, -0.16102831f, -0.15914801f,
-    -0.15717604f, -0.15511913f, -0.15298399f, -0.15077729f, -0.14850565f, -0.14617564f, -0.14379375f, -0.14136641f,
-    -0.13889995f, -0.13640065f, -0.13387463f, -0.13132796f, -0.12876657f, -0.12619628f, -0.12362277f, -0.12105160f,
-    -0.11848818f, -0.11593780f, -0.11340557f, -0.11089647f, -0.10841528f, -0.10596666f, -0.10355508f, -0.10118482f,
-    -0.09886002f, -0.09658462f, -0.09436235f, -0.09219680f, -0.09009135f, -0.08804917f, -0.08607327f, -0.08416646f,
-    -0.08233132f, -0.08057029f, -0.07888556f, -0.07727916f, -0.07575291f, -0.07430844f, -0.07294717f, -0.07167035f,
-    -0.07047902f, -0.06937402f, -0.06835604f, -0.06742555f, -0.06658284f, -0.06582803f, -0.06516106f, -0.06458170f,
-    -0.06408953f, -0.06368398f, -0.06336431f, -0.06312963f, -0.06297890f, -0.06291091f, -0.06292431f, -0.06301764f,
-    -0.06318926f, -0.06343744f, -0.06376031f, -0.06415587f, -0.06462204f, -0.06515661f, -0.06575727f, -0.06642163f,
-    -0.06714719f, -0.06793140f, -0.06877160f, -0.06966509f, -0.07060910f, -0.07160078f, -0.07263726f, -0.07371561f,
-    -0.07483287f, -0.07598604f, -0.07717212f, -0.07838805f, -0.07963079f, -0.08089729f, -0.08218448f, -0.08348933f,
-    -0.08480878f, -0.08613982f, -0.08747944f, -0.08882469f, -0.09017261f, -0.09152032f, -0.09286497f, -0.09420374f,
-    -0.09553388f, -0.09685271f, -0.09815760f, -0.09944599f, -0.10071538f, -0.10196336f, -0.10318759f, -0.10438583f,
-    -0.10555589f, -0.10669571f, -0.10780330f, -0.10887675f, -0.10991428f, -0.11091419f, -0.11187488f, -0.11279485f,
-    -0.11367271f, -0.11450719f, -0.11529710f, -0.11604138f, -0.11673906f, -0.11738928f, -0.11799131f, -0.11854452f,
-    -0.11904837f, -0.11950245f, -0.11990645f, -0.12026017f, -0.12056352f, -0.12081650f, -0.12101923f, -0.12117192f,
-    -0.12127489f, -0.12132856f, -0.12133343f, -0.12129012f, -0.12119931f, -0.12106180f, -0.12087846f, -0.12065024f,
-    -0.12037819f, -0.12006342f, -0.11970712f, -0.11931055f, -0.11887503f, -0.11840198f, -0.11789283f, -0.11734910f,
-    -0.11677235f, -0.11616421f, -0.11552632f, -0.11486040f, -0.11416817f, -0.11345142f, -0.11271195f, -0.11195159f,
-    -0.11117219f, -0.11037561f, -0.10956375f, -0.10873850f, -0.10790176f, -0.10705542f, -0.10620139f, -0.10534156f,
-    -0.10447782f, -0.10361205f, -0.10274608f, -0.10188176f, -0.10102091f, -0.10016530f, -0.09931668f, -0.09847678f,
-    -0.09764727f, -0.09682981f, -0.09602598f, -0.09523735f, -0.09446541f, -0.09371162f, -0.09297739f, -0.09226405f,
-    -0.09157290f, -0.09090516f, -0.09026199f, -0.08964451f, -0.08905374f, -0.08849066f, -0.08795617f, -0.08745111f,
-    -0.08697624f, -0.08653225f, -0.08611977f, -0.08573934f, -0.08539145f, -0.08507650f, -0.08479482f, -0.08454667f,
-    -0.08433224f, -0.08415165f, -0.08400494f, -0.08389207f, -0.08381296f, -0.08376744f, -0.08375527f, -0.08377615f,
-    -0.08382971f, -0.08391552f, -0.08403308f, -0.08418184f, -0.08436118f, -0.08457042f, -0.08480884f, -0.08507564f,
-    -0.08537000f, -0.08569104f, -0.08603780f, -0.08640933f, -0.08680460f, -0.08722255f, -0.08766208f, -0.08812207f,
-    -0.08860134f, -0.08909871f, -0.08961296f, -0.09014283f, -0.09068708f, -0.09124441f, -0.09181352f, -0.09239311f,
-    -0.09298186f, -0.09357843f, -0.09418149f, -0.09478971f, -0.09540175f, -0.09601630f, -0.09663201f, -0.09724760f,
-    -0.09786174f, -0.09847316f, -0.09908058f, -0.09968277f, -0.10027848f, -0.10086652f, -0.10144571f, -0.10201490f,
-    -0.10257298f, -0.10311886f, -0.10365150f, -0.10416987f, -0.10467301f, -0.10515999f, -0.10562991f, -0.10608192f,
-    -0.10651522f, -0.10692905f, -0.10732271f, -0.10769552f, -0.10804688f, -0.10837622f, -0.10868303f, -0.10896686f,
-    -0.10922728f, -0.10946394f, -0.10967655f, -0.10986484f, -0.11002862f, -0.11016774f, -0.11028212f, -0.11037171f,
-    -0.11043652f, -0.11047663f, -0.11049213f, -0.11048320f, -0.11045006f, -0.11039296f, -0.11031223f, -0.11020822f,
-    -0.11008133f, -0.10993201f, -0.10976077f, -0.10956813f, -0.10935467f, -0.10912101f, -0.10886779f, -0.10859571f,
-    -0.10830549f, -0.10799788f, -0.10767366f, -0.10733366f, -0.10697872f, -0.10660969f, -0.10622746f, -0.10583296f,
-    -0.10542710f, -0.10501082f, -0.10458510f, -0.10415089f, -0.10370919f, -0.10326097f, -0.10280725f, -0.10234902f,
-    -0.10188727f, -0.10142303f, -0.10095727f, -0.10049101f, -0.10002523f, -0.09956091f, -0.09909902f, -0.09864052f,
-    -0.09818636f, -0.09773746f, -0.09729473f, -0.09685908f, -0.09643135f, -0.09601241f, -0.09560307f, -0.09520413f,
-    -0.09481636f, -0.09444049f, -0.09407725f, -0.09372729f, -0.09339128f, -0.09306982f, -0.09276349f, -0.09247282f,
-    -0.09219833f, -0.09194047f, -0.09169968f, -0.09147634f, -0.09127081f, -0.09108340f, -0.09091437f, -0.09076395f,
-    -0.09063234f, -0.09051969f, -0.09042609f, -0.09035161f, -0.09029629f, -0.09026011f, -0.09024300f, -0.09024489f,
-    -0.09026564f, -0.09030507f, -0.09036297f, -0.09043910f, -0.09053317f, -0.09064486f, -0.09077383f, -0.09091967f,
-    -0.09108197f, -0.09126028f, -0.09145411f, -0.09166296f, -0.09188627f, -0.09212348f, -0.09237400f, -0.09263722f,
-    -0.09291248f, -0.09319913f, -0.09349650f, -0.09380388f, -0.09412055f, -0.09444579f, -0.09477885f, -0.09511899f,
-    -0.09546542f, -0.09581739f, -0.09617412f, -0.09653481f, -0.09689868f, -0.09726494f, -0.09763280f, -0.09800147f,
-    -0.09837018f, -0.09873813f, -0.09910456f, -0.09946869f, -0.09982979f, -0.10018710f, -0.10053988f, -0.10088743f,
-    -0.10122904f, -0.10156402f, -0.10189172f, -0.10221147f, -0.10252266f, -0.10282467f, -0.10311693f, -0.10339888f,
-    -0.10366999f, -0.10392975f, -0.10417767f, -0.10441331f, -0.10463625f, -0.10484609f, -0.10504246f, -0.10522503f,
-    -0.10539350f, -0.10554760f, -0.10568708f, -0.10581175f, -0.10592142f, -0.10601596f, -0.10609524f, -0.10615921f,
-    -0.10620780f, -0.10624102f, -0.10625887f, -0.10626142f, -0.10624874f, -0.10622096f, -0.10617822f, -0.10612070f,
-    -0.10604860f, -0.10596217f, -0.10586166f, -0.10574738f, -0.10561964f, -0.10547880f, -0.10532522f, -0.10515930f,
-    -0.10498147f, -0.10479216f, -0.10459185f, -0.10438102f, -0.10416018f, -0.10392984f, -0.10369055f, -0.10344287f,
-    -0.10318737f, -0.10292463f, -0.10265524f, -0.10237982f, -0.10209898f, -0.10181335f, -0.10152355f, -0.10123021f,
-    -0.10093399f, -0.10063552f, -0.10033545f, -0.10003441f, -0.09973305f, -0.09943202f, -0.09913193f, -0.09883343f,
-    -0.09853713f, -0.09824365f, -0.09795360f, -0.09766756f, -0.09738613f, -0.09710986f, -0.09683933f, -0.09657506f,
-    -0.09631759f, -0.09606741f, -0.09582503f, -0.09559091f, -0.09536549f, -0.09514923f, -0.09494251f, -0.09474573f,
-    -0.09455925f, -0.09438340f, -0.09421852f, -0.09406488f, -0.09392275f, -0.09379237f, -0.09367396f, -0.09356770f,
-    -0.09347376f, -0.09339226f, -0.09332332f, -0.09326702f, -0.09322341f, -0.09319252f, -0.09317434f, -0.09316886f,
-    -0.09317601f, -0.09319571f, -0.09322787f, -0.09327234f, -0.09332898f, -0.09339760f, -0.09347799f, -0.09356992f,
-    -0.09367315f, -0.09378740f, -0.09391236f, -0.09404773f, -0.09419315f, -0.09434829f, -0.09451275f, -0.09468615f,
-    -0.09486807f, -0.09505808f, -0.09525575f, -0.09546062f, -0.09567222f, -0.09589007f, -0.09611368f, -0.09634254f,
-    -0.09657616f, -0.09681400f, -0.09705555f, -0.09730028f, -0.09754765f, -0.09779713f, -0.09804819f, -0.09830028f,
-    -0.09855286f, -0.09880541f, -0.09905738f, -0.09930825f, -0.09955748f, -0.09980458f, -0.10004901f, -0.10029027f,
-    -0.10052788f, -0.10076135f, -0.10099020f, -0.10121397f, -0.10143221f, -0.10164449f, -0.10185039f, -0.10204949f,
-    -0.10224142f, -0.10242580f, -0.10260228f, -0.10277052f, -0.10293020f, -0.10308102f, -0.10322271f, -0.10335502f,
-    -0.10347770f, -0.10359053f, -0.10369334f, -0.10378594f, -0.10386819f, -0.10393995f, -0.10400114f, -0.10405166f,
-    -0.10409146f, -0.10412050f, -0.10413878f, -0.10414629f, -0.10414308f, -0.10412920f, -0.10410473f, -0.10406976f,
-    -0.10402442f, -0.10396885f, -0.10390321f, -0.10382769f, -0.10374250f, -0.10364785f, -0.10354398f, -0.10343116f,
-    -0.10330967f, -0.10317980f, -0.10304186f, -0.10289619f, -0.10274311f, -0.10258300f, -0.10241621f, -0.10224313f,
-    -0.10206415f, -0.10187968f, -0.10169013f, -0.10149593f, -0.10129750f, -0.10109528f, -0.10088972f, -0.10068126f,
-    -0.10047036f, -0.10025748f, -0.10004307f, -0.09982759f, -0.09961151f, -0.09939528f, -0.09917936f, -0.09896420f,
-    -0.09875026f, -0.09853799f, -0.09832782f, -0.09812019f, -0.09791553f, -0.09771425f, -0.09751678f, -0.09732351f,
-    -0.09713483f, -0.09695113f, -0.09677276f, -0.09660009f, -0.09643345f, -0.09627318f, -0.09611958f, -0.09597295f,
-    -0.09583357f, -0.09570171f, -0.09557762f, -0.09546152f, -0.09535363f, -0.09525414f, -0.09516323f, -0.09508105f,
-    -0.09500774f, -0.09494343f, -0.09488821f, -0.09484216f, -0.09480533f, -0.09477778f, -0.09475952f, -0.09475056f,
-    -0.09475086f, -0.09476041f, -0.09477913f, -0.09480695f, -0.09484378f, -0.09488951f, -0.09494399f, -0.09500709f,
-    -0.09507862f, -0.09515842f, -0.09524627f, -0.09534197f, -0.09544527f, -0.09555592f, -0.09567367f, -0.09579824f,
-    -0.09592934f, -0.09606666f, -0.09620989f, -0.09635870f, -0.09651277f, -0.09667173f, -0.09683524f, -0.09700294f,
-    -0.09717445f, -0.09734939f, -0.09752739f, -0.09770805f, -0.09789098f, -0.09807579f, -0.09826208f, -0.09844945f,
-    -0.09863750f, -0.09882582f, -0.09901403f, -0.09920172f, -0.09938850f, -0.09957397f, -0.09975775f, -0.09993947f,
-    -0.10011873f, -0.10029517f, -0.10046843f, -0.10063816f, -0.10080401f, -0.10096563f, -0.10112272f, -0.10127495f,
-    -0.10142202f, -0.10156363f, -0.10169951f, -0.10182939f, -0.10195302f, -0.10207017f, -0.10218060f, -0.10228411f,
-    -0.10238050f, -0.10246960f, -0.10255125f, -0.10262530f, -0.10269162f, -0.10275010f, -0.10280065f, -0.10284318f,
-    -0.10287764f, -0.10290398f, -0.10292217f, -0.10293222f, -0.10293411f, -0.10292789f, -0.10291360f, -0.10289128f,
-    -0.10286102f, -0.10282291f, -0.10277706f, -0.10272360f, -0.10266266f, -0.10259439f, -0.10251898f, -0.10243660f,
-    -0.10234745f, -0.10225175f, -0.10214972f, -0.10204159f, -0.10192763f, -0.10180808f, -0.10168323f, -0.10155335f,
-    -0.10141873f, -0.10127969f, -0.10113652f, -0.10098954f, -0.10083909f, -0.10068548f, -0.10052905f, -0.10037015f,
-    -0.10020912f, -0.10004630f, -0.09988205f, -0.09971672f, -0.09955065f, -0.09938422f, -0.09921776f, -0.09905163f,
-    -0.09888619f, -0.09872177f, -0.09855872f, -0.09839739f, -0.09823810f, -0.09808119f, -0.09792698f, -0.09777578f,
-    -0.09762792f, -0.09748368f, -0.09734337f, -0.09720726f, -0.09707562f, -0.09694873f, -0.09682684f, -0.09671018f,
-    -0.09659898f, -0.09649347f, -0.09639384f, -0.09630029f, -0.09621300f, -0.09613212f, -0.09605781f, -0.09599021f,
-    -0.09592943f, -0.09587559f, -0.09582876f, -0.09578904f, -0.09575648f, -0.09573112f, -0.09571300f, -0.09570212f,
-    -0.09569850f, -0.09570212f, -0.09571293f, -0.09573091f, -0.09575598f, -0.09578807f, -0.09582710f, -0.09587295f,
-    -0.09592550f, -0.09598463f, -0.09605019f, -0.09612202f, -0.09619995f, -0.09628380f, -0.09637336f, -0.09646843f,
-    -0.09656880f, -0.09667423f, -0.09678448f, -0.09689931f, -0.09701847f, -0.09714167f, -0.09726866f, -0.09739915f,
-    -0.09753285f, -0.09766948f, -0.09780873f, -0.09795030f, -0.09809388f, -0.09823917f, -0.09838586f, -0.09853362f,
-    -0.09868214f, -0.09883112f, -0.09898022f, -0.09912913f, -0.09927755f, -0.09942515f, -0.09957164f, -0.09971669f,
-    -0.09986002f, -0.10000132f, -0.10014029f, -0.10027666f, -0.10041015f, -0.10054047f, -0.10066736f, -0.10079057f,
-    -0.10090984f, -0.10102494f, -0.10113563f, -0.10124170f, -0.10134292f, -0.10143912f, -0.10153008f, -0.10161564f,
-    -0.10169564f, -0.10176991f, -0.10183833f, -0.10190076f, -0.10195708f, -0.10200720f, -0.10205103f, -0.10208850f,
-    -0.10211954f, -0.10214410f, -0.10216216f, -0.10217370f, -0.10217870f, -0.10217718f, -0.10216916f, -0.10215467f,
-    -0.10213377f, -0.10210652f, -0.10207299f, -0.10203327f, -0.10198746f, -0.10193568f, -0.10187805f, -0.10181472f,
-    -0.10174583f, -0.10167154f, -0.10159203f, -0.10150748f, -0.10141808f, -0.10132403f, -0.10122555f, -0.10112286f,
-    -0.10101618f, -0.10090576f, -0.10079183f, -0.10067465f, -0.10055448f, -0.10043157f, -0.10030620f, -0.10017863f,
-    -0.10004914f, -0.09991801f, -0.09978553f, -0.09965197f, -0.09951763f, -0.09938278f, -0.09924771f, -0.09911272f,
-    -0.09897808f, -0.09884408f, -0.09871100f, -0.09857913f, -0.09844872f, -0.09832007f, -0.09819342f, -0.09806906f,
-    -0.09794723f, -0.09782818f, -0.09771216f, -0.09759940f, -0.09749015f, -0.09738460f, -0.09728299f, -0.09718551f,
-    -0.09709236f, -0.09700373f, -0.09691979f, -0.09684070f, -0.09676662f, -0.09669769f, -0.09663405f, -0.09657582f,
-    -0.09652310f, -0.09647599f, -0.09643458f, -0.09639894f, -0.09636912f, -0.09634519f, -0.09632716f, -0.09631508f,
-    -0.09630894f, -0.09630874f, -0.09631447f, -0.09632610f, -0.09634359f, -0.09636689f, -0.09639593f, -0.09643065f,
-    -0.09647094f, -0.09651672f, -0.09656786f, -0.09662426f, -0.09668577f, -0.09675225f, -0.09682356f, -0.09689952f,
-    -0.09697996f, -0.09706471f, -0.09715357f, -0.09724635f, -0.09734283f, -0.09744281f, -0.09754607f, -0.09765237f,
-    -0.09776150f, -0.09787320f, -0.09798723f, -0.09810336f, -0.09822132f, -0.09834087f, -0.09846175f, -0.09858369f,
-    -0.09870645f, -0.09882975f, -0.09895334f, -0.09907695f, -0.09920032f, -0.09932319f, -0.09944531f, -0.09956641f,
-    -0.09968624f, -0.09980456f, -0.09992112f, -0.10003566f, -0.10014797f, -0.10025780f, -0.10036492f, -0.10046913f,
-    -0.10057020f, -0.10066793f, -0.10076212f, -0.10085258f, -0.10093912f, -0.10102158f, -0.10109979f, -0.10117359f,
-    -0.10124284f, -0.10130741f, -0.10136715f, -0.10142197f, -0.10147176f, -0.10151642f, -0.10155588f, -0.10159005f,
-    -0.10161889f, -0.10164233f, -0.10166035f, -0.10167292f, -0.10168003f, -0.10168167f, -0.10167785f, -0.10166860f,
-    -0.10165393f, -0.10163391f, -0.10160859f, -0.10157802f, -0.10154228f, -0.10150147f, -0.10145568f, -0.10140502f,
-    -0.10134961f, -0.10128957f, -0.10122504f, -0.10115618f, -0.10108312f, -0.10100605f, -0.10092513f, -0.10084054f,
-    -0.10075246f, -0.10066110f, -0.10056665f, -0.10046931f, -0.10036931f, -0.10026686f, -0.10016218f, -0.10005549f,
-    -0.09994703f, -0.09983703f, -0.09972573f, -0.09961336f, -0.09950016f, -0.09938638f, -0.09927226f, -0.09915803f,
-    -0.09904395f, -0.09893025f, -0.09881717f, -0.09870495f, -0.09859382f, -0.09848402f, -0.09837578f, -0.09826932f,
-    -0.09816487f, -0.09806263f, -0.09796282f, -0.09786565f, -0.09777132f, -0.09768002f, -0.09759193f, -0.09750725f,
-    -0.09742613f, -0.09734874f, -0.09727524f, -0.09720577f, -0.09714048f, -0.09707949f, -0.09702292f, -0.09697089f,
-    -0.09692348f, -0.09688081f, -0.09684293f, -0.09680993f, -0.09678187f, -0.09675879f, -0.09674072f, -0.09672771f,
-    -0.09671977f, -0.09671689f, -0.09671909f, -0.09672633f, -0.09673861f, -0.09675587f, -0.09677808f, -0.09680518f,
-    -0.09683710f, -0.09687376f, -0.09691507f, -0.09696095f, -0.09701127f, -0.09706594f, -0.09712481f, -0.09718777f,
-    -0.09725466f, -0.09732534f, -0.09739966f, -0.09747744f, -0.09755852f, -0.09764271f, -0.09772984f, -0.09781971f,
-    -0.09791213f, -0.09800690f, -0.09810381f, -0.09820266f, -0.09830322f, -0.09840529f, -0.09850865f, -0.09861307f,
-    -0.09871833f, -0.09882421f, -0.09893048f, -0.09903691f, -0.09914329f, -0.09924939f, -0.09935498f, -0.09945984f,
-    -0.09956375f, -0.09966649f, -0.09976785f, -0.09986762f, -0.09996558f, -0.10006154f, -0.10015529f, -0.10024665f,
-    -0.10033541f, -0.10042141f, -0.10050446f, -0.10058439f, -0.10066104f, -0.10073426f, -0.10080389f, -0.10086979f,
-    -0.10093184f, -0.10098991f, -0.10104388f, -0.10109365f, -0.10113911f, -0.10118019f, -0.10121680f, -0.10124888f,
-    -0.10127636f, -0.10129919f, -0.10131734f, -0.10133077f, -0.10133947f, -0.10134343f, -0.10134264f, -0.10133711f,
-    -0.10132687f, -0.10131195f, -0.10129239f, -0.10126823f, -0.10123954f, -0.10120639f, -0.10116885f, -0.10112700f,
-    -0.10108096f, -0.10103082f, -0.10097669f, -0.10091870f, -0.10085697f, -0.10079165f, -0.10072287f, -0.10065080f,
-    -0.10057558f, -0.10049738f, -0.10041638f, -0.10033275f, -0.10024667f, -0.10015832f, -0.10006790f, -0.09997561f,
-    -0.09988164f, -0.09978618f, -0.09968946f, -0.09959167f, -0.09949302f, -0.09939373f, -0.09929400f, -0.09919404f,
-    -0.09909407f, -0.09899430f, -0.09889494f, -0.09879620f, -0.09869829f, -0.09860140f, -0.09850576f, -0.09841154f,
-    -0.09831896f, -0.09822821f, -0.09813947f, -0.09805293f, -0.09796876f, -0.09788715f, -0.09780826f, -0.09773224f,
-    -0.09765927f, -0.09758949f, -0.09752303f, -0.09746004f, -0.09740064f, -0.09734495f, -0.09729309f, -0.09724515f,
-    -0.09720124f, -0.09716143f, -0.09712581f, -0.09709444f, -0.09706739f, -0.09704470f, -0.09702641f, -0.09701256f,
-    -0.09700317f, -0.09699825f, -0.09699780f, -0.09700182f, -0.09701030f, -0.09702319f, -0.09704049f, -0.09706213f,
-    -0.09708806f, -0.09711823f, -0.09715257f, -0.09719099f, -0.09723340f, -0.09727972f, -0.09732984f, -0.09738363f,
-    -0.09744100f, -0.09750180f, -0.09756591f, -0.09763318f, -0.09770347f, -0.09777662f, -0.09785247f, -0.09793087f,
-    -0.09801163f, -0.09809459f, -0.09817956f, -0.09826637f, -0.09835483f, -0.09844474f, -0.09853592f, -0.09862817f,
-    -0.09872129f, -0.09881509f, -0.09890937f, -0.09900392f, -0.09909854f, -0.09919304f, -0.09928722f, -0.09938087f,
-    -0.09947381f, -0.09956582f, -0.09965673f, -0.09974634f, -0.09983446f, -0.09992091f, -0.10000551f, -0.10008808f,
-    -0.10016845f, -0.10024646f, -0.10032193f, -0.10039472f, -0.10046468f, -0.10053167f, -0.10059553f, -0.10065615f,
-    -0.10071341f, -0.10076717f, -0.10081735f, -0.10086383f, -0.10090652f, -0.10094534f, -0.10098020f, -0.10101106f,
-    -0.10103783f, -0.10106048f, -0.10107896f, -0.10109323f, -0.10110328f, -0.10110909f, -0.10111065f, -0.10110796f,
-    -0.10110104f, -0.10108990f, -0.10107458f, -0.10105512f, -0.10103155f, -0.10100394f, -0.10097235f, -0.10093686f,
-    -0.10089754f, -0.10085448f, -0.10080777f, -0.10075753f, -0.10070387f, -0.10064689f, -0.10058673f, -0.10052352f,
-    -0.10045739f, -0.10038849f, -0.10031697f, -0.10024298f, -0.10016669f, -0.10008826f, -0.10000785f, -0.09992564f,
-    -0.09984181f, -0.09975653f, -0.09966999f, -0.09958237f, -0.09949386f, -0.09940464f, -0.09931492f, -0.09922487f,
-    -0.09913468f, -0.09904456f, -0.09895469f, -0.09886525f, -0.09877645f, -0.09868846f, -0.09860147f, -0.09851566f,
-    -0.09843121f, -0.09834830f, -0.09826711f, -0.09818780f, -0.09811054f, -0.09803548f, -0.09796279f, -0.09789261f,
-    -0.09782510f, -0.09776038f, -0.09769860f, -0.09763988f, -0.09758434f, -0.09753209f, -0.09748324f, -0.09743789f,
-    -0.09739614f, -0.09735806f, -0.09732372f, -0.09729321f, -0.09726658f, -0.09724388f, -0.09722515f, -0.09721043f,
-    -0.09719974f, -0.09719311f, -0.09719053f, -0.09719202f, -0.09719756f, -0.09720714f, -0.09722073f, -0.09723830f,
-    -0.09725981f, -0.09728520f, -0.09731442f, -0.09734741f, -0.09738408f, -0.09742435f, -0.09746814f, -0.09751535f,
-    -0.09756588f, -0.09761961f, -0.09767642f, -0.09773621f, -0.09779882f, -0.09786413f, -0.09793200f, -0.09800228f,
-    -0.09807482f, -0.09814946f, -0.09822604f, -0.09830440f, -0.09838437f, -0.09846578f, -0.09854845f, -0.09863221f,
-    -0.09871689f, -0.09880229f, -0.09888825f, -0.09897457f, -0.09906107f, -0.09914758f, -0.09923390f, -0.09931986f,
-    -0.09940527f, -0.09948996f, -0.09957374f, -0.09965644f, -0.09973788f, -0.09981790f, -0.09989633f, -0.09997300f,
-    -0.10004775f, -0.10012043f, -0.10019088f, -0.10025896f, -0.10032453f, -0.10038745f, -0.10044759f, -0.10050482f,
-    -0.10055904f, -0.10061012f, -0.10065796f, -0.10070247f, -0.10074355f, -0.10078112f, -0.10081511f, -0.10084544f,
-    -0.10087206f, -0.10089492f, -0.10091396f, -0.10092916f, -0.10094048f, -0.10094791f, -0.10095142f, -0.10095103f,
-    -0.10094674f, -0.10093855f, -0.10092649f, -0.10091059f, -0.10089088f, -0.10086742f, -0.10084025f, -0.10080944f,
-    -0.10077505f, -0.10073717f, -0.10069587f, -0.10065124f, -0.10060339f, -0.10055241f, -0.10049843f, -0.10044155f,
-    -0.10038190f, -0.10031960f, -0.10025480f, -0.10018763f, -0.10011824f, -0.10004677f, -0.09997338f, -0.09989823f,
-    -0.09982147f, -0.09974327f, -0.09966380f, -0.09958322f, -0.09950172f, -0.09941945f, -0.09933660f, -0.09925334f,
-    -0.09916984f, -0.09908629f, -0.09900287f, -0.09891974f, -0.09883708f, -0.09875507f, -0.09867389f, -0.09859369f,
-    -0.09851466f, -0.09843695f, -0.09836073f, -0.09828616f, -0.09821340f, -0.09814259f, -0.09807389f, -0.09800744f,
-    -0.09794338f, -0.09788184f, -0.09782295f, -0.09776683f, -0.09771360f, -0.09766336f, -0.09761623f, -0.09757230f,
-    -0.09753165f, -0.09749438f, -0.09746055f, -0.09743024f, -0.09740351f, -0.09738041f, -0.09736099f, -0.09734528f,
-    -0.09733331f, -0.09732511f, -0.09732069f, -0.09732006f, -0.09732322f, -0.09733015f, -0.09734083f, -0.09735525f,
-    -0.09737337f, -0.09739514f, -0.09742052f, -0.09744945f, -0.09748187f, -0.09751770f, -0.09755687f, -0.09759929f,
-    -0.09764487f, -0.09769351f, -0.09774510f, -0.09779954f, -0.09785670f, -0.09791647f, -0.09797871f, -0.09804328f,
-    -0.09811006f, -0.09817890f, -0.09824965f, -0.09832216f, -0.09839628f, -0.09847184f, -0.09854869f, -0.09862667f,
-    -0.09870560f, -0.09878532f, -0.09886566f, -0.09894645f, -0.09902751f, -0.09910869f, -0.09918980f, -0.09927067f,
-    -0.09935114f, -0.09943103f, -0.09951017f, -0.09958840f, -0.09966555f, -0.09974146f, -0.09981597f, -0.09988893f,
-    -0.09996018f, -0.10002956f, -0.10009695f, -0.10016218f, -0.10022514f, -0.10028568f, -0.10034368f, -0.10039902f,
-    -0.10045159f, -0.10050127f, -0.10054796f, -0.10059156f, -0.10063200f, -0.10066917f, -0.10070301f, -0.10073344f,
-    -0.10076041f, -0.10078386f, -0.10080374f, -0.10082001f, -0.10083264f, -0.10084161f, -0.10084690f, -0.10084850f,
-    -0.10084641f, -0.10084063f, -0.10083119f, -0.10081810f, -0.10080140f, -0.10078112f, -0.10075730f, -0.10073001f,
-    -0.10069929f, -0.10066523f, -0.10062788f, -0.10058733f, -0.10054368f, -0.10049701f, -0.10044743f, -0.10039503f,
-    -0.10033995f, -0.10028228f, -0.10022216f, -0.10015972f, -0.10009508f, -0.10002839f, -0.09995979f, -0.09988943f,
-    -0.09981745f, -0.09974401f, -0.09966927f, -0.09959337f, -0.09951650f, -0.09943880f, -0.09936044f, -0.09928160f,
-    -0.09920243f, -0.09912310f, -0.09904379f, -0.09896465f, -0.09888587f, -0.09880759f, -0.09873000f, -0.09865325f,
-    -0.09857750f, -0.09850291f, -0.09842965f, -0.09835787f, -0.09828771f, -0.09821932f, -0.09815285f, -0.09808844f,
-    -0.09802622f, -0.09796633f, -0.09790888f, -0.09785401f, -0.09780181f, -0.09775241f, -0.09770590f, -0.09766239f,
-    -0.09762196f, -0.09758469f, -0.09755067f, -0.09751996f, -0.09749263f, -0.09746874f, -0.09744832f, -0.09743143f,
-    -0.09741810f, -0.09740835f, -0.09740220f, -0.09739967f, -0.09740076f, -0.09740545f, -0.09741375f, -0.09742564f,
-    -0.09744107f, -0.09746003f, -0.09748247f, -0.09750834f, -0.09753758f, -0.09757013f, -0.09760593f, -0.09764488f,
-    -0.09768691f, -0.09773194f, -0.09777985f, -0.09783055f, -0.09788393f, -0.09793988f, -0.09799828f, -0.09805899f,
-    -0.09812190f, -0.09818687f, -0.09825376f, -0.09832242f, -0.09839272f, -0.09846450f, -0.09853761f, -0.09861189f,
-    -0.09868719f, -0.09876335f, -0.09884020f, -0.09891759f, -0.09899534f, -0.09907330f, -0.09915129f, -0.09922916f,
-    -0.09930674f, -0.09938386f, -0.09946037f, -0.09953610f, -0.09961089f, -0.09968458f, -0.09975701f, -0.09982804f,
-    -0.09989752f, -0.09996530f, -0.10003123f, -0.10009517f, -0.10015700f, -0.10021658f, -0.10027379f, -0.10032851f,
-    -0.10038062f, -0.10043001f, -0.10047658f, -0.10052023f, -0.10056087f, -0.10059842f, -0.10063279f, -0.10066392f,
-    -0.10069174f, -0.10071620f, -0.10073723f, -0.10075481f, -0.10076889f, -0.10077944f, -0.10078645f, -0.10078990f,
-    -0.10078978f, -0.10078610f, -0.10077886f, -0.10076808f, -0.10075378f, -0.10073601f, -0.10071478f, -0.10069016f,
-    -0.10066219f, -0.10063093f, -0.10059646f, -0.10055884f, -0.10051816f, -0.10047450f, -0.10042795f, -0.10037863f,
-    -0.10032662f, -0.10027204f, -0.10021501f, -0.10015565f, -0.10009408f, -0.10003044f, -0.09996487f, -0.09989749f,
-    -0.09982845f, -0.09975791f, -0.09968601f, -0.09961290f, -0.09953873f, -0.09946367f, -0.09938788f, -0.09931150f,
-    -0.09923472f, -0.09915768f, -0.09908056f, -0.09900351f, -0.09892669f, -0.09885028f, -0.09877443f, -0.09869930f,
-    -0.09862505f, -0.09855184f, -0.09847983f, -0.09840916f, -0.09833998f, -0.09827244f, -0.09820668f, -0.09814285f,
-    -0.09808107f, -0.09802148f, -0.09796420f, -0.09790935f, -0.09785705f, -0.09780741f, -0.09776054f, -0.09771652f,
-    -0.09767546f, -0.09763744f, -0.09760253f, -0.09757082f, -0.09754238f, -0.09751725f, -0.09749549f, -0.09747715f,
-    -0.09746227f, -0.09745087f, -0.09744299f, -0.09743863f, -0.09743780f, -0.09744051f, -0.09744675f, -0.09745651f,
-    -0.09746976f, -0.09748648f, -0.09750662f, -0.09753016f, -0.09755703f, -0.09758718f, -0.09762055f, -0.09765706f,
-    -0.09769664f, -0.09773920f, -0.09778465f, -0.09783289f, -0.09788383f, -0.09793736f, -0.09799335f, -0.09805170f,
-    -0.09811228f, -0.09817495f, -0.09823960f, -0.09830607f, -0.09837423f, -0.09844394f, -0.09851504f, -0.09858740f,
-    -0.09866084f, -0.09873523f, -0.09881039f, -0.09888617f, -0.09896242f, -0.09903897f, -0.09911565f, -0.09919231f,
-    -0.09926878f, -0.09934490f, -0.09942051f, -0.09949545f, -0.09956957f, -0.09964270f, -0.09971469f, -0.09978538f,
-    -0.09985464f, -0.09992231f, -0.09998824f, -0.10005231f, -0.10011437f, -0.10017429f, -0.10023195f, -0.10028722f,
-    -0.10033999f, -0.10039014f, -0.10043757f, -0.10048219f, -0.10052389f, -0.10056258f, -0.10059819f, -0.10063064f,
-    -0.10065986f, -0.10068579f, -0.10070838f, -0.10072757f, -0.10074333f, -0.10075562f, -0.10076442f, -0.10076970f,
-    -0.10077147f, -0.10076970f, -0.10076442f, -0.10075562f, -0.10074333f, -0.10072757f, -0.10070838f, -0.10068579f,
-    -0.10065986f, -0.10063064f, -0.10059819f, -0.10056258f, -0.10052389f, -0.10048219f, -0.10043757f, -0.10039014f,
-    -0.10033999f, -0.10028722f, -0.10023195f, -0.10017429f, -0.10011437f, -0.10005231f, -0.09998824f, -0.09992231f,
-    -0.09985464f, -0.09978538f, -0.09971469f, -0.09964270f, -0.09956957f, -0.09949545f, -0.09942051f, -0.09934490f,
-    -0.09926878f, -0.09919231f, -0.09911565f, -0.09903897f, -0.09896242f, -0.09888617f, -0.09881039f, -0.09873523f,
-    -0.09866084f, -0.09858740f, -0.09851504f, -0.09844394f, -0.09837423f, -0.09830607f, -0.09823960f, -0.09817495f,
-    -0.09811228f, -0.09805170f, -0.09799335f, -0.09793736f, -0.09788383f, -0.09783289f, -0.09778465f, -0.09773920f,
-    -0.09769664f, -0.09765706f, -0.09762055f, -0.09758718f, -0.09755703f, -0.09753016f, -0.09750662f, -0.09748648f,
-    -0.09746976f, -0.09745651f, -0.09744675f, -0.09744051f, -0.09743780f, -0.09743863f, -0.09744299f, -0.09745087f,
-    -0.09746227f, -0.09747715f, -0.09749549f, -0.09751725f, -0.09754238f, -0.09757082f, -0.09760253f, -0.09763744f,
-    -0.09767546f, -0.09771652f, -0.09776054f, -0.09780741f, -0.09785705f, -0.09790935f, -0.09796420f, -0.09802148f,
-    -0.09808107f, -0.09814285f, -0.09820668f, -0.09827244f, -0.09833998f, -0.09840916f, -0.09847983f, -0.09855184f,
-    -0.09862505f, -0.09869930f, -0.09877443f, -0.09885028f, -0.09892669f, -0.09900351f, -0.09908056f, -0.09915768f,
-    -0.09923472f, -0.09931150f, -0.09938788f, -0.09946367f, -0.09953873f, -0.09961290f, -0.09968601f, -0.09975791f,
-    -0.09982845f, -0.09989749f, -0.09996487f, -0.10003044f, -0.10009408f, -0.10015565f, -0.10021501f, -0.10027204f,
-    -0.10032662f, -0.10037863f, -0.10042795f, -0.10047450f, -0.10051816f, -0.10055884f, -0.10059646f, -0.10063093f,
-    -0.10066219f, -0.10069016f, -0.10071478f, -0.10073601f, -0.10075378f, -0.10076808f, -0.10077886f, -0.10078610f,
-    -0.10078978f, -0.10078990f, -0.10078645f, -0.10077944f, -0.10076889f, -0.10075481f, -0.10073723f, -0.10071620f,
-    -0.10069174f, -0.10066392f, -0.10063279f, -0.10059842f, -0.10056087f, -0.10052023f, -0.10047658f, -0.10043001f,
-    -0.10038062f, -0.10032851f, -0.10027379f, -0.10021658f, -0.10015700f, -0.10009517f, -0.10003123f, -0.09996530f,
-    -0.09989752f, -0.09982804f, -0.09975701f, -0.09968458f, -0.09961089f, -0.09953610f, -0.09946037f, -0.09938386f,
-    -0.09930674f, -0.09922916f, -0.09915129f, -0.09907330f, -0.09899534f, -0.09891759f, -0.09884020f, -0.09876335f,
-    -0.09868719f, -0.09861189f, -0.09853761f, -0.09846450f, -0.09839272f, -0.09832242f, -0.09825376f, -0.09818687f,
-    -0.09812190f, -0.09805899f, -0.09799828f, -0.09793988f, -0.09788393f, -0.09783055f, -0.09777985f, -0.09773194f,
-    -0.09768691f, -0.09764488f, -0.09760593f, -0.09757013f, -0.09753758f, -0.09750834f, -0.09748247f, -0.09746003f,
-    -0.09744107f, -0.09742564f, -0.09741375f, -0.09740545f, -0.09740076f, -0.09739967f, -0.09740220f, -0.09740835f,
-    -0.09741810f, -0.09743143f, -0.09744832f, -0.09746874f, -0.09749263f, -0.09751996f, -0.09755067f, -0.09758469f,
-    -0.09762196f, -0.09766239f, -0.09770590f, -0.09775241f, -0.09780181f, -0.09785401f, -0.09790888f, -0.09796633f,
-    -0.09802622f, -0.09808844f, -0.09815285f, -0.09821932f, -0.09828771f, -0.09835787f, -0.09842965f, -0.09850291f,
-    -0.09857750f, -0.09865325f, -0.09873000f, -0.09880759f, -0.09888587f, -0.09896465f, -0.09904379f, -0.09912310f,
-    -0.09920243f, -0.09928160f, -0.09936044f, -0.09943880f, -0.09951650f, -0.09959337f, -0.09966927f, -0.09974401f,
-    -0.09981745f, -0.09988943f, -0.09995979f, -0.10002839f, -0.10009508f, -0.10015972f, -0.10022216f, -0.10028228f,
-    -0.10033995f, -0.10039503f, -0.10044743f, -0.10049701f, -0.10054368f, -0.10058733f, -0.10062788f, -0.10066523f,
-    -0.10069929f, -0.10073001f, -0.10075730f, -0.10078112f, -0.10080140f, -0.10081810f, -0.10083119f, -0.10084063f,
-    -0.10084641f, -0.10084850f, -0.10084690f, -0.10084161f, -0.10083264f, -0.10082001f, -0.10080374f, -0.10078386f,
-    -0.10076041f, -0.10073344f, -0.10070301f, -0.10066917f, -0.10063200f, -0.10059156f, -0.10054796f, -0.10050127f,
-    -0.10045159f, -0.10039902f, -0.10034368f, -0.10028568f, -0.10022514f, -0.10016218f, -0.10009695f, -0.10002956f,
-    -0.09996018f, -0.09988893f, -0.09981597f, -0.09974146f, -0.09966555f, -0.09958840f, -0.09951017f, -0.09943103f,
-    -0.09935114f, -0.09927067f, -0.09918980f, -0.09910869f, -0.09902751f, -0.09894645f, -0.09886566f, -0.09878532f,
-    -0.09870560f, -0.09862667f, -0.09854869f, -0.09847184f, -0.09839628f, -0.09832216f, -0.09824965f, -0.09817890f,
-    -0.09811006f, -0.09804328f, -0.09797871f, -0.09791647f, -0.09785670f, -0.09779954f, -0.09774510f, -0.09769351f,
-    -0.09764487f, -0.09759929f, -0.09755687f, -0.09751770f, -0.09748187f, -0.09744945f, -0.09742052f, -0.09739514f,
-    -0.09737337f, -0.09735525f, -0.09734083f, -0.09733015f, -0.09732322f, -0.09732006f, -0.09732069f, -0.09732511f,
-    -0.09733331f, -0.09734528f, -0.09736099f, -0.09738041f, -0.09740351f, -0.09743024f, -0.09746055f, -0.09749438f,
-    -0.09753165f, -0.09757230f, -0.09761623f, -0.09766336f, -0.09771360f, -0.09776683f, -0.09782295f, -0.09788184f,
-    -0.09794338f, -0.09800744f, -0.09807389f, -0.09814259f, -0.09821340f, -0.09828616f, -0.09836073f, -0.09843695f,
-    -0.09851466f, -0.09859369f, -0.09867389f, -0.09875507f, -0.09883708f, -0.09891974f, -0.09900287f, -0.09908629f,
-    -0.09916984f, -0.09925334f, -0.09933660f, -0.09941945f, -0.09950172f, -0.09958322f, -0.09966380f, -0.09974327f,
-    -0.09982147f, -0.09989823f, -0.09997338f, -0.10004677f, -0.10011824f, -0.10018763f, -0.10025480f, -0.10031960f,
-    -0.10038190f, -0.10044155f, -0.10049843f, -0.10055241f, -0.10060339f, -0.10065124f, -0.10069587f, -0.10073717f,
-    -0.10077505f, -0.10080944f, -0.10084025f, -0.10086742f, -0.10089088f, -0.10091059f, -0.10092649f, -0.10093855f,
-    -0.10094674f, -0.10095103f, -0.10095142f, -0.10094791f, -0.10094048f, -0.10092916f, -0.10091396f, -0.10089492f,
-    -0.10087206f, -0.10084544f, -0.10081511f, -0.10078112f, -0.10074355f, -0.10070247f, -0.10065796f, -0.10061012f,
-    -0.10055904f, -0.10050482f, -0.10044759f, -0.10038745f, -0.10032453f, -0.10025896f, -0.10019088f, -0.10012043f,
-    -0.10004775f, -0.09997300f, -0.09989633f, -0.09981790f, -0.09973788f, -0.09965644f, -0.09957374f, -0.09948996f,
-    -0.09940527f, -0.09931986f, -0.09923390f, -0.09914758f, -0.09906107f, -0.09897457f, -0.09888825f, -0.09880229f,
-    -0.09871689f, -0.09863221f, -0.09854845f, -0.09846578f, -0.09838437f, -0.09830440f, -0.09822604f, -0.09814946f,
-    -0.09807482f, -0.09800228f, -0.09793200f, -0.09786413f, -0.09779882f, -0.09773621f, -0.09767642f, -0.09761961f,
-    -0.09756588f, -0.09751535f, -0.09746814f, -0.09742435f, -0.09738408f, -0.09734741f, -0.09731442f, -0.09728520f,
-    -0.09725981f, -0.09723830f, -0.09722073f, -0.09720714f, -0.09719756f, -0.09719202f, -0.09719053f, -0.09719311f,
-    -0.09719974f, -0.09721043f, -0.09722515f, -0.09724388f, -0.09726658f, -0.09729321f, -0.09732372f, -0.09735806f,
-    -0.09739614f, -0.09743789f, -0.09748324f, -0.09753209f, -0.09758434f, -0.09763988f, -0.09769860f, -0.09776038f,
-    -0.09782510f, -0.09789261f, -0.09796279f, -0.09803548f, -0.09811054f, -0.09818780f, -0.09826711f, -0.09834830f,
-    -0.09843121f, -0.09851566f, -0.09860147f, -0.09868846f, -0.09877645f, -0.09886525f, -0.09895469f, -0.09904456f,
-    -0.09913468f, -0.09922487f, -0.09931492f, -0.09940464f, -0.09949386f, -0.09958237f, -0.09966999f, -0.09975653f,
-    -0.09984181f, -0.09992564f, -0.10000785f, -0.10008826f, -0.10016669f, -0.10024298f, -0.10031697f, -0.10038849f,
-    -0.10045739f, -0.10052352f, -0.10058673f, -0.10064689f, -0.10070387f, -0.10075753f, -0.10080777f, -0.10085448f,
-    -0.10089754f, -0.10093686f, -0.10097235f, -0.10100394f, -0.10103155f, -0.10105512f, -0.10107458f, -0.10108990f,
-    -0.10110104f, -0.10110796f, -0.10111065f, -0.10110909f, -0.10110328f, -0.10109323f, -0.10107896f, -0.10106048f,
-    -0.10103783f, -0.10101106f, -0.10098020f, -0.10094534f, -0.10090652f, -0.10086383f, -0.10081735f, -0.10076717f,
-    -0.10071341f, -0.10065615f, -0.10059553f, -0.10053167f, -0.10046468f, -0.10039472f, -0.10032193f, -0.10024646f,
-    -0.10016845f, -0.10008808f, -0.10000551f, -0.09992091f, -0.09983446f, -0.09974634f, -0.09965673f, -0.09956582f,
-    -0.09947381f, -0.09938087f, -0.09928722f, -0.09919304f, -0.09909854f, -0.09900392f, -0.09890937f, -0.09881509f,
-    -0.09872129f, -0.09862817f, -0.09853592f, -0.09844474f, -0.09835483f, -0.09826637f, -0.09817956f, -0.09809459f,
-    -0.09801163f, -0.09793087f, -0.09785247f, -0.09777662f, -0.09770347f, -0.09763318f, -0.09756591f, -0.09750180f,
-    -0.09744100f, -0.09738363f, -0.09732984f, -0.09727972f, -0.09723340f, -0.09719099f, -0.09715257f, -0.09711823f,
-    -0.09708806f, -0.09706213f, -0.09704049f, -0.09702319f, -0.09701030f, -0.09700182f, -0.09699780f, -0.09699825f,
-    -0.09700317f, -0.09701256f, -0.09702641f, -0.09704470f, -0.09706739f, -0.09709444f, -0.09712581f, -0.09716143f,
-    -0.09720124f, -0.09724515f, -0.09729309f, -0.09734495f, -0.09740064f, -0.09746004f, -0.09752303f, -0.09758949f,
-    -0.09765927f, -0.09773224f, -0.09780826f, -0.09788715f, -0.09796876f, -0.09805293f, -0.09813947f, -0.09822821f,
-    -0.09831896f, -0.09841154f, -0.09850576f, -0.09860140f, -0.09869829f, -0.09879620f, -0.09889494f, -0.09899430f,
-    -0.09909407f, -0.09919404f, -0.09929400f, -0.09939373f, -0.09949302f, -0.09959167f, -0.09968946f, -0.09978618f,
-    -0.09988164f, -0.09997561f, -0.10006790f, -0.10015832f, -0.10024667f, -0.10033275f, -0.10041638f, -0.10049738f,
-    -0.10057558f, -0.10065080f, -0.10072287f, -0.10079165f, -0.10085697f, -0.10091870f, -0.10097669f, -0.10103082f,
-    -0.10108096f, -0.10112700f, -0.10116885f, -0.10120639f, -0.10123954f, -0.10126823f, -0.10129239f, -0.10131195f,
-    -0.10132687f, -0.10133711f, -0.10134264f, -0.10134343f, -0.10133947f, -0.10133077f, -0.10131734f, -0.10129919f,
-    -0.10127636f, -0.10124888f, -0.10121680f, -0.10118019f, -0.10113911f, -0.10109365f, -0.10104388f, -0.10098991f,
-    -0.10093184f, -0.10086979f, -0.10080389f, -0.10073426f, -0.10066104f, -0.10058439f, -0.10050446f, -0.10042141f,
-    -0.10033541f, -0.10024665f, -0.10015529f, -0.10006154f, -0.09996558f, -0.09986762f, -0.09976785f, -0.09966649f,
-    -0.09956375f, -0.09945984f, -0.09935498f, -0.09924939f, -0.09914329f, -0.09903691f, -0.09893048f, -0.09882421f,
-    -0.09871833f, -0.09861307f, -0.09850865f, -0.09840529f, -0.09830322f, -0.09820266f, -0.09810381f, -0.09800690f,
-    -0.09791213f, -0.09781971f, -0.09772984f, -0.09764271f, -0.09755852f, -0.09747744f, -0.09739966f, -0.09732534f,
-    -0.09725466f, -0.09718777f, -0.09712481f, -0.09706594f, -0.09701127f, -0.09696095f, -0.09691507f, -0.09687376f,
-    -0.09683710f, -0.09680518f, -0.09677808f, -0.09675587f, -0.09673861f, -0.09672633f, -0.09671909f, -0.09671689f,
-    -0.09671977f, -0.09672771f, -0.09674072f, -0.09675879f, -0.09678187f, -0.09680993f, -0.09684293f, -0.09688081f,
-    -0.09692348f, -0.09697089f, -0.09702292f, -0.09707949f, -0.09714048f, -0.09720577f, -0.09727524f, -0.09734874f,
-    -0.09742613f, -0.09750725f, -0.09759193f, -0.09768002f, -0.09777132f, -0.09786565f, -0.09796282f, -0.09806263f,
-    -0.09816487f, -0.09826932f, -0.09837578f, -0.09848402f, -0.09859382f, -0.09870495f, -0.09881717f, -0.09893025f,
-    -0.09904395f, -0.09915803f, -0.09927226f, -0.09938638f, -0.09950016f, -0.09961336f, -0.09972573f, -0.09983703f,
-    -0.09994703f, -0.10005549f, -0.10016218f, -0.10026686f, -0.10036931f, -0.10046931f, -0.10056665f, -0.10066110f,
-    -0.10075246f, -0.10084054f, -0.10092513f, -0.10100605f, -0.10108312f, -0.10115618f, -0.10122504f, -0.10128957f,
-    -0.10134961f, -0.10140502f, -0.10145568f, -0.10150147f, -0.10154228f, -0.10157802f, -0.10160859f, -0.10163391f,
-    -0.10165393f, -0.10166860f, -0.10167785f, -0.10168167f, -0.10168003f, -0.10167292f, -0.10166035f, -0.10164233f,
-    -0.10161889f, -0.10159005f, -0.10155588f, -0.10151642f, -0.10147176f, -0.10142197f, -0.10136715f, -0.10130741f,
-    -0.10124284f, -0.10117359f, -0.10109979f, -0.10102158f, -0.10093912f, -0.10085258f, -0.10076212f, -0.10066793f,
-    -0.10057020f, -0.10046913f, -0.10036492f, -0.10025780f, -0.10014797f, -0.10003566f, -0.09992112f, -0.09980456f,
-    -0.09968624f, -0.09956641f, -0.09944531f, -0.09932319f, -0.09920032f, -0.09907695f, -0.09895334f, -0.09882975f,
-    -0.09870645f, -0.09858369f, -0.09846175f, -0.09834087f, -0.09822132f, -0.09810336f, -0.09798723f, -0.09787320f,
-    -0.09776150f, -0.09765237f, -0.09754607f, -0.09744281f, -0.09734283f, -0.09724635f, -0.09715357f, -0.09706471f,
-    -0.09697996f, -0.09689952f, -0.09682356f, -0.09675225f, -0.09668577f, -0.09662426f, -0.09656786f, -0.09651672f,
-    -0.09647094f, -0.09643065f, -0.09639593f, -0.09636689f, -0.09634359f, -0.09632610f, -0.09631447f, -0.09630874f,
-    -0.09630894f, -0.09631508f, -0.09632716f, -0.09634519f, -0.09636912f, -0.09639894f, -0.09643458f, -0.09647599f,
-    -0.09652310f, -0.09657582f, -0.09663405f, -0.09669769f, -0.09676662f, -0.09684070f, -0.09691979f, -0.09700373f,
-    -0.09709236f, -0.09718551f, -0.09728299f, -0.09738460f, -0.09749015f, -0.09759940f, -0.09771216f, -0.09782818f,
-    -0.09794723f, -0.09806906f, -0.09819342f, -0.09832007f, -0.09844872f, -0.09857913f, -0.09871100f, -0.09884408f,
-    -0.09897808f, -0.09911272f, -0.09924771f, -0.09938278f, -0.09951763f, -0.09965197f, -0.09978553f, -0.09991801f,
-    -0.10004914f, -0.10017863f, -0.10030620f, -0.10043157f, -0.10055448f, -0.10067465f, -0.10079183f, -0.10090576f,
-    -0.10101618f, -0.10112286f, -0.10122555f, -0.10132403f, -0.10141808f, -0.10150748f, -0.10159203f, -0.10167154f,
-    -0.10174583f, -0.10181472f, -0.10187805f, -0.10193568f, -0.10198746f, -0.10203327f, -0.10207299f, -0.10210652f,
-    -0.10213377f, -0.10215467f, -0.10216916f, -0.10217718f, -0.10217870f, -0.10217370f, -0.10216216f, -0.10214410f,
-    -0.10211954f, -0.10208850f, -0.10205103f, -0.10200720f, -0.10195708f, -0.10190076f, -0.10183833f, -0.10176991f,
-    -0.10169564f, -0.10161564f, -0.10153008f, -0.10143912f, -0.10134292f, -0.10124170f, -0.10113563f, -0.10102494f,
-    -0.10090984f, -0.10079057f, -0.10066736f, -0.10054047f, -0.10041015f, -0.10027666f, -0.10014029f, -0.10000132f,
-    -0.09986002f, -0.09971669f, -0.09957164f, -0.09942515f, -0.09927755f, -0.09912913f, -0.09898022f, -0.09883112f,
-    -0.09868214f, -0.09853362f, -0.09838586f, -0.09823917f, -0.09809388f, -0.09795030f, -0.09780873f, -0.09766948f,
-    -0.09753285f, -0.09739915f, -0.09726866f, -0.09714167f, -0.09701847f, -0.09689931f, -0.09678448f, -0.09667423f,
-    -0.09656880f, -0.09646843f, -0.09637336f, -0.09628380f, -0.09619995f, -0.09612202f, -0.09605019f, -0.09598463f,
-    -0.09592550f, -0.09587295f, -0.09582710f, -0.09578807f, -0.09575598f, -0.09573091f, -0.09571293f, -0.09570212f,
-    -0.09569850f, -0.09570212f, -0.09571300f, -0.09573112f, -0.09575648f, -0.09578904f, -0.09582876f, -0.09587559f,
-    -0.09592943f, -0.09599021f, -0.09605781f, -0.09613212f, -0.09621300f, -0.09630029f, -0.09639384f, -0.09649347f,
-    -0.09659898f, -0.09671018f, -0.09682684f, -0.09694873f, -0.09707562f, -0.09720726f, -0.09734337f, -0.09748368f,
-    -0.09762792f, -0.09777578f, -0.09792698f, -0.09808119f, -0.09823810f, -0.09839739f, -0.09855872f, -0.09872177f,
-    -0.09888619f, -0.09905163f, -0.09921776f, -0.09938422f, -0.09955065f, -0.09971672f, -0.09988205f, -0.10004630f,
-    -0.10020912f, -0.10037015f, -0.10052905f, -0.10068548f, -0.10083909f, -0.10098954f, -0.10113652f, -0.10127969f,
-    -0.10141873f, -0.10155335f, -0.10168323f, -0.10180808f, -0.10192763f, -0.10204159f, -0.10214972f, -0.10225175f,
-    -0.10234745f, -0.10243660f, -0.10251898f, -0.10259439f, -0.10266266f, -0.10272360f, -0.10277706f, -0.10282291f,
-    -0.10286102f, -0.10289128f, -0.10291360f, -0.10292789f, -0.10293411f, -0.10293222f, -0.10292217f, -0.10290398f,
-    -0.10287764f, -0.10284318f, -0.10280065f, -0.10275010f, -0.10269162f, -0.10262530f, -0.10255125f, -0.10246960f,
-    -0.10238050f, -0.10228411f, -0.10218060f, -0.10207017f, -0.10195302f, -0.10182939f, -0.10169951f, -0.10156363f,
-    -0.10142202f, -0.10127495f, -0.10112272f, -0.10096563f, -0.10080401f, -0.10063816f, -0.10046843f, -0.10029517f,
-    -0.10011873f, -0.09993947f, -0.09975775f, -0.09957397f, -0.09938850f, -0.09920172f, -0.09901403f, -0.09882582f,
-    -0.09863750f, -0.09844945f, -0.09826208f, -0.09807579f, -0.09789098f, -0.09770805f, -0.09752739f, -0.09734939f,
-    -0.09717445f, -0.09700294f, -0.09683524f, -0.09667173f, -0.09651277f, -0.09635870f, -0.09620989f, -0.09606666f,
-    -0.09592934f, -0.09579824f, -0.09567367f, -0.09555592f, -0.09544527f, -0.09534197f, -0.09524627f, -0.09515842f,
-    -0.09507862f, -0.09500709f, -0.09494399f, -0.09488951f, -0.09484378f, -0.09480695f, -0.09477913f, -0.09476041f,
-    -0.09475086f, -0.09475056f, -0.09475952f, -0.09477778f, -0.09480533f, -0.09484216f, -0.09488821f, -0.09494343f,
-    -0.09500774f, -0.09508105f, -0.09516323f, -0.09525414f, -0.09535363f, -0.09546152f, -0.09557762f, -0.09570171f,
-    -0.09583357f, -0.09597295f, -0.09611958f, -0.09627318f, -0.09643345f, -0.09660009f, -0.09677276f, -0.09695113f,
-    -0.09713483f, -0.09732351f, -0.09751678f, -0.09771425f, -0.09791553f, -0.09812019f, -0.09832782f, -0.09853799f,
-    -0.09875026f, -0.09896420f, -0.09917936f, -0.09939528f, -0.09961151f, -0.09982759f, -0.10004307f, -0.10025748f,
-    -0.10047036f, -0.10068126f, -0.10088972f, -0.10109528f, -0.10129750f, -0.10149593f, -0.10169013f, -0.10187968f,
-    -0.10206415f, -0.10224313f, -0.10241621f, -0.10258300f, -0.10274311f, -0.10289619f, -0.10304186f, -0.10317980f,
-    -0.10330967f, -0.10343116f, -0.10354398f, -0.10364785f, -0.10374250f, -0.10382769f, -0.10390321f, -0.10396885f,
-    -0.10402442f, -0.10406976f, -0.10410473f, -0.10412920f, -0.10414308f, -0.10414629f, -0.10413878f, -0.10412050f,
-    -0.10409146f, -0.10405166f, -0.10400114f, -0.10393995f, -0.10386819f, -0.10378594f, -0.10369334f, -0.10359053f,
-    -0.10347770f, -0.10335502f, -0.10322271f, -0.10308102f, -0.10293020f, -0.10277052f, -0.10260228f, -0.10242580f,
-    -0.10224142f, -0.10204949f, -0.10185039f, -0.10164449f, -0.10143221f, -0.10121397f, -0.10099020f, -0.10076135f,
-    -0.10052788f, -0.10029027f, -0.10004901f, -0.09980458f, -0.09955748f, -0.09930825f, -0.09905738f, -0.09880541f,
-    -0.09855286f, -0.09830028f, -0.09804819f, -0.09779713f, -0.09754765f, -0.09730028f, -0.09705555f, -0.09681400f,
-    -0.09657616f, -0.09634254f, -0.09611368f, -0.09589007f, -0.09567222f, -0.09546062f, -0.09525575f, -0.09505808f,
-    -0.09486807f, -0.09468615f, -0.09451275f, -0.09434829f, -0.09419315f, -0.09404773f, -0.09391236f, -0.09378740f,
-    -0.09367315f, -0.09356992f, -0.09347799f, -0.09339760f, -0.09332898f, -0.09327234f, -0.09322787f, -0.09319571f,
-    -0.09317601f, -0.09316886f, -0.09317434f, -0.09319252f, -0.09322341f, -0.09326702f, -0.09332332f, -0.09339226f,
-    -0.09347376f, -0.09356770f, -0.09367396f, -0.09379237f, -0.09392275f, -0.09406488f, -0.09421852f, -0.09438340f,
-    -0.09455925f, -0.09474573f, -0.09494251f, -0.09514923f, -0.09536549f, -0.09559091f, -0.09582503f, -0.09606741f,
-    -0.09631759f, -0.09657506f, -0.09683933f, -0.09710986f, -0.09738613f, -0.09766756f, -0.09795360f, -0.09824365f,
-    -0.09853713f, -0.09883343f, -0.09913193f, -0.09943202f, -0.09973305f, -0.10003441f, -0.10033545f, -0.10063552f,
-    -0.10093399f, -0.10123021f, -0.10152355f, -0.10181335f, -0.10209898f, -0.10237982f, -0.10265524f, -0.10292463f,
-    -0.10318737f, -0.10344287f, -0.10369055f, -0.10392984f, -0.10416018f, -0.10438102f, -0.10459185f, -0.10479216f,
-    -0.10498147f, -0.10515930f, -0.10532522f, -0.10547880f, -0.10561964f, -0.10574738f, -0.10586166f, -0.10596217f,
-    -0.10604860f, -0.10612070f, -0.10617822f, -0.10622096f, -0.10624874f, -0.10626142f, -0.10625887f, -0.10624102f,
-    -0.10620780f, -0.10615921f, -0.10609524f, -0.10601596f, -0.10592142f, -0.10581175f, -0.10568708f, -0.10554760f,
-    -0.10539350f, -0.10522503f, -0.10504246f, -0.10484609f, -0.10463625f, -0.10441331f, -0.10417767f, -0.10392975f,
-    -0.10366999f, -0.10339888f, -0.10311693f, -0.10282467f, -0.10252266f, -0.10221147f, -0.10189172f, -0.10156402f,
-    -0.10122904f, -0.10088743f, -0.10053988f, -0.10018710f, -0.09982979f, -0.09946869f, -0.09910456f, -0.09873813f,
-    -0.09837018f, -0.09800147f, -0.09763280f, -0.09726494f, -0.09689868f, -0.09653481f, -0.09617412f, -0.09581739f,
-    -0.09546542f, -0.09511899f, -0.09477885f, -0.09444579f, -0.09412055f, -0.09380388f, -0.09349650f, -0.09319913f,
-    -0.09291248f, -0.09263722f, -0.09237400f, -0.09212348f, -0.09188627f, -0.09166296f, -0.09145411f, -0.09126028f,
-    -0.09108197f, -0.09091967f, -0.09077383f, -0.09064486f, -0.09053317f, -0.09043910f, -0.09036297f, -0.09030507f,
-    -0.09026564f, -0.09024489f, -0.09024300f, -0.09026011f, -0.09029629f, -0.09035161f, -0.09042609f, -0.09051969f,
-    -0.09063234f, -0.09076395f, -0.09091437f, -0.09108340f, -0.09127081f, -0.09147634f, -0.09169968f, -0.09194047f,
-    -0.09219833f, -0.09247282f, -0.09276349f, -0.09306982f, -0.09339128f, -0.09372729f, -0.09407725f, -0.09444049f,
-    -0.09481636f, -0.09520413f, -0.09560307f, -0.09601241f, -0.09643135f, -0.09685908f, -0.09729473f, -0.09773746f,
-    -0.09818636f, -0.09864052f, -0.09909902f, -0.09956091f, -0.10002523f, -0.10049101f, -0.10095727f, -0.10142303f,
-    -0.10188727f, -0.10234902f, -0.10280725f, -0.10326097f, -0.10370919f, -0.10415089f, -0.10458510f, -0.10501082f,
-    -0.10542710f, -0.10583296f, -0.10622746f, -0.10660969f, -0.10697872f, -0.10733366f, -0.10767366f, -0.10799788f,
-    -0.10830549f, -0.10859571f, -0.10886779f, -0.10912101f, -0.10935467f, -0.10956813f, -0.10976077f, -0.10993201f,
-    -0.11008133f, -0.11020822f, -0.11031223f, -0.11039296f, -0.11045006f, -0.11048320f, -0.11049213f, -0.11047663f,
-    -0.11043652f, -0.11037171f, -0.11028212f, -0.11016774f, -0.11002862f, -0.10986484f, -0.10967655f, -0.10946394f,
-    -0.10922728f, -0.10896686f, -0.10868303f, -0.10837622f, -0.10804688f, -0.10769552f, -0.10732271f, -0.10692905f,
-    -0.10651522f, -0.10608192f, -0.10562991f, -0.10515999f, -0.10467301f, -0.10416987f, -0.10365150f, -0.10311886f,
-    -0.10257298f, -0.10201490f, -0.10144571f, -0.10086652f, -0.10027848f, -0.09968277f, -0.09908058f, -0.09847316f,
-    -0.09786174f, -0.09724760f, -0.09663201f, -0.09601630f, -0.09540175f, -0.09478971f, -0.09418149f, -0.09357843f,
-    -0.09298186f, -0.09239311f, -0.09181352f, -0.09124441f, -0.09068708f, -0.09014283f, -0.08961296f, -0.08909871f,
-    -0.08860134f, -0.08812207f, -0.08766208f, -0.08722255f, -0.08680460f, -0.08640933f, -0.08603780f, -0.08569104f,
-    -0.08537000f, -0.08507564f, -0.08480884f, -0.08457042f, -0.08436118f, -0.08418184f, -0.08403308f, -0.08391552f,
-    -0.08382971f, -0.08377615f, -0.08375527f, -0.08376744f, -0.08381296f, -0.08389207f, -0.08400494f, -0.08415165f,
-    -0.08433224f, -0.08454667f, -0.08479482f, -0.08507650f, -0.08539145f, -0.08573934f, -0.08611977f, -0.08653225f,
-    -0.08697624f, -0.08745111f, -0.08795617f, -0.08849066f, -0.08905374f, -0.08964451f, -0.09026199f, -0.09090516f,
-    -0.09157290f, -0.09226405f, -0.09297739f, -0.09371162f, -0.09446541f, -0.09523735f, -0.09602598f, -0.09682981f,
-    -0.09764727f, -0.09847678f, -0.09931668f, -0.10016530f, -0.10102091f, -0.10188176f, -0.10274608f, -0.10361205f,
-    -0.10447782f, -0.10534156f, -0.10620139f, -0.10705542f, -0.10790176f, -0.10873850f, -0.10956375f, -0.11037561f,
-    -0.11117219f, -0.11195159f, -0.11271195f, -0.11345142f, -0.11416817f, -0.11486040f, -0.11552632f, -0.11616421f,
-    -0.11677235f, -0.11734910f, -0.11789283f, -0.11840198f, -0.11887503f, -0.11931055f, -0.11970712f, -0.12006342f,
-    -0.12037819f, -0.12065024f, -0.12087846f, -0.12106180f, -0.12119931f, -0.12129012f, -0.12133343f, -0.12132856f,
-    -0.12127489f, -0.12117192f, -0.12101923f, -0.12081650f, -0.12056352f, -0.12026017f, -0.11990645f, -0.11950245f,
-    -0.11904837f, -0.11854452f, -0.11799131f, -0.11738928f, -0.11673906f, -0.11604138f, -0.11529710f, -0.11450719f,
-    -0.11367271f, -0.11279485f, -0.11187488f, -0.11091419f, -0.10991428f, -0.10887675f, -0.10780330f, -0.10669571f,
-    -0.10555589f, -0.10438583f, -0.10318759f, -0.10196336f, -0.10071538f, -0.09944599f, -0.09815760f, -0.09685271f,
-    -0.09553388f, -0.09420374f, -0.09286497f, -0.09152032f, -0.09017261f, -0.08882469f, -0.08747944f, -0.08613982f,
-    -0.08480878f, -0.08348933f, -0.08218448f, -0.08089729f, -0.07963079f, -0.07838805f, -0.07717212f, -0.07598604f,
-    -0.07483287f, -0.07371561f, -0.07263726f, -0.07160078f, -0.07060910f, -0.06966509f, -0.06877160f, -0.06793140f,
-    -0.06714719f, -0.06642163f, -0.06575727f, -0.06515661f, -0.06462204f, -0.06415587f, -0.06376031f, -0.06343744f,
-    -0.06318926f, -0.06301764f, -0.06292431f, -0.06291091f, -0.06297890f, -0.06312963f, -0.06336431f, -0.06368398f,
-    -0.06408953f, -0.06458170f, -0.06516106f, -0.06582803f, -0.06658284f, -0.06742555f, -0.06835604f, -0.06937402f,
-    -0.07047902f, -0.07167035f, -0.07294717f, -0.07430844f, -0.07575291f, -0.07727916f, -0.07888556f, -0.08057029f,
-    -0.08233132f, -0.08416646f, -0.08607327f, -0.08804917f, -0.09009135f, -0.09219680f, -0.09436235f, -0.09658462f,
-    -0.09886002f, -0.10118482f, -0.10355508f, -0.10596666f, -0.10841528f, -0.11089647f, -0.11340557f, -0.11593780f,
-    -0.11848818f, -0.12105160f, -0.12362277f, -0.12619628f, -0.12876657f, -0.13132796f, -0.13387463f, -0.13640065f,
-    -0.13889995f, -0.14136641f, -0.14379375f, -0.14617564f, -0.14850565f, -0.15077729f, -0.15298399f, -0.15511913f,
-    -0.15717604f, -0.15914801f, -0.16102831f, -0.16281016f, -0.16448681f, -0.16605146f, -0.16749736f, -0.16881776f,
-    -0.17000594f, -0.17105519f, -0.17195890f, -0.17271046f, -0.17330338f, -0.17373120f, -0.17398757f, -0.17406624f,
-    -0.17396105f, -0.17366597f, -0.17317510f, -0.17248265f, -0.17158300f, -0.17047067f, -0.16914037f, -0.16758694f,
-    -0.16580545f, -0.16379111f, -0.16153938f, -0.15904589f, -0.15630651f, -0.15331733f, -0.15007465f, -0.14657503f,
-    -0.14281529f, -0.13879248f, -0.13450390f, -0.12994716f, -0.12512009f, -0.12002084f, -0.11464783f, -0.10899975f,
-    -0.10307561f, -0.09687469f, -0.09039660f, -0.08364122f, -0.07660878f, -0.06929977f, -0.06171503f, -0.05385570f,
-    -0.04572323f, -0.03731938f, -0.02864625f, -0.01970622f, -0.01050203f, -0.00103669f, 0.00868645f, 0.01866373f,
-    0.02889120f, 0.03936458f, 0.05007931f, 0.06103050f, 0.07221301f, 0.08362136f, 0.09524982f, 0.10709235f,
-    0.11914267f, 0.13139420f, 0.14384012f, 0.15647333f, 0.16928651f, 0.18227208f, 0.19542223f, 0.20872895f,
-    0.22218397f, 0.23577885f, 0.24950496f, 0.26335344f, 0.27731531f, 0.29138138f, 0.30554232f, 0.31978867f,
-    0.33411081f, 0.34849902f, 0.36294347f, 0.37743421f, 0.39196123f, 0.40651443f, 0.42108366f, 0.43565871f,
-    0.45022935f, 0.46478529f, 0.47931628f, 0.49381203f, 0.50826229f, 0.52265683f, 0.53698545f, 0.55123802f,
-    0.56540446f, 0.57947478f, 0.59343909f, 0.60728758f, 0.62101058f, 0.63459853f, 0.64804203f, 0.66133182f,
-    0.67445880f, 0.68741407f, 0.70018890f, 0.71277475f, 0.72516333f, 0.73734652f, 0.74931648f, 0.76106556f,
-    0.77258642f, 0.78387193f, 0.79491525f, 0.80570983f, 0.81624939f, 0.82652795f, 0.83653983f, 0.84627966f,
-    0.85574239f, 0.86492330f, 0.87381797f, 0.88242234f, 0.89073269f, 0.89874561f, 0.90645808f, 0.91386741f,
-    0.92097125f, 0.92776763f, 0.93425492f, 0.94043185f, 0.94629753f, 0.95185140f, 0.95709329f, 0.96202337f,
-    0.96664217f, 0.97095059f, 0.97494987f, 0.97864161f, 0.98202777f, 0.98511062f, 0.98789282f, 0.99037732f,
-    0.99256744f, 0.99446681f, 0.99607937f, 0.99740940f, 0.99846146f, 0.99924042f, 0.99975145f, 1.00000000f,
-    0.99999179f, 0.99973280f, 0.99922928f, 0.99848773f, 0.99751487f, 0.99631767f, 0.99490328f, 0.99327910f,
-    0.99145270f, 0.98943182f, 0.98722440f, 0.98483851f, 0.98228239f, 0.97956441f, 0.97669304f, 0.97367689f,
-    0.97052464f, 0.96724507f, 0.96384702f, 0.96033940f, 0.95673115f, 0.95303124f, 0.94924867f, 0.94539244f,
-    0.94147153f, 0.93749491f, 0.93347151f, 0.92941021f, 0.92531985f, 0.92120915f, 0.91708680f, 0.91296135f,
-    0.90884125f, 0.90473484f, 0.90065031f, 0.89659571f, 0.89257893f, 0.88860770f, 0.88468956f, 0.88083187f,
-    0.87704178f, 0.87332625f, 0.86969200f, 0.86614553f, 0.86269310f, 0.85934075f, 0.85609423f, 0.85295905f,
-    0.84994047f, 0.84704345f, 0.84427268f, 0.84163257f, 0.83912724f, 0.83676051f, 0.83453591f, 0.83245666f,
-    0.83052569f, 0.82874560f, 0.82711869f, 0.82564697f, 0.82433210f, 0.82317545f, 0.82217808f, 0.82134072f,
-    0.82066381f, 0.82014747f, 0.81979149f, 0.81959539f, 0.81955837f, 0.81967933f, 0.81995688f, 0.82038933f,
-    0.82097470f, 0.82171075f, 0.82259496f, 0.82362451f, 0.82479635f, 0.82610717f, 0.82755340f, 0.82913123f,
-    0.83083664f, 0.83266536f, 0.83461292f, 0.83667463f, 0.83884562f, 0.84112083f, 0.84349502f, 0.84596279f,
-    0.84851858f, 0.85115668f, 0.85387126f, 0.85665636f, 0.85950592f, 0.86241377f, 0.86537365f, 0.86837924f,
-    0.87142416f, 0.87450194f, 0.87760613f, 0.88073020f, 0.88386764f, 0.88701192f, 0.89015653f, 0.89329498f,
-    0.89642079f, 0.89952757f, 0.90260895f, 0.90565865f, 0.90867046f, 0.91163825f, 0.91455603f, 0.91741789f,
-    0.92021806f, 0.92295090f, 0.92561091f, 0.92819276f, 0.93069128f, 0.93310146f, 0.93541850f, 0.93763777f,
-    0.93975484f, 0.94176551f, 0.94366577f, 0.94545185f, 0.94712021f, 0.94866754f, 0.95009077f, 0.95138708f,
-    0.95255391f, 0.95358896f, 0.95449017f, 0.95525576f, 0.95588423f, 0.95637432f, 0.95672509f, 0.95693582f,
+alignas(4) const int16_t waveform_Clav[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+     29978,  29970,  29943,  29900,  29839,  29762,  29669,  29561,  29438,  29302,  29154,  28995,  28826,  28649,  28464,  28274,
+     28081,  27884,  27687,  27491,  27298,  27108,  26924,  26748,  26580,  26423,  26277,  26144,  26026,  25923,  25837,  25768,
+     25717,  25685,  25673,  25680,  25707,  25755,  25822,  25910,  26016,  26142,  26286,  26447,  26625,  26817,  27024,  27243,
+     27473,  27713,  27960,  28213,  28470,  28728,  28986,  29241,  29492,  29735,  29970,  30193,  30402,  30595,  30770,  30925,
+     31057,  31166,  31247,  31301,  31325,  31317,  31277,  31202,  31092,  30946,  30762,  30540,  30280,  29981,  29643,  29266,
+     28850,  28395,  27902,  27373,  26806,  26205,  25569,  24901,  24201,  23472,  22716,  21934,  21128,  20300,  19453,  18590,
+     17711,  16821,  15921,  15015,  14104,  13191,  12278,  11369,  10466,   9571,   8687,   7816,   6960,   6122,   5303,   4506,
+      3732,   2984,   2262,   1569,    905,    272,   -329,   -897,  -1432,  -1933,  -2400,  -2832,  -3229,  -3591,  -3919,  -4213,
+     -4474,  -4701,  -4896,  -5060,  -5194,  -5298,  -5375,  -5425,  -5449,  -5450,  -5429,  -5387,  -5325,  -5247,  -5153,  -5044,
+     -4924,  -4792,  -4652,  -4504,  -4351,  -4194,  -4034,  -3873,  -3712,  -3552,  -3396,  -3244,  -3097,  -2956,  -2822,  -2696,
+     -2579,  -2471,  -2373,  -2285,  -2208,  -2141,  -2086,  -2041,  -2008,  -1985,  -1973,  -1971,  -1979,  -1997,  -2024,  -2060,
+     -2103,  -2154,  -2212,  -2275,  -2344,  -2417,  -2494,  -2574,  -2657,  -2740,  -2825,  -2909,  -2993,  -3075,  -3155,  -3232,
+     -3307,  -3377,  -3443,  -3505,  -3561,  -3612,  -3657,  -3696,  -3729,  -3756,  -3777,  -3791,  -3799,  -3801,  -3797,  -3787,
+     -3771,  -3750,  -3724,  -3693,  -3658,  -3619,  -3576,  -3531,  -3482,  -3432,  -3380,  -3327,  -3273,  -3219,  -3164,  -3111,
+     -3059,  -3008,  -2959,  -2913,  -2869,  -2827,  -2790,  -2755,  -2725,  -2698,  -2675,  -2656,  -2642,  -2631,  -2625,  -2624,
+     -2626,  -2632,  -2643,  -2657,  -2674,  -2695,  -2719,  -2746,  -2775,  -2807,  -2841,  -2876,  -2913,  -2950,  -2988,  -3027,
+     -3066,  -3104,  -3141,  -3178,  -3213,  -3247,  -3279,  -3309,  -3337,  -3362,  -3385,  -3405,  -3422,  -3436,  -3447,  -3455,
+     -3459,  -3461,  -3460,  -3456,  -3448,  -3438,  -3426,  -3410,  -3393,  -3373,  -3351,  -3328,  -3303,  -3276,  -3249,  -3220,
+     -3192,  -3163,  -3133,  -3104,  -3076,  -3048,  -3021,  -2995,  -2970,  -2947,  -2925,  -2906,  -2888,  -2873,  -2859,  -2848,
+     -2839,  -2833,  -2829,  -2827,  -2828,  -2831,  -2836,  -2844,  -2853,  -2865,  -2878,  -2894,  -2911,  -2929,  -2948,  -2969,
+     -2990,  -3013,  -3035,  -3058,  -3081,  -3104,  -3127,  -3149,  -3171,  -3192,  -3212,  -3230,  -3247,  -3263,  -3278,  -3290,
+     -3301,  -3311,  -3318,  -3323,  -3327,  -3329,  -3328,  -3326,  -3322,  -3316,  -3309,  -3299,  -3289,  -3276,  -3263,  -3248,
+     -3232,  -3216,  -3198,  -3180,  -3162,  -3143,  -3124,  -3105,  -3087,  -3068,  -3051,  -3034,  -3017,  -3002,  -2987,  -2974,
+     -2962,  -2951,  -2942,  -2934,  -2928,  -2923,  -2920,  -2919,  -2919,  -2920,  -2924,  -2928,  -2934,  -2942,  -2951,  -2961,
+     -2972,  -2984,  -2997,  -3011,  -3025,  -3040,  -3056,  -3071,  -3087,  -3103,  -3119,  -3134,  -3149,  -3164,  -3177,  -3190,
+     -3203,  -3214,  -3224,  -3233,  -3241,  -3248,  -3254,  -3258,  -3261,  -3262,  -3262,  -3261,  -3259,  -3255,  -3250,  -3244,
+     -3236,  -3228,  -3218,  -3208,  -3197,  -3185,  -3173,  -3160,  -3147,  -3134,  -3120,  -3107,  -3093,  -3080,  -3067,  -3055,
+     -3043,  -3031,  -3021,  -3011,  -3002,  -2994,  -2987,  -2981,  -2976,  -2972,  -2970,  -2968,  -2968,  -2969,  -2971,  -2974,
+     -2978,  -2984,  -2990,  -2997,  -3005,  -3014,  -3023,  -3033,  -3044,  -3055,  -3066,  -3078,  -3090,  -3102,  -3113,  -3125,
+     -3136,  -3147,  -3158,  -3168,  -3177,  -3186,  -3194,  -3201,  -3207,  -3212,  -3217,  -3220,  -3223,  -3224,  -3224,  -3224,
+     -3222,  -3220,  -3216,  -3211,  -3206,  -3200,  -3193,  -3185,  -3177,  -3168,  -3159,  -3149,  -3139,  -3129,  -3118,  -3108,
+     -3098,  -3087,  -3077,  -3068,  -3058,  -3049,  -3041,  -3033,  -3026,  -3020,  -3014,  -3009,  -3005,  -3002,  -3000,  -2998,
+     -2998,  -2998,  -3000,  -3002,  -3005,  -3009,  -3013,  -3019,  -3025,  -3032,  -3039,  -3047,  -3055,  -3064,  -3073,  -3082,
+     -3091,  -3101,  -3110,  -3119,  -3128,  -3137,  -3145,  -3153,  -3161,  -3168,  -3175,  -3180,  -3186,  -3190,  -3194,  -3197,
+     -3199,  -3200,  -3201,  -3200,  -3199,  -3197,  -3195,  -3191,  -3187,  -3182,  -3177,  -3171,  -3164,  -3157,  -3150,  -3142,
+     -3134,  -3126,  -3117,  -3109,  -3101,  -3092,  -3084,  -3076,  -3068,  -3061,  -3054,  -3047,  -3041,  -3036,  -3031,  -3027,
+     -3024,  -3021,  -3019,  -3017,  -3017,  -3017,  -3018,  -3020,  -3022,  -3025,  -3029,  -3033,  -3038,  -3043,  -3049,  -3056,
+     -3062,  -3069,  -3077,  -3084,  -3092,  -3100,  -3107,  -3115,  -3123,  -3130,  -3137,  -3144,  -3150,  -3156,  -3162,  -3167,
+     -3171,  -3175,  -3179,  -3181,  -3183,  -3185,  -3185,  -3185,  -3184,  -3183,  -3181,  -3178,  -3175,  -3171,  -3166,  -3161,
+     -3156,  -3150,  -3144,  -3138,  -3131,  -3124,  -3117,  -3110,  -3103,  -3095,  -3088,  -3082,  -3075,  -3069,  -3063,  -3057,
+     -3052,  -3047,  -3043,  -3039,  -3036,  -3034,  -3032,  -3030,  -3030,  -3030,  -3030,  -3032,  -3033,  -3036,  -3039,  -3042,
+     -3047,  -3051,  -3056,  -3061,  -3067,  -3073,  -3079,  -3086,  -3092,  -3099,  -3106,  -3112,  -3119,  -3125,  -3131,  -3137,
+     -3143,  -3148,  -3153,  -3158,  -3162,  -3165,  -3168,  -3171,  -3173,  -3174,  -3174,  -3175,  -3174,  -3173,  -3171,  -3169,
+     -3166,  -3163,  -3159,  -3155,  -3151,  -3146,  -3140,  -3135,  -3129,  -3123,  -3117,  -3110,  -3104,  -3098,  -3092,  -3086,
+     -3080,  -3074,  -3069,  -3064,  -3059,  -3055,  -3051,  -3048,  -3045,  -3042,  -3041,  -3039,  -3039,  -3038,  -3039,  -3040,
+     -3041,  -3043,  -3046,  -3049,  -3052,  -3056,  -3061,  -3065,  -3070,  -3075,  -3081,  -3087,  -3092,  -3098,  -3104,  -3110,
+     -3116,  -3122,  -3127,  -3133,  -3138,  -3143,  -3147,  -3151,  -3155,  -3158,  -3161,  -3163,  -3165,  -3166,  -3167,  -3167,
+     -3167,  -3166,  -3165,  -3163,  -3161,  -3158,  -3155,  -3151,  -3147,  -3142,  -3138,  -3133,  -3128,  -3122,  -3117,  -3111,
+     -3105,  -3100,  -3094,  -3089,  -3083,  -3078,  -3073,  -3069,  -3064,  -3060,  -3057,  -3054,  -3051,  -3049,  -3047,  -3046,
+     -3045,  -3045,  -3045,  -3045,  -3047,  -3048,  -3051,  -3053,  -3056,  -3060,  -3064,  -3068,  -3072,  -3077,  -3082,  -3087,
+     -3092,  -3098,  -3103,  -3109,  -3114,  -3119,  -3124,  -3129,  -3134,  -3138,  -3143,  -3147,  -3150,  -3153,  -3156,  -3158,
+     -3160,  -3161,  -3162,  -3162,  -3162,  -3162,  -3160,  -3159,  -3157,  -3154,  -3151,  -3148,  -3144,  -3141,  -3136,  -3132,
+     -3127,  -3122,  -3117,  -3112,  -3107,  -3101,  -3096,  -3091,  -3086,  -3081,  -3077,  -3072,  -3068,  -3064,  -3061,  -3058,
+     -3055,  -3053,  -3051,  -3050,  -3049,  -3049,  -3049,  -3049,  -3050,  -3052,  -3054,  -3056,  -3059,  -3062,  -3065,  -3069,
+     -3073,  -3078,  -3082,  -3087,  -3092,  -3097,  -3102,  -3107,  -3112,  -3117,  -3122,  -3127,  -3131,  -3136,  -3140,  -3143,
+     -3147,  -3150,  -3152,  -3155,  -3156,  -3158,  -3159,  -3159,  -3159,  -3159,  -3158,  -3156,  -3154,  -3152,  -3150,  -3147,
+     -3143,  -3139,  -3135,  -3131,  -3127,  -3122,  -3117,  -3112,  -3108,  -3103,  -3098,  -3093,  -3088,  -3083,  -3079,  -3075,
+     -3071,  -3067,  -3064,  -3061,  -3058,  -3056,  -3054,  -3053,  -3052,  -3051,  -3051,  -3052,  -3052,  -3054,  -3055,  -3058,
+     -3060,  -3063,  -3066,  -3070,  -3074,  -3078,  -3082,  -3087,  -3091,  -3096,  -3101,  -3106,  -3111,  -3116,  -3120,  -3125,
+     -3129,  -3133,  -3137,  -3141,  -3144,  -3147,  -3150,  -3152,  -3154,  -3156,  -3157,  -3157,  -3157,  -3157,  -3156,  -3155,
+     -3153,  -3151,  -3149,  -3146,  -3143,  -3139,  -3135,  -3131,  -3127,  -3123,  -3118,  -3113,  -3109,  -3104,  -3099,  -3094,
+     -3089,  -3085,  -3081,  -3076,  -3072,  -3069,  -3065,  -3062,  -3060,  -3057,  -3056,  -3054,  -3053,  -3052,  -3052,  -3053,
+     -3053,  -3054,  -3056,  -3058,  -3060,  -3063,  -3066,  -3070,  -3073,  -3077,  -3082,  -3086,  -3091,  -3095,  -3100,  -3105,
+     -3110,  -3114,  -3119,  -3124,  -3128,  -3132,  -3136,  -3140,  -3143,  -3146,  -3149,  -3151,  -3153,  -3155,  -3156,  -3156,
+     -3157,  -3156,  -3156,  -3155,  -3153,  -3151,  -3149,  -3146,  -3143,  -3140,  -3136,  -3132,  -3128,  -3124,  -3119,  -3114,
+     -3110,  -3105,  -3100,  -3095,  -3091,  -3086,  -3082,  -3077,  -3073,  -3070,  -3066,  -3063,  -3060,  -3058,  -3056,  -3054,
+     -3053,  -3053,  -3052,  -3052,  -3053,  -3054,  -3056,  -3057,  -3060,  -3062,  -3065,  -3069,  -3072,  -3076,  -3081,  -3085,
+     -3089,  -3094,  -3099,  -3104,  -3109,  -3113,  -3118,  -3123,  -3127,  -3131,  -3135,  -3139,  -3143,  -3146,  -3149,  -3151,
+     -3153,  -3155,  -3156,  -3157,  -3157,  -3157,  -3157,  -3156,  -3154,  -3152,  -3150,  -3147,  -3144,  -3141,  -3137,  -3133,
+     -3129,  -3125,  -3120,  -3116,  -3111,  -3106,  -3101,  -3096,  -3091,  -3087,  -3082,  -3078,  -3074,  -3070,  -3066,  -3063,
+     -3060,  -3058,  -3055,  -3054,  -3052,  -3052,  -3051,  -3051,  -3052,  -3053,  -3054,  -3056,  -3058,  -3061,  -3064,  -3067,
+     -3071,  -3075,  -3079,  -3083,  -3088,  -3093,  -3098,  -3103,  -3108,  -3112,  -3117,  -3122,  -3127,  -3131,  -3135,  -3139,
+     -3143,  -3147,  -3150,  -3152,  -3154,  -3156,  -3158,  -3159,  -3159,  -3159,  -3159,  -3158,  -3156,  -3155,  -3152,  -3150,
+     -3147,  -3143,  -3140,  -3136,  -3131,  -3127,  -3122,  -3117,  -3112,  -3107,  -3102,  -3097,  -3092,  -3087,  -3082,  -3078,
+     -3073,  -3069,  -3065,  -3062,  -3059,  -3056,  -3054,  -3052,  -3050,  -3049,  -3049,  -3049,  -3049,  -3050,  -3051,  -3053,
+     -3055,  -3058,  -3061,  -3064,  -3068,  -3072,  -3077,  -3081,  -3086,  -3091,  -3096,  -3101,  -3107,  -3112,  -3117,  -3122,
+     -3127,  -3132,  -3136,  -3141,  -3144,  -3148,  -3151,  -3154,  -3157,  -3159,  -3160,  -3162,  -3162,  -3162,  -3162,  -3161,
+     -3160,  -3158,  -3156,  -3153,  -3150,  -3147,  -3143,  -3138,  -3134,  -3129,  -3124,  -3119,  -3114,  -3109,  -3103,  -3098,
+     -3092,  -3087,  -3082,  -3077,  -3072,  -3068,  -3064,  -3060,  -3056,  -3053,  -3051,  -3048,  -3047,  -3045,  -3045,  -3045,
+     -3045,  -3046,  -3047,  -3049,  -3051,  -3054,  -3057,  -3060,  -3064,  -3069,  -3073,  -3078,  -3083,  -3089,  -3094,  -3100,
+     -3105,  -3111,  -3117,  -3122,  -3128,  -3133,  -3138,  -3142,  -3147,  -3151,  -3155,  -3158,  -3161,  -3163,  -3165,  -3166,
+     -3167,  -3167,  -3167,  -3166,  -3165,  -3163,  -3161,  -3158,  -3155,  -3151,  -3147,  -3143,  -3138,  -3133,  -3127,  -3122,
+     -3116,  -3110,  -3104,  -3098,  -3092,  -3087,  -3081,  -3075,  -3070,  -3065,  -3061,  -3056,  -3052,  -3049,  -3046,  -3043,
+     -3041,  -3040,  -3039,  -3038,  -3039,  -3039,  -3041,  -3042,  -3045,  -3048,  -3051,  -3055,  -3059,  -3064,  -3069,  -3074,
+     -3080,  -3086,  -3092,  -3098,  -3104,  -3110,  -3117,  -3123,  -3129,  -3135,  -3140,  -3146,  -3151,  -3155,  -3159,  -3163,
+     -3166,  -3169,  -3171,  -3173,  -3174,  -3175,  -3174,  -3174,  -3173,  -3171,  -3168,  -3165,  -3162,  -3158,  -3153,  -3148,
+     -3143,  -3137,  -3131,  -3125,  -3119,  -3112,  -3106,  -3099,  -3092,  -3086,  -3079,  -3073,  -3067,  -3061,  -3056,  -3051,
+     -3047,  -3042,  -3039,  -3036,  -3033,  -3032,  -3030,  -3030,  -3030,  -3030,  -3032,  -3034,  -3036,  -3039,  -3043,  -3047,
+     -3052,  -3057,  -3063,  -3069,  -3075,  -3082,  -3088,  -3095,  -3103,  -3110,  -3117,  -3124,  -3131,  -3138,  -3144,  -3150,
+     -3156,  -3161,  -3166,  -3171,  -3175,  -3178,  -3181,  -3183,  -3184,  -3185,  -3185,  -3185,  -3183,  -3181,  -3179,  -3175,
+     -3171,  -3167,  -3162,  -3156,  -3150,  -3144,  -3137,  -3130,  -3123,  -3115,  -3107,  -3100,  -3092,  -3084,  -3077,  -3069,
+     -3062,  -3056,  -3049,  -3043,  -3038,  -3033,  -3029,  -3025,  -3022,  -3020,  -3018,  -3017,  -3017,  -3017,  -3019,  -3021,
+     -3024,  -3027,  -3031,  -3036,  -3041,  -3047,  -3054,  -3061,  -3068,  -3076,  -3084,  -3092,  -3101,  -3109,  -3117,  -3126,
+     -3134,  -3142,  -3150,  -3157,  -3164,  -3171,  -3177,  -3182,  -3187,  -3191,  -3195,  -3197,  -3199,  -3200,  -3201,  -3200,
+     -3199,  -3197,  -3194,  -3190,  -3186,  -3180,  -3175,  -3168,  -3161,  -3153,  -3145,  -3137,  -3128,  -3119,  -3110,  -3101,
+     -3091,  -3082,  -3073,  -3064,  -3055,  -3047,  -3039,  -3032,  -3025,  -3019,  -3013,  -3009,  -3005,  -3002,  -3000,  -2998,
+     -2998,  -2998,  -3000,  -3002,  -3005,  -3009,  -3014,  -3020,  -3026,  -3033,  -3041,  -3049,  -3058,  -3068,  -3077,  -3087,
+     -3098,  -3108,  -3118,  -3129,  -3139,  -3149,  -3159,  -3168,  -3177,  -3185,  -3193,  -3200,  -3206,  -3211,  -3216,  -3220,
+     -3222,  -3224,  -3224,  -3224,  -3223,  -3220,  -3217,  -3212,  -3207,  -3201,  -3194,  -3186,  -3177,  -3168,  -3158,  -3147,
+     -3136,  -3125,  -3113,  -3102,  -3090,  -3078,  -3066,  -3055,  -3044,  -3033,  -3023,  -3014,  -3005,  -2997,  -2990,  -2984,
+     -2978,  -2974,  -2971,  -2969,  -2968,  -2968,  -2970,  -2972,  -2976,  -2981,  -2987,  -2994,  -3002,  -3011,  -3021,  -3031,
+     -3043,  -3055,  -3067,  -3080,  -3093,  -3107,  -3120,  -3134,  -3147,  -3160,  -3173,  -3185,  -3197,  -3208,  -3218,  -3228,
+     -3236,  -3244,  -3250,  -3255,  -3259,  -3261,  -3262,  -3262,  -3261,  -3258,  -3254,  -3248,  -3241,  -3233,  -3224,  -3214,
+     -3203,  -3190,  -3177,  -3164,  -3149,  -3134,  -3119,  -3103,  -3087,  -3071,  -3056,  -3040,  -3025,  -3011,  -2997,  -2984,
+     -2972,  -2961,  -2951,  -2942,  -2934,  -2928,  -2924,  -2920,  -2919,  -2919,  -2920,  -2923,  -2928,  -2934,  -2942,  -2951,
+     -2962,  -2974,  -2987,  -3002,  -3017,  -3034,  -3051,  -3068,  -3087,  -3105,  -3124,  -3143,  -3162,  -3180,  -3198,  -3216,
+     -3232,  -3248,  -3263,  -3276,  -3289,  -3299,  -3309,  -3316,  -3322,  -3326,  -3328,  -3329,  -3327,  -3323,  -3318,  -3311,
+     -3301,  -3290,  -3278,  -3263,  -3247,  -3230,  -3212,  -3192,  -3171,  -3149,  -3127,  -3104,  -3081,  -3058,  -3035,  -3013,
+     -2990,  -2969,  -2948,  -2929,  -2911,  -2894,  -2878,  -2865,  -2853,  -2844,  -2836,  -2831,  -2828,  -2827,  -2829,  -2833,
+     -2839,  -2848,  -2859,  -2873,  -2888,  -2906,  -2925,  -2947,  -2970,  -2995,  -3021,  -3048,  -3076,  -3104,  -3133,  -3163,
+     -3192,  -3220,  -3249,  -3276,  -3303,  -3328,  -3351,  -3373,  -3393,  -3410,  -3426,  -3438,  -3448,  -3456,  -3460,  -3461,
+     -3459,  -3455,  -3447,  -3436,  -3422,  -3405,  -3385,  -3362,  -3337,  -3309,  -3279,  -3247,  -3213,  -3178,  -3141,  -3104,
+     -3066,  -3027,  -2988,  -2950,  -2913,  -2876,  -2841,  -2807,  -2775,  -2746,  -2719,  -2695,  -2674,  -2657,  -2643,  -2632,
+     -2626,  -2624,  -2625,  -2631,  -2642,  -2656,  -2675,  -2698,  -2725,  -2755,  -2790,  -2827,  -2869,  -2913,  -2959,  -3008,
+     -3059,  -3111,  -3164,  -3219,  -3273,  -3327,  -3380,  -3432,  -3482,  -3531,  -3576,  -3619,  -3658,  -3693,  -3724,  -3750,
+     -3771,  -3787,  -3797,  -3801,  -3799,  -3791,  -3777,  -3756,  -3729,  -3696,  -3657,  -3612,  -3561,  -3505,  -3443,  -3377,
+     -3307,  -3232,  -3155,  -3075,  -2993,  -2909,  -2825,  -2740,  -2657,  -2574,  -2494,  -2417,  -2344,  -2275,  -2212,  -2154,
+     -2103,  -2060,  -2024,  -1997,  -1979,  -1971,  -1973,  -1985,  -2008,  -2041,  -2086,  -2141,  -2208,  -2285,  -2373,  -2471,
+     -2579,  -2696,  -2822,  -2956,  -3097,  -3244,  -3396,  -3552,  -3712,  -3873,  -4034,  -4194,  -4351,  -4504,  -4652,  -4792,
+     -4924,  -5044,  -5153,  -5247,  -5325,  -5387,  -5429,  -5450,  -5449,  -5425,  -5375,  -5298,  -5194,  -5060,  -4896,  -4701,
+     -4474,  -4213,  -3919,  -3591,  -3229,  -2832,  -2400,  -1933,  -1432,   -897,   -329,    272,    905,   1569,   2262,   2984,
+      3732,   4506,   5303,   6122,   6960,   7816,   8687,   9571,  10466,  11369,  12278,  13191,  14104,  15015,  15921,  16821,
+     17711,  18590,  19453,  20300,  21128,  21934,  22716,  23472,  24201,  24901,  25569,  26205,  26806,  27373,  27902,  28395,
+     28850,  29266,  29643,  29981,  30280,  30540,  30762,  30946,  31092,  31202,  31277,  31317,  31325,  31301,  31247,  31166,
+     31057,  30925,  30770,  30595,  30402,  30193,  29970,  29735,  29492,  29241,  28986,  28728,  28470,  28213,  27960,  27713,
+     27473,  27243,  27024,  26817,  26625,  26447,  26286,  26142,  26016,  25910,  25822,  25755,  25707,  25680,  25673,  25685,
+     25717,  25768,  25837,  25923,  26026,  26144,  26277,  26423,  26580,  26748,  26924,  27108,  27298,  27491,  27687,  27884,
+     28081,  28274,  28464,  28649,  28826,  28995,  29154,  29302,  29438,  29561,  29669,  29762,  29839,  29900,  29943,  29970,
+    
+    // Level 1: 1024 samples, 511 harmonics
+     29978,  29943,  29839,  29669,  29438,  29154,  28826,  28464,  28081,  27687,  27298,  26924,  26580,  26277,  26026,  25837,
+     25717,  25673,  25707,  25822,  26016,  26286,  26625,  27024,  27473,  27960,  28470,  28986,  29492,  29970,  30402,  30770,
+     31057,  31247,  31325,  31277,  31092,  30762,  30280,  29643,  28850,  27902,  26806,  25569,  24201,  22716,  21128,  19453,
+     17711,  15921,  14104,  12278,  10466,   8687,   6960,   5303,   3732,   2262,    905,   -329,  -1432,  -2400,  -3229,  -3919,
+     -4474,  -4896,  -5194,  -5375,  -5449,  -5429,  -5325,  -5153,  -4924,  -4652,  -4351,  -4034,  -3712,  -3396,  -3097,  -2822,
+     -2579,  -2373,  -2208,  -2086,  -2008,  -1973,  -1979,  -2024,  -2103,  -2212,  -2344,  -2494,  -2657,  -2825,  -2993,  -3155,
+     -3307,  -3443,  -3561,  -3657,  -3729,  -3777,  -3799,  -3797,  -3771,  -3724,  -3658,  -3576,  -3482,  -3380,  -3273,  -3164,
+     -3059,  -2959,  -2869,  -2790,  -2725,  -2675,  -2642,  -2625,  -2626,  -2643,  -2674,  -2719,  -2775,  -2841,  -2913,  -2988,
+     -3066,  -3141,  -3213,  -3279,  -3337,  -3385,  -3422,  -3447,  -3459,  -3460,  -3448,  -3426,  -3393,  -3351,  -3303,  -3249,
+     -3192,  -3133,  -3076,  -3021,  -2970,  -2925,  -2888,  -2859,  -2839,  -2829,  -2828,  -2836,  -2853,  -2878,  -2911,  -2948,
+     -2990,  -3035,  -3081,  -3127,  -3171,  -3212,  -3247,  -3278,  -3301,  -3318,  -3327,  -3328,  -3322,  -3309,  -3289,  -3263,
+     -3232,  -3198,  -3162,  -3124,  -3087,  -3051,  -3017,  -2987,  -2962,  -2942,  -2928,  -2920,  -2919,  -2924,  -2934,  -2951,
+     -2972,  -2997,  -3025,  -3056,  -3087,  -3119,  -3149,  -3177,  -3203,  -3224,  -3241,  -3254,  -3261,  -3262,  -3259,  -3250,
+     -3236,  -3218,  -3197,  -3173,  -3147,  -3120,  -3093,  -3067,  -3043,  -3021,  -3002,  -2987,  -2976,  -2970,  -2968,  -2971,
+     -2978,  -2990,  -3005,  -3023,  -3044,  -3066,  -3090,  -3113,  -3136,  -3158,  -3177,  -3194,  -3207,  -3217,  -3223,  -3224,
+     -3222,  -3216,  -3206,  -3193,  -3177,  -3159,  -3139,  -3118,  -3098,  -3077,  -3058,  -3041,  -3026,  -3014,  -3005,  -3000,
+     -2998,  -3000,  -3005,  -3013,  -3025,  -3039,  -3055,  -3073,  -3091,  -3110,  -3128,  -3145,  -3161,  -3175,  -3186,  -3194,
+     -3199,  -3201,  -3199,  -3195,  -3187,  -3177,  -3164,  -3150,  -3134,  -3117,  -3101,  -3084,  -3068,  -3054,  -3041,  -3031,
+     -3024,  -3019,  -3017,  -3018,  -3022,  -3029,  -3038,  -3049,  -3062,  -3077,  -3092,  -3107,  -3123,  -3137,  -3150,  -3162,
+     -3171,  -3179,  -3183,  -3185,  -3184,  -3181,  -3175,  -3166,  -3156,  -3144,  -3131,  -3117,  -3103,  -3088,  -3075,  -3063,
+     -3052,  -3043,  -3036,  -3032,  -3030,  -3030,  -3033,  -3039,  -3047,  -3056,  -3067,  -3079,  -3092,  -3106,  -3119,  -3131,
+     -3143,  -3153,  -3162,  -3168,  -3173,  -3174,  -3174,  -3171,  -3166,  -3159,  -3151,  -3140,  -3129,  -3117,  -3104,  -3092,
+     -3080,  -3069,  -3059,  -3051,  -3045,  -3041,  -3039,  -3039,  -3041,  -3046,  -3052,  -3061,  -3070,  -3081,  -3092,  -3104,
+     -3116,  -3127,  -3138,  -3147,  -3155,  -3161,  -3165,  -3167,  -3167,  -3165,  -3161,  -3155,  -3147,  -3138,  -3128,  -3117,
+     -3105,  -3094,  -3083,  -3073,  -3064,  -3057,  -3051,  -3047,  -3045,  -3045,  -3047,  -3051,  -3056,  -3064,  -3072,  -3082,
+     -3092,  -3103,  -3114,  -3124,  -3134,  -3143,  -3150,  -3156,  -3160,  -3162,  -3162,  -3160,  -3157,  -3151,  -3144,  -3136,
+     -3127,  -3117,  -3107,  -3096,  -3086,  -3077,  -3068,  -3061,  -3055,  -3051,  -3049,  -3049,  -3050,  -3054,  -3059,  -3065,
+     -3073,  -3082,  -3092,  -3102,  -3112,  -3122,  -3131,  -3140,  -3147,  -3152,  -3156,  -3159,  -3159,  -3158,  -3154,  -3150,
+     -3143,  -3135,  -3127,  -3117,  -3108,  -3098,  -3088,  -3079,  -3071,  -3064,  -3058,  -3054,  -3052,  -3051,  -3052,  -3055,
+     -3060,  -3066,  -3074,  -3082,  -3091,  -3101,  -3111,  -3120,  -3129,  -3137,  -3144,  -3150,  -3154,  -3157,  -3157,  -3156,
+     -3153,  -3149,  -3143,  -3135,  -3127,  -3118,  -3109,  -3099,  -3089,  -3081,  -3072,  -3065,  -3060,  -3056,  -3053,  -3052,
+     -3053,  -3056,  -3060,  -3066,  -3073,  -3082,  -3091,  -3100,  -3110,  -3119,  -3128,  -3136,  -3143,  -3149,  -3153,  -3156,
+     -3157,  -3156,  -3153,  -3149,  -3143,  -3136,  -3128,  -3119,  -3110,  -3100,  -3091,  -3082,  -3073,  -3066,  -3060,  -3056,
+     -3053,  -3052,  -3053,  -3056,  -3060,  -3065,  -3072,  -3081,  -3089,  -3099,  -3109,  -3118,  -3127,  -3135,  -3143,  -3149,
+     -3153,  -3156,  -3157,  -3157,  -3154,  -3150,  -3144,  -3137,  -3129,  -3120,  -3111,  -3101,  -3091,  -3082,  -3074,  -3066,
+     -3060,  -3055,  -3052,  -3051,  -3052,  -3054,  -3058,  -3064,  -3071,  -3079,  -3088,  -3098,  -3108,  -3117,  -3127,  -3135,
+     -3143,  -3150,  -3154,  -3158,  -3159,  -3159,  -3156,  -3152,  -3147,  -3140,  -3131,  -3122,  -3112,  -3102,  -3092,  -3082,
+     -3073,  -3065,  -3059,  -3054,  -3050,  -3049,  -3049,  -3051,  -3055,  -3061,  -3068,  -3077,  -3086,  -3096,  -3107,  -3117,
+     -3127,  -3136,  -3144,  -3151,  -3157,  -3160,  -3162,  -3162,  -3160,  -3156,  -3150,  -3143,  -3134,  -3124,  -3114,  -3103,
+     -3092,  -3082,  -3072,  -3064,  -3056,  -3051,  -3047,  -3045,  -3045,  -3047,  -3051,  -3057,  -3064,  -3073,  -3083,  -3094,
+     -3105,  -3117,  -3128,  -3138,  -3147,  -3155,  -3161,  -3165,  -3167,  -3167,  -3165,  -3161,  -3155,  -3147,  -3138,  -3127,
+     -3116,  -3104,  -3092,  -3081,  -3070,  -3061,  -3052,  -3046,  -3041,  -3039,  -3039,  -3041,  -3045,  -3051,  -3059,  -3069,
+     -3080,  -3092,  -3104,  -3117,  -3129,  -3140,  -3151,  -3159,  -3166,  -3171,  -3174,  -3174,  -3173,  -3168,  -3162,  -3153,
+     -3143,  -3131,  -3119,  -3106,  -3092,  -3079,  -3067,  -3056,  -3047,  -3039,  -3033,  -3030,  -3030,  -3032,  -3036,  -3043,
+     -3052,  -3063,  -3075,  -3088,  -3103,  -3117,  -3131,  -3144,  -3156,  -3166,  -3175,  -3181,  -3184,  -3185,  -3183,  -3179,
+     -3171,  -3162,  -3150,  -3137,  -3123,  -3107,  -3092,  -3077,  -3062,  -3049,  -3038,  -3029,  -3022,  -3018,  -3017,  -3019,
+     -3024,  -3031,  -3041,  -3054,  -3068,  -3084,  -3101,  -3117,  -3134,  -3150,  -3164,  -3177,  -3187,  -3195,  -3199,  -3201,
+     -3199,  -3194,  -3186,  -3175,  -3161,  -3145,  -3128,  -3110,  -3091,  -3073,  -3055,  -3039,  -3025,  -3013,  -3005,  -3000,
+     -2998,  -3000,  -3005,  -3014,  -3026,  -3041,  -3058,  -3077,  -3098,  -3118,  -3139,  -3159,  -3177,  -3193,  -3206,  -3216,
+     -3222,  -3224,  -3223,  -3217,  -3207,  -3194,  -3177,  -3158,  -3136,  -3113,  -3090,  -3066,  -3044,  -3023,  -3005,  -2990,
+     -2978,  -2971,  -2968,  -2970,  -2976,  -2987,  -3002,  -3021,  -3043,  -3067,  -3093,  -3120,  -3147,  -3173,  -3197,  -3218,
+     -3236,  -3250,  -3259,  -3262,  -3261,  -3254,  -3241,  -3224,  -3203,  -3177,  -3149,  -3119,  -3087,  -3056,  -3025,  -2997,
+     -2972,  -2951,  -2934,  -2924,  -2919,  -2920,  -2928,  -2942,  -2962,  -2987,  -3017,  -3051,  -3087,  -3124,  -3162,  -3198,
+     -3232,  -3263,  -3289,  -3309,  -3322,  -3328,  -3327,  -3318,  -3301,  -3278,  -3247,  -3212,  -3171,  -3127,  -3081,  -3035,
+     -2990,  -2948,  -2911,  -2878,  -2853,  -2836,  -2828,  -2829,  -2839,  -2859,  -2888,  -2925,  -2970,  -3021,  -3076,  -3133,
+     -3192,  -3249,  -3303,  -3351,  -3393,  -3426,  -3448,  -3460,  -3459,  -3447,  -3422,  -3385,  -3337,  -3279,  -3213,  -3141,
+     -3066,  -2988,  -2913,  -2841,  -2775,  -2719,  -2674,  -2643,  -2626,  -2625,  -2642,  -2675,  -2725,  -2790,  -2869,  -2959,
+     -3059,  -3164,  -3273,  -3380,  -3482,  -3576,  -3658,  -3724,  -3771,  -3797,  -3799,  -3777,  -3729,  -3657,  -3561,  -3443,
+     -3307,  -3155,  -2993,  -2825,  -2657,  -2494,  -2344,  -2212,  -2103,  -2024,  -1979,  -1973,  -2008,  -2086,  -2208,  -2373,
+     -2579,  -2822,  -3097,  -3396,  -3712,  -4034,  -4351,  -4652,  -4924,  -5153,  -5325,  -5429,  -5449,  -5375,  -5194,  -4896,
+     -4474,  -3919,  -3229,  -2400,  -1432,   -329,    905,   2262,   3732,   5303,   6960,   8687,  10466,  12278,  14104,  15921,
+     17711,  19453,  21128,  22716,  24201,  25569,  26806,  27902,  28850,  29643,  30280,  30762,  31092,  31277,  31325,  31247,
+     31057,  30770,  30402,  29970,  29492,  28986,  28470,  27960,  27473,  27024,  26625,  26286,  26016,  25822,  25707,  25673,
+     25717,  25837,  26026,  26277,  26580,  26924,  27298,  27687,  28081,  28464,  28826,  29154,  29438,  29669,  29839,  29943,
+    
+    // Level 2: 512 samples, 255 harmonics
+     29978,  29839,  29438,  28826,  28081,  27298,  26580,  26026,  25717,  25707,  26016,  26625,  27473,  28470,  29492,  30402,
+     31057,  31325,  31092,  30280,  28850,  26806,  24201,  21128,  17711,  14104,  10466,   6960,   3732,    905,  -1432,  -3229,
+     -4474,  -5194,  -5449,  -5325,  -4924,  -4351,  -3712,  -3097,  -2579,  -2208,  -2008,  -1979,  -2103,  -2344,  -2657,  -2993,
+     -3307,  -3561,  -3729,  -3799,  -3771,  -3658,  -3482,  -3273,  -3059,  -2869,  -2725,  -2642,  -2626,  -2674,  -2775,  -2913,
+     -3066,  -3213,  -3337,  -3422,  -3459,  -3448,  -3393,  -3303,  -3192,  -3076,  -2970,  -2888,  -2839,  -2828,  -2853,  -2911,
+     -2990,  -3081,  -3171,  -3247,  -3301,  -3327,  -3322,  -3289,  -3232,  -3162,  -3087,  -3017,  -2962,  -2928,  -2919,  -2934,
+     -2972,  -3025,  -3087,  -3149,  -3203,  -3241,  -3261,  -3259,  -3236,  -3197,  -3147,  -3093,  -3043,  -3002,  -2976,  -2968,
+     -2978,  -3005,  -3044,  -3090,  -3136,  -3177,  -3207,  -3223,  -3222,  -3206,  -3177,  -3139,  -3098,  -3058,  -3026,  -3005,
+     -2998,  -3005,  -3025,  -3055,  -3091,  -3128,  -3161,  -3186,  -3199,  -3199,  -3187,  -3164,  -3134,  -3101,  -3068,  -3041,
+     -3024,  -3017,  -3022,  -3038,  -3062,  -3092,  -3123,  -3150,  -3171,  -3183,  -3184,  -3175,  -3156,  -3131,  -3103,  -3075,
+     -3052,  -3036,  -3030,  -3033,  -3047,  -3067,  -3092,  -3119,  -3143,  -3162,  -3173,  -3174,  -3166,  -3151,  -3129,  -3104,
+     -3080,  -3059,  -3045,  -3039,  -3041,  -3052,  -3070,  -3092,  -3116,  -3138,  -3155,  -3165,  -3167,  -3161,  -3147,  -3128,
+     -3105,  -3083,  -3064,  -3051,  -3045,  -3047,  -3056,  -3072,  -3092,  -3114,  -3134,  -3150,  -3160,  -3162,  -3157,  -3144,
+     -3127,  -3107,  -3086,  -3068,  -3055,  -3049,  -3050,  -3059,  -3073,  -3092,  -3112,  -3131,  -3147,  -3156,  -3159,  -3154,
+     -3143,  -3127,  -3108,  -3088,  -3071,  -3058,  -3052,  -3052,  -3060,  -3074,  -3091,  -3111,  -3129,  -3144,  -3154,  -3157,
+     -3153,  -3143,  -3127,  -3109,  -3089,  -3072,  -3060,  -3053,  -3053,  -3060,  -3073,  -3091,  -3110,  -3128,  -3143,  -3153,
+     -3157,  -3153,  -3143,  -3128,  -3110,  -3091,  -3073,  -3060,  -3053,  -3053,  -3060,  -3072,  -3089,  -3109,  -3127,  -3143,
+     -3153,  -3157,  -3154,  -3144,  -3129,  -3111,  -3091,  -3074,  -3060,  -3052,  -3052,  -3058,  -3071,  -3088,  -3108,  -3127,
+     -3143,  -3154,  -3159,  -3156,  -3147,  -3131,  -3112,  -3092,  -3073,  -3059,  -3050,  -3049,  -3055,  -3068,  -3086,  -3107,
+     -3127,  -3144,  -3157,  -3162,  -3160,  -3150,  -3134,  -3114,  -3092,  -3072,  -3056,  -3047,  -3045,  -3051,  -3064,  -3083,
+     -3105,  -3128,  -3147,  -3161,  -3167,  -3165,  -3155,  -3138,  -3116,  -3092,  -3070,  -3052,  -3041,  -3039,  -3045,  -3059,
+     -3080,  -3104,  -3129,  -3151,  -3166,  -3174,  -3173,  -3162,  -3143,  -3119,  -3092,  -3067,  -3047,  -3033,  -3030,  -3036,
+     -3052,  -3075,  -3103,  -3131,  -3156,  -3175,  -3184,  -3183,  -3171,  -3150,  -3123,  -3092,  -3062,  -3038,  -3022,  -3017,
+     -3024,  -3041,  -3068,  -3101,  -3134,  -3164,  -3187,  -3199,  -3199,  -3186,  -3161,  -3128,  -3091,  -3055,  -3025,  -3005,
+     -2998,  -3005,  -3026,  -3058,  -3098,  -3139,  -3177,  -3206,  -3222,  -3223,  -3207,  -3177,  -3136,  -3090,  -3044,  -3005,
+     -2978,  -2968,  -2976,  -3002,  -3043,  -3093,  -3147,  -3197,  -3236,  -3259,  -3261,  -3241,  -3203,  -3149,  -3087,  -3025,
+     -2972,  -2934,  -2919,  -2928,  -2962,  -3017,  -3087,  -3162,  -3232,  -3289,  -3322,  -3327,  -3301,  -3247,  -3171,  -3081,
+     -2990,  -2911,  -2853,  -2828,  -2839,  -2888,  -2970,  -3076,  -3192,  -3303,  -3393,  -3448,  -3459,  -3422,  -3337,  -3213,
+     -3066,  -2913,  -2775,  -2674,  -2626,  -2642,  -2725,  -2869,  -3059,  -3273,  -3482,  -3658,  -3771,  -3799,  -3729,  -3561,
+     -3307,  -2993,  -2657,  -2344,  -2103,  -1979,  -2008,  -2208,  -2579,  -3097,  -3712,  -4351,  -4924,  -5325,  -5449,  -5194,
+     -4474,  -3229,  -1432,    905,   3732,   6960,  10466,  14104,  17711,  21128,  24201,  26806,  28850,  30280,  31092,  31325,
+     31057,  30402,  29492,  28470,  27473,  26625,  26016,  25707,  25717,  26026,  26580,  27298,  28081,  28826,  29438,  29839,
+    
+    // Level 3: 256 samples, 127 harmonics
+     29978,  29438,  28081,  26580,  25717,  26016,  27473,  29492,  31057,  31092,  28850,  24201,  17711,  10466,   3732,  -1432,
+     -4474,  -5449,  -4924,  -3712,  -2579,  -2008,  -2103,  -2657,  -3307,  -3729,  -3771,  -3482,  -3059,  -2725,  -2626,  -2775,
+     -3066,  -3337,  -3459,  -3393,  -3192,  -2970,  -2839,  -2853,  -2990,  -3171,  -3301,  -3322,  -3232,  -3087,  -2962,  -2919,
+     -2972,  -3087,  -3203,  -3261,  -3236,  -3147,  -3043,  -2976,  -2978,  -3044,  -3136,  -3207,  -3222,  -3177,  -3098,  -3026,
+     -2998,  -3025,  -3091,  -3161,  -3199,  -3187,  -3134,  -3068,  -3024,  -3022,  -3062,  -3123,  -3171,  -3184,  -3156,  -3103,
+     -3052,  -3030,  -3047,  -3092,  -3143,  -3173,  -3166,  -3129,  -3080,  -3045,  -3041,  -3070,  -3116,  -3155,  -3167,  -3147,
+     -3105,  -3064,  -3045,  -3056,  -3092,  -3134,  -3160,  -3157,  -3127,  -3086,  -3055,  -3050,  -3073,  -3112,  -3147,  -3159,
+     -3143,  -3108,  -3071,  -3052,  -3060,  -3091,  -3129,  -3154,  -3153,  -3127,  -3089,  -3060,  -3053,  -3073,  -3110,  -3143,
+     -3157,  -3143,  -3110,  -3073,  -3053,  -3060,  -3089,  -3127,  -3153,  -3154,  -3129,  -3091,  -3060,  -3052,  -3071,  -3108,
+     -3143,  -3159,  -3147,  -3112,  -3073,  -3050,  -3055,  -3086,  -3127,  -3157,  -3160,  -3134,  -3092,  -3056,  -3045,  -3064,
+     -3105,  -3147,  -3167,  -3155,  -3116,  -3070,  -3041,  -3045,  -3080,  -3129,  -3166,  -3173,  -3143,  -3092,  -3047,  -3030,
+     -3052,  -3103,  -3156,  -3184,  -3171,  -3123,  -3062,  -3022,  -3024,  -3068,  -3134,  -3187,  -3199,  -3161,  -3091,  -3025,
+     -2998,  -3026,  -3098,  -3177,  -3222,  -3207,  -3136,  -3044,  -2978,  -2976,  -3043,  -3147,  -3236,  -3261,  -3203,  -3087,
+     -2972,  -2919,  -2962,  -3087,  -3232,  -3322,  -3301,  -3171,  -2990,  -2853,  -2839,  -2970,  -3192,  -3393,  -3459,  -3337,
+     -3066,  -2775,  -2626,  -2725,  -3059,  -3482,  -3771,  -3729,  -3307,  -2657,  -2103,  -2008,  -2579,  -3712,  -4924,  -5449,
+     -4474,  -1432,   3732,  10466,  17711,  24201,  28850,  31092,  31057,  29492,  27473,  26016,  25717,  26580,  28081,  29438,
+    
+    // Level 4: 128 samples, 63 harmonics
+     29978,  28081,  25717,  27473,  31057,  28850,  17711,   3732,  -4474,  -4924,  -2579,  -2103,  -3307,  -3771,  -3059,  -2626,
+     -3066,  -3459,  -3192,  -2839,  -2990,  -3301,  -3232,  -2962,  -2972,  -3203,  -3236,  -3043,  -2978,  -3136,  -3222,  -3098,
+     -2998,  -3091,  -3199,  -3134,  -3024,  -3062,  -3171,  -3156,  -3052,  -3047,  -3143,  -3166,  -3080,  -3041,  -3116,  -3167,
+     -3105,  -3045,  -3092,  -3160,  -3127,  -3055,  -3073,  -3147,  -3143,  -3071,  -3060,  -3129,  -3153,  -3089,  -3053,  -3110,
+     -3157,  -3110,  -3053,  -3089,  -3153,  -3129,  -3060,  -3071,  -3143,  -3147,  -3073,  -3055,  -3127,  -3160,  -3092,  -3045,
+     -3105,  -3167,  -3116,  -3041,  -3080,  -3166,  -3143,  -3047,  -3052,  -3156,  -3171,  -3062,  -3024,  -3134,  -3199,  -3091,
+     -2998,  -3098,  -3222,  -3136,  -2978,  -3043,  -3236,  -3203,  -2972,  -2962,  -3232,  -3301,  -2990,  -2839,  -3192,  -3459,
+     -3066,  -2626,  -3059,  -3771,  -3307,  -2103,  -2579,  -4924,  -4474,   3732,  17711,  28850,  31057,  27473,  25717,  28081,
+    
+    // Level 5: 64 samples, 31 harmonics
+     29978,  25717,  31057,  17711,  -4474,  -2579,  -3307,  -3059,  -3066,  -3192,  -2990,  -3232,  -2972,  -3236,  -2978,  -3222,
+     -2998,  -3199,  -3024,  -3171,  -3052,  -3143,  -3080,  -3116,  -3105,  -3092,  -3127,  -3073,  -3143,  -3060,  -3153,  -3053,
+     -3157,  -3053,  -3153,  -3060,  -3143,  -3073,  -3127,  -3092,  -3105,  -3116,  -3080,  -3143,  -3052,  -3171,  -3024,  -3199,
+     -2998,  -3222,  -2978,  -3236,  -2972,  -3232,  -2990,  -3192,  -3066,  -3059,  -3307,  -2579,  -4474,  17711,  31057,  25717,
+    
+    // Level 6: 64 samples, 16 harmonics
+     26857,  29150,  28542,  16454,    272,  -6409,  -3410,  -1150,  -3273,  -4487,  -2769,  -2049,  -3519,  -3941,  -2646,  -2428,
+     -3590,  -3656,  -2601,  -2656,  -3620,  -3466,  -2581,  -2820,  -3634,  -3319,  -2571,  -2954,  -3641,  -3193,  -2567,  -3075,
+     -3643,  -3075,  -2567,  -3193,  -3641,  -2954,  -2571,  -3319,  -3634,  -2820,  -2581,  -3466,  -3620,  -2656,  -2601,  -3656,
+     -3590,  -2428,  -2646,  -3941,  -3519,  -2049,  -2769,  -4487,  -3273,  -1150,  -3410,  -6409,    272,  16454,  28542,  29150,
+    
+    // Level 7: 64 samples, 8 harmonics
+     32767,  30100,  22951,  13526,   4499,  -2003,  -5102,  -5272,  -3877,  -2408,  -1815,  -2234,  -3153,  -3875,  -3966,  -3468,
+     -2790,  -2399,  -2519,  -3019,  -3535,  -3725,  -3487,  -3007,  -2617,  -2572,  -2887,  -3338,  -3619,  -3546,  -3175,  -2760,
+     -2582,  -2760,  -3175,  -3546,  -3619,  -3338,  -2887,  -2572,  -2617,  -3007,  -3487,  -3725,  -3535,  -3019,  -2519,  -2399,
+     -2790,  -3468,  -3966,  -3875,  -3153,  -2234,  -1815,  -2408,  -3877,  -5272,  -5102,  -2003,   4499,  13526,  22951,  30100,
+    
+    // Level 8: 64 samples, 4 harmonics
+     21945,  21217,  19111,  15854,  11789,   7337,   2938,  -1000,  -4149,  -6301,  -7380,  -7450,  -6694,  -5378,  -3813,  -2304,
+     -1109,   -407,   -274,   -684,  -1520,  -2600,  -3711,  -4649,  -5249,  -5417,  -5138,  -4480,  -3575,  -2598,  -1732,  -1140,
+      -930,  -1140,  -1732,  -2598,  -3575,  -4480,  -5138,  -5417,  -5249,  -4649,  -3711,  -2600,  -1520,   -684,   -274,   -407,
+     -1109,  -2304,  -3813,  -5378,  -6694,  -7450,  -7380,  -6301,  -4149,  -1000,   2938,   7337,  11789,  15854,  19111,  21217,
+    
+    // Level 9: 64 samples, 2 harmonics
+     11916,  11775,  11356,  10674,   9750,   8613,   7301,   5854,   4319,   2741,   1170,   -348,  -1770,  -3057,  -4175,  -5098,
+     -5809,  -6296,  -6558,  -6603,  -6444,  -6106,  -5616,  -5008,  -4319,  -3588,  -2855,  -2159,  -1535,  -1015,   -624,   -381,
+      -299,   -381,   -624,  -1015,  -1535,  -2159,  -2855,  -3588,  -4319,  -5008,  -5616,  -6106,  -6444,  -6603,  -6558,  -6296,
+     -5809,  -5098,  -4175,  -3057,  -1770,   -348,   1170,   2741,   4319,   5854,   7301,   8613,   9750,  10674,  11356,  11775,
+    
+    // Level 10: 64 samples, 1 harmonics
+      6107,   6078,   5990,   5844,   5643,   5386,   5078,   4721,   4319,   3875,   3393,   2879,   2337,   1773,   1192,    599,
+         0,   -599,  -1192,  -1773,  -2337,  -2879,  -3393,  -3875,  -4319,  -4721,  -5078,  -5386,  -5643,  -5844,  -5990,  -6078,
+     -6107,  -6078,  -5990,  -5844,  -5643,  -5386,  -5078,  -4721,  -4319,  -3875,  -3393,  -2879,  -2337,  -1773,  -1192,   -599,
+         0,    599,   1192,   1773,   2337,   2879,   3393,   3875,   4319,   4721,   5078,   5386,   5643,   5844,   5990,   6078,
     
 };
 
-alignas(4) const float waveform_Choir[4096] = {
-    0.00000000f, 0.00520631f, 0.01041248f, 0.01561835f, 0.02082378f, 0.02602863f, 0.03123274f, 0.03643596f,
-    0.04163816f, 0.04683919f, 0.05203889f, 0.05723712f, 0.06243373f, 0.06762858f, 0.07282153f, 0.07801242f,
-    0.08320110f, 0.08838744f, 0.09357128f, 0.09875248f, 0.10393090f, 0.10910638f, 0.11427878f, 0.11944796f,
-    0.12461377f, 0.12977606f, 0.13493469f, 0.14008952f, 0.14524039f, 0.15038717f, 0.15552970f, 0.16066785f,
-    0.16580147f, 0.17093041f, 0.17605454f, 0.18117370f, 0.18628775f, 0.19139656f, 0.19649997f, 0.20159784f,
-    0.20669003f, 0.21177640f, 0.21685680f, 0.22193110f, 0.22699914f, 0.23206079f, 0.23711591f, 0.24216435f,
-    0.24720598f, 0.25224064f, 0.25726821f, 0.26228854f, 0.26730149f, 0.27230692f, 0.27730469f, 0.28229466f,
-    0.28727670f, 0.29225065f, 0.29721640f, 0.30217379f, 0.30712269f, 0.31206296f, 0.31699446f, 0.32191706f,
-    0.32683062f, 0.33173501f, 0.33663008f, 0.34151570f, 0.34639174f, 0.35125807f, 0.35611454f, 0.36096102f,
-    0.36579738f, 0.37062349f, 0.37543921f, 0.38024441f, 0.38503895f, 0.38982271f, 0.39459556f, 0.39935735f,
-    0.40410797f, 0.40884728f, 0.41357515f, 0.41829144f, 0.42299605f, 0.42768882f, 0.43236964f, 0.43703837f,
-    0.44169490f, 0.44633909f, 0.45097081f, 0.45558994f, 0.46019636f, 0.46478993f, 0.46937054f, 0.47393805f,
-    0.47849236f, 0.48303332f, 0.48756083f, 0.49207475f, 0.49657496f, 0.50106135f, 0.50553380f, 0.50999217f,
-    0.51443636f, 0.51886624f, 0.52328169f, 0.52768260f, 0.53206885f, 0.53644032f, 0.54079689f, 0.54513845f,
-    0.54946489f, 0.55377607f, 0.55807190f, 0.56235226f, 0.56661704f, 0.57086611f, 0.57509938f, 0.57931672f,
-    0.58351802f, 0.58770319f, 0.59187209f, 0.59602464f, 0.60016071f, 0.60428020f, 0.60838300f, 0.61246900f,
-    0.61653810f, 0.62059019f, 0.62462517f, 0.62864293f, 0.63264336f, 0.63662637f, 0.64059185f, 0.64453970f,
-    0.64846981f, 0.65238209f, 0.65627644f, 0.66015275f, 0.66401092f, 0.66785087f, 0.67167248f, 0.67547567f,
-    0.67926033f, 0.68302638f, 0.68677371f, 0.69050223f, 0.69421185f, 0.69790247f, 0.70157401f, 0.70522636f,
-    0.70885945f, 0.71247317f, 0.71606744f, 0.71964217f, 0.72319727f, 0.72673265f, 0.73024823f, 0.73374392f,
-    0.73721963f, 0.74067528f, 0.74411079f, 0.74752607f, 0.75092104f, 0.75429562f, 0.75764972f, 0.76098326f,
-    0.76429617f, 0.76758837f, 0.77085978f, 0.77411031f, 0.77733990f, 0.78054846f, 0.78373592f, 0.78690222f,
-    0.79004726f, 0.79317098f, 0.79627331f, 0.79935417f, 0.80241350f, 0.80545121f, 0.80846726f, 0.81146155f,
-    0.81443404f, 0.81738464f, 0.82031330f, 0.82321994f, 0.82610451f, 0.82896693f, 0.83180715f, 0.83462510f,
-    0.83742073f, 0.84019396f, 0.84294473f, 0.84567300f, 0.84837870f, 0.85106177f, 0.85372216f, 0.85635980f,
-    0.85897465f, 0.86156664f, 0.86413573f, 0.86668186f, 0.86920498f, 0.87170503f, 0.87418197f, 0.87663575f,
-    0.87906631f, 0.88147361f, 0.88385760f, 0.88621823f, 0.88855546f, 0.89086924f, 0.89315953f, 0.89542628f,
-    0.89766945f, 0.89988900f, 0.90208488f, 0.90425707f, 0.90640550f, 0.90853016f, 0.91063100f, 0.91270798f,
-    0.91476106f, 0.91679021f, 0.91879541f, 0.92077660f, 0.92273376f, 0.92466685f, 0.92657585f, 0.92846073f,
-    0.93032144f, 0.93215798f, 0.93397029f, 0.93575837f, 0.93752218f, 0.93926169f, 0.94097689f, 0.94266774f,
-    0.94433423f, 0.94597632f, 0.94759401f, 0.94918726f, 0.95075606f, 0.95230039f, 0.95382023f, 0.95531556f,
-    0.95678637f, 0.95823263f, 0.95965435f, 0.96105149f, 0.96242404f, 0.96377200f, 0.96509535f, 0.96639408f,
-    0.96766818f, 0.96891764f, 0.97014245f, 0.97134261f, 0.97251810f, 0.97366892f, 0.97479506f, 0.97589653f,
-    0.97697331f, 0.97802541f, 0.97905281f, 0.98005553f, 0.98103355f, 0.98198688f, 0.98291553f, 0.98381948f,
-    0.98469875f, 0.98555333f, 0.98638324f, 0.98718848f, 0.98796904f, 0.98872495f, 0.98945620f, 0.99016281f,
-    0.99084478f, 0.99150213f, 0.99213486f, 0.99274298f, 0.99332652f, 0.99388547f, 0.99441986f, 0.99492969f,
-    0.99541500f, 0.99587578f, 0.99631206f, 0.99672385f, 0.99711118f, 0.99747406f, 0.99781251f, 0.99812656f,
-    0.99841622f, 0.99868152f, 0.99892247f, 0.99913912f, 0.99933147f, 0.99949955f, 0.99964340f, 0.99976303f,
-    0.99985848f, 0.99992977f, 0.99997693f, 1.00000000f, 0.99999900f, 0.99997396f, 0.99992492f, 0.99985191f,
-    0.99975497f, 0.99963412f, 0.99948940f, 0.99932086f, 0.99912851f, 0.99891241f, 0.99867260f, 0.99840910f,
-    0.99812196f, 0.99781122f, 0.99747692f, 0.99711910f, 0.99673781f, 0.99633308f, 0.99590497f, 0.99545351f,
-    0.99497876f, 0.99448075f, 0.99395953f, 0.99341516f, 0.99284768f, 0.99225713f, 0.99164357f, 0.99100705f,
-    0.99034762f, 0.98966532f, 0.98896022f, 0.98823237f, 0.98748181f, 0.98670861f, 0.98591281f, 0.98509448f,
-    0.98425366f, 0.98339042f, 0.98250482f, 0.98159691f, 0.98066674f, 0.97971439f, 0.97873991f, 0.97774336f,
-    0.97672480f, 0.97568429f, 0.97462191f, 0.97353770f, 0.97243173f, 0.97130408f, 0.97015480f, 0.96898396f,
-    0.96779162f, 0.96657786f, 0.96534273f, 0.96408632f, 0.96280868f, 0.96150989f, 0.96019002f, 0.95884913f,
-    0.95748731f, 0.95610461f, 0.95470112f, 0.95327690f, 0.95183203f, 0.95036658f, 0.94888063f, 0.94737425f,
-    0.94584752f, 0.94430052f, 0.94273332f, 0.94114599f, 0.93953863f, 0.93791130f, 0.93626408f, 0.93459705f,
-    0.93291030f, 0.93120391f, 0.92947795f, 0.92773250f, 0.92596766f, 0.92418350f, 0.92238010f, 0.92055755f,
-    0.91871594f, 0.91685534f, 0.91497584f, 0.91307753f, 0.91116050f, 0.90922483f, 0.90727060f, 0.90529791f,
-    0.90330684f, 0.90129749f, 0.89926993f, 0.89722427f, 0.89516059f, 0.89307897f, 0.89097952f, 0.88886232f,
-    0.88672746f, 0.88457504f, 0.88240514f, 0.88021787f, 0.87801331f, 0.87579156f, 0.87355271f, 0.87129686f,
-    0.86902410f, 0.86673452f, 0.86442823f, 0.86210532f, 0.85976588f, 0.85741002f, 0.85503782f, 0.85264939f,
-    0.85024482f, 0.84782422f, 0.84538768f, 0.84293530f, 0.84046718f, 0.83798342f, 0.83548413f, 0.83296939f,
-    0.83043931f, 0.82789400f, 0.82533355f, 0.82275807f, 0.82016765f, 0.81756241f, 0.81494244f, 0.81230784f,
-    0.80965872f, 0.80699519f, 0.80431735f, 0.80162529f, 0.79891913f, 0.79619897f, 0.79346492f, 0.79071708f,
-    0.78795555f, 0.78518045f, 0.78239187f, 0.77958993f, 0.77677474f, 0.77394638f, 0.77110499f, 0.76825065f,
-    0.76538349f, 0.76250361f, 0.75961111f, 0.75670610f, 0.75378870f, 0.75085901f, 0.74791713f, 0.74496319f,
-    0.74199729f, 0.73901953f, 0.73603003f, 0.73302890f, 0.73001624f, 0.72699218f, 0.72395681f, 0.72091024f,
-    0.71785260f, 0.71478399f, 0.71170452f, 0.70861429f, 0.70551344f, 0.70240205f, 0.69928025f, 0.69614815f,
-    0.69300586f, 0.68985349f, 0.68669116f, 0.68351897f, 0.68033703f, 0.67714547f, 0.67394439f, 0.67073391f,
-    0.66751413f, 0.66428517f, 0.66104715f, 0.65780017f, 0.65454435f, 0.65127981f, 0.64800664f, 0.64472498f,
-    0.64143493f, 0.63813661f, 0.63483012f, 0.63151558f, 0.62819311f, 0.62486282f, 0.62152482f, 0.61817923f,
-    0.61482615f, 0.61146571f, 0.60809801f, 0.60472318f, 0.60134131f, 0.59795254f, 0.59455696f, 0.59115470f,
-    0.58774586f, 0.58433057f, 0.58090893f, 0.57748106f, 0.57404707f, 0.57060708f, 0.56716119f, 0.56370953f,
-    0.56025220f, 0.55678932f, 0.55332101f, 0.54984736f, 0.54636851f, 0.54288455f, 0.53939561f, 0.53590180f,
-    0.53240323f, 0.52890001f, 0.52539225f, 0.52188007f, 0.51836358f, 0.51484290f, 0.51131813f, 0.50778938f,
-    0.50425678f, 0.50072042f, 0.49718043f, 0.49363691f, 0.49008998f, 0.48653975f, 0.48298633f, 0.47942982f,
-    0.47587035f, 0.47230802f, 0.46874294f, 0.46517523f, 0.46160499f, 0.45803233f, 0.45445737f, 0.45088021f,
-    0.44730097f, 0.44371975f, 0.44013666f, 0.43655181f, 0.43296532f, 0.42937729f, 0.42578783f, 0.42219704f,
-    0.41860504f, 0.41501193f, 0.41141783f, 0.40782284f, 0.40422706f, 0.40063061f, 0.39703359f, 0.39343610f,
-    0.38983827f, 0.38624018f, 0.38264195f, 0.37904368f, 0.37544549f, 0.37184746f, 0.36824972f, 0.36465236f,
-    0.36105549f, 0.35745921f, 0.35386363f, 0.35026886f, 0.34667498f, 0.34308212f, 0.33949036f, 0.33589982f,
-    0.33231060f, 0.32872280f, 0.32513651f, 0.32155185f, 0.31796891f, 0.31438780f, 0.31080861f, 0.30723145f,
-    0.30365641f, 0.30008360f, 0.29651312f, 0.29294506f, 0.28937952f, 0.28581660f, 0.28225641f, 0.27869903f,
-    0.27514457f, 0.27159312f, 0.26804478f, 0.26449965f, 0.26095782f, 0.25741939f, 0.25388445f, 0.25035310f,
-    0.24682544f, 0.24330155f, 0.23978154f, 0.23626549f, 0.23275351f, 0.22924567f, 0.22574208f, 0.22224283f,
-    0.21874801f, 0.21525771f, 0.21177202f, 0.20829104f, 0.20481485f, 0.20134354f, 0.19787721f, 0.19441594f,
-    0.19095982f, 0.18750894f, 0.18406338f, 0.18062325f, 0.17718861f, 0.17375957f, 0.17033620f, 0.16691860f,
-    0.16350684f, 0.16010102f, 0.15670121f, 0.15330750f, 0.14991999f, 0.14653874f, 0.14316384f, 0.13979538f,
-    0.13643344f, 0.13307809f, 0.12972943f, 0.12638753f, 0.12305247f, 0.11972434f, 0.11640320f, 0.11308915f,
-    0.10978226f, 0.10648261f, 0.10319027f, 0.09990533f, 0.09662786f, 0.09335793f, 0.09009563f, 0.08684103f,
-    0.08359420f, 0.08035522f, 0.07712416f, 0.07390110f, 0.07068611f, 0.06747927f, 0.06428063f, 0.06109029f,
-    0.05790830f, 0.05473475f, 0.05156969f, 0.04841321f, 0.04526536f, 0.04212622f, 0.03899586f, 0.03587435f,
-    0.03276174f, 0.02965812f, 0.02656355f, 0.02347809f, 0.02040180f, 0.01733476f, 0.01427703f, 0.01122867f,
-    0.00818975f, 0.00516033f, 0.00214047f, -0.00086977f, -0.00387031f, -0.00686112f, -0.00984211f, -0.01281323f,
-    -0.01577443f, -0.01872564f, -0.02166680f, -0.02459785f, -0.02751875f, -0.03042942f, -0.03332982f, -0.03621988f,
-    -0.03909956f, -0.04196880f, -0.04482753f, -0.04767571f, -0.05051329f, -0.05334021f, -0.05615641f, -0.05896185f,
-    -0.06175647f, -0.06454023f, -0.06731307f, -0.07007494f, -0.07282580f, -0.07556558f, -0.07829426f, -0.08101176f,
-    -0.08371806f, -0.08641310f, -0.08909684f, -0.09176923f, -0.09443022f, -0.09707976f, -0.09971783f, -0.10234436f,
-    -0.10495933f, -0.10756267f, -0.11015436f, -0.11273435f, -0.11530260f, -0.11785906f, -0.12040371f, -0.12293649f,
-    -0.12545737f, -0.12796631f, -0.13046327f, -0.13294822f, -0.13542111f, -0.13788191f, -0.14033059f, -0.14276710f,
-    -0.14519142f, -0.14760351f, -0.15000333f, -0.15239085f, -0.15476604f, -0.15712887f, -0.15947929f, -0.16181729f,
-    -0.16414283f, -0.16645588f, -0.16875642f, -0.17104440f, -0.17331980f, -0.17558260f, -0.17783276f, -0.18007026f,
-    -0.18229507f, -0.18450717f, -0.18670653f, -0.18889312f, -0.19106692f, -0.19322790f, -0.19537604f, -0.19751133f,
-    -0.19963372f, -0.20174321f, -0.20383977f, -0.20592338f, -0.20799402f, -0.21005166f, -0.21209630f, -0.21412790f,
-    -0.21614646f, -0.21815194f, -0.22014434f, -0.22212364f, -0.22408982f, -0.22604287f, -0.22798276f, -0.22990948f,
-    -0.23182303f, -0.23372338f, -0.23561052f, -0.23748443f, -0.23934512f, -0.24119255f, -0.24302672f, -0.24484763f,
-    -0.24665525f, -0.24844958f, -0.25023061f, -0.25199833f, -0.25375272f, -0.25549379f, -0.25722153f, -0.25893592f,
-    -0.26063695f, -0.26232464f, -0.26399895f, -0.26565990f, -0.26730748f, -0.26894168f, -0.27056249f, -0.27216992f,
-    -0.27376396f, -0.27534461f, -0.27691187f, -0.27846573f, -0.28000619f, -0.28153326f, -0.28304692f, -0.28454719f,
-    -0.28603406f, -0.28750753f, -0.28896761f, -0.29041430f, -0.29184759f, -0.29326750f, -0.29467402f, -0.29606717f,
-    -0.29744693f, -0.29881332f, -0.30016635f, -0.30150601f, -0.30283232f, -0.30414528f, -0.30544489f, -0.30673117f,
-    -0.30800413f, -0.30926376f, -0.31051008f, -0.31174310f, -0.31296283f, -0.31416928f, -0.31536245f, -0.31654236f,
-    -0.31770902f, -0.31886244f, -0.32000264f, -0.32112961f, -0.32224339f, -0.32334398f, -0.32443139f, -0.32550564f,
-    -0.32656674f, -0.32761471f, -0.32864957f, -0.32967132f, -0.33067998f, -0.33167558f, -0.33265812f, -0.33362763f,
-    -0.33458412f, -0.33552761f, -0.33645812f, -0.33737567f, -0.33828027f, -0.33917195f, -0.34005073f, -0.34091662f,
-    -0.34176964f, -0.34260983f, -0.34343719f, -0.34425175f, -0.34505354f, -0.34584257f, -0.34661887f, -0.34738246f,
-    -0.34813336f, -0.34887160f, -0.34959721f, -0.35031020f, -0.35101060f, -0.35169844f, -0.35237375f, -0.35303654f,
-    -0.35368685f, -0.35432470f, -0.35495012f, -0.35556313f, -0.35616377f, -0.35675206f, -0.35732803f, -0.35789171f,
-    -0.35844313f, -0.35898232f, -0.35950930f, -0.36002411f, -0.36052677f, -0.36101732f, -0.36149579f, -0.36196221f,
-    -0.36241661f, -0.36285902f, -0.36328948f, -0.36370802f, -0.36411466f, -0.36450945f, -0.36489241f, -0.36526358f,
-    -0.36562299f, -0.36597069f, -0.36630669f, -0.36663104f, -0.36694377f, -0.36724492f, -0.36753452f, -0.36781261f,
-    -0.36807922f, -0.36833439f, -0.36857816f, -0.36881056f, -0.36903163f, -0.36924142f, -0.36943994f, -0.36962725f,
-    -0.36980338f, -0.36996838f, -0.37012227f, -0.37026509f, -0.37039690f, -0.37051772f, -0.37062759f, -0.37072657f,
-    -0.37081467f, -0.37089195f, -0.37095845f, -0.37101420f, -0.37105926f, -0.37109365f, -0.37111742f, -0.37113061f,
-    -0.37113327f, -0.37112543f, -0.37110714f, -0.37107844f, -0.37103937f, -0.37098998f, -0.37093030f, -0.37086039f,
-    -0.37078028f, -0.37069003f, -0.37058966f, -0.37047923f, -0.37035878f, -0.37022836f, -0.37008801f, -0.36993777f,
-    -0.36977769f, -0.36960782f, -0.36942819f, -0.36923886f, -0.36903987f, -0.36883126f, -0.36861309f, -0.36838540f,
-    -0.36814823f, -0.36790163f, -0.36764565f, -0.36738033f, -0.36710572f, -0.36682187f, -0.36652882f, -0.36622663f,
-    -0.36591533f, -0.36559498f, -0.36526563f, -0.36492731f, -0.36458009f, -0.36422400f, -0.36385910f, -0.36348544f,
-    -0.36310305f, -0.36271200f, -0.36231233f, -0.36190408f, -0.36148731f, -0.36106207f, -0.36062841f, -0.36018636f,
-    -0.35973599f, -0.35927735f, -0.35881047f, -0.35833542f, -0.35785224f, -0.35736097f, -0.35686168f, -0.35635441f,
-    -0.35583921f, -0.35531613f, -0.35478523f, -0.35424654f, -0.35370012f, -0.35314602f, -0.35258430f, -0.35201500f,
-    -0.35143817f, -0.35085386f, -0.35026213f, -0.34966302f, -0.34905659f, -0.34844288f, -0.34782195f, -0.34719385f,
-    -0.34655863f, -0.34591633f, -0.34526702f, -0.34461074f, -0.34394754f, -0.34327748f, -0.34260060f, -0.34191696f,
-    -0.34122661f, -0.34052959f, -0.33982597f, -0.33911579f, -0.33839910f, -0.33767595f, -0.33694640f, -0.33621050f,
-    -0.33546830f, -0.33471984f, -0.33396519f, -0.33320439f, -0.33243750f, -0.33166456f, -0.33088563f, -0.33010075f,
-    -0.32930999f, -0.32851339f, -0.32771100f, -0.32690287f, -0.32608906f, -0.32526962f, -0.32444460f, -0.32361404f,
-    -0.32277801f, -0.32193655f, -0.32108972f, -0.32023755f, -0.31938012f, -0.31851746f, -0.31764963f, -0.31677668f,
-    -0.31589867f, -0.31501563f, -0.31412763f, -0.31323471f, -0.31233692f, -0.31143433f, -0.31052696f, -0.30961489f,
-    -0.30869816f, -0.30777681f, -0.30685091f, -0.30592049f, -0.30498562f, -0.30404633f, -0.30310269f, -0.30215474f,
-    -0.30120254f, -0.30024612f, -0.29928555f, -0.29832088f, -0.29735215f, -0.29637941f, -0.29540271f, -0.29442211f,
-    -0.29343764f, -0.29244938f, -0.29145735f, -0.29046162f, -0.28946222f, -0.28845922f, -0.28745266f, -0.28644258f,
-    -0.28542905f, -0.28441210f, -0.28339178f, -0.28236816f, -0.28134126f, -0.28031115f, -0.27927787f, -0.27824146f,
-    -0.27720199f, -0.27615949f, -0.27511401f, -0.27406561f, -0.27301432f, -0.27196020f, -0.27090330f, -0.26984366f,
-    -0.26878133f, -0.26771636f, -0.26664879f, -0.26557868f, -0.26450606f, -0.26343099f, -0.26235351f, -0.26127367f,
-    -0.26019152f, -0.25910710f, -0.25802045f, -0.25693164f, -0.25584069f, -0.25474766f, -0.25365259f, -0.25255553f,
-    -0.25145652f, -0.25035561f, -0.24925285f, -0.24814827f, -0.24704193f, -0.24593386f, -0.24482412f, -0.24371275f,
-    -0.24259979f, -0.24148528f, -0.24036928f, -0.23925182f, -0.23813295f, -0.23701271f, -0.23589115f, -0.23476831f,
-    -0.23364422f, -0.23251895f, -0.23139252f, -0.23026498f, -0.22913637f, -0.22800674f, -0.22687613f, -0.22574458f,
-    -0.22461213f, -0.22347882f, -0.22234470f, -0.22120980f, -0.22007418f, -0.21893786f, -0.21780089f, -0.21666332f,
-    -0.21552517f, -0.21438650f, -0.21324734f, -0.21210773f, -0.21096772f, -0.20982733f, -0.20868662f, -0.20754562f,
-    -0.20640437f, -0.20526291f, -0.20412128f, -0.20297952f, -0.20183766f, -0.20069575f, -0.19955382f, -0.19841191f,
-    -0.19727006f, -0.19612830f, -0.19498668f, -0.19384522f, -0.19270398f, -0.19156298f, -0.19042227f, -0.18928187f,
-    -0.18814182f, -0.18700217f, -0.18586294f, -0.18472418f, -0.18358591f, -0.18244818f, -0.18131102f, -0.18017446f,
-    -0.17903854f, -0.17790329f, -0.17676876f, -0.17563496f, -0.17450194f, -0.17336973f, -0.17223837f, -0.17110788f,
-    -0.16997831f, -0.16884968f, -0.16772203f, -0.16659538f, -0.16546978f, -0.16434526f, -0.16322184f, -0.16209956f,
-    -0.16097846f, -0.15985855f, -0.15873988f, -0.15762248f, -0.15650637f, -0.15539159f, -0.15427816f, -0.15316613f,
-    -0.15205551f, -0.15094634f, -0.14983865f, -0.14873247f, -0.14762782f, -0.14652474f, -0.14542326f, -0.14432340f,
-    -0.14322519f, -0.14212867f, -0.14103385f, -0.13994077f, -0.13884946f, -0.13775994f, -0.13667224f, -0.13558638f,
-    -0.13450240f, -0.13342033f, -0.13234018f, -0.13126198f, -0.13018577f, -0.12911156f, -0.12803938f, -0.12696926f,
-    -0.12590123f, -0.12483530f, -0.12377150f, -0.12270987f, -0.12165041f, -0.12059316f, -0.11953815f, -0.11848539f,
-    -0.11743490f, -0.11638672f, -0.11534087f, -0.11429736f, -0.11325623f, -0.11221749f, -0.11118116f, -0.11014728f,
-    -0.10911586f, -0.10808692f, -0.10706048f, -0.10603657f, -0.10501521f, -0.10399642f, -0.10298022f, -0.10196663f,
-    -0.10095567f, -0.09994736f, -0.09894172f, -0.09793877f, -0.09693854f, -0.09594103f, -0.09494628f, -0.09395429f,
-    -0.09296509f, -0.09197870f, -0.09099513f, -0.09001440f, -0.08903654f, -0.08806155f, -0.08708946f, -0.08612029f,
-    -0.08515405f, -0.08419075f, -0.08323043f, -0.08227308f, -0.08131873f, -0.08036740f, -0.07941910f, -0.07847384f,
-    -0.07753165f, -0.07659254f, -0.07565652f, -0.07472361f, -0.07379382f, -0.07286717f, -0.07194367f, -0.07102334f,
-    -0.07010620f, -0.06919224f, -0.06828150f, -0.06737398f, -0.06646970f, -0.06556866f, -0.06467089f, -0.06377639f,
-    -0.06288518f, -0.06199727f, -0.06111267f, -0.06023140f, -0.05935346f, -0.05847887f, -0.05760764f, -0.05673978f,
-    -0.05587530f, -0.05501422f, -0.05415654f, -0.05330227f, -0.05245143f, -0.05160402f, -0.05076005f, -0.04991955f,
-    -0.04908250f, -0.04824893f, -0.04741884f, -0.04659224f, -0.04576915f, -0.04494956f, -0.04413349f, -0.04332095f,
-    -0.04251195f, -0.04170648f, -0.04090457f, -0.04010621f, -0.03931142f, -0.03852021f, -0.03773257f, -0.03694852f,
-    -0.03616807f, -0.03539121f, -0.03461797f, -0.03384833f, -0.03308232f, -0.03231993f, -0.03156117f, -0.03080605f,
-    -0.03005457f, -0.02930674f, -0.02856256f, -0.02782204f, -0.02708518f, -0.02635199f, -0.02562247f, -0.02489662f,
-    -0.02417446f, -0.02345597f, -0.02274118f, -0.02203008f, -0.02132267f, -0.02061896f, -0.01991895f, -0.01922264f,
-    -0.01853004f, -0.01784115f, -0.01715597f, -0.01647451f, -0.01579676f, -0.01512273f, -0.01445243f, -0.01378584f,
-    -0.01312298f, -0.01246384f, -0.01180843f, -0.01115675f, -0.01050880f, -0.00986458f, -0.00922408f, -0.00858732f,
-    -0.00795429f, -0.00732499f, -0.00669942f, -0.00607759f, -0.00545948f, -0.00484511f, -0.00423447f, -0.00362755f,
-    -0.00302437f, -0.00242492f, -0.00182919f, -0.00123719f, -0.00064892f, -0.00006436f, 0.00051647f, 0.00109357f,
-    0.00166696f, 0.00223664f, 0.00280260f, 0.00336484f, 0.00392338f, 0.00447821f, 0.00502933f, 0.00557675f,
-    0.00612048f, 0.00666050f, 0.00719683f, 0.00772948f, 0.00825843f, 0.00878370f, 0.00930530f, 0.00982321f,
-    0.01033746f, 0.01084803f, 0.01135495f, 0.01185820f, 0.01235780f, 0.01285374f, 0.01334604f, 0.01383470f,
-    0.01431972f, 0.01480111f, 0.01527887f, 0.01575301f, 0.01622353f, 0.01669044f, 0.01715375f, 0.01761345f,
-    0.01806956f, 0.01852208f, 0.01897102f, 0.01941638f, 0.01985816f, 0.02029639f, 0.02073105f, 0.02116217f,
-    0.02158973f, 0.02201376f, 0.02243426f, 0.02285123f, 0.02326468f, 0.02367462f, 0.02408105f, 0.02448399f,
-    0.02488344f, 0.02527940f, 0.02567189f, 0.02606091f, 0.02644647f, 0.02682858f, 0.02720724f, 0.02758247f,
-    0.02795426f, 0.02832264f, 0.02868760f, 0.02904916f, 0.02940733f, 0.02976210f, 0.03011350f, 0.03046153f,
-    0.03080619f, 0.03114751f, 0.03148547f, 0.03182011f, 0.03215141f, 0.03247940f, 0.03280408f, 0.03312547f,
-    0.03344356f, 0.03375837f, 0.03406991f, 0.03437819f, 0.03468322f, 0.03498501f, 0.03528356f, 0.03557889f,
-    0.03587101f, 0.03615993f, 0.03644565f, 0.03672819f, 0.03700756f, 0.03728377f, 0.03755682f, 0.03782673f,
-    0.03809351f, 0.03835717f, 0.03861772f, 0.03887517f, 0.03912953f, 0.03938081f, 0.03962902f, 0.03987417f,
-    0.04011628f, 0.04035536f, 0.04059140f, 0.04082444f, 0.04105447f, 0.04128151f, 0.04150557f, 0.04172667f,
-    0.04194480f, 0.04215999f, 0.04237224f, 0.04258157f, 0.04278799f, 0.04299150f, 0.04319213f, 0.04338988f,
-    0.04358476f, 0.04377679f, 0.04396597f, 0.04415233f, 0.04433586f, 0.04451659f, 0.04469453f, 0.04486968f,
-    0.04504205f, 0.04521167f, 0.04537854f, 0.04554268f, 0.04570409f, 0.04586279f, 0.04601879f, 0.04617210f,
-    0.04632274f, 0.04647072f, 0.04661604f, 0.04675873f, 0.04689879f, 0.04703624f, 0.04717109f, 0.04730335f,
-    0.04743303f, 0.04756015f, 0.04768472f, 0.04780675f, 0.04792626f, 0.04804325f, 0.04815774f, 0.04826974f,
-    0.04837927f, 0.04848633f, 0.04859094f, 0.04869312f, 0.04879287f, 0.04889020f, 0.04898514f, 0.04907769f,
-    0.04916787f, 0.04925569f, 0.04934116f, 0.04942429f, 0.04950510f, 0.04958360f, 0.04965980f, 0.04973372f,
-    0.04980536f, 0.04987475f, 0.04994189f, 0.05000680f, 0.05006949f, 0.05012998f, 0.05018827f, 0.05024437f,
-    0.05029831f, 0.05035010f, 0.05039974f, 0.05044725f, 0.05049265f, 0.05053594f, 0.05057715f, 0.05061627f,
-    0.05065333f, 0.05068834f, 0.05072131f, 0.05075225f, 0.05078118f, 0.05080812f, 0.05083306f, 0.05085603f,
-    0.05087704f, 0.05089610f, 0.05091323f, 0.05092843f, 0.05094173f, 0.05095312f, 0.05096264f, 0.05097028f,
-    0.05097607f, 0.05098001f, 0.05098212f, 0.05098240f, 0.05098089f, 0.05097758f, 0.05097249f, 0.05096563f,
-    0.05095701f, 0.05094666f, 0.05093457f, 0.05092077f, 0.05090526f, 0.05088806f, 0.05086919f, 0.05084864f,
-    0.05082645f, 0.05080261f, 0.05077715f, 0.05075007f, 0.05072139f, 0.05069112f, 0.05065927f, 0.05062585f,
-    0.05059089f, 0.05055438f, 0.05051635f, 0.05047680f, 0.05043575f, 0.05039321f, 0.05034919f, 0.05030371f,
-    0.05025677f, 0.05020840f, 0.05015859f, 0.05010738f, 0.05005475f, 0.05000074f, 0.04994535f, 0.04988859f,
-    0.04983047f, 0.04977101f, 0.04971023f, 0.04964812f, 0.04958471f, 0.04952000f, 0.04945402f, 0.04938676f,
-    0.04931824f, 0.04924848f, 0.04917748f, 0.04910526f, 0.04903183f, 0.04895720f, 0.04888139f, 0.04880440f,
-    0.04872624f, 0.04864693f, 0.04856649f, 0.04848491f, 0.04840222f, 0.04831842f, 0.04823352f, 0.04814755f,
-    0.04806050f, 0.04797239f, 0.04788324f, 0.04779304f, 0.04770182f, 0.04760959f, 0.04751635f, 0.04742213f,
-    0.04732692f, 0.04723074f, 0.04713360f, 0.04703551f, 0.04693649f, 0.04683654f, 0.04673567f, 0.04663391f,
-    0.04653124f, 0.04642770f, 0.04632329f, 0.04621801f, 0.04611188f, 0.04600492f, 0.04589712f, 0.04578851f,
-    0.04567909f, 0.04556887f, 0.04545786f, 0.04534608f, 0.04523353f, 0.04512023f, 0.04500618f, 0.04489139f,
-    0.04477588f, 0.04465965f, 0.04454272f, 0.04442510f, 0.04430679f, 0.04418780f, 0.04406815f, 0.04394785f,
-    0.04382690f, 0.04370531f, 0.04358310f, 0.04346027f, 0.04333684f, 0.04321281f, 0.04308819f, 0.04296299f,
-    0.04283723f, 0.04271090f, 0.04258403f, 0.04245662f, 0.04232868f, 0.04220021f, 0.04207124f, 0.04194176f,
-    0.04181178f, 0.04168132f, 0.04155039f, 0.04141899f, 0.04128713f, 0.04115482f, 0.04102207f, 0.04088889f,
-    0.04075528f, 0.04062126f, 0.04048684f, 0.04035202f, 0.04021681f, 0.04008122f, 0.03994526f, 0.03980894f,
-    0.03967226f, 0.03953523f, 0.03939787f, 0.03926017f, 0.03912216f, 0.03898383f, 0.03884519f, 0.03870626f,
-    0.03856704f, 0.03842753f, 0.03828775f, 0.03814771f, 0.03800740f, 0.03786685f, 0.03772605f, 0.03758501f,
-    0.03744375f, 0.03730227f, 0.03716057f, 0.03701867f, 0.03687657f, 0.03673428f, 0.03659180f, 0.03644915f,
-    0.03630633f, 0.03616335f, 0.03602021f, 0.03587692f, 0.03573349f, 0.03558993f, 0.03544624f, 0.03530242f,
-    0.03515850f, 0.03501446f, 0.03487033f, 0.03472610f, 0.03458178f, 0.03443738f, 0.03429291f, 0.03414837f,
-    0.03400377f, 0.03385911f, 0.03371440f, 0.03356965f, 0.03342486f, 0.03328004f, 0.03313519f, 0.03299033f,
-    0.03284545f, 0.03270057f, 0.03255568f, 0.03241080f, 0.03226593f, 0.03212107f, 0.03197624f, 0.03183143f,
-    0.03168666f, 0.03154192f, 0.03139723f, 0.03125258f, 0.03110799f, 0.03096346f, 0.03081899f, 0.03067460f,
-    0.03053027f, 0.03038603f, 0.03024188f, 0.03009781f, 0.02995384f, 0.02980997f, 0.02966620f, 0.02952254f,
-    0.02937900f, 0.02923557f, 0.02909227f, 0.02894910f, 0.02880606f, 0.02866315f, 0.02852039f, 0.02837778f,
-    0.02823531f, 0.02809300f, 0.02795085f, 0.02780886f, 0.02766704f, 0.02752539f, 0.02738391f, 0.02724261f,
-    0.02710150f, 0.02696058f, 0.02681984f, 0.02667930f, 0.02653896f, 0.02639882f, 0.02625889f, 0.02611916f,
-    0.02597965f, 0.02584036f, 0.02570129f, 0.02556243f, 0.02542381f, 0.02528542f, 0.02514726f, 0.02500933f,
-    0.02487165f, 0.02473421f, 0.02459702f, 0.02446007f, 0.02432338f, 0.02418694f, 0.02405076f, 0.02391485f,
-    0.02377919f, 0.02364380f, 0.02350868f, 0.02337384f, 0.02323926f, 0.02310497f, 0.02297095f, 0.02283722f,
-    0.02270377f, 0.02257061f, 0.02243774f, 0.02230516f, 0.02217287f, 0.02204088f, 0.02190919f, 0.02177780f,
-    0.02164671f, 0.02151593f, 0.02138545f, 0.02125528f, 0.02112543f, 0.02099588f, 0.02086665f, 0.02073774f,
-    0.02060914f, 0.02048086f, 0.02035291f, 0.02022528f, 0.02009797f, 0.01997099f, 0.01984433f, 0.01971801f,
-    0.01959201f, 0.01946635f, 0.01934102f, 0.01921603f, 0.01909137f, 0.01896705f, 0.01884306f, 0.01871942f,
-    0.01859611f, 0.01847315f, 0.01835053f, 0.01822825f, 0.01810632f, 0.01798473f, 0.01786349f, 0.01774260f,
-    0.01762205f, 0.01750185f, 0.01738200f, 0.01726250f, 0.01714336f, 0.01702456f, 0.01690611f, 0.01678802f,
-    0.01667028f, 0.01655289f, 0.01643585f, 0.01631917f, 0.01620284f, 0.01608687f, 0.01597125f, 0.01585599f,
-    0.01574108f, 0.01562653f, 0.01551233f, 0.01539848f, 0.01528500f, 0.01517186f, 0.01505909f, 0.01494667f,
-    0.01483460f, 0.01472289f, 0.01461153f, 0.01450053f, 0.01438988f, 0.01427959f, 0.01416965f, 0.01406006f,
-    0.01395083f, 0.01384195f, 0.01373342f, 0.01362524f, 0.01351742f, 0.01340994f, 0.01330282f, 0.01319604f,
-    0.01308962f, 0.01298354f, 0.01287781f, 0.01277243f, 0.01266739f, 0.01256270f, 0.01245835f, 0.01235435f,
-    0.01225068f, 0.01214737f, 0.01204439f, 0.01194175f, 0.01183945f, 0.01173749f, 0.01163586f, 0.01153457f,
-    0.01143362f, 0.01133300f, 0.01123271f, 0.01113275f, 0.01103312f, 0.01093382f, 0.01083485f, 0.01073620f,
-    0.01063788f, 0.01053988f, 0.01044221f, 0.01034485f, 0.01024781f, 0.01015110f, 0.01005469f, 0.00995860f,
-    0.00986283f, 0.00976736f, 0.00967221f, 0.00957736f, 0.00948282f, 0.00938859f, 0.00929466f, 0.00920103f,
-    0.00910770f, 0.00901467f, 0.00892193f, 0.00882949f, 0.00873734f, 0.00864548f, 0.00855391f, 0.00846263f,
-    0.00837163f, 0.00828092f, 0.00819048f, 0.00810033f, 0.00801045f, 0.00792085f, 0.00783152f, 0.00774246f,
-    0.00765367f, 0.00756514f, 0.00747688f, 0.00738889f, 0.00730115f, 0.00721367f, 0.00712645f, 0.00703948f,
-    0.00695276f, 0.00686629f, 0.00678007f, 0.00669409f, 0.00660835f, 0.00652286f, 0.00643760f, 0.00635257f,
-    0.00626778f, 0.00618322f, 0.00609889f, 0.00601478f, 0.00593089f, 0.00584723f, 0.00576378f, 0.00568054f,
-    0.00559752f, 0.00551471f, 0.00543211f, 0.00534972f, 0.00526752f, 0.00518553f, 0.00510373f, 0.00502213f,
-    0.00494071f, 0.00485949f, 0.00477846f, 0.00469761f, 0.00461694f, 0.00453645f, 0.00445613f, 0.00437599f,
-    0.00429602f, 0.00421621f, 0.00413657f, 0.00405709f, 0.00397777f, 0.00389861f, 0.00381960f, 0.00374074f,
-    0.00366203f, 0.00358347f, 0.00350504f, 0.00342676f, 0.00334861f, 0.00327060f, 0.00319272f, 0.00311496f,
-    0.00303733f, 0.00295982f, 0.00288243f, 0.00280515f, 0.00272799f, 0.00265094f, 0.00257400f, 0.00249716f,
-    0.00242042f, 0.00234378f, 0.00226723f, 0.00219078f, 0.00211441f, 0.00203813f, 0.00196194f, 0.00188582f,
-    0.00180978f, 0.00173382f, 0.00165793f, 0.00158210f, 0.00150634f, 0.00143064f, 0.00135500f, 0.00127942f,
-    0.00120388f, 0.00112840f, 0.00105296f, 0.00097757f, 0.00090222f, 0.00082690f, 0.00075162f, 0.00067637f,
-    0.00060115f, 0.00052595f, 0.00045077f, 0.00037562f, 0.00030047f, 0.00022535f, 0.00015023f, 0.00007511f,
-    0.00000000f, -0.00007511f, -0.00015023f, -0.00022535f, -0.00030047f, -0.00037562f, -0.00045077f, -0.00052595f,
-    -0.00060115f, -0.00067637f, -0.00075162f, -0.00082690f, -0.00090222f, -0.00097757f, -0.00105296f, -0.00112840f,
-    -0.00120388f, -0.00127942f, -0.00135500f, -0.00143064f, -0.00150634f, -0.00158210f, -0.00165793f, -0.00173382f,
-    -0.00180978f, -0.00188582f, -0.00196194f, -0.00203813f, -0.00211441f, -0.00219078f, -0.00226723f, -0.00234378f,
-    -0.00242042f, -0.00249716f, -0.00257400f, -0.00265094f, -0.00272799f, -0.00280515f, -0.00288243f, -0.00295982f,
-    -0.00303733f, -0.00311496f, -0.00319272f, -0.00327060f, -0.00334861f, -0.00342676f, -0.00350504f, -0.00358347f,
-    -0.00366203f, -0.00374074f, -0.00381960f, -0.00389861f, -0.00397777f, -0.00405709f, -0.00413657f, -0.00421621f,
-    -0.00429602f, -0.00437599f, -0.00445613f, -0.00453645f, -0.00461694f, -0.00469761f, -0.00477846f, -0.00485949f,
-    -0.00494071f, -0.00502213f, -0.00510373f, -0.00518553f, -0.00526752f, -0.00534972f, -0.00543211f, -0.00551471f,
-    -0.00559752f, -0.00568054f, -0.00576378f, -0.00584723f, -0.00593089f, -0.00601478f, -0.00609889f, -0.00618322f,
-    -0.00626778f, -0.00635257f, -0.00643760f, -0.00652286f, -0.00660835f, -0.00669409f, -0.00678007f, -0.00686629f,
-    -0.00695276f, -0.00703948f, -0.00712645f, -0.00721367f, -0.00730115f, -0.00738889f, -0.00747688f, -0.00756514f,
-    -0.00765367f, -0.00774246f, -0.00783152f, -0.00792085f, -0.00801045f, -0.00810033f, -0.00819048f, -0.00828092f,
-    -0.00837163f, -0.00846263f, -0.00855391f, -0.00864548f, -0.00873734f, -0.00882949f, -0.00892193f, -0.00901467f,
-    -0.00910770f, -0.00920103f, -0.00929466f, -0.00938859f, -0.00948282f, -0.00957736f, -0.00967221f, -0.00976736f,
-    -0.00986283f, -0.00995860f, -0.01005469f, -0.01015110f, -0.01024781f, -0.01034485f, -0.01044221f, -0.01053988f,
-    -0.01063788f, -0.01073620f, -0.01083485f, -0.01093382f, -0.01103312f, -0.01113275f, -0.01123271f, -0.01133300f,
-    -0.01143362f, -0.01153457f, -0.01163586f, -0.01173749f, -0.01183945f, -0.01194175f, -0.01204439f, -0.01214737f,
-    -0.01225068f, -0.01235435f, -0.01245835f, -0.01256270f, -0.01266739f, -0.01277243f, -0.01287781f, -0.01298354f,
-    -0.01308962f, -0.01319604f, -0.01330282f, -0.01340994f, -0.01351742f, -0.01362524f, -0.01373342f, -0.01384195f,
-    -0.01395083f, -0.01406006f, -0.01416965f, -0.01427959f, -0.01438988f, -0.01450053f, -0.01461153f, -0.01472289f,
-    -0.01483460f, -0.01494667f, -0.01505909f, -0.01517186f, -0.01528500f, -0.01539848f, -0.01551233f, -0.01562653f,
-    -0.01574108f, -0.01585599f, -0.01597125f, -0.01608687f, -0.01620284f, -0.01631917f, -0.01643585f, -0.01655289f,
-    -0.01667028f, -0.01678802f, -0.01690611f, -0.01702456f, -0.01714336f, -0.01726250f, -0.01738200f, -0.01750185f,
-    -0.01762205f, -0.01774260f, -0.01786349f, -0.01798473f, -0.01810632f, -0.01822825f, -0.01835053f, -0.01847315f,
-    -0.01859611f, -0.01871942f, -0.01884306f, -0.01896705f, -0.01909137f, -0.01921603f, -0.01934102f, -0.01946635f,
-    -0.01959201f, -0.01971801f, -0.01984433f, -0.01997099f, -0.02009797f, -0.02022528f, -0.02035291f, -0.02048086f,
-    -0.02060914f, -0.02073774f, -0.02086665f, -0.02099588f, -0.02112543f, -0.02125528f, -0.02138545f, -0.02151593f,
-    -0.02164671f, -0.02177780f, -0.02190919f, -0.02204088f, -0.02217287f, -0.02230516f, -0.02243774f, -0.02257061f,
-    -0.02270377f, -0.02283722f, -0.02297095f, -0.02310497f, -0.02323926f, -0.02337384f, -0.02350868f, -0.02364380f,
-    -0.02377919f, -0.02391485f, -0.02405076f, -0.02418694f, -0.02432338f, -0.02446007f, -0.02459702f, -0.02473421f,
-    -0.02487165f, -0.02500933f, -0.02514726f, -0.02528542f, -0.02542381f, -0.02556243f, -0.02570129f, -0.02584036f,
-    -0.02597965f, -0.02611916f, -0.02625889f, -0.02639882f, -0.02653896f, -0.02667930f, -0.02681984f, -0.02696058f,
-    -0.02710150f, -0.02724261f, -0.02738391f, -0.02752539f, -0.02766704f, -0.02780886f, -0.02795085f, -0.02809300f,
-    -0.02823531f, -0.02837778f, -0.02852039f, -0.02866315f, -0.02880606f, -0.02894910f, -0.02909227f, -0.02923557f,
-    -0.02937900f, -0.02952254f, -0.02966620f, -0.02980997f, -0.02995384f, -0.03009781f, -0.03024188f, -0.03038603f,
-    -0.03053027f, -0.03067460f, -0.03081899f, -0.03096346f, -0.03110799f, -0.03125258f, -0.03139723f, -0.03154192f,
-    -0.03168666f, -0.03183143f, -0.03197624f, -0.03212107f, -0.03226593f, -0.03241080f, -0.03255568f, -0.03270057f,
-    -0.03284545f, -0.03299033f, -0.03313519f, -0.03328004f, -0.03342486f, -0.03356965f, -0.03371440f, -0.03385911f,
-    -0.03400377f, -0.03414837f, -0.03429291f, -0.03443738f, -0.03458178f, -0.03472610f, -0.03487033f, -0.03501446f,
-    -0.03515850f, -0.03530242f, -0.03544624f, -0.03558993f, -0.03573349f, -0.03587692f, -0.03602021f, -0.03616335f,
-    -0.03630633f, -0.03644915f, -0.03659180f, -0.03673428f, -0.03687657f, -0.03701867f, -0.03716057f, -0.03730227f,
-    -0.03744375f, -0.03758501f, -0.03772605f, -0.03786685f, -0.03800740f, -0.03814771f, -0.03828775f, -0.03842753f,
-    -0.03856704f, -0.03870626f, -0.03884519f, -0.03898383f, -0.03912216f, -0.03926017f, -0.03939787f, -0.03953523f,
-    -0.03967226f, -0.03980894f, -0.03994526f, -0.04008122f, -0.04021681f, -0.04035202f, -0.04048684f, -0.04062126f,
-    -0.04075528f, -0.04088889f, -0.04102207f, -0.04115482f, -0.04128713f, -0.04141899f, -0.04155039f, -0.04168132f,
-    -0.04181178f, -0.04194176f, -0.04207124f, -0.04220021f, -0.04232868f, -0.04245662f, -0.04258403f, -0.04271090f,
-    -0.04283723f, -0.04296299f, -0.04308819f, -0.04321281f, -0.04333684f, -0.04346027f, -0.04358310f, -0.04370531f,
-    -0.04382690f, -0.04394785f, -0.04406815f, -0.04418780f, -0.04430679f, -0.04442510f, -0.04454272f, -0.04465965f,
-    -0.04477588f, -0.04489139f, -0.04500618f, -0.04512023f, -0.04523353f, -0.04534608f, -0.04545786f, -0.04556887f,
-    -0.04567909f, -0.04578851f, -0.04589712f, -0.04600492f, -0.04611188f, -0.04621801f, -0.04632329f, -0.04642770f,
-    -0.04653124f, -0.04663391f, -0.04673567f, -0.04683654f, -0.04693649f, -0.04703551f, -0.04713360f, -0.04723074f,
-    -0.04732692f, -0.04742213f, -0.04751635f, -0.04760959f, -0.04770182f, -0.04779304f, -0.04788324f, -0.04797239f,
-    -0.04806050f, -0.04814755f, -0.04823352f, -0.04831842f, -0.04840222f, -0.04848491f, -0.04856649f, -0.04864693f,
-    -0.04872624f, -0.04880440f, -0.04888139f, -0.04895720f, -0.04903183f, -0.04910526f, -0.04917748f, -0.04924848f,
-    -0.04931824f, -0.04938676f, -0.04945402f, -0.04952000f, -0.04958471f, -0.04964812f, -0.04971023f, -0.04977101f,
-    -0.04983047f, -0.04988859f, -0.04994535f, -0.05000074f, -0.05005475f, -0.05010738f, -0.05015859f, -0.05020840f,
-    -0.05025677f, -0.05030371f, -0.05034919f, -0.05039321f, -0.05043575f, -0.05047680f, -0.05051635f, -0.05055438f,
-    -0.05059089f, -0.05062585f, -0.05065927f, -0.05069112f, -0.05072139f, -0.05075007f, -0.05077715f, -0.05080261f,
-    -0.05082645f, -0.05084864f, -0.05086919f, -0.05088806f, -0.05090526f, -0.05092077f, -0.05093457f, -0.05094666f,
-    -0.05095701f, -0.05096563f, -0.05097249f, -0.05097758f, -0.05098089f, -0.05098240f, -0.05098212f, -0.05098001f,
-    -0.05097607f, -0.05097028f, -0.05096264f, -0.05095312f, -0.05094173f, -0.05092843f, -0.05091323f, -0.05089610f,
-    -0.05087704f, -0.05085603f, -0.05083306f, -0.05080812f, -0.05078118f, -0.05075225f, -0.05072131f, -0.05068834f,
-    -0.05065333f, -0.05061627f, -0.05057715f, -0.05053594f, -0.05049265f, -0.05044725f, -0.05039974f, -0.05035010f,
-    -0.05029831f, -0.05024437f, -0.05018827f, -0.05012998f, -0.05006949f, -0.05000680f, -0.04994189f, -0.04987475f,
-    -0.04980536f, -0.04973372f, -0.04965980f, -0.04958360f, -0.04950510f, -0.04942429f, -0.04934116f, -0.04925569f,
-    -0.04916787f, -0.04907769f, -0.04898514f, -0.04889020f, -0.04879287f, -0.04869312f, -0.04859094f, -0.04848633f,
-    -0.04837927f, -0.04826974f, -0.04815774f, -0.04804325f, -0.04792626f, -0.04780675f, -0.04768472f, -0.04756015f,
-    -0.04743303f, -0.04730335f, -0.04717109f, -0.04703624f, -0.04689879f, -0.04675873f, -0.04661604f, -0.04647072f,
-    -0.04632274f, -0.04617210f, -0.04601879f, -0.04586279f, -0.04570409f, -0.04554268f, -0.04537854f, -0.04521167f,
-    -0.04504205f, -0.04486968f, -0.04469453f, -0.04451659f, -0.04433586f, -0.04415233f, -0.04396597f, -0.04377679f,
-    -0.04358476f, -0.04338988f, -0.04319213f, -0.04299150f, -0.04278799f, -0.04258157f, -0.04237224f, -0.04215999f,
-    -0.04194480f, -0.04172667f, -0.04150557f, -0.04128151f, -0.04105447f, -0.04082444f, -0.04059140f, -0.04035536f,
-    -0.04011628f, -0.03987417f, -0.03962902f, -0.03938081f, -0.03912953f, -0.03887517f, -0.03861772f, -0.03835717f,
-    -0.03809351f, -0.03782673f, -0.03755682f, -0.03728377f, -0.03700756f, -0.03672819f, -0.03644565f, -0.03615993f,
-    -0.03587101f, -0.03557889f, -0.03528356f, -0.03498501f, -0.03468322f, -0.03437819f, -0.03406991f, -0.03375837f,
-    -0.03344356f, -0.03312547f, -0.03280408f, -0.03247940f, -0.03215141f, -0.03182011f, -0.03148547f, -0.03114751f,
-    -0.03080619f, -0.03046153f, -0.03011350f, -0.02976210f, -0.02940733f, -0.02904916f, -0.02868760f, -0.02832264f,
-    -0.02795426f, -0.02758247f, -0.02720724f, -0.02682858f, -0.02644647f, -0.02606091f, -0.02567189f, -0.02527940f,
-    -0.02488344f, -0.02448399f, -0.02408105f, -0.02367462f, -0.02326468f, -0.02285123f, -0.02243426f, -0.02201376f,
-    -0.02158973f, -0.02116217f, -0.02073105f, -0.02029639f, -0.01985816f, -0.01941638f, -0.01897102f, -0.01852208f,
-    -0.01806956f, -0.01761345f, -0.01715375f, -0.01669044f, -0.01622353f, -0.01575301f, -0.01527887f, -0.01480111f,
-    -0.01431972f, -0.01383470f, -0.01334604f, -0.01285374f, -0.01235780f, -0.01185820f, -0.01135495f, -0.01084803f,
-    -0.01033746f, -0.00982321f, -0.00930530f, -0.00878370f, -0.00825843f, -0.00772948f, -0.00719683f, -0.00666050f,
-    -0.00612048f, -0.00557675f, -0.00502933f, -0.00447821f, -0.00392338f, -0.00336484f, -0.00280260f, -0.00223664f,
-    -0.00166696f, -0.00109357f, -0.00051647f, 0.00006436f, 0.00064892f, 0.00123719f, 0.00182919f, 0.00242492f,
-    0.00302437f, 0.00362755f, 0.00423447f, 0.00484511f, 0.00545948f, 0.00607759f, 0.00669942f, 0.00732499f,
-    0.00795429f, 0.00858732f, 0.00922408f, 0.00986458f, 0.01050880f, 0.01115675f, 0.01180843f, 0.01246384f,
-    0.01312298f, 0.01378584f, 0.01445243f, 0.01512273f, 0.01579676f, 0.01647451f, 0.01715597f, 0.01784115f,
-    0.01853004f, 0.01922264f, 0.01991895f, 0.02061896f, 0.02132267f, 0.02203008f, 0.02274118f, 0.02345597f,
-    0.02417446f, 0.02489662f, 0.02562247f, 0.02635199f, 0.02708518f, 0.02782204f, 0.02856256f, 0.02930674f,
-    0.03005457f, 0.03080605f, 0.03156117f, 0.03231993f, 0.03308232f, 0.03384833f, 0.03461797f, 0.03539121f,
-    0.03616807f, 0.03694852f, 0.03773257f, 0.03852021f, 0.03931142f, 0.04010621f, 0.04090457f, 0.04170648f,
-    0.04251195f, 0.04332095f, 0.04413349f, 0.04494956f, 0.04576915f, 0.04659224f, 0.04741884f, 0.04824893f,
-    0.04908250f, 0.04991955f, 0.05076005f, 0.05160402f, 0.05245143f, 0.05330227f, 0.05415654f, 0.05501422f,
-    0.05587530f, 0.05673978f, 0.05760764f, 0.05847887f, 0.05935346f, 0.06023140f, 0.06111267f, 0.06199727f,
-    0.06288518f, 0.06377639f, 0.06467089f, 0.06556866f, 0.06646970f, 0.06737398f, 0.06828150f, 0.06919224f,
-    0.07010620f, 0.07102334f, 0.07194367f, 0.07286717f, 0.07379382f, 0.07472361f, 0.07565652f, 0.07659254f,
-    0.07753165f, 0.07847384f, 0.07941910f, 0.08036740f, 0.08131873f, 0.08227308f, 0.08323043f, 0.08419075f,
-    0.08515405f, 0.08612029f, 0.08708946f, 0.08806155f, 0.08903654f, 0.09001440f, 0.09099513f, 0.09197870f,
-    0.09296509f, 0.09395429f, 0.09494628f, 0.09594103f, 0.09693854f, 0.09793877f, 0.09894172f, 0.09994736f,
-    0.10095567f, 0.10196663f, 0.10298022f, 0.10399642f, 0.10501521f, 0.10603657f, 0.10706048f, 0.10808692f,
-    0.10911586f, 0.11014728f, 0.11118116f, 0.11221749f, 0.11325623f, 0.11429736f, 0.11534087f, 0.11638672f,
-    0.11743490f, 0.11848539f, 0.11953815f, 0.12059316f, 0.12165041f, 0.12270987f, 0.12377150f, 0.12483530f,
-    0.12590123f, 0.12696926f, 0.12803938f, 0.12911156f, 0.13018577f, 0.13126198f, 0.13234018f, 0.13342033f,
-    0.13450240f, 0.13558638f, 0.13667224f, 0.13775994f, 0.13884946f, 0.13994077f, 0.14103385f, 0.14212867f,
-    0.14322519f, 0.14432340f, 0.14542326f, 0.14652474f, 0.14762782f, 0.14873247f, 0.14983865f, 0.15094634f,
-    0.15205551f, 0.15316613f, 0.15427816f, 0.15539159f, 0.15650637f, 0.15762248f, 0.15873988f, 0.15985855f,
-    0.16097846f, 0.16209956f, 0.16322184f, 0.16434526f, 0.16546978f, 0.16659538f, 0.16772203f, 0.16884968f,
-    0.16997831f, 0.17110788f, 0.17223837f, 0.17336973f, 0.17450194f, 0.17563496f, 0.17676876f, 0.17790329f,
-    0.17903854f, 0.18017446f, 0.18131102f, 0.18244818f, 0.18358591f, 0.18472418f, 0.18586294f, 0.18700217f,
-    0.18814182f, 0.18928187f, 0.19042227f, 0.19156298f, 0.19270398f, 0.19384522f, 0.19498668f, 0.19612830f,
-    0.19727006f, 0.19841191f, 0.19955382f, 0.20069575f, 0.20183766f, 0.20297952f, 0.20412128f, 0.20526291f,
-    0.20640437f, 0.20754562f, 0.20868662f, 0.20982733f, 0.21096772f, 0.21210773f, 0.21324734f, 0.21438650f,
-    0.21552517f, 0.21666332f, 0.21780089f, 0.21893786f, 0.22007418f, 0.22120980f, 0.22234470f, 0.22347882f,
-    0.22461213f, 0.22574458f, 0.22687613f, 0.22800674f, 0.22913637f, 0.23026498f, 0.23139252f, 0.23251895f,
-    0.23364422f, 0.23476831f, 0.23589115f, 0.23701271f, 0.23813295f, 0.23925182f, 0.24036928f, 0.24148528f,
-    0.24259979f, 0.24371275f, 0.24482412f, 0.24593386f, 0.24704193f, 0.24814827f, 0.24925285f, 0.25035561f,
-    0.25145652f, 0.25255553f, 0.25365259f, 0.25474766f, 0.25584069f, 0.25693164f, 0.25802045f, 0.25910710f,
-    0.26019152f, 0.26127367f, 0.26235351f, 0.26343099f, 0.26450606f, 0.26557868f, 0.26664879f, 0.26771636f,
-    0.26878133f, 0.26984366f, 0.27090330f, 0.27196020f, 0.27301432f, 0.27406561f, 0.27511401f, 0.27615949f,
-    0.27720199f, 0.27824146f, 0.27927787f, 0.28031115f, 0.28134126f, 0.28236816f, 0.28339178f, 0.28441210f,
-    0.28542905f, 0.28644258f, 0.28745266f, 0.28845922f, 0.28946222f, 0.29046162f, 0.29145735f, 0.29244938f,
-    0.29343764f, 0.29442211f, 0.29540271f, 0.29637941f, 0.29735215f, 0.29832088f, 0.29928555f, 0.30024612f,
-    0.30120254f, 0.30215474f, 0.30310269f, 0.30404633f, 0.30498562f, 0.30592049f, 0.30685091f, 0.30777681f,
-    0.30869816f, 0.30961489f, 0.31052696f, 0.31143433f, 0.31233692f, 0.31323471f, 0.31412763f, 0.31501563f,
-    0.31589867f, 0.31677668f, 0.31764963f, 0.31851746f, 0.31938012f, 0.32023755f, 0.32108972f, 0.32193655f,
-    0.32277801f, 0.32361404f, 0.32444460f, 0.32526962f, 0.32608906f, 0.32690287f, 0.32771100f, 0.32851339f,
-    0.32930999f, 0.33010075f, 0.33088563f, 0.33166456f, 0.33243750f, 0.33320439f, 0.33396519f, 0.33471984f,
-    0.33546830f, 0.33621050f, 0.33694640f, 0.33767595f, 0.33839910f, 0.33911579f, 0.33982597f, 0.34052959f,
-    0.34122661f, 0.34191696f, 0.34260060f, 0.34327748f, 0.34394754f, 0.34461074f, 0.34526702f, 0.34591633f,
-    0.34655863f, 0.34719385f, 0.34782195f, 0.34844288f, 0.34905659f, 0.34966302f, 0.35026213f, 0.35085386f,
-    0.35143817f, 0.35201500f, 0.35258430f, 0.35314602f, 0.35370012f, 0.35424654f, 0.35478523f, 0.35531613f,
-    0.35583921f, 0.35635441f, 0.35686168f, 0.35736097f, 0.35785224f, 0.35833542f, 0.35881047f, 0.35927735f,
-    0.35973599f, 0.36018636f, 0.36062841f, 0.36106207f, 0.36148731f, 0.36190408f, 0.36231233f, 0.36271200f,
-    0.36310305f, 0.36348544f, 0.36385910f, 0.36422400f, 0.36458009f, 0.36492731f, 0.36526563f, 0.36559498f,
-    0.36591533f, 0.36622663f, 0.36652882f, 0.36682187f, 0.36710572f, 0.36738033f, 0.36764565f, 0.36790163f,
-    0.36814823f, 0.36838540f, 0.36861309f, 0.36883126f, 0.36903987f, 0.36923886f, 0.36942819f, 0.36960782f,
-    0.36977769f, 0.36993777f, 0.37008801f, 0.37022836f, 0.37035878f, 0.37047923f, 0.37058966f, 0.37069003f,
-    0.37078028f, 0.37086039f, 0.37093030f, 0.37098998f, 0.37103937f, 0.37107844f, 0.37110714f, 0.37112543f,
-    0.37113327f, 0.37113061f, 0.37111742f, 0.37109365f, 0.37105926f, 0.37101420f, 0.37095845f, 0.37089195f,
-    0.37081467f, 0.37072657f, 0.37062759f, 0.37051772f, 0.37039690f, 0.37026509f, 0.37012227f, 0.36996838f,
-    0.36980338f, 0.36962725f, 0.36943994f, 0.36924142f, 0.36903163f, 0.36881056f, 0.36857816f, 0.36833439f,
-    0.36807922f, 0.36781261f, 0.36753452f, 0.36724492f, 0.36694377f, 0.36663104f, 0.36630669f, 0.36597069f,
-    0.36562299f, 0.36526358f, 0.36489241f, 0.36450945f, 0.36411466f, 0.36370802f, 0.36328948f, 0.36285902f,
-    0.36241661f, 0.36196221f, 0.36149579f, 0.36101732f, 0.36052677f, 0.36002411f, 0.35950930f, 0.35898232f,
-    0.35844313f, 0.35789171f, 0.35732803f, 0.35675206f, 0.35616377f, 0.35556313f, 0.35495012f, 0.35432470f,
-    0.35368685f, 0.35303654f, 0.35237375f, 0.35169844f, 0.35101060f, 0.35031020f, 0.34959721f, 0.34887160f,
-    0.34813336f, 0.34738246f, 0.34661887f, 0.34584257f, 0.34505354f, 0.34425175f, 0.34343719f, 0.34260983f,
-    0.34176964f, 0.34091662f, 0.34005073f, 0.33917195f, 0.33828027f, 0.33737567f, 0.33645812f, 0.33552761f,
-    0.33458412f, 0.33362763f, 0.33265812f, 0.33167558f, 0.33067998f, 0.32967132f, 0.32864957f, 0.32761471f,
-    0.32656674f, 0.32550564f, 0.32443139f, 0.32334398f, 0.32224339f, 0.32112961f, 0.32000264f, 0.31886244f,
-    0.31770902f, 0.31654236f, 0.31536245f, 0.31416928f, 0.31296283f, 0.31174310f, 0.31051008f, 0.30926376f,
-    0.30800413f, 0.30673117f, 0.30544489f, 0.30414528f, 0.30283232f, 0.30150601f, 0.30016635f, 0.29881332f,
-    0.29744693f, 0.29606717f, 0.29467402f, 0.29326750f, 0.29184759f, 0.29041430f, 0.28896761f, 0.28750753f,
-    0.28603406f, 0.28454719f, 0.28304692f, 0.28153326f, 0.28000619f, 0.27846573f, 0.27691187f, 0.27534461f,
-    0.27376396f, 0.27216992f, 0.27056249f, 0.26894168f, 0.26730748f, 0.26565990f, 0.26399895f, 0.26232464f,
-    0.26063695f, 0.25893592f, 0.25722153f, 0.25549379f, 0.25375272f, 0.25199833f, 0.25023061f, 0.24844958f,
-    0.24665525f, 0.24484763f, 0.24302672f, 0.24119255f, 0.23934512f, 0.23748443f, 0.23561052f, 0.23372338f,
-    0.23182303f, 0.22990948f, 0.22798276f, 0.22604287f, 0.22408982f, 0.22212364f, 0.22014434f, 0.21815194f,
-    0.21614646f, 0.21412790f, 0.21209630f, 0.21005166f, 0.20799402f, 0.20592338f, 0.20383977f, 0.20174321f,
-    0.19963372f, 0.19751133f, 0.19537604f, 0.19322790f, 0.19106692f, 0.18889312f, 0.18670653f, 0.18450717f,
-    0.18229507f, 0.18007026f, 0.17783276f, 0.17558260f, 0.17331980f, 0.17104440f, 0.16875642f, 0.16645588f,
-    0.16414283f, 0.16181729f, 0.15947929f, 0.15712887f, 0.15476604f, 0.15239085f, 0.15000333f, 0.14760351f,
-    0.14519142f, 0.14276710f, 0.14033059f, 0.13788191f, 0.13542111f, 0.13294822f, 0.13046327f, 0.12796631f,
-    0.12545737f, 0.12293649f, 0.12040371f, 0.11785906f, 0.11530260f, 0.11273435f, 0.11015436f, 0.10756267f,
-    0.10495933f, 0.10234436f, 0.09971783f, 0.09707976f, 0.09443022f, 0.09176923f, 0.08909684f, 0.08641310f,
-    0.08371806f, 0.08101176f, 0.07829426f, 0.07556558f, 0.07282580f, 0.07007494f, 0.06731307f, 0.06454023f,
-    0.06175647f, 0.05896185f, 0.05615641f, 0.05334021f, 0.05051329f, 0.04767571f, 0.04482753f, 0.04196880f,
-    0.03909956f, 0.03621988f, 0.03332982f, 0.03042942f, 0.02751875f, 0.02459785f, 0.02166680f, 0.01872564f,
-    0.01577443f, 0.01281323f, 0.00984211f, 0.00686112f, 0.00387031f, 0.00086977f, -0.00214047f, -0.00516033f,
-    -0.00818975f, -0.01122867f, -0.01427703f, -0.01733476f, -0.02040180f, -0.02347809f, -0.02656355f, -0.02965812f,
-    -0.03276174f, -0.03587435f, -0.03899586f, -0.04212622f, -0.04526536f, -0.04841321f, -0.05156969f, -0.05473475f,
-    -0.05790830f, -0.06109029f, -0.06428063f, -0.06747927f, -0.07068611f, -0.07390110f, -0.07712416f, -0.08035522f,
-    -0.08359420f, -0.08684103f, -0.09009563f, -0.09335793f, -0.09662786f, -0.09990533f, -0.10319027f, -0.10648261f,
-    -0.10978226f, -0.11308915f, -0.11640320f, -0.11972434f, -0.12305247f, -0.12638753f, -0.12972943f, -0.13307809f,
-    -0.13643344f, -0.13979538f, -0.14316384f, -0.14653874f, -0.14991999f, -0.15330750f, -0.15670121f, -0.16010102f,
-    -0.16350684f, -0.16691860f, -0.17033620f, -0.17375957f, -0.17718861f, -0.18062325f, -0.18406338f, -0.18750894f,
-    -0.19095982f, -0.19441594f, -0.19787721f, -0.20134354f, -0.20481485f, -0.20829104f, -0.21177202f, -0.21525771f,
-    -0.21874801f, -0.22224283f, -0.22574208f, -0.22924567f, -0.23275351f, -0.23626549f, -0.23978154f, -0.24330155f,
-    -0.24682544f, -0.25035310f, -0.25388445f, -0.25741939f, -0.26095782f, -0.26449965f, -0.26804478f, -0.27159312f,
-    -0.27514457f, -0.27869903f, -0.28225641f, -0.28581660f, -0.28937952f, -0.29294506f, -0.29651312f, -0.30008360f,
-    -0.30365641f, -0.30723145f, -0.31080861f, -0.31438780f, -0.31796891f, -0.32155185f, -0.32513651f, -0.32872280f,
-    -0.33231060f, -0.33589982f, -0.33949036f, -0.34308212f, -0.34667498f, -0.35026886f, -0.35386363f, -0.35745921f,
-    -0.36105549f, -0.36465236f, -0.36824972f, -0.37184746f, -0.37544549f, -0.37904368f, -0.38264195f, -0.38624018f,
-    -0.38983827f, -0.39343610f, -0.39703359f, -0.40063061f, -0.40422706f, -0.40782284f, -0.41141783f, -0.41501193f,
-    -0.41860504f, -0.42219704f, -0.42578783f, -0.42937729f, -0.43296532f, -0.43655181f, -0.44013666f, -0.44371975f,
-    -0.44730097f, -0.45088021f, -0.45445737f, -0.45803233f, -0.46160499f, -0.46517523f, -0.46874294f, -0.47230802f,
-    -0.47587035f, -0.47942982f, -0.48298633f, -0.48653975f, -0.49008998f, -0.49363691f, -0.49718043f, -0.50072042f,
-    -0.50425678f, -0.50778938f, -0.51131813f, -0.51484290f, -0.51836358f, -0.52188007f, -0.52539225f, -0.52890001f,
-    -0.53240323f, -0.53590180f, -0.53939561f, -0.54288455f, -0.54636851f, -0.54984736f, -0.55332101f, -0.55678932f,
-    -0.56025220f, -0.56370953f, -0.56716119f, -0.57060708f, -0.57404707f, -0.57748106f, -0.58090893f, -0.58433057f,
-    -0.58774586f, -0.59115470f, -0.59455696f, -0.59795254f, -0.60134131f, -0.60472318f, -0.60809801f, -0.61146571f,
-    -0.61482615f, -0.61817923f, -0.62152482f, -0.62486282f, -0.62819311f, -0.63151558f, -0.63483012f, -0.63813661f,
-    -0.64143493f, -0.64472498f, -0.64800664f, -0.65127981f, -0.65454435f, -0.65780017f, -0.66104715f, -0.66428517f,
-    -0.66751413f, -0.67073391f, -0.67394439f, -0.67714547f, -0.68033703f, -0.68351897f, -0.68669116f, -0.68985349f,
-    -0.69300586f, -0.69614815f, -0.69928025f, -0.70240205f, -0.70551344f, -0.70861429f, -0.71170452f, -0.71478399f,
-    -0.71785260f, -0.72091024f, -0.72395681f, -0.72699218f, -0.73001624f, -0.73302890f, -0.73603003f, -0.73901953f,
-    -0.74199729f, -0.74496319f, -0.74791713f, -0.75085901f, -0.75378870f, -0.75670610f, -0.75961111f, -0.76250361f,
-    -0.76538349f, -0.76825065f, -0.77110499f, -0.77394638f, -0.77677474f, -0.77958993f, -0.78239187f, -0.78518045f,
-    -0.78795555f, -0.79071708f, -0.79346492f, -0.79619897f, -0.79891913f, -0.80162529f, -0.80431735f, -0.80699519f,
-    -0.80965872f, -0.81230784f, -0.81494244f, -0.81756241f, -0.82016765f, -0.82275807f, -0.82533355f, -0.82789400f,
-    -0.83043931f, -0.83296939f, -0.83548413f, -0.83798342f, -0.84046718f, -0.84293530f, -0.84538768f, -0.84782422f,
-    -0.85024482f, -0.85264939f, -0.85503782f, -0.85741002f, -0.85976588f, -0.86210532f, -0.86442823f, -0.86673452f,
-    -0.86902410f, -0.87129686f, -0.87355271f, -0.87579156f, -0.87801331f, -0.88021787f, -0.88240514f, -0.88457504f,
-    -0.88672746f, -0.88886232f, -0.89097952f, -0.89307897f, -0.89516059f, -0.89722427f, -0.89926993f, -0.90129749f,
-    -0.90330684f, -0.90529791f, -0.90727060f, -0.90922483f, -0.91116050f, -0.91307753f, -0.91497584f, -0.91685534f,
-    -0.91871594f, -0.92055755f, -0.92238010f, -0.92418350f, -0.92596766f, -0.92773250f, -0.92947795f, -0.93120391f,
-    -0.93291030f, -0.93459705f, -0.93626408f, -0.93791130f, -0.93953863f, -0.94114599f, -0.94273332f, -0.94430052f,
-    -0.94584752f, -0.94737425f, -0.94888063f, -0.95036658f, -0.95183203f, -0.95327690f, -0.95470112f, -0.95610461f,
-    -0.95748731f, -0.95884913f, -0.96019002f, -0.96150989f, -0.96280868f, -0.96408632f, -0.96534273f, -0.96657786f,
-    -0.96779162f, -0.96898396f, -0.97015480f, -0.97130408f, -0.97243173f, -0.97353770f, -0.97462191f, -0.97568429f,
-    -0.97672480f, -0.97774336f, -0.97873991f, -0.97971439f, -0.98066674f, -0.98159691f, -0.98250482f, -0.98339042f,
-    -0.98425366f, -0.98509448f, -0.98591281f, -0.98670861f, -0.98748181f, -0.98823237f, -0.98896022f, -0.98966532f,
-    -0.99034762f, -0.99100705f, -0.99164357f, -0.99225713f, -0.99284768f, -0.99341516f, -0.99395953f, -0.99448075f,
-    -0.99497876f, -0.99545351f, -0.99590497f, -0.99633308f, -0.99673781f, -0.99711910f, -0.99747692f, -0.99781122f,
-    -0.99812196f, -0.99840910f, -0.99867260f, -0.99891241f, -0.99912851f, -0.99932086f, -0.99948940f, -0.99963412f,
-    -0.99975497f, -0.99985191f, -0.99992492f, -0.99997396f, -0.99999900f, -1.00000000f, -0.99997693f, -0.99992977f,
-    -0.99985848f, -0.99976303f, -0.99964340f, -0.99949955f, -0.99933147f, -0.99913912f, -0.99892247f, -0.99868152f,
-    -0.99841622f, -0.99812656f, -0.99781251f, -0.99747406f, -0.99711118f, -0.99672385f, -0.99631206f, -0.99587578f,
-    -0.99541500f, -0.99492969f, -0.99441986f, -0.99388547f, -0.99332652f, -0.99274298f, -0.99213486f, -0.99150213f,
-    -0.99084478f, -0.99016281f, -0.98945620f, -0.98872495f, -0.98796904f, -0.98718848f, -0.98638324f, -0.98555333f,
-    -0.98469875f, -0.98381948f, -0.98291553f, -0.98198688f, -0.98103355f, -0.98005553f, -0.97905281f, -0.97802541f,
-    -0.97697331f, -0.97589653f, -0.97479506f, -0.97366892f, -0.97251810f, -0.97134261f, -0.97014245f, -0.96891764f,
-    -0.96766818f, -0.96639408f, -0.96509535f, -0.96377200f, -0.96242404f, -0.96105149f, -0.95965435f, -0.95823263f,
-    -0.95678637f, -0.95531556f, -0.95382023f, -0.95230039f, -0.95075606f, -0.94918726f, -0.94759401f, -0.94597632f,
-    -0.94433423f, -0.94266774f, -0.94097689f, -0.93926169f, -0.93752218f, -0.93575837f, -0.93397029f, -0.93215798f,
-    -0.93032144f, -0.92846073f, -0.92657585f, -0.92466685f, -0.92273376f, -0.92077660f, -0.91879541f, -0.91679021f,
-    -0.91476106f, -0.91270798f, -0.91063100f, -0.90853016f, -0.90640550f, -0.90425707f, -0.90208488f, -0.89988900f,
-    -0.89766945f, -0.89542628f, -0.89315953f, -0.89086924f, -0.88855546f, -0.88621823f, -0.88385760f, -0.88147361f,
-    -0.87906631f, -0.87663575f, -0.87418197f, -0.87170503f, -0.86920498f, -0.86668186f, -0.86413573f, -0.86156664f,
-    -0.85897465f, -0.85635980f, -0.85372216f, -0.85106177f, -0.84837870f, -0.84567300f, -0.84294473f, -0.84019396f,
-    -0.83742073f, -0.83462510f, -0.83180715f, -0.82896693f, -0.82610451f, -0.82321994f, -0.82031330f, -0.81738464f,
-    -0.81443404f, -0.81146155f, -0.80846726f, -0.80545121f, -0.80241350f, -0.79935417f, -0.79627331f, -0.79317098f,
-    -0.79004726f, -0.78690222f, -0.78373592f, -0.78054846f, -0.77733990f, -0.77411031f, -0.77085978f, -0.76758837f,
-    -0.76429617f, -0.76098326f, -0.75764972f, -0.75429562f, -0.75092104f, -0.74752607f, -0.74411079f, -0.74067528f,
-    -0.73721963f, -0.73374392f, -0.73024823f, -0.72673265f, -0.72319727f, -0.71964217f, -0.71606744f, -0.71247317f,
-    -0.70885945f, -0.70522636f, -0.70157401f, -0.69790247f, -0.69421185f, -0.69050223f, -0.68677371f, -0.68302638f,
-    -0.67926033f, -0.67547567f, -0.67167248f, -0.66785087f, -0.66401092f, -0.66015275f, -0.65627644f, -0.65238209f,
-    -0.64846981f, -0.64453970f, -0.64059185f, -0.63662637f, -0.63264336f, -0.62864293f, -0.62462517f, -0.62059019f,
-    -0.61653810f, -0.61246900f, -0.60838300f, -0.60428020f, -0.60016071f, -0.59602464f, -0.59187209f, -0.58770319f,
-    -0.58351802f, -0.57931672f, -0.57509938f, -0.57086611f, -0.56661704f, -0.56235226f, -0.55807190f, -0.55377607f,
-    -0.54946489f, -0.54513845f, -0.54079689f, -0.53644032f, -0.53206885f, -0.52768260f, -0.52328169f, -0.51886624f,
-    -0.51443636f, -0.50999217f, -0.50553380f, -0.50106135f, -0.49657496f, -0.49207475f, -0.48756083f, -0.48303332f,
-    -0.47849236f, -0.47393805f, -0.46937054f, -0.46478993f, -0.46019636f, -0.45558994f, -0.45097081f, -0.44633909f,
-    -0.44169490f, -0.43703837f, -0.43236964f, -0.42768882f, -0.42299605f, -0.41829144f, -0.41357515f, -0.40884728f,
-    -0.40410797f, -0.39935735f, -0.39459556f, -0.38982271f, -0.38503895f, -0.38024441f, -0.37543921f, -0.37062349f,
-    -0.36579738f, -0.36096102f, -0.35611454f, -0.35125807f, -0.34639174f, -0.34151570f, -0.33663008f, -0.33173501f,
-    -0.32683062f, -0.32191706f, -0.31699446f, -0.31206296f, -0.30712269f, -0.30217379f, -0.29721640f, -0.29225065f,
-    -0.28727670f, -0.28229466f, -0.27730469f, -0.27230692f, -0.26730149f, -0.26228854f, -0.25726821f, -0.25224064f,
-    -0.24720598f, -0.24216435f, -0.23711591f, -0.23206079f, -0.22699914f, -0.22193110f, -0.21685680f, -0.21177640f,
-    -0.20669003f, -0.20159784f, -0.19649997f, -0.19139656f, -0.18628775f, -0.18117370f, -0.17605454f, -0.17093041f,
-    -0.16580147f, -0.16066785f, -0.15552970f, -0.15038717f, -0.14524039f, -0.14008952f, -0.13493469f, -0.12977606f,
-    -0.12461377f, -0.11944796f, -0.11427878f, -0.10910638f, -0.10393090f, -0.09875248f, -0.09357128f, -0.08838744f,
-    -0.08320110f, -0.07801242f, -0.07282153f, -0.06762858f, -0.06243373f, -0.05723712f, -0.05203889f, -0.04683919f,
-    -0.04163816f, -0.03643596f, -0.03123274f, -0.02602863f, -0.02082378f, -0.01561835f, -0.01041248f, -0.00520631f,
+alignas(4) const int16_t waveform_Choir[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+         0,    341,    682,   1023,   1364,   1705,   2046,   2386,   2726,   3066,   3406,   3745,   4083,   4421,   4759,   5096,
+      5433,   5769,   6104,   6439,   6773,   7106,   7438,   7770,   8100,   8430,   8759,   9086,   9413,   9739,  10063,  10387,
+     10709,  11030,  11350,  11669,  11986,  12302,  12617,  12930,  13241,  13552,  13860,  14167,  14473,  14777,  15079,  15380,
+     15679,  15976,  16271,  16565,  16857,  17146,  17434,  17720,  18004,  18286,  18566,  18844,  19120,  19394,  19665,  19935,
+     20202,  20467,  20730,  20990,  21248,  21504,  21758,  22009,  22257,  22504,  22747,  22988,  23227,  23463,  23697,  23928,
+     24156,  24382,  24605,  24826,  25044,  25259,  25471,  25681,  25888,  26092,  26293,  26491,  26687,  26879,  27069,  27256,
+     27440,  27621,  27799,  27974,  28146,  28315,  28481,  28644,  28804,  28961,  29115,  29266,  29414,  29559,  29700,  29839,
+     29974,  30106,  30235,  30361,  30484,  30603,  30720,  30833,  30943,  31050,  31153,  31254,  31351,  31445,  31536,  31623,
+     31708,  31789,  31867,  31941,  32013,  32081,  32146,  32207,  32266,  32321,  32373,  32422,  32467,  32509,  32548,  32584,
+     32617,  32646,  32672,  32695,  32715,  32732,  32745,  32755,  32762,  32766,  32767,  32765,  32759,  32750,  32738,  32724,
+     32705,  32684,  32660,  32633,  32603,  32569,  32533,  32493,  32451,  32405,  32357,  32305,  32251,  32194,  32134,  32070,
+     32004,  31935,  31864,  31789,  31712,  31631,  31548,  31463,  31374,  31283,  31189,  31092,  30993,  30891,  30786,  30679,
+     30569,  30456,  30341,  30224,  30104,  29981,  29856,  29729,  29599,  29466,  29332,  29195,  29055,  28914,  28770,  28624,
+     28475,  28325,  28172,  28017,  27860,  27701,  27540,  27376,  27211,  27044,  26874,  26703,  26530,  26355,  26178,  25999,
+     25819,  25637,  25453,  25267,  25079,  24890,  24699,  24507,  24313,  24118,  23920,  23722,  23522,  23320,  23118,  22913,
+     22708,  22501,  22293,  22083,  21872,  21661,  21447,  21233,  21018,  20801,  20584,  20366,  20146,  19926,  19704,  19482,
+     19259,  19035,  18810,  18584,  18358,  18131,  17903,  17674,  17445,  17216,  16985,  16754,  16523,  16291,  16059,  15826,
+     15593,  15359,  15125,  14891,  14657,  14422,  14187,  13952,  13716,  13481,  13245,  13010,  12774,  12538,  12302,  12066,
+     11831,  11595,  11360,  11124,  10889,  10654,  10419,  10184,   9950,   9716,   9482,   9249,   9016,   8783,   8551,   8319,
+      8088,   7857,   7627,   7397,   7168,   6939,   6711,   6484,   6257,   6031,   5806,   5581,   5358,   5135,   4912,   4691,
+      4471,   4251,   4032,   3814,   3597,   3381,   3166,   2952,   2739,   2527,   2316,   2106,   1897,   1690,   1483,   1278,
+      1074,    870,    669,    468,    268,     70,   -127,   -322,   -517,   -710,   -902,  -1092,  -1281,  -1469,  -1655,  -1840,
+     -2024,  -2206,  -2386,  -2565,  -2743,  -2919,  -3094,  -3267,  -3439,  -3609,  -3778,  -3945,  -4111,  -4275,  -4437,  -4598,
+     -4757,  -4915,  -5071,  -5226,  -5378,  -5530,  -5679,  -5827,  -5973,  -6118,  -6261,  -6402,  -6541,  -6679,  -6815,  -6950,
+     -7082,  -7213,  -7343,  -7470,  -7596,  -7720,  -7843,  -7963,  -8082,  -8199,  -8315,  -8428,  -8540,  -8650,  -8759,  -8866,
+     -8970,  -9074,  -9175,  -9275,  -9372,  -9469,  -9563,  -9656,  -9746,  -9836,  -9923, -10009, -10092, -10174, -10255, -10333,
+    -10410, -10486, -10559, -10631, -10701, -10769, -10835, -10900, -10963, -11025, -11084, -11142, -11199, -11253, -11306, -11358,
+    -11407, -11455, -11502, -11546, -11589, -11631, -11670, -11709, -11745, -11780, -11813, -11845, -11875, -11904, -11931, -11956,
+    -11980, -12003, -12024, -12043, -12061, -12077, -12092, -12105, -12117, -12128, -12137, -12144, -12150, -12155, -12159, -12160,
+    -12161, -12160, -12158, -12154, -12149, -12143, -12136, -12127, -12117, -12105, -12092, -12078, -12063, -12047, -12029, -12010,
+    -11990, -11969, -11946, -11923, -11898, -11872, -11845, -11817, -11787, -11757, -11726, -11693, -11660, -11625, -11590, -11553,
+    -11516, -11477, -11438, -11397, -11356, -11313, -11270, -11226, -11181, -11135, -11088, -11041, -10992, -10943, -10893, -10842,
+    -10791, -10738, -10685, -10631, -10576, -10521, -10465, -10408, -10351, -10293, -10234, -10175, -10115, -10055,  -9993,  -9932,
+     -9870,  -9807,  -9743,  -9679,  -9615,  -9550,  -9485,  -9419,  -9353,  -9286,  -9219,  -9151,  -9083,  -9015,  -8946,  -8877,
+     -8807,  -8737,  -8667,  -8597,  -8526,  -8455,  -8383,  -8311,  -8239,  -8167,  -8095,  -8022,  -7949,  -7876,  -7803,  -7729,
+     -7656,  -7582,  -7508,  -7434,  -7360,  -7286,  -7211,  -7137,  -7062,  -6987,  -6913,  -6838,  -6763,  -6688,  -6614,  -6539,
+     -6464,  -6389,  -6314,  -6240,  -6165,  -6090,  -6016,  -5941,  -5867,  -5792,  -5718,  -5644,  -5570,  -5496,  -5422,  -5348,
+     -5275,  -5201,  -5128,  -5055,  -4982,  -4910,  -4837,  -4765,  -4693,  -4621,  -4550,  -4478,  -4407,  -4336,  -4266,  -4195,
+     -4125,  -4056,  -3986,  -3917,  -3848,  -3779,  -3711,  -3643,  -3575,  -3508,  -3441,  -3374,  -3308,  -3242,  -3176,  -3111,
+     -3046,  -2982,  -2917,  -2854,  -2790,  -2727,  -2665,  -2602,  -2540,  -2479,  -2418,  -2357,  -2297,  -2237,  -2178,  -2119,
+     -2061,  -2002,  -1945,  -1888,  -1831,  -1775,  -1719,  -1663,  -1608,  -1554,  -1500,  -1446,  -1393,  -1340,  -1288,  -1236,
+     -1185,  -1134,  -1084,  -1034,   -985,   -936,   -888,   -840,   -792,   -745,   -699,   -653,   -607,   -562,   -518,   -474,
+      -430,   -387,   -344,   -302,   -261,   -220,   -179,   -139,    -99,    -60,    -21,     17,     55,     92,    129,    165,
+       201,    236,    271,    305,    339,    372,    405,    437,    469,    501,    532,    562,    592,    622,    651,    679,
+       707,    735,    762,    789,    815,    841,    867,    892,    916,    940,    964,    987,   1009,   1032,   1054,   1075,
+      1096,   1116,   1136,   1156,   1175,   1194,   1213,   1231,   1248,   1265,   1282,   1299,   1314,   1330,   1345,   1360,
+      1374,   1388,   1402,   1415,   1428,   1441,   1453,   1465,   1476,   1487,   1498,   1508,   1518,   1527,   1537,   1546,
+      1554,   1562,   1570,   1578,   1585,   1592,   1599,   1605,   1611,   1617,   1622,   1627,   1632,   1636,   1641,   1645,
+      1648,   1651,   1654,   1657,   1660,   1662,   1664,   1666,   1667,   1668,   1669,   1670,   1670,   1671,   1670,   1670,
+      1670,   1669,   1668,   1667,   1665,   1664,   1662,   1660,   1658,   1655,   1653,   1650,   1647,   1644,   1640,   1637,
+      1633,   1629,   1625,   1620,   1616,   1611,   1607,   1602,   1597,   1591,   1586,   1580,   1575,   1569,   1563,   1557,
+      1551,   1544,   1538,   1531,   1525,   1518,   1511,   1504,   1497,   1490,   1482,   1475,   1467,   1460,   1452,   1444,
+      1436,   1428,   1420,   1412,   1404,   1395,   1387,   1379,   1370,   1361,   1353,   1344,   1335,   1327,   1318,   1309,
+      1300,   1291,   1282,   1273,   1264,   1255,   1245,   1236,   1227,   1218,   1208,   1199,   1190,   1180,   1171,   1161,
+      1152,   1143,   1133,   1124,   1114,   1105,   1095,   1086,   1076,   1067,   1057,   1048,   1038,   1029,   1019,   1010,
+      1000,    991,    981,    972,    963,    953,    944,    935,    925,    916,    907,    897,    888,    879,    870,    860,
+       851,    842,    833,    824,    815,    806,    797,    788,    779,    770,    761,    753,    744,    735,    727,    718,
+       709,    701,    692,    684,    675,    667,    659,    650,    642,    634,    626,    617,    609,    601,    593,    585,
+       577,    570,    562,    554,    546,    539,    531,    523,    516,    508,    501,    493,    486,    479,    472,    464,
+       457,    450,    443,    436,    429,    422,    415,    408,    401,    395,    388,    381,    375,    368,    362,    355,
+       349,    342,    336,    329,    323,    317,    311,    305,    298,    292,    286,    280,    274,    268,    262,    257,
+       251,    245,    239,    234,    228,    222,    217,    211,    205,    200,    194,    189,    183,    178,    173,    167,
+       162,    157,    151,    146,    141,    136,    130,    125,    120,    115,    110,    105,    100,     94,     89,     84,
+        79,     74,     69,     64,     59,     54,     49,     44,     39,     35,     30,     25,     20,     15,     10,      5,
+         0,     -5,    -10,    -15,    -20,    -25,    -30,    -35,    -39,    -44,    -49,    -54,    -59,    -64,    -69,    -74,
+       -79,    -84,    -89,    -94,   -100,   -105,   -110,   -115,   -120,   -125,   -130,   -136,   -141,   -146,   -151,   -157,
+      -162,   -167,   -173,   -178,   -183,   -189,   -194,   -200,   -205,   -211,   -217,   -222,   -228,   -234,   -239,   -245,
+      -251,   -257,   -262,   -268,   -274,   -280,   -286,   -292,   -298,   -305,   -311,   -317,   -323,   -329,   -336,   -342,
+      -349,   -355,   -362,   -368,   -375,   -381,   -388,   -395,   -401,   -408,   -415,   -422,   -429,   -436,   -443,   -450,
+      -457,   -464,   -472,   -479,   -486,   -493,   -501,   -508,   -516,   -523,   -531,   -539,   -546,   -554,   -562,   -570,
+      -577,   -585,   -593,   -601,   -609,   -617,   -626,   -634,   -642,   -650,   -659,   -667,   -675,   -684,   -692,   -701,
+      -709,   -718,   -727,   -735,   -744,   -753,   -761,   -770,   -779,   -788,   -797,   -806,   -815,   -824,   -833,   -842,
+      -851,   -860,   -870,   -879,   -888,   -897,   -907,   -916,   -925,   -935,   -944,   -953,   -963,   -972,   -981,   -991,
+     -1000,  -1010,  -1019,  -1029,  -1038,  -1048,  -1057,  -1067,  -1076,  -1086,  -1095,  -1105,  -1114,  -1124,  -1133,  -1143,
+     -1152,  -1161,  -1171,  -1180,  -1190,  -1199,  -1208,  -1218,  -1227,  -1236,  -1245,  -1255,  -1264,  -1273,  -1282,  -1291,
+     -1300,  -1309,  -1318,  -1327,  -1335,  -1344,  -1353,  -1361,  -1370,  -1379,  -1387,  -1395,  -1404,  -1412,  -1420,  -1428,
+     -1436,  -1444,  -1452,  -1460,  -1467,  -1475,  -1482,  -1490,  -1497,  -1504,  -1511,  -1518,  -1525,  -1531,  -1538,  -1544,
+     -1551,  -1557,  -1563,  -1569,  -1575,  -1580,  -1586,  -1591,  -1597,  -1602,  -1607,  -1611,  -1616,  -1620,  -1625,  -1629,
+     -1633,  -1637,  -1640,  -1644,  -1647,  -1650,  -1653,  -1655,  -1658,  -1660,  -1662,  -1664,  -1665,  -1667,  -1668,  -1669,
+     -1670,  -1670,  -1670,  -1671,  -1670,  -1670,  -1669,  -1668,  -1667,  -1666,  -1664,  -1662,  -1660,  -1657,  -1654,  -1651,
+     -1648,  -1645,  -1641,  -1636,  -1632,  -1627,  -1622,  -1617,  -1611,  -1605,  -1599,  -1592,  -1585,  -1578,  -1570,  -1562,
+     -1554,  -1546,  -1537,  -1527,  -1518,  -1508,  -1498,  -1487,  -1476,  -1465,  -1453,  -1441,  -1428,  -1415,  -1402,  -1388,
+     -1374,  -1360,  -1345,  -1330,  -1314,  -1299,  -1282,  -1265,  -1248,  -1231,  -1213,  -1194,  -1175,  -1156,  -1136,  -1116,
+     -1096,  -1075,  -1054,  -1032,  -1009,   -987,   -964,   -940,   -916,   -892,   -867,   -841,   -815,   -789,   -762,   -735,
+      -707,   -679,   -651,   -622,   -592,   -562,   -532,   -501,   -469,   -437,   -405,   -372,   -339,   -305,   -271,   -236,
+      -201,   -165,   -129,    -92,    -55,    -17,     21,     60,     99,    139,    179,    220,    261,    302,    344,    387,
+       430,    474,    518,    562,    607,    653,    699,    745,    792,    840,    888,    936,    985,   1034,   1084,   1134,
+      1185,   1236,   1288,   1340,   1393,   1446,   1500,   1554,   1608,   1663,   1719,   1775,   1831,   1888,   1945,   2002,
+      2061,   2119,   2178,   2237,   2297,   2357,   2418,   2479,   2540,   2602,   2665,   2727,   2790,   2854,   2917,   2982,
+      3046,   3111,   3176,   3242,   3308,   3374,   3441,   3508,   3575,   3643,   3711,   3779,   3848,   3917,   3986,   4056,
+      4125,   4195,   4266,   4336,   4407,   4478,   4550,   4621,   4693,   4765,   4837,   4910,   4982,   5055,   5128,   5201,
+      5275,   5348,   5422,   5496,   5570,   5644,   5718,   5792,   5867,   5941,   6016,   6090,   6165,   6240,   6314,   6389,
+      6464,   6539,   6614,   6688,   6763,   6838,   6913,   6987,   7062,   7137,   7211,   7286,   7360,   7434,   7508,   7582,
+      7656,   7729,   7803,   7876,   7949,   8022,   8095,   8167,   8239,   8311,   8383,   8455,   8526,   8597,   8667,   8737,
+      8807,   8877,   8946,   9015,   9083,   9151,   9219,   9286,   9353,   9419,   9485,   9550,   9615,   9679,   9743,   9807,
+      9870,   9932,   9993,  10055,  10115,  10175,  10234,  10293,  10351,  10408,  10465,  10521,  10576,  10631,  10685,  10738,
+     10791,  10842,  10893,  10943,  10992,  11041,  11088,  11135,  11181,  11226,  11270,  11313,  11356,  11397,  11438,  11477,
+     11516,  11553,  11590,  11625,  11660,  11693,  11726,  11757,  11787,  11817,  11845,  11872,  11898,  11923,  11946,  11969,
+     11990,  12010,  12029,  12047,  12063,  12078,  12092,  12105,  12117,  12127,  12136,  12143,  12149,  12154,  12158,  12160,
+     12161,  12160,  12159,  12155,  12150,  12144,  12137,  12128,  12117,  12105,  12092,  12077,  12061,  12043,  12024,  12003,
+     11980,  11956,  11931,  11904,  11875,  11845,  11813,  11780,  11745,  11709,  11670,  11631,  11589,  11546,  11502,  11455,
+     11407,  11358,  11306,  11253,  11199,  11142,  11084,  11025,  10963,  10900,  10835,  10769,  10701,  10631,  10559,  10486,
+     10410,  10333,  10255,  10174,  10092,  10009,   9923,   9836,   9746,   9656,   9563,   9469,   9372,   9275,   9175,   9074,
+      8970,   8866,   8759,   8650,   8540,   8428,   8315,   8199,   8082,   7963,   7843,   7720,   7596,   7470,   7343,   7213,
+      7082,   6950,   6815,   6679,   6541,   6402,   6261,   6118,   5973,   5827,   5679,   5530,   5378,   5226,   5071,   4915,
+      4757,   4598,   4437,   4275,   4111,   3945,   3778,   3609,   3439,   3267,   3094,   2919,   2743,   2565,   2386,   2206,
+      2024,   1840,   1655,   1469,   1281,   1092,    902,    710,    517,    322,    127,    -70,   -268,   -468,   -669,   -870,
+     -1074,  -1278,  -1483,  -1690,  -1897,  -2106,  -2316,  -2527,  -2739,  -2952,  -3166,  -3381,  -3597,  -3814,  -4032,  -4251,
+     -4471,  -4691,  -4912,  -5135,  -5358,  -5581,  -5806,  -6031,  -6257,  -6484,  -6711,  -6939,  -7168,  -7397,  -7627,  -7857,
+     -8088,  -8319,  -8551,  -8783,  -9016,  -9249,  -9482,  -9716,  -9950, -10184, -10419, -10654, -10889, -11124, -11360, -11595,
+    -11831, -12066, -12302, -12538, -12774, -13010, -13245, -13481, -13716, -13952, -14187, -14422, -14657, -14891, -15125, -15359,
+    -15593, -15826, -16059, -16291, -16523, -16754, -16985, -17216, -17445, -17674, -17903, -18131, -18358, -18584, -18810, -19035,
+    -19259, -19482, -19704, -19926, -20146, -20366, -20584, -20801, -21018, -21233, -21447, -21661, -21872, -22083, -22293, -22501,
+    -22708, -22913, -23118, -23320, -23522, -23722, -23920, -24118, -24313, -24507, -24699, -24890, -25079, -25267, -25453, -25637,
+    -25819, -25999, -26178, -26355, -26530, -26703, -26874, -27044, -27211, -27376, -27540, -27701, -27860, -28017, -28172, -28325,
+    -28475, -28624, -28770, -28914, -29055, -29195, -29332, -29466, -29599, -29729, -29856, -29981, -30104, -30224, -30341, -30456,
+    -30569, -30679, -30786, -30891, -30993, -31092, -31189, -31283, -31374, -31463, -31548, -31631, -31712, -31789, -31864, -31935,
+    -32004, -32070, -32134, -32194, -32251, -32305, -32357, -32405, -32451, -32493, -32533, -32569, -32603, -32633, -32660, -32684,
+    -32705, -32724, -32738, -32750, -32759, -32765, -32767, -32766, -32762, -32755, -32745, -32732, -32715, -32695, -32672, -32646,
+    -32617, -32584, -32548, -32509, -32467, -32422, -32373, -32321, -32266, -32207, -32146, -32081, -32013, -31941, -31867, -31789,
+    -31708, -31623, -31536, -31445, -31351, -31254, -31153, -31050, -30943, -30833, -30720, -30603, -30484, -30361, -30235, -30106,
+    -29974, -29839, -29700, -29559, -29414, -29266, -29115, -28961, -28804, -28644, -28481, -28315, -28146, -27974, -27799, -27621,
+    -27440, -27256, -27069, -26879, -26687, -26491, -26293, -26092, -25888, -25681, -25471, -25259, -25044, -24826, -24605, -24382,
+    -24156, -23928, -23697, -23463, -23227, -22988, -22747, -22504, -22257, -22009, -21758, -21504, -21248, -20990, -20730, -20467,
+    -20202, -19935, -19665, -19394, -19120, -18844, -18566, -18286, -18004, -17720, -17434, -17146, -16857, -16565, -16271, -15976,
+    -15679, -15380, -15079, -14777, -14473, -14167, -13860, -13552, -13241, -12930, -12617, -12302, -11986, -11669, -11350, -11030,
+    -10709, -10387, -10063,  -9739,  -9413,  -9086,  -8759,  -8430,  -8100,  -7770,  -7438,  -7106,  -6773,  -6439,  -6104,  -5769,
+     -5433,  -5096,  -4759,  -4421,  -4083,  -3745,  -3406,  -3066,  -2726,  -2386,  -2046,  -1705,  -1364,  -1023,   -682,   -341,
+    
+    // Level 1: 1024 samples, 511 harmonics
+         0,    682,   1364,   2046,   2726,   3406,   4083,   4759,   5433,   6104,   6773,   7438,   8100,   8759,   9413,  10063,
+     10709,  11350,  11986,  12617,  13241,  13860,  14473,  15079,  15679,  16271,  16857,  17434,  18004,  18566,  19120,  19665,
+     20202,  20730,  21248,  21758,  22257,  22747,  23227,  23697,  24156,  24605,  25044,  25471,  25888,  26293,  26687,  27069,
+     27440,  27799,  28146,  28481,  28804,  29115,  29414,  29700,  29974,  30235,  30484,  30720,  30943,  31153,  31351,  31536,
+     31708,  31867,  32013,  32146,  32266,  32373,  32467,  32548,  32617,  32672,  32715,  32745,  32762,  32767,  32759,  32738,
+     32705,  32660,  32603,  32533,  32451,  32357,  32251,  32134,  32004,  31864,  31712,  31548,  31374,  31189,  30993,  30786,
+     30569,  30341,  30104,  29856,  29599,  29332,  29055,  28770,  28475,  28172,  27860,  27540,  27211,  26874,  26530,  26178,
+     25819,  25453,  25079,  24699,  24313,  23920,  23522,  23118,  22708,  22293,  21872,  21447,  21018,  20584,  20146,  19704,
+     19259,  18810,  18358,  17903,  17445,  16985,  16523,  16059,  15593,  15125,  14657,  14187,  13716,  13245,  12774,  12302,
+     11831,  11360,  10889,  10419,   9950,   9482,   9016,   8551,   8088,   7627,   7168,   6711,   6257,   5806,   5358,   4912,
+      4471,   4032,   3597,   3166,   2739,   2316,   1897,   1483,   1074,    669,    268,   -127,   -517,   -902,  -1281,  -1655,
+     -2024,  -2386,  -2743,  -3094,  -3439,  -3778,  -4111,  -4437,  -4757,  -5071,  -5378,  -5679,  -5973,  -6261,  -6541,  -6815,
+     -7082,  -7343,  -7596,  -7843,  -8082,  -8315,  -8540,  -8759,  -8970,  -9175,  -9372,  -9563,  -9746,  -9923, -10092, -10255,
+    -10410, -10559, -10701, -10835, -10963, -11084, -11199, -11306, -11407, -11502, -11589, -11670, -11745, -11813, -11875, -11931,
+    -11980, -12024, -12061, -12092, -12117, -12137, -12150, -12159, -12161, -12158, -12149, -12136, -12117, -12092, -12063, -12029,
+    -11990, -11946, -11898, -11845, -11787, -11726, -11660, -11590, -11516, -11438, -11356, -11270, -11181, -11088, -10992, -10893,
+    -10791, -10685, -10576, -10465, -10351, -10234, -10115,  -9993,  -9870,  -9743,  -9615,  -9485,  -9353,  -9219,  -9083,  -8946,
+     -8807,  -8667,  -8526,  -8383,  -8239,  -8095,  -7949,  -7803,  -7656,  -7508,  -7360,  -7211,  -7062,  -6913,  -6763,  -6614,
+     -6464,  -6314,  -6165,  -6016,  -5867,  -5718,  -5570,  -5422,  -5275,  -5128,  -4982,  -4837,  -4693,  -4550,  -4407,  -4266,
+     -4125,  -3986,  -3848,  -3711,  -3575,  -3441,  -3308,  -3176,  -3046,  -2917,  -2790,  -2665,  -2540,  -2418,  -2297,  -2178,
+     -2061,  -1945,  -1831,  -1719,  -1608,  -1500,  -1393,  -1288,  -1185,  -1084,   -985,   -888,   -792,   -699,   -607,   -518,
+      -430,   -344,   -261,   -179,    -99,    -21,     55,    129,    201,    271,    339,    405,    469,    532,    592,    651,
+       707,    762,    815,    867,    916,    964,   1009,   1054,   1096,   1136,   1175,   1213,   1248,   1282,   1314,   1345,
+      1374,   1402,   1428,   1453,   1476,   1498,   1518,   1537,   1554,   1570,   1585,   1599,   1611,   1622,   1632,   1641,
+      1648,   1654,   1660,   1664,   1667,   1669,   1670,   1670,   1670,   1668,   1665,   1662,   1658,   1653,   1647,   1640,
+      1633,   1625,   1616,   1607,   1597,   1586,   1575,   1563,   1551,   1538,   1525,   1511,   1497,   1482,   1467,   1452,
+      1436,   1420,   1404,   1387,   1370,   1353,   1335,   1318,   1300,   1282,   1264,   1245,   1227,   1208,   1190,   1171,
+      1152,   1133,   1114,   1095,   1076,   1057,   1038,   1019,   1000,    981,    963,    944,    925,    907,    888,    870,
+       851,    833,    815,    797,    779,    761,    744,    727,    709,    692,    675,    659,    642,    626,    609,    593,
+       577,    562,    546,    531,    516,    501,    486,    472,    457,    443,    429,    415,    401,    388,    375,    362,
+       349,    336,    323,    311,    298,    286,    274,    262,    251,    239,    228,    217,    205,    194,    183,    173,
+       162,    151,    141,    130,    120,    110,    100,     89,     79,     69,     59,     49,     39,     30,     20,     10,
+         0,    -10,    -20,    -30,    -39,    -49,    -59,    -69,    -79,    -89,   -100,   -110,   -120,   -130,   -141,   -151,
+      -162,   -173,   -183,   -194,   -205,   -217,   -228,   -239,   -251,   -262,   -274,   -286,   -298,   -311,   -323,   -336,
+      -349,   -362,   -375,   -388,   -401,   -415,   -429,   -443,   -457,   -472,   -486,   -501,   -516,   -531,   -546,   -562,
+      -577,   -593,   -609,   -626,   -642,   -659,   -675,   -692,   -709,   -727,   -744,   -761,   -779,   -797,   -815,   -833,
+      -851,   -870,   -888,   -907,   -925,   -944,   -963,   -981,  -1000,  -1019,  -1038,  -1057,  -1076,  -1095,  -1114,  -1133,
+     -1152,  -1171,  -1190,  -1208,  -1227,  -1245,  -1264,  -1282,  -1300,  -1318,  -1335,  -1353,  -1370,  -1387,  -1404,  -1420,
+     -1436,  -1452,  -1467,  -1482,  -1497,  -1511,  -1525,  -1538,  -1551,  -1563,  -1575,  -1586,  -1597,  -1607,  -1616,  -1625,
+     -1633,  -1640,  -1647,  -1653,  -1658,  -1662,  -1665,  -1668,  -1670,  -1670,  -1670,  -1669,  -1667,  -1664,  -1660,  -1654,
+     -1648,  -1641,  -1632,  -1622,  -1611,  -1599,  -1585,  -1570,  -1554,  -1537,  -1518,  -1498,  -1476,  -1453,  -1428,  -1402,
+     -1374,  -1345,  -1314,  -1282,  -1248,  -1213,  -1175,  -1136,  -1096,  -1054,  -1009,   -964,   -916,   -867,   -815,   -762,
+      -707,   -651,   -592,   -532,   -469,   -405,   -339,   -271,   -201,   -129,    -55,     21,     99,    179,    261,    344,
+       430,    518,    607,    699,    792,    888,    985,   1084,   1185,   1288,   1393,   1500,   1608,   1719,   1831,   1945,
+      2061,   2178,   2297,   2418,   2540,   2665,   2790,   2917,   3046,   3176,   3308,   3441,   3575,   3711,   3848,   3986,
+      4125,   4266,   4407,   4550,   4693,   4837,   4982,   5128,   5275,   5422,   5570,   5718,   5867,   6016,   6165,   6314,
+      6464,   6614,   6763,   6913,   7062,   7211,   7360,   7508,   7656,   7803,   7949,   8095,   8239,   8383,   8526,   8667,
+      8807,   8946,   9083,   9219,   9353,   9485,   9615,   9743,   9870,   9993,  10115,  10234,  10351,  10465,  10576,  10685,
+     10791,  10893,  10992,  11088,  11181,  11270,  11356,  11438,  11516,  11590,  11660,  11726,  11787,  11845,  11898,  11946,
+     11990,  12029,  12063,  12092,  12117,  12136,  12149,  12158,  12161,  12159,  12150,  12137,  12117,  12092,  12061,  12024,
+     11980,  11931,  11875,  11813,  11745,  11670,  11589,  11502,  11407,  11306,  11199,  11084,  10963,  10835,  10701,  10559,
+     10410,  10255,  10092,   9923,   9746,   9563,   9372,   9175,   8970,   8759,   8540,   8315,   8082,   7843,   7596,   7343,
+      7082,   6815,   6541,   6261,   5973,   5679,   5378,   5071,   4757,   4437,   4111,   3778,   3439,   3094,   2743,   2386,
+      2024,   1655,   1281,    902,    517,    127,   -268,   -669,  -1074,  -1483,  -1897,  -2316,  -2739,  -3166,  -3597,  -4032,
+     -4471,  -4912,  -5358,  -5806,  -6257,  -6711,  -7168,  -7627,  -8088,  -8551,  -9016,  -9482,  -9950, -10419, -10889, -11360,
+    -11831, -12302, -12774, -13245, -13716, -14187, -14657, -15125, -15593, -16059, -16523, -16985, -17445, -17903, -18358, -18810,
+    -19259, -19704, -20146, -20584, -21018, -21447, -21872, -22293, -22708, -23118, -23522, -23920, -24313, -24699, -25079, -25453,
+    -25819, -26178, -26530, -26874, -27211, -27540, -27860, -28172, -28475, -28770, -29055, -29332, -29599, -29856, -30104, -30341,
+    -30569, -30786, -30993, -31189, -31374, -31548, -31712, -31864, -32004, -32134, -32251, -32357, -32451, -32533, -32603, -32660,
+    -32705, -32738, -32759, -32767, -32762, -32745, -32715, -32672, -32617, -32548, -32467, -32373, -32266, -32146, -32013, -31867,
+    -31708, -31536, -31351, -31153, -30943, -30720, -30484, -30235, -29974, -29700, -29414, -29115, -28804, -28481, -28146, -27799,
+    -27440, -27069, -26687, -26293, -25888, -25471, -25044, -24605, -24156, -23697, -23227, -22747, -22257, -21758, -21248, -20730,
+    -20202, -19665, -19120, -18566, -18004, -17434, -16857, -16271, -15679, -15079, -14473, -13860, -13241, -12617, -11986, -11350,
+    -10709, -10063,  -9413,  -8759,  -8100,  -7438,  -6773,  -6104,  -5433,  -4759,  -4083,  -3406,  -2726,  -2046,  -1364,   -682,
+    
+    // Level 2: 512 samples, 255 harmonics
+         0,   1364,   2726,   4083,   5433,   6773,   8100,   9413,  10709,  11986,  13241,  14473,  15679,  16857,  18004,  19120,
+     20202,  21248,  22257,  23227,  24156,  25044,  25888,  26687,  27440,  28146,  28804,  29414,  29974,  30484,  30943,  31351,
+     31708,  32013,  32266,  32467,  32617,  32715,  32762,  32759,  32705,  32603,  32451,  32251,  32004,  31712,  31374,  30993,
+     30569,  30104,  29599,  29055,  28475,  27860,  27211,  26530,  25819,  25079,  24313,  23522,  22708,  21872,  21018,  20146,
+     19259,  18358,  17445,  16523,  15593,  14657,  13716,  12774,  11831,  10889,   9950,   9016,   8088,   7168,   6257,   5358,
+      4471,   3597,   2739,   1897,   1074,    268,   -517,  -1281,  -2024,  -2743,  -3439,  -4111,  -4757,  -5378,  -5973,  -6541,
+     -7082,  -7596,  -8082,  -8540,  -8970,  -9372,  -9746, -10092, -10410, -10701, -10963, -11199, -11407, -11589, -11745, -11875,
+    -11980, -12061, -12117, -12150, -12161, -12149, -12117, -12063, -11990, -11898, -11787, -11660, -11516, -11356, -11181, -10992,
+    -10791, -10576, -10351, -10115,  -9870,  -9615,  -9353,  -9083,  -8807,  -8526,  -8239,  -7949,  -7656,  -7360,  -7062,  -6763,
+     -6464,  -6165,  -5867,  -5570,  -5275,  -4982,  -4693,  -4407,  -4125,  -3848,  -3575,  -3308,  -3046,  -2790,  -2540,  -2297,
+     -2061,  -1831,  -1608,  -1393,  -1185,   -985,   -792,   -607,   -430,   -261,    -99,     55,    201,    339,    469,    592,
+       707,    815,    916,   1009,   1096,   1175,   1248,   1314,   1374,   1428,   1476,   1518,   1554,   1585,   1611,   1632,
+      1648,   1660,   1667,   1670,   1670,   1665,   1658,   1647,   1633,   1616,   1597,   1575,   1551,   1525,   1497,   1467,
+      1436,   1404,   1370,   1335,   1300,   1264,   1227,   1190,   1152,   1114,   1076,   1038,   1000,    963,    925,    888,
+       851,    815,    779,    744,    709,    675,    642,    609,    577,    546,    516,    486,    457,    429,    401,    375,
+       349,    323,    298,    274,    251,    228,    205,    183,    162,    141,    120,    100,     79,     59,     39,     20,
+         0,    -20,    -39,    -59,    -79,   -100,   -120,   -141,   -162,   -183,   -205,   -228,   -251,   -274,   -298,   -323,
+      -349,   -375,   -401,   -429,   -457,   -486,   -516,   -546,   -577,   -609,   -642,   -675,   -709,   -744,   -779,   -815,
+      -851,   -888,   -925,   -963,  -1000,  -1038,  -1076,  -1114,  -1152,  -1190,  -1227,  -1264,  -1300,  -1335,  -1370,  -1404,
+     -1436,  -1467,  -1497,  -1525,  -1551,  -1575,  -1597,  -1616,  -1633,  -1647,  -1658,  -1665,  -1670,  -1670,  -1667,  -1660,
+     -1648,  -1632,  -1611,  -1585,  -1554,  -1518,  -1476,  -1428,  -1374,  -1314,  -1248,  -1175,  -1096,  -1009,   -916,   -815,
+      -707,   -592,   -469,   -339,   -201,    -55,     99,    261,    430,    607,    792,    985,   1185,   1393,   1608,   1831,
+      2061,   2297,   2540,   2790,   3046,   3308,   3575,   3848,   4125,   4407,   4693,   4982,   5275,   5570,   5867,   6165,
+      6464,   6763,   7062,   7360,   7656,   7949,   8239,   8526,   8807,   9083,   9353,   9615,   9870,  10115,  10351,  10576,
+     10791,  10992,  11181,  11356,  11516,  11660,  11787,  11898,  11990,  12063,  12117,  12149,  12161,  12150,  12117,  12061,
+     11980,  11875,  11745,  11589,  11407,  11199,  10963,  10701,  10410,  10092,   9746,   9372,   8970,   8540,   8082,   7596,
+      7082,   6541,   5973,   5378,   4757,   4111,   3439,   2743,   2024,   1281,    517,   -268,  -1074,  -1897,  -2739,  -3597,
+     -4471,  -5358,  -6257,  -7168,  -8088,  -9016,  -9950, -10889, -11831, -12774, -13716, -14657, -15593, -16523, -17445, -18358,
+    -19259, -20146, -21018, -21872, -22708, -23522, -24313, -25079, -25819, -26530, -27211, -27860, -28475, -29055, -29599, -30104,
+    -30569, -30993, -31374, -31712, -32004, -32251, -32451, -32603, -32705, -32759, -32762, -32715, -32617, -32467, -32266, -32013,
+    -31708, -31351, -30943, -30484, -29974, -29414, -28804, -28146, -27440, -26687, -25888, -25044, -24156, -23227, -22257, -21248,
+    -20202, -19120, -18004, -16857, -15679, -14473, -13241, -11986, -10709,  -9413,  -8100,  -6773,  -5433,  -4083,  -2726,  -1364,
+    
+    // Level 3: 256 samples, 127 harmonics
+         0,   2726,   5433,   8100,  10709,  13241,  15679,  18004,  20202,  22257,  24156,  25888,  27440,  28804,  29974,  30943,
+     31708,  32266,  32617,  32762,  32705,  32451,  32004,  31374,  30569,  29599,  28475,  27211,  25819,  24313,  22708,  21018,
+     19259,  17445,  15593,  13716,  11831,   9950,   8088,   6257,   4471,   2739,   1074,   -517,  -2024,  -3439,  -4757,  -5973,
+     -7082,  -8082,  -8970,  -9746, -10410, -10963, -11407, -11745, -11980, -12117, -12161, -12117, -11990, -11787, -11516, -11181,
+    -10791, -10351,  -9870,  -9353,  -8807,  -8239,  -7656,  -7062,  -6464,  -5867,  -5275,  -4693,  -4125,  -3575,  -3046,  -2540,
+     -2061,  -1608,  -1185,   -792,   -430,    -99,    201,    469,    707,    916,   1096,   1248,   1374,   1476,   1554,   1611,
+      1648,   1667,   1670,   1658,   1633,   1597,   1551,   1497,   1436,   1370,   1300,   1227,   1152,   1076,   1000,    925,
+       851,    779,    709,    642,    577,    516,    457,    401,    349,    298,    251,    205,    162,    120,     79,     39,
+         0,    -39,    -79,   -120,   -162,   -205,   -251,   -298,   -349,   -401,   -457,   -516,   -577,   -642,   -709,   -779,
+      -851,   -925,  -1000,  -1076,  -1152,  -1227,  -1300,  -1370,  -1436,  -1497,  -1551,  -1597,  -1633,  -1658,  -1670,  -1667,
+     -1648,  -1611,  -1554,  -1476,  -1374,  -1248,  -1096,   -916,   -707,   -469,   -201,     99,    430,    792,   1185,   1608,
+      2061,   2540,   3046,   3575,   4125,   4693,   5275,   5867,   6464,   7062,   7656,   8239,   8807,   9353,   9870,  10351,
+     10791,  11181,  11516,  11787,  11990,  12117,  12161,  12117,  11980,  11745,  11407,  10963,  10410,   9746,   8970,   8082,
+      7082,   5973,   4757,   3439,   2024,    517,  -1074,  -2739,  -4471,  -6257,  -8088,  -9950, -11831, -13716, -15593, -17445,
+    -19259, -21018, -22708, -24313, -25819, -27211, -28475, -29599, -30569, -31374, -32004, -32451, -32705, -32762, -32617, -32266,
+    -31708, -30943, -29974, -28804, -27440, -25888, -24156, -22257, -20202, -18004, -15679, -13241, -10709,  -8100,  -5433,  -2726,
+    
+    // Level 4: 128 samples, 63 harmonics
+         0,   5433,  10709,  15679,  20202,  24156,  27440,  29974,  31708,  32617,  32705,  32004,  30569,  28475,  25819,  22708,
+     19259,  15593,  11831,   8088,   4471,   1074,  -2024,  -4757,  -7082,  -8970, -10410, -11407, -11980, -12161, -11990, -11516,
+    -10791,  -9870,  -8807,  -7656,  -6464,  -5275,  -4125,  -3046,  -2061,  -1185,   -430,    201,    707,   1096,   1374,   1554,
+      1648,   1670,   1633,   1551,   1436,   1300,   1152,   1000,    851,    709,    577,    457,    349,    251,    162,     79,
+         0,    -79,   -162,   -251,   -349,   -457,   -577,   -709,   -851,  -1000,  -1152,  -1300,  -1436,  -1551,  -1633,  -1670,
+     -1648,  -1554,  -1374,  -1096,   -707,   -201,    430,   1185,   2061,   3046,   4125,   5275,   6464,   7656,   8807,   9870,
+     10791,  11516,  11990,  12161,  11980,  11407,  10410,   8970,   7082,   4757,   2024,  -1074,  -4471,  -8088, -11831, -15593,
+    -19259, -22708, -25819, -28475, -30569, -32004, -32705, -32617, -31708, -29974, -27440, -24156, -20202, -15679, -10709,  -5433,
+    
+    // Level 5: 64 samples, 31 harmonics
+         0,  10709,  20202,  27440,  31708,  32705,  30569,  25819,  19259,  11831,   4471,  -2024,  -7082, -10410, -11980, -11990,
+    -10791,  -8807,  -6464,  -4125,  -2061,   -430,    707,   1374,   1648,   1633,   1436,   1152,    851,    577,    349,    162,
+         0,   -162,   -349,   -577,   -851,  -1152,  -1436,  -1633,  -1648,  -1374,   -707,    430,   2061,   4125,   6464,   8807,
+     10791,  11990,  11980,  10410,   7082,   2024,  -4471, -11831, -19259, -25819, -30569, -32705, -31708, -27440, -20202, -10709,
+    
+    // Level 6: 64 samples, 16 harmonics
+         0,  10709,  20202,  27440,  31708,  32705,  30569,  25819,  19259,  11831,   4471,  -2024,  -7082, -10410, -11980, -11990,
+    -10791,  -8807,  -6464,  -4125,  -2061,   -430,    707,   1374,   1648,   1633,   1436,   1152,    851,    577,    349,    162,
+         0,   -162,   -349,   -577,   -851,  -1152,  -1436,  -1633,  -1648,  -1374,   -707,    430,   2061,   4125,   6464,   8807,
+     10791,  11990,  11980,  10410,   7082,   2024,  -4471, -11831, -19259, -25819, -30569, -32705, -31708, -27440, -20202, -10709,
+    
+    // Level 7: 64 samples, 8 harmonics
+         0,  10709,  20202,  27440,  31708,  32705,  30569,  25819,  19259,  11831,   4471,  -2024,  -7082, -10410, -11980, -11990,
+    -10791,  -8807,  -6464,  -4125,  -2061,   -430,    707,   1374,   1648,   1633,   1436,   1152,    851,    577,    349,    162,
+         0,   -162,   -349,   -577,   -851,  -1152,  -1436,  -1633,  -1648,  -1374,   -707,    430,   2061,   4125,   6464,   8807,
+     10791,  11990,  11980,  10410,   7082,   2024,  -4471, -11831, -19259, -25819, -30569, -32705, -31708, -27440, -20202, -10709,
+    
+    // Level 8: 64 samples, 4 harmonics
+         0,   9671,  18381,  25283,  29741,  31405,  30245,  26542,  20842,  13883,   6494,   -513,  -6437, -10770, -13243, -13842,
+    -12787, -10477,  -7423,  -4163,  -1183,   1144,   2605,   3154,   2903,   2082,    987,    -84,   -883,  -1258,  -1169,   -693,
+         0,    693,   1169,   1258,    883,     84,   -987,  -2082,  -2903,  -3154,  -2605,  -1144,   1183,   4163,   7423,  10477,
+     12787,  13842,  13243,  10770,   6437,    513,  -6494, -13883, -20842, -26542, -30245, -31405, -29741, -25283, -18381,  -9671,
+    
+    // Level 9: 64 samples, 2 harmonics
+         0,   1946,   3823,   5564,   7108,   8401,   9399,  10067,  10385,  10344,   9951,   9223,   8191,   6898,   5395,   3742,
+      2001,    242,  -1470,  -3068,  -4493,  -5693,  -6623,  -7250,  -7554,  -7528,  -7175,  -6514,  -5577,  -4402,  -3042,  -1554,
+         0,   1554,   3042,   4402,   5577,   6514,   7175,   7528,   7554,   7250,   6623,   5693,   4493,   3068,   1470,   -242,
+     -2001,  -3742,  -5395,  -6898,  -8191,  -9223,  -9951, -10344, -10385, -10067,  -9399,  -8401,  -7108,  -5564,  -3823,  -1946,
+    
+    // Level 10: 64 samples, 1 harmonics
+         0,    196,    390,    581,    766,    943,   1112,   1270,   1415,   1547,   1664,   1765,   1849,   1915,   1963,   1992,
+      2001,   1992,   1963,   1915,   1849,   1765,   1664,   1547,   1415,   1270,   1112,    943,    766,    581,    390,    196,
+         0,   -196,   -390,   -581,   -766,   -943,  -1112,  -1270,  -1415,  -1547,  -1664,  -1765,  -1849,  -1915,  -1963,  -1992,
+     -2001,  -1992,  -1963,  -1915,  -1849,  -1765,  -1664,  -1547,  -1415,  -1270,  -1112,   -943,   -766,   -581,   -390,   -196,
     
 };
 
-alignas(4) const float waveform_Acid[4096] = {
-    0.97540036f, 0.97569556f, 0.97598867f, 0.97627971f, 0.97656868f, 0.97685558f, 0.97714043f, 0.97742322f,
-    0.97770396f, 0.97798267f, 0.97825934f, 0.97853398f, 0.97880659f, 0.97907718f, 0.97934577f, 0.97961234f,
-    0.97987691f, 0.98013949f, 0.98040008f, 0.98065868f, 0.98091530f, 0.98116994f, 0.98142262f, 0.98167334f,
-    0.98192210f, 0.98216890f, 0.98241376f, 0.98265668f, 0.98289766f, 0.98313672f, 0.98337384f, 0.98360905f,
-    0.98384235f, 0.98407373f, 0.98430322f, 0.98453080f, 0.98475649f, 0.98498030f, 0.98520222f, 0.98542227f,
-    0.98564045f, 0.98585676f, 0.98607121f, 0.98628380f, 0.98649455f, 0.98670345f, 0.98691051f, 0.98711573f,
-    0.98731913f, 0.98752070f, 0.98772046f, 0.98791840f, 0.98811453f, 0.98830886f, 0.98850139f, 0.98869213f,
-    0.98888108f, 0.98906824f, 0.98925363f, 0.98943725f, 0.98961910f, 0.98979918f, 0.98997751f, 0.99015408f,
-    0.99032891f, 0.99050200f, 0.99067335f, 0.99084296f, 0.99101085f, 0.99117701f, 0.99134146f, 0.99150419f,
-    0.99166522f, 0.99182454f, 0.99198217f, 0.99213810f, 0.99229234f, 0.99244490f, 0.99259579f, 0.99274499f,
-    0.99289253f, 0.99303841f, 0.99318262f, 0.99332518f, 0.99346609f, 0.99360536f, 0.99374298f, 0.99387897f,
-    0.99401333f, 0.99414607f, 0.99427718f, 0.99440667f, 0.99453455f, 0.99466083f, 0.99478550f, 0.99490858f,
-    0.99503006f, 0.99514995f, 0.99526826f, 0.99538499f, 0.99550014f, 0.99561373f, 0.99572575f, 0.99583620f,
-    0.99594510f, 0.99605245f, 0.99615825f, 0.99626251f, 0.99636523f, 0.99646641f, 0.99656607f, 0.99666420f,
-    0.99676081f, 0.99685591f, 0.99694949f, 0.99704156f, 0.99713213f, 0.99722121f, 0.99730879f, 0.99739488f,
-    0.99747948f, 0.99756261f, 0.99764426f, 0.99772443f, 0.99780314f, 0.99788038f, 0.99795617f, 0.99803050f,
-    0.99810338f, 0.99817481f, 0.99824480f, 0.99831336f, 0.99838048f, 0.99844617f, 0.99851044f, 0.99857328f,
-    0.99863471f, 0.99869473f, 0.99875334f, 0.99881054f, 0.99886635f, 0.99892076f, 0.99897377f, 0.99902540f,
-    0.99907565f, 0.99912452f, 0.99917201f, 0.99921814f, 0.99926289f, 0.99930629f, 0.99934832f, 0.99938900f,
-    0.99942833f, 0.99946632f, 0.99950296f, 0.99953826f, 0.99957223f, 0.99960487f, 0.99963618f, 0.99966617f,
-    0.99969484f, 0.99972220f, 0.99974824f, 0.99977298f, 0.99979642f, 0.99981856f, 0.99983941f, 0.99985896f,
-    0.99987723f, 0.99989421f, 0.99990991f, 0.99992434f, 0.99993750f, 0.99994939f, 0.99996002f, 0.99996939f,
-    0.99997750f, 0.99998436f, 0.99998997f, 0.99999433f, 0.99999746f, 0.99999935f, 1.00000000f, 0.99999943f,
-    0.99999762f, 0.99999460f, 0.99999036f, 0.99998491f, 0.99997824f, 0.99997037f, 0.99996129f, 0.99995101f,
-    0.99993954f, 0.99992687f, 0.99991302f, 0.99989798f, 0.99988176f, 0.99986436f, 0.99984579f, 0.99982605f,
-    0.99980514f, 0.99978306f, 0.99975983f, 0.99973544f, 0.99970990f, 0.99968321f, 0.99965537f, 0.99962639f,
-    0.99959627f, 0.99956502f, 0.99953264f, 0.99949912f, 0.99946449f, 0.99942873f, 0.99939185f, 0.99935387f,
-    0.99931477f, 0.99927456f, 0.99923325f, 0.99919084f, 0.99914733f, 0.99910273f, 0.99905704f, 0.99901026f,
-    0.99896240f, 0.99891346f, 0.99886345f, 0.99881236f, 0.99876020f, 0.99870697f, 0.99865269f, 0.99859734f,
-    0.99854093f, 0.99848348f, 0.99842497f, 0.99836542f, 0.99830482f, 0.99824319f, 0.99818051f, 0.99811681f,
-    0.99805207f, 0.99798631f, 0.99791952f, 0.99785172f, 0.99778290f, 0.99771306f, 0.99764221f, 0.99757036f,
-    0.99749750f, 0.99742364f, 0.99734878f, 0.99727293f, 0.99719608f, 0.99711825f, 0.99703944f, 0.99695964f,
-    0.99687886f, 0.99679711f, 0.99671438f, 0.99663068f, 0.99654602f, 0.99646039f, 0.99637381f, 0.99628627f,
-    0.99619777f, 0.99610832f, 0.99601792f, 0.99592658f, 0.99583430f, 0.99574108f, 0.99564692f, 0.99555183f,
-    0.99545581f, 0.99535886f, 0.99526099f, 0.99516220f, 0.99506249f, 0.99496186f, 0.99486033f, 0.99475788f,
-    0.99465453f, 0.99455028f, 0.99444512f, 0.99433907f, 0.99423212f, 0.99412429f, 0.99401556f, 0.99390595f,
-    0.99379545f, 0.99368408f, 0.99357183f, 0.99345870f, 0.99334470f, 0.99322984f, 0.99311411f, 0.99299752f,
-    0.99288006f, 0.99276175f, 0.99264259f, 0.99252257f, 0.99240171f, 0.99228000f, 0.99215744f, 0.99203405f,
-    0.99190982f, 0.99178475f, 0.99165885f, 0.99153213f, 0.99140457f, 0.99127619f, 0.99114700f, 0.99101698f,
-    0.99088615f, 0.99075450f, 0.99062205f, 0.99048878f, 0.99035472f, 0.99021985f, 0.99008418f, 0.98994771f,
-    0.98981045f, 0.98967240f, 0.98953356f, 0.98939393f, 0.98925352f, 0.98911233f, 0.98897036f, 0.98882762f,
-    0.98868410f, 0.98853981f, 0.98839475f, 0.98824893f, 0.98810235f, 0.98795500f, 0.98780690f, 0.98765804f,
-    0.98750843f, 0.98735807f, 0.98720696f, 0.98705511f, 0.98690252f, 0.98674918f, 0.98659511f, 0.98644031f,
-    0.98628477f, 0.98612850f, 0.98597150f, 0.98581378f, 0.98565534f, 0.98549618f, 0.98533630f, 0.98517570f,
-    0.98501439f, 0.98485237f, 0.98468965f, 0.98452622f, 0.98436208f, 0.98419725f, 0.98403172f, 0.98386549f,
-    0.98369857f, 0.98353095f, 0.98336265f, 0.98319367f, 0.98302400f, 0.98285365f, 0.98268262f, 0.98251091f,
-    0.98233853f, 0.98216547f, 0.98199175f, 0.98181736f, 0.98164230f, 0.98146659f, 0.98129021f, 0.98111317f,
-    0.98093548f, 0.98075714f, 0.98057814f, 0.98039849f, 0.98021820f, 0.98003727f, 0.97985569f, 0.97967347f,
-    0.97949061f, 0.97930712f, 0.97912300f, 0.97893824f, 0.97875286f, 0.97856685f, 0.97838021f, 0.97819296f,
-    0.97800508f, 0.97781659f, 0.97762748f, 0.97743776f, 0.97724742f, 0.97705648f, 0.97686493f, 0.97667278f,
-    0.97648002f, 0.97628667f, 0.97609271f, 0.97589816f, 0.97570302f, 0.97550728f, 0.97531096f, 0.97511405f,
-    0.97491655f, 0.97471847f, 0.97451980f, 0.97432056f, 0.97412074f, 0.97392035f, 0.97371938f, 0.97351785f,
-    0.97331574f, 0.97311307f, 0.97290983f, 0.97270603f, 0.97250167f, 0.97229675f, 0.97209128f, 0.97188525f,
-    0.97167867f, 0.97147154f, 0.97126386f, 0.97105563f, 0.97084686f, 0.97063755f, 0.97042769f, 0.97021730f,
-    0.97000637f, 0.96979491f, 0.96958291f, 0.96937039f, 0.96915733f, 0.96894375f, 0.96872965f, 0.96851502f,
-    0.96829987f, 0.96808420f, 0.96786802f, 0.96765132f, 0.96743410f, 0.96721638f, 0.96699814f, 0.96677940f,
-    0.96656016f, 0.96634041f, 0.96612016f, 0.96589940f, 0.96567815f, 0.96545641f, 0.96523417f, 0.96501144f,
-    0.96478821f, 0.96456450f, 0.96434030f, 0.96411562f, 0.96389045f, 0.96366481f, 0.96343868f, 0.96321207f,
-    0.96298499f, 0.96275744f, 0.96252941f, 0.96230091f, 0.96207195f, 0.96184251f, 0.96161261f, 0.96138225f,
-    0.96115143f, 0.96092014f, 0.96068840f, 0.96045621f, 0.96022355f, 0.95999045f, 0.95975689f, 0.95952289f,
-    0.95928843f, 0.95905353f, 0.95881819f, 0.95858241f, 0.95834618f, 0.95810952f, 0.95787241f, 0.95763487f,
-    0.95739690f, 0.95715850f, 0.95691966f, 0.95668040f, 0.95644071f, 0.95620059f, 0.95596005f, 0.95571909f,
-    0.95547771f, 0.95523591f, 0.95499369f, 0.95475106f, 0.95450801f, 0.95426455f, 0.95402068f, 0.95377640f,
-    0.95353171f, 0.95328662f, 0.95304112f, 0.95279522f, 0.95254892f, 0.95230222f, 0.95205512f, 0.95180763f,
-    0.95155974f, 0.95131146f, 0.95106279f, 0.95081372f, 0.95056427f, 0.95031444f, 0.95006421f, 0.94981361f,
-    0.94956262f, 0.94931125f, 0.94905950f, 0.94880738f, 0.94855487f, 0.94830200f, 0.94804875f, 0.94779513f,
-    0.94754114f, 0.94728678f, 0.94703206f, 0.94677697f, 0.94652152f, 0.94626570f, 0.94600952f, 0.94575299f,
-    0.94549609f, 0.94523884f, 0.94498124f, 0.94472328f, 0.94446497f, 0.94420631f, 0.94394730f, 0.94368794f,
-    0.94342824f, 0.94316819f, 0.94290779f, 0.94264706f, 0.94238599f, 0.94212457f, 0.94186282f, 0.94160074f,
-    0.94133832f, 0.94107556f, 0.94081248f, 0.94054906f, 0.94028531f, 0.94002124f, 0.93975684f, 0.93949212f,
-    0.93922707f, 0.93896170f, 0.93869601f, 0.93843000f, 0.93816367f, 0.93789702f, 0.93763006f, 0.93736279f,
-    0.93709520f, 0.93682730f, 0.93655909f, 0.93629058f, 0.93602175f, 0.93575262f, 0.93548319f, 0.93521345f,
-    0.93494341f, 0.93467307f, 0.93440243f, 0.93413150f, 0.93386026f, 0.93358873f, 0.93331691f, 0.93304479f,
-    0.93277239f, 0.93249969f, 0.93222670f, 0.93195343f, 0.93167987f, 0.93140602f, 0.93113189f, 0.93085748f,
-    0.93058279f, 0.93030781f, 0.93003256f, 0.92975703f, 0.92948122f, 0.92920514f, 0.92892879f, 0.92865216f,
-    0.92837526f, 0.92809809f, 0.92782066f, 0.92754295f, 0.92726498f, 0.92698674f, 0.92670824f, 0.92642948f,
-    0.92615045f, 0.92587117f, 0.92559162f, 0.92531182f, 0.92503176f, 0.92475144f, 0.92447087f, 0.92419005f,
-    0.92390897f, 0.92362765f, 0.92334607f, 0.92306425f, 0.92278217f, 0.92249986f, 0.92221729f, 0.92193448f,
-    0.92165143f, 0.92136814f, 0.92108461f, 0.92080084f, 0.92051683f, 0.92023258f, 0.91994810f, 0.91966338f,
-    0.91937843f, 0.91909324f, 0.91880783f, 0.91852218f, 0.91823630f, 0.91795020f, 0.91766387f, 0.91737731f,
-    0.91709053f, 0.91680352f, 0.91651629f, 0.91622884f, 0.91594117f, 0.91565328f, 0.91536517f, 0.91507684f,
-    0.91478830f, 0.91449954f, 0.91421057f, 0.91392139f, 0.91363199f, 0.91334238f, 0.91305256f, 0.91276254f,
-    0.91247230f, 0.91218186f, 0.91189121f, 0.91160036f, 0.91130930f, 0.91101804f, 0.91072658f, 0.91043492f,
-    0.91014306f, 0.90985100f, 0.90955874f, 0.90926629f, 0.90897364f, 0.90868080f, 0.90838776f, 0.90809453f,
-    0.90780111f, 0.90750750f, 0.90721369f, 0.90691970f, 0.90662553f, 0.90633116f, 0.90603661f, 0.90574187f,
-    0.90544696f, 0.90515185f, 0.90485657f, 0.90456111f, 0.90426546f, 0.90396964f, 0.90367364f, 0.90337746f,
-    0.90308110f, 0.90278457f, 0.90248787f, 0.90219099f, 0.90189394f, 0.90159672f, 0.90129933f, 0.90100177f,
-    0.90070404f, 0.90040614f, 0.90010807f, 0.89980984f, 0.89951145f, 0.89921289f, 0.89891416f, 0.89861528f,
-    0.89831623f, 0.89801703f, 0.89771766f, 0.89741813f, 0.89711845f, 0.89681861f, 0.89651861f, 0.89621846f,
-    0.89591816f, 0.89561770f, 0.89531709f, 0.89501632f, 0.89471541f, 0.89441434f, 0.89411313f, 0.89381177f,
-    0.89351026f, 0.89320861f, 0.89290681f, 0.89260486f, 0.89230277f, 0.89200054f, 0.89169816f, 0.89139564f,
-    0.89109299f, 0.89079019f, 0.89048725f, 0.89018418f, 0.88988097f, 0.88957762f, 0.88927414f, 0.88897052f,
-    0.88866677f, 0.88836288f, 0.88805886f, 0.88775471f, 0.88745043f, 0.88714602f, 0.88684148f, 0.88653681f,
-    0.88623202f, 0.88592709f, 0.88562205f, 0.88531687f, 0.88501157f, 0.88470615f, 0.88440061f, 0.88409494f,
-    0.88378915f, 0.88348324f, 0.88317721f, 0.88287106f, 0.88256480f, 0.88225841f, 0.88195191f, 0.88164530f,
-    0.88133856f, 0.88103172f, 0.88072476f, 0.88041768f, 0.88011050f, 0.87980320f, 0.87949579f, 0.87918827f,
-    0.87888065f, 0.87857291f, 0.87826507f, 0.87795711f, 0.87764906f, 0.87734089f, 0.87703263f, 0.87672425f,
-    0.87641578f, 0.87610720f, 0.87579852f, 0.87548973f, 0.87518085f, 0.87487187f, 0.87456279f, 0.87425360f,
-    0.87394433f, 0.87363495f, 0.87332548f, 0.87301591f, 0.87270624f, 0.87239649f, 0.87208663f, 0.87177669f,
-    0.87146665f, 0.87115652f, 0.87084630f, 0.87053599f, 0.87022559f, 0.86991510f, 0.86960452f, 0.86929386f,
-    0.86898310f, 0.86867226f, 0.86836134f, 0.86805033f, 0.86773924f, 0.86742806f, 0.86711680f, 0.86680545f,
-    0.86649403f, 0.86618252f, 0.86587093f, 0.86555926f, 0.86524752f, 0.86493569f, 0.86462379f, 0.86431181f,
-    0.86399975f, 0.86368761f, 0.86337540f, 0.86306312f, 0.86275076f, 0.86243833f, 0.86212582f, 0.86181325f,
-    0.86150060f, 0.86118787f, 0.86087508f, 0.86056222f, 0.86024929f, 0.85993629f, 0.85962322f, 0.85931008f,
-    0.85899688f, 0.85868361f, 0.85837028f, 0.85805688f, 0.85774341f, 0.85742988f, 0.85711629f, 0.85680263f,
-    0.85648891f, 0.85617513f, 0.85586129f, 0.85554739f, 0.85523343f, 0.85491940f, 0.85460532f, 0.85429118f,
-    0.85397699f, 0.85366273f, 0.85334842f, 0.85303406f, 0.85271963f, 0.85240516f, 0.85209062f, 0.85177604f,
-    0.85146140f, 0.85114670f, 0.85083196f, 0.85051716f, 0.85020231f, 0.84988742f, 0.84957247f, 0.84925747f,
-    0.84894242f, 0.84862733f, 0.84831218f, 0.84799699f, 0.84768175f, 0.84736647f, 0.84705113f, 0.84673576f,
-    0.84642034f, 0.84610487f, 0.84578936f, 0.84547381f, 0.84515821f, 0.84484257f, 0.84452689f, 0.84421117f,
-    0.84389541f, 0.84357961f, 0.84326376f, 0.84294788f, 0.84263196f, 0.84231600f, 0.84200000f, 0.84168397f,
-    0.84136790f, 0.84105179f, 0.84073565f, 0.84041947f, 0.84010325f, 0.83978700f, 0.83947072f, 0.83915440f,
-    0.83883806f, 0.83852167f, 0.83820526f, 0.83788881f, 0.83757234f, 0.83725583f, 0.83693929f, 0.83662272f,
-    0.83630613f, 0.83598950f, 0.83567285f, 0.83535616f, 0.83503945f, 0.83472272f, 0.83440595f, 0.83408917f,
-    0.83377235f, 0.83345551f, 0.83313864f, 0.83282175f, 0.83250484f, 0.83218790f, 0.83187094f, 0.83155396f,
-    0.83123696f, 0.83091993f, 0.83060288f, 0.83028581f, 0.82996872f, 0.82965161f, 0.82933449f, 0.82901734f,
-    0.82870017f, 0.82838299f, 0.82806578f, 0.82774856f, 0.82743132f, 0.82711407f, 0.82679680f, 0.82647951f,
-    0.82616221f, 0.82584489f, 0.82552756f, 0.82521022f, 0.82489286f, 0.82457548f, 0.82425810f, 0.82394070f,
-    0.82362329f, 0.82330587f, 0.82298843f, 0.82267099f, 0.82235353f, 0.82203607f, 0.82171859f, 0.82140110f,
-    0.82108361f, 0.82076611f, 0.82044860f, 0.82013108f, 0.81981355f, 0.81949601f, 0.81917847f, 0.81886093f,
-    0.81854337f, 0.81822581f, 0.81790825f, 0.81759068f, 0.81727311f, 0.81695553f, 0.81663795f, 0.81632036f,
-    0.81600277f, 0.81568518f, 0.81536759f, 0.81504999f, 0.81473239f, 0.81441479f, 0.81409719f, 0.81377959f,
-    0.81346199f, 0.81314439f, 0.81282679f, 0.81250919f, 0.81219160f, 0.81187400f, 0.81155640f, 0.81123881f,
-    0.81092122f, 0.81060363f, 0.81028605f, 0.80996847f, 0.80965089f, 0.80933332f, 0.80901575f, 0.80869819f,
-    0.80838063f, 0.80806308f, 0.80774553f, 0.80742799f, 0.80711046f, 0.80679293f, 0.80647541f, 0.80615790f,
-    0.80584039f, 0.80552289f, 0.80520540f, 0.80488792f, 0.80457045f, 0.80425299f, 0.80393554f, 0.80361810f,
-    0.80330067f, 0.80298325f, 0.80266584f, 0.80234844f, 0.80203105f, 0.80171368f, 0.80139631f, 0.80107896f,
-    0.80076162f, 0.80044430f, 0.80012699f, 0.79980969f, 0.79949240f, 0.79917513f, 0.79885788f, 0.79854064f,
-    0.79822341f, 0.79790620f, 0.79758901f, 0.79727183f, 0.79695466f, 0.79663752f, 0.79632039f, 0.79600328f,
-    0.79568618f, 0.79536910f, 0.79505204f, 0.79473500f, 0.79441798f, 0.79410098f, 0.79378399f, 0.79346703f,
-    0.79315008f, 0.79283315f, 0.79251625f, 0.79219936f, 0.79188250f, 0.79156565f, 0.79124883f, 0.79093203f,
-    0.79061525f, 0.79029849f, 0.78998175f, 0.78966504f, 0.78934835f, 0.78903168f, 0.78871504f, 0.78839841f,
-    0.78808182f, 0.78776524f, 0.78744869f, 0.78713217f, 0.78681567f, 0.78649919f, 0.78618274f, 0.78586632f,
-    0.78554992f, 0.78523355f, 0.78491720f, 0.78460088f, 0.78428459f, 0.78396832f, 0.78365208f, 0.78333587f,
-    0.78301969f, 0.78270353f, 0.78238740f, 0.78207130f, 0.78175523f, 0.78143919f, 0.78112318f, 0.78080719f,
-    0.78049124f, 0.78017531f, 0.77985942f, 0.77954355f, 0.77922772f, 0.77891192f, 0.77859614f, 0.77828040f,
-    0.77796469f, 0.77764901f, 0.77733336f, 0.77701775f, 0.77670217f, 0.77638662f, 0.77607110f, 0.77575561f,
-    0.77544016f, 0.77512474f, 0.77480935f, 0.77449400f, 0.77417868f, 0.77386340f, 0.77354815f, 0.77323293f,
-    0.77291775f, 0.77260261f, 0.77228750f, 0.77197242f, 0.77165738f, 0.77134238f, 0.77102741f, 0.77071248f,
-    0.77039758f, 0.77008272f, 0.76976790f, 0.76945311f, 0.76913836f, 0.76882365f, 0.76850897f, 0.76819434f,
-    0.76787974f, 0.76756518f, 0.76725065f, 0.76693617f, 0.76662172f, 0.76630732f, 0.76599295f, 0.76567862f,
-    0.76536433f, 0.76505008f, 0.76473587f, 0.76442170f, 0.76410757f, 0.76379348f, 0.76347943f, 0.76316542f,
-    0.76285145f, 0.76253752f, 0.76222363f, 0.76190979f, 0.76159598f, 0.76128222f, 0.76096850f, 0.76065482f,
-    0.76034118f, 0.76002759f, 0.75971403f, 0.75940052f, 0.75908706f, 0.75877363f, 0.75846025f, 0.75814691f,
-    0.75783362f, 0.75752037f, 0.75720716f, 0.75689400f, 0.75658088f, 0.75626780f, 0.75595477f, 0.75564179f,
-    0.75532885f, 0.75501595f, 0.75470310f, 0.75439029f, 0.75407753f, 0.75376482f, 0.75345215f, 0.75313952f,
-    0.75282694f, 0.75251441f, 0.75220192f, 0.75188948f, 0.75157709f, 0.75126474f, 0.75095244f, 0.75064019f,
-    0.75032799f, 0.75001583f, 0.74970371f, 0.74939165f, 0.74907963f, 0.74876767f, 0.74845575f, 0.74814387f,
-    0.74783205f, 0.74752027f, 0.74720854f, 0.74689686f, 0.74658523f, 0.74627365f, 0.74596212f, 0.74565064f,
-    0.74533920f, 0.74502782f, 0.74471648f, 0.74440520f, 0.74409396f, 0.74378277f, 0.74347164f, 0.74316055f,
-    0.74284952f, 0.74253853f, 0.74222760f, 0.74191671f, 0.74160588f, 0.74129510f, 0.74098436f, 0.74067368f,
-    0.74036305f, 0.74005248f, 0.73974195f, 0.73943148f, 0.73912105f, 0.73881068f, 0.73850036f, 0.73819009f,
-    0.73787988f, 0.73756972f, 0.73725961f, 0.73694955f, 0.73663954f, 0.73632959f, 0.73601969f, 0.73570984f,
-    0.73540005f, 0.73509031f, 0.73478062f, 0.73447099f, 0.73416141f, 0.73385188f, 0.73354241f, 0.73323299f,
-    0.73292362f, 0.73261431f, 0.73230505f, 0.73199585f, 0.73168670f, 0.73137761f, 0.73106857f, 0.73075958f,
-    0.73045065f, 0.73014177f, 0.72983295f, 0.72952419f, 0.72921548f, 0.72890682f, 0.72859822f, 0.72828968f,
-    0.72798119f, 0.72767275f, 0.72736437f, 0.72705605f, 0.72674778f, 0.72643957f, 0.72613142f, 0.72582332f,
-    0.72551528f, 0.72520729f, 0.72489936f, 0.72459149f, 0.72428367f, 0.72397591f, 0.72366821f, 0.72336056f,
-    0.72305297f, 0.72274544f, 0.72243796f, 0.72213054f, 0.72182318f, 0.72151588f, 0.72120863f, 0.72090144f,
-    0.72059431f, 0.72028724f, 0.71998022f, 0.71967326f, 0.71936636f, 0.71905952f, 0.71875273f, 0.71844601f,
-    0.71813934f, 0.71783273f, 0.71752618f, 0.71721968f, 0.71691325f, 0.71660687f, 0.71630055f, 0.71599429f,
-    0.71568809f, 0.71538195f, 0.71507587f, 0.71476984f, 0.71446388f, 0.71415797f, 0.71385213f, 0.71354634f,
-    0.71324061f, 0.71293494f, 0.71262933f, 0.71232378f, 0.71201829f, 0.71171286f, 0.71140749f, 0.71110218f,
-    0.71079692f, 0.71049173f, 0.71018660f, 0.70988153f, 0.70957652f, 0.70927156f, 0.70896667f, 0.70866184f,
-    0.70835707f, 0.70805236f, 0.70774771f, 0.70744312f, 0.70713859f, 0.70683412f, 0.70652971f, 0.70622536f,
-    0.70592108f, 0.70561685f, 0.70531268f, 0.70500858f, 0.70470454f, 0.70440055f, 0.70409663f, 0.70379277f,
-    0.70348897f, 0.70318523f, 0.70288156f, 0.70257794f, 0.70227439f, 0.70197089f, 0.70166746f, 0.70136409f,
-    0.70106078f, 0.70075754f, 0.70045435f, 0.70015123f, 0.69984817f, 0.69954517f, 0.69924223f, 0.69893935f,
-    0.69863654f, 0.69833378f, 0.69803109f, 0.69772846f, 0.69742590f, 0.69712339f, 0.69682095f, 0.69651857f,
-    0.69621625f, 0.69591400f, 0.69561180f, 0.69530967f, 0.69500760f, 0.69470560f, 0.69440365f, 0.69410177f,
-    0.69379995f, 0.69349820f, 0.69319650f, 0.69289487f, 0.69259330f, 0.69229180f, 0.69199036f, 0.69168898f,
-    0.69138766f, 0.69108640f, 0.69078521f, 0.69048408f, 0.69018302f, 0.68988201f, 0.68958107f, 0.68928020f,
-    0.68897938f, 0.68867863f, 0.68837795f, 0.68807732f, 0.68777676f, 0.68747626f, 0.68717583f, 0.68687545f,
-    0.68657515f, 0.68627490f, 0.68597472f, 0.68567460f, 0.68537455f, 0.68507455f, 0.68477463f, 0.68447476f,
-    0.68417496f, 0.68387522f, 0.68357555f, 0.68327594f, 0.68297639f, 0.68267691f, 0.68237749f, 0.68207813f,
-    0.68177884f, 0.68147961f, 0.68118045f, 0.68088134f, 0.68058231f, 0.68028333f, 0.67998442f, 0.67968558f,
-    0.67938679f, 0.67908807f, 0.67878942f, 0.67849083f, 0.67819230f, 0.67789384f, 0.67759544f, 0.67729710f,
-    0.67699883f, 0.67670062f, 0.67640248f, 0.67610440f, 0.67580639f, 0.67550843f, 0.67521055f, 0.67491272f,
-    0.67461496f, 0.67431727f, 0.67401964f, 0.67372207f, 0.67342457f, 0.67312713f, 0.67282975f, 0.67253244f,
-    0.67223520f, 0.67193801f, 0.67164090f, 0.67134384f, 0.67104685f, 0.67074993f, 0.67045306f, 0.67015627f,
-    0.66985953f, 0.66956287f, 0.66926626f, 0.66896972f, 0.66867324f, 0.66837683f, 0.66808048f, 0.66778420f,
-    0.66748798f, 0.66719183f, 0.66689574f, 0.66659971f, 0.66630375f, 0.66600785f, 0.66571202f, 0.66541625f,
-    0.66512054f, 0.66482490f, 0.66452933f, 0.66423381f, 0.66393837f, 0.66364298f, 0.66334766f, 0.66305241f,
-    0.66275722f, 0.66246209f, 0.66216703f, 0.66187203f, 0.66157710f, 0.66128223f, 0.66098743f, 0.66069269f,
-    0.66039801f, 0.66010340f, 0.65980885f, 0.65951437f, 0.65921995f, 0.65892559f, 0.65863130f, 0.65833708f,
-    0.65804291f, 0.65774882f, 0.65745478f, 0.65716081f, 0.65686691f, 0.65657307f, 0.65627929f, 0.65598558f,
-    0.65569193f, 0.65539835f, 0.65510483f, 0.65481137f, 0.65451798f, 0.65422466f, 0.65393139f, 0.65363820f,
-    0.65334506f, 0.65305199f, 0.65275898f, 0.65246604f, 0.65217317f, 0.65188035f, 0.65158760f, 0.65129492f,
-    0.65100230f, 0.65070974f, 0.65041724f, 0.65012482f, 0.64983245f, 0.64954015f, 0.64924791f, 0.64895574f,
-    0.64866363f, 0.64837159f, 0.64807960f, 0.64778769f, 0.64749583f, 0.64720405f, 0.64691232f, 0.64662066f,
-    0.64632906f, 0.64603753f, 0.64574606f, 0.64545465f, 0.64516331f, 0.64487203f, 0.64458082f, 0.64428967f,
-    0.64399858f, 0.64370756f, 0.64341660f, 0.64312570f, 0.64283487f, 0.64254410f, 0.64225340f, 0.64196276f,
-    0.64167218f, 0.64138167f, 0.64109122f, 0.64080083f, 0.64051051f, 0.64022025f, 0.63993005f, 0.63963992f,
-    0.63934985f, 0.63905985f, 0.63876991f, 0.63848003f, 0.63819021f, 0.63790046f, 0.63761077f, 0.63732115f,
-    0.63703159f, 0.63674209f, 0.63645265f, 0.63616328f, 0.63587397f, 0.63558473f, 0.63529555f, 0.63500643f,
-    0.63471737f, 0.63442838f, 0.63413945f, 0.63385059f, 0.63356178f, 0.63327304f, 0.63298437f, 0.63269575f,
-    0.63240720f, 0.63211871f, 0.63183029f, 0.63154193f, 0.63125363f, 0.63096539f, 0.63067722f, 0.63038911f,
-    0.63010106f, 0.62981307f, 0.62952515f, 0.62923729f, 0.62894949f, 0.62866176f, 0.62837409f, 0.62808648f,
-    0.62779893f, 0.62751145f, 0.62722403f, 0.62693667f, 0.62664937f, 0.62636214f, 0.62607496f, 0.62578785f,
-    0.62550081f, 0.62521382f, 0.62492690f, 0.62464004f, 0.62435324f, 0.62406651f, 0.62377983f, 0.62349322f,
-    0.62320667f, 0.62292018f, 0.62263376f, 0.62234740f, 0.62206109f, 0.62177486f, 0.62148868f, 0.62120256f,
-    0.62091651f, 0.62063052f, 0.62034459f, 0.62005872f, 0.61977291f, 0.61948717f, 0.61920149f, 0.61891587f,
-    0.61863031f, 0.61834481f, 0.61805937f, 0.61777400f, 0.61748869f, 0.61720343f, 0.61691824f, 0.61663311f,
-    0.61634805f, 0.61606304f, 0.61577810f, 0.61549321f, 0.61520839f, 0.61492363f, 0.61463893f, 0.61435429f,
-    0.61406971f, 0.61378520f, 0.61350074f, 0.61321635f, 0.61293201f, 0.61264774f, 0.61236353f, 0.61207938f,
-    0.61179529f, 0.61151126f, 0.61122729f, 0.61094338f, 0.61065953f, 0.61037575f, 0.61009202f, 0.60980836f,
-    0.60952475f, 0.60924121f, 0.60895772f, 0.60867430f, 0.60839094f, 0.60810764f, 0.60782439f, 0.60754121f,
-    0.60725809f, 0.60697503f, 0.60669203f, 0.60640909f, 0.60612620f, 0.60584338f, 0.60556062f, 0.60527792f,
-    0.60499528f, 0.60471270f, 0.60443018f, 0.60414772f, 0.60386532f, 0.60358297f, 0.60330069f, 0.60301847f,
-    0.60273631f, 0.60245420f, 0.60217216f, 0.60189018f, 0.60160825f, 0.60132639f, 0.60104458f, 0.60076283f,
-    0.60048115f, 0.60019952f, 0.59991795f, 0.59963644f, 0.59935499f, 0.59907360f, 0.59879227f, 0.59851100f,
-    0.59822978f, 0.59794863f, 0.59766753f, 0.59738649f, 0.59710551f, 0.59682460f, 0.59654373f, 0.59626293f,
-    0.59598219f, 0.59570150f, 0.59542088f, 0.59514031f, 0.59485980f, 0.59457935f, 0.59429896f, 0.59401863f,
-    0.59373835f, 0.59345813f, 0.59317797f, 0.59289787f, 0.59261783f, 0.59233785f, 0.59205792f, 0.59177805f,
-    0.59149824f, 0.59121849f, 0.59093880f, 0.59065916f, 0.59037958f, 0.59010006f, 0.58982060f, 0.58954119f,
-    0.58926184f, 0.58898255f, 0.58870332f, 0.58842415f, 0.58814503f, 0.58786597f, 0.58758696f, 0.58730802f,
-    0.58702913f, 0.58675030f, 0.58647153f, 0.58619281f, 0.58591415f, 0.58563555f, 0.58535700f, 0.58507852f,
-    0.58480008f, 0.58452171f, 0.58424339f, 0.58396513f, 0.58368693f, 0.58340878f, 0.58313069f, 0.58285266f,
-    0.58257468f, 0.58229676f, 0.58201889f, 0.58174109f, 0.58146333f, 0.58118564f, 0.58090800f, 0.58063042f,
-    0.58035289f, 0.58007542f, 0.57979801f, 0.57952065f, 0.57924335f, 0.57896610f, 0.57868891f, 0.57841178f,
-    0.57813470f, 0.57785768f, 0.57758071f, 0.57730380f, 0.57702694f, 0.57675014f, 0.57647340f, 0.57619671f,
-    0.57592008f, 0.57564350f, 0.57536698f, 0.57509051f, 0.57481410f, 0.57453774f, 0.57426144f, 0.57398520f,
-    0.57370900f, 0.57343287f, 0.57315679f, 0.57288076f, 0.57260479f, 0.57232887f, 0.57205301f, 0.57177721f,
-    0.57150145f, 0.57122576f, 0.57095011f, 0.57067453f, 0.57039899f, 0.57012351f, 0.56984809f, 0.56957272f,
-    0.56929740f, 0.56902214f, 0.56874693f, 0.56847178f, 0.56819668f, 0.56792163f, 0.56764664f, 0.56737171f,
-    0.56709682f, 0.56682199f, 0.56654722f, 0.56627250f, 0.56599783f, 0.56572321f, 0.56544865f, 0.56517415f,
-    0.56489969f, 0.56462529f, 0.56435095f, 0.56407665f, 0.56380241f, 0.56352823f, 0.56325409f, 0.56298001f,
-    0.56270599f, 0.56243201f, 0.56215809f, 0.56188423f, 0.56161041f, 0.56133665f, 0.56106294f, 0.56078928f,
-    0.56051568f, 0.56024213f, 0.55996863f, 0.55969519f, 0.55942179f, 0.55914845f, 0.55887517f, 0.55860193f,
-    0.55832875f, 0.55805562f, 0.55778254f, 0.55750951f, 0.55723654f, 0.55696362f, 0.55669075f, 0.55641793f,
-    0.55614516f, 0.55587245f, 0.55559978f, 0.55532717f, 0.55505462f, 0.55478211f, 0.55450965f, 0.55423725f,
-    0.55396490f, 0.55369260f, 0.55342035f, 0.55314815f, 0.55287600f, 0.55260391f, 0.55233186f, 0.55205987f,
-    0.55178793f, 0.55151604f, 0.55124420f, 0.55097241f, 0.55070067f, 0.55042899f, 0.55015735f, 0.54988576f,
-    0.54961423f, 0.54934275f, 0.54907131f, 0.54879993f, 0.54852860f, 0.54825732f, 0.54798609f, 0.54771491f,
-    0.54744378f, 0.54717270f, 0.54690167f, 0.54663069f, 0.54635976f, 0.54608888f, 0.54581805f, 0.54554727f,
-    0.54527654f, 0.54500586f, 0.54473523f, 0.54446465f, 0.54419412f, 0.54392364f, 0.54365321f, 0.54338282f,
-    0.54311249f, 0.54284221f, 0.54257198f, 0.54230179f, 0.54203166f, 0.54176157f, 0.54149154f, 0.54122155f,
-    0.54095161f, 0.54068172f, 0.54041188f, 0.54014209f, 0.53987235f, 0.53960266f, 0.53933301f, 0.53906342f,
-    0.53879387f, 0.53852437f, 0.53825492f, 0.53798552f, 0.53771617f, 0.53744686f, 0.53717761f, 0.53690840f,
-    0.53663924f, 0.53637013f, 0.53610107f, 0.53583205f, 0.53556309f, 0.53529417f, 0.53502530f, 0.53475647f,
-    0.53448770f, 0.53421897f, 0.53395029f, 0.53368166f, 0.53341308f, 0.53314454f, 0.53287605f, 0.53260761f,
-    0.53233921f, 0.53207087f, 0.53180257f, 0.53153432f, 0.53126611f, 0.53099795f, 0.53072984f, 0.53046178f,
-    0.53019376f, 0.52992579f, 0.52965787f, 0.52938999f, 0.52912216f, 0.52885438f, 0.52858665f, 0.52831896f,
-    0.52805132f, 0.52778372f, 0.52751617f, 0.52724867f, 0.52698121f, 0.52671380f, 0.52644644f, 0.52617912f,
-    0.52591185f, 0.52564462f, 0.52537744f, 0.52511031f, 0.52484322f, 0.52457618f, 0.52430919f, 0.52404224f,
-    0.52377533f, 0.52350848f, 0.52324166f, 0.52297490f, 0.52270818f, 0.52244150f, 0.52217487f, 0.52190829f,
-    0.52164175f, 0.52137525f, 0.52110880f, 0.52084240f, 0.52057604f, 0.52030973f, 0.52004346f, 0.51977724f,
-    0.51951106f, 0.51924492f, 0.51897884f, 0.51871279f, 0.51844679f, 0.51818084f, 0.51791493f, 0.51764906f,
-    0.51738324f, 0.51711747f, 0.51685173f, 0.51658605f, 0.51632040f, 0.51605480f, 0.51578925f, 0.51552374f,
-    0.51525827f, 0.51499285f, 0.51472747f, 0.51446214f, 0.51419685f, 0.51393160f, 0.51366640f, 0.51340124f,
-    0.51313612f, 0.51287105f, 0.51260602f, 0.51234104f, 0.51207610f, 0.51181120f, 0.51154634f, 0.51128153f,
-    0.51101677f, 0.51075204f, 0.51048736f, 0.51022272f, 0.50995813f, 0.50969357f, 0.50942907f, 0.50916460f,
-    0.50890018f, 0.50863579f, 0.50837146f, 0.50810716f, 0.50784291f, 0.50757870f, 0.50731453f, 0.50705041f,
-    0.50678633f, 0.50652229f, 0.50625829f, 0.50599433f, 0.50573042f, 0.50546655f, 0.50520272f, 0.50493893f,
-    0.50467519f, 0.50441149f, 0.50414783f, 0.50388421f, 0.50362063f, 0.50335710f, 0.50309360f, 0.50283015f,
-    0.50256674f, 0.50230337f, 0.50204004f, 0.50177676f, 0.50151352f, 0.50125031f, 0.50098715f, 0.50072403f,
-    0.50046095f, 0.50019791f, 0.49993492f, 0.49967196f, 0.49940905f, 0.49914617f, 0.49888334f, 0.49862055f,
-    0.49835780f, 0.49809509f, 0.49783242f, 0.49756979f, 0.49730720f, 0.49704466f, 0.49678215f, 0.49651968f,
-    0.49625726f, 0.49599487f, 0.49573252f, 0.49547022f, 0.49520795f, 0.49494573f, 0.49468354f, 0.49442140f,
-    0.49415929f, 0.49389723f, 0.49363520f, 0.49337322f, 0.49311127f, 0.49284937f, 0.49258750f, 0.49232568f,
-    0.49206389f, 0.49180214f, 0.49154044f, 0.49127877f, 0.49101714f, 0.49075555f, 0.49049400f, 0.49023249f,
-    0.48997102f, 0.48970958f, 0.48944819f, 0.48918684f, 0.48892552f, 0.48866425f, 0.48840301f, 0.48814181f,
-    0.48788065f, 0.48761953f, 0.48735845f, 0.48709740f, 0.48683640f, 0.48657543f, 0.48631450f, 0.48605361f,
-    0.48579276f, 0.48553195f, 0.48527117f, 0.48501044f, 0.48474974f, 0.48448908f, 0.48422846f, 0.48396787f,
-    0.48370733f, 0.48344682f, 0.48318635f, 0.48292592f, 0.48266552f, 0.48240516f, 0.48214485f, 0.48188456f,
-    0.48162432f, 0.48136411f, 0.48110395f, 0.48084381f, 0.48058372f, 0.48032366f, 0.48006364f, 0.47980366f,
-    0.47954372f, 0.47928381f, 0.47902394f, 0.47876411f, 0.47850431f, 0.47824455f, 0.47798483f, 0.47772514f,
-    0.47746549f, 0.47720588f, 0.47694631f, 0.47668677f, 0.47642726f, 0.47616780f, 0.47590837f, 0.47564898f,
-    0.47538962f, 0.47513030f, 0.47487102f, 0.47461177f, 0.47435256f, 0.47409339f, 0.47383425f, 0.47357514f,
-    0.47331608f, 0.47305705f, 0.47279805f, 0.47253909f, 0.47228017f, 0.47202128f, 0.47176243f, 0.47150362f,
-    0.47124484f, 0.47098609f, 0.47072738f, 0.47046871f, 0.47021007f, 0.46995147f, 0.46969290f, 0.46943437f,
-    0.46917587f, 0.46891741f, 0.46865899f, 0.46840059f, 0.46814224f, 0.46788392f, 0.46762563f, 0.46736738f,
-    0.46710916f, 0.46685098f, 0.46659284f, 0.46633472f, 0.46607665f, 0.46581860f, 0.46556060f, 0.46530262f,
-    0.46504468f, 0.46478678f, 0.46452891f, 0.46427107f, 0.46401327f, 0.46375550f, 0.46349777f, 0.46324007f,
-    0.46298241f, 0.46272478f, 0.46246718f, 0.46220962f, 0.46195209f, 0.46169459f, 0.46143713f, 0.46117971f,
-    0.46092231f, 0.46066495f, 0.46040763f, 0.46015033f, 0.45989307f, 0.45963585f, 0.45937866f, 0.45912150f,
-    0.45886437f, 0.45860728f, 0.45835022f, 0.45809320f, 0.45783620f, 0.45757925f, 0.45732232f, 0.45706543f,
-    0.45680857f, 0.45655174f, 0.45629495f, 0.45603818f, 0.45578146f, 0.45552476f, 0.45526810f, 0.45501147f,
-    0.45475487f, 0.45449830f, 0.45424177f, 0.45398527f, 0.45372880f, 0.45347237f, 0.45321596f, 0.45295959f,
-    0.45270326f, 0.45244695f, 0.45219068f, 0.45193443f, 0.45167822f, 0.45142205f, 0.45116590f, 0.45090979f,
-    0.45065370f, 0.45039765f, 0.45014164f, 0.44988565f, 0.44962969f, 0.44937377f, 0.44911788f, 0.44886202f,
-    0.44860619f, 0.44835039f, 0.44809463f, 0.44783889f, 0.44758319f, 0.44732752f, 0.44707188f, 0.44681627f,
-    0.44656069f, 0.44630515f, 0.44604963f, 0.44579415f, 0.44553869f, 0.44528327f, 0.44502788f, 0.44477252f,
-    0.44451719f, 0.44426189f, 0.44400662f, 0.44375138f, 0.44349617f, 0.44324100f, 0.44298585f, 0.44273073f,
-    0.44247565f, 0.44222059f, 0.44196557f, 0.44171058f, 0.44145561f, 0.44120068f, 0.44094578f, 0.44069090f,
-    0.44043606f, 0.44018125f, 0.43992646f, 0.43967171f, 0.43941699f, 0.43916229f, 0.43890763f, 0.43865300f,
-    0.43839839f, 0.43814382f, 0.43788927f, 0.43763476f, 0.43738027f, 0.43712582f, 0.43687139f, 0.43661699f,
-    0.43636263f, 0.43610829f, 0.43585398f, 0.43559970f, 0.43534545f, 0.43509123f, 0.43483704f, 0.43458287f,
-    0.43432874f, 0.43407463f, 0.43382056f, 0.43356651f, 0.43331249f, 0.43305850f, 0.43280454f, 0.43255061f,
-    0.43229671f, 0.43204284f, 0.43178899f, 0.43153517f, 0.43128138f, 0.43102762f, 0.43077389f, 0.43052019f,
-    0.43026651f, 0.43001287f, 0.42975925f, 0.42950566f, 0.42925210f, 0.42899857f, 0.42874506f, 0.42849158f,
-    0.42823813f, 0.42798471f, 0.42773132f, 0.42747795f, 0.42722462f, 0.42697131f, 0.42671803f, 0.42646477f,
-    0.42621154f, 0.42595835f, 0.42570517f, 0.42545203f, 0.42519892f, 0.42494583f, 0.42469277f, 0.42443973f,
-    0.42418673f, 0.42393375f, 0.42368079f, 0.42342787f, 0.42317497f, 0.42292210f, 0.42266926f, 0.42241644f,
-    0.42216366f, 0.42191089f, 0.42165816f, 0.42140545f, 0.42115277f, 0.42090012f, 0.42064749f, 0.42039489f,
-    0.42014231f, 0.41988977f, 0.41963725f, 0.41938475f, 0.41913228f, 0.41887984f, 0.41862743f, 0.41837504f,
-    0.41812268f, 0.41787034f, 0.41761803f, 0.41736575f, 0.41711350f, 0.41686127f, 0.41660906f, 0.41635688f,
-    0.41610473f, 0.41585260f, 0.41560050f, 0.41534843f, 0.41509638f, 0.41484436f, 0.41459236f, 0.41434039f,
-    0.41408845f, 0.41383653f, 0.41358464f, 0.41333277f, 0.41308093f, 0.41282911f, 0.41257732f, 0.41232555f,
-    0.41207381f, 0.41182210f, 0.41157041f, 0.41131874f, 0.41106710f, 0.41081549f, 0.41056390f, 0.41031234f,
-    0.41006080f, 0.40980929f, 0.40955780f, 0.40930633f, 0.40905490f, 0.40880348f, 0.40855209f, 0.40830073f,
-    0.40804939f, 0.40779808f, 0.40754679f, 0.40729552f, 0.40704428f, 0.40679307f, 0.40654188f, 0.40629071f,
-    0.40603957f, 0.40578845f, 0.40553736f, 0.40528629f, 0.40503525f, 0.40478423f, 0.40453323f, 0.40428226f,
-    0.40403131f, 0.40378039f, 0.40352949f, 0.40327862f, 0.40302777f, 0.40277694f, 0.40252614f, 0.40227536f,
-    0.40202460f, 0.40177387f, 0.40152317f, 0.40127248f, 0.40102182f, 0.40077119f, 0.40052058f, 0.40026999f,
-    0.40001942f, 0.39976888f, 0.39951836f, 0.39926787f, 0.39901740f, 0.39876695f, 0.39851652f, 0.39826612f,
-    0.39801575f, 0.39776539f, 0.39751506f, 0.39726475f, 0.39701447f, 0.39676420f, 0.39651397f, 0.39626375f,
-    0.39601356f, 0.39576339f, 0.39551324f, 0.39526312f, 0.39501302f, 0.39476294f, 0.39451288f, 0.39426285f,
-    0.39401284f, 0.39376285f, 0.39351289f, 0.39326295f, 0.39301303f, 0.39276313f, 0.39251325f, 0.39226340f,
-    0.39201357f, 0.39176377f, 0.39151398f, 0.39126422f, 0.39101448f, 0.39076476f, 0.39051506f, 0.39026539f,
-    0.39001574f, 0.38976611f, 0.38951650f, 0.38926692f, 0.38901735f, 0.38876781f, 0.38851829f, 0.38826879f,
-    0.38801932f, 0.38776986f, 0.38752043f, 0.38727102f, 0.38702163f, 0.38677226f, 0.38652292f, 0.38627359f,
-    0.38602429f, 0.38577501f, 0.38552575f, 0.38527651f, 0.38502730f, 0.38477810f, 0.38452893f, 0.38427978f,
-    0.38403064f, 0.38378153f, 0.38353245f, 0.38328338f, 0.38303433f, 0.38278531f, 0.38253630f, 0.38228732f,
-    0.38203836f, 0.38178942f, 0.38154050f, 0.38129160f, 0.38104272f, 0.38079386f, 0.38054502f, 0.38029621f,
-    0.38004741f, 0.37979864f, 0.37954988f, 0.37930115f, 0.37905244f, 0.37880375f, 0.37855507f, 0.37830642f,
-    0.37805779f, 0.37780918f, 0.37756059f, 0.37731202f, 0.37706347f, 0.37681495f, 0.37656644f, 0.37631795f,
-    0.37606948f, 0.37582103f, 0.37557260f, 0.37532420f, 0.37507581f, 0.37482744f, 0.37457909f, 0.37433077f,
-    0.37408246f, 0.37383417f, 0.37358590f, 0.37333765f, 0.37308943f, 0.37284122f, 0.37259303f, 0.37234486f,
-    0.37209671f, 0.37184858f, 0.37160047f, 0.37135238f, 0.37110431f, 0.37085626f, 0.37060822f, 0.37036021f,
-    0.37011222f, 0.36986425f, 0.36961629f, 0.36936836f, 0.36912044f, 0.36887254f, 0.36862466f, 0.36837681f,
-    0.36812897f, 0.36788115f, 0.36763335f, 0.36738556f, 0.36713780f, 0.36689006f, 0.36664233f, 0.36639463f,
-    0.36614694f, 0.36589927f, 0.36565162f, 0.36540399f, 0.36515638f, 0.36490879f, 0.36466121f, 0.36441366f,
-    0.36416612f, 0.36391860f, 0.36367110f, 0.36342362f, 0.36317616f, 0.36292871f, 0.36268129f, 0.36243388f,
-    0.36218649f, 0.36193912f, 0.36169177f, 0.36144443f, 0.36119712f, 0.36094982f, 0.36070254f, 0.36045528f,
-    0.36020803f, 0.35996081f, 0.35971360f, 0.35946641f, 0.35921924f, 0.35897209f, 0.35872496f, 0.35847784f,
-    0.35823074f, 0.35798366f, 0.35773660f, 0.35748955f, 0.35724252f, 0.35699551f, 0.35674852f, 0.35650155f,
-    0.35625459f, 0.35600765f, 0.35576073f, 0.35551382f, 0.35526694f, 0.35502007f, 0.35477322f, 0.35452638f,
-    0.35427957f, 0.35403277f, 0.35378598f, 0.35353922f, 0.35329247f, 0.35304574f, 0.35279903f, 0.35255233f,
-    0.35230566f, 0.35205899f, 0.35181235f, 0.35156572f, 0.35131911f, 0.35107252f, 0.35082594f, 0.35057939f,
-    0.35033284f, 0.35008632f, 0.34983981f, 0.34959332f, 0.34934684f, 0.34910039f, 0.34885395f, 0.34860752f,
-    0.34836111f, 0.34811472f, 0.34786835f, 0.34762199f, 0.34737565f, 0.34712933f, 0.34688302f, 0.34663673f,
-    0.34639045f, 0.34614420f, 0.34589795f, 0.34565173f, 0.34540552f, 0.34515933f, 0.34491315f, 0.34466699f,
-    0.34442085f, 0.34417472f, 0.34392861f, 0.34368251f, 0.34343643f, 0.34319037f, 0.34294432f, 0.34269829f,
-    0.34245228f, 0.34220628f, 0.34196029f, 0.34171433f, 0.34146838f, 0.34122244f, 0.34097652f, 0.34073062f,
-    0.34048473f, 0.34023886f, 0.33999300f, 0.33974716f, 0.33950134f, 0.33925553f, 0.33900974f, 0.33876396f,
-    0.33851820f, 0.33827245f, 0.33802672f, 0.33778101f, 0.33753531f, 0.33728962f, 0.33704395f, 0.33679830f,
-    0.33655266f, 0.33630704f, 0.33606143f, 0.33581584f, 0.33557026f, 0.33532470f, 0.33507915f, 0.33483362f,
-    0.33458810f, 0.33434260f, 0.33409712f, 0.33385165f, 0.33360619f, 0.33336075f, 0.33311532f, 0.33286991f,
-    0.33262452f, 0.33237914f, 0.33213377f, 0.33188842f, 0.33164308f, 0.33139776f, 0.33115245f, 0.33090716f,
-    0.33066189f, 0.33041662f, 0.33017138f, 0.32992614f, 0.32968092f, 0.32943572f, 0.32919053f, 0.32894536f,
-    0.32870020f, 0.32845505f, 0.32820992f, 0.32796480f, 0.32771970f, 0.32747461f, 0.32722954f, 0.32698448f,
-    0.32673943f, 0.32649440f, 0.32624939f, 0.32600438f, 0.32575940f, 0.32551442f, 0.32526946f, 0.32502452f,
-    0.32477959f, 0.32453467f, 0.32428977f, 0.32404488f, 0.32380000f, 0.32355514f, 0.32331030f, 0.32306546f,
-    0.32282064f, 0.32257584f, 0.32233105f, 0.32208627f, 0.32184151f, 0.32159676f, 0.32135202f, 0.32110730f,
-    0.32086259f, 0.32061789f, 0.32037321f, 0.32012854f, 0.31988389f, 0.31963925f, 0.31939462f, 0.31915001f,
-    0.31890541f, 0.31866082f, 0.31841625f, 0.31817169f, 0.31792715f, 0.31768261f, 0.31743810f, 0.31719359f,
-    0.31694910f, 0.31670462f, 0.31646015f, 0.31621570f, 0.31597126f, 0.31572684f, 0.31548242f, 0.31523802f,
-    0.31499364f, 0.31474926f, 0.31450490f, 0.31426056f, 0.31401622f, 0.31377190f, 0.31352759f, 0.31328330f,
-    0.31303901f, 0.31279474f, 0.31255049f, 0.31230625f, 0.31206201f, 0.31181780f, 0.31157359f, 0.31132940f,
-    0.31108522f, 0.31084105f, 0.31059690f, 0.31035276f, 0.31010863f, 0.30986451f, 0.30962041f, 0.30937632f,
-    0.30913224f, 0.30888818f, 0.30864412f, 0.30840008f, 0.30815605f, 0.30791204f, 0.30766804f, 0.30742405f,
-    0.30718007f, 0.30693610f, 0.30669215f, 0.30644821f, 0.30620428f, 0.30596036f, 0.30571646f, 0.30547256f,
-    0.30522868f, 0.30498482f, 0.30474096f, 0.30449712f, 0.30425329f, 0.30400947f, 0.30376566f, 0.30352187f,
-    0.30327808f, 0.30303431f, 0.30279055f, 0.30254681f, 0.30230307f, 0.30205935f, 0.30181564f, 0.30157194f,
-    0.30132825f, 0.30108457f, 0.30084091f, 0.30059726f, 0.30035362f, 0.30010999f, 0.29986637f, 0.29962277f,
-    0.29937918f, 0.29913559f, 0.29889202f, 0.29864847f, 0.29840492f, 0.29816138f, 0.29791786f, 0.29767435f,
-    0.29743085f, 0.29718736f, 0.29694388f, 0.29670042f, 0.29645696f, 0.29621352f, 0.29597009f, 0.29572667f,
-    0.29548326f, 0.29523986f, 0.29499647f, 0.29475310f, 0.29450973f, 0.29426638f, 0.29402304f, 0.29377971f,
-    0.29353639f, 0.29329308f, 0.29304979f, 0.29280650f, 0.29256323f, 0.29231996f, 0.29207671f, 0.29183347f,
-    0.29159024f, 0.29134702f, 0.29110381f, 0.29086061f, 0.29061743f, 0.29037425f, 0.29013109f, 0.28988793f,
-    0.28964479f, 0.28940166f, 0.28915854f, 0.28891543f, 0.28867233f, 0.28842924f, 0.28818616f, 0.28794309f,
-    0.28770003f, 0.28745699f, 0.28721395f, 0.28697093f, 0.28672791f, 0.28648491f, 0.28624192f, 0.28599893f,
-    0.28575596f, 0.28551300f, 0.28527005f, 0.28502711f, 0.28478418f, 0.28454126f, 0.28429835f, 0.28405545f,
-    0.28381256f, 0.28356968f, 0.28332682f, 0.28308396f, 0.28284111f, 0.28259828f, 0.28235545f, 0.28211263f,
-    0.28186983f, 0.28162703f, 0.28138424f, 0.28114147f, 0.28089870f, 0.28065595f, 0.28041320f, 0.28017047f,
-    0.27992774f, 0.27968503f, 0.27944232f, 0.27919963f, 0.27895694f, 0.27871427f, 0.27847160f, 0.27822895f,
-    0.27798630f, 0.27774367f, 0.27750104f, 0.27725843f, 0.27701582f, 0.27677322f, 0.27653064f, 0.27628806f,
-    0.27604549f, 0.27580294f, 0.27556039f, 0.27531785f, 0.27507532f, 0.27483281f, 0.27459030f, 0.27434780f,
-    0.27410531f, 0.27386283f, 0.27362036f, 0.27337790f, 0.27313545f, 0.27289301f, 0.27265058f, 0.27240815f,
-    0.27216574f, 0.27192334f, 0.27168094f, 0.27143856f, 0.27119618f, 0.27095382f, 0.27071146f, 0.27046911f,
-    0.27022678f, 0.26998445f, 0.26974213f, 0.26949982f, 0.26925752f, 0.26901523f, 0.26877294f, 0.26853067f,
-    0.26828841f, 0.26804615f, 0.26780391f, 0.26756167f, 0.26731944f, 0.26707723f, 0.26683502f, 0.26659282f,
-    0.26635062f, 0.26610844f, 0.26586627f, 0.26562411f, 0.26538195f, 0.26513980f, 0.26489767f, 0.26465554f,
-    0.26441342f, 0.26417131f, 0.26392921f, 0.26368712f, 0.26344503f, 0.26320296f, 0.26296089f, 0.26271883f,
-    0.26247678f, 0.26223474f, 0.26199271f, 0.26175069f, 0.26150868f, 0.26126667f, 0.26102468f, 0.26078269f,
-    0.26054071f, 0.26029874f, 0.26005678f, 0.25981482f, 0.25957288f, 0.25933094f, 0.25908901f, 0.25884709f,
-    0.25860518f, 0.25836328f, 0.25812139f, 0.25787950f, 0.25763763f, 0.25739576f, 0.25715390f, 0.25691205f,
-    0.25667020f, 0.25642837f, 0.25618654f, 0.25594472f, 0.25570291f, 0.25546111f, 0.25521932f, 0.25497753f,
-    0.25473576f, 0.25449399f, 0.25425223f, 0.25401047f, 0.25376873f, 0.25352699f, 0.25328527f, 0.25304355f,
-    0.25280183f, 0.25256013f, 0.25231844f, 0.25207675f, 0.25183507f, 0.25159340f, 0.25135173f, 0.25111008f,
-    0.25086843f, 0.25062679f, 0.25038516f, 0.25014354f, 0.24990192f, 0.24966031f, 0.24941871f, 0.24917712f,
-    0.24893554f, 0.24869396f, 0.24845239f, 0.24821083f, 0.24796928f, 0.24772774f, 0.24748620f, 0.24724467f,
-    0.24700315f, 0.24676163f, 0.24652013f, 0.24627863f, 0.24603714f, 0.24579566f, 0.24555418f, 0.24531271f,
-    0.24507125f, 0.24482980f, 0.24458835f, 0.24434692f, 0.24410549f, 0.24386406f, 0.24362265f, 0.24338124f,
-    0.24313984f, 0.24289845f, 0.24265706f, 0.24241569f, 0.24217432f, 0.24193295f, 0.24169160f, 0.24145025f,
-    0.24120891f, 0.24096758f, 0.24072625f, 0.24048493f, 0.24024362f, 0.24000232f, 0.23976102f, 0.23951973f,
-    0.23927845f, 0.23903717f, 0.23879591f, 0.23855465f, 0.23831339f, 0.23807215f, 0.23783091f, 0.23758968f,
-    0.23734845f, 0.23710723f, 0.23686602f, 0.23662482f, 0.23638362f, 0.23614243f, 0.23590125f, 0.23566008f,
-    0.23541891f, 0.23517775f, 0.23493660f, 0.23469545f, 0.23445431f, 0.23421318f, 0.23397205f, 0.23373093f,
-    0.23348982f, 0.23324871f, 0.23300761f, 0.23276652f, 0.23252544f, 0.23228436f, 0.23204329f, 0.23180223f,
-    0.23156117f, 0.23132012f, 0.23107907f, 0.23083804f, 0.23059701f, 0.23035598f, 0.23011497f, 0.22987396f,
-    0.22963295f, 0.22939196f, 0.22915097f, 0.22890998f, 0.22866901f, 0.22842804f, 0.22818707f, 0.22794612f,
-    0.22770517f, 0.22746422f, 0.22722329f, 0.22698236f, 0.22674143f, 0.22650051f, 0.22625960f, 0.22601870f,
-    0.22577780f, 0.22553691f, 0.22529602f, 0.22505515f, 0.22481427f, 0.22457341f, 0.22433255f, 0.22409169f,
-    0.22385085f, 0.22361001f, 0.22336917f, 0.22312835f, 0.22288753f, 0.22264671f, 0.22240590f, 0.22216510f,
-    0.22192430f, 0.22168351f, 0.22144273f, 0.22120195f, 0.22096118f, 0.22072042f, 0.22047966f, 0.22023891f,
-    0.21999816f, 0.21975742f, 0.21951669f, 0.21927596f, 0.21903524f, 0.21879452f, 0.21855381f, 0.21831311f,
-    0.21807241f, 0.21783172f, 0.21759104f, 0.21735036f, 0.21710968f, 0.21686902f, 0.21662836f, 0.21638770f,
-    0.21614705f, 0.21590641f, 0.21566577f, 0.21542514f, 0.21518451f, 0.21494390f, 0.21470328f, 0.21446267f,
-    0.21422207f, 0.21398148f, 0.21374089f, 0.21350030f, 0.21325972f, 0.21301915f, 0.21277858f, 0.21253802f,
-    0.21229747f, 0.21205692f, 0.21181638f, 0.21157584f, 0.21133531f, 0.21109478f, 0.21085426f, 0.21061374f,
-    0.21037323f, 0.21013273f, 0.20989223f, 0.20965174f, 0.20941125f, 0.20917077f, 0.20893030f, 0.20868983f,
-    0.20844936f, 0.20820891f, 0.20796845f, 0.20772801f, 0.20748756f, 0.20724713f, 0.20700670f, 0.20676627f,
-    0.20652585f, 0.20628544f, 0.20604503f, 0.20580462f, 0.20556423f, 0.20532383f, 0.20508345f, 0.20484307f,
-    0.20460269f, 0.20436232f, 0.20412195f, 0.20388159f, 0.20364124f, 0.20340089f, 0.20316055f, 0.20292021f,
-    0.20267987f, 0.20243955f, 0.20219922f, 0.20195891f, 0.20171859f, 0.20147829f, 0.20123798f, 0.20099769f,
-    0.20075740f, 0.20051711f, 0.20027683f, 0.20003656f, 0.19979628f, 0.19955602f, 0.19931576f, 0.19907551f,
-    0.19883526f, 0.19859501f, 0.19835477f, 0.19811454f, 0.19787431f, 0.19763408f, 0.19739387f, 0.19715365f,
-    0.19691344f, 0.19667324f, 0.19643304f, 0.19619285f, 0.19595266f, 0.19571247f, 0.19547230f, 0.19523212f,
-    0.19499195f, 0.19475179f, 0.19451163f, 0.19427148f, 0.19403133f, 0.19379118f, 0.19355105f, 0.19331091f,
-    0.19307078f, 0.19283066f, 0.19259054f, 0.19235042f, 0.19211031f, 0.19187021f, 0.19163011f, 0.19139001f,
-    0.19114992f, 0.19090984f, 0.19066976f, 0.19042968f, 0.19018961f, 0.18994954f, 0.18970948f, 0.18946942f,
-    0.18922937f, 0.18898932f, 0.18874928f, 0.18850924f, 0.18826921f, 0.18802918f, 0.18778916f, 0.18754914f,
-    0.18730912f, 0.18706911f, 0.18682911f, 0.18658911f, 0.18634911f, 0.18610912f, 0.18586913f, 0.18562915f,
-    0.18538917f, 0.18514920f, 0.18490923f, 0.18466926f, 0.18442930f, 0.18418935f, 0.18394940f, 0.18370945f,
-    0.18346951f, 0.18322957f, 0.18298964f, 0.18274971f, 0.18250979f, 0.18226987f, 0.18202995f, 0.18179004f,
-    0.18155014f, 0.18131024f, 0.18107034f, 0.18083044f, 0.18059056f, 0.18035067f, 0.18011079f, 0.17987092f,
-    0.17963105f, 0.17939118f, 0.17915132f, 0.17891146f, 0.17867161f, 0.17843176f, 0.17819191f, 0.17795207f,
-    0.17771223f, 0.17747240f, 0.17723257f, 0.17699275f, 0.17675293f, 0.17651311f, 0.17627330f, 0.17603350f,
-    0.17579369f, 0.17555389f, 0.17531410f, 0.17507431f, 0.17483452f, 0.17459474f, 0.17435496f, 0.17411519f,
-    0.17387542f, 0.17363566f, 0.17339589f, 0.17315614f, 0.17291638f, 0.17267663f, 0.17243689f, 0.17219715f,
-    0.17195741f, 0.17171768f, 0.17147795f, 0.17123823f, 0.17099850f, 0.17075879f, 0.17051908f, 0.17027937f,
-    0.17003966f, 0.16979996f, 0.16956026f, 0.16932057f, 0.16908088f, 0.16884120f, 0.16860152f, 0.16836184f,
-    0.16812217f, 0.16788250f, 0.16764283f, 0.16740317f, 0.16716351f, 0.16692386f, 0.16668421f, 0.16644456f,
-    0.16620492f, 0.16596528f, 0.16572565f, 0.16548602f, 0.16524639f, 0.16500677f, 0.16476715f, 0.16452753f,
-    0.16428792f, 0.16404832f, 0.16380871f, 0.16356911f, 0.16332951f, 0.16308992f, 0.16285033f, 0.16261075f,
-    0.16237117f, 0.16213159f, 0.16189201f, 0.16165244f, 0.16141288f, 0.16117331f, 0.16093375f, 0.16069420f,
-    0.16045465f, 0.16021510f, 0.15997555f, 0.15973601f, 0.15949647f, 0.15925694f, 0.15901741f, 0.15877788f,
-    0.15853836f, 0.15829884f, 0.15805932f, 0.15781981f, 0.15758030f, 0.15734080f, 0.15710129f, 0.15686180f,
-    0.15662230f, 0.15638281f, 0.15614332f, 0.15590384f, 0.15566436f, 0.15542488f, 0.15518541f, 0.15494594f,
-    0.15470647f, 0.15446700f, 0.15422754f, 0.15398809f, 0.15374864f, 0.15350919f, 0.15326974f, 0.15303030f,
-    0.15279086f, 0.15255142f, 0.15231199f, 0.15207256f, 0.15183313f, 0.15159371f, 0.15135429f, 0.15111488f,
-    0.15087546f, 0.15063605f, 0.15039665f, 0.15015725f, 0.14991785f, 0.14967845f, 0.14943906f, 0.14919967f,
-    0.14896028f, 0.14872090f, 0.14848152f, 0.14824214f, 0.14800277f, 0.14776340f, 0.14752404f, 0.14728467f,
-    0.14704531f, 0.14680596f, 0.14656660f, 0.14632725f, 0.14608790f, 0.14584856f, 0.14560922f, 0.14536988f,
-    0.14513055f, 0.14489122f, 0.14465189f, 0.14441256f, 0.14417324f, 0.14393392f, 0.14369461f, 0.14345530f,
-    0.14321599f, 0.14297668f, 0.14273738f, 0.14249808f, 0.14225878f, 0.14201949f, 0.14178019f, 0.14154091f,
-    0.14130162f, 0.14106234f, 0.14082306f, 0.14058379f, 0.14034451f, 0.14010524f, 0.13986598f, 0.13962672f,
-    0.13938745f, 0.13914820f, 0.13890894f, 0.13866969f, 0.13843044f, 0.13819120f, 0.13795195f, 0.13771272f,
-    0.13747348f, 0.13723424f, 0.13699501f, 0.13675579f, 0.13651656f, 0.13627734f, 0.13603812f, 0.13579890f,
-    0.13555969f, 0.13532048f, 0.13508127f, 0.13484207f, 0.13460287f, 0.13436367f, 0.13412447f, 0.13388528f,
-    0.13364609f, 0.13340690f, 0.13316772f, 0.13292853f, 0.13268935f, 0.13245018f, 0.13221100f, 0.13197183f,
-    0.13173267f, 0.13149350f, 0.13125434f, 0.13101518f, 0.13077602f, 0.13053687f, 0.13029772f, 0.13005857f,
-    0.12981942f, 0.12958028f, 0.12934114f, 0.12910200f, 0.12886287f, 0.12862374f, 0.12838461f, 0.12814548f,
-    0.12790636f, 0.12766723f, 0.12742812f, 0.12718900f, 0.12694989f, 0.12671078f, 0.12647167f, 0.12623256f,
-    0.12599346f, 0.12575436f, 0.12551526f, 0.12527617f, 0.12503708f, 0.12479799f, 0.12455890f, 0.12431981f,
-    0.12408073f, 0.12384165f, 0.12360258f, 0.12336350f, 0.12312443f, 0.12288536f, 0.12264630f, 0.12240723f,
-    0.12216817f, 0.12192911f, 0.12169006f, 0.12145100f, 0.12121195f, 0.12097290f, 0.12073386f, 0.12049481f,
-    0.12025577f, 0.12001674f, 0.11977770f, 0.11953867f, 0.11929963f, 0.11906061f, 0.11882158f, 0.11858256f,
-    0.11834354f, 0.11810452f, 0.11786550f, 0.11762649f, 0.11738747f, 0.11714847f, 0.11690946f, 0.11667046f,
-    0.11643145f, 0.11619245f, 0.11595346f, 0.11571446f, 0.11547547f, 0.11523648f, 0.11499749f, 0.11475851f,
-    0.11451953f, 0.11428055f, 0.11404157f, 0.11380259f, 0.11356362f, 0.11332465f, 0.11308568f, 0.11284671f,
-    0.11260775f, 0.11236879f, 0.11212983f, 0.11189087f, 0.11165192f, 0.11141296f, 0.11117401f, 0.11093507f,
-    0.11069612f, 0.11045718f, 0.11021824f, 0.10997930f, 0.10974036f, 0.10950143f, 0.10926250f, 0.10902357f,
-    0.10878464f, 0.10854571f, 0.10830679f, 0.10806787f, 0.10782895f, 0.10759003f, 0.10735112f, 0.10711221f,
-    0.10687330f, 0.10663439f, 0.10639549f, 0.10615658f, 0.10591768f, 0.10567878f, 0.10543989f, 0.10520099f,
-    0.10496210f, 0.10472321f, 0.10448432f, 0.10424543f, 0.10400655f, 0.10376767f, 0.10352879f, 0.10328991f,
-    0.10305104f, 0.10281216f, 0.10257329f, 0.10233442f, 0.10209556f, 0.10185669f, 0.10161783f, 0.10137897f,
-    0.10114011f, 0.10090125f, 0.10066240f, 0.10042355f, 0.10018470f, 0.09994585f, 0.09970700f, 0.09946816f,
-    0.09922932f, 0.09899048f, 0.09875164f, 0.09851280f, 0.09827397f, 0.09803513f, 0.09779630f, 0.09755748f,
-    0.09731865f, 0.09707983f, 0.09684100f, 0.09660218f, 0.09636337f, 0.09612455f, 0.09588574f, 0.09564692f,
-    0.09540811f, 0.09516931f, 0.09493050f, 0.09469170f, 0.09445289f, 0.09421409f, 0.09397529f, 0.09373650f,
-    0.09349770f, 0.09325891f, 0.09302012f, 0.09278133f, 0.09254254f, 0.09230376f, 0.09206497f, 0.09182619f,
-    0.09158741f, 0.09134864f, 0.09110986f, 0.09087109f, 0.09063231f, 0.09039354f, 0.09015478f, 0.08991601f,
-    0.08967724f, 0.08943848f, 0.08919972f, 0.08896096f, 0.08872221f, 0.08848345f, 0.08824470f, 0.08800594f,
-    0.08776719f, 0.08752845f, 0.08728970f, 0.08705096f, 0.08681221f, 0.08657347f, 0.08633473f, 0.08609600f,
-    0.08585726f, 0.08561853f, 0.08537979f, 0.08514106f, 0.08490234f, 0.08466361f, 0.08442488f, 0.08418616f,
-    0.08394744f, 0.08370872f, 0.08347000f, 0.08323129f, 0.08299257f, 0.08275386f, 0.08251515f, 0.08227644f,
-    0.08203773f, 0.08179902f, 0.08156032f, 0.08132162f, 0.08108292f, 0.08084422f, 0.08060552f, 0.08036682f,
-    0.08012813f, 0.07988944f, 0.07965075f, 0.07941206f, 0.07917337f, 0.07893469f, 0.07869600f, 0.07845732f,
-    0.07821864f, 0.07797996f, 0.07774128f, 0.07750261f, 0.07726393f, 0.07702526f, 0.07678659f, 0.07654792f,
-    0.07630925f, 0.07607058f, 0.07583192f, 0.07559326f, 0.07535460f, 0.07511594f, 0.07487728f, 0.07463862f,
-    0.07439997f, 0.07416131f, 0.07392266f, 0.07368401f, 0.07344536f, 0.07320671f, 0.07296807f, 0.07272943f,
-    0.07249078f, 0.07225214f, 0.07201350f, 0.07177486f, 0.07153623f, 0.07129759f, 0.07105896f, 0.07082033f,
-    0.07058170f, 0.07034307f, 0.07010444f, 0.06986582f, 0.06962719f, 0.06938857f, 0.06914995f, 0.06891133f,
-    0.06867271f, 0.06843410f, 0.06819548f, 0.06795687f, 0.06771825f, 0.06747964f, 0.06724103f, 0.06700243f,
-    0.06676382f, 0.06652522f, 0.06628661f, 0.06604801f, 0.06580941f, 0.06557081f, 0.06533221f, 0.06509362f,
-    0.06485502f, 0.06461643f, 0.06437784f, 0.06413925f, 0.06390066f, 0.06366207f, 0.06342348f, 0.06318490f,
-    0.06294632f, 0.06270773f, 0.06246915f, 0.06223057f, 0.06199200f, 0.06175342f, 0.06151484f, 0.06127627f,
-    0.06103770f, 0.06079913f, 0.06056056f, 0.06032199f, 0.06008342f, 0.05984486f, 0.05960629f, 0.05936773f,
-    0.05912917f, 0.05889061f, 0.05865205f, 0.05841349f, 0.05817494f, 0.05793638f, 0.05769783f, 0.05745928f,
-    0.05722073f, 0.05698218f, 0.05674363f, 0.05650508f, 0.05626654f, 0.05602799f, 0.05578945f, 0.05555091f,
-    0.05531237f, 0.05507383f, 0.05483529f, 0.05459676f, 0.05435822f, 0.05411969f, 0.05388116f, 0.05364262f,
-    0.05340409f, 0.05316557f, 0.05292704f, 0.05268851f, 0.05244999f, 0.05221146f, 0.05197294f, 0.05173442f,
-    0.05149590f, 0.05125738f, 0.05101886f, 0.05078035f, 0.05054183f, 0.05030332f, 0.05006481f, 0.04982630f,
-    0.04958779f, 0.04934928f, 0.04911077f, 0.04887226f, 0.04863376f, 0.04839525f, 0.04815675f, 0.04791825f,
-    0.04767975f, 0.04744125f, 0.04720275f, 0.04696426f, 0.04672576f, 0.04648727f, 0.04624877f, 0.04601028f,
-    0.04577179f, 0.04553330f, 0.04529481f, 0.04505632f, 0.04481784f, 0.04457935f, 0.04434087f, 0.04410239f,
-    0.04386390f, 0.04362542f, 0.04338694f, 0.04314847f, 0.04290999f, 0.04267151f, 0.04243304f, 0.04219456f,
-    0.04195609f, 0.04171762f, 0.04147915f, 0.04124068f, 0.04100221f, 0.04076375f, 0.04052528f, 0.04028682f,
-    0.04004835f, 0.03980989f, 0.03957143f, 0.03933297f, 0.03909451f, 0.03885605f, 0.03861759f, 0.03837914f,
-    0.03814068f, 0.03790223f, 0.03766378f, 0.03742532f, 0.03718687f, 0.03694842f, 0.03670997f, 0.03647153f,
-    0.03623308f, 0.03599464f, 0.03575619f, 0.03551775f, 0.03527931f, 0.03504086f, 0.03480242f, 0.03456399f,
-    0.03432555f, 0.03408711f, 0.03384867f, 0.03361024f, 0.03337181f, 0.03313337f, 0.03289494f, 0.03265651f,
-    0.03241808f, 0.03217965f, 0.03194122f, 0.03170280f, 0.03146437f, 0.03122595f, 0.03098752f, 0.03074910f,
-    0.03051068f, 0.03027226f, 0.03003384f, 0.02979542f, 0.02955700f, 0.02931858f, 0.02908017f, 0.02884175f,
-    0.02860334f, 0.02836492f, 0.02812651f, 0.02788810f, 0.02764969f, 0.02741128f, 0.02717287f, 0.02693447f,
-    0.02669606f, 0.02645765f, 0.02621925f, 0.02598085f, 0.02574244f, 0.02550404f, 0.02526564f, 0.02502724f,
-    0.02478884f, 0.02455044f, 0.02431205f, 0.02407365f, 0.02383526f, 0.02359686f, 0.02335847f, 0.02312008f,
-    0.02288169f, 0.02264329f, 0.02240491f, 0.02216652f, 0.02192813f, 0.02168974f, 0.02145136f, 0.02121297f,
-    0.02097459f, 0.02073620f, 0.02049782f, 0.02025944f, 0.02002106f, 0.01978268f, 0.01954430f, 0.01930592f,
-    0.01906754f, 0.01882917f, 0.01859079f, 0.01835242f, 0.01811404f, 0.01787567f, 0.01763730f, 0.01739893f,
-    0.01716056f, 0.01692219f, 0.01668382f, 0.01644545f, 0.01620708f, 0.01596872f, 0.01573035f, 0.01549199f,
-    0.01525363f, 0.01501526f, 0.01477690f, 0.01453854f, 0.01430018f, 0.01406182f, 0.01382346f, 0.01358510f,
-    0.01334675f, 0.01310839f, 0.01287004f, 0.01263168f, 0.01239333f, 0.01215497f, 0.01191662f, 0.01167827f,
-    0.01143992f, 0.01120157f, 0.01096322f, 0.01072487f, 0.01048653f, 0.01024818f, 0.01000984f, 0.00977149f,
-    0.00953315f, 0.00929480f, 0.00905646f, 0.00881812f, 0.00857978f, 0.00834144f, 0.00810310f, 0.00786476f,
-    0.00762642f, 0.00738808f, 0.00714975f, 0.00691141f, 0.00667308f, 0.00643474f, 0.00619641f, 0.00595808f,
-    0.00571974f, 0.00548141f, 0.00524308f, 0.00500475f, 0.00476642f, 0.00452810f, 0.00428977f, 0.00405144f,
-    0.00381312f, 0.00357479f, 0.00333647f, 0.00309814f, 0.00285982f, 0.00262150f, 0.00238318f, 0.00214486f,
-    0.00190654f, 0.00166822f, 0.00142990f, 0.00119158f, 0.00095326f, 0.00071495f, 0.00047663f, 0.00023831f,
+alignas(4) const int16_t waveform_Acid[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+     22101,  31503,  28387,  30287,  28957,  30023,  29180,  29925,  29309,  29883,  29398,  29867,  29467,  29864,  29525,  29869,
+     29574,  29879,  29618,  29892,  29657,  29906,  29694,  29922,  29728,  29938,  29759,  29955,  29789,  29972,  29817,  29988,
+     29843,  30005,  29868,  30021,  29892,  30037,  29914,  30052,  29935,  30067,  29955,  30081,  29974,  30095,  29992,  30108,
+     30010,  30120,  30026,  30132,  30041,  30144,  30055,  30154,  30069,  30165,  30082,  30174,  30093,  30183,  30104,  30191,
+     30115,  30199,  30124,  30206,  30133,  30212,  30141,  30218,  30148,  30223,  30155,  30227,  30160,  30231,  30166,  30234,
+     30170,  30237,  30174,  30239,  30177,  30240,  30179,  30241,  30181,  30242,  30183,  30241,  30183,  30240,  30183,  30239,
+     30182,  30237,  30181,  30235,  30179,  30231,  30177,  30228,  30174,  30224,  30170,  30219,  30166,  30214,  30162,  30208,
+     30156,  30202,  30151,  30195,  30144,  30188,  30138,  30180,  30130,  30172,  30122,  30163,  30114,  30154,  30105,  30144,
+     30096,  30134,  30086,  30124,  30076,  30113,  30065,  30101,  30054,  30089,  30043,  30077,  30030,  30064,  30018,  30051,
+     30005,  30037,  29992,  30023,  29978,  30009,  29964,  29994,  29949,  29979,  29934,  29963,  29918,  29947,  29903,  29931,
+     29886,  29914,  29870,  29897,  29853,  29879,  29835,  29861,  29817,  29843,  29799,  29824,  29781,  29805,  29762,  29786,
+     29743,  29766,  29723,  29746,  29703,  29726,  29683,  29705,  29662,  29684,  29642,  29663,  29620,  29641,  29599,  29619,
+     29577,  29597,  29555,  29574,  29532,  29551,  29510,  29528,  29487,  29505,  29463,  29481,  29440,  29457,  29416,  29433,
+     29391,  29408,  29367,  29383,  29342,  29358,  29317,  29333,  29292,  29307,  29266,  29281,  29240,  29255,  29214,  29229,
+     29188,  29202,  29162,  29175,  29135,  29148,  29108,  29121,  29080,  29093,  29053,  29065,  29025,  29037,  28997,  29009,
+     28969,  28981,  28941,  28952,  28912,  28923,  28883,  28894,  28854,  28865,  28825,  28835,  28796,  28806,  28766,  28776,
+     28736,  28746,  28706,  28716,  28676,  28685,  28646,  28655,  28615,  28624,  28584,  28593,  28554,  28562,  28522,  28530,
+     28491,  28499,  28460,  28467,  28428,  28435,  28396,  28403,  28365,  28371,  28332,  28339,  28300,  28307,  28268,  28274,
+     28235,  28241,  28203,  28209,  28170,  28176,  28137,  28142,  28104,  28109,  28071,  28076,  28037,  28042,  28004,  28009,
+     27970,  27975,  27936,  27941,  27903,  27907,  27869,  27873,  27834,  27838,  27800,  27804,  27766,  27769,  27731,  27735,
+     27697,  27700,  27662,  27665,  27627,  27630,  27593,  27595,  27558,  27560,  27522,  27525,  27487,  27490,  27452,  27454,
+     27417,  27419,  27381,  27383,  27346,  27347,  27310,  27312,  27274,  27276,  27238,  27240,  27202,  27204,  27166,  27168,
+     27130,  27131,  27094,  27095,  27058,  27059,  27022,  27022,  26985,  26986,  26949,  26949,  26912,  26913,  26876,  26876,
+     26839,  26839,  26802,  26803,  26766,  26766,  26729,  26729,  26692,  26692,  26655,  26655,  26618,  26618,  26581,  26580,
+     26544,  26543,  26507,  26506,  26469,  26469,  26432,  26431,  26395,  26394,  26357,  26356,  26320,  26319,  26283,  26281,
+     26245,  26244,  26208,  26206,  26170,  26168,  26132,  26131,  26095,  26093,  26057,  26055,  26019,  26017,  25981,  25979,
+     25944,  25942,  25906,  25904,  25868,  25866,  25830,  25828,  25792,  25790,  25754,  25752,  25716,  25714,  25678,  25676,
+     25640,  25637,  25602,  25599,  25564,  25561,  25526,  25523,  25488,  25485,  25450,  25447,  25411,  25408,  25373,  25370,
+     25335,  25332,  25297,  25294,  25259,  25255,  25220,  25217,  25182,  25179,  25144,  25140,  25106,  25102,  25067,  25064,
+     25029,  25025,  24991,  24987,  24952,  24949,  24914,  24910,  24876,  24872,  24837,  24833,  24799,  24795,  24761,  24757,
+     24722,  24718,  24684,  24680,  24646,  24641,  24607,  24603,  24569,  24565,  24531,  24526,  24492,  24488,  24454,  24449,
+     24415,  24411,  24377,  24373,  24339,  24334,  24300,  24296,  24262,  24257,  24224,  24219,  24185,  24181,  24147,  24142,
+     24109,  24104,  24070,  24066,  24032,  24027,  23994,  23989,  23956,  23951,  23917,  23912,  23879,  23874,  23841,  23836,
+     23803,  23797,  23764,  23759,  23726,  23721,  23688,  23683,  23650,  23644,  23612,  23606,  23573,  23568,  23535,  23530,
+     23497,  23492,  23459,  23454,  23421,  23415,  23383,  23377,  23345,  23339,  23307,  23301,  23269,  23263,  23231,  23225,
+     23193,  23187,  23155,  23149,  23117,  23111,  23079,  23073,  23041,  23035,  23003,  22997,  22965,  22959,  22927,  22921,
+     22889,  22883,  22851,  22845,  22814,  22808,  22776,  22770,  22738,  22732,  22700,  22694,  22663,  22657,  22625,  22619,
+     22587,  22581,  22549,  22543,  22512,  22506,  22474,  22468,  22437,  22431,  22399,  22393,  22362,  22355,  22324,  22318,
+     22287,  22280,  22249,  22243,  22212,  22205,  22174,  22168,  22137,  22131,  22100,  22093,  22062,  22056,  22025,  22019,
+     21988,  21981,  21950,  21944,  21913,  21907,  21876,  21870,  21839,  21832,  21802,  21795,  21765,  21758,  21728,  21721,
+     21690,  21684,  21653,  21647,  21616,  21610,  21579,  21573,  21543,  21536,  21506,  21499,  21469,  21462,  21432,  21425,
+     21395,  21388,  21358,  21352,  21321,  21315,  21285,  21278,  21248,  21241,  21211,  21205,  21175,  21168,  21138,  21131,
+     21102,  21095,  21065,  21058,  21028,  21022,  20992,  20985,  20955,  20949,  20919,  20912,  20883,  20876,  20846,  20839,
+     20810,  20803,  20774,  20767,  20737,  20730,  20701,  20694,  20665,  20658,  20629,  20622,  20592,  20585,  20556,  20549,
+     20520,  20513,  20484,  20477,  20448,  20441,  20412,  20405,  20376,  20369,  20340,  20333,  20304,  20297,  20268,  20261,
+     20232,  20225,  20197,  20189,  20161,  20154,  20125,  20118,  20089,  20082,  20054,  20046,  20018,  20011,  19982,  19975,
+     19947,  19939,  19911,  19904,  19876,  19868,  19840,  19833,  19805,  19797,  19769,  19762,  19734,  19726,  19698,  19691,
+     19663,  19656,  19628,  19620,  19592,  19585,  19557,  19550,  19522,  19514,  19487,  19479,  19451,  19444,  19416,  19409,
+     19381,  19374,  19346,  19339,  19311,  19304,  19276,  19269,  19241,  19234,  19206,  19199,  19171,  19164,  19136,  19129,
+     19101,  19094,  19067,  19059,  19032,  19024,  18997,  18989,  18962,  18955,  18927,  18920,  18893,  18885,  18858,  18851,
+     18823,  18816,  18789,  18781,  18754,  18747,  18720,  18712,  18685,  18678,  18651,  18643,  18616,  18609,  18582,  18574,
+     18548,  18540,  18513,  18506,  18479,  18471,  18445,  18437,  18410,  18403,  18376,  18368,  18342,  18334,  18308,  18300,
+     18273,  18266,  18239,  18232,  18205,  18198,  18171,  18163,  18137,  18129,  18103,  18095,  18069,  18061,  18035,  18027,
+     18001,  17993,  17967,  17960,  17933,  17926,  17900,  17892,  17866,  17858,  17832,  17824,  17798,  17790,  17765,  17757,
+     17731,  17723,  17697,  17689,  17664,  17656,  17630,  17622,  17596,  17588,  17563,  17555,  17529,  17521,  17496,  17488,
+     17462,  17454,  17429,  17421,  17395,  17387,  17362,  17354,  17329,  17321,  17295,  17287,  17262,  17254,  17229,  17221,
+     17195,  17187,  17162,  17154,  17129,  17121,  17096,  17088,  17063,  17054,  17029,  17021,  16996,  16988,  16963,  16955,
+     16930,  16922,  16897,  16889,  16864,  16856,  16831,  16823,  16798,  16790,  16765,  16757,  16732,  16724,  16699,  16691,
+     16667,  16658,  16634,  16626,  16601,  16593,  16568,  16560,  16535,  16527,  16503,  16494,  16470,  16462,  16437,  16429,
+     16405,  16396,  16372,  16364,  16339,  16331,  16307,  16298,  16274,  16266,  16242,  16233,  16209,  16201,  16177,  16168,
+     16144,  16136,  16112,  16103,  16079,  16071,  16047,  16038,  16014,  16006,  15982,  15974,  15950,  15941,  15917,  15909,
+     15885,  15877,  15853,  15844,  15820,  15812,  15788,  15780,  15756,  15748,  15724,  15715,  15692,  15683,  15660,  15651,
+     15627,  15619,  15595,  15587,  15563,  15555,  15531,  15523,  15499,  15491,  15467,  15459,  15435,  15427,  15403,  15395,
+     15371,  15363,  15339,  15331,  15307,  15299,  15276,  15267,  15244,  15235,  15212,  15203,  15180,  15171,  15148,  15139,
+     15116,  15108,  15085,  15076,  15053,  15044,  15021,  15012,  14989,  14981,  14958,  14949,  14926,  14917,  14894,  14886,
+     14863,  14854,  14831,  14822,  14800,  14791,  14768,  14759,  14736,  14728,  14705,  14696,  14673,  14664,  14642,  14633,
+     14610,  14601,  14579,  14570,  14547,  14539,  14516,  14507,  14485,  14476,  14453,  14444,  14422,  14413,  14391,  14382,
+     14359,  14350,  14328,  14319,  14297,  14288,  14265,  14256,  14234,  14225,  14203,  14194,  14172,  14162,  14140,  14131,
+     14109,  14100,  14078,  14069,  14047,  14038,  14016,  14006,  13984,  13975,  13953,  13944,  13922,  13913,  13891,  13882,
+     13860,  13851,  13829,  13820,  13798,  13789,  13767,  13758,  13736,  13727,  13705,  13696,  13674,  13665,  13643,  13634,
+     13612,  13603,  13581,  13572,  13550,  13541,  13519,  13510,  13489,  13479,  13458,  13448,  13427,  13417,  13396,  13386,
+     13365,  13356,  13334,  13325,  13304,  13294,  13273,  13263,  13242,  13232,  13211,  13202,  13181,  13171,  13150,  13140,
+     13119,  13109,  13088,  13079,  13058,  13048,  13027,  13017,  12996,  12987,  12966,  12956,  12935,  12925,  12905,  12895,
+     12874,  12864,  12843,  12834,  12813,  12803,  12782,  12772,  12752,  12742,  12721,  12711,  12691,  12681,  12660,  12650,
+     12630,  12620,  12599,  12589,  12569,  12559,  12538,  12528,  12508,  12498,  12477,  12467,  12447,  12437,  12417,  12407,
+     12386,  12376,  12356,  12346,  12325,  12315,  12295,  12285,  12265,  12255,  12234,  12224,  12204,  12194,  12174,  12164,
+     12143,  12133,  12113,  12103,  12083,  12073,  12053,  12042,  12022,  12012,  11992,  11982,  11962,  11952,  11932,  11921,
+     11902,  11891,  11871,  11861,  11841,  11831,  11811,  11801,  11781,  11770,  11751,  11740,  11721,  11710,  11690,  11680,
+     11660,  11650,  11630,  11620,  11600,  11590,  11570,  11559,  11540,  11529,  11510,  11499,  11480,  11469,  11450,  11439,
+     11420,  11409,  11390,  11379,  11360,  11349,  11330,  11319,  11300,  11289,  11270,  11259,  11240,  11229,  11210,  11199,
+     11180,  11169,  11150,  11139,  11120,  11109,  11090,  11079,  11060,  11049,  11030,  11019,  11000,  10989,  10970,  10959,
+     10940,  10929,  10911,  10900,  10881,  10870,  10851,  10840,  10821,  10810,  10791,  10780,  10761,  10750,  10731,  10720,
+     10702,  10690,  10672,  10661,  10642,  10631,  10612,  10601,  10582,  10571,  10553,  10541,  10523,  10512,  10493,  10482,
+     10463,  10452,  10434,  10422,  10404,  10393,  10374,  10363,  10344,  10333,  10315,  10303,  10285,  10274,  10255,  10244,
+     10226,  10214,  10196,  10184,  10166,  10155,  10137,  10125,  10107,  10095,  10077,  10066,  10048,  10036,  10018,  10006,
+      9988,   9977,   9959,   9947,   9929,   9917,   9900,   9888,   9870,   9858,   9840,   9829,   9811,   9799,   9781,   9769,
+      9752,   9740,   9722,   9710,   9693,   9681,   9663,   9651,   9633,   9621,   9604,   9592,   9574,   9562,   9545,   9533,
+      9515,   9503,   9486,   9474,   9456,   9444,   9427,   9415,   9397,   9385,   9368,   9356,   9338,   9326,   9309,   9296,
+      9279,   9267,   9250,   9237,   9220,   9208,   9191,   9179,   9162,   9149,   9132,   9120,   9103,   9090,   9073,   9061,
+      9044,   9031,   9014,   9002,   8985,   8972,   8956,   8943,   8926,   8913,   8897,   8884,   8867,   8855,   8838,   8825,
+      8809,   8796,   8779,   8766,   8750,   8737,   8721,   8708,   8691,   8678,   8662,   8649,   8632,   8619,   8603,   8590,
+      8574,   8561,   8544,   8531,   8515,   8502,   8486,   8473,   8456,   8443,   8427,   8414,   8398,   8385,   8369,   8355,
+      8339,   8326,   8310,   8297,   8281,   8267,   8251,   8238,   8222,   8209,   8193,   8179,   8164,   8150,   8134,   8121,
+      8105,   8091,   8076,   8062,   8047,   8033,   8017,   8004,   7988,   7974,   7959,   7945,   7930,   7916,   7900,   7886,
+      7871,   7857,   7842,   7828,   7813,   7799,   7783,   7769,   7754,   7740,   7725,   7711,   7696,   7682,   7667,   7652,
+      7637,   7623,   7608,   7594,   7579,   7565,   7550,   7536,   7521,   7506,   7492,   7477,   7462,   7448,   7433,   7419,
+      7404,   7390,   7375,   7360,   7346,   7331,   7317,   7302,   7288,   7273,   7258,   7244,   7229,   7214,   7200,   7185,
+      7171,   7156,   7142,   7127,   7113,   7098,   7084,   7069,   7054,   7039,   7025,   7010,   6996,   6981,   6967,   6952,
+      6938,   6923,   6909,   6894,   6880,   6864,   6851,   6835,   6822,   6806,   6793,   6777,   6764,   6748,   6734,   6719,
+      6705,   6690,   6676,   6661,   6647,   6631,   6618,   6602,   6589,   6573,   6560,   6544,   6531,   6515,   6502,   6486,
+      6473,   6457,   6444,   6428,   6415,   6399,   6386,   6369,   6357,   6340,   6328,   6311,   6299,   6282,   6270,   6253,
+      6241,   6224,   6212,   6195,   6183,   6166,   6154,   6137,   6125,   6108,   6095,   6079,   6066,   6050,   6037,   6021,
+      6008,   5991,   5979,   5962,   5950,   5933,   5921,   5904,   5892,   5875,   5864,   5846,   5835,   5817,   5806,   5788,
+      5777,   5759,   5748,   5730,   5719,   5701,   5690,   5672,   5661,   5643,   5632,   5614,   5603,   5585,   5574,   5556,
+      5545,   5527,   5516,   5498,   5487,   5469,   5458,   5440,   5429,   5411,   5400,   5382,   5371,   5353,   5342,   5324,
+      5313,   5294,   5284,   5265,   5255,   5236,   5226,   5207,   5197,   5178,   5169,   5149,   5140,   5120,   5111,   5091,
+      5082,   5062,   5053,   5033,   5024,   5004,   4995,   4975,   4966,   4946,   4937,   4917,   4908,   4888,   4879,   4859,
+      4850,   4830,   4822,   4801,   4793,   4772,   4764,   4743,   4735,   4714,   4706,   4685,   4677,   4656,   4648,   4627,
+      4619,   4599,   4590,   4570,   4561,   4541,   4533,   4512,   4504,   4483,   4475,   4454,   4446,   4425,   4417,   4396,
+      4388,   4367,   4359,   4338,   4331,   4309,   4302,   4280,   4273,   4251,   4244,   4222,   4215,   4193,   4186,   4164,
+      4157,   4135,   4129,   4106,   4100,   4077,   4071,   4048,   4042,   4019,   4013,   3990,   3984,   3961,   3955,   3932,
+      3927,   3903,   3898,   3874,   3869,   3845,   3840,   3816,   3811,   3787,   3782,   3758,   3754,   3729,   3725,   3700,
+      3696,   3671,   3667,   3642,   3638,   3613,   3610,   3584,   3581,   3556,   3552,   3527,   3523,   3498,   3494,   3469,
+      3466,   3440,   3437,   3411,   3408,   3382,   3379,   3353,   3350,   3324,   3322,   3295,   3293,   3266,   3264,   3237,
+      3235,   3208,   3207,   3179,   3178,   3150,   3149,   3121,   3120,   3092,   3091,   3063,   3063,   3034,   3034,   3005,
+      3005,   2976,   2976,   2947,   2948,   2918,   2919,   2889,   2890,   2860,   2861,   2831,   2833,   2802,   2804,   2773,
+      2775,   2744,   2747,   2715,   2718,   2686,   2689,   2657,   2660,   2628,   2632,   2599,   2603,   2570,   2574,   2541,
+      2546,   2512,   2517,   2483,   2488,   2454,   2460,   2425,   2431,   2396,   2402,   2367,   2374,   2338,   2345,   2309,
+      2316,   2280,   2288,   2251,   2259,   2222,   2230,   2193,   2202,   2164,   2173,   2135,   2144,   2106,   2116,   2077,
+      2087,   2048,   2059,   2019,   2030,   1990,   2001,   1961,   1973,   1931,   1944,   1902,   1916,   1873,   1887,   1844,
+      1859,   1815,   1830,   1786,   1802,   1757,   1773,   1728,   1744,   1698,   1716,   1669,   1688,   1640,   1659,   1611,
+      1631,   1582,   1602,   1552,   1574,   1523,   1545,   1494,   1517,   1465,   1489,   1435,   1460,   1406,   1432,   1377,
+      1404,   1348,   1375,   1318,   1347,   1289,   1319,   1259,   1290,   1230,   1262,   1201,   1234,   1171,   1206,   1142,
+      1178,   1112,   1150,   1082,   1122,   1053,   1094,   1023,   1066,    993,   1038,    964,   1010,    934,    982,    904,
+       955,    874,    927,    844,    900,    814,    872,    784,    845,    753,    817,    723,    790,    692,    763,    662,
+       736,    631,    710,    600,    683,    568,    657,    537,    631,    505,    605,    473,    580,    441,    555,    408,
+       530,    374,    507,    340,    483,    306,    461,    270,    440,    233,    420,    194,    402,    154,    386,    111,
+       373,     63,    365,     11,    364,    -51,    374,   -127,    404,   -229,    471,   -389,    632,   -716,   1139,  -1995,
+    
+    // Level 1: 1024 samples, 511 harmonics
+     18421,  31990,  28181,  30499,  28902,  30201,  29193,  30102,  29368,  30069,  29492,  30064,  29590,  30074,  29671,  30090,
+     29740,  30110,  29800,  30132,  29852,  30153,  29899,  30173,  29941,  30193,  29977,  30210,  30010,  30226,  30038,  30240,
+     30063,  30252,  30084,  30262,  30102,  30270,  30117,  30275,  30129,  30278,  30138,  30279,  30144,  30278,  30147,  30275,
+     30148,  30269,  30146,  30262,  30142,  30252,  30136,  30241,  30127,  30227,  30116,  30212,  30103,  30195,  30088,  30175,
+     30071,  30154,  30051,  30131,  30030,  30107,  30007,  30081,  29982,  30053,  29956,  30023,  29927,  29992,  29898,  29959,
+     29866,  29925,  29833,  29890,  29798,  29852,  29762,  29814,  29724,  29774,  29685,  29733,  29645,  29691,  29603,  29647,
+     29560,  29602,  29516,  29556,  29470,  29509,  29424,  29460,  29376,  29411,  29327,  29360,  29277,  29309,  29226,  29256,
+     29174,  29203,  29121,  29148,  29067,  29093,  29012,  29037,  28956,  28980,  28899,  28922,  28842,  28863,  28783,  28803,
+     28724,  28743,  28664,  28682,  28603,  28620,  28542,  28558,  28480,  28494,  28417,  28431,  28353,  28366,  28289,  28301,
+     28225,  28236,  28159,  28169,  28093,  28103,  28027,  28036,  27960,  27968,  27893,  27900,  27825,  27831,  27756,  27762,
+     27687,  27692,  27618,  27622,  27548,  27552,  27478,  27481,  27408,  27410,  27337,  27338,  27265,  27266,  27194,  27194,
+     27122,  27122,  27050,  27049,  26977,  26976,  26904,  26903,  26831,  26829,  26758,  26755,  26684,  26681,  26610,  26607,
+     26536,  26532,  26462,  26457,  26387,  26382,  26313,  26307,  26238,  26232,  26163,  26157,  26088,  26081,  26012,  26005,
+     25937,  25929,  25861,  25853,  25785,  25777,  25710,  25701,  25634,  25625,  25558,  25548,  25481,  25472,  25405,  25395,
+     25329,  25319,  25252,  25242,  25176,  25166,  25100,  25089,  25023,  25012,  24947,  24935,  24870,  24858,  24793,  24781,
+     24717,  24705,  24640,  24628,  24563,  24551,  24487,  24474,  24410,  24397,  24334,  24320,  24257,  24243,  24180,  24167,
+     24104,  24090,  24027,  24013,  23951,  23936,  23874,  23860,  23798,  23783,  23721,  23707,  23645,  23630,  23569,  23554,
+     23492,  23477,  23416,  23401,  23340,  23325,  23264,  23248,  23188,  23172,  23112,  23096,  23036,  23020,  22961,  22944,
+     22885,  22869,  22809,  22793,  22734,  22717,  22659,  22642,  22583,  22566,  22508,  22491,  22433,  22416,  22358,  22340,
+     22283,  22265,  22208,  22190,  22133,  22116,  22059,  22041,  21984,  21966,  21910,  21892,  21835,  21817,  21761,  21743,
+     21687,  21669,  21613,  21595,  21539,  21521,  21465,  21447,  21392,  21373,  21318,  21300,  21245,  21226,  21172,  21153,
+     21098,  21079,  21025,  21006,  20952,  20933,  20880,  20860,  20807,  20788,  20734,  20715,  20662,  20642,  20590,  20570,
+     20517,  20498,  20445,  20426,  20373,  20354,  20302,  20282,  20230,  20210,  20158,  20138,  20087,  20067,  20016,  19995,
+     19944,  19924,  19873,  19853,  19802,  19782,  19731,  19711,  19661,  19640,  19590,  19570,  19520,  19499,  19449,  19429,
+     19379,  19358,  19309,  19288,  19239,  19218,  19169,  19148,  19099,  19078,  19030,  19009,  18960,  18939,  18891,  18870,
+     18822,  18800,  18753,  18731,  18684,  18662,  18615,  18593,  18546,  18524,  18477,  18456,  18409,  18387,  18340,  18319,
+     18272,  18250,  18204,  18182,  18136,  18114,  18068,  18046,  18000,  17978,  17932,  17910,  17865,  17842,  17797,  17775,
+     17730,  17707,  17662,  17640,  17595,  17573,  17528,  17506,  17461,  17439,  17394,  17372,  17328,  17305,  17261,  17238,
+     17194,  17172,  17128,  17105,  17062,  17039,  16995,  16973,  16929,  16906,  16863,  16840,  16797,  16774,  16731,  16708,
+     16666,  16643,  16600,  16577,  16535,  16511,  16469,  16446,  16404,  16381,  16339,  16315,  16274,  16250,  16208,  16185,
+     16144,  16120,  16079,  16055,  16014,  15990,  15949,  15925,  15885,  15861,  15820,  15796,  15756,  15732,  15691,  15667,
+     15627,  15603,  15563,  15539,  15499,  15475,  15435,  15411,  15371,  15347,  15307,  15283,  15244,  15219,  15180,  15155,
+     15116,  15092,  15053,  15028,  14989,  14965,  14926,  14901,  14863,  14838,  14800,  14775,  14737,  14712,  14674,  14648,
+     14611,  14585,  14548,  14523,  14485,  14460,  14422,  14397,  14360,  14334,  14297,  14271,  14234,  14209,  14172,  14146,
+     14110,  14084,  14047,  14021,  13985,  13959,  13923,  13897,  13861,  13835,  13799,  13773,  13737,  13710,  13675,  13648,
+     13613,  13587,  13551,  13525,  13489,  13463,  13428,  13401,  13366,  13339,  13304,  13278,  13243,  13216,  13181,  13155,
+     13120,  13093,  13059,  13032,  12997,  12970,  12936,  12909,  12875,  12848,  12814,  12787,  12753,  12725,  12692,  12664,
+     12631,  12603,  12570,  12542,  12509,  12481,  12448,  12420,  12388,  12360,  12327,  12299,  12266,  12238,  12206,  12177,
+     12145,  12117,  12085,  12056,  12024,  11995,  11964,  11935,  11903,  11874,  11843,  11814,  11783,  11754,  11722,  11693,
+     11662,  11633,  11602,  11573,  11542,  11512,  11482,  11452,  11422,  11392,  11362,  11332,  11302,  11272,  11242,  11212,
+     11182,  11152,  11122,  11092,  11062,  11032,  11002,  10972,  10943,  10912,  10883,  10852,  10823,  10793,  10764,  10733,
+     10704,  10673,  10644,  10613,  10585,  10554,  10525,  10494,  10466,  10435,  10407,  10375,  10347,  10316,  10288,  10256,
+     10228,  10197,  10169,  10137,  10110,  10078,  10051,  10018,   9991,   9959,   9932,   9900,   9873,   9840,   9814,   9781,
+      9755,   9722,   9696,   9663,   9637,   9603,   9578,   9544,   9519,   9485,   9460,   9426,   9401,   9367,   9342,   9308,
+      9283,   9249,   9224,   9190,   9165,   9131,   9106,   9072,   9047,   9013,   8989,   8954,   8930,   8895,   8871,   8836,
+      8812,   8777,   8754,   8718,   8695,   8660,   8636,   8601,   8578,   8542,   8519,   8483,   8461,   8424,   8402,   8366,
+      8343,   8307,   8285,   8248,   8226,   8190,   8168,   8131,   8109,   8072,   8051,   8014,   7993,   7955,   7934,   7896,
+      7876,   7838,   7817,   7779,   7759,   7721,   7701,   7662,   7642,   7604,   7584,   7545,   7526,   7487,   7467,   7428,
+      7409,   7370,   7351,   7311,   7293,   7253,   7235,   7194,   7176,   7136,   7118,   7078,   7060,   7019,   7002,   6961,
+      6944,   6903,   6886,   6844,   6827,   6786,   6769,   6727,   6711,   6669,   6653,   6611,   6595,   6553,   6537,   6494,
+      6479,   6436,   6421,   6378,   6363,   6319,   6305,   6261,   6247,   6203,   6189,   6145,   6131,   6086,   6073,   6028,
+      6015,   5970,   5957,   5912,   5900,   5854,   5842,   5795,   5784,   5737,   5726,   5679,   5668,   5621,   5610,   5563,
+      5552,   5505,   5495,   5446,   5437,   5388,   5379,   5330,   5321,   5272,   5263,   5214,   5206,   5156,   5148,   5097,
+      5090,   5039,   5032,   4981,   4975,   4923,   4917,   4865,   4859,   4807,   4802,   4749,   4744,   4691,   4686,   4633,
+      4629,   4574,   4571,   4516,   4514,   4458,   4456,   4400,   4398,   4342,   4341,   4284,   4283,   4226,   4226,   4168,
+      4168,   4110,   4111,   4051,   4053,   3993,   3996,   3935,   3938,   3877,   3881,   3819,   3823,   3761,   3766,   3703,
+      3708,   3645,   3651,   3586,   3594,   3528,   3536,   3470,   3479,   3412,   3421,   3354,   3364,   3295,   3307,   3237,
+      3250,   3179,   3192,   3121,   3135,   3063,   3078,   3004,   3021,   2946,   2963,   2888,   2906,   2829,   2849,   2771,
+      2792,   2713,   2735,   2654,   2678,   2596,   2621,   2538,   2564,   2479,   2507,   2421,   2450,   2362,   2393,   2304,
+      2337,   2245,   2280,   2186,   2223,   2128,   2166,   2069,   2110,   2010,   2053,   1951,   1997,   1893,   1940,   1834,
+      1884,   1774,   1828,   1715,   1772,   1656,   1716,   1597,   1660,   1537,   1604,   1478,   1549,   1418,   1493,   1358,
+      1438,   1298,   1383,   1237,   1328,   1177,   1273,   1116,   1219,   1055,   1165,    993,   1112,    931,   1059,    869,
+      1006,    806,    955,    742,    904,    677,    854,    611,    805,    543,    759,    474,    714,    402,    672,    327,
+       634,    247,    602,    161,    577,     64,    567,    -51,    579,   -197,    638,   -414,    811,   -834,   1409,  -2451,
+    
+    // Level 2: 512 samples, 255 harmonics
+     16586,  32139,  28189,  30632,  28993,  30366,  29337,  30299,  29549,  30290,  29700,  30302,  29814,  30319,  29901,  30335,
+     29968,  30347,  30018,  30353,  30053,  30351,  30075,  30343,  30085,  30327,  30084,  30303,  30073,  30272,  30053,  30234,
+     30023,  30189,  29986,  30137,  29941,  30079,  29888,  30014,  29828,  29944,  29762,  29868,  29690,  29787,  29613,  29701,
+     29529,  29609,  29441,  29514,  29348,  29414,  29250,  29309,  29148,  29201,  29042,  29090,  28932,  28975,  28818,  28856,
+     28701,  28735,  28581,  28610,  28459,  28483,  28333,  28354,  28205,  28222,  28074,  28088,  27941,  27952,  27807,  27814,
+     27670,  27675,  27531,  27533,  27391,  27390,  27249,  27246,  27106,  27101,  26962,  26954,  26816,  26807,  26670,  26658,
+     26522,  26509,  26374,  26358,  26225,  26207,  26075,  26056,  25924,  25904,  25773,  25751,  25622,  25599,  25470,  25445,
+     25317,  25292,  25165,  25138,  25012,  24984,  24859,  24830,  24706,  24676,  24553,  24522,  24400,  24368,  24247,  24215,
+     24094,  24061,  23941,  23907,  23789,  23754,  23636,  23600,  23484,  23447,  23332,  23295,  23180,  23142,  23029,  22990,
+     22877,  22838,  22726,  22687,  22576,  22536,  22426,  22385,  22276,  22235,  22126,  22085,  21978,  21935,  21829,  21786,
+     21681,  21638,  21533,  21490,  21386,  21342,  21239,  21195,  21093,  21048,  20947,  20902,  20802,  20757,  20657,  20611,
+     20512,  20467,  20369,  20322,  20225,  20179,  20082,  20036,  19940,  19893,  19798,  19751,  19657,  19609,  19516,  19468,
+     19375,  19327,  19235,  19187,  19096,  19047,  18957,  18908,  18818,  18769,  18680,  18631,  18543,  18493,  18406,  18356,
+     18269,  18219,  18133,  18082,  17997,  17947,  17862,  17811,  17727,  17676,  17593,  17541,  17459,  17407,  17326,  17274,
+     17192,  17140,  17060,  17007,  16928,  16875,  16796,  16743,  16664,  16611,  16533,  16480,  16403,  16349,  16273,  16218,
+     16143,  16088,  16013,  15959,  15884,  15829,  15755,  15700,  15627,  15571,  15499,  15443,  15371,  15315,  15243,  15187,
+     15116,  15060,  14990,  14933,  14863,  14806,  14737,  14680,  14611,  14553,  14486,  14428,  14360,  14302,  14235,  14177,
+     14111,  14052,  13986,  13927,  13862,  13802,  13738,  13678,  13614,  13554,  13491,  13430,  13368,  13307,  13245,  13184,
+     13122,  13060,  12999,  12938,  12877,  12815,  12755,  12693,  12633,  12570,  12512,  12448,  12390,  12326,  12269,  12205,
+     12148,  12083,  12027,  11962,  11906,  11841,  11786,  11720,  11665,  11599,  11545,  11479,  11425,  11358,  11305,  11238,
+     11186,  11118,  11066,  10998,  10947,  10878,  10828,  10758,  10709,  10639,  10590,  10519,  10471,  10400,  10352,  10281,
+     10233,  10162,  10115,  10043,   9997,   9924,   9878,   9805,   9760,   9687,   9642,   9568,   9524,   9450,   9407,   9331,
+      9289,   9213,   9171,   9095,   9054,   8977,   8937,   8859,   8819,   8741,   8702,   8623,   8585,   8505,   8468,   8387,
+      8351,   8270,   8234,   8152,   8118,   8035,   8001,   7917,   7884,   7800,   7768,   7683,   7651,   7565,   7535,   7448,
+      7419,   7331,   7302,   7214,   7186,   7097,   7070,   6980,   6954,   6863,   6838,   6746,   6722,   6629,   6606,   6512,
+      6491,   6395,   6375,   6278,   6259,   6162,   6144,   6045,   6028,   5928,   5913,   5811,   5797,   5695,   5682,   5578,
+      5566,   5461,   5451,   5344,   5336,   5228,   5221,   5111,   5106,   4994,   4991,   4878,   4876,   4761,   4761,   4644,
+      4646,   4527,   4532,   4411,   4417,   4294,   4302,   4177,   4188,   4060,   4074,   3943,   3959,   3826,   3845,   3709,
+      3731,   3592,   3617,   3475,   3503,   3358,   3389,   3241,   3276,   3123,   3162,   3006,   3049,   2888,   2936,   2770,
+      2823,   2652,   2710,   2534,   2598,   2415,   2486,   2296,   2374,   2177,   2263,   2058,   2152,   1938,   2041,   1817,
+      1931,   1696,   1822,   1574,   1714,   1451,   1607,   1327,   1501,   1202,   1397,   1074,   1295,    944,   1196,    810,
+      1102,    672,   1013,    527,    933,    370,    866,    196,    824,    -12,    830,   -293,    955,   -786,   1525,  -2539,
+    
+    // Level 3: 256 samples, 127 harmonics
+     15678,  32232,  28295,  30804,  29182,  30591,  29566,  30540,  29782,  30516,  29904,  30483,  29961,  30430,  29967,  30353,
+     29931,  30251,  29859,  30125,  29755,  29977,  29624,  29808,  29469,  29620,  29292,  29416,  29096,  29195,  28884,  28962,
+     28657,  28716,  28417,  28459,  28166,  28193,  27905,  27919,  27635,  27638,  27359,  27350,  27076,  27058,  26787,  26761,
+     26495,  26460,  26198,  26157,  25899,  25852,  25598,  25545,  25295,  25237,  24991,  24928,  24686,  24619,  24381,  24310,
+     24076,  24002,  23771,  23694,  23467,  23387,  23164,  23082,  22862,  22777,  22562,  22474,  22262,  22173,  21965,  21873,
+     21669,  21576,  21374,  21280,  21082,  20986,  20791,  20694,  20503,  20404,  20216,  20116,  19931,  19830,  19648,  19546,
+     19368,  19264,  19089,  18984,  18812,  18706,  18537,  18430,  18264,  18156,  17992,  17884,  17723,  17613,  17455,  17344,
+     17189,  17077,  16925,  16812,  16662,  16548,  16401,  16286,  16141,  16025,  15883,  15766,  15626,  15508,  15371,  15251,
+     15116,  14996,  14864,  14742,  14612,  14489,  14362,  14238,  14112,  13987,  13864,  13738,  13617,  13489,  13371,  13242,
+     13126,  12995,  12881,  12749,  12638,  12504,  12395,  12260,  12154,  12017,  11913,  11774,  11672,  11532,  11433,  11291,
+     11193,  11050,  10955,  10810,  10717,  10570,  10480,  10331,  10243,  10092,  10007,   9854,   9771,   9616,   9536,   9378,
+      9301,   9141,   9067,   8904,   8833,   8668,   8600,   8431,   8366,   8195,   8134,   7960,   7901,   7724,   7669,   7489,
+      7437,   7253,   7206,   7018,   6974,   6783,   6744,   6549,   6513,   6314,   6283,   6079,   6053,   5844,   5823,   5609,
+      5594,   5374,   5365,   5139,   5137,   4904,   4909,   4669,   4681,   4433,   4454,   4198,   4227,   3961,   4001,   3725,
+      3776,   3488,   3551,   3250,   3327,   3011,   3105,   2771,   2884,   2529,   2665,   2286,   2448,   2040,   2234,   1790,
+      2024,   1536,   1820,   1275,   1625,   1003,   1444,    712,   1288,    388,   1180,    -11,   1192,   -623,   1655,  -2512,
+    
+    // Level 4: 128 samples, 63 harmonics
+     15244,  32356,  28489,  31037,  29417,  30795,  29716,  30604,  29748,  30353,  29609,  30027,  29348,  29630,  28994,  29175,
+     28569,  28671,  28089,  28129,  27567,  27559,  27015,  26967,  26440,  26361,  25850,  25745,  25251,  25125,  24646,  24503,
+     24040,  23882,  23434,  23266,  22832,  22654,  22235,  22049,  21644,  21450,  21060,  20860,  20483,  20278,  19914,  19704,
+     19353,  19138,  18799,  18580,  18253,  18029,  17714,  17486,  17182,  16950,  16657,  16421,  16138,  15897,  15624,  15380,
+     15117,  14868,  14614,  14360,  14116,  13857,  13623,  13359,  13133,  12863,  12648,  12372,  12165,  11883,  11686,  11397,
+     11209,  10913,  10735,  10431,  10263,   9952,   9794,   9473,   9326,   8996,   8861,   8521,   8397,   8046,   7935,   7571,
+      7474,   7097,   7015,   6623,   6558,   6149,   6103,   5674,   5649,   5199,   5198,   4722,   4750,   4242,   4305,   3760,
+      3864,   3273,   3430,   2780,   3005,   2275,   2594,   1752,   2208,   1196,   1871,    566,   1654,   -279,   1890,  -2407,
+    
+    // Level 5: 64 samples, 31 harmonics
+     15067,  32545,  28729,  31179,  29389,  30486,  29110,  29611,  28394,  28558,  27432,  27386,  26332,  26151,  25163,  24893,
+     23968,  23639,  22774,  22403,  21597,  21197,  20445,  20023,  19324,  18883,  18232,  17774,  17169,  16694,  16132,  15640,
+     15118,  14609,  14125,  13595,  13149,  12598,  12189,  11612,  11241,  10636,  10304,   9667,   9377,   8703,   8458,   7741,
+      7549,   6778,   6649,   5812,   5760,   4837,   4888,   3846,   4042,   2822,   3246,   1726,   2572,    414,   2352,  -2185,
+    
+    // Level 6: 64 samples, 16 harmonics
+     15055,  28334,  32767,  30286,  28707,  30044,  30540,  28993,  28047,  28486,  28254,  26885,  26114,  26217,  25702,  24459,
+     23821,  23779,  23139,  22015,  21498,  21387,  20685,  19670,  19262,  19111,  18370,  17452,  17139,  16955,  16179,  15346,
+     15118,  14899,  14086,  13330,  13178,  12917,  12059,  11378,  11301,  10988,  10073,   9470,   9474,   9091,   8101,   7592,
+      7695,   7215,   6117,   5735,   5979,   5344,   4072,   3903,   4392,   3452,   1816,   2147,   3266,   1331,  -1733,   2063,
+    
+    // Level 7: 64 samples, 8 harmonics
+     15181,  22736,  28737,  32096,  32715,  31404,  29430,  27912,  27374,  27645,  28107,  28132,  27433,  26187,  24864,  23917,
+     23516,  23477,  23411,  22981,  22106,  20993,  19990,  19362,  19125,  19052,  18825,  18241,  17335,  16354,  15594,  15205,
+     15102,  15016,  14670,  13961,  13023,  12145,  11587,  11404,  11408,  11282,  10784,   9909,   8905,   8124,   7792,   7851,
+      7974,   7761,   6999,   5828,   4687,   4058,   4145,   4689,   5056,   4588,   3041,    878,   -803,   -685,   2159,   7771,
+    
+    // Level 8: 64 samples, 4 harmonics
+     15456,  19455,  23219,  26497,  29087,  30864,  31785,  31896,  31315,  30217,  28809,  27298,  25870,  24666,  23768,  23195,
+     22909,  22824,  22830,  22808,  22655,  22300,  21712,  20906,  19935,  18883,  17844,  16910,  16151,  15605,  15272,  15114,
+     15059,  15022,  14912,  14654,  14199,  13537,  12695,  11737,  10750,   9831,   9068,   8525,   8228,   8158,   8251,   8410,
+      8514,   8445,   8103,   7430,   6423,   5143,   3714,   2307,   1129,    391,    283,    947,   2455,   4796,   7871,  11504,
+    
+    // Level 9: 64 samples, 2 harmonics
+     15817,  17878,  19895,  21819,  23605,  25212,  26604,  27754,  28640,  29249,  29578,  29630,  29418,  28962,  28288,  27428,
+     26419,  25299,  24109,  22890,  21679,  20512,  19421,  18430,  17559,  16821,  16221,  15757,  15422,  15200,  15072,  15013,
+     14996,  14992,  14971,  14904,  14766,  14534,  14190,  13723,  13128,  12405,  11564,  10620,   9595,   8516,   7417,   6333,
+      5302,   4365,   3559,   2921,   2484,   2276,   2319,   2627,   3207,   4059,   5171,   6527,   8099,   9856,  11757,  13760,
+    
+    // Level 10: 64 samples, 1 harmonics
+     16044,  17077,  18096,  19091,  20053,  20972,  21841,  22649,  23389,  24056,  24640,  25139,  25545,  25856,  26069,  26181,
+     26192,  26101,  25909,  25618,  25231,  24752,  24185,  23535,  22809,  22015,  21158,  20249,  19295,  18306,  17291,  16260,
+     15223,  14190,  13171,  12176,  11214,  10295,   9427,   8618,   7878,   7212,   6627,   6128,   5722,   5411,   5198,   5086,
+      5075,   5166,   5358,   5649,   6036,   6515,   7082,   7732,   8458,   9252,  10109,  11018,  11972,  12961,  13976,  15007,
     
 };
 
-alignas(4) const float waveform_Glass[4096] = {
-    0.00000000f, 0.00527874f, 0.01055712f, 0.01583476f, 0.02111132f, 0.02638641f, 0.03165968f, 0.03693077f,
-    0.04219930f, 0.04746492f, 0.05272726f, 0.05798596f, 0.06324066f, 0.06849099f, 0.07373660f, 0.07897712f,
-    0.08421220f, 0.08944146f, 0.09466456f, 0.09988114f, 0.10509084f, 0.11029330f, 0.11548817f, 0.12067509f,
-    0.12585371f, 0.13102367f, 0.13618463f, 0.14133624f, 0.14647813f, 0.15160998f, 0.15673142f, 0.16184212f,
-    0.16694172f, 0.17202989f, 0.17710628f, 0.18217055f, 0.18722237f, 0.19226140f, 0.19728729f, 0.20229972f,
-    0.20729835f, 0.21228286f, 0.21725291f, 0.22220817f, 0.22714832f, 0.23207303f, 0.23698199f, 0.24187486f,
-    0.24675134f, 0.25161111f, 0.25645385f, 0.26127925f, 0.26608699f, 0.27087678f, 0.27564830f, 0.28040125f,
-    0.28513533f, 0.28985024f, 0.29454568f, 0.29922135f, 0.30387697f, 0.30851225f, 0.31312688f, 0.31772060f,
-    0.32229312f, 0.32684415f, 0.33137342f, 0.33588065f, 0.34036558f, 0.34482792f, 0.34926742f, 0.35368381f,
-    0.35807683f, 0.36244621f, 0.36679171f, 0.37111306f, 0.37541002f, 0.37968234f, 0.38392977f, 0.38815208f,
-    0.39234902f, 0.39652036f, 0.40066586f, 0.40478530f, 0.40887844f, 0.41294507f, 0.41698496f, 0.42099790f,
-    0.42498367f, 0.42894205f, 0.43287285f, 0.43677586f, 0.44065087f, 0.44449769f, 0.44831612f, 0.45210597f,
-    0.45586706f, 0.45959919f, 0.46330218f, 0.46697587f, 0.47062006f, 0.47423460f, 0.47781931f, 0.48137403f,
-    0.48489860f, 0.48839285f, 0.49185664f, 0.49528982f, 0.49869224f, 0.50206375f, 0.50540421f, 0.50871350f,
-    0.51199146f, 0.51523799f, 0.51845295f, 0.52163622f, 0.52478768f, 0.52790721f, 0.53099471f, 0.53405007f,
-    0.53707318f, 0.54006395f, 0.54302228f, 0.54594807f, 0.54884124f, 0.55170170f, 0.55452937f, 0.55732418f,
-    0.56008604f, 0.56281489f, 0.56551066f, 0.56817329f, 0.57080272f, 0.57339889f, 0.57596175f, 0.57849126f,
-    0.58098737f, 0.58345004f, 0.58587923f, 0.58827492f, 0.59063706f, 0.59296563f, 0.59526062f, 0.59752201f,
-    0.59974977f, 0.60194391f, 0.60410441f, 0.60623126f, 0.60832448f, 0.61038406f, 0.61241002f, 0.61440236f,
-    0.61636109f, 0.61828624f, 0.62017784f, 0.62203590f, 0.62386045f, 0.62565154f, 0.62740919f, 0.62913345f,
-    0.63082436f, 0.63248196f, 0.63410632f, 0.63569748f, 0.63725551f, 0.63878046f, 0.64027241f, 0.64173141f,
-    0.64315755f, 0.64455089f, 0.64591152f, 0.64723953f, 0.64853499f, 0.64979800f, 0.65102864f, 0.65222703f,
-    0.65339325f, 0.65452741f, 0.65562961f, 0.65669997f, 0.65773860f, 0.65874562f, 0.65972113f, 0.66066528f,
-    0.66157817f, 0.66245995f, 0.66331074f, 0.66413069f, 0.66491991f, 0.66567857f, 0.66640680f, 0.66710475f,
-    0.66777257f, 0.66841042f, 0.66901844f, 0.66959681f, 0.67014568f, 0.67066522f, 0.67115559f, 0.67161697f,
-    0.67204952f, 0.67245343f, 0.67282888f, 0.67317604f, 0.67349511f, 0.67378625f, 0.67404968f, 0.67428557f,
-    0.67449413f, 0.67467555f, 0.67483003f, 0.67495776f, 0.67505897f, 0.67513385f, 0.67518261f, 0.67520546f,
-    0.67520262f, 0.67517431f, 0.67512073f, 0.67504212f, 0.67493869f, 0.67481067f, 0.67465829f, 0.67448177f,
-    0.67428134f, 0.67405725f, 0.67380971f, 0.67353898f, 0.67324528f, 0.67292886f, 0.67258996f, 0.67222883f,
-    0.67184570f, 0.67144083f, 0.67101446f, 0.67056685f, 0.67009825f, 0.66960891f, 0.66909908f, 0.66856903f,
-    0.66801901f, 0.66744928f, 0.66686010f, 0.66625173f, 0.66562443f, 0.66497848f, 0.66431413f, 0.66363165f,
-    0.66293131f, 0.66221339f, 0.66147814f, 0.66072584f, 0.65995676f, 0.65917118f, 0.65836936f, 0.65755159f,
-    0.65671813f, 0.65586927f, 0.65500528f, 0.65412644f, 0.65323302f, 0.65232531f, 0.65140358f, 0.65046811f,
-    0.64951919f, 0.64855709f, 0.64758210f, 0.64659450f, 0.64559456f, 0.64458257f, 0.64355881f, 0.64252357f,
-    0.64147713f, 0.64041976f, 0.63935176f, 0.63827340f, 0.63718497f, 0.63608675f, 0.63497903f, 0.63386208f,
-    0.63273618f, 0.63160163f, 0.63045870f, 0.62930767f, 0.62814883f, 0.62698245f, 0.62580882f, 0.62462821f,
-    0.62344091f, 0.62224719f, 0.62104734f, 0.61984163f, 0.61863034f, 0.61741374f, 0.61619211f, 0.61496573f,
-    0.61373488f, 0.61249981f, 0.61126082f, 0.61001816f, 0.60877211f, 0.60752295f, 0.60627093f, 0.60501633f,
-    0.60375942f, 0.60250045f, 0.60123970f, 0.59997743f, 0.59871390f, 0.59744938f, 0.59618411f, 0.59491837f,
-    0.59365240f, 0.59238647f, 0.59112083f, 0.58985573f, 0.58859142f, 0.58732815f, 0.58606618f, 0.58480574f,
-    0.58354709f, 0.58229046f, 0.58103611f, 0.57978426f, 0.57853516f, 0.57728905f, 0.57604616f, 0.57480673f,
-    0.57357097f, 0.57233914f, 0.57111145f, 0.56988812f, 0.56866939f, 0.56745548f, 0.56624659f, 0.56504297f,
-    0.56384480f, 0.56265233f, 0.56146574f, 0.56028526f, 0.55911109f, 0.55794343f, 0.55678249f, 0.55562848f,
-    0.55448158f, 0.55334199f, 0.55220991f, 0.55108554f, 0.54996905f, 0.54886063f, 0.54776048f, 0.54666877f,
-    0.54558568f, 0.54451140f, 0.54344608f, 0.54238991f, 0.54134306f, 0.54030570f, 0.53927798f, 0.53826007f,
-    0.53725214f, 0.53625433f, 0.53526680f, 0.53428971f, 0.53332320f, 0.53236742f, 0.53142252f, 0.53048863f,
-    0.52956589f, 0.52865445f, 0.52775442f, 0.52686595f, 0.52598916f, 0.52512418f, 0.52427113f, 0.52343012f,
-    0.52260128f, 0.52178471f, 0.52098054f, 0.52018886f, 0.51940979f, 0.51864343f, 0.51788986f, 0.51714921f,
-    0.51642155f, 0.51570697f, 0.51500558f, 0.51431745f, 0.51364266f, 0.51298130f, 0.51233344f, 0.51169916f,
-    0.51107852f, 0.51047161f, 0.50987847f, 0.50929918f, 0.50873380f, 0.50818237f, 0.50764496f, 0.50712162f,
-    0.50661240f, 0.50611733f, 0.50563647f, 0.50516985f, 0.50471752f, 0.50427949f, 0.50385581f, 0.50344651f,
-    0.50305160f, 0.50267112f, 0.50230507f, 0.50195349f, 0.50161637f, 0.50129375f, 0.50098561f, 0.50069197f,
-    0.50041283f, 0.50014819f, 0.49989805f, 0.49966240f, 0.49944124f, 0.49923455f, 0.49904231f, 0.49886453f,
-    0.49870116f, 0.49855220f, 0.49841761f, 0.49829738f, 0.49819146f, 0.49809983f, 0.49802246f, 0.49795930f,
-    0.49791031f, 0.49787545f, 0.49785468f, 0.49784795f, 0.49785520f, 0.49787639f, 0.49791145f, 0.49796033f,
-    0.49802297f, 0.49809930f, 0.49818926f, 0.49829279f, 0.49840980f, 0.49854023f, 0.49868400f, 0.49884104f,
-    0.49901126f, 0.49919458f, 0.49939092f, 0.49960019f, 0.49982231f, 0.50005717f, 0.50030469f, 0.50056477f,
-    0.50083731f, 0.50112221f, 0.50141938f, 0.50172870f, 0.50205007f, 0.50238339f, 0.50272853f, 0.50308540f,
-    0.50345387f, 0.50383383f, 0.50422516f, 0.50462774f, 0.50504145f, 0.50546617f, 0.50590177f, 0.50634812f,
-    0.50680509f, 0.50727255f, 0.50775038f, 0.50823843f, 0.50873657f, 0.50924467f, 0.50976258f, 0.51029016f,
-    0.51082728f, 0.51137378f, 0.51192953f, 0.51249438f, 0.51306817f, 0.51365076f, 0.51424201f, 0.51484175f,
-    0.51544983f, 0.51606611f, 0.51669042f, 0.51732261f, 0.51796251f, 0.51860998f, 0.51926485f, 0.51992696f,
-    0.52059614f, 0.52127224f, 0.52195509f, 0.52264452f, 0.52334036f, 0.52404246f, 0.52475065f, 0.52546474f,
-    0.52618458f, 0.52691000f, 0.52764082f, 0.52837687f, 0.52911798f, 0.52986397f, 0.53061468f, 0.53136993f,
-    0.53212955f, 0.53289335f, 0.53366117f, 0.53443282f, 0.53520814f, 0.53598694f, 0.53676905f, 0.53755429f,
-    0.53834249f, 0.53913346f, 0.53992702f, 0.54072301f, 0.54152124f, 0.54232153f, 0.54312370f, 0.54392758f,
-    0.54473298f, 0.54553973f, 0.54634766f, 0.54715657f, 0.54796630f, 0.54877667f, 0.54958749f, 0.55039859f,
-    0.55120980f, 0.55202093f, 0.55283181f, 0.55364226f, 0.55445211f, 0.55526118f, 0.55606929f, 0.55687628f,
-    0.55768196f, 0.55848617f, 0.55928872f, 0.56008946f, 0.56088820f, 0.56168477f, 0.56247901f, 0.56327075f,
-    0.56405980f, 0.56484602f, 0.56562922f, 0.56640925f, 0.56718594f, 0.56795912f, 0.56872862f, 0.56949429f,
-    0.57025597f, 0.57101349f, 0.57176669f, 0.57251541f, 0.57325950f, 0.57399880f, 0.57473315f, 0.57546240f,
-    0.57618639f, 0.57690498f, 0.57761802f, 0.57832534f, 0.57902681f, 0.57972228f, 0.58041160f, 0.58109464f,
-    0.58177123f, 0.58244125f, 0.58310456f, 0.58376101f, 0.58441047f, 0.58505281f, 0.58568789f, 0.58631557f,
-    0.58693573f, 0.58754824f, 0.58815296f, 0.58874979f, 0.58933858f, 0.58991922f, 0.59049158f, 0.59105556f,
-    0.59161102f, 0.59215785f, 0.59269595f, 0.59322520f, 0.59374548f, 0.59425669f, 0.59475873f, 0.59525148f,
-    0.59573485f, 0.59620873f, 0.59667303f, 0.59712764f, 0.59757248f, 0.59800745f, 0.59843245f, 0.59884741f,
-    0.59925223f, 0.59964682f, 0.60003111f, 0.60040501f, 0.60076844f, 0.60112132f, 0.60146359f, 0.60179517f,
-    0.60211598f, 0.60242596f, 0.60272504f, 0.60301316f, 0.60329026f, 0.60355627f, 0.60381113f, 0.60405480f,
-    0.60428721f, 0.60450832f, 0.60471807f, 0.60491642f, 0.60510333f, 0.60527874f, 0.60544263f, 0.60559495f,
-    0.60573566f, 0.60586473f, 0.60598214f, 0.60608784f, 0.60618182f, 0.60626404f, 0.60633449f, 0.60639314f,
-    0.60643997f, 0.60647498f, 0.60649814f, 0.60650944f, 0.60650888f, 0.60649645f, 0.60647213f, 0.60643594f,
-    0.60638786f, 0.60632790f, 0.60625606f, 0.60617236f, 0.60607679f, 0.60596937f, 0.60585011f, 0.60571903f,
-    0.60557614f, 0.60542146f, 0.60525501f, 0.60507682f, 0.60488691f, 0.60468532f, 0.60447206f, 0.60424718f,
-    0.60401070f, 0.60376267f, 0.60350311f, 0.60323208f, 0.60294962f, 0.60265577f, 0.60235057f, 0.60203408f,
-    0.60170634f, 0.60136742f, 0.60101736f, 0.60065623f, 0.60028407f, 0.59990096f, 0.59950696f, 0.59910212f,
-    0.59868653f, 0.59826024f, 0.59782333f, 0.59737587f, 0.59691793f, 0.59644960f, 0.59597095f, 0.59548206f,
-    0.59498301f, 0.59447389f, 0.59395478f, 0.59342577f, 0.59288695f, 0.59233841f, 0.59178024f, 0.59121254f,
-    0.59063541f, 0.59004893f, 0.58945321f, 0.58884836f, 0.58823447f, 0.58761165f, 0.58698000f, 0.58633963f,
-    0.58569066f, 0.58503318f, 0.58436731f, 0.58369317f, 0.58301087f, 0.58232053f, 0.58162225f, 0.58091617f,
-    0.58020240f, 0.57948107f, 0.57875229f, 0.57801619f, 0.57727289f, 0.57652253f, 0.57576522f, 0.57500111f,
-    0.57423031f, 0.57345296f, 0.57266919f, 0.57187913f, 0.57108292f, 0.57028069f, 0.56947259f, 0.56865874f,
-    0.56783928f, 0.56701436f, 0.56618410f, 0.56534867f, 0.56450819f, 0.56366280f, 0.56281266f, 0.56195790f,
-    0.56109867f, 0.56023511f, 0.55936737f, 0.55849560f, 0.55761994f, 0.55674054f, 0.55585755f, 0.55497111f,
-    0.55408139f, 0.55318852f, 0.55229265f, 0.55139394f, 0.55049254f, 0.54958859f, 0.54868226f, 0.54777368f,
-    0.54686302f, 0.54595043f, 0.54503605f, 0.54412004f, 0.54320255f, 0.54228374f, 0.54136375f, 0.54044275f,
-    0.53952088f, 0.53859830f, 0.53767515f, 0.53675160f, 0.53582779f, 0.53490387f, 0.53398001f, 0.53305635f,
-    0.53213304f, 0.53121023f, 0.53028808f, 0.52936674f, 0.52844635f, 0.52752707f, 0.52660905f, 0.52569243f,
-    0.52477737f, 0.52386402f, 0.52295252f, 0.52204302f, 0.52113566f, 0.52023060f, 0.51932797f, 0.51842793f,
-    0.51753062f, 0.51663618f, 0.51574476f, 0.51485649f, 0.51397151f, 0.51308998f, 0.51221202f, 0.51133778f,
-    0.51046740f, 0.50960101f, 0.50873874f, 0.50788073f, 0.50702713f, 0.50617805f, 0.50533363f, 0.50449400f,
-    0.50365929f, 0.50282964f, 0.50200516f, 0.50118598f, 0.50037223f, 0.49956403f, 0.49876151f, 0.49796478f,
-    0.49717397f, 0.49638918f, 0.49561055f, 0.49483819f, 0.49407220f, 0.49331271f, 0.49255982f, 0.49181365f,
-    0.49107430f, 0.49034188f, 0.48961649f, 0.48889825f, 0.48818724f, 0.48748357f, 0.48678735f, 0.48609866f,
-    0.48541761f, 0.48474429f, 0.48407878f, 0.48342118f, 0.48277159f, 0.48213008f, 0.48149674f, 0.48087165f,
-    0.48025490f, 0.47964657f, 0.47904673f, 0.47845547f, 0.47787284f, 0.47729894f, 0.47673382f, 0.47617756f,
-    0.47563022f, 0.47509186f, 0.47456256f, 0.47404236f, 0.47353134f, 0.47302953f, 0.47253701f, 0.47205382f,
-    0.47158002f, 0.47111564f, 0.47066075f, 0.47021537f, 0.46977956f, 0.46935336f, 0.46893679f, 0.46852991f,
-    0.46813273f, 0.46774530f, 0.46736764f, 0.46699978f, 0.46664175f, 0.46629357f, 0.46595525f, 0.46562682f,
-    0.46530830f, 0.46499969f, 0.46470101f, 0.46441228f, 0.46413349f, 0.46386465f, 0.46360577f, 0.46335684f,
-    0.46311787f, 0.46288885f, 0.46266978f, 0.46246064f, 0.46226144f, 0.46207214f, 0.46189275f, 0.46172324f,
-    0.46156360f, 0.46141380f, 0.46127381f, 0.46114362f, 0.46102320f, 0.46091251f, 0.46081152f, 0.46072020f,
-    0.46063851f, 0.46056641f, 0.46050386f, 0.46045081f, 0.46040723f, 0.46037306f, 0.46034825f, 0.46033275f,
-    0.46032650f, 0.46032945f, 0.46034154f, 0.46036271f, 0.46039289f, 0.46043202f, 0.46048003f, 0.46053686f,
-    0.46060243f, 0.46067666f, 0.46075948f, 0.46085082f, 0.46095058f, 0.46105870f, 0.46117509f, 0.46129965f,
-    0.46143231f, 0.46157297f, 0.46172153f, 0.46187792f, 0.46204202f, 0.46221374f, 0.46239299f, 0.46257965f,
-    0.46277363f, 0.46297481f, 0.46318310f, 0.46339838f, 0.46362055f, 0.46384948f, 0.46408506f, 0.46432718f,
-    0.46457572f, 0.46483056f, 0.46509157f, 0.46535863f, 0.46563162f, 0.46591041f, 0.46619488f, 0.46648488f,
-    0.46678029f, 0.46708098f, 0.46738681f, 0.46769765f, 0.46801335f, 0.46833377f, 0.46865879f, 0.46898824f,
-    0.46932200f, 0.46965991f, 0.47000183f, 0.47034761f, 0.47069709f, 0.47105014f, 0.47140660f, 0.47176631f,
-    0.47212912f, 0.47249488f, 0.47286342f, 0.47323459f, 0.47360824f, 0.47398420f, 0.47436230f, 0.47474240f,
-    0.47512432f, 0.47550790f, 0.47589297f, 0.47627938f, 0.47666695f, 0.47705551f, 0.47744490f, 0.47783494f,
-    0.47822547f, 0.47861632f, 0.47900731f, 0.47939827f, 0.47978903f, 0.48017941f, 0.48056925f, 0.48095836f,
-    0.48134656f, 0.48173370f, 0.48211958f, 0.48250403f, 0.48288687f, 0.48326793f, 0.48364703f, 0.48402399f,
-    0.48439863f, 0.48477077f, 0.48514023f, 0.48550684f, 0.48587041f, 0.48623077f, 0.48658773f, 0.48694112f,
-    0.48729075f, 0.48763644f, 0.48797803f, 0.48831532f, 0.48864813f, 0.48897630f, 0.48929963f, 0.48961795f,
-    0.48993107f, 0.49023884f, 0.49054105f, 0.49083754f, 0.49112812f, 0.49141263f, 0.49169087f, 0.49196269f,
-    0.49222790f, 0.49248632f, 0.49273778f, 0.49298211f, 0.49321913f, 0.49344867f, 0.49367056f, 0.49388462f,
-    0.49409069f, 0.49428859f, 0.49447816f, 0.49465923f, 0.49483163f, 0.49499519f, 0.49514975f, 0.49529514f,
-    0.49543120f, 0.49555777f, 0.49567468f, 0.49578178f, 0.49587891f, 0.49596590f, 0.49604260f, 0.49610885f,
-    0.49616451f, 0.49620941f, 0.49624341f, 0.49626635f, 0.49627809f, 0.49627847f, 0.49626736f, 0.49624460f,
-    0.49621005f, 0.49616358f, 0.49610503f, 0.49603428f, 0.49595119f, 0.49585561f, 0.49574742f, 0.49562648f,
-    0.49549266f, 0.49534584f, 0.49518589f, 0.49501268f, 0.49482608f, 0.49462599f, 0.49441227f, 0.49418482f,
-    0.49394351f, 0.49368823f, 0.49341888f, 0.49313533f, 0.49283749f, 0.49252524f, 0.49219849f, 0.49185713f,
-    0.49150106f, 0.49113019f, 0.49074441f, 0.49034365f, 0.48992781f, 0.48949679f, 0.48905052f, 0.48858891f,
-    0.48811188f, 0.48761934f, 0.48711123f, 0.48658747f, 0.48604799f, 0.48549271f, 0.48492157f, 0.48433451f,
-    0.48373146f, 0.48311237f, 0.48247717f, 0.48182581f, 0.48115825f, 0.48047442f, 0.47977429f, 0.47905780f,
-    0.47832492f, 0.47757561f, 0.47680984f, 0.47602756f, 0.47522874f, 0.47441336f, 0.47358140f, 0.47273282f,
-    0.47186761f, 0.47098575f, 0.47008723f, 0.46917203f, 0.46824014f, 0.46729156f, 0.46632628f, 0.46534430f,
-    0.46434562f, 0.46333026f, 0.46229820f, 0.46124947f, 0.46018408f, 0.45910204f, 0.45800338f, 0.45688810f,
-    0.45575624f, 0.45460783f, 0.45344289f, 0.45226146f, 0.45106357f, 0.44984926f, 0.44861857f, 0.44737155f,
-    0.44610824f, 0.44482870f, 0.44353297f, 0.44222112f, 0.44089319f, 0.43954926f, 0.43818939f, 0.43681364f,
-    0.43542208f, 0.43401479f, 0.43259184f, 0.43115332f, 0.42969930f, 0.42822987f, 0.42674511f, 0.42524512f,
-    0.42372999f, 0.42219981f, 0.42065469f, 0.41909472f, 0.41752001f, 0.41593067f, 0.41432680f, 0.41270853f,
-    0.41107596f, 0.40942921f, 0.40776841f, 0.40609367f, 0.40440514f, 0.40270292f, 0.40098717f, 0.39925800f,
-    0.39751557f, 0.39576000f, 0.39399145f, 0.39221005f, 0.39041596f, 0.38860933f, 0.38679031f, 0.38495906f,
-    0.38311573f, 0.38126049f, 0.37939350f, 0.37751492f, 0.37562493f, 0.37372370f, 0.37181141f, 0.36988821f,
-    0.36795431f, 0.36600987f, 0.36405509f, 0.36209014f, 0.36011521f, 0.35813051f, 0.35613621f, 0.35413252f,
-    0.35211963f, 0.35009774f, 0.34806706f, 0.34602779f, 0.34398013f, 0.34192430f, 0.33986050f, 0.33778895f,
-    0.33570986f, 0.33362345f, 0.33152995f, 0.32942956f, 0.32732251f, 0.32520904f, 0.32308936f, 0.32096371f,
-    0.31883231f, 0.31669540f, 0.31455321f, 0.31240598f, 0.31025394f, 0.30809735f, 0.30593643f, 0.30377143f,
-    0.30160260f, 0.29943018f, 0.29725443f, 0.29507558f, 0.29289389f, 0.29070961f, 0.28852300f, 0.28633432f,
-    0.28414381f, 0.28195174f, 0.27975837f, 0.27756395f, 0.27536875f, 0.27317303f, 0.27097706f, 0.26878110f,
-    0.26658542f, 0.26439029f, 0.26219597f, 0.26000273f, 0.25781085f, 0.25562059f, 0.25343223f, 0.25124605f,
-    0.24906231f, 0.24688129f, 0.24470327f, 0.24252852f, 0.24035732f, 0.23818994f, 0.23602667f, 0.23386779f,
-    0.23171357f, 0.22956430f, 0.22742024f, 0.22528170f, 0.22314894f, 0.22102224f, 0.21890189f, 0.21678818f,
-    0.21468137f, 0.21258176f, 0.21048963f, 0.20840526f, 0.20632893f, 0.20426093f, 0.20220153f, 0.20015102f,
-    0.19810969f, 0.19607781f, 0.19405567f, 0.19204354f, 0.19004172f, 0.18805048f, 0.18607010f, 0.18410086f,
-    0.18214305f, 0.18019694f, 0.17826281f, 0.17634095f, 0.17443162f, 0.17253511f, 0.17065169f, 0.16878164f,
-    0.16692524f, 0.16508275f, 0.16325446f, 0.16144064f, 0.15964155f, 0.15785748f, 0.15608868f, 0.15433543f,
-    0.15259800f, 0.15087665f, 0.14917165f, 0.14748327f, 0.14581176f, 0.14415739f, 0.14252043f, 0.14090112f,
-    0.13929973f, 0.13771652f, 0.13615174f, 0.13460564f, 0.13307848f, 0.13157051f, 0.13008198f, 0.12861313f,
-    0.12716421f, 0.12573546f, 0.12432714f, 0.12293947f, 0.12157270f, 0.12022706f, 0.11890279f, 0.11760013f,
-    0.11631930f, 0.11506053f, 0.11382406f, 0.11261010f, 0.11141887f, 0.11025061f, 0.10910553f, 0.10798384f,
-    0.10688577f, 0.10581151f, 0.10476129f, 0.10373531f, 0.10273377f, 0.10175688f, 0.10080483f, 0.09987784f,
-    0.09897608f, 0.09809976f, 0.09724906f, 0.09642417f, 0.09562528f, 0.09485257f, 0.09410622f, 0.09338641f,
-    0.09269330f, 0.09202708f, 0.09138791f, 0.09077595f, 0.09019138f, 0.08963435f, 0.08910501f, 0.08860353f,
-    0.08813005f, 0.08768472f, 0.08726769f, 0.08687910f, 0.08651909f, 0.08618780f, 0.08588535f, 0.08561189f,
-    0.08536753f, 0.08515240f, 0.08496662f, 0.08481031f, 0.08468358f, 0.08458655f, 0.08451932f, 0.08448199f,
-    0.08447467f, 0.08449746f, 0.08455044f, 0.08463371f, 0.08474736f, 0.08489148f, 0.08506613f, 0.08527140f,
-    0.08550737f, 0.08577410f, 0.08607167f, 0.08640012f, 0.08675953f, 0.08714996f, 0.08757144f, 0.08802404f,
-    0.08850780f, 0.08902276f, 0.08956896f, 0.09014643f, 0.09075521f, 0.09139532f, 0.09206679f, 0.09276963f,
-    0.09350388f, 0.09426953f, 0.09506659f, 0.09589508f, 0.09675500f, 0.09764634f, 0.09856910f, 0.09952327f,
-    0.10050884f, 0.10152578f, 0.10257409f, 0.10365374f, 0.10476469f, 0.10590692f, 0.10708040f, 0.10828508f,
-    0.10952093f, 0.11078789f, 0.11208592f, 0.11341496f, 0.11477496f, 0.11616585f, 0.11758757f, 0.11904006f,
-    0.12052324f, 0.12203703f, 0.12358135f, 0.12515613f, 0.12676128f, 0.12839669f, 0.13006229f, 0.13175798f,
-    0.13348364f, 0.13523918f, 0.13702448f, 0.13883945f, 0.14068395f, 0.14255786f, 0.14446108f, 0.14639346f,
-    0.14835489f, 0.15034521f, 0.15236431f, 0.15441203f, 0.15648823f, 0.15859277f, 0.16072548f, 0.16288623f,
-    0.16507484f, 0.16729115f, 0.16953501f, 0.17180623f, 0.17410466f, 0.17643011f, 0.17878240f, 0.18116135f,
-    0.18356678f, 0.18599850f, 0.18845631f, 0.19094001f, 0.19344942f, 0.19598432f, 0.19854452f, 0.20112979f,
-    0.20373994f, 0.20637475f, 0.20903399f, 0.21171745f, 0.21442490f, 0.21715612f, 0.21991088f, 0.22268893f,
-    0.22549005f, 0.22831400f, 0.23116054f, 0.23402941f, 0.23692037f, 0.23983318f, 0.24276757f, 0.24572330f,
-    0.24870009f, 0.25169770f, 0.25471586f, 0.25775429f, 0.26081273f, 0.26389091f, 0.26698855f, 0.27010538f,
-    0.27324111f, 0.27639546f, 0.27956815f, 0.28275889f, 0.28596739f, 0.28919336f, 0.29243651f, 0.29569653f,
-    0.29897314f, 0.30226602f, 0.30557488f, 0.30889941f, 0.31223930f, 0.31559424f, 0.31896393f, 0.32234805f,
-    0.32574628f, 0.32915831f, 0.33258381f, 0.33602247f, 0.33947397f, 0.34293797f, 0.34641416f, 0.34990221f,
-    0.35340178f, 0.35691255f, 0.36043418f, 0.36396633f, 0.36750868f, 0.37106089f, 0.37462261f, 0.37819352f,
-    0.38177325f, 0.38536149f, 0.38895787f, 0.39256206f, 0.39617371f, 0.39979247f, 0.40341800f, 0.40704994f,
-    0.41068795f, 0.41433167f, 0.41798076f, 0.42163485f, 0.42529360f, 0.42895666f, 0.43262366f, 0.43629425f,
-    0.43996807f, 0.44364478f, 0.44732400f, 0.45100538f, 0.45468857f, 0.45837320f, 0.46205892f, 0.46574536f,
-    0.46943217f, 0.47311898f, 0.47680544f, 0.48049118f, 0.48417584f, 0.48785907f, 0.49154049f, 0.49521976f,
-    0.49889651f, 0.50257038f, 0.50624100f, 0.50990803f, 0.51357109f, 0.51722983f, 0.52088389f, 0.52453291f,
-    0.52817654f, 0.53181440f, 0.53544615f, 0.53907143f, 0.54268988f, 0.54630115f, 0.54990488f, 0.55350071f,
-    0.55708829f, 0.56066727f, 0.56423730f, 0.56779803f, 0.57134910f, 0.57489016f, 0.57842087f, 0.58194088f,
-    0.58544984f, 0.58894741f, 0.59243324f, 0.59590700f, 0.59936833f, 0.60281691f, 0.60625238f, 0.60967442f,
-    0.61308268f, 0.61647684f, 0.61985655f, 0.62322150f, 0.62657134f, 0.62990575f, 0.63322440f, 0.63652697f,
-    0.63981314f, 0.64308258f, 0.64633497f, 0.64957000f, 0.65278735f, 0.65598670f, 0.65916775f, 0.66233019f,
-    0.66547369f, 0.66859797f, 0.67170272f, 0.67478763f, 0.67785241f, 0.68089676f, 0.68392038f, 0.68692298f,
-    0.68990427f, 0.69286397f, 0.69580178f, 0.69871743f, 0.70161064f, 0.70448111f, 0.70732859f, 0.71015280f,
-    0.71295346f, 0.71573032f, 0.71848309f, 0.72121153f, 0.72391537f, 0.72659436f, 0.72924824f, 0.73187675f,
-    0.73447966f, 0.73705671f, 0.73960767f, 0.74213228f, 0.74463033f, 0.74710156f, 0.74954575f, 0.75196268f,
-    0.75435212f, 0.75671384f, 0.75904763f, 0.76135327f, 0.76363055f, 0.76587926f, 0.76809919f, 0.77029015f,
-    0.77245192f, 0.77458433f, 0.77668716f, 0.77876024f, 0.78080337f, 0.78281637f, 0.78479907f, 0.78675128f,
-    0.78867284f, 0.79056357f, 0.79242332f, 0.79425190f, 0.79604917f, 0.79781498f, 0.79954916f, 0.80125157f,
-    0.80292207f, 0.80456051f, 0.80616675f, 0.80774067f, 0.80928212f, 0.81079099f, 0.81226715f, 0.81371048f,
-    0.81512085f, 0.81649817f, 0.81784232f, 0.81915320f, 0.82043070f, 0.82167472f, 0.82288517f, 0.82406197f,
-    0.82520502f, 0.82631424f, 0.82738955f, 0.82843087f, 0.82943814f, 0.83041128f, 0.83135023f, 0.83225493f,
-    0.83312532f, 0.83396135f, 0.83476297f, 0.83553013f, 0.83626279f, 0.83696091f, 0.83762446f, 0.83825341f,
-    0.83884772f, 0.83940738f, 0.83993237f, 0.84042266f, 0.84087826f, 0.84129914f, 0.84168531f, 0.84203675f,
-    0.84235349f, 0.84263552f, 0.84288284f, 0.84309549f, 0.84327347f, 0.84341680f, 0.84352551f, 0.84359963f,
-    0.84363919f, 0.84364423f, 0.84361478f, 0.84355088f, 0.84345260f, 0.84331996f, 0.84315304f, 0.84295188f,
-    0.84271655f, 0.84244712f, 0.84214364f, 0.84180619f, 0.84143485f, 0.84102970f, 0.84059081f, 0.84011828f,
-    0.83961219f, 0.83907263f, 0.83849971f, 0.83789351f, 0.83725415f, 0.83658172f, 0.83587635f, 0.83513813f,
-    0.83436719f, 0.83356365f, 0.83272762f, 0.83185924f, 0.83095863f, 0.83002593f, 0.82906127f, 0.82806479f,
-    0.82703662f, 0.82597693f, 0.82488584f, 0.82376352f, 0.82261012f, 0.82142580f, 0.82021070f, 0.81896501f,
-    0.81768888f, 0.81638248f, 0.81504598f, 0.81367956f, 0.81228340f, 0.81085767f, 0.80940255f, 0.80791824f,
-    0.80640493f, 0.80486279f, 0.80329203f, 0.80169283f, 0.80006541f, 0.79840996f, 0.79672669f, 0.79501579f,
-    0.79327748f, 0.79151198f, 0.78971949f, 0.78790022f, 0.78605441f, 0.78418226f, 0.78228400f, 0.78035986f,
-    0.77841006f, 0.77643483f, 0.77443441f, 0.77240902f, 0.77035891f, 0.76828430f, 0.76618544f, 0.76406257f,
-    0.76191594f, 0.75974578f, 0.75755235f, 0.75533590f, 0.75309667f, 0.75083492f, 0.74855090f, 0.74624486f,
-    0.74391707f, 0.74156779f, 0.73919726f, 0.73680577f, 0.73439356f, 0.73196090f, 0.72950806f, 0.72703532f,
-    0.72454292f, 0.72203116f, 0.71950029f, 0.71695059f, 0.71438233f, 0.71179579f, 0.70919125f, 0.70656897f,
-    0.70392925f, 0.70127235f, 0.69859856f, 0.69590816f, 0.69320143f, 0.69047865f, 0.68774010f, 0.68498607f,
-    0.68221685f, 0.67943271f, 0.67663394f, 0.67382084f, 0.67099368f, 0.66815276f, 0.66529835f, 0.66243076f,
-    0.65955026f, 0.65665715f, 0.65375171f, 0.65083424f, 0.64790503f, 0.64496435f, 0.64201251f, 0.63904980f,
-    0.63607649f, 0.63309289f, 0.63009928f, 0.62709595f, 0.62408320f, 0.62106131f, 0.61803056f, 0.61499126f,
-    0.61194368f, 0.60888812f, 0.60582487f, 0.60275421f, 0.59967643f, 0.59659181f, 0.59350065f, 0.59040322f,
-    0.58729982f, 0.58419073f, 0.58107623f, 0.57795660f, 0.57483214f, 0.57170311f, 0.56856980f, 0.56543249f,
-    0.56229147f, 0.55914700f, 0.55599936f, 0.55284884f, 0.54969570f, 0.54654022f, 0.54338268f, 0.54022335f,
-    0.53706249f, 0.53390038f, 0.53073728f, 0.52757346f, 0.52440920f, 0.52124474f, 0.51808036f, 0.51491632f,
-    0.51175288f, 0.50859029f, 0.50542882f, 0.50226871f, 0.49911023f, 0.49595363f, 0.49279916f, 0.48964706f,
-    0.48649759f, 0.48335098f, 0.48020750f, 0.47706737f, 0.47393084f, 0.47079814f, 0.46766953f, 0.46454521f,
-    0.46142545f, 0.45831045f, 0.45520046f, 0.45209570f, 0.44899639f, 0.44590276f, 0.44281504f, 0.43973343f,
-    0.43665815f, 0.43358943f, 0.43052747f, 0.42747248f, 0.42442467f, 0.42138425f, 0.41835142f, 0.41532638f,
-    0.41230933f, 0.40930047f, 0.40629999f, 0.40330809f, 0.40032495f, 0.39735075f, 0.39438570f, 0.39142996f,
-    0.38848371f, 0.38554714f, 0.38262042f, 0.37970372f, 0.37679721f, 0.37390106f, 0.37101543f, 0.36814048f,
-    0.36527637f, 0.36242327f, 0.35958132f, 0.35675067f, 0.35393147f, 0.35112388f, 0.34832803f, 0.34554406f,
-    0.34277211f, 0.34001231f, 0.33726481f, 0.33452972f, 0.33180718f, 0.32909731f, 0.32640023f, 0.32371605f,
-    0.32104490f, 0.31838689f, 0.31574212f, 0.31311071f, 0.31049275f, 0.30788836f, 0.30529762f, 0.30272064f,
-    0.30015751f, 0.29760831f, 0.29507314f, 0.29255208f, 0.29004521f, 0.28755260f, 0.28507435f, 0.28261051f,
-    0.28016116f, 0.27772636f, 0.27530618f, 0.27290069f, 0.27050993f, 0.26813397f, 0.26577286f, 0.26342664f,
-    0.26109537f, 0.25877908f, 0.25647783f, 0.25419164f, 0.25192056f, 0.24966462f, 0.24742384f, 0.24519825f,
-    0.24298788f, 0.24079275f, 0.23861288f, 0.23644828f, 0.23429896f, 0.23216494f, 0.23004623f, 0.22794282f,
-    0.22585472f, 0.22378193f, 0.22172444f, 0.21968225f, 0.21765535f, 0.21564373f, 0.21364736f, 0.21166624f,
-    0.20970035f, 0.20774966f, 0.20581414f, 0.20389377f, 0.20198851f, 0.20009834f, 0.19822322f, 0.19636311f,
-    0.19451796f, 0.19268774f, 0.19087239f, 0.18907188f, 0.18728614f, 0.18551513f, 0.18375878f, 0.18201704f,
-    0.18028986f, 0.17857715f, 0.17687887f, 0.17519493f, 0.17352527f, 0.17186982f, 0.17022851f, 0.16860124f,
-    0.16698795f, 0.16538855f, 0.16380296f, 0.16223108f, 0.16067284f, 0.15912814f, 0.15759689f, 0.15607899f,
-    0.15457434f, 0.15308285f, 0.15160442f, 0.15013893f, 0.14868630f, 0.14724640f, 0.14581912f, 0.14440437f,
-    0.14300202f, 0.14161196f, 0.14023407f, 0.13886824f, 0.13751433f, 0.13617224f, 0.13484184f, 0.13352300f,
-    0.13221559f, 0.13091949f, 0.12963456f, 0.12836067f, 0.12709770f, 0.12584549f, 0.12460393f, 0.12337286f,
-    0.12215214f, 0.12094165f, 0.11974123f, 0.11855074f, 0.11737004f, 0.11619898f, 0.11503741f, 0.11388518f,
-    0.11274214f, 0.11160814f, 0.11048303f, 0.10936666f, 0.10825886f, 0.10715949f, 0.10606839f, 0.10498540f,
-    0.10391035f, 0.10284310f, 0.10178348f, 0.10073133f, 0.09968648f, 0.09864878f, 0.09761806f, 0.09659415f,
-    0.09557690f, 0.09456612f, 0.09356167f, 0.09256337f, 0.09157105f, 0.09058454f, 0.08960369f, 0.08862830f,
-    0.08765823f, 0.08669329f, 0.08573332f, 0.08477815f, 0.08382760f, 0.08288151f, 0.08193969f, 0.08100199f,
-    0.08006823f, 0.07913823f, 0.07821183f, 0.07728885f, 0.07636911f, 0.07545246f, 0.07453871f, 0.07362769f,
-    0.07271924f, 0.07181317f, 0.07090932f, 0.07000751f, 0.06910758f, 0.06820935f, 0.06731265f, 0.06641731f,
-    0.06552316f, 0.06463002f, 0.06373774f, 0.06284614f, 0.06195506f, 0.06106431f, 0.06017374f, 0.05928319f,
-    0.05839247f, 0.05750143f, 0.05660990f, 0.05571772f, 0.05482472f, 0.05393074f, 0.05303562f, 0.05213919f,
-    0.05124130f, 0.05034178f, 0.04944048f, 0.04853724f, 0.04763189f, 0.04672429f, 0.04581428f, 0.04490170f,
-    0.04398640f, 0.04306823f, 0.04214704f, 0.04122268f, 0.04029500f, 0.03936384f, 0.03842908f, 0.03749055f,
-    0.03654811f, 0.03560164f, 0.03465097f, 0.03369597f, 0.03273651f, 0.03177244f, 0.03080364f, 0.02982996f,
-    0.02885127f, 0.02786744f, 0.02687835f, 0.02588386f, 0.02488384f, 0.02387817f, 0.02286673f, 0.02184939f,
-    0.02082604f, 0.01979655f, 0.01876081f, 0.01771870f, 0.01667011f, 0.01561493f, 0.01455304f, 0.01348434f,
-    0.01240871f, 0.01132606f, 0.01023629f, 0.00913928f, 0.00803494f, 0.00692317f, 0.00580389f, 0.00467698f,
-    0.00354237f, 0.00239995f, 0.00124965f, 0.00009137f, -0.00107496f, -0.00224943f, -0.00343213f, -0.00462312f,
-    -0.00582249f, -0.00703031f, -0.00824665f, -0.00947158f, -0.01070517f, -0.01194749f, -0.01319859f, -0.01445855f,
-    -0.01572742f, -0.01700526f, -0.01829212f, -0.01958806f, -0.02089312f, -0.02220737f, -0.02353084f, -0.02486357f,
-    -0.02620562f, -0.02755702f, -0.02891781f, -0.03028803f, -0.03166771f, -0.03305687f, -0.03445556f, -0.03586380f,
-    -0.03728161f, -0.03870901f, -0.04014604f, -0.04159269f, -0.04304900f, -0.04451497f, -0.04599062f, -0.04747596f,
-    -0.04897099f, -0.05047571f, -0.05199014f, -0.05351427f, -0.05504810f, -0.05659163f, -0.05814485f, -0.05970775f,
-    -0.06128033f, -0.06286256f, -0.06445444f, -0.06605595f, -0.06766707f, -0.06928777f, -0.07091804f, -0.07255785f,
-    -0.07420717f, -0.07586597f, -0.07753422f, -0.07921189f, -0.08089893f, -0.08259532f, -0.08430100f, -0.08601594f,
-    -0.08774009f, -0.08947341f, -0.09121585f, -0.09296735f, -0.09472787f, -0.09649734f, -0.09827571f, -0.10006293f,
-    -0.10185892f, -0.10366363f, -0.10547700f, -0.10729895f, -0.10912942f, -0.11096833f, -0.11281561f, -0.11467120f,
-    -0.11653500f, -0.11840695f, -0.12028696f, -0.12217495f, -0.12407084f, -0.12597454f, -0.12788596f, -0.12980501f,
-    -0.13173161f, -0.13366566f, -0.13560706f, -0.13755572f, -0.13951155f, -0.14147443f, -0.14344427f, -0.14542097f,
-    -0.14740443f, -0.14939453f, -0.15139117f, -0.15339424f, -0.15540362f, -0.15741922f, -0.15944090f, -0.16146857f,
-    -0.16350209f, -0.16554136f, -0.16758626f, -0.16963665f, -0.17169243f, -0.17375347f, -0.17581964f, -0.17789081f,
-    -0.17996687f, -0.18204768f, -0.18413311f, -0.18622303f, -0.18831731f, -0.19041581f, -0.19251841f, -0.19462497f,
-    -0.19673534f, -0.19884940f, -0.20096701f, -0.20308802f, -0.20521229f, -0.20733969f, -0.20947008f, -0.21160330f,
-    -0.21373922f, -0.21587769f, -0.21801857f, -0.22016171f, -0.22230696f, -0.22445418f, -0.22660322f, -0.22875393f,
-    -0.23090616f, -0.23305976f, -0.23521458f, -0.23737047f, -0.23952728f, -0.24168485f, -0.24384304f, -0.24600169f,
-    -0.24816065f, -0.25031976f, -0.25247888f, -0.25463784f, -0.25679649f, -0.25895469f, -0.26111226f, -0.26326907f,
-    -0.26542494f, -0.26757974f, -0.26973330f, -0.27188547f, -0.27403609f, -0.27618500f, -0.27833206f, -0.28047711f,
-    -0.28261998f, -0.28476054f, -0.28689861f, -0.28903405f, -0.29116671f, -0.29329642f, -0.29542304f, -0.29754641f,
-    -0.29966637f, -0.30178278f, -0.30389549f, -0.30600433f, -0.30810916f, -0.31020983f, -0.31230618f, -0.31439807f,
-    -0.31648534f, -0.31856786f, -0.32064546f, -0.32271800f, -0.32478534f, -0.32684732f, -0.32890381f, -0.33095465f,
-    -0.33299971f, -0.33503884f, -0.33707189f, -0.33909873f, -0.34111921f, -0.34313320f, -0.34514055f, -0.34714114f,
-    -0.34913481f, -0.35112144f, -0.35310089f, -0.35507303f, -0.35703772f, -0.35899484f, -0.36094424f, -0.36288582f,
-    -0.36481942f, -0.36674494f, -0.36866224f, -0.37057120f, -0.37247170f, -0.37436361f, -0.37624682f, -0.37812120f,
-    -0.37998665f, -0.38184304f, -0.38369025f, -0.38552818f, -0.38735672f, -0.38917575f, -0.39098517f, -0.39278486f,
-    -0.39457473f, -0.39635467f, -0.39812458f, -0.39988436f, -0.40163390f, -0.40337312f, -0.40510191f, -0.40682018f,
-    -0.40852785f, -0.41022481f, -0.41191099f, -0.41358630f, -0.41525064f, -0.41690395f, -0.41854612f, -0.42017710f,
-    -0.42179680f, -0.42340514f, -0.42500206f, -0.42658747f, -0.42816131f, -0.42972352f, -0.43127402f, -0.43281275f,
-    -0.43433966f, -0.43585468f, -0.43735775f, -0.43884882f, -0.44032783f, -0.44179473f, -0.44324948f, -0.44469203f,
-    -0.44612232f, -0.44754033f, -0.44894600f, -0.45033929f, -0.45172018f, -0.45308863f, -0.45444460f, -0.45578806f,
-    -0.45711899f, -0.45843735f, -0.45974313f, -0.46103631f, -0.46231686f, -0.46358477f, -0.46484002f, -0.46608260f,
-    -0.46731250f, -0.46852971f, -0.46973423f, -0.47092605f, -0.47210517f, -0.47327158f, -0.47442531f, -0.47556634f,
-    -0.47669468f, -0.47781035f, -0.47891336f, -0.48000373f, -0.48108146f, -0.48214657f, -0.48319910f, -0.48423905f,
-    -0.48526646f, -0.48628136f, -0.48728377f, -0.48827373f, -0.48925126f, -0.49021642f, -0.49116923f, -0.49210973f,
-    -0.49303798f, -0.49395402f, -0.49485788f, -0.49574963f, -0.49662932f, -0.49749700f, -0.49835272f, -0.49919655f,
-    -0.50002855f, -0.50084878f, -0.50165730f, -0.50245418f, -0.50323949f, -0.50401331f, -0.50477570f, -0.50552675f,
-    -0.50626652f, -0.50699511f, -0.50771259f, -0.50841904f, -0.50911456f, -0.50979923f, -0.51047314f, -0.51113639f,
-    -0.51178906f, -0.51243125f, -0.51306307f, -0.51368461f, -0.51429597f, -0.51489726f, -0.51548859f, -0.51607005f,
-    -0.51664177f, -0.51720385f, -0.51775641f, -0.51829955f, -0.51883341f, -0.51935809f, -0.51987372f, -0.52038042f,
-    -0.52087831f, -0.52136752f, -0.52184817f, -0.52232040f, -0.52278434f, -0.52324011f, -0.52368785f, -0.52412771f,
-    -0.52455980f, -0.52498428f, -0.52540128f, -0.52581094f, -0.52621341f, -0.52660883f, -0.52699734f, -0.52737910f,
-    -0.52775425f, -0.52812295f, -0.52848533f, -0.52884157f, -0.52919180f, -0.52953618f, -0.52987487f, -0.53020804f,
-    -0.53053583f, -0.53085840f, -0.53117592f, -0.53148855f, -0.53179645f, -0.53209978f, -0.53239871f, -0.53269341f,
-    -0.53298404f, -0.53327078f, -0.53355378f, -0.53383322f, -0.53410926f, -0.53438209f, -0.53465186f, -0.53491877f,
-    -0.53518296f, -0.53544463f, -0.53570394f, -0.53596108f, -0.53621621f, -0.53646951f, -0.53672117f, -0.53697135f,
-    -0.53722023f, -0.53746800f, -0.53771483f, -0.53796090f, -0.53820639f, -0.53845147f, -0.53869634f, -0.53894117f,
-    -0.53918614f, -0.53943142f, -0.53967721f, -0.53992368f, -0.54017101f, -0.54041939f, -0.54066899f, -0.54092000f,
-    -0.54117259f, -0.54142695f, -0.54168326f, -0.54194169f, -0.54220244f, -0.54246567f, -0.54273157f, -0.54300032f,
-    -0.54327209f, -0.54354708f, -0.54382544f, -0.54410737f, -0.54439304f, -0.54468263f, -0.54497631f, -0.54527427f,
-    -0.54557667f, -0.54588369f, -0.54619550f, -0.54651229f, -0.54683422f, -0.54716146f, -0.54749419f, -0.54783257f,
-    -0.54817678f, -0.54852699f, -0.54888336f, -0.54924606f, -0.54961526f, -0.54999112f, -0.55037380f, -0.55076348f,
-    -0.55116030f, -0.55156444f, -0.55197605f, -0.55239529f, -0.55282231f, -0.55325728f, -0.55370035f, -0.55415167f,
-    -0.55461140f, -0.55507968f, -0.55555667f, -0.55604250f, -0.55653734f, -0.55704132f, -0.55755459f, -0.55807729f,
-    -0.55860955f, -0.55915153f, -0.55970335f, -0.56026516f, -0.56083707f, -0.56141924f, -0.56201179f, -0.56261484f,
-    -0.56322852f, -0.56385296f, -0.56448829f, -0.56513461f, -0.56579206f, -0.56646075f, -0.56714080f, -0.56783231f,
-    -0.56853540f, -0.56925019f, -0.56997677f, -0.57071525f, -0.57146574f, -0.57222833f, -0.57300313f, -0.57379024f,
-    -0.57458974f, -0.57540173f, -0.57622630f, -0.57706354f, -0.57791353f, -0.57877636f, -0.57965210f, -0.58054085f,
-    -0.58144266f, -0.58235763f, -0.58328581f, -0.58422728f, -0.58518210f, -0.58615034f, -0.58713206f, -0.58812732f,
-    -0.58913617f, -0.59015868f, -0.59119488f, -0.59224484f, -0.59330860f, -0.59438619f, -0.59547767f, -0.59658307f,
-    -0.59770242f, -0.59883577f, -0.59998314f, -0.60114456f, -0.60232005f, -0.60350963f, -0.60471334f, -0.60593118f,
-    -0.60716317f, -0.60840932f, -0.60966963f, -0.61094413f, -0.61223280f, -0.61353565f, -0.61485268f, -0.61618388f,
-    -0.61752925f, -0.61888877f, -0.62026243f, -0.62165022f, -0.62305211f, -0.62446808f, -0.62589811f, -0.62734217f,
-    -0.62880024f, -0.63027227f, -0.63175823f, -0.63325808f, -0.63477178f, -0.63629929f, -0.63784055f, -0.63939552f,
-    -0.64096414f, -0.64254636f, -0.64414212f, -0.64575135f, -0.64737399f, -0.64900998f, -0.65065923f, -0.65232169f,
-    -0.65399726f, -0.65568588f, -0.65738746f, -0.65910192f, -0.66082916f, -0.66256909f, -0.66432164f, -0.66608668f,
-    -0.66786414f, -0.66965390f, -0.67145586f, -0.67326991f, -0.67509595f, -0.67693385f, -0.67878351f, -0.68064480f,
-    -0.68251761f, -0.68440180f, -0.68629726f, -0.68820384f, -0.69012143f, -0.69204988f, -0.69398905f, -0.69593882f,
-    -0.69789902f, -0.69986952f, -0.70185017f, -0.70384082f, -0.70584131f, -0.70785149f, -0.70987119f, -0.71190026f,
-    -0.71393854f, -0.71598585f, -0.71804203f, -0.72010690f, -0.72218030f, -0.72426204f, -0.72635195f, -0.72844985f,
-    -0.73055554f, -0.73266886f, -0.73478960f, -0.73691758f, -0.73905260f, -0.74119447f, -0.74334299f, -0.74549797f,
-    -0.74765919f, -0.74982647f, -0.75199958f, -0.75417832f, -0.75636248f, -0.75855185f, -0.76074621f, -0.76294535f,
-    -0.76514905f, -0.76735709f, -0.76956924f, -0.77178528f, -0.77400498f, -0.77622812f, -0.77845446f, -0.78068378f,
-    -0.78291583f, -0.78515039f, -0.78738722f, -0.78962607f, -0.79186671f, -0.79410889f, -0.79635238f, -0.79859692f,
-    -0.80084226f, -0.80308817f, -0.80533439f, -0.80758066f, -0.80982674f, -0.81207237f, -0.81431729f, -0.81656126f,
-    -0.81880400f, -0.82104526f, -0.82328478f, -0.82552231f, -0.82775756f, -0.82999029f, -0.83222022f, -0.83444710f,
-    -0.83667064f, -0.83889059f, -0.84110668f, -0.84331863f, -0.84552617f, -0.84772904f, -0.84992695f, -0.85211965f,
-    -0.85430684f, -0.85648827f, -0.85866365f, -0.86083270f, -0.86299516f, -0.86515074f, -0.86729916f, -0.86944015f,
-    -0.87157344f, -0.87369873f, -0.87581576f, -0.87792424f, -0.88002390f, -0.88211445f, -0.88419561f, -0.88626711f,
-    -0.88832866f, -0.89037999f, -0.89242080f, -0.89445083f, -0.89646980f, -0.89847742f, -0.90047341f, -0.90245749f,
-    -0.90442939f, -0.90638882f, -0.90833550f, -0.91026917f, -0.91218953f, -0.91409631f, -0.91598923f, -0.91786802f,
-    -0.91973241f, -0.92158210f, -0.92341684f, -0.92523633f, -0.92704032f, -0.92882853f, -0.93060068f, -0.93235650f,
-    -0.93409573f, -0.93581809f, -0.93752332f, -0.93921114f, -0.94088129f, -0.94253350f, -0.94416752f, -0.94578306f,
-    -0.94737989f, -0.94895772f, -0.95051630f, -0.95205538f, -0.95357469f, -0.95507399f, -0.95655300f, -0.95801149f,
-    -0.95944920f, -0.96086588f, -0.96226128f, -0.96363516f, -0.96498726f, -0.96631735f, -0.96762518f, -0.96891051f,
-    -0.97017311f, -0.97141273f, -0.97262914f, -0.97382212f, -0.97499142f, -0.97613682f, -0.97725810f, -0.97835501f,
-    -0.97942736f, -0.98047490f, -0.98149743f, -0.98249472f, -0.98346657f, -0.98441275f, -0.98533307f, -0.98622730f,
-    -0.98709526f, -0.98793672f, -0.98875150f, -0.98953939f, -0.99030020f, -0.99103374f, -0.99173981f, -0.99241823f,
-    -0.99306880f, -0.99369136f, -0.99428571f, -0.99485168f, -0.99538909f, -0.99589777f, -0.99637756f, -0.99682828f,
-    -0.99724977f, -0.99764188f, -0.99800443f, -0.99833728f, -0.99864027f, -0.99891326f, -0.99915610f, -0.99936864f,
-    -0.99955074f, -0.99970227f, -0.99982309f, -0.99991307f, -0.99997208f, -1.00000000f, -0.99999670f, -0.99996207f,
-    -0.99989599f, -0.99979835f, -0.99966904f, -0.99950795f, -0.99931498f, -0.99909003f, -0.99883301f, -0.99854382f,
-    -0.99822238f, -0.99786859f, -0.99748238f, -0.99706367f, -0.99661237f, -0.99612843f, -0.99561176f, -0.99506232f,
-    -0.99448002f, -0.99386482f, -0.99321666f, -0.99253549f, -0.99182126f, -0.99107393f, -0.99029346f, -0.98947981f,
-    -0.98863295f, -0.98775284f, -0.98683947f, -0.98589280f, -0.98491283f, -0.98389953f, -0.98285290f, -0.98177292f,
-    -0.98065959f, -0.97951292f, -0.97833290f, -0.97711954f, -0.97587286f, -0.97459286f, -0.97327956f, -0.97193299f,
-    -0.97055318f, -0.96914014f, -0.96769391f, -0.96621454f, -0.96470206f, -0.96315651f, -0.96157794f, -0.95996640f,
-    -0.95832196f, -0.95664465f, -0.95493456f, -0.95319175f, -0.95141627f, -0.94960822f, -0.94776766f, -0.94589468f,
-    -0.94398936f, -0.94205179f, -0.94008207f, -0.93808028f, -0.93604652f, -0.93398091f, -0.93188354f, -0.92975453f,
-    -0.92759399f, -0.92540204f, -0.92317879f, -0.92092438f, -0.91863894f, -0.91632258f, -0.91397546f, -0.91159770f,
-    -0.90918945f, -0.90675087f, -0.90428208f, -0.90178326f, -0.89925455f, -0.89669612f, -0.89410813f, -0.89149075f,
-    -0.88884414f, -0.88616848f, -0.88346395f, -0.88073073f, -0.87796900f, -0.87517894f, -0.87236076f, -0.86951464f,
-    -0.86664078f, -0.86373938f, -0.86081065f, -0.85785478f, -0.85487200f, -0.85186251f, -0.84882653f, -0.84576428f,
-    -0.84267597f, -0.83956185f, -0.83642213f, -0.83325705f, -0.83006684f, -0.82685173f, -0.82361198f, -0.82034782f,
-    -0.81705950f, -0.81374726f, -0.81041136f, -0.80705206f, -0.80366961f, -0.80026427f, -0.79683631f, -0.79338598f,
-    -0.78991357f, -0.78641933f, -0.78290355f, -0.77936649f, -0.77580844f, -0.77222968f, -0.76863049f, -0.76501116f,
-    -0.76137197f, -0.75771322f, -0.75403520f, -0.75033821f, -0.74662253f, -0.74288848f, -0.73913635f, -0.73536645f,
-    -0.73157909f, -0.72777456f, -0.72395319f, -0.72011529f, -0.71626116f, -0.71239113f, -0.70850552f, -0.70460464f,
-    -0.70068881f, -0.69675836f, -0.69281362f, -0.68885491f, -0.68488257f, -0.68089691f, -0.67689827f, -0.67288700f,
-    -0.66886341f, -0.66482785f, -0.66078066f, -0.65672218f, -0.65265274f, -0.64857269f, -0.64448237f, -0.64038212f,
-    -0.63627230f, -0.63215325f, -0.62802531f, -0.62388884f, -0.61974418f, -0.61559169f, -0.61143172f, -0.60726462f,
-    -0.60309074f, -0.59891044f, -0.59472408f, -0.59053200f, -0.58633458f, -0.58213215f, -0.57792509f, -0.57371375f,
-    -0.56949849f, -0.56527967f, -0.56105764f, -0.55683277f, -0.55260543f, -0.54837596f, -0.54414473f, -0.53991210f,
-    -0.53567844f, -0.53144410f, -0.52720945f, -0.52297484f, -0.51874064f, -0.51450722f, -0.51027492f, -0.50604412f,
-    -0.50181517f, -0.49758844f, -0.49336428f, -0.48914306f, -0.48492513f, -0.48071086f, -0.47650060f, -0.47229471f,
-    -0.46809356f, -0.46389748f, -0.45970686f, -0.45552203f, -0.45134336f, -0.44717119f, -0.44300589f, -0.43884781f,
-    -0.43469729f, -0.43055469f, -0.42642036f, -0.42229465f, -0.41817791f, -0.41407047f, -0.40997270f, -0.40588493f,
-    -0.40180750f, -0.39774077f, -0.39368506f, -0.38964072f, -0.38560809f, -0.38158750f, -0.37757928f, -0.37358378f,
-    -0.36960133f, -0.36563225f, -0.36167687f, -0.35773552f, -0.35380852f, -0.34989621f, -0.34599890f, -0.34211691f,
-    -0.33825055f, -0.33440016f, -0.33056603f, -0.32674849f, -0.32294784f, -0.31916439f, -0.31539845f, -0.31165031f,
-    -0.30792030f, -0.30420869f, -0.30051580f, -0.29684192f, -0.29318733f, -0.28955233f, -0.28593721f, -0.28234225f,
-    -0.27876775f, -0.27521397f, -0.27168119f, -0.26816970f, -0.26467976f, -0.26121166f, -0.25776564f, -0.25434199f,
-    -0.25094096f, -0.24756281f, -0.24420780f, -0.24087619f, -0.23756822f, -0.23428415f, -0.23102423f, -0.22778868f,
-    -0.22457776f, -0.22139170f, -0.21823074f, -0.21509511f, -0.21198503f, -0.20890073f, -0.20584243f, -0.20281036f,
-    -0.19980472f, -0.19682574f, -0.19387361f, -0.19094855f, -0.18805076f, -0.18518043f, -0.18233778f, -0.17952298f,
-    -0.17673623f, -0.17397771f, -0.17124762f, -0.16854612f, -0.16587340f, -0.16322963f, -0.16061497f, -0.15802960f,
-    -0.15547367f, -0.15294735f, -0.15045080f, -0.14798416f, -0.14554758f, -0.14314121f, -0.14076518f, -0.13841965f,
-    -0.13610474f, -0.13382059f, -0.13156731f, -0.12934504f, -0.12715390f, -0.12499400f, -0.12286545f, -0.12076836f,
-    -0.11870285f, -0.11666900f, -0.11466693f, -0.11269672f, -0.11075846f, -0.10885224f, -0.10697815f, -0.10513626f,
-    -0.10332666f, -0.10154940f, -0.09980457f, -0.09809222f, -0.09641241f, -0.09476522f, -0.09315067f, -0.09156884f,
-    -0.09001976f, -0.08850347f, -0.08702001f, -0.08556943f, -0.08415174f, -0.08276698f, -0.08141517f, -0.08009633f,
-    -0.07881047f, -0.07755761f, -0.07633776f, -0.07515091f, -0.07399708f, -0.07287626f, -0.07178845f, -0.07073362f,
-    -0.06971177f, -0.06872289f, -0.06776694f, -0.06684391f, -0.06595377f, -0.06509648f, -0.06427201f, -0.06348032f,
-    -0.06272137f, -0.06199510f, -0.06130147f, -0.06064043f, -0.06001192f, -0.05941587f, -0.05885223f, -0.05832091f,
-    -0.05782186f, -0.05735500f, -0.05692024f, -0.05651751f, -0.05614671f, -0.05580777f, -0.05550059f, -0.05522506f,
-    -0.05498110f, -0.05476860f, -0.05458745f, -0.05443755f, -0.05431877f, -0.05423101f, -0.05417415f, -0.05414806f,
-    -0.05415261f, -0.05418769f, -0.05425314f, -0.05434885f, -0.05447467f, -0.05463046f, -0.05481607f, -0.05503136f,
-    -0.05527617f, -0.05555035f, -0.05585375f, -0.05618620f, -0.05654755f, -0.05693761f, -0.05735624f, -0.05780324f,
-    -0.05827846f, -0.05878171f, -0.05931281f, -0.05987159f, -0.06045784f, -0.06107139f, -0.06171205f, -0.06237961f,
-    -0.06307389f, -0.06379469f, -0.06454180f, -0.06531502f, -0.06611414f, -0.06693896f, -0.06778926f, -0.06866483f,
-    -0.06956546f, -0.07049092f, -0.07144099f, -0.07241546f, -0.07341409f, -0.07443667f, -0.07548295f, -0.07655271f,
-    -0.07764571f, -0.07876173f, -0.07990051f, -0.08106183f, -0.08224544f, -0.08345109f, -0.08467854f, -0.08592754f,
-    -0.08719785f, -0.08848921f, -0.08980138f, -0.09113409f, -0.09248708f, -0.09386011f, -0.09525292f, -0.09666524f,
-    -0.09809680f, -0.09954736f, -0.10101663f, -0.10250437f, -0.10401028f, -0.10553412f, -0.10707561f, -0.10863447f,
-    -0.11021043f, -0.11180323f, -0.11341258f, -0.11503820f, -0.11667983f, -0.11833718f, -0.12000998f, -0.12169793f,
-    -0.12340077f, -0.12511821f, -0.12684997f, -0.12859577f, -0.13035531f, -0.13212832f, -0.13391452f, -0.13571360f,
-    -0.13752530f, -0.13934931f, -0.14118536f, -0.14303315f, -0.14489240f, -0.14676282f, -0.14864412f, -0.15053601f,
-    -0.15243820f, -0.15435040f, -0.15627232f, -0.15820367f, -0.16014416f, -0.16209350f, -0.16405140f, -0.16601758f,
-    -0.16799173f, -0.16997357f, -0.17196281f, -0.17395916f, -0.17596233f, -0.17797204f, -0.17998799f, -0.18200989f,
-    -0.18403746f, -0.18607041f, -0.18810845f, -0.19015129f, -0.19219866f, -0.19425026f, -0.19630581f, -0.19836502f,
-    -0.20042762f, -0.20249331f, -0.20456182f, -0.20663286f, -0.20870616f, -0.21078144f, -0.21285841f, -0.21493680f,
-    -0.21701633f, -0.21909673f, -0.22117772f, -0.22325904f, -0.22534039f, -0.22742153f, -0.22950216f, -0.23158204f,
-    -0.23366088f, -0.23573843f, -0.23781441f, -0.23988857f, -0.24196065f, -0.24403037f, -0.24609749f, -0.24816174f,
-    -0.25022287f, -0.25228063f, -0.25433476f, -0.25638500f, -0.25843112f, -0.26047286f, -0.26250998f, -0.26454223f,
-    -0.26656937f, -0.26859116f, -0.27060735f, -0.27261772f, -0.27462202f, -0.27662003f, -0.27861151f, -0.28059623f,
-    -0.28257396f, -0.28454449f, -0.28650758f, -0.28846301f, -0.29041057f, -0.29235004f, -0.29428120f, -0.29620384f,
-    -0.29811776f, -0.30002273f, -0.30191856f, -0.30380504f, -0.30568197f, -0.30754915f, -0.30940639f, -0.31125348f,
-    -0.31309025f, -0.31491649f, -0.31673203f, -0.31853666f, -0.32033023f, -0.32211254f, -0.32388341f, -0.32564268f,
-    -0.32739016f, -0.32912570f, -0.33084912f, -0.33256025f, -0.33425894f, -0.33594503f, -0.33761836f, -0.33927878f,
-    -0.34092613f, -0.34256026f, -0.34418104f, -0.34578831f, -0.34738194f, -0.34896179f, -0.35052772f, -0.35207960f,
-    -0.35361730f, -0.35514069f, -0.35664966f, -0.35814407f, -0.35962382f, -0.36108878f, -0.36253884f, -0.36397389f,
-    -0.36539383f, -0.36679855f, -0.36818795f, -0.36956192f, -0.37092039f, -0.37226324f, -0.37359039f, -0.37490176f,
-    -0.37619726f, -0.37747681f, -0.37874033f, -0.37998774f, -0.38121897f, -0.38243396f, -0.38363263f, -0.38481492f,
-    -0.38598077f, -0.38713012f, -0.38826291f, -0.38937910f, -0.39047863f, -0.39156146f, -0.39262754f, -0.39367683f,
-    -0.39470930f, -0.39572490f, -0.39672361f, -0.39770539f, -0.39867023f, -0.39961808f, -0.40054895f, -0.40146279f,
-    -0.40235961f, -0.40323939f, -0.40410211f, -0.40494778f, -0.40577638f, -0.40658792f, -0.40738239f, -0.40815981f,
-    -0.40892017f, -0.40966350f, -0.41038979f, -0.41109906f, -0.41179134f, -0.41246665f, -0.41312500f, -0.41376642f,
-    -0.41439094f, -0.41499860f, -0.41558942f, -0.41616345f, -0.41672071f, -0.41726126f, -0.41778514f, -0.41829239f,
-    -0.41878307f, -0.41925722f, -0.41971490f, -0.42015616f, -0.42058107f, -0.42098969f, -0.42138208f, -0.42175831f,
-    -0.42211844f, -0.42246255f, -0.42279072f, -0.42310301f, -0.42339950f, -0.42368029f, -0.42394544f, -0.42419504f,
-    -0.42442919f, -0.42464797f, -0.42485147f, -0.42503979f, -0.42521301f, -0.42537125f, -0.42551460f, -0.42564316f,
-    -0.42575704f, -0.42585635f, -0.42594118f, -0.42601165f, -0.42606788f, -0.42610997f, -0.42613805f, -0.42615223f,
-    -0.42615263f, -0.42613937f, -0.42611257f, -0.42607237f, -0.42601888f, -0.42595223f, -0.42587256f, -0.42578000f,
-    -0.42567467f, -0.42555672f, -0.42542628f, -0.42528348f, -0.42512848f, -0.42496140f, -0.42478239f, -0.42459159f,
-    -0.42438916f, -0.42417523f, -0.42394995f, -0.42371347f, -0.42346594f, -0.42320752f, -0.42293835f, -0.42265859f,
-    -0.42236840f, -0.42206792f, -0.42175732f, -0.42143676f, -0.42110638f, -0.42076637f, -0.42041686f, -0.42005804f,
-    -0.41969005f, -0.41931306f, -0.41892724f, -0.41853276f, -0.41812977f, -0.41771844f, -0.41729895f, -0.41687146f,
-    -0.41643613f, -0.41599314f, -0.41554266f, -0.41508485f, -0.41461989f, -0.41414795f, -0.41366920f, -0.41318381f,
-    -0.41269195f, -0.41219380f, -0.41168953f, -0.41117931f, -0.41066332f, -0.41014173f, -0.40961471f, -0.40908243f,
-    -0.40854508f, -0.40800282f, -0.40745583f, -0.40690428f, -0.40634835f, -0.40578821f, -0.40522403f, -0.40465599f,
-    -0.40408426f, -0.40350901f, -0.40293042f, -0.40234866f, -0.40176391f, -0.40117633f, -0.40058609f, -0.39999337f,
-    -0.39939834f, -0.39880118f, -0.39820204f, -0.39760109f, -0.39699852f, -0.39639449f, -0.39578915f, -0.39518269f,
-    -0.39457527f, -0.39396705f, -0.39335821f, -0.39274889f, -0.39213927f, -0.39152952f, -0.39091978f, -0.39031023f,
-    -0.38970102f, -0.38909231f, -0.38848427f, -0.38787704f, -0.38727079f, -0.38666567f, -0.38606184f, -0.38545944f,
-    -0.38485863f, -0.38425957f, -0.38366239f, -0.38306726f, -0.38247431f, -0.38188369f, -0.38129555f, -0.38071004f,
-    -0.38012728f, -0.37954744f, -0.37897063f, -0.37839701f, -0.37782671f, -0.37725986f, -0.37669661f, -0.37613707f,
-    -0.37558139f, -0.37502968f, -0.37448209f, -0.37393873f, -0.37339973f, -0.37286522f, -0.37233531f, -0.37181012f,
-    -0.37128978f, -0.37077439f, -0.37026408f, -0.36975896f, -0.36925914f, -0.36876472f, -0.36827582f, -0.36779254f,
-    -0.36731498f, -0.36684326f, -0.36637746f, -0.36591768f, -0.36546403f, -0.36501660f, -0.36457548f, -0.36414076f,
-    -0.36371254f, -0.36329089f, -0.36287590f, -0.36246766f, -0.36206625f, -0.36167174f, -0.36128422f, -0.36090375f,
-    -0.36053042f, -0.36016429f, -0.35980543f, -0.35945391f, -0.35910979f, -0.35877314f, -0.35844401f, -0.35812247f,
-    -0.35780857f, -0.35750236f, -0.35720390f, -0.35691324f, -0.35663042f, -0.35635549f, -0.35608850f, -0.35582948f,
-    -0.35557847f, -0.35533552f, -0.35510065f, -0.35487390f, -0.35465530f, -0.35444488f, -0.35424266f, -0.35404866f,
-    -0.35386292f, -0.35368544f, -0.35351625f, -0.35335536f, -0.35320278f, -0.35305853f, -0.35292261f, -0.35279502f,
-    -0.35267578f, -0.35256489f, -0.35246233f, -0.35236812f, -0.35228225f, -0.35220471f, -0.35213548f, -0.35207457f,
-    -0.35202195f, -0.35197762f, -0.35194154f, -0.35191371f, -0.35189410f, -0.35188269f, -0.35187945f, -0.35188435f,
-    -0.35189736f, -0.35191845f, -0.35194758f, -0.35198473f, -0.35202983f, -0.35208287f, -0.35214379f, -0.35221255f,
-    -0.35228910f, -0.35237340f, -0.35246538f, -0.35256500f, -0.35267221f, -0.35278694f, -0.35290913f, -0.35303873f,
-    -0.35317567f, -0.35331989f, -0.35347132f, -0.35362989f, -0.35379553f, -0.35396816f, -0.35414772f, -0.35433412f,
-    -0.35452730f, -0.35472716f, -0.35493362f, -0.35514661f, -0.35536604f, -0.35559181f, -0.35582385f, -0.35606206f,
-    -0.35630634f, -0.35655661f, -0.35681277f, -0.35707472f, -0.35734237f, -0.35761560f, -0.35789433f, -0.35817845f,
-    -0.35846784f, -0.35876242f, -0.35906206f, -0.35936665f, -0.35967610f, -0.35999028f, -0.36030908f, -0.36063239f,
-    -0.36096009f, -0.36129206f, -0.36162818f, -0.36196834f, -0.36231241f, -0.36266026f, -0.36301178f, -0.36336684f,
-    -0.36372531f, -0.36408707f, -0.36445198f, -0.36481992f, -0.36519075f, -0.36556435f, -0.36594058f, -0.36631931f,
-    -0.36670040f, -0.36708372f, -0.36746913f, -0.36785649f, -0.36824567f, -0.36863652f, -0.36902891f, -0.36942269f,
-    -0.36981773f, -0.37021389f, -0.37061101f, -0.37100896f, -0.37140758f, -0.37180675f, -0.37220631f, -0.37260612f,
-    -0.37300602f, -0.37340588f, -0.37380555f, -0.37420488f, -0.37460371f, -0.37500192f, -0.37539933f, -0.37579581f,
-    -0.37619121f, -0.37658537f, -0.37697815f, -0.37736939f, -0.37775896f, -0.37814669f, -0.37853243f, -0.37891605f,
-    -0.37929738f, -0.37967627f, -0.38005258f, -0.38042616f, -0.38079684f, -0.38116450f, -0.38152897f, -0.38189010f,
-    -0.38224775f, -0.38260176f, -0.38295199f, -0.38329828f, -0.38364050f, -0.38397849f, -0.38431209f, -0.38464118f,
-    -0.38496559f, -0.38528519f, -0.38559982f, -0.38590934f, -0.38621360f, -0.38651247f, -0.38680579f, -0.38709342f,
-    -0.38737523f, -0.38765106f, -0.38792079f, -0.38818426f, -0.38844134f, -0.38869188f, -0.38893576f, -0.38917283f,
-    -0.38940296f, -0.38962602f, -0.38984185f, -0.39005035f, -0.39025136f, -0.39044477f, -0.39063043f, -0.39080822f,
-    -0.39097802f, -0.39113969f, -0.39129311f, -0.39143815f, -0.39157470f, -0.39170262f, -0.39182180f, -0.39193211f,
-    -0.39203345f, -0.39212568f, -0.39220870f, -0.39228239f, -0.39234663f, -0.39240133f, -0.39244635f, -0.39248160f,
-    -0.39250697f, -0.39252236f, -0.39252765f, -0.39252275f, -0.39250755f, -0.39248195f, -0.39244587f, -0.39239919f,
-    -0.39234183f, -0.39227369f, -0.39219468f, -0.39210471f, -0.39200369f, -0.39189155f, -0.39176818f, -0.39163351f,
-    -0.39148747f, -0.39132996f, -0.39116092f, -0.39098026f, -0.39078792f, -0.39058382f, -0.39036789f, -0.39014007f,
-    -0.38990029f, -0.38964848f, -0.38938459f, -0.38910855f, -0.38882031f, -0.38851981f, -0.38820699f, -0.38788181f,
-    -0.38754421f, -0.38719415f, -0.38683159f, -0.38645647f, -0.38606875f, -0.38566841f, -0.38525539f, -0.38482967f,
-    -0.38439121f, -0.38393998f, -0.38347596f, -0.38299911f, -0.38250941f, -0.38200685f, -0.38149139f, -0.38096303f,
-    -0.38042174f, -0.37986752f, -0.37930035f, -0.37872022f, -0.37812713f, -0.37752107f, -0.37690205f, -0.37627005f,
-    -0.37562509f, -0.37496716f, -0.37429628f, -0.37361246f, -0.37291569f, -0.37220601f, -0.37148342f, -0.37074795f,
-    -0.36999960f, -0.36923842f, -0.36846441f, -0.36767761f, -0.36687805f, -0.36606576f, -0.36524077f, -0.36440312f,
-    -0.36355285f, -0.36268999f, -0.36181460f, -0.36092671f, -0.36002638f, -0.35911365f, -0.35818858f, -0.35725121f,
-    -0.35630161f, -0.35533984f, -0.35436595f, -0.35338001f, -0.35238208f, -0.35137223f, -0.35035053f, -0.34931706f,
-    -0.34827188f, -0.34721506f, -0.34614670f, -0.34506687f, -0.34397565f, -0.34287312f, -0.34175938f, -0.34063451f,
-    -0.33949860f, -0.33835174f, -0.33719403f, -0.33602557f, -0.33484645f, -0.33365678f, -0.33245665f, -0.33124618f,
-    -0.33002547f, -0.32879462f, -0.32755375f, -0.32630298f, -0.32504241f, -0.32377215f, -0.32249234f, -0.32120309f,
-    -0.31990452f, -0.31859675f, -0.31727991f, -0.31595413f, -0.31461954f, -0.31327626f, -0.31192442f, -0.31056417f,
-    -0.30919564f, -0.30781897f, -0.30643428f, -0.30504173f, -0.30364146f, -0.30223361f, -0.30081832f, -0.29939575f,
-    -0.29796603f, -0.29652933f, -0.29508578f, -0.29363555f, -0.29217878f, -0.29071564f, -0.28924627f, -0.28777084f,
-    -0.28628951f, -0.28480244f, -0.28330978f, -0.28181170f, -0.28030837f, -0.27879995f, -0.27728660f, -0.27576850f,
-    -0.27424581f, -0.27271870f, -0.27118735f, -0.26965192f, -0.26811259f, -0.26656954f, -0.26502292f, -0.26347293f,
-    -0.26191974f, -0.26036352f, -0.25880445f, -0.25724271f, -0.25567849f, -0.25411195f, -0.25254329f, -0.25097268f,
-    -0.24940030f, -0.24782634f, -0.24625099f, -0.24467441f, -0.24309681f, -0.24151836f, -0.23993925f, -0.23835966f,
-    -0.23677979f, -0.23519981f, -0.23361991f, -0.23204028f, -0.23046111f, -0.22888259f, -0.22730489f, -0.22572822f,
-    -0.22415275f, -0.22257868f, -0.22100619f, -0.21943547f, -0.21786671f, -0.21630009f, -0.21473581f, -0.21317405f,
-    -0.21161500f, -0.21005885f, -0.20850578f, -0.20695598f, -0.20540964f, -0.20386694f, -0.20232807f, -0.20079322f,
-    -0.19926256f, -0.19773629f, -0.19621459f, -0.19469765f, -0.19318563f, -0.19167874f, -0.19017715f, -0.18868104f,
-    -0.18719059f, -0.18570598f, -0.18422740f, -0.18275501f, -0.18128901f, -0.17982955f, -0.17837683f, -0.17693102f,
-    -0.17549229f, -0.17406080f, -0.17263675f, -0.17122029f, -0.16981160f, -0.16841084f, -0.16701819f, -0.16563381f,
-    -0.16425786f, -0.16289052f, -0.16153194f, -0.16018228f, -0.15884172f, -0.15751039f, -0.15618847f, -0.15487611f,
-    -0.15357347f, -0.15228069f, -0.15099794f, -0.14972535f, -0.14846309f, -0.14721129f, -0.14597011f, -0.14473968f,
-    -0.14352016f, -0.14231167f, -0.14111437f, -0.13992839f, -0.13875386f, -0.13759091f, -0.13643969f, -0.13530031f,
-    -0.13417292f, -0.13305763f, -0.13195457f, -0.13086386f, -0.12978562f, -0.12871997f, -0.12766703f, -0.12662692f,
+alignas(4) const int16_t waveform_Glass[WaveMip::TOTAL_SIZE] = {
+    // Level 0: 2048 samples, 1023 harmonics
+     -1007,    624,    537,   1144,   1302,   1793,   2018,   2463,   2718,   3139,   3410,   3814,   4096,   4488,   4776,   5158,
+      5449,   5823,   6116,   6482,   6776,   7135,   7428,   7780,   8071,   8417,   8706,   9045,   9331,   9663,   9946,  10271,
+     10550,  10869,  11143,  11454,  11724,  12028,  12292,  12589,  12848,  13137,  13390,  13672,  13918,  14192,  14431,  14698,
+     14930,  15188,  15414,  15664,  15882,  16123,  16334,  16567,  16770,  16994,  17190,  17405,  17592,  17799,  17978,  18176,
+     18347,  18536,  18698,  18878,  19032,  19203,  19348,  19510,  19647,  19800,  19928,  20072,  20192,  20326,  20438,  20563,
+     20666,  20782,  20877,  20984,  21070,  21169,  21246,  21337,  21406,  21487,  21548,  21621,  21674,  21739,  21784,  21840,
+     21877,  21926,  21955,  21996,  22017,  22050,  22065,  22090,  22098,  22116,  22116,  22127,  22121,  22125,  22112,  22110,
+     22091,  22082,  22057,  22042,  22011,  21991,  21954,  21928,  21886,  21854,  21808,  21771,  21719,  21678,  21622,  21576,
+     21516,  21466,  21402,  21348,  21280,  21222,  21151,  21091,  21017,  20953,  20876,  20809,  20730,  20661,  20580,  20509,
+     20426,  20353,  20268,  20194,  20108,  20032,  19945,  19868,  19781,  19704,  19616,  19538,  19450,  19372,  19284,  19206,
+     19119,  19041,  18955,  18878,  18792,  18716,  18631,  18557,  18473,  18400,  18318,  18247,  18166,  18097,  18019,  17951,
+     17875,  17810,  17736,  17673,  17602,  17541,  17473,  17415,  17350,  17295,  17233,  17181,  17122,  17073,  17017,  16972,
+     16920,  16877,  16829,  16790,  16745,  16709,  16668,  16636,  16598,  16570,  16536,  16512,  16482,  16461,  16435,  16418,
+     16395,  16382,  16363,  16354,  16339,  16334,  16322,  16321,  16313,  16315,  16311,  16317,  16317,  16326,  16330,  16342,
+     16349,  16366,  16376,  16395,  16409,  16432,  16449,  16475,  16495,  16524,  16547,  16579,  16605,  16639,  16668,  16705,
+     16737,  16776,  16810,  16852,  16888,  16932,  16970,  17017,  17057,  17105,  17147,  17196,  17240,  17291,  17336,  17388,
+     17435,  17488,  17536,  17590,  17638,  17694,  17742,  17798,  17848,  17904,  17954,  18010,  18060,  18116,  18166,  18222,
+     18272,  18328,  18377,  18432,  18481,  18536,  18584,  18637,  18684,  18737,  18783,  18834,  18878,  18929,  18972,  19020,
+     19061,  19108,  19148,  19193,  19231,  19274,  19309,  19350,  19384,  19423,  19454,  19490,  19519,  19553,  19579,  19610,
+     19634,  19663,  19684,  19710,  19728,  19751,  19767,  19787,  19799,  19816,  19826,  19840,  19847,  19858,  19861,  19869,
+     19870,  19875,  19872,  19874,  19868,  19867,  19858,  19853,  19842,  19834,  19819,  19808,  19790,  19777,  19756,  19739,
+     19715,  19695,  19668,  19646,  19616,  19590,  19558,  19530,  19495,  19464,  19426,  19392,  19352,  19316,  19273,  19235,
+     19190,  19149,  19102,  19059,  19010,  18965,  18914,  18868,  18815,  18766,  18712,  18661,  18605,  18554,  18496,  18443,
+     18384,  18330,  18270,  18215,  18154,  18098,  18037,  17980,  17918,  17861,  17798,  17740,  17677,  17619,  17556,  17498,
+     17435,  17377,  17314,  17257,  17194,  17137,  17075,  17018,  16957,  16901,  16840,  16785,  16725,  16671,  16613,  16560,
+     16502,  16451,  16395,  16344,  16290,  16241,  16188,  16141,  16090,  16045,  15995,  15952,  15905,  15863,  15818,  15778,
+     15735,  15698,  15657,  15622,  15584,  15551,  15515,  15485,  15451,  15423,  15392,  15367,  15338,  15315,  15289,  15269,
+     15246,  15228,  15207,  15192,  15174,  15162,  15146,  15136,  15123,  15116,  15105,  15101,  15093,  15091,  15085,  15085,
+     15083,  15085,  15085,  15090,  15092,  15099,  15103,  15113,  15119,  15130,  15139,  15152,  15163,  15178,  15190,  15208,
+     15222,  15241,  15256,  15277,  15294,  15316,  15334,  15358,  15377,  15402,  15422,  15448,  15469,  15495,  15518,  15545,
+     15567,  15595,  15618,  15646,  15669,  15697,  15720,  15748,  15771,  15799,  15822,  15849,  15871,  15898,  15920,  15945,
+     15966,  15991,  16011,  16034,  16053,  16075,  16092,  16112,  16128,  16147,  16160,  16177,  16189,  16204,  16213,  16226,
+     16233,  16243,  16248,  16255,  16257,  16262,  16261,  16262,  16258,  16257,  16250,  16245,  16235,  16227,  16213,  16201,
+     16184,  16169,  16148,  16129,  16104,  16081,  16053,  16026,  15993,  15962,  15926,  15890,  15850,  15810,  15765,  15722,
+     15672,  15625,  15571,  15519,  15461,  15404,  15342,  15281,  15214,  15149,  15078,  15008,  14933,  14859,  14779,  14701,
+     14617,  14534,  14446,  14359,  14267,  14176,  14079,  13984,  13884,  13785,  13680,  13577,  13469,  13362,  13250,  13140,
+     13025,  12911,  12792,  12675,  12553,  12433,  12307,  12184,  12056,  11930,  11799,  11670,  11537,  11406,  11270,  11137,
+     10999,  10864,  10725,  10588,  10446,  10308,  10165,  10026,   9882,   9741,   9596,   9455,   9310,   9168,   9022,   8880,
+      8734,   8592,   8447,   8305,   8160,   8019,   7875,   7735,   7592,   7453,   7311,   7174,   7034,   6898,   6760,   6626,
+      6491,   6360,   6226,   6098,   5967,   5842,   5715,   5593,   5469,   5350,   5230,   5115,   4999,   4889,   4777,   4671,
+      4564,   4462,   4360,   4263,   4166,   4075,   3983,   3897,   3811,   3731,   3650,   3576,   3502,   3434,   3365,   3304,
+      3242,   3187,   3133,   3084,   3037,   2995,   2955,   2921,   2887,   2860,   2834,   2815,   2796,   2785,   2774,   2770,
+      2767,   2771,   2776,   2788,   2801,   2821,   2842,   2870,   2899,   2936,   2973,   3018,   3063,   3116,   3170,   3231,
+      3293,   3362,   3432,   3509,   3588,   3674,   3760,   3854,   3948,   4050,   4153,   4263,   4373,   4491,   4609,   4734,
+      4860,   4993,   5127,   5267,   5408,   5556,   5704,   5859,   6014,   6176,   6338,   6506,   6675,   6850,   7025,   7207,
+      7388,   7575,   7762,   7956,   8148,   8347,   8545,   8749,   8953,   9161,   9370,   9583,   9796,  10014,  10230,  10452,
+     10673,  10899,  11123,  11352,  11579,  11811,  12042,  12276,  12509,  12746,  12981,  13220,  13456,  13697,  13935,  14177,
+     14416,  14658,  14898,  15141,  15381,  15624,  15864,  16107,  16347,  16589,  16828,  17069,  17306,  17546,  17782,  18020,
+     18254,  18489,  18721,  18954,  19183,  19413,  19639,  19866,  20088,  20312,  20530,  20750,  20964,  21179,  21389,  21600,
+     21805,  22011,  22211,  22411,  22606,  22800,  22989,  23178,  23361,  23543,  23720,  23896,  24066,  24236,  24399,  24561,
+     24717,  24873,  25021,  25169,  25310,  25451,  25584,  25716,  25842,  25966,  26084,  26200,  26309,  26417,  26517,  26616,
+     26709,  26799,  26883,  26964,  27039,  27112,  27178,  27242,  27299,  27354,  27401,  27447,  27486,  27523,  27553,  27580,
+     27601,  27620,  27631,  27641,  27643,  27644,  27637,  27628,  27613,  27595,  27571,  27544,  27511,  27476,  27434,  27390,
+     27339,  27287,  27228,  27167,  27099,  27030,  26954,  26877,  26793,  26707,  26616,  26522,  26423,  26322,  26215,  26107,
+     25993,  25878,  25756,  25634,  25506,  25377,  25242,  25106,  24965,  24824,  24676,  24529,  24376,  24222,  24063,  23905,
+     23741,  23577,  23408,  23239,  23065,  22892,  22714,  22536,  22354,  22172,  21986,  21801,  21611,  21422,  21229,  21038,
+     20842,  20647,  20449,  20252,  20051,  19852,  19649,  19448,  19244,  19041,  18835,  18631,  18424,  18219,  18011,  17806,
+     17597,  17391,  17183,  16977,  16768,  16562,  16354,  16148,  15941,  15736,  15529,  15325,  15119,  14916,  14712,  14510,
+     14308,  14108,  13907,  13709,  13510,  13314,  13117,  12923,  12729,  12538,  12346,  12158,  11969,  11783,  11597,  11414,
+     11231,  11052,  10872,  10696,  10519,  10347,  10173,  10004,   9835,   9669,   9503,   9342,   9180,   9022,   8863,   8709,
+      8555,   8405,   8254,   8108,   7962,   7819,   7677,   7539,   7400,   7266,   7131,   7001,   6871,   6744,   6618,   6496,
+      6373,   6255,   6136,   6022,   5907,   5796,   5685,   5578,   5471,   5368,   5264,   5165,   5064,   4968,   4872,   4779,
+      4685,   4596,   4505,   4419,   4332,   4248,   4164,   4083,   4002,   3924,   3845,   3770,   3694,   3621,   3547,   3476,
+      3404,   3336,   3266,   3199,   3131,   3066,   3000,   2937,   2872,   2810,   2746,   2685,   2623,   2563,   2502,   2443,
+      2382,   2324,   2264,   2206,   2147,   2089,   2030,   1972,   1913,   1855,   1796,   1738,   1679,   1621,   1560,   1502,
+      1441,   1382,   1320,   1260,   1197,   1136,   1072,   1010,    945,    881,    815,    750,    682,    615,    546,    477,
+       406,    336,    263,    191,    116,     41,    -36,   -112,   -191,   -270,   -351,   -432,   -516,   -599,   -685,   -771,
+      -859,   -947,  -1038,  -1129,  -1222,  -1315,  -1411,  -1507,  -1605,  -1703,  -1804,  -1905,  -2008,  -2112,  -2218,  -2323,
+     -2432,  -2540,  -2651,  -2762,  -2875,  -2988,  -3104,  -3220,  -3338,  -3456,  -3576,  -3696,  -3819,  -3941,  -4066,  -4190,
+     -4317,  -4443,  -4572,  -4700,  -4830,  -4960,  -5093,  -5224,  -5358,  -5491,  -5626,  -5761,  -5897,  -6033,  -6171,  -6308,
+     -6447,  -6585,  -6725,  -6863,  -7004,  -7143,  -7285,  -7425,  -7567,  -7707,  -7849,  -7990,  -8132,  -8273,  -8415,  -8556,
+     -8698,  -8838,  -8980,  -9120,  -9261,  -9400,  -9541,  -9680,  -9820,  -9957, -10096, -10233, -10371, -10506, -10643, -10777,
+    -10912, -11045, -11178, -11309, -11441, -11570, -11700, -11827, -11955, -12080, -12205, -12328, -12451, -12572, -12693, -12811,
+    -12929, -13045, -13161, -13274, -13387, -13497, -13607, -13714, -13821, -13926, -14030, -14131, -14232, -14331, -14429, -14524,
+    -14619, -14710, -14802, -14891, -14979, -15064, -15149, -15231, -15313, -15392, -15470, -15545, -15620, -15692, -15764, -15833,
+    -15901, -15967, -16032, -16094, -16156, -16215, -16274, -16329, -16385, -16438, -16490, -16540, -16589, -16636, -16683, -16726,
+    -16770, -16811, -16852, -16891, -16929, -16965, -17001, -17034, -17068, -17099, -17131, -17159, -17189, -17216, -17243, -17268,
+    -17293, -17317, -17340, -17362, -17385, -17405, -17426, -17445, -17465, -17483, -17502, -17519, -17537, -17553, -17571, -17587,
+    -17604, -17619, -17636, -17651, -17668, -17683, -17700, -17716, -17733, -17749, -17767, -17784, -17802, -17819, -17839, -17857,
+    -17877, -17897, -17919, -17940, -17963, -17985, -18010, -18034, -18060, -18086, -18115, -18143, -18173, -18204, -18236, -18269,
+    -18304, -18340, -18377, -18415, -18456, -18496, -18540, -18583, -18630, -18676, -18726, -18775, -18828, -18881, -18937, -18993,
+    -19053, -19112, -19175, -19238, -19305, -19372, -19441, -19512, -19585, -19660, -19737, -19815, -19895, -19977, -20061, -20147,
+    -20235, -20324, -20416, -20509, -20604, -20701, -20800, -20900, -21003, -21107, -21213, -21320, -21430, -21541, -21654, -21768,
+    -21884, -22002, -22121, -22242, -22364, -22488, -22614, -22740, -22868, -22997, -23129, -23260, -23394, -23528, -23664, -23800,
+    -23939, -24077, -24217, -24357, -24499, -24641, -24784, -24927, -25072, -25216, -25362, -25508, -25654, -25800, -25947, -26094,
+    -26242, -26388, -26536, -26683, -26830, -26977, -27124, -27269, -27416, -27561, -27706, -27850, -27993, -28136, -28278, -28419,
+    -28559, -28698, -28836, -28972, -29108, -29242, -29375, -29506, -29636, -29763, -29890, -30014, -30137, -30258, -30377, -30493,
+    -30608, -30720, -30830, -30938, -31043, -31146, -31246, -31343, -31439, -31530, -31620, -31706, -31790, -31870, -31948, -32022,
+    -32093, -32161, -32226, -32286, -32345, -32399, -32450, -32496, -32540, -32580, -32616, -32648, -32677, -32702, -32723, -32739,
+    -32753, -32761, -32766, -32767, -32764, -32756, -32745, -32729, -32709, -32685, -32656, -32623, -32586, -32545, -32499, -32449,
+    -32395, -32336, -32273, -32205, -32134, -32057, -31977, -31892, -31802, -31709, -31611, -31508, -31402, -31290, -31175, -31056,
+    -30932, -30804, -30672, -30535, -30395, -30250, -30101, -29948, -29792, -29631, -29466, -29297, -29125, -28949, -28769, -28585,
+    -28397, -28206, -28012, -27814, -27612, -27407, -27199, -26987, -26773, -26555, -26334, -26110, -25883, -25654, -25421, -25186,
+    -24948, -24708, -24465, -24219, -23972, -23722, -23470, -23216, -22960, -22702, -22442, -22180, -21917, -21652, -21386, -21118,
+    -20849, -20579, -20307, -20035, -19762, -19487, -19213, -18937, -18661, -18384, -18107, -17830, -17553, -17275, -16998, -16720,
+    -16443, -16166, -15890, -15614, -15338, -15063, -14789, -14516, -14244, -13973, -13703, -13434, -13166, -12900, -12635, -12372,
+    -12111, -11851, -11593, -11337, -11084, -10832, -10582, -10335, -10090,  -9847,  -9607,  -9369,  -9134,  -8902,  -8673,  -8446,
+     -8223,  -8002,  -7784,  -7570,  -7359,  -7151,  -6946,  -6745,  -6547,  -6353,  -6162,  -5975,  -5791,  -5611,  -5435,  -5263,
+     -5094,  -4930,  -4769,  -4613,  -4460,  -4311,  -4166,  -4026,  -3889,  -3757,  -3629,  -3505,  -3386,  -3270,  -3159,  -3052,
+     -2950,  -2852,  -2757,  -2668,  -2582,  -2501,  -2425,  -2352,  -2284,  -2221,  -2161,  -2106,  -2055,  -2009,  -1966,  -1929,
+     -1895,  -1865,  -1840,  -1819,  -1801,  -1789,  -1780,  -1775,  -1774,  -1778,  -1785,  -1796,  -1811,  -1830,  -1853,  -1880,
+     -1909,  -1944,  -1981,  -2022,  -2067,  -2115,  -2166,  -2221,  -2279,  -2341,  -2405,  -2474,  -2544,  -2618,  -2695,  -2775,
+     -2857,  -2943,  -3030,  -3121,  -3214,  -3310,  -3408,  -3509,  -3611,  -3716,  -3823,  -3933,  -4043,  -4157,  -4271,  -4388,
+     -4506,  -4626,  -4747,  -4871,  -4995,  -5121,  -5247,  -5376,  -5504,  -5635,  -5766,  -5898,  -6030,  -6164,  -6298,  -6433,
+     -6567,  -6703,  -6838,  -6975,  -7111,  -7248,  -7384,  -7520,  -7656,  -7793,  -7928,  -8064,  -8199,  -8334,  -8468,  -8602,
+     -8734,  -8867,  -8998,  -9130,  -9259,  -9388,  -9516,  -9643,  -9768,  -9893, -10016, -10139, -10259, -10379, -10496, -10613,
+    -10727, -10841, -10952, -11063, -11171, -11278, -11382, -11486, -11587, -11687, -11783, -11880, -11973, -12065, -12154, -12242,
+    -12327, -12411, -12491, -12571, -12647, -12723, -12794, -12866, -12933, -13000, -13063, -13125, -13184, -13242, -13296, -13349,
+    -13399, -13448, -13493, -13537, -13578, -13618, -13654, -13690, -13722, -13753, -13781, -13808, -13831, -13854, -13873, -13892,
+    -13907, -13922, -13933, -13943, -13950, -13957, -13961, -13964, -13963, -13963, -13959, -13955, -13948, -13941, -13930, -13920,
+    -13905, -13892, -13875, -13859, -13839, -13820, -13798, -13777, -13751, -13728, -13700, -13674, -13645, -13617, -13585, -13555,
+    -13522, -13491, -13456, -13423, -13386, -13352, -13314, -13279, -13240, -13204, -13164, -13127, -13086, -13049, -13008, -12970,
+    -12928, -12890, -12849, -12810, -12769, -12730, -12689, -12651, -12610, -12572, -12532, -12495, -12455, -12419, -12380, -12344,
+    -12306, -12272, -12234, -12201, -12165, -12133, -12099, -12068, -12035, -12006, -11974, -11947, -11917, -11891, -11863, -11839,
+    -11813, -11791, -11766, -11746, -11723, -11706, -11685, -11669, -11650, -11637, -11620, -11609, -11594, -11585, -11572, -11565,
+    -11555, -11550, -11542, -11540, -11534, -11533, -11530, -11531, -11530, -11533, -11534, -11540, -11542, -11550, -11555, -11565,
+    -11571, -11583, -11592, -11606, -11616, -11631, -11643, -11661, -11674, -11693, -11708, -11728, -11745, -11767, -11784, -11808,
+    -11826, -11851, -11871, -11896, -11917, -11943, -11965, -11992, -12014, -12042, -12065, -12094, -12116, -12145, -12169, -12198,
+    -12221, -12250, -12273, -12302, -12325, -12354, -12377, -12405, -12427, -12455, -12476, -12503, -12524, -12550, -12569, -12595,
+    -12613, -12637, -12653, -12676, -12691, -12713, -12726, -12746, -12758, -12776, -12786, -12802, -12809, -12824, -12829, -12841,
+    -12844, -12854, -12854, -12861, -12859, -12864, -12859, -12862, -12854, -12853, -12843, -12839, -12826, -12820, -12803, -12794,
+    -12774, -12761, -12738, -12723, -12696, -12678, -12648, -12626, -12593, -12568, -12531, -12503, -12463, -12431, -12387, -12353,
+    -12305, -12268, -12216, -12175, -12121, -12077, -12018, -11971, -11909, -11859, -11794, -11740, -11672, -11615, -11543, -11484,
+    -11408, -11346, -11267, -11202, -11121, -11053, -10968, -10898, -10810, -10737, -10647, -10571, -10478, -10401, -10305, -10225,
+    -10127, -10046,  -9945,  -9862,  -9759,  -9674,  -9569,  -9483,  -9376,  -9289,  -9179,  -9092,  -8980,  -8892,  -8779,  -8690,
+     -8576,  -8487,  -8371,  -8282,  -8165,  -8076,  -7958,  -7870,  -7751,  -7663,  -7543,  -7457,  -7336,  -7251,  -7130,  -7046,
+     -6924,  -6842,  -6720,  -6641,  -6518,  -6441,  -6318,  -6244,  -6121,  -6050,  -5926,  -5860,  -5735,  -5674,  -5547,  -5492,
+     -5362,  -5314,  -5182,  -5143,  -5005,  -4977,  -4832,  -4819,  -4662,  -4670,  -4493,  -4535,  -4316,  -4430,  -4097,  -4467,
+    
+    // Level 1: 1024 samples, 511 harmonics
+     -1490,   1032,   1195,   2200,   2662,   3522,   4058,   4856,   5421,   6179,   6753,   7479,   8052,   8750,   9315,   9984,
+     10536,  11176,  11711,  12322,  12836,  13417,  13907,  14456,  14921,  15437,  15873,  16356,  16762,  17210,  17585,  17997,
+     18340,  18716,  19025,  19365,  19641,  19944,  20186,  20453,  20660,  20891,  21065,  21260,  21401,  21561,  21669,  21796,
+     21872,  21967,  22013,  22077,  22093,  22128,  22117,  22123,  22087,  22068,  22007,  21964,  21882,  21818,  21716,  21632,
+     21512,  21411,  21277,  21161,  21013,  20885,  20727,  20589,  20423,  20277,  20105,  19953,  19778,  19624,  19447,  19292,
+     19116,  18962,  18789,  18639,  18471,  18326,  18164,  18026,  17873,  17743,  17600,  17480,  17348,  17240,  17120,  17024,
+     16917,  16835,  16742,  16674,  16596,  16542,  16479,  16441,  16393,  16369,  16337,  16328,  16311,  16317,  16315,  16335,
+     16347,  16382,  16407,  16455,  16493,  16552,  16603,  16674,  16735,  16815,  16886,  16976,  17055,  17152,  17238,  17341,
+     17433,  17541,  17637,  17747,  17846,  17959,  18058,  18171,  18271,  18382,  18480,  18588,  18683,  18787,  18877,  18976,
+     19060,  19153,  19229,  19314,  19383,  19458,  19518,  19584,  19633,  19688,  19727,  19771,  19798,  19830,  19846,  19866,
+     19869,  19876,  19867,  19862,  19840,  19823,  19789,  19760,  19714,  19672,  19615,  19562,  19493,  19430,  19351,  19277,
+     19189,  19106,  19009,  18918,  18814,  18715,  18604,  18500,  18383,  18274,  18153,  18040,  17917,  17802,  17676,  17560,
+     17434,  17318,  17193,  17078,  16956,  16844,  16724,  16616,  16501,  16398,  16289,  16192,  16089,  15999,  15904,  15821,
+     15735,  15661,  15583,  15518,  15450,  15395,  15337,  15293,  15245,  15210,  15173,  15149,  15122,  15108,  15092,  15088,
+     15082,  15088,  15091,  15106,  15118,  15142,  15162,  15193,  15221,  15259,  15293,  15337,  15377,  15425,  15469,  15521,
+     15567,  15621,  15668,  15723,  15771,  15825,  15871,  15922,  15965,  16013,  16052,  16095,  16127,  16163,  16188,  16216,
+     16232,  16250,  16256,  16263,  16258,  16253,  16234,  16216,  16184,  16151,  16104,  16055,  15993,  15928,  15849,  15768,
+     15672,  15573,  15460,  15344,  15214,  15080,  14932,  14782,  14616,  14448,  14266,  14082,  13883,  13682,  13468,  13253,
+     13024,  12794,  12552,  12310,  12055,  11801,  11537,  11273,  10999,  10727,  10446,  10168,   9881,   9599,   9309,   9024,
+      8734,   8449,   8160,   7877,   7591,   7313,   7033,   6762,   6490,   6228,   5967,   5717,   5468,   5232,   4999,   4779,
+      4563,   4362,   4166,   3985,   3810,   3652,   3501,   3368,   3242,   3135,   3036,   2957,   2887,   2836,   2796,   2776,
+      2767,   2778,   2801,   2844,   2899,   2975,   3063,   3172,   3292,   3434,   3588,   3762,   3948,   4155,   4373,   4611,
+      4860,   5129,   5408,   5706,   6014,   6340,   6675,   7027,   7388,   7764,   8148,   8547,   8952,   9371,   9795,  10232,
+     10673,  11125,  11579,  12043,  12509,  12983,  13456,  13937,  14416,  14900,  15381,  15866,  16346,  16829,  17306,  17783,
+     18253,  18722,  19183,  19641,  20088,  20532,  20964,  21391,  21805,  22212,  22605,  22991,  23361,  23722,  24066,  24400,
+     24717,  25023,  25310,  25586,  25842,  26085,  26309,  26519,  26708,  26884,  27039,  27179,  27298,  27403,  27486,  27554,
+     27601,  27633,  27643,  27638,  27613,  27572,  27511,  27435,  27339,  27229,  27099,  26955,  26793,  26617,  26423,  26217,
+     25993,  25758,  25506,  25243,  24965,  24678,  24375,  24065,  23741,  23409,  23065,  22715,  22354,  21987,  21611,  21231,
+     20842,  20450,  20051,  19650,  19244,  18836,  18424,  18013,  17597,  17184,  16768,  16355,  15941,  15530,  15119,  14713,
+     14307,  13908,  13510,  13118,  12729,  12347,  11968,  11598,  11231,  10873,  10519,  10175,   9835,   9505,   9180,   8864,
+      8555,   8255,   7961,   7678,   7400,   7133,   6871,   6619,   6373,   6137,   5907,   5686,   5471,   5265,   5064,   4873,
+      4685,   4506,   4332,   4165,   4002,   3846,   3694,   3548,   3404,   3267,   3131,   3001,   2872,   2747,   2623,   2503,
+      2382,   2265,   2147,   2031,   1913,   1797,   1679,   1561,   1441,   1321,   1197,   1073,    945,    816,    682,    547,
+       406,    264,    116,    -35,   -191,   -350,   -516,   -684,   -859,  -1037,  -1222,  -1410,  -1605,  -1803,  -2008,  -2217,
+     -2432,  -2651,  -2875,  -3104,  -3338,  -3576,  -3819,  -4065,  -4317,  -4571,  -4830,  -5092,  -5358,  -5626,  -5897,  -6170,
+     -6447,  -6724,  -7004,  -7284,  -7566,  -7848,  -8132,  -8414,  -8697,  -8979,  -9261,  -9541,  -9819, -10096, -10371, -10642,
+    -10912, -11177, -11440, -11699, -11954, -12205, -12451, -12692, -12929, -13160, -13386, -13606, -13821, -14030, -14232, -14428,
+    -14618, -14801, -14979, -15149, -15313, -15469, -15620, -15764, -15901, -16031, -16156, -16273, -16385, -16490, -16589, -16682,
+    -16770, -16852, -16929, -17001, -17068, -17130, -17188, -17243, -17293, -17340, -17384, -17425, -17464, -17501, -17536, -17570,
+    -17603, -17636, -17668, -17700, -17733, -17766, -17802, -17838, -17877, -17918, -17962, -18009, -18060, -18115, -18173, -18236,
+    -18304, -18377, -18455, -18540, -18629, -18725, -18828, -18937, -19052, -19175, -19304, -19441, -19585, -19736, -19895, -20061,
+    -20235, -20416, -20604, -20800, -21002, -21213, -21430, -21654, -21884, -22121, -22364, -22614, -22868, -23129, -23394, -23664,
+    -23938, -24217, -24499, -24784, -25072, -25362, -25654, -25948, -26241, -26536, -26830, -27124, -27415, -27706, -27993, -28278,
+    -28559, -28836, -29108, -29375, -29635, -29890, -30137, -30377, -30607, -30830, -31043, -31246, -31438, -31620, -31790, -31948,
+    -32093, -32226, -32344, -32450, -32540, -32617, -32677, -32723, -32752, -32767, -32763, -32745, -32709, -32657, -32586, -32500,
+    -32394, -32273, -32133, -31977, -31802, -31611, -31401, -31176, -30931, -30672, -30394, -30102, -29791, -29467, -29124, -28769,
+    -28397, -28012, -27612, -27200, -26772, -26335, -25883, -25422, -24947, -24465, -23971, -23471, -22959, -22442, -21916, -21386,
+    -20848, -20308, -19761, -19213, -18660, -18108, -17552, -16998, -16442, -15890, -15337, -14790, -14243, -13703, -13165, -12636,
+    -12110, -11594, -11083, -10583, -10089,  -9608,  -9134,  -8674,  -8222,  -7785,  -7358,  -6947,  -6546,  -6163,  -5790,  -5436,
+     -5094,  -4770,  -4459,  -4167,  -3889,  -3630,  -3385,  -3160,  -2949,  -2758,  -2581,  -2426,  -2283,  -2162,  -2054,  -1967,
+     -1894,  -1841,  -1801,  -1781,  -1773,  -1786,  -1810,  -1854,  -1909,  -1982,  -2066,  -2168,  -2278,  -2407,  -2543,  -2696,
+     -2856,  -3032,  -3213,  -3409,  -3610,  -3825,  -4042,  -4273,  -4505,  -4749,  -4994,  -5249,  -5503,  -5767,  -6029,  -6299,
+     -6566,  -6840,  -7110,  -7385,  -7655,  -7930,  -8198,  -8470,  -8733,  -9000,  -9258,  -9517,  -9767, -10018, -10258, -10498,
+    -10726, -10954, -11170, -11384, -11585, -11786, -11971, -12156, -12325, -12493, -12646, -12797, -12932, -13065, -13182, -13298,
+    -13397, -13495, -13577, -13657, -13720, -13783, -13830, -13876, -13905, -13935, -13949, -13963, -13962, -13962, -13946, -13932,
+    -13904, -13878, -13838, -13801, -13750, -13703, -13643, -13588, -13520, -13459, -13385, -13317, -13238, -13167, -13085, -13011,
+    -12927, -12852, -12767, -12692, -12608, -12535, -12453, -12383, -12304, -12238, -12163, -12102, -12033, -11978, -11915, -11867,
+    -11811, -11770, -11721, -11689, -11648, -11624, -11592, -11577, -11553, -11547, -11531, -11534, -11527, -11538, -11540, -11560,
+    -11569, -11597, -11613, -11648, -11671, -11713, -11742, -11789, -11824, -11876, -11914, -11970, -12012, -12071, -12114, -12174,
+    -12218, -12279, -12322, -12383, -12424, -12482, -12520, -12576, -12609, -12660, -12688, -12733, -12754, -12793, -12806, -12836,
+    -12840, -12862, -12856, -12867, -12850, -12851, -12822, -12811, -12769, -12747, -12692, -12657, -12588, -12541, -12458, -12398,
+    -12300, -12227, -12116, -12030, -11904, -11806, -11666, -11556, -11403, -11281, -11115, -10982, -10804, -10662, -10471, -10321,
+    -10120,  -9962,  -9751,  -9587,  -9367,  -9199,  -8972,  -8801,  -8566,  -8395,  -8155,  -7984,  -7739,  -7572,  -7323,  -7162,
+     -6910,  -6757,  -6501,  -6360,  -6101,  -5976,  -5711,  -5608,  -5333,  -5261,  -4967,  -4943,  -4605,  -4676,  -4205,  -4606,
+    
+    // Level 2: 512 samples, 255 harmonics
+     -1689,   1733,   2567,   4256,   5370,   6874,   8018,   9401,  10510,  11779,  12815,  13963,  14903,  15920,  16747,  17626,
+     18327,  19062,  19629,  20218,  20650,  21094,  21391,  21696,  21864,  22038,  22085,  22140,  22080,  22029,  21875,  21736,
+     21506,  21295,  21007,  20745,  20417,  20122,  19773,  19463,  19111,  18804,  18466,  18178,  17868,  17613,  17343,  17133,
+     16913,  16755,  16592,  16492,  16389,  16349,  16308,  16326,  16344,  16418,  16490,  16614,  16732,  16897,  17052,  17248,
+     17430,  17646,  17843,  18068,  18268,  18489,  18680,  18886,  19057,  19238,  19380,  19526,  19631,  19735,  19796,  19853,
+     19866,  19875,  19838,  19797,  19712,  19622,  19491,  19358,  19187,  19016,  18812,  18611,  18381,  18160,  17915,  17683,
+     17432,  17200,  16954,  16731,  16500,  16295,  16087,  15910,  15733,  15589,  15449,  15343,  15243,  15179,  15121,  15097,
+     15080,  15096,  15117,  15167,  15220,  15298,  15375,  15473,  15565,  15673,  15769,  15875,  15964,  16057,  16126,  16193,
+     16231,  16261,  16257,  16239,  16182,  16108,  15991,  15853,  15671,  15464,  15213,  14936,  14615,  14270,  13882,  13472,
+     13023,  12556,  12055,  11540,  10998,  10449,   9880,   9313,   8733,   8163,   7591,   7037,   6489,   5970,   5468,   5002,
+      4563,   4169,   3810,   3504,   3241,   3039,   2886,   2799,   2766,   2804,   2898,   3066,   3292,   3590,   3948,   4376,
+      4860,   5411,   6013,   6678,   7387,   8151,   8952,   9798,  10672,  11581,  12508,  13459,  14415,  15383,  16346,  17308,
+     18253,  19185,  20088,  20966,  21804,  22607,  23360,  24068,  24717,  25312,  25841,  26311,  26708,  27041,  27298,  27488,
+     27601,  27645,  27612,  27513,  27339,  27101,  26792,  26425,  25993,  25507,  24965,  24377,  23740,  23067,  22354,  21612,
+     20842,  20052,  19243,  18425,  17597,  16769,  15940,  15120,  14307,  13511,  12729,  11970,  11231,  10520,   9835,   9181,
+      8555,   7963,   7400,   6872,   6373,   5908,   5471,   5065,   4685,   4333,   4002,   3695,   3405,   3132,   2872,   2624,
+      2383,   2147,   1913,   1679,   1441,   1198,    945,    683,    406,    116,   -191,   -515,   -859,  -1222,  -1605,  -2008,
+     -2432,  -2875,  -3338,  -3819,  -4316,  -4830,  -5357,  -5897,  -6446,  -7004,  -7566,  -8132,  -8697,  -9261,  -9819, -10371,
+    -10911, -11440, -11954, -12451, -12929, -13387, -13821, -14232, -14618, -14979, -15312, -15620, -15900, -16156, -16384, -16589,
+    -16769, -16929, -17067, -17189, -17292, -17385, -17464, -17537, -17603, -17668, -17732, -17802, -17876, -17963, -18059, -18174,
+    -18303, -18456, -18629, -18829, -19051, -19305, -19584, -19896, -20234, -20605, -21002, -21431, -21883, -22365, -22867, -23395,
+    -23937, -24500, -25071, -25655, -26240, -26831, -27414, -27994, -28558, -29109, -29634, -30138, -30606, -31044, -31437, -31791,
+    -32092, -32346, -32539, -32679, -32751, -32765, -32707, -32588, -32393, -32135, -31801, -31403, -30930, -30396, -29790, -29127,
+    -28396, -27614, -26771, -25885, -24946, -23974, -22958, -21919, -20847, -19764, -18659, -17555, -16441, -15340, -14242, -13168,
+    -12109, -11086, -10087,  -9137,  -8220,  -7361,  -6545,  -5794,  -5092,  -4462,  -3887,  -3388,  -2947,  -2585,  -2282,  -2058,
+     -1892,  -1804,  -1772,  -1814,  -1907,  -2070,  -2276,  -2547,  -2854,  -3218,  -3608,  -4047,  -4503,  -4998,  -5501,  -6034,
+     -6564,  -7115,  -7653,  -8203,  -8731,  -9263,  -9765, -10263, -10724, -11175, -11583, -11977, -12323, -12652, -12929, -13189,
+    -13395, -13583, -13718, -13836, -13903, -13956, -13959, -13953, -13901, -13845, -13747, -13651, -13517, -13392, -13235, -13093,
+    -12923, -12775, -12605, -12462, -12300, -12173, -12029, -11925, -11807, -11731, -11644, -11602, -11549, -11542, -11523, -11551,
+    -11565, -11625, -11667, -11755, -11819, -11927, -12006, -12127, -12213, -12337, -12418, -12536, -12603, -12705, -12748, -12823,
+    -12833, -12874, -12843, -12842, -12762, -12714, -12580, -12481, -12291, -12141, -11894, -11694, -11392, -11146, -10791, -10506,
+    -10106,  -9791,  -9352,  -9018,  -8548,  -8209,  -7718,  -7390,  -6883,  -6588,  -6065,  -5833,  -5280,  -5168,  -4501,  -4772,
+    
+    // Level 3: 256 samples, 127 harmonics
+     -1703,   3099,   5281,   8216,  10461,  12936,  14871,  16834,  18302,  19697,  20630,  21447,  21848,  22132,  22066,  21916,
+     21494,  21043,  20406,  19804,  19101,  18494,  17859,  17369,  16905,  16616,  16382,  16329,  16337,  16510,  16726,  17071,
+     17425,  17861,  18263,  18696,  19053,  19395,  19626,  19810,  19862,  19852,  19708,  19504,  19183,  18824,  18378,  17927,
+     17429,  16965,  16497,  16098,  15730,  15459,  15241,  15130,  15078,  15126,  15217,  15384,  15563,  15777,  15962,  16134,
+     16229,  16264,  16181,  15998,  15669,  15219,  14614,  13888,  13022,  12061,  10997,   9886,   8732,   7596,   6488,   5473,
+      4561,   3814,   3240,   2891,   2765,   2903,   3291,   3952,   4859,   6017,   7387,   8955,  10672,  12512,  14415,  16349,
+     18253,  20091,  21804,  23363,  24717,  25844,  26708,  27300,  27600,  27615,  27339,  26794,  25993,  24967,  23741,  22355,
+     20842,  19245,  17598,  15942,  14308,  12730,  11231,   9836,   8555,   7401,   6374,   5472,   4686,   4002,   3405,   2872,
+      2383,   1913,   1442,    945,    407,   -191,   -858,  -1605,  -2431,  -3339,  -4315,  -5359,  -6445,  -7567,  -8696,  -9821,
+    -10910, -11956, -12928, -13823, -14617, -15314, -15899, -16386, -16768, -17070, -17291, -17467, -17601, -17735, -17875, -18062,
+    -18302, -18632, -19050, -19588, -20232, -21006, -21881, -22871, -23935, -25075, -26238, -27419, -28556, -29639, -30604, -31442,
+    -32089, -32544, -32749, -32713, -32391, -31807, -30928, -29796, -28393, -26777, -24943, -22965, -20844, -18666, -16438, -14249,
+    -12105, -10095,  -8217,  -6553,  -5088,  -3896,  -2943,  -2291,  -1888,  -1781,  -1903,  -2287,  -2850,  -3619,  -4499,  -5512,
+     -6559,  -7665,  -8726,  -9777, -10719, -11596, -12318, -12943, -13389, -13733, -13897, -13975, -13895, -13764, -13511, -13253,
+    -12916, -12624, -12293, -12050, -11799, -11667, -11540, -11547, -11555, -11693, -11809, -12036, -12202, -12450, -12591, -12784,
+    -12820, -12884, -12746, -12628, -12273, -11951, -11370, -10861, -10079,  -9441,  -8512,  -7843,  -6829,  -6274,  -5174,  -5096,
+    
+    // Level 4: 128 samples, 63 harmonics
+     -1537,   5779,  10385,  15060,  18259,  20745,  21819,  22147,  21473,  20469,  19085,  17910,  16892,  16424,  16327,  16761,
+     17415,  18293,  19045,  19653,  19856,  19731,  19178,  18398,  17425,  16515,  15726,  15257,  15075,  15231,  15561,  15975,
+     16227,  16192,  15667,  14623,  13020,  11005,   8731,   6495,   4561,   3246,   2765,   3296,   4859,   7391,  10672,  14418,
+     18253,  21807,  24718,  26709,  27602,  27340,  25994,  23740,  20844,  17597,  14310,  11230,   8557,   6371,   4688,   3402,
+      2386,   1438,    410,   -863,  -2427,  -4321,  -6442,  -8702, -10906, -12935, -14613, -15907, -16764, -17300, -17596, -17884,
+    -18297, -19060, -20227, -21892, -23930, -26250, -28550, -30617, -32083, -32763, -32384, -30943, -28386, -24960, -20837, -16456,
+    -12098,  -8236,  -5080,  -2965,  -1879,  -1926,  -2840,  -4524,  -6549,  -8754, -10708, -12348, -13377, -13931, -13881, -13549,
+    -12901, -12336, -11782, -11590, -11536, -11868, -12178, -12663, -12791, -12839, -12235, -11500, -10021,  -8729,  -6714,  -5804,
+    
+    // Level 5: 64 samples, 31 harmonics
+     -1099,  10795,  18214,  21977,  21447,  19177,  16877,  16388,  17407,  19088,  19851,  19208,  17423,  15748,  15075,  15575,
+     16229,  15676,  13024,   8735,   4566,   2765,   4865,  10668,  18261,  24710,  27610,  25984,  20853,  14296,   8568,   4672,
+      2397,    391,  -2415,  -6464, -10893, -14638, -16749, -17625, -18281, -20259, -23913, -28585, -32065, -32424, -28367, -20881,
+    -12076,  -5131,  -1856,  -2899,  -6523, -10776, -13347, -13964, -12865, -11886, -11489, -12321, -12723, -12471,  -9887,  -7414,
+    
+    // Level 6: 64 samples, 16 harmonics
+      -228,   9819,  18491,  22212,  21384,  18920,  17044,  16488,  17325,  18966,  19974,  19263,  17340,  15685,  15174,  15606,
+     16148,  15648,  13107,   8750,   4487,   2762,   4935,  10672,  18184,  24727,  27669,  25978,  20778,  14330,   8617,   4658,
+      2325,    441,  -2377,  -6487, -10963, -14571, -16722, -17657, -18348, -20174, -23898, -28627, -32128, -32318, -28368, -20936,
+    -12133,  -4996,  -1881,  -2971,  -6569, -10596, -13415, -14063, -12887, -11620, -11661, -12473, -12658, -11960, -10629,  -7358,
+    
+    // Level 7: 64 samples, 8 harmonics
+      1986,  10684,  17421,  20801,  20953,  19279,  17564,  17006,  17700,  18820,  19330,  18724,  17335,  16039,  15568,  15909,
+     16215,  15325,  12590,   8504,   4685,   3151,   5245,  10801,  18043,  24314,  27279,  25970,  21135,  14719,   8805,   4601,
+      2017,      7,  -2591,  -6249, -10484, -14250, -16720, -17920, -18781, -20543, -23852, -28117, -31587, -32183, -28654, -21425,
+    -12615,  -5151,  -1417,  -2142,  -6123, -10927, -14181, -14753, -13180, -11146, -10337, -11344, -13241, -14077, -11991,  -6309,
+    
+    // Level 8: 64 samples, 4 harmonics
+      1350,   5868,  10302,  14356,  17775,  20371,  22039,  22758,  22592,  21676,  20197,  18369,  16413,  14531,  12895,  11629,
+     10807,  10454,  10551,  11041,  11844,  12857,  13973,  15076,  16051,  16788,  17175,  17110,  16500,  15269,  13362,  10759,
+      7483,   3604,   -755,  -5420, -10173, -14765, -18939, -22449, -25086, -26700, -27223, -26673, -25161, -22883, -20099, -17107,
+    -14214, -11701,  -9791,  -8622,  -8236,  -8571,  -9467, -10690, -11953, -12958, -13426, -13132, -11932,  -9780,  -6733,  -2946,
+    
+    // Level 9: 64 samples, 2 harmonics
+      5883,   7418,   8813,  10068,  11187,  12179,  13052,  13818,  14489,  15076,  15590,  16040,  16433,  16772,  17057,  17286,
+     17452,  17548,  17559,  17474,  17275,  16948,  16475,  15842,  15035,  14045,  12864,  11490,   9925,   8178,   6260,   4191,
+      1995,   -301,  -2662,  -5053,  -7433,  -9762, -11998, -14099, -16028, -17746, -19220, -20424, -21334, -21935, -22216, -22174,
+    -21816, -21150, -20195, -18974, -17515, -15850, -14015, -12046,  -9982,  -7861,  -5719,  -3591,  -1509,    500,   2413,   4212,
+    
+    // Level 10: 64 samples, 1 harmonics
+      2823,   4738,   6616,   8439,  10189,  11849,  13404,  14837,  16137,  17290,  18284,  19111,  19762,  20232,  20515,  20609,
+     20513,  20228,  19756,  19103,  18274,  17278,  16124,  14822,  13387,  11831,  10170,   8419,   6596,   4717,   2802,    868,
+     -1066,  -2981,  -4859,  -6682,  -8431, -10092, -11646, -13080, -14380, -15532, -16527, -17354, -18005, -18474, -18758, -18851,
+    -18755, -18470, -17999, -17346, -16517, -15520, -14366, -13065, -11630, -10074,  -8413,  -6662,  -4839,  -2960,  -1045,    889,
     
 };
 
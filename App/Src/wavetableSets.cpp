@@ -0,0 +1,4014 @@
+#include "waveforms.h"
+
+alignas(4) const int16_t wavetableSet_Pulse[16 * FrameMip::FRAME_SIZE] = {
+    // Frame 0
+     14882,  15031,  14882,  15031,  14882,  15032,  14882,  15032,  14881,  15033,  14880,  15034,  14879,  15035,  14878,  15036,
+     14876,  15038,  14874,  15040,  14872,  15042,  14870,  15045,  14867,  15048,  14864,  15051,  14861,  15055,  14856,  15059,
+     14852,  15065,  14846,  15071,  14840,  15078,  14832,  15086,  14823,  15096,  14812,  15108,  14799,  15122,  14783,  15140,
+     14763,  15163,  14736,  15194,  14701,  15235,  14651,  15295,  14577,  15390,  14453,  15560,  14207,  15948,  13503,  17634,
+         0, -17634, -13503, -15948, -14207, -15560, -14453, -15390, -14577, -15295, -14651, -15235, -14701, -15194, -14736, -15163,
+    -14763, -15140, -14783, -15122, -14799, -15108, -14812, -15096, -14823, -15086, -14832, -15078, -14840, -15071, -14846, -15065,
+    -14852, -15059, -14856, -15055, -14861, -15051, -14864, -15048, -14867, -15045, -14870, -15042, -14872, -15040, -14874, -15038,
+    -14876, -15036, -14878, -15035, -14879, -15034, -14880, -15033, -14881, -15032, -14882, -15032, -14882, -15031, -14882, -15031,
+    -14882, -15031, -14882, -15031, -14882, -15032, -14882, -15032, -14881, -15033, -14880, -15034, -14879, -15035, -14878, -15036,
+    -14876, -15038, -14874, -15040, -14872, -15042, -14870, -15045, -14867, -15048, -14864, -15051, -14861, -15055, -14856, -15059,
+    -14852, -15065, -14846, -15071, -14840, -15078, -14832, -15086, -14823, -15096, -14812, -15108, -14799, -15122, -14783, -15140,
+    -14763, -15163, -14736, -15194, -14701, -15235, -14651, -15295, -14577, -15390, -14453, -15560, -14207, -15948, -13503, -17634,
+         0,  17634,  13503,  15948,  14207,  15560,  14453,  15390,  14577,  15295,  14651,  15235,  14701,  15194,  14736,  15163,
+     14763,  15140,  14783,  15122,  14799,  15108,  14812,  15096,  14823,  15086,  14832,  15078,  14840,  15071,  14846,  15065,
+     14852,  15059,  14856,  15055,  14861,  15051,  14864,  15048,  14867,  15045,  14870,  15042,  14872,  15040,  14874,  15038,
+     14876,  15036,  14878,  15035,  14879,  15034,  14880,  15033,  14881,  15032,  14882,  15032,  14882,  15031,  14882,  15031,
+     14808,  15106,  14807,  15107,  14805,  15110,  14801,  15115,  14796,  15121,  14788,  15130,  14778,  15142,  14764,  15157,
+     14747,  15178,  14722,  15206,  14689,  15246,  14642,  15304,  14569,  15397,  14447,  15564,  14203,  15950,  13501,  17635,
+         0, -17635, -13501, -15950, -14203, -15564, -14447, -15397, -14569, -15304, -14642, -15246, -14689, -15206, -14722, -15178,
+    -14747, -15157, -14764, -15142, -14778, -15130, -14788, -15121, -14796, -15115, -14801, -15110, -14805, -15107, -14807, -15106,
+    -14808, -15106, -14807, -15107, -14805, -15110, -14801, -15115, -14796, -15121, -14788, -15130, -14778, -15142, -14764, -15157,
+    -14747, -15178, -14722, -15206, -14689, -15246, -14642, -15304, -14569, -15397, -14447, -15564, -14203, -15950, -13501, -17635,
+         0,  17635,  13501,  15950,  14203,  15564,  14447,  15397,  14569,  15304,  14642,  15246,  14689,  15206,  14722,  15178,
+     14747,  15157,  14764,  15142,  14778,  15130,  14788,  15121,  14796,  15115,  14801,  15110,  14805,  15107,  14807,  15106,
+     14659,  15255,  14654,  15267,  14635,  15294,  14600,  15341,  14537,  15424,  14424,  15583,  14188,  15961,  13494,  17639,
+         0, -17639, -13494, -15961, -14188, -15583, -14424, -15424, -14537, -15341, -14600, -15294, -14635, -15267, -14654, -15255,
+    -14659, -15255, -14654, -15267, -14635, -15294, -14600, -15341, -14537, -15424, -14424, -15583, -14188, -15961, -13494, -17639,
+         0,  17639,  13494,  15961,  14188,  15583,  14424,  15424,  14537,  15341,  14600,  15294,  14635,  15267,  14654,  15255,
+     14364,  14960,  15561,  14945,  14316,  14979,  15667,  14919,  14124,  15025,  16007,  14821,  13464,  15308,  17653,  13058,
+         0, -13058, -17653, -15308, -13464, -14821, -16007, -15025, -14124, -14919, -15667, -14979, -14316, -14945, -15561, -14960,
+    -14364, -14960, -15561, -14945, -14316, -14979, -15667, -14919, -14124, -15025, -16007, -14821, -13464, -15308, -17653, -13058,
+         0,  13058,  17653,  15308,  13464,  14821,  16007,  15025,  14124,  14919,  15667,  14979,  14316,  14945,  15561,  14960,
+     13784,  14133,  14985,  15852,  16221,  15832,  14848,  13802,  13338,  13866,  15287,  16921,  17712,  16625,  13077,   7231,
+         0,  -7231, -13077, -16625, -17712, -16921, -15287, -13866, -13338, -13802, -14848, -15832, -16221, -15852, -14985, -14133,
+    -13784, -14133, -14985, -15852, -16221, -15832, -14848, -13802, -13338, -13866, -15287, -16921, -17712, -16625, -13077,  -7231,
+         0,   7231,  13077,  16625,  17712,  16921,  15287,  13866,  13338,  13802,  14848,  15832,  16221,  15852,  14985,  14133,
+     12696,  12877,  13400,  14196,  15165,  16173,  17073,  17713,  17954,  17679,  16806,  15294,  13152,  10435,   7242,   3709,
+         0,  -3709,  -7242, -10435, -13152, -15294, -16806, -17679, -17954, -17713, -17073, -16173, -15165, -14196, -13400, -12877,
+    -12696, -12877, -13400, -14196, -15165, -16173, -17073, -17713, -17954, -17679, -16806, -15294, -13152, -10435,  -7242,  -3709,
+         0,   3709,   7242,  10435,  13152,  15294,  16806,  17679,  17954,  17713,  17073,  16173,  15165,  14196,  13400,  12877,
+     19044,  18952,  18678,  18224,  17594,  16795,  15834,  14721,  13466,  12081,  10580,   8977,   7288,   5528,   3715,   1867,
+         0,  -1867,  -3715,  -5528,  -7288,  -8977, -10580, -12081, -13466, -14721, -15834, -16795, -17594, -18224, -18678, -18952,
+    -19044, -18952, -18678, -18224, -17594, -16795, -15834, -14721, -13466, -12081, -10580,  -8977,  -7288,  -5528,  -3715,  -1867,
+         0,   1867,   3715,   5528,   7288,   8977,  10580,  12081,  13466,  14721,  15834,  16795,  17594,  18224,  18678,  18952,
+     19044,  18952,  18678,  18224,  17594,  16795,  15834,  14721,  13466,  12081,  10580,   8977,   7288,   5528,   3715,   1867,
+         0,  -1867,  -3715,  -5528,  -7288,  -8977, -10580, -12081, -13466, -14721, -15834, -16795, -17594, -18224, -18678, -18952,
+    -19044, -18952, -18678, -18224, -17594, -16795, -15834, -14721, -13466, -12081, -10580,  -8977,  -7288,  -5528,  -3715,  -1867,
+         0,   1867,   3715,   5528,   7288,   8977,  10580,  12081,  13466,  14721,  15834,  16795,  17594,  18224,  18678,  18952,
+    
+    // Frame 1
+     15746,  15962,  15746,  15962,  15746,  15963,  15746,  15963,  15745,  15964,  15744,  15965,  15743,  15966,  15741,  15968,
+     15740,  15970,  15738,  15972,  15736,  15974,  15733,  15977,  15730,  15980,  15726,  15984,  15722,  15988,  15717,  15994,
+     15712,  16000,  15705,  16007,  15697,  16015,  15688,  16026,  15677,  16038,  15662,  16054,  15645,  16075,  15621,  16101,
+     15591,  16138,  15547,  16190,  15481,  16274,  15372,  16423,  15157,  16763,  14539,  18231,   5578, -16277, -12842, -14881,
+    -13445, -14547, -13658, -14399, -13766, -14316, -13831, -14264, -13874, -14228, -13905, -14201, -13928, -14181, -13946, -14165,
+    -13960, -14152, -13972, -14142, -13981, -14133, -13989, -14126, -13996, -14120, -14002, -14114, -14007, -14110, -14011, -14106,
+    -14015, -14102, -14018, -14099, -14021, -14097, -14023, -14094, -14025, -14092, -14027, -14090, -14029, -14089, -14030, -14088,
+    -14032, -14086, -14033, -14085, -14034, -14085, -14034, -14084, -14035, -14083, -14036, -14083, -14036, -14083, -14036, -14083,
+    -14036, -14083, -14036, -14083, -14036, -14083, -14036, -14083, -14035, -14084, -14034, -14085, -14034, -14085, -14033, -14086,
+    -14032, -14088, -14030, -14089, -14029, -14090, -14027, -14092, -14025, -14094, -14023, -14097, -14021, -14099, -14018, -14102,
+    -14015, -14106, -14011, -14110, -14007, -14114, -14002, -14120, -13996, -14126, -13989, -14133, -13981, -14142, -13972, -14152,
+    -13960, -14165, -13946, -14181, -13928, -14201, -13905, -14228, -13874, -14264, -13831, -14316, -13766, -14399, -13658, -14547,
+    -13445, -14881, -12842, -16277,   5578,  18231,  14539,  16763,  15157,  16423,  15372,  16274,  15481,  16190,  15547,  16138,
+     15591,  16101,  15621,  16075,  15645,  16054,  15662,  16038,  15677,  16026,  15688,  16015,  15697,  16007,  15705,  16000,
+     15712,  15994,  15717,  15988,  15722,  15984,  15726,  15980,  15730,  15977,  15733,  15974,  15736,  15972,  15738,  15970,
+     15740,  15968,  15741,  15966,  15743,  15965,  15744,  15964,  15745,  15963,  15746,  15963,  15746,  15962,  15746,  15962,
+     15658,  16050,  15657,  16052,  15655,  16056,  15650,  16061,  15644,  16069,  15634,  16080,  15622,  16094,  15605,  16114,
+     15582,  16141,  15550,  16179,  15504,  16235,  15434,  16325,  15316,  16487,  15080,  16861,  14401,  18486,   3238, -16593,
+    -12697, -14976, -13374, -14603, -13610, -14441, -13728, -14351, -13799, -14295, -13845, -14256, -13877, -14229, -13901, -14209,
+    -13918, -14193, -13932, -14181, -13942, -14172, -13950, -14165, -13956, -14160, -13960, -14157, -13963, -14154, -13965, -14153,
+    -13966, -14153, -13965, -14154, -13963, -14157, -13960, -14160, -13956, -14165, -13950, -14172, -13942, -14181, -13932, -14193,
+    -13918, -14209, -13901, -14229, -13877, -14256, -13845, -14295, -13799, -14351, -13728, -14441, -13610, -14603, -13374, -14976,
+    -12697, -16593,   3238,  18486,  14401,  16861,  15080,  16487,  15316,  16325,  15434,  16235,  15504,  16179,  15550,  16141,
+     15582,  16114,  15605,  16094,  15622,  16080,  15634,  16069,  15644,  16061,  15650,  16056,  15655,  16052,  15657,  16050,
+     16217,  15490,  16224,  15475,  16247,  15443,  16291,  15383,  16372,  15272,  16529,  15039,  16903,  14351,  18565,   2041,
+    -16665, -12660, -15004, -13349, -14628, -13583, -14470, -13697, -14386, -13760, -14338, -13797, -14309, -13818, -14294, -13828,
+    -14289, -13828, -14294, -13818, -14309, -13797, -14338, -13760, -14386, -13697, -14470, -13583, -14628, -13349, -15004, -12660,
+    -16665,   2041,  18565,  14351,  16903,  15039,  16529,  15272,  16372,  15383,  16291,  15443,  16247,  15475,  16224,  15490,
+     15260,  15918,  16447,  15655,  15264,  16207,  16437,  15305,  15289,  16690,  16373,  14513,  15501,  18457,  14906,   1525,
+    -12349, -16721, -13963, -12658, -14420, -14959, -13611, -13441, -14547, -14488, -13551, -13776, -14578, -14222, -13535, -14006,
+    -14586, -14006, -13535, -14222, -14578, -13776, -13551, -14488, -14547, -13441, -13611, -14959, -14420, -12658, -13963, -16721,
+    -12349,   1525,  14906,  18457,  15501,  14513,  16373,  16690,  15289,  15305,  16437,  16207,  15264,  15655,  16447,  15918,
+     14210,  14758,  16052,  17255,  17559,  16703,  15170,  13941,  13920,  15343,  17514,  19032,  18415,  14818,   8477,    656,
+     -6867, -12527, -15554, -16159, -15275, -14033, -13259, -13215, -13674, -14201, -14468, -14410, -14182, -13988, -13932, -13973,
+    -14004, -13973, -13932, -13988, -14182, -14410, -14468, -14201, -13674, -13215, -13259, -14033, -15275, -16159, -15554, -12527,
+     -6867,    656,   8477,  14818,  18415,  19032,  17514,  15343,  13920,  13941,  15170,  16703,  17559,  17255,  16052,  14758,
+     12895,  13165,  13935,  15088,  16445,  17785,  18875,  19496,  19469,  18675,  17068,  14683,  11625,   8061,   4198,    259,
+     -3537,  -6997,  -9973, -12370, -14149, -15324, -15955, -16132, -15964, -15562, -15031, -14461, -13921, -13463, -13117, -12904,
+    -12832, -12904, -13117, -13463, -13921, -14461, -15031, -15562, -15964, -16132, -15955, -15324, -14149, -12370,  -9973,  -6997,
+     -3537,    259,   4198,   8061,  11625,  14683,  17068,  18675,  19469,  19496,  18875,  17785,  16445,  15088,  13935,  13165,
+     20743,  20618,  20243,  19626,  18777,  17712,  16447,  15004,  13406,  11679,   9850,   7946,   5994,   4020,   2050,    108,
+     -1784,  -3608,  -5347,  -6987,  -8517,  -9928, -11216, -12376, -13406, -14307, -15081, -15729, -16254, -16659, -16946, -17118,
+    -17175, -17118, -16946, -16659, -16254, -15729, -15081, -14307, -13406, -12376, -11216,  -9928,  -8517,  -6987,  -5347,  -3608,
+     -1784,    108,   2050,   4020,   5994,   7946,   9850,  11679,  13406,  15004,  16447,  17712,  18777,  19626,  20243,  20618,
+     18959,  18868,  18595,  18143,  17516,  16720,  15764,  14656,  13406,  12027,  10533,   8937,   7255,   5504,   3699,   1858,
+         0,  -1858,  -3699,  -5504,  -7255,  -8937, -10533, -12027, -13406, -14656, -15764, -16720, -17516, -18143, -18595, -18868,
+    -18959, -18868, -18595, -18143, -17516, -16720, -15764, -14656, -13406, -12027, -10533,  -8937,  -7255,  -5504,  -3699,  -1858,
+         0,   1858,   3699,   5504,   7255,   8937,  10533,  12027,  13406,  14656,  15764,  16720,  17516,  18143,  18595,  18868,
+    
+    // Frame 2
+     16640,  16863,  16640,  16863,  16640,  16864,  16639,  16864,  16639,  16865,  16638,  16865,  16637,  16866,  16636,  16868,
+     16635,  16869,  16633,  16871,  16632,  16873,  16629,  16875,  16627,  16878,  16624,  16881,  16621,  16884,  16617,  16889,
+     16612,  16894,  16606,  16900,  16599,  16908,  16590,  16918,  16579,  16931,  16565,  16947,  16546,  16970,  16518,  17003,
+     16477,  17056,  16408,  17151,  16270,  17370,  15868,  18328,  10779, -13976, -12562, -13581, -12851, -13404, -12968, -13320,
+    -13030, -13273, -13068, -13242, -13094, -13220, -13112, -13204, -13126, -13192, -13137, -13183, -13145, -13175, -13152, -13169,
+    -13158, -13164, -13163, -13159, -13167, -13156, -13170, -13152, -13173, -13149, -13176, -13147, -13178, -13145, -13180, -13143,
+    -13182, -13141, -13183, -13140, -13185, -13139, -13186, -13138, -13187, -13137, -13188, -13136, -13189, -13135, -13189, -13134,
+    -13190, -13134, -13191, -13133, -13191, -13133, -13191, -13132, -13192, -13132, -13192, -13132, -13192, -13132, -13192, -13132,
+    -13192, -13132, -13192, -13132, -13192, -13132, -13192, -13132, -13192, -13132, -13191, -13133, -13191, -13133, -13191, -13134,
+    -13190, -13134, -13189, -13135, -13189, -13136, -13188, -13137, -13187, -13138, -13186, -13139, -13185, -13140, -13183, -13141,
+    -13182, -13143, -13180, -13145, -13178, -13147, -13176, -13149, -13173, -13152, -13170, -13156, -13167, -13159, -13163, -13164,
+    -13158, -13169, -13152, -13175, -13145, -13183, -13137, -13192, -13126, -13204, -13112, -13220, -13094, -13242, -13068, -13273,
+    -13030, -13320, -12968, -13404, -12851, -13581, -12562, -13976,  10779,  18328,  15868,  17370,  16270,  17151,  16408,  17056,
+     16477,  17003,  16518,  16970,  16546,  16947,  16565,  16931,  16579,  16918,  16590,  16908,  16599,  16900,  16606,  16894,
+     16612,  16889,  16617,  16884,  16621,  16881,  16624,  16878,  16627,  16875,  16629,  16873,  16632,  16871,  16633,  16869,
+     16635,  16868,  16636,  16866,  16637,  16865,  16638,  16865,  16639,  16864,  16639,  16864,  16640,  16863,  16640,  16863,
+     16521,  16982,  16520,  16984,  16517,  16988,  16512,  16995,  16504,  17004,  16494,  17016,  16479,  17034,  16459,  17057,
+     16430,  17092,  16389,  17142,  16326,  17223,  16219,  17370,  16005,  17709,  15389,  19175,   6430, -15335, -11989, -13941,
+    -12590, -13608, -12801, -13462, -12908, -13381, -12971, -13330, -13013, -13295, -13042, -13270, -13064, -13252, -13080, -13238,
+    -13092, -13227, -13102, -13218, -13109, -13212, -13115, -13206, -13119, -13203, -13123, -13200, -13125, -13198, -13126, -13197,
+    -13127, -13197, -13126, -13198, -13125, -13200, -13123, -13203, -13119, -13206, -13115, -13212, -13109, -13218, -13102, -13227,
+    -13092, -13238, -13080, -13252, -13064, -13270, -13042, -13295, -13013, -13330, -12971, -13381, -12908, -13462, -12801, -13608,
+    -12590, -13941, -11989, -15335,   6430,  19175,  15389,  17709,  16005,  17370,  16219,  17223,  16326,  17142,  16389,  17092,
+     16430,  17057,  16459,  17034,  16479,  17016,  16494,  17004,  16504,  16995,  16512,  16988,  16517,  16984,  16520,  16982,
+     16327,  17178,  16318,  17196,  16290,  17236,  16235,  17313,  16128,  17464,  15902,  17829,  15232,  19446,   4077, -15641,
+    -11850, -14031, -12521, -13665, -12750, -13510, -12861, -13428, -12923, -13379, -12961, -13350, -12984, -13333, -12996, -13325,
+    -13000, -13325, -12996, -13333, -12984, -13350, -12961, -13379, -12923, -13428, -12861, -13510, -12750, -13665, -12521, -14031,
+    -11850, -15641,   4077,  19446,  15232,  17829,  15902,  17464,  16128,  17313,  16235,  17236,  16290,  17196,  16318,  17178,
+     17393,  16755,  16093,  16741,  17466,  16767,  15926,  16736,  17787,  16747,  15282,  16867,  19410,  15575,   3006, -10467,
+    -15850, -13770, -11665, -12877, -14218, -13330, -12325, -13052, -13873, -13235, -12526, -13115, -13752, -13189, -12597, -13153,
+    -13719, -13153, -12597, -13189, -13752, -13115, -12526, -13235, -13873, -13052, -12325, -13330, -14218, -12877, -11665, -13770,
+    -15850, -10467,   3006,  15575,  19410,  16867,  15282,  16747,  17787,  16736,  15926,  16767,  17466,  16741,  16093,  16755,
+     15651,  16073,  17035,  17826,  17823,  16947,  15772,  15197,  15839,  17513,  19140,  19172,  16365,  10476,   2510,  -5643,
+    -12012, -15390, -15794, -14319, -12510, -11579, -11907, -13028, -14072, -14359, -13787, -12831, -12176, -12252, -12969, -13804,
+    -14166, -13804, -12969, -12252, -12176, -12831, -13787, -14359, -14072, -13028, -11907, -11579, -12510, -14319, -15794, -15390,
+    -12012,  -5643,   2510,  10476,  16365,  19172,  19140,  17513,  15839,  15197,  15772,  16947,  17823,  17826,  17035,  16073,
+     13593,  13914,  14824,  16168,  17710,  19167,  20245,  20681,  20276,  18921,  16612,  13452,   9632,   5412,   1084,  -3059,
+     -6764,  -9838, -12170, -13735, -14589, -14852, -14686, -14267, -13758, -13292, -12953, -12778, -12753, -12833, -12957, -13060,
+    -13100, -13060, -12957, -12833, -12753, -12778, -12953, -13292, -13758, -14267, -14686, -14852, -14589, -13735, -12170,  -9838,
+     -6764,  -3059,   1084,   5412,   9632,  13452,  16612,  18921,  20276,  20681,  20245,  19167,  17710,  16168,  14824,  13914,
+     22211,  22054,  21585,  20815,  19761,  18445,  16895,  15144,  13227,  11183,   9051,   6871,   4680,   2516,    411,  -1604,
+     -3505,  -5271,  -6888,  -8345,  -9637, -10765, -11734, -12551, -13227, -13776, -14212, -14550, -14804, -14986, -15108, -15178,
+    -15201, -15178, -15108, -14986, -14804, -14550, -14212, -13776, -13227, -12551, -11734, -10765,  -9637,  -8345,  -6888,  -5271,
+     -3505,  -1604,    411,   2516,   4680,   6871,   9051,  11183,  13227,  15144,  16895,  18445,  19761,  20815,  21585,  22054,
+     18706,  18616,  18347,  17901,  17282,  16497,  15554,  14460,  13227,  11867,  10393,   8818,   7159,   5430,   3649,   1834,
+         0,  -1834,  -3649,  -5430,  -7159,  -8818, -10393, -11867, -13227, -14460, -15554, -16497, -17282, -17901, -18347, -18616,
+    -18706, -18616, -18347, -17901, -17282, -16497, -15554, -14460, -13227, -11867, -10393,  -8818,  -7159,  -5430,  -3649,  -1834,
+         0,   1834,   3649,   5430,   7159,   8818,  10393,  11867,  13227,  14460,  15554,  16497,  17282,  17901,  18347,  18616,
+    
+    // Frame 3
+     17568,  17730,  17568,  17730,  17568,  17730,  17568,  17730,  17567,  17731,  17567,  17731,  17567,  17731,  17567,  17731,
+     17567,  17731,  17566,  17732,  17566,  17732,  17566,  17733,  17565,  17733,  17565,  17734,  17564,  17735,  17563,  17736,
+     17562,  17737,  17560,  17739,  17558,  17741,  17556,  17744,  17552,  17748,  17547,  17755,  17538,  17767,  17522,  17790,
+     17485,  17854,  17355,  18210,  15281, -10658, -12571, -12123, -12361, -12185, -12336, -12196, -12331, -12199, -12330, -12199,
+    -12330, -12199, -12331, -12198, -12331, -12198, -12332, -12197, -12332, -12197, -12332, -12196, -12333, -12196, -12333, -12196,
+    -12333, -12195, -12334, -12195, -12334, -12195, -12334, -12195, -12334, -12195, -12335, -12194, -12335, -12194, -12335, -12194,
+    -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12194, -12336, -12194,
+    -12336, -12194, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193,
+    -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12193, -12336, -12194,
+    -12336, -12194, -12336, -12194, -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12194,
+    -12335, -12194, -12335, -12194, -12335, -12194, -12335, -12195, -12334, -12195, -12334, -12195, -12334, -12195, -12334, -12195,
+    -12333, -12196, -12333, -12196, -12333, -12196, -12332, -12197, -12332, -12197, -12332, -12198, -12331, -12198, -12331, -12199,
+    -12330, -12199, -12330, -12199, -12331, -12196, -12336, -12185, -12361, -12123, -12571, -10658,  15281,  18210,  17355,  17854,
+     17485,  17790,  17522,  17767,  17538,  17755,  17547,  17748,  17552,  17744,  17556,  17741,  17558,  17739,  17560,  17737,
+     17562,  17736,  17563,  17735,  17564,  17734,  17565,  17733,  17565,  17733,  17566,  17732,  17566,  17732,  17566,  17731,
+     17567,  17731,  17567,  17731,  17567,  17731,  17567,  17731,  17567,  17730,  17568,  17730,  17568,  17730,  17568,  17730,
+     17401,  17898,  17400,  17900,  17396,  17904,  17391,  17911,  17383,  17920,  17371,  17934,  17355,  17954,  17331,  17982,
+     17297,  18024,  17245,  18092,  17155,  18215,  16975,  18500,  16456,  19734,   9530, -13844, -11374, -12850, -11844, -12583,
+    -12015, -12464, -12102, -12398, -12155, -12356, -12189, -12327, -12213, -12306, -12231, -12291, -12244, -12279, -12255, -12270,
+    -12263, -12263, -12269, -12257, -12274, -12253, -12278, -12249, -12281, -12247, -12283, -12245, -12285, -12244, -12286, -12243,
+    -12286, -12243, -12286, -12244, -12285, -12245, -12283, -12247, -12281, -12249, -12278, -12253, -12274, -12257, -12269, -12263,
+    -12263, -12270, -12255, -12279, -12244, -12291, -12231, -12306, -12213, -12327, -12189, -12356, -12155, -12398, -12102, -12464,
+    -12015, -12583, -11844, -12850, -11374, -13844,   9530,  19734,  16456,  18500,  16975,  18215,  17155,  18092,  17245,  18024,
+     17297,  17982,  17331,  17954,  17355,  17934,  17371,  17920,  17383,  17911,  17391,  17904,  17396,  17900,  17400,  17898,
+     18131,  17164,  18142,  17143,  18176,  17093,  18246,  16993,  18390,  16778,  18738,  16136,  20285,   6102, -14563, -11064,
+    -13045, -11702, -12695, -11921, -12546, -12028, -12467, -12089, -12420, -12126, -12391, -12149, -12373, -12162, -12363, -12168,
+    -12360, -12168, -12363, -12162, -12373, -12149, -12391, -12126, -12420, -12089, -12467, -12028, -12546, -11921, -12695, -11702,
+    -13045, -11064, -14563,   6102,  20285,  16136,  18738,  16778,  18390,  16993,  18246,  17093,  18176,  17143,  18142,  17164,
+     18331,  17569,  16966,  17900,  18334,  17191,  16962,  18398,  18328,  16397,  17042,  20144,  17407,   4572,  -9736, -14934,
+    -12426, -10829, -12471, -13208, -11928, -11597, -12663, -12749, -11832, -11918, -12717, -12498, -11800, -12129, -12735, -12309,
+    -11792, -12309, -12735, -12129, -11800, -12498, -12717, -11918, -11832, -12749, -12663, -11597, -11928, -13208, -12471, -10829,
+    -12426, -14934,  -9736,   4572,  17407,  20144,  17042,  16397,  18328,  18398,  16962,  17191,  18334,  17900,  16966,  17569,
+     17875,  17888,  17860,  17662,  17278,  16914,  16929,  17580,  18716,  19643,  19295,  16689,  11467,   4214,  -3629, -10293,
+    -14393, -15506, -14300, -12173, -10561, -10291, -11289, -12769, -13769, -13722, -12750, -11530, -10847, -11110, -12115, -13197,
+    -13657, -13197, -12115, -11110, -10847, -11530, -12750, -13722, -13769, -12769, -11289, -10291, -10561, -12173, -14300, -15506,
+    -14393, -10293,  -3629,   4214,  11467,  16689,  19295,  19643,  18716,  17580,  16929,  16914,  17278,  17662,  17860,  17888,
+     14884,  15206,  16113,  17430,  18897,  20200,  21023,  21090,  20207,  18288,  15371,  11612,   7269,   2663,  -1860,  -5973,
+     -9410, -11995, -13660, -14444, -14484, -13984, -13184, -12319, -11592, -11140, -11026, -11234, -11681, -12243, -12778, -13158,
+    -13295, -13158, -12778, -12243, -11681, -11234, -11026, -11140, -11592, -12319, -13184, -13984, -14484, -14444, -13660, -11995,
+     -9410,  -5973,  -1860,   2663,   7269,  11612,  15371,  18288,  20207,  21090,  21023,  20200,  18897,  17430,  16113,  15206,
+     23389,  23203,  22650,  21742,  20503,  18963,  17158,  15132,  12931,  10606,   8207,   5786,   3391,   1066,  -1146,  -3212,
+     -5102,  -6796,  -8281,  -9551, -10606, -11455, -12112, -12597, -12931, -13141, -13253, -13294, -13288, -13258, -13222, -13195,
+    -13185, -13195, -13222, -13258, -13288, -13294, -13253, -13141, -12931, -12597, -12112, -11455, -10606,  -9551,  -8281,  -6796,
+     -5102,  -3212,  -1146,   1066,   3391,   5786,   8207,  10606,  12931,  15132,  17158,  18963,  20503,  21742,  22650,  23203,
+     18287,  18199,  17936,  17500,  16895,  16128,  15205,  14136,  12931,  11601,  10160,   8621,   6998,   5309,   3568,   1792,
+         0,  -1792,  -3568,  -5309,  -6998,  -8621, -10160, -11601, -12931, -14136, -15205, -16128, -16895, -17500, -17936, -18199,
+    -18287, -18199, -17936, -17500, -16895, -16128, -15205, -14136, -12931, -11601, -10160,  -8621,  -6998,  -5309,  -3568,  -1792,
+         0,   1792,   3568,   5309,   6998,   8621,  10160,  11601,  12931,  14136,  15205,  16128,  16895,  17500,  17936,  18199,
+    
+    // Frame 4
+     18525,  18568,  18525,  18568,  18525,  18567,  18526,  18567,  18526,  18566,  18527,  18565,  18528,  18564,  18529,  18563,
+     18531,  18561,  18533,  18559,  18535,  18556,  18538,  18554,  18541,  18550,  18545,  18546,  18549,  18541,  18555,  18534,
+     18563,  18526,  18572,  18515,  18584,  18501,  18600,  18482,  18624,  18453,  18660,  18406,  18722,  18321,  18846,  18142,
+     18861,  -6381, -12689, -10632, -11880, -10968, -11698, -11082, -11620, -11138, -11577, -11172, -11550, -11194, -11532, -11210,
+    -11518, -11221, -11508, -11230, -11500, -11238, -11494, -11243, -11488, -11248, -11484, -11252, -11481, -11255, -11477, -11258,
+    -11475, -11261, -11472, -11263, -11470, -11265, -11469, -11266, -11467, -11268, -11466, -11269, -11464, -11270, -11463, -11271,
+    -11462, -11272, -11462, -11273, -11461, -11274, -11460, -11275, -11459, -11275, -11459, -11276, -11458, -11276, -11458, -11276,
+    -11458, -11277, -11457, -11277, -11457, -11277, -11457, -11278, -11457, -11278, -11457, -11278, -11456, -11278, -11456, -11278,
+    -11456, -11278, -11456, -11278, -11456, -11278, -11457, -11278, -11457, -11278, -11457, -11277, -11457, -11277, -11457, -11277,
+    -11458, -11276, -11458, -11276, -11458, -11276, -11459, -11275, -11459, -11275, -11460, -11274, -11461, -11273, -11462, -11272,
+    -11462, -11271, -11463, -11270, -11464, -11269, -11466, -11268, -11467, -11266, -11469, -11265, -11470, -11263, -11472, -11261,
+    -11475, -11258, -11477, -11255, -11481, -11252, -11484, -11248, -11488, -11243, -11494, -11238, -11500, -11230, -11508, -11221,
+    -11518, -11210, -11532, -11194, -11550, -11172, -11577, -11138, -11620, -11082, -11698, -10968, -11880, -10632, -12689,  -6381,
+     18861,  18142,  18846,  18321,  18722,  18406,  18660,  18453,  18624,  18482,  18600,  18501,  18584,  18515,  18572,  18526,
+     18563,  18534,  18555,  18541,  18549,  18546,  18545,  18550,  18541,  18554,  18538,  18556,  18535,  18559,  18533,  18561,
+     18531,  18563,  18529,  18564,  18528,  18565,  18527,  18566,  18526,  18567,  18526,  18567,  18525,  18568,  18525,  18568,
+     18300,  18793,  18299,  18795,  18296,  18799,  18291,  18805,  18283,  18815,  18272,  18829,  18255,  18849,  18229,  18881,
+     18190,  18931,  18123,  19025,  17986,  19243,  17586,  20199,  12498, -12107, -10842, -11713, -11129, -11536, -11246, -11454,
+    -11306, -11407, -11343, -11377, -11368, -11357, -11385, -11342, -11398, -11331, -11408, -11322, -11415, -11316, -11421, -11311,
+    -11426, -11306, -11430, -11303, -11433, -11300, -11435, -11298, -11437, -11297, -11438, -11295, -11439, -11295, -11440, -11294,
+    -11440, -11294, -11440, -11295, -11439, -11295, -11438, -11297, -11437, -11298, -11435, -11300, -11433, -11303, -11430, -11306,
+    -11426, -11311, -11421, -11316, -11415, -11322, -11408, -11331, -11398, -11342, -11385, -11357, -11368, -11377, -11343, -11407,
+    -11306, -11454, -11246, -11536, -11129, -11713, -10842, -12107,  12498,  20199,  17586,  19243,  17986,  19025,  18123,  18931,
+     18190,  18881,  18229,  18849,  18255,  18829,  18272,  18815,  18283,  18805,  18291,  18799,  18296,  18795,  18299,  18793,
+     18013,  19083,  18000,  19109,  17958,  19171,  17868,  19304,  17667,  19631,  17062,  21087,   8112, -13432, -10299, -12045,
+    -10893, -11718, -11098, -11579, -11198, -11504, -11255, -11460, -11290, -11432, -11313, -11414, -11327, -11403, -11334, -11398,
+    -11337, -11398, -11334, -11403, -11327, -11414, -11313, -11432, -11290, -11460, -11255, -11504, -11198, -11579, -11098, -11718,
+    -10893, -12045, -10299, -13432,   8112,  21087,  17062,  19631,  17667,  19304,  17868,  19171,  17958,  19109,  18000,  19083,
+     17837,  18532,  19283,  18591,  17720,  18470,  19565,  18651,  17114,  18453,  21129,  18013,   6003,  -7803, -13995, -12249,
+     -9891, -10920, -12416, -11649, -10533, -11173, -12078, -11506, -10734, -11269, -11952, -11433, -10813, -11329, -11904, -11379,
+    -10835, -11379, -11904, -11329, -10813, -11433, -11952, -11269, -10734, -11506, -12078, -11173, -10533, -11649, -12416, -10920,
+     -9891, -12249, -13995,  -7803,   6003,  18013,  21129,  18453,  17114,  18651,  19565,  18470,  17720,  18591,  19283,  18532,
+     20124,  19665,  18528,  17325,  16750,  17231,  18674,  20413,  21402,  20596,  17365,  11788,   4692,  -2595,  -8679, -12574,
+    -14013, -13480, -11957, -10505,  -9855, -10175, -11116, -12065, -12496, -12229, -11485, -10727, -10394, -10655, -11332, -12014,
+    -12297, -12014, -11332, -10655, -10394, -10727, -11485, -12229, -12496, -12065, -11116, -10175,  -9855, -10505, -11957, -13480,
+    -14013, -12574,  -8679,  -2595,   4692,  11788,  17365,  20596,  21402,  20413,  18674,  17231,  16750,  17325,  18528,  19665,
+     16770,  17038,  17781,  18830,  19933,  20790,  21104,  20623,  19183,  16735,  13353,   9233,   4664,     -9,  -4426,  -8263,
+    -11270, -13303, -14338, -14467, -13882, -12839, -11622, -10498,  -9680,  -9300,  -9395,  -9911, -10715, -11628, -12457, -13032,
+    -13237, -13032, -12457, -11628, -10715,  -9911,  -9395,  -9300,  -9680, -10498, -11622, -12839, -13882, -14467, -14338, -13303,
+    -11270,  -8263,  -4426,     -9,   4664,   9233,  13353,  16735,  19183,  20623,  21104,  20790,  19933,  18830,  17781,  17038,
+     24224,  24014,  23388,  22363,  20967,  19237,  17217,  14959,  12520,   9961,   7343,   4725,   2167,   -280,  -2568,  -4657,
+     -6518,  -8128,  -9476, -10559, -11385, -11968, -12331, -12504, -12520, -12415, -12228, -11994, -11749, -11524, -11344, -11228,
+    -11188, -11228, -11344, -11524, -11749, -11994, -12228, -12415, -12520, -12504, -12331, -11968, -11385, -10559,  -9476,  -8128,
+     -6518,  -4657,  -2568,   -280,   2167,   4725,   7343,   9961,  12520,  14959,  17217,  19237,  20967,  22363,  23388,  24014,
+     17706,  17621,  17366,  16944,  16358,  15616,  14722,  13687,  12520,  11233,   9837,   8347,   6776,   5140,   3454,   1736,
+         0,  -1736,  -3454,  -5140,  -6776,  -8347,  -9837, -11233, -12520, -13687, -14722, -15616, -16358, -16944, -17366, -17621,
+    -17706, -17621, -17366, -16944, -16358, -15616, -14722, -13687, -12520, -11233,  -9837,  -8347,  -6776,  -5140,  -3454,  -1736,
+         0,   1736,   3454,   5140,   6776,   8347,   9837,  11233,  12520,  13687,  14722,  15616,  16358,  16944,  17366,  17621,
+    
+    // Frame 5
+     19498,  19390,  19498,  19389,  19498,  19389,  19500,  19387,  19501,  19385,  19503,  19383,  19506,  19380,  19509,  19376,
+     19513,  19372,  19518,  19367,  19524,  19360,  19532,  19352,  19541,  19342,  19552,  19329,  19566,  19313,  19584,  19292,
+     19608,  19264,  19641,  19225,  19689,  19165,  19765,  19067,  19900,  18872,  20204,  18328,  21423,  -1337, -12664,  -9259,
+    -11304,  -9831, -10989, -10031, -10851, -10132, -10774, -10193, -10725, -10233, -10691, -10262, -10667, -10283, -10648, -10299,
+    -10633, -10313, -10621, -10323, -10612, -10332, -10604, -10339, -10597, -10346, -10591, -10351, -10586, -10356, -10582, -10360,
+    -10578, -10363, -10575, -10366, -10572, -10369, -10569, -10371, -10567, -10374, -10565, -10375, -10563, -10377, -10561, -10379,
+    -10560, -10380, -10559, -10381, -10557, -10383, -10556, -10384, -10555, -10384, -10555, -10385, -10554, -10386, -10553, -10387,
+    -10553, -10387, -10552, -10388, -10552, -10388, -10551, -10388, -10551, -10389, -10551, -10389, -10551, -10389, -10551, -10389,
+    -10551, -10389, -10551, -10389, -10551, -10389, -10551, -10389, -10551, -10388, -10551, -10388, -10552, -10388, -10552, -10387,
+    -10553, -10387, -10553, -10386, -10554, -10385, -10555, -10384, -10555, -10384, -10556, -10383, -10557, -10381, -10559, -10380,
+    -10560, -10379, -10561, -10377, -10563, -10375, -10565, -10374, -10567, -10371, -10569, -10369, -10572, -10366, -10575, -10363,
+    -10578, -10360, -10582, -10356, -10586, -10351, -10591, -10346, -10597, -10339, -10604, -10332, -10612, -10323, -10621, -10313,
+    -10633, -10299, -10648, -10283, -10667, -10262, -10691, -10233, -10725, -10193, -10774, -10132, -10851, -10031, -10989,  -9831,
+    -11304,  -9259, -12664,  -1337,  21423,  18328,  20204,  18872,  19900,  19067,  19765,  19165,  19689,  19225,  19641,  19264,
+     19608,  19292,  19584,  19313,  19566,  19329,  19552,  19342,  19541,  19352,  19532,  19360,  19524,  19367,  19518,  19372,
+     19513,  19376,  19509,  19380,  19506,  19383,  19503,  19385,  19501,  19387,  19500,  19389,  19498,  19389,  19498,  19390,
+     19223,  19665,  19223,  19666,  19220,  19669,  19216,  19675,  19209,  19683,  19199,  19695,  19184,  19714,  19160,  19745,
+     19118,  19804,  19030,  19947,  18764,  20602,  15297, -10120, -10376, -10542, -10433, -10477, -10484, -10439, -10513, -10416,
+    -10532, -10401, -10545, -10390, -10554, -10382, -10561, -10376, -10566, -10371, -10570, -10368, -10573, -10365, -10576, -10362,
+    -10578, -10360, -10580, -10359, -10581, -10358, -10582, -10357, -10583, -10356, -10584, -10355, -10584, -10355, -10584, -10355,
+    -10585, -10355, -10584, -10355, -10584, -10355, -10584, -10356, -10583, -10357, -10582, -10358, -10581, -10359, -10580, -10360,
+    -10578, -10362, -10576, -10365, -10573, -10368, -10570, -10371, -10566, -10376, -10561, -10382, -10554, -10390, -10545, -10401,
+    -10532, -10416, -10513, -10439, -10484, -10477, -10433, -10542, -10376, -10120,  15297,  20602,  18764,  19947,  19030,  19804,
+     19118,  19745,  19160,  19714,  19184,  19695,  19199,  19683,  19209,  19675,  19216,  19669,  19220,  19666,  19223,  19665,
+     20021,  18863,  20036,  18831,  20088,  18752,  20207,  18569,  20507,  18010,  21854,  10101, -12243,  -9555, -11034, -10090,
+    -10737, -10277, -10610, -10369, -10541, -10421, -10500, -10454, -10474, -10475, -10457, -10488, -10446, -10497, -10440, -10500,
+    -10438, -10500, -10440, -10497, -10446, -10488, -10457, -10475, -10474, -10454, -10500, -10421, -10541, -10369, -10610, -10277,
+    -10737, -10090, -11034,  -9555, -12243,  10101,  21854,  18010,  20507,  18569,  20207,  18752,  20088,  18831,  20036,  18863,
+     18643,  19548,  20249,  19112,  18623,  20075,  20290,  18312,  18586,  21784,  19851,   7613,  -7073, -13095, -10884,  -9026,
+    -10528, -11437, -10240,  -9768, -10784, -10994, -10108, -10077, -10861, -10757, -10060, -10274, -10891, -10584, -10042, -10432,
+    -10899, -10432, -10042, -10584, -10891, -10274, -10060, -10757, -10861, -10077, -10108, -10994, -10784,  -9768, -10240, -11437,
+    -10528,  -9026, -10884, -13095,  -7073,   7613,  19851,  21784,  18586,  18312,  20290,  20075,  18623,  19112,  20249,  19548,
+     21524,  20815,  19135,  17568,  17199,  18439,  20694,  22556,  22432,  19311,  13269,   5484,  -2258,  -8293, -11707, -12587,
+    -11813, -10542,  -9681,  -9579, -10047, -10633, -10950, -10881, -10578, -10295, -10207, -10316, -10490, -10585, -10554, -10461,
+    -10413, -10461, -10554, -10585, -10490, -10316, -10207, -10295, -10578, -10881, -10950, -10633, -10047,  -9579,  -9681, -10542,
+    -11813, -12587, -11707,  -8293,  -2258,   5484,  13269,  19311,  22432,  22556,  20694,  18439,  17199,  17568,  19135,  20815,
+     19150,  19308,  19731,  20280,  20743,  20879,  20452,  19271,  17228,  14320,  10655,   6440,   1964,  -2445,  -6457,  -9787,
+    -12231, -13690, -14181, -13831, -12858, -11534, -10147,  -8960,  -8172,  -7898,  -8152,  -8855,  -9849, -10935, -11901, -12564,
+    -12799, -12564, -11901, -10935,  -9849,  -8855,  -8152,  -7898,  -8172,  -8960, -10147, -11534, -12858, -13831, -14181, -13690,
+    -12231,  -9787,  -6457,  -2445,   1964,   6440,  10655,  14320,  17228,  19271,  20452,  20879,  20743,  20280,  19731,  19308,
+     24671,  24441,  23759,  22642,  21123,  19244,  17056,  14619,  11998,   9261,   6479,   3719,   1046,  -1480,  -3807,  -5892,
+     -7703,  -9218, -10427, -11331, -11940, -12278, -12375, -12267, -11998, -11614, -11160, -10685, -10229,  -9832,  -9525,  -9331,
+     -9265,  -9331,  -9525,  -9832, -10229, -10685, -11160, -11614, -11998, -12267, -12375, -12278, -11940, -11331, -10427,  -9218,
+     -7703,  -5892,  -3807,  -1480,   1046,   3719,   6479,   9261,  11998,  14619,  17056,  19244,  21123,  22642,  23759,  24441,
+     16968,  16886,  16642,  16237,  15676,  14964,  14108,  13116,  11998,  10764,   9427,   7999,   6493,   4926,   3310,   1663,
+         0,  -1663,  -3310,  -4926,  -6493,  -7999,  -9427, -10764, -11998, -13116, -14108, -14964, -15676, -16237, -16642, -16886,
+    -16968, -16886, -16642, -16237, -15676, -14964, -14108, -13116, -11998, -10764,  -9427,  -7999,  -6493,  -4926,  -3310,  -1663,
+         0,   1663,   3310,   4926,   6493,   7999,   9427,  10764,  11998,  13116,  14108,  14964,  15676,  16237,  16642,  16886,
+    
+    // Frame 6
+     20466,  20216,  20466,  20216,  20467,  20214,  20469,  20212,  20472,  20209,  20475,  20205,  20480,  20200,  20485,  20194,
+     20492,  20186,  20501,  20177,  20512,  20165,  20525,  20149,  20542,  20130,  20564,  20105,  20594,  20070,  20634,  20022,
+     20693,  19948,  20787,  19826,  20954,  19582,  21339,  18885,  23008,   4175, -12212,  -8144, -10542,  -8842, -10157,  -9085,
+     -9989,  -9208,  -9896,  -9282,  -9836,  -9331,  -9795,  -9366,  -9765,  -9392,  -9742,  -9412,  -9724,  -9428,  -9710,  -9441,
+     -9698,  -9452,  -9688,  -9461,  -9680,  -9468,  -9673,  -9475,  -9667,  -9480,  -9662,  -9485,  -9657,  -9490,  -9653,  -9493,
+     -9650,  -9497,  -9646,  -9500,  -9644,  -9502,  -9641,  -9505,  -9639,  -9507,  -9637,  -9509,  -9635,  -9511,  -9633,  -9512,
+     -9632,  -9513,  -9631,  -9515,  -9629,  -9516,  -9628,  -9517,  -9627,  -9518,  -9626,  -9519,  -9626,  -9519,  -9625,  -9520,
+     -9624,  -9521,  -9624,  -9521,  -9623,  -9521,  -9623,  -9522,  -9623,  -9522,  -9623,  -9522,  -9622,  -9522,  -9622,  -9522,
+     -9622,  -9522,  -9622,  -9522,  -9622,  -9522,  -9623,  -9522,  -9623,  -9522,  -9623,  -9521,  -9623,  -9521,  -9624,  -9521,
+     -9624,  -9520,  -9625,  -9519,  -9626,  -9519,  -9626,  -9518,  -9627,  -9517,  -9628,  -9516,  -9629,  -9515,  -9631,  -9513,
+     -9632,  -9512,  -9633,  -9511,  -9635,  -9509,  -9637,  -9507,  -9639,  -9505,  -9641,  -9502,  -9644,  -9500,  -9646,  -9497,
+     -9650,  -9493,  -9653,  -9490,  -9657,  -9485,  -9662,  -9480,  -9667,  -9475,  -9673,  -9468,  -9680,  -9461,  -9688,  -9452,
+     -9698,  -9441,  -9710,  -9428,  -9724,  -9412,  -9742,  -9392,  -9765,  -9366,  -9795,  -9331,  -9836,  -9282,  -9896,  -9208,
+     -9989,  -9085, -10157,  -8842, -10542,  -8144, -12212,   4175,  23008,  18885,  21339,  19582,  20954,  19826,  20787,  19948,
+     20693,  20022,  20634,  20070,  20594,  20105,  20564,  20130,  20542,  20149,  20525,  20165,  20512,  20177,  20501,  20186,
+     20492,  20194,  20485,  20200,  20480,  20205,  20475,  20209,  20472,  20212,  20469,  20214,  20467,  20216,  20466,  20216,
+     20171,  20512,  20170,  20512,  20169,  20514,  20168,  20516,  20165,  20520,  20160,  20526,  20151,  20537,  20136,  20561,
+     20099,  20624,  19969,  20979,  17896,  -7888,  -9956,  -9354,  -9745,  -9416,  -9721,  -9427,  -9715,  -9430,  -9714,  -9431,
+     -9714,  -9430,  -9714,  -9430,  -9715,  -9430,  -9715,  -9429,  -9716,  -9429,  -9716,  -9429,  -9716,  -9428,  -9716,  -9428,
+     -9717,  -9428,  -9717,  -9428,  -9717,  -9428,  -9717,  -9428,  -9717,  -9428,  -9717,  -9428,  -9717,  -9427,  -9717,  -9427,
+     -9717,  -9427,  -9717,  -9427,  -9717,  -9428,  -9717,  -9428,  -9717,  -9428,  -9717,  -9428,  -9717,  -9428,  -9717,  -9428,
+     -9717,  -9428,  -9716,  -9428,  -9716,  -9429,  -9716,  -9429,  -9716,  -9429,  -9715,  -9430,  -9715,  -9430,  -9714,  -9430,
+     -9714,  -9431,  -9714,  -9430,  -9715,  -9427,  -9721,  -9416,  -9745,  -9354,  -9956,  -7888,  17896,  20979,  19969,  20624,
+     20099,  20561,  20136,  20537,  20151,  20526,  20160,  20520,  20165,  20516,  20168,  20514,  20169,  20512,  20170,  20512,
+     19730,  20957,  19712,  20996,  19646,  21098,  19484,  21368,  18979,  22590,  12064, -10998,  -8831, -10012,  -9294,  -9752,
+     -9458,  -9640,  -9539,  -9579,  -9586,  -9542,  -9615,  -9519,  -9635,  -9503,  -9647,  -9493,  -9655,  -9487,  -9660,  -9484,
+     -9661,  -9484,  -9660,  -9487,  -9655,  -9493,  -9647,  -9503,  -9635,  -9519,  -9615,  -9542,  -9586,  -9579,  -9539,  -9640,
+     -9458,  -9752,  -9294, -10012,  -8831, -10998,  12064,  22590,  18979,  21368,  19484,  21098,  19646,  20996,  19712,  20957,
+     21149,  20374,  19488,  20239,  21351,  20523,  18951,  20073,  22819,  20368,   8980,  -5067, -12080, -10743,  -8143,  -8950,
+    -10597,  -9980,  -8751,  -9282, -10276,  -9788,  -8943,  -9412, -10153,  -9689,  -9023,  -9493, -10101,  -9619,  -9055,  -9557,
+    -10086,  -9557,  -9055,  -9619, -10101,  -9493,  -9023,  -9689, -10153,  -9412,  -8943,  -9788, -10276,  -9282,  -8751,  -9980,
+    -10597,  -8950,  -8143, -10743, -12080,  -5067,   8980,  20368,  22819,  20073,  18951,  20523,  21351,  20239,  19488,  20374,
+     21611,  21066,  19846,  18919,  19137,  20587,  22352,  22865,  20692,  15327,   7562,   -780,  -7630, -11570, -12395, -11073,
+     -9156,  -7985,  -8108,  -9180, -10347, -10841, -10427,  -9480,  -8679,  -8541,  -9112,  -9965, -10513, -10398,  -9719,  -8950,
+     -8618,  -8950,  -9719, -10398, -10513,  -9965,  -9112,  -8541,  -8679,  -9480, -10427, -10841, -10347,  -9180,  -8108,  -7985,
+     -9156, -11073, -12395, -11570,  -7630,   -780,   7562,  15327,  20692,  22865,  22352,  20587,  19137,  18919,  19846,  21066,
+     21822,  21824,  21797,  21651,  21252,  20449,  19105,  17124,  14475,  11207,   7450,   3405,   -674,  -4515,  -7859, -10494,
+    -12284, -13184, -13248, -12620, -11510, -10171,  -8856,  -7790,  -7139,  -6984,  -7323,  -8068,  -9067, -10132, -11066, -11702,
+    -11927, -11702, -11066, -10132,  -9067,  -8068,  -7323,  -6984,  -7139,  -7790,  -8856, -10171, -11510, -12620, -13248, -13184,
+    -12284, -10494,  -7859,  -4515,   -674,   3405,   7450,  11207,  14475,  17124,  19105,  20449,  21252,  21651,  21797,  21824,
+     24695,  24452,  23730,  22550,  20947,  18967,  16666,  14110,  11370,   8520,   5636,   2793,     61,  -2496,  -4823,  -6874,
+     -8616, -10026, -11097, -11831, -12245, -12366, -12230, -11881, -11370, -10748, -10072,  -9394,  -8763,  -8223,  -7810,  -7552,
+     -7463,  -7552,  -7810,  -8223,  -8763,  -9394, -10072, -10748, -11370, -11881, -12230, -12366, -12245, -11831, -11097, -10026,
+     -8616,  -6874,  -4823,  -2496,     61,   2793,   5636,   8520,  11370,  14110,  16666,  18967,  20947,  22550,  23730,  24452,
+     16079,  16002,  15770,  15387,  14855,  14180,  13369,  12429,  11370,  10200,   8933,   7580,   6153,   4667,   3137,   1576,
+         0,  -1576,  -3137,  -4667,  -6153,  -7580,  -8933, -10200, -11370, -12429, -13369, -14180, -14855, -15387, -15770, -16002,
+    -16079, -16002, -15770, -15387, -14855, -14180, -13369, -12429, -11370, -10200,  -8933,  -7580,  -6153,  -4667,  -3137,  -1576,
+         0,   1576,   3137,   4667,   6153,   7580,   8933,  10200,  11370,  12429,  13369,  14180,  14855,  15387,  15770,  16002,
+    
+    // Frame 7
+     21408,  21069,  21408,  21068,  21409,  21067,  21412,  21064,  21415,  21060,  21420,  21055,  21426,  21048,  21433,  21040,
+     21443,  21029,  21455,  21015,  21470,  20997,  21491,  20974,  21518,  20942,  21556,  20897,  21611,  20828,  21698,  20713,
+     21855,  20485,  22215,  19832,  23773,   9789, -11067,  -7386,  -9539,  -8033,  -9181,  -8260,  -9025,  -8375,  -8937,  -8443,
+     -8881,  -8489,  -8843,  -8522,  -8815,  -8546,  -8794,  -8565,  -8777,  -8580,  -8764,  -8592,  -8753,  -8602,  -8744,  -8610,
+     -8736,  -8617,  -8730,  -8623,  -8724,  -8628,  -8719,  -8633,  -8715,  -8637,  -8711,  -8641,  -8708,  -8644,  -8705,  -8646,
+     -8702,  -8649,  -8700,  -8651,  -8698,  -8653,  -8696,  -8655,  -8694,  -8657,  -8693,  -8658,  -8691,  -8659,  -8690,  -8661,
+     -8689,  -8662,  -8688,  -8663,  -8687,  -8663,  -8686,  -8664,  -8685,  -8665,  -8685,  -8666,  -8684,  -8666,  -8683,  -8667,
+     -8683,  -8667,  -8683,  -8667,  -8682,  -8668,  -8682,  -8668,  -8682,  -8668,  -8682,  -8668,  -8681,  -8668,  -8681,  -8669,
+     -8681,  -8669,  -8681,  -8668,  -8681,  -8668,  -8682,  -8668,  -8682,  -8668,  -8682,  -8668,  -8682,  -8667,  -8683,  -8667,
+     -8683,  -8667,  -8683,  -8666,  -8684,  -8666,  -8685,  -8665,  -8685,  -8664,  -8686,  -8663,  -8687,  -8663,  -8688,  -8662,
+     -8689,  -8661,  -8690,  -8659,  -8691,  -8658,  -8693,  -8657,  -8694,  -8655,  -8696,  -8653,  -8698,  -8651,  -8700,  -8649,
+     -8702,  -8646,  -8705,  -8644,  -8708,  -8641,  -8711,  -8637,  -8715,  -8633,  -8719,  -8628,  -8724,  -8623,  -8730,  -8617,
+     -8736,  -8610,  -8744,  -8602,  -8753,  -8592,  -8764,  -8580,  -8777,  -8565,  -8794,  -8546,  -8815,  -8522,  -8843,  -8489,
+     -8881,  -8443,  -8937,  -8375,  -9025,  -8260,  -9181,  -8033,  -9539,  -7386, -11067,   9789,  23773,  19832,  22215,  20485,
+     21855,  20713,  21698,  20828,  21611,  20897,  21556,  20942,  21518,  20974,  21491,  20997,  21470,  21015,  21455,  21029,
+     21443,  21040,  21433,  21048,  21426,  21055,  21420,  21060,  21415,  21064,  21412,  21067,  21409,  21068,  21408,  21069,
+     21143,  21334,  21144,  21333,  21146,  21330,  21148,  21327,  21153,  21321,  21160,  21313,  21170,  21301,  21183,  21288,
+     21185,  21361,  20271,  -5424,  -9556,  -8165,  -9052,  -8363,  -8948,  -8426,  -8907,  -8455,  -8885,  -8472,  -8872,  -8483,
+     -8863,  -8490,  -8857,  -8495,  -8852,  -8499,  -8849,  -8503,  -8846,  -8505,  -8844,  -8507,  -8842,  -8508,  -8841,  -8510,
+     -8840,  -8511,  -8839,  -8512,  -8838,  -8512,  -8837,  -8513,  -8837,  -8513,  -8837,  -8513,  -8836,  -8514,  -8836,  -8514,
+     -8836,  -8514,  -8836,  -8514,  -8836,  -8513,  -8837,  -8513,  -8837,  -8513,  -8837,  -8512,  -8838,  -8512,  -8839,  -8511,
+     -8840,  -8510,  -8841,  -8508,  -8842,  -8507,  -8844,  -8505,  -8846,  -8503,  -8849,  -8499,  -8852,  -8495,  -8857,  -8490,
+     -8863,  -8483,  -8872,  -8472,  -8885,  -8455,  -8907,  -8426,  -8948,  -8363,  -9052,  -8165,  -9556,  -5424,  20271,  21361,
+     21185,  21288,  21183,  21301,  21170,  21313,  21160,  21321,  21153,  21327,  21148,  21330,  21146,  21333,  21144,  21334,
+     21872,  20599,  21895,  20551,  21979,  20413,  22214,  19967,  23299,  13998,  -9694,  -8124,  -8983,  -8501,  -8766,  -8640,
+     -8670,  -8709,  -8618,  -8749,  -8587,  -8774,  -8567,  -8791,  -8553,  -8802,  -8544,  -8809,  -8538,  -8813,  -8535,  -8816,
+     -8534,  -8816,  -8535,  -8813,  -8538,  -8809,  -8544,  -8802,  -8553,  -8791,  -8567,  -8774,  -8587,  -8749,  -8618,  -8709,
+     -8670,  -8640,  -8766,  -8501,  -8983,  -8124,  -9694,  13998,  23299,  19967,  22214,  20413,  21979,  20551,  21895,  20599,
+     22205,  21096,  20258,  21708,  22266,  20268,  20127,  23374,  22243,  10645,  -4366, -11204,  -9332,  -7247,  -8594,  -9650,
+     -8543,  -7954,  -8912,  -9226,  -8377,  -8249,  -9010,  -9001,  -8315,  -8434,  -9051,  -8841,  -8289,  -8577,  -9067,  -8707,
+     -8281,  -8707,  -9067,  -8577,  -8289,  -8841,  -9051,  -8434,  -8315,  -9001,  -9010,  -8249,  -8377,  -9226,  -8912,  -7954,
+     -8543,  -9650,  -8594,  -7247,  -9332, -11204,  -4366,  10645,  22243,  23374,  20127,  20268,  22266,  21708,  20258,  21096,
+     20688,  20692,  20828,  21330,  22217,  23030,  22856,  20693,  16002,   9125,   1321,  -5664, -10311, -11969, -11101,  -9012,
+     -7193,  -6627,  -7413,  -8868, -10023, -10209,  -9411,  -8214,  -7395,  -7443,  -8278,  -9331,  -9922,  -9689,  -8801,  -7844,
+     -7437,  -7844,  -8801,  -9689,  -9922,  -9331,  -8278,  -7443,  -7395,  -8214,  -9411, -10209, -10023,  -8868,  -7413,  -6627,
+     -7193,  -9012, -11101, -11969, -10311,  -5664,   1321,   9125,  16002,  20693,  22856,  23030,  22217,  21330,  20828,  20692,
+     24497,  24314,  23753,  22789,  21388,  19519,  17171,  14362,  11151,   7642,   3980,    338,  -3092,  -6127,  -8607, -10421,
+    -11516, -11907, -11677, -10965,  -9951,  -8830,  -7795,  -7003,  -6564,  -6525,  -6868,  -7516,  -8345,  -9208,  -9956, -10461,
+    -10639, -10461,  -9956,  -9208,  -8345,  -7516,  -6868,  -6525,  -6564,  -7003,  -7795,  -8830,  -9951, -10965, -11677, -11907,
+    -11516, -10421,  -8607,  -6127,  -3092,    338,   3980,   7642,  11151,  14362,  17171,  19519,  21388,  22789,  23753,  24314,
+     24270,  24020,  23279,  22068,  20423,  18394,  16041,  13431,  10640,   7747,   4831,   1969,   -763,  -3300,  -5585,  -7571,
+     -9223, -10520, -11456, -12036, -12280, -12217, -11889, -11345, -10640,  -9833,  -8982,  -8147,  -7381,  -6731,  -6238,  -5929,
+     -5825,  -5929,  -6238,  -6731,  -7381,  -8147,  -8982,  -9833, -10640, -11345, -11889, -12217, -12280, -12036, -11456, -10520,
+     -9223,  -7571,  -5585,  -3300,   -763,   1969,   4831,   7747,  10640,  13431,  16041,  18394,  20423,  22068,  23279,  24020,
+     15047,  14975,  14758,  14399,  13902,  13271,  12511,  11632,  10640,   9546,   8360,   7093,   5758,   4368,   2936,   1475,
+         0,  -1475,  -2936,  -4368,  -5758,  -7093,  -8360,  -9546, -10640, -11632, -12511, -13271, -13902, -14399, -14758, -14975,
+    -15047, -14975, -14758, -14399, -13902, -13271, -12511, -11632, -10640,  -9546,  -8360,  -7093,  -5758,  -4368,  -2936,  -1475,
+         0,   1475,   2936,   4368,   5758,   7093,   8360,   9546,  10640,  11632,  12511,  13271,  13902,  14399,  14758,  14975,
+    
+    // Frame 8
+     22304,  21968,  22305,  21967,  22306,  21965,  22308,  21962,  22312,  21958,  22316,  21953,  22322,  21946,  22330,  21937,
+     22341,  21925,  22354,  21909,  22373,  21887,  22399,  21856,  22437,  21808,  22498,  21728,  22608,  21568,  22862,  21105,
+     23962,  15123,  -9019,  -7009,  -8298,  -7395,  -8073,  -7542,  -7970,  -7617,  -7913,  -7663,  -7875,  -7694,  -7850,  -7715,
+     -7831,  -7732,  -7817,  -7744,  -7806,  -7754,  -7797,  -7762,  -7789,  -7769,  -7783,  -7775,  -7778,  -7779,  -7774,  -7783,
+     -7770,  -7787,  -7766,  -7790,  -7764,  -7793,  -7761,  -7795,  -7759,  -7797,  -7757,  -7799,  -7755,  -7801,  -7754,  -7802,
+     -7752,  -7804,  -7751,  -7805,  -7750,  -7806,  -7749,  -7807,  -7748,  -7808,  -7747,  -7809,  -7746,  -7809,  -7745,  -7810,
+     -7745,  -7811,  -7744,  -7811,  -7744,  -7812,  -7743,  -7812,  -7743,  -7813,  -7742,  -7813,  -7742,  -7813,  -7742,  -7813,
+     -7741,  -7814,  -7741,  -7814,  -7741,  -7814,  -7741,  -7814,  -7741,  -7814,  -7741,  -7814,  -7741,  -7815,  -7740,  -7815,
+     -7740,  -7815,  -7740,  -7815,  -7741,  -7814,  -7741,  -7814,  -7741,  -7814,  -7741,  -7814,  -7741,  -7814,  -7741,  -7814,
+     -7741,  -7813,  -7742,  -7813,  -7742,  -7813,  -7742,  -7813,  -7743,  -7812,  -7743,  -7812,  -7744,  -7811,  -7744,  -7811,
+     -7745,  -7810,  -7745,  -7809,  -7746,  -7809,  -7747,  -7808,  -7748,  -7807,  -7749,  -7806,  -7750,  -7805,  -7751,  -7804,
+     -7752,  -7802,  -7754,  -7801,  -7755,  -7799,  -7757,  -7797,  -7759,  -7795,  -7761,  -7793,  -7764,  -7790,  -7766,  -7787,
+     -7770,  -7783,  -7774,  -7779,  -7778,  -7775,  -7783,  -7769,  -7789,  -7762,  -7797,  -7754,  -7806,  -7744,  -7817,  -7732,
+     -7831,  -7715,  -7850,  -7694,  -7875,  -7663,  -7913,  -7617,  -7970,  -7542,  -8073,  -7395,  -8298,  -7009,  -9019,  15123,
+     23962,  21105,  22862,  21568,  22608,  21728,  22498,  21808,  22437,  21856,  22399,  21887,  22373,  21909,  22354,  21925,
+     22341,  21937,  22330,  21946,  22322,  21953,  22316,  21958,  22312,  21962,  22308,  21965,  22306,  21967,  22305,  21968,
+     22141,  22131,  22143,  22126,  22149,  22118,  22161,  22103,  22181,  22077,  22213,  22034,  22272,  21951,  22393,  21775,
+     22406,  -2747,  -9145,  -6995,  -8339,  -7329,  -8158,  -7442,  -8081,  -7497,  -8040,  -7530,  -8014,  -7551,  -7996,  -7565,
+     -7984,  -7576,  -7975,  -7584,  -7968,  -7590,  -7962,  -7595,  -7958,  -7599,  -7954,  -7602,  -7951,  -7605,  -7949,  -7607,
+     -7947,  -7609,  -7945,  -7610,  -7944,  -7612,  -7943,  -7612,  -7942,  -7613,  -7942,  -7614,  -7941,  -7614,  -7941,  -7614,
+     -7941,  -7614,  -7941,  -7614,  -7941,  -7614,  -7942,  -7613,  -7942,  -7612,  -7943,  -7612,  -7944,  -7610,  -7945,  -7609,
+     -7947,  -7607,  -7949,  -7605,  -7951,  -7602,  -7954,  -7599,  -7958,  -7595,  -7962,  -7590,  -7968,  -7584,  -7975,  -7576,
+     -7984,  -7565,  -7996,  -7551,  -8014,  -7530,  -8040,  -7497,  -8081,  -7442,  -8158,  -7329,  -8339,  -6995,  -9145,  -2747,
+     22406,  21775,  22393,  21951,  22272,  22034,  22213,  22077,  22181,  22103,  22161,  22118,  22149,  22126,  22143,  22131,
+     21493,  22786,  21465,  22847,  21354,  23044,  20972,  23985,  15898,  -8332,  -7432,  -7947,  -7711,  -7779,  -7821,  -7702,
+     -7876,  -7661,  -7908,  -7635,  -7929,  -7619,  -7942,  -7608,  -7951,  -7600,  -7957,  -7595,  -7961,  -7592,  -7964,  -7591,
+     -7964,  -7591,  -7964,  -7592,  -7961,  -7595,  -7957,  -7600,  -7951,  -7608,  -7942,  -7619,  -7929,  -7635,  -7908,  -7661,
+     -7876,  -7702,  -7821,  -7779,  -7711,  -7947,  -7432,  -8332,  15898,  23985,  20972,  23044,  21354,  22847,  21465,  22786,
+     21177,  22071,  23178,  22344,  20776,  21743,  24495,  22631,  11925,  -2256, -10098,  -9250,  -6427,  -6968,  -8759,  -8322,
+     -6981,  -7379,  -8466,  -8080,  -7157,  -7545,  -8353,  -7955,  -7232,  -7646,  -8302,  -7868,  -7266,  -7724,  -8281,  -7795,
+     -7276,  -7795,  -8281,  -7724,  -7266,  -7868,  -8302,  -7646,  -7232,  -7955,  -8353,  -7545,  -7157,  -8080,  -8466,  -7379,
+     -6981,  -8322,  -8759,  -6968,  -6427,  -9250, -10098,  -2256,  11925,  22631,  24495,  21743,  20776,  22344,  23178,  22071,
+     19770,  20438,  22148,  24099,  25232,  24564,  21524,  16185,   9292,   2066,  -4164,  -8388, -10231, -10036,  -8680,  -7202,
+     -6390,  -6519,  -7336,  -8278,  -8801,  -8667,  -8026,  -7298,  -6914,  -7073,  -7646,  -8269,  -8568,  -8374,  -7819,  -7248,
+     -7009,  -7248,  -7819,  -8374,  -8568,  -8269,  -7646,  -7073,  -6914,  -7298,  -8026,  -8667,  -8801,  -8278,  -7336,  -6519,
+     -6390,  -7202,  -8680, -10036, -10231,  -8388,  -4164,   2066,   9292,  16185,  21524,  24564,  25232,  24099,  22148,  20438,
+     26835,  26456,  25337,  23524,  21093,  18147,  14812,  11229,   7552,   3936,    529,  -2534,  -5145,  -7228,  -8741,  -9686,
+    -10100, -10058,  -9662,  -9032,  -8294,  -7568,  -6959,  -6541,  -6358,  -6418,  -6695,  -7132,  -7654,  -8178,  -8622,  -8918,
+     -9022,  -8918,  -8622,  -8178,  -7654,  -7132,  -6695,  -6418,  -6358,  -6541,  -6959,  -7568,  -8294,  -9032,  -9662, -10058,
+    -10100,  -9686,  -8741,  -7228,  -5145,  -2534,    529,   3936,   7552,  11229,  14812,  18147,  21093,  23524,  25337,  26456,
+     23385,  23136,  22395,  21186,  19545,  17523,  15179,  12585,   9816,   6953,   4076,   1264,  -1407,  -3872,  -6071,  -7960,
+     -9503, -10681, -11488, -11931, -12032, -11824, -11349, -10661,  -9816,  -8877,  -7906,  -6963,  -6106,  -5383,  -4836,  -4495,
+     -4379,  -4495,  -4836,  -5383,  -6106,  -6963,  -7906,  -8877,  -9816, -10661, -11349, -11824, -12032, -11931, -11488, -10681,
+     -9503,  -7960,  -6071,  -3872,  -1407,   1264,   4076,   6953,   9816,  12585,  15179,  17523,  19545,  21186,  22395,  23136,
+     13882,  13815,  13615,  13284,  12825,  12243,  11543,  10731,   9816,   8807,   7713,   6544,   5312,   4030,   2708,   1361,
+         0,  -1361,  -2708,  -4030,  -5312,  -6544,  -7713,  -8807,  -9816, -10731, -11543, -12243, -12825, -13284, -13615, -13815,
+    -13882, -13815, -13615, -13284, -12825, -12243, -11543, -10731,  -9816,  -8807,  -7713,  -6544,  -5312,  -4030,  -2708,  -1361,
+         0,   1361,   2708,   4030,   5312,   6544,   7713,   8807,   9816,  10731,  11543,  12243,  12825,  13284,  13615,  13815,
+    
+    // Frame 9
+     23146,  22921,  23146,  22921,  23146,  22920,  23148,  22918,  23149,  22916,  23152,  22914,  23155,  22910,  23159,  22905,
+     23165,  22898,  23174,  22887,  23187,  22870,  23209,  22840,  23251,  22778,  23354,  22579,  23859,  19838,  -5967,  -6948,
+     -6881,  -6875,  -6879,  -6889,  -6864,  -6902,  -6853,  -6911,  -6846,  -6918,  -6840,  -6923,  -6835,  -6927,  -6832,  -6930,
+     -6829,  -6932,  -6827,  -6934,  -6825,  -6936,  -6823,  -6938,  -6822,  -6939,  -6821,  -6940,  -6820,  -6941,  -6819,  -6942,
+     -6818,  -6942,  -6818,  -6943,  -6817,  -6943,  -6817,  -6944,  -6816,  -6944,  -6816,  -6945,  -6815,  -6945,  -6815,  -6945,
+     -6815,  -6946,  -6814,  -6946,  -6814,  -6946,  -6814,  -6946,  -6814,  -6947,  -6813,  -6947,  -6813,  -6947,  -6813,  -6947,
+     -6813,  -6947,  -6813,  -6947,  -6813,  -6948,  -6813,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,
+     -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,
+     -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,
+     -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6812,  -6948,  -6813,  -6948,  -6813,  -6947,  -6813,  -6947,
+     -6813,  -6947,  -6813,  -6947,  -6813,  -6947,  -6813,  -6947,  -6814,  -6946,  -6814,  -6946,  -6814,  -6946,  -6814,  -6946,
+     -6815,  -6945,  -6815,  -6945,  -6815,  -6945,  -6816,  -6944,  -6816,  -6944,  -6817,  -6943,  -6817,  -6943,  -6818,  -6942,
+     -6818,  -6942,  -6819,  -6941,  -6820,  -6940,  -6821,  -6939,  -6822,  -6938,  -6823,  -6936,  -6825,  -6934,  -6827,  -6932,
+     -6829,  -6930,  -6832,  -6927,  -6835,  -6923,  -6840,  -6918,  -6846,  -6911,  -6853,  -6902,  -6864,  -6889,  -6879,  -6875,
+     -6881,  -6948,  -5967,  19838,  23859,  22579,  23354,  22778,  23251,  22840,  23209,  22870,  23187,  22887,  23174,  22898,
+     23165,  22905,  23159,  22910,  23155,  22914,  23152,  22916,  23149,  22918,  23148,  22920,  23146,  22921,  23146,  22921,
+     23162,  22903,  23167,  22894,  23181,  22873,  23210,  22836,  23260,  22766,  23357,  22625,  23577,  22244,  24294,    115,
+     -8691,  -5864,  -7593,  -6324,  -7342,  -6482,  -7234,  -6560,  -7174,  -6606,  -7137,  -6636,  -7113,  -6657,  -7095,  -6673,
+     -7081,  -6684,  -7071,  -6693,  -7063,  -6700,  -7057,  -6706,  -7052,  -6711,  -7048,  -6714,  -7044,  -6717,  -7041,  -6720,
+     -7039,  -6722,  -7037,  -6724,  -7036,  -6725,  -7034,  -6726,  -7033,  -6727,  -7033,  -6728,  -7032,  -6728,  -7032,  -6729,
+     -7032,  -6729,  -7032,  -6728,  -7032,  -6728,  -7033,  -6727,  -7033,  -6726,  -7034,  -6725,  -7036,  -6724,  -7037,  -6722,
+     -7039,  -6720,  -7041,  -6717,  -7044,  -6714,  -7048,  -6711,  -7052,  -6706,  -7057,  -6700,  -7063,  -6693,  -7071,  -6684,
+     -7081,  -6673,  -7095,  -6657,  -7113,  -6636,  -7137,  -6606,  -7174,  -6560,  -7234,  -6482,  -7342,  -6324,  -7593,  -5864,
+     -8691,    115,  24294,  22244,  23577,  22625,  23357,  22766,  23260,  22836,  23210,  22873,  23181,  22894,  23167,  22903,
+     23670,  22389,  23705,  22308,  23860,  21995,  24650,  17760,  -6913,  -6752,  -6908,  -6921,  -6793,  -6999,  -6738,  -7040,
+     -6707,  -7063,  -6689,  -7078,  -6676,  -7088,  -6668,  -7095,  -6662,  -7100,  -6658,  -7103,  -6656,  -7105,  -6654,  -7106,
+     -6654,  -7106,  -6654,  -7105,  -6656,  -7103,  -6658,  -7100,  -6662,  -7095,  -6668,  -7088,  -6676,  -7078,  -6689,  -7063,
+     -6707,  -7040,  -6738,  -6999,  -6793,  -6921,  -6908,  -6752,  -6913,  17760,  24650,  21995,  23860,  22308,  23705,  22389,
+     21820,  23246,  24285,  22287,  21650,  24905,  24596,  13672,  -1628,  -9263,  -7757,  -5488,  -6678,  -7849,  -6833,  -6152,
+     -7051,  -7447,  -6638,  -6432,  -7166,  -7234,  -6564,  -6606,  -7216,  -7085,  -6531,  -6738,  -7238,  -6964,  -6517,  -6852,
+     -7244,  -6852,  -6517,  -6964,  -7238,  -6738,  -6531,  -7085,  -7216,  -6606,  -6564,  -7234,  -7166,  -6432,  -6638,  -7447,
+     -7051,  -6152,  -6833,  -7849,  -6678,  -5488,  -7757,  -9263,  -1628,  13672,  24596,  24905,  21650,  22287,  24285,  23246,
+     20088,  21148,  23693,  26114,  26584,  23908,  18069,  10242,   2275,  -4074,  -7797,  -8913,  -8269,  -7032,  -6148,  -6009,
+     -6458,  -7048,  -7374,  -7300,  -6971,  -6657,  -6560,  -6701,  -6936,  -7086,  -7061,  -6907,  -6757,  -6725,  -6822,  -6959,
+     -7022,  -6959,  -6822,  -6725,  -6757,  -6907,  -7061,  -7086,  -6936,  -6701,  -6560,  -6657,  -6971,  -7300,  -7374,  -7048,
+     -6458,  -6009,  -6148,  -7032,  -8269,  -8913,  -7797,  -4074,   2275,  10242,  18069,  23908,  26584,  26114,  23693,  21148,
+     28475,  27916,  26282,  23690,  20324,  16416,  12225,   8009,   4009,    422,  -2605,  -4990,  -6711,  -7804,  -8350,  -8461,
+     -8263,  -7882,  -7430,  -6999,  -6649,  -6413,  -6300,  -6296,  -6377,  -6511,  -6669,  -6826,  -6964,  -7074,  -7152,  -7198,
+     -7213,  -7198,  -7152,  -7074,  -6964,  -6826,  -6669,  -6511,  -6377,  -6296,  -6300,  -6413,  -6649,  -6999,  -7430,  -7882,
+     -8263,  -8461,  -8350,  -7804,  -6711,  -4990,  -2605,    422,   4009,   8009,  12225,  16416,  20324,  23690,  26282,  27916,
+     22040,  21798,  21079,  19906,  18315,  16355,  14086,  11578,   8905,   6146,   3382,    688,  -1860,  -4199,  -6271,  -8031,
+     -9447, -10500, -11185, -11510, -11499, -11185, -10612,  -9832,  -8905,  -7892,  -6856,  -5858,  -4955,  -4197,  -3624,  -3268,
+     -3147,  -3268,  -3624,  -4197,  -4955,  -5858,  -6856,  -7892,  -8905,  -9832, -10612, -11185, -11499, -11510, -11185, -10500,
+     -9447,  -8031,  -6271,  -4199,  -1860,    688,   3382,   6146,   8905,  11578,  14086,  16355,  18315,  19906,  21079,  21798,
+     12594,  12533,  12352,  12051,  11635,  11107,  10471,   9735,   8905,   7989,   6997,   5937,   4819,   3656,   2457,   1234,
+         0,  -1234,  -2457,  -3656,  -4819,  -5937,  -6997,  -7989,  -8905,  -9735, -10471, -11107, -11635, -12051, -12352, -12533,
+    -12594, -12533, -12352, -12051, -11635, -11107, -10471,  -9735,  -8905,  -7989,  -6997,  -5937,  -4819,  -3656,  -2457,  -1234,
+         0,   1234,   2457,   3656,   4819,   5937,   6997,   7989,   8905,   9735,  10471,  11107,  11635,  12051,  12352,  12533,
+    
+    // Frame 10
+     23934,  23928,  23933,  23929,  23932,  23930,  23930,  23933,  23927,  23937,  23922,  23942,  23916,  23950,  23907,  23960,
+     23895,  23975,  23876,  23999,  23847,  24037,  23796,  24101,  23739,  23680,  -1935,  -7042,  -5402,  -6386,  -5669,  -6243,
+     -5758,  -6183,  -5801,  -6151,  -5826,  -6130,  -5842,  -6117,  -5854,  -6107,  -5862,  -6099,  -5869,  -6094,  -5874,  -6089,
+     -5878,  -6085,  -5882,  -6082,  -5884,  -6080,  -5887,  -6078,  -5889,  -6076,  -5890,  -6074,  -5892,  -6073,  -5893,  -6072,
+     -5894,  -6070,  -5895,  -6070,  -5896,  -6069,  -5897,  -6068,  -5898,  -6067,  -5899,  -6067,  -5899,  -6066,  -5900,  -6066,
+     -5900,  -6065,  -5901,  -6065,  -5901,  -6064,  -5901,  -6064,  -5902,  -6064,  -5902,  -6063,  -5902,  -6063,  -5902,  -6063,
+     -5903,  -6063,  -5903,  -6062,  -5903,  -6062,  -5903,  -6062,  -5903,  -6062,  -5904,  -6062,  -5904,  -6062,  -5904,  -6062,
+     -5904,  -6062,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,
+     -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6061,  -5904,  -6062,
+     -5904,  -6062,  -5904,  -6062,  -5904,  -6062,  -5904,  -6062,  -5903,  -6062,  -5903,  -6062,  -5903,  -6062,  -5903,  -6063,
+     -5903,  -6063,  -5902,  -6063,  -5902,  -6063,  -5902,  -6064,  -5902,  -6064,  -5901,  -6064,  -5901,  -6065,  -5901,  -6065,
+     -5900,  -6066,  -5900,  -6066,  -5899,  -6067,  -5899,  -6067,  -5898,  -6068,  -5897,  -6069,  -5896,  -6070,  -5895,  -6070,
+     -5894,  -6072,  -5893,  -6073,  -5892,  -6074,  -5890,  -6076,  -5889,  -6078,  -5887,  -6080,  -5884,  -6082,  -5882,  -6085,
+     -5878,  -6089,  -5874,  -6094,  -5869,  -6099,  -5862,  -6107,  -5854,  -6117,  -5842,  -6130,  -5826,  -6151,  -5801,  -6183,
+     -5758,  -6243,  -5669,  -6386,  -5402,  -7042,  -1935,  23680,  23739,  24101,  23796,  24037,  23847,  23999,  23876,  23975,
+     23895,  23960,  23907,  23950,  23916,  23942,  23922,  23937,  23927,  23933,  23930,  23930,  23932,  23929,  23933,  23928,
+     24206,  23653,  24215,  23635,  24245,  23591,  24306,  23505,  24429,  23321,  24725,  22786,  25936,   3128,  -8158,  -4788,
+     -6804,  -5355,  -6493,  -5550,  -6360,  -5647,  -6286,  -5704,  -6241,  -5741,  -6210,  -5767,  -6188,  -5786,  -6172,  -5800,
+     -6160,  -5811,  -6150,  -5820,  -6142,  -5827,  -6136,  -5832,  -6131,  -5837,  -6127,  -5841,  -6123,  -5844,  -6120,  -5847,
+     -6118,  -5849,  -6116,  -5851,  -6114,  -5852,  -6113,  -5853,  -6112,  -5854,  -6111,  -5855,  -6110,  -5855,  -6110,  -5855,
+     -6110,  -5855,  -6110,  -5855,  -6110,  -5855,  -6111,  -5854,  -6112,  -5853,  -6113,  -5852,  -6114,  -5851,  -6116,  -5849,
+     -6118,  -5847,  -6120,  -5844,  -6123,  -5841,  -6127,  -5837,  -6131,  -5832,  -6136,  -5827,  -6142,  -5820,  -6150,  -5811,
+     -6160,  -5800,  -6172,  -5786,  -6188,  -5767,  -6210,  -5741,  -6241,  -5704,  -6286,  -5647,  -6360,  -5550,  -6493,  -5355,
+     -6804,  -4788,  -8158,   3128,  25936,  22786,  24725,  23321,  24429,  23505,  24306,  23591,  24245,  23635,  24215,  23653,
+     23321,  24551,  23275,  24662,  23033,  25298,  19582,  -5437,  -6080,  -5869,  -6129,  -5811,  -6173,  -5778,  -6198,  -5759,
+     -6213,  -5748,  -6222,  -5740,  -6229,  -5734,  -6233,  -5731,  -6236,  -5728,  -6238,  -5726,  -6240,  -5725,  -6240,  -5725,
+     -6241,  -5725,  -6240,  -5725,  -6240,  -5726,  -6238,  -5728,  -6236,  -5731,  -6233,  -5734,  -6229,  -5740,  -6222,  -5748,
+     -6213,  -5759,  -6198,  -5778,  -6173,  -5811,  -6129,  -5869,  -6080,  -5437,  19582,  25298,  23033,  24662,  23275,  24551,
+     25144,  24061,  22537,  23495,  26187,  24783,  14817,    637,  -8039,  -7776,  -4747,  -4971,  -6899,  -6678,  -5227,  -5464,
+     -6646,  -6385,  -5378,  -5666,  -6549,  -6232,  -5443,  -5790,  -6504,  -6127,  -5474,  -5883,  -6483,  -6042,  -5487,  -5963,
+     -6477,  -5963,  -5487,  -6042,  -6483,  -5883,  -5474,  -6127,  -6504,  -5790,  -5443,  -6232,  -6549,  -5666,  -5378,  -6385,
+     -6646,  -5464,  -5227,  -6678,  -6899,  -4971,  -4747,  -7776,  -8039,    637,  14817,  24783,  26187,  23495,  22537,  24061,
+     22368,  23232,  25125,  26326,  25029,  20330,  12777,   4170,  -3246,  -7787,  -9021,  -7813,  -5763,  -4357,  -4306,  -5360,
+     -6656,  -7332,  -7041,  -6086,  -5155,  -4848,  -5314,  -6191,  -6879,  -6936,  -6356,  -5549,  -5056,  -5196,  -5862,  -6602,
+     -6919,  -6602,  -5862,  -5196,  -5056,  -5549,  -6356,  -6936,  -6879,  -6191,  -5314,  -4848,  -5155,  -6086,  -7041,  -7332,
+     -6656,  -5360,  -4306,  -4357,  -5763,  -7813,  -9021,  -7787,  -3246,   4170,  12777,  20330,  25029,  26326,  25125,  23232,
+     29085,  28384,  26343,  23142,  19055,  14424,   9616,   4988,    848,  -2575,  -5147,  -6833,  -7697,  -7876,  -7558,  -6952,
+     -6257,  -5641,  -5217,  -5041,  -5109,  -5370,  -5742,  -6129,  -6444,  -6625,  -6643,  -6503,  -6248,  -5941,  -5653,  -5450,
+     -5377,  -5450,  -5653,  -5941,  -6248,  -6503,  -6643,  -6625,  -6444,  -6129,  -5742,  -5370,  -5109,  -5041,  -5217,  -5641,
+     -6257,  -6952,  -7558,  -7876,  -7697,  -6833,  -5147,  -2575,    848,   4988,   9616,  14424,  19055,  23142,  26343,  28384,
+     20249,  20021,  19345,  18241,  16745,  14903,  12773,  10419,   7915,   5334,   2753,    245,  -2120,  -4280,  -6183,  -7785,
+     -9056,  -9979, -10550, -10779, -10687, -10308,  -9684,  -8868,  -7915,  -6886,  -5842,  -4841,  -3938,  -3182,  -2612,  -2258,
+     -2138,  -2258,  -2612,  -3182,  -3938,  -4841,  -5842,  -6886,  -7915,  -8868,  -9684, -10308, -10687, -10779, -10550,  -9979,
+     -9056,  -7785,  -6183,  -4280,  -2120,    245,   2753,   5334,   7915,  10419,  12773,  14903,  16745,  18241,  19345,  20021,
+     11194,  11140,  10978,  10712,  10341,   9872,   9307,   8653,   7915,   7101,   6219,   5277,   4284,   3249,   2184,   1097,
+         0,  -1097,  -2184,  -3249,  -4284,  -5277,  -6219,  -7101,  -7915,  -8653,  -9307,  -9872, -10341, -10712, -10978, -11140,
+    -11194, -11140, -10978, -10712, -10341,  -9872,  -9307,  -8653,  -7915,  -7101,  -6219,  -5277,  -4284,  -3249,  -2184,  -1097,
+         0,   1097,   2184,   3249,   4284,   5277,   6219,   7101,   7915,   8653,   9307,   9872,  10341,  10712,  10978,  11140,
+    
+    // Frame 11
+     24684,  24973,  24682,  24976,  24677,  24983,  24668,  24995,  24654,  25012,  24632,  25038,  24600,  25078,  24550,  25143,
+     24464,  25261,  24294,  25527,  23825,  26520,   2921,  -7058,  -4005,  -5824,  -4524,  -5538,  -4704,  -5414,  -4795,  -5346,
+     -4849,  -5303,  -4884,  -5273,  -4909,  -5252,  -4928,  -5235,  -4942,  -5223,  -4953,  -5213,  -4962,  -5205,  -4969,  -5198,
+     -4975,  -5192,  -4981,  -5188,  -4985,  -5184,  -4989,  -5180,  -4992,  -5177,  -4995,  -5174,  -4998,  -5172,  -5000,  -5170,
+     -5002,  -5168,  -5004,  -5166,  -5005,  -5165,  -5007,  -5163,  -5008,  -5162,  -5009,  -5161,  -5010,  -5160,  -5011,  -5159,
+     -5012,  -5158,  -5013,  -5158,  -5013,  -5157,  -5014,  -5156,  -5015,  -5156,  -5015,  -5155,  -5016,  -5155,  -5016,  -5154,
+     -5017,  -5154,  -5017,  -5154,  -5017,  -5153,  -5018,  -5153,  -5018,  -5153,  -5018,  -5152,  -5018,  -5152,  -5019,  -5152,
+     -5019,  -5152,  -5019,  -5152,  -5019,  -5152,  -5019,  -5151,  -5019,  -5151,  -5019,  -5151,  -5019,  -5151,  -5019,  -5151,
+     -5019,  -5151,  -5019,  -5151,  -5019,  -5151,  -5019,  -5151,  -5019,  -5151,  -5019,  -5152,  -5019,  -5152,  -5019,  -5152,
+     -5019,  -5152,  -5019,  -5152,  -5018,  -5152,  -5018,  -5153,  -5018,  -5153,  -5018,  -5153,  -5017,  -5154,  -5017,  -5154,
+     -5017,  -5154,  -5016,  -5155,  -5016,  -5155,  -5015,  -5156,  -5015,  -5156,  -5014,  -5157,  -5013,  -5158,  -5013,  -5158,
+     -5012,  -5159,  -5011,  -5160,  -5010,  -5161,  -5009,  -5162,  -5008,  -5163,  -5007,  -5165,  -5005,  -5166,  -5004,  -5168,
+     -5002,  -5170,  -5000,  -5172,  -4998,  -5174,  -4995,  -5177,  -4992,  -5180,  -4989,  -5184,  -4985,  -5188,  -4981,  -5192,
+     -4975,  -5198,  -4969,  -5205,  -4962,  -5213,  -4953,  -5223,  -4942,  -5235,  -4928,  -5252,  -4909,  -5273,  -4884,  -5303,
+     -4849,  -5346,  -4795,  -5414,  -4704,  -5538,  -4524,  -5824,  -4005,  -7058,   2921,  26520,  23825,  25527,  24294,  25261,
+     24464,  25143,  24550,  25078,  24600,  25038,  24632,  25012,  24654,  24995,  24668,  24983,  24677,  24976,  24682,  24973,
+     25272,  24380,  25289,  24344,  25349,  24253,  25485,  24045,  25826,  23412,  27340,   6250,  -7510,  -3784,  -5961,  -4429,
+     -5608,  -4651,  -5457,  -4760,  -5375,  -4824,  -5324,  -4865,  -5290,  -4894,  -5265,  -4915,  -5247,  -4931,  -5234,  -4943,
+     -5223,  -4952,  -5214,  -4960,  -5208,  -4966,  -5202,  -4971,  -5197,  -4975,  -5194,  -4979,  -5190,  -4982,  -5188,  -4984,
+     -5186,  -4986,  -5184,  -4988,  -5182,  -4989,  -5181,  -4990,  -5180,  -4991,  -5179,  -4992,  -5179,  -4992,  -5178,  -4992,
+     -5178,  -4992,  -5178,  -4992,  -5179,  -4992,  -5179,  -4991,  -5180,  -4990,  -5181,  -4989,  -5182,  -4988,  -5184,  -4986,
+     -5186,  -4984,  -5188,  -4982,  -5190,  -4979,  -5194,  -4975,  -5197,  -4971,  -5202,  -4966,  -5208,  -4960,  -5214,  -4952,
+     -5223,  -4943,  -5234,  -4931,  -5247,  -4915,  -5265,  -4894,  -5290,  -4865,  -5324,  -4824,  -5375,  -4760,  -5457,  -4651,
+     -5608,  -4429,  -5961,  -3784,  -7510,   6250,  27340,  23412,  25826,  24045,  25485,  24253,  25349,  24344,  25289,  24380,
+     25387,  24256,  25449,  24087,  25932,  21362,  -3908,  -5412,  -4831,  -5332,  -4835,  -5341,  -4826,  -5349,  -4818,  -5355,
+     -4814,  -5359,  -4810,  -5362,  -4808,  -5364,  -4806,  -5365,  -4805,  -5366,  -4804,  -5367,  -4804,  -5367,  -4803,  -5367,
+     -4803,  -5367,  -4803,  -5367,  -4804,  -5367,  -4804,  -5366,  -4805,  -5365,  -4806,  -5364,  -4808,  -5362,  -4810,  -5359,
+     -4814,  -5355,  -4818,  -5349,  -4826,  -5341,  -4835,  -5332,  -4831,  -5412,  -3908,  21362,  25932,  24087,  25449,  24256,
+     26447,  24460,  23100,  26339,  26942,  16708,   1115,  -7281,  -6143,  -3743,  -4790,  -6039,  -5102,  -4359,  -5206,  -5659,
+     -4887,  -4625,  -5333,  -5456,  -4806,  -4789,  -5387,  -5318,  -4768,  -4911,  -5413,  -5207,  -4751,  -5013,  -5424,  -5109,
+     -4746,  -5109,  -5424,  -5013,  -4751,  -5207,  -5413,  -4911,  -4768,  -5318,  -5387,  -4789,  -4806,  -5456,  -5333,  -4625,
+     -4887,  -5659,  -5206,  -4359,  -5102,  -6039,  -4790,  -3743,  -6143,  -7281,   1115,  16708,  26942,  26339,  23100,  24460,
+     26249,  26270,  25920,  24230,  20330,  14114,   6511,   -800,  -6109,  -8445,  -7991,  -5938,  -3856,  -2936,  -3486,  -4934,
+     -6279,  -6721,  -6094,  -4894,  -3918,  -3755,  -4448,  -5506,  -6238,  -6196,  -5441,  -4482,  -3940,  -4154,  -4970,  -5853,
+     -6228,  -5853,  -4970,  -4154,  -3940,  -4482,  -5441,  -6196,  -6238,  -5506,  -4448,  -3755,  -3918,  -4894,  -6094,  -6721,
+     -6279,  -4934,  -3486,  -2936,  -3856,  -5938,  -7991,  -8445,  -6109,   -800,   6511,  14114,  20330,  24230,  25920,  26270,
+     28402,  27616,  25334,  21778,  17284,  12269,   7173,   2417,  -1651,  -4787,  -6873,  -7918,  -8052,  -7490,  -6500,  -5361,
+     -4324,  -3578,  -3233,  -3309,  -3748,  -4429,  -5198,  -5896,  -6388,  -6589,  -6472,  -6074,  -5484,  -4826,  -4232,  -3821,
+     -3675,  -3821,  -4232,  -4826,  -5484,  -6074,  -6472,  -6589,  -6388,  -5896,  -5198,  -4429,  -3748,  -3309,  -3233,  -3578,
+     -4324,  -5361,  -6500,  -7490,  -8052,  -7918,  -6873,  -4787,  -1651,   2417,   7173,  12269,  17284,  21778,  25334,  27616,
+     18038,  17831,  17217,  16214,  14856,  13185,  11253,   9121,   6855,   4522,   2193,    -66,  -2190,  -4124,  -5818,  -7233,
+     -8344,  -9134,  -9600,  -9752,  -9610,  -9205,  -8579,  -7778,  -6855,  -5866,  -4867,  -3914,  -3056,  -2339,  -1799,  -1464,
+     -1350,  -1464,  -1799,  -2339,  -3056,  -3914,  -4867,  -5866,  -6855,  -7778,  -8579,  -9205,  -9610,  -9752,  -9600,  -9134,
+     -8344,  -7233,  -5818,  -4124,  -2190,    -66,   2193,   4522,   6855,   9121,  11253,  13185,  14856,  16214,  17217,  17831,
+      9694,   9647,   9508,   9277,   8956,   8549,   8060,   7494,   6855,   6150,   5386,   4570,   3710,   2814,   1891,    950,
+         0,   -950,  -1891,  -2814,  -3710,  -4570,  -5386,  -6150,  -6855,  -7494,  -8060,  -8549,  -8956,  -9277,  -9508,  -9647,
+     -9694,  -9647,  -9508,  -9277,  -8956,  -8549,  -8060,  -7494,  -6855,  -6150,  -5386,  -4570,  -3710,  -2814,  -1891,   -950,
+         0,    950,   1891,   2814,   3710,   4570,   5386,   6150,   6855,   7494,   8060,   8549,   8956,   9277,   9508,   9647,
+    
+    // Frame 12
+     25424,  26029,  25419,  26037,  25407,  26055,  25383,  26086,  25344,  26136,  25279,  26221,  25165,  26379,  24933,  26748,
+     24259,  28362,   8327,  -6719,  -2834,  -5095,  -3512,  -4723,  -3747,  -4561,  -3865,  -4472,  -3935,  -4416,  -3981,  -4378,
+     -4013,  -4350,  -4037,  -4329,  -4055,  -4313,  -4070,  -4300,  -4081,  -4290,  -4090,  -4281,  -4098,  -4274,  -4105,  -4268,
+     -4110,  -4263,  -4115,  -4259,  -4119,  -4255,  -4123,  -4251,  -4126,  -4248,  -4129,  -4246,  -4131,  -4243,  -4133,  -4241,
+     -4135,  -4240,  -4137,  -4238,  -4139,  -4236,  -4140,  -4235,  -4141,  -4234,  -4143,  -4233,  -4144,  -4232,  -4145,  -4231,
+     -4145,  -4230,  -4146,  -4229,  -4147,  -4228,  -4148,  -4228,  -4148,  -4227,  -4149,  -4227,  -4149,  -4226,  -4150,  -4226,
+     -4150,  -4225,  -4151,  -4225,  -4151,  -4225,  -4151,  -4224,  -4152,  -4224,  -4152,  -4224,  -4152,  -4224,  -4152,  -4223,
+     -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,
+     -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,  -4153,  -4223,
+     -4153,  -4223,  -4152,  -4224,  -4152,  -4224,  -4152,  -4224,  -4152,  -4224,  -4151,  -4225,  -4151,  -4225,  -4151,  -4225,
+     -4150,  -4226,  -4150,  -4226,  -4149,  -4227,  -4149,  -4227,  -4148,  -4228,  -4148,  -4228,  -4147,  -4229,  -4146,  -4230,
+     -4145,  -4231,  -4145,  -4232,  -4144,  -4233,  -4143,  -4234,  -4141,  -4235,  -4140,  -4236,  -4139,  -4238,  -4137,  -4240,
+     -4135,  -4241,  -4133,  -4243,  -4131,  -4246,  -4129,  -4248,  -4126,  -4251,  -4123,  -4255,  -4119,  -4259,  -4115,  -4263,
+     -4110,  -4268,  -4105,  -4274,  -4098,  -4281,  -4090,  -4290,  -4081,  -4300,  -4070,  -4313,  -4055,  -4329,  -4037,  -4350,
+     -4013,  -4378,  -3981,  -4416,  -3935,  -4472,  -3865,  -4561,  -3747,  -4723,  -3512,  -5095,  -2834,  -6719,   8327,  28362,
+     24259,  26748,  24933,  26379,  25165,  26221,  25279,  26136,  25344,  26086,  25383,  26055,  25407,  26037,  25419,  26029,
+     26363,  25080,  26397,  25007,  26524,  24798,  26878,  24126,  28525,   9436,  -6713,  -2867,  -5057,  -3552,  -4684,  -3785,
+     -4525,  -3899,  -4440,  -3965,  -4387,  -4008,  -4352,  -4037,  -4327,  -4058,  -4309,  -4074,  -4295,  -4086,  -4285,  -4095,
+     -4276,  -4103,  -4269,  -4109,  -4264,  -4114,  -4259,  -4118,  -4256,  -4122,  -4252,  -4125,  -4250,  -4127,  -4248,  -4129,
+     -4246,  -4131,  -4244,  -4132,  -4243,  -4133,  -4242,  -4134,  -4241,  -4135,  -4240,  -4136,  -4240,  -4136,  -4240,  -4136,
+     -4240,  -4136,  -4240,  -4136,  -4240,  -4136,  -4240,  -4135,  -4241,  -4134,  -4242,  -4133,  -4243,  -4132,  -4244,  -4131,
+     -4246,  -4129,  -4248,  -4127,  -4250,  -4125,  -4252,  -4122,  -4256,  -4118,  -4259,  -4114,  -4264,  -4109,  -4269,  -4103,
+     -4276,  -4095,  -4285,  -4086,  -4295,  -4074,  -4309,  -4058,  -4327,  -4037,  -4352,  -4008,  -4387,  -3965,  -4440,  -3899,
+     -4525,  -3785,  -4684,  -3552,  -5057,  -2867,  -6713,   9436,  28525,  24126,  26878,  24798,  26524,  25007,  26397,  25080,
+     25251,  26219,  25158,  26551,  23100,  -2329,  -4744,  -3800,  -4528,  -3867,  -4500,  -3881,  -4492,  -3886,  -4489,  -3888,
+     -4487,  -3889,  -4487,  -3889,  -4486,  -3890,  -4486,  -3890,  -4486,  -3890,  -4486,  -3890,  -4486,  -3890,  -4486,  -3890,
+     -4486,  -3890,  -4486,  -3890,  -4486,  -3890,  -4486,  -3890,  -4486,  -3890,  -4486,  -3890,  -4486,  -3889,  -4487,  -3889,
+     -4487,  -3888,  -4489,  -3886,  -4492,  -3881,  -4500,  -3867,  -4528,  -3800,  -4744,  -2329,  23100,  26551,  25158,  26219,
+     24015,  25441,  27986,  26764,  17609,   3643,  -5878,  -6337,  -3114,  -2945,  -5009,  -5056,  -3493,  -3531,  -4811,  -4704,
+     -3609,  -3774,  -4738,  -4520,  -3658,  -3922,  -4703,  -4396,  -3682,  -4032,  -4687,  -4297,  -3694,  -4124,  -4680,  -4209,
+     -3697,  -4209,  -4680,  -4124,  -3694,  -4297,  -4687,  -4032,  -3682,  -4396,  -4703,  -3922,  -3658,  -4520,  -4738,  -3774,
+     -3609,  -4704,  -4811,  -3531,  -3493,  -5056,  -5009,  -2945,  -3114,  -6337,  -5878,   3643,  17609,  26764,  27986,  25441,
+     30175,  28970,  25480,  20092,  13490,   6615,    513,  -3921,  -6225,  -6525,  -5484,  -4039,  -3026,  -2876,  -3496,  -4412,
+     -5065,  -5120,  -4617,  -3909,  -3434,  -3454,  -3919,  -4519,  -4881,  -4796,  -4337,  -3802,  -3524,  -3670,  -4140,  -4635,
+     -4843,  -4635,  -4140,  -3670,  -3524,  -3802,  -4337,  -4796,  -4881,  -4519,  -3919,  -3454,  -3434,  -3909,  -4617,  -5120,
+     -5065,  -4412,  -3496,  -2876,  -3026,  -4039,  -5484,  -6525,  -6225,  -3921,    513,   6615,  13490,  20092,  25480,  28970,
+     26270,  25469,  23150,  19550,  15032,  10040,   5043,    480,  -3291,  -6030,  -7640,  -8162,  -7765,  -6710,  -5305,  -3865,
+     -2660,  -1885,  -1637,  -1911,  -2610,  -3569,  -4589,  -5473,  -6062,  -6259,  -6042,  -5467,  -4656,  -3770,  -2980,  -2437,
+     -2244,  -2437,  -2980,  -3770,  -4656,  -5467,  -6042,  -6259,  -6062,  -5473,  -4589,  -3569,  -2610,  -1911,  -1637,  -1885,
+     -2660,  -3865,  -5305,  -6710,  -7765,  -8162,  -7640,  -6030,  -3291,    480,   5043,  10040,  15032,  19550,  23150,  25469,
+     15445,  15265,  14731,  13859,  12679,  11227,   9549,   7699,   5733,   3713,   1697,   -254,  -2085,  -3746,  -5196,  -6401,
+     -7337,  -7990,  -8360,  -8454,  -8291,  -7898,  -7312,  -6575,  -5733,  -4837,  -3934,  -3075,  -2303,  -1659,  -1174,   -874,
+      -772,   -874,  -1174,  -1659,  -2303,  -3075,  -3934,  -4837,  -5733,  -6575,  -7312,  -7898,  -8291,  -8454,  -8360,  -7990,
+     -7337,  -6401,  -5196,  -3746,  -2085,   -254,   1697,   3713,   5733,   7699,   9549,  11227,  12679,  13859,  14731,  15265,
+      8108,   8069,   7953,   7759,   7491,   7151,   6742,   6268,   5733,   5144,   4505,   3822,   3103,   2354,   1582,    795,
+         0,   -795,  -1582,  -2354,  -3103,  -3822,  -4505,  -5144,  -5733,  -6268,  -6742,  -7151,  -7491,  -7759,  -7953,  -8069,
+     -8108,  -8069,  -7953,  -7759,  -7491,  -7151,  -6742,  -6268,  -5733,  -5144,  -4505,  -3822,  -3103,  -2354,  -1582,   -795,
+         0,    795,   1582,   2354,   3103,   3822,   4505,   5144,   5733,   6268,   6742,   7151,   7491,   7759,   7953,   8069,
+    
+    // Frame 13
+     26190,  27059,  26181,  27076,  26153,  27117,  26096,  27195,  25989,  27348,  25761,  27714,  25089,  29333,  13932,  -5751,
+     -1998,  -4139,  -2672,  -3769,  -2905,  -3610,  -3021,  -3522,  -3089,  -3467,  -3134,  -3430,  -3165,  -3403,  -3188,  -3384,
+     -3206,  -3368,  -3219,  -3356,  -3230,  -3346,  -3239,  -3338,  -3246,  -3332,  -3252,  -3326,  -3257,  -3321,  -3262,  -3317,
+     -3266,  -3314,  -3269,  -3311,  -3272,  -3308,  -3274,  -3306,  -3276,  -3303,  -3278,  -3302,  -3280,  -3300,  -3282,  -3298,
+     -3283,  -3297,  -3284,  -3296,  -3286,  -3295,  -3287,  -3294,  -3288,  -3293,  -3288,  -3292,  -3289,  -3291,  -3290,  -3291,
+     -3291,  -3290,  -3291,  -3289,  -3292,  -3289,  -3292,  -3288,  -3293,  -3288,  -3293,  -3288,  -3294,  -3287,  -3294,  -3287,
+     -3294,  -3287,  -3295,  -3286,  -3295,  -3286,  -3295,  -3286,  -3295,  -3286,  -3295,  -3285,  -3296,  -3285,  -3296,  -3285,
+     -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3284,
+     -3296,  -3284,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3296,  -3285,
+     -3296,  -3285,  -3296,  -3285,  -3296,  -3285,  -3295,  -3286,  -3295,  -3286,  -3295,  -3286,  -3295,  -3286,  -3295,  -3287,
+     -3294,  -3287,  -3294,  -3287,  -3294,  -3288,  -3293,  -3288,  -3293,  -3288,  -3292,  -3289,  -3292,  -3289,  -3291,  -3290,
+     -3291,  -3291,  -3290,  -3291,  -3289,  -3292,  -3288,  -3293,  -3288,  -3294,  -3287,  -3295,  -3286,  -3296,  -3284,  -3297,
+     -3283,  -3298,  -3282,  -3300,  -3280,  -3302,  -3278,  -3303,  -3276,  -3306,  -3274,  -3308,  -3272,  -3311,  -3269,  -3314,
+     -3266,  -3317,  -3262,  -3321,  -3257,  -3326,  -3252,  -3332,  -3246,  -3338,  -3239,  -3346,  -3230,  -3356,  -3219,  -3368,
+     -3206,  -3384,  -3188,  -3403,  -3165,  -3430,  -3134,  -3467,  -3089,  -3522,  -3021,  -3610,  -2905,  -3769,  -2672,  -4139,
+     -1998,  -5751,  13932,  29333,  25089,  27714,  25761,  27348,  25989,  27195,  26096,  27117,  26153,  27076,  26181,  27059,
+     27489,  25740,  27563,  25570,  27888,  24921,  29518,  12637,  -5732,  -2047,  -4086,  -2725,  -3719,  -2952,  -3565,  -3062,
+     -3483,  -3126,  -3433,  -3166,  -3400,  -3193,  -3377,  -3213,  -3361,  -3227,  -3348,  -3238,  -3338,  -3247,  -3331,  -3253,
+     -3325,  -3259,  -3320,  -3263,  -3316,  -3267,  -3312,  -3270,  -3309,  -3273,  -3307,  -3275,  -3305,  -3277,  -3303,  -3278,
+     -3302,  -3280,  -3301,  -3281,  -3300,  -3282,  -3299,  -3282,  -3298,  -3283,  -3298,  -3283,  -3298,  -3283,  -3298,  -3284,
+     -3297,  -3284,  -3298,  -3283,  -3298,  -3283,  -3298,  -3283,  -3298,  -3282,  -3299,  -3282,  -3300,  -3281,  -3301,  -3280,
+     -3302,  -3278,  -3303,  -3277,  -3305,  -3275,  -3307,  -3273,  -3309,  -3270,  -3312,  -3267,  -3316,  -3263,  -3320,  -3259,
+     -3325,  -3253,  -3331,  -3247,  -3338,  -3238,  -3348,  -3227,  -3361,  -3213,  -3377,  -3193,  -3400,  -3166,  -3433,  -3126,
+     -3483,  -3062,  -3565,  -2952,  -3719,  -2725,  -4086,  -2047,  -5732,  12637,  29518,  24921,  27888,  25570,  27563,  25740,
+     26965,  26253,  27151,  24799,   -706,  -4067,  -2781,  -3711,  -2911,  -3647,  -2948,  -3624,  -2963,  -3613,  -2971,  -3607,
+     -2976,  -3603,  -2979,  -3600,  -2982,  -3599,  -2983,  -3597,  -2984,  -3597,  -2985,  -3596,  -2985,  -3596,  -2985,  -3596,
+     -2985,  -3596,  -2985,  -3596,  -2985,  -3596,  -2985,  -3597,  -2984,  -3597,  -2983,  -3599,  -2982,  -3600,  -2979,  -3603,
+     -2976,  -3607,  -2971,  -3613,  -2963,  -3624,  -2948,  -3647,  -2911,  -3711,  -2781,  -4067,   -706,  24799,  27151,  26253,
+     24231,  27475,  29398,  19829,   3797,  -5293,  -4447,  -1991,  -2957,  -4229,  -3332,  -2569,  -3388,  -3865,  -3115,  -2825,
+     -3515,  -3671,  -3035,  -2981,  -3568,  -3540,  -2998,  -3094,  -3593,  -3439,  -2980,  -3187,  -3606,  -3352,  -2973,  -3270,
+     -3609,  -3270,  -2973,  -3352,  -3606,  -3187,  -2980,  -3439,  -3593,  -3094,  -2998,  -3540,  -3568,  -2981,  -3035,  -3671,
+     -3515,  -2825,  -3115,  -3865,  -3388,  -2569,  -3332,  -4229,  -2957,  -1991,  -4447,  -5293,   3797,  19829,  29398,  27475,
+     31879,  29562,  23289,  14834,   6398,   -170,  -3945,  -5075,  -4490,  -3368,  -2605,  -2541,  -2994,  -3528,  -3779,  -3647,
+     -3298,  -3003,  -2951,  -3140,  -3409,  -3565,  -3515,  -3312,  -3110,  -3049,  -3162,  -3360,  -3500,  -3486,  -3332,  -3151,
+     -3072,  -3151,  -3332,  -3486,  -3500,  -3360,  -3162,  -3049,  -3110,  -3312,  -3515,  -3565,  -3409,  -3140,  -2951,  -3003,
+     -3298,  -3647,  -3779,  -3528,  -2994,  -2541,  -2605,  -3368,  -4490,  -5075,  -3945,   -170,   6398,  14834,  23289,  29562,
+     22661,  21922,  19784,  16475,  12342,   7807,   3314,   -726,  -3979,  -6231,  -7405,  -7558,  -6871,  -5608,  -4078,  -2586,
+     -1393,   -678,   -523,   -906,  -1712,  -2765,  -3854,  -4778,  -5374,  -5547,  -5282,  -4642,  -3759,  -2803,  -1956,  -1375,
+     -1169,  -1375,  -1956,  -2803,  -3759,  -4642,  -5282,  -5547,  -5374,  -4778,  -3854,  -2765,  -1712,   -906,   -523,   -678,
+     -1393,  -2586,  -4078,  -5608,  -6871,  -7558,  -7405,  -6231,  -3979,   -726,   3314,   7807,  12342,  16475,  19784,  21922,
+     12520,  12372,  11934,  11220,  10251,   9061,   7686,   6171,   4561,   2908,   1261,   -331,  -1823,  -3174,  -4349,  -5320,
+     -6069,  -6585,  -6866,  -6919,  -6760,  -6413,  -5907,  -5276,  -4561,  -3802,  -3041,  -2317,  -1668,  -1126,   -719,   -467,
+      -381,   -467,   -719,  -1126,  -1668,  -2317,  -3041,  -3802,  -4561,  -5276,  -5907,  -6413,  -6760,  -6919,  -6866,  -6585,
+     -6069,  -5320,  -4349,  -3174,  -1823,   -331,   1261,   2908,   4561,   6171,   7686,   9061,  10251,  11220,  11934,  12372,
+      6451,   6420,   6327,   6173,   5960,   5689,   5364,   4987,   4561,   4092,   3584,   3041,   2469,   1873,   1258,    632,
+         0,   -632,  -1258,  -1873,  -2469,  -3041,  -3584,  -4092,  -4561,  -4987,  -5364,  -5689,  -5960,  -6173,  -6327,  -6420,
+     -6451,  -6420,  -6327,  -6173,  -5960,  -5689,  -5364,  -4987,  -4561,  -4092,  -3584,  -3041,  -2469,  -1873,  -1258,   -632,
+         0,    632,   1258,   1873,   2469,   3041,   3584,   4092,   4561,   4987,   5364,   5689,   5960,   6173,   6327,   6420,
+    
+    // Frame 14
+     27028,  28017,  27010,  28056,  26944,  28159,  26782,  28429,  26276,  29652,  19361,  -3935,  -1535,  -2949,  -1999,  -2688,
+     -2165,  -2574,  -2248,  -2511,  -2297,  -2472,  -2328,  -2446,  -2350,  -2428,  -2366,  -2414,  -2378,  -2404,  -2387,  -2395,
+     -2394,  -2389,  -2400,  -2383,  -2405,  -2379,  -2409,  -2375,  -2412,  -2372,  -2415,  -2370,  -2418,  -2367,  -2420,  -2365,
+     -2422,  -2364,  -2423,  -2362,  -2425,  -2361,  -2426,  -2360,  -2427,  -2359,  -2428,  -2358,  -2429,  -2357,  -2430,  -2356,
+     -2431,  -2355,  -2431,  -2355,  -2432,  -2354,  -2432,  -2354,  -2433,  -2353,  -2433,  -2353,  -2434,  -2352,  -2434,  -2352,
+     -2434,  -2352,  -2435,  -2351,  -2435,  -2351,  -2435,  -2351,  -2435,  -2351,  -2436,  -2350,  -2436,  -2350,  -2436,  -2350,
+     -2436,  -2350,  -2436,  -2350,  -2436,  -2350,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,
+     -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,
+     -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,
+     -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2349,  -2437,  -2350,  -2436,  -2350,  -2436,  -2350,
+     -2436,  -2350,  -2436,  -2350,  -2436,  -2350,  -2436,  -2351,  -2435,  -2351,  -2435,  -2351,  -2435,  -2351,  -2435,  -2352,
+     -2434,  -2352,  -2434,  -2352,  -2434,  -2353,  -2433,  -2353,  -2433,  -2354,  -2432,  -2354,  -2432,  -2355,  -2431,  -2355,
+     -2431,  -2356,  -2430,  -2357,  -2429,  -2358,  -2428,  -2359,  -2427,  -2360,  -2426,  -2361,  -2425,  -2362,  -2423,  -2364,
+     -2422,  -2365,  -2420,  -2367,  -2418,  -2370,  -2415,  -2372,  -2412,  -2375,  -2409,  -2379,  -2405,  -2383,  -2400,  -2389,
+     -2394,  -2395,  -2387,  -2404,  -2378,  -2414,  -2366,  -2428,  -2350,  -2446,  -2328,  -2472,  -2297,  -2511,  -2248,  -2574,
+     -2165,  -2688,  -1999,  -2949,  -1535,  -3935,  19361,  29652,  26276,  28429,  26782,  28159,  26944,  28056,  27010,  28017,
+     28689,  26307,  28892,  25769,  30362,  15795,  -4534,  -1334,  -3044,  -1949,  -2714,  -2152,  -2579,  -2248,  -2508,  -2302,
+     -2466,  -2336,  -2438,  -2358,  -2419,  -2374,  -2406,  -2386,  -2395,  -2395,  -2388,  -2402,  -2382,  -2407,  -2377,  -2411,
+     -2373,  -2415,  -2370,  -2418,  -2367,  -2420,  -2365,  -2422,  -2363,  -2424,  -2362,  -2425,  -2360,  -2426,  -2359,  -2427,
+     -2358,  -2428,  -2358,  -2429,  -2357,  -2429,  -2356,  -2430,  -2356,  -2430,  -2356,  -2431,  -2356,  -2431,  -2355,  -2431,
+     -2355,  -2431,  -2355,  -2431,  -2356,  -2431,  -2356,  -2430,  -2356,  -2430,  -2356,  -2429,  -2357,  -2429,  -2358,  -2428,
+     -2358,  -2427,  -2359,  -2426,  -2360,  -2425,  -2362,  -2424,  -2363,  -2422,  -2365,  -2420,  -2367,  -2418,  -2370,  -2415,
+     -2373,  -2411,  -2377,  -2407,  -2382,  -2402,  -2388,  -2395,  -2395,  -2386,  -2406,  -2374,  -2419,  -2358,  -2438,  -2336,
+     -2466,  -2302,  -2508,  -2248,  -2579,  -2152,  -2714,  -1949,  -3044,  -1334,  -4534,  15795,  30362,  25769,  28892,  26307,
+     27388,  27718,  26472,    946,  -3369,  -1783,  -2875,  -1972,  -2779,  -2028,  -2743,  -2053,  -2726,  -2066,  -2716,  -2074,
+     -2709,  -2079,  -2705,  -2082,  -2702,  -2085,  -2700,  -2086,  -2699,  -2088,  -2698,  -2088,  -2698,  -2089,  -2697,  -2089,
+     -2697,  -2089,  -2697,  -2089,  -2698,  -2088,  -2698,  -2088,  -2699,  -2086,  -2700,  -2085,  -2702,  -2082,  -2705,  -2079,
+     -2709,  -2074,  -2716,  -2066,  -2726,  -2053,  -2743,  -2028,  -2779,  -1972,  -2875,  -1783,  -3369,    946,  26472,  27718,
+     30543,  28310,  20107,   6878,  -3539,  -4992,  -1562,   -859,  -3073,  -3477,  -1787,  -1567,  -2959,  -3048,  -1852,  -1864,
+     -2918,  -2824,  -1879,  -2042,  -2900,  -2676,  -1892,  -2171,  -2891,  -2561,  -1898,  -2276,  -2886,  -2463,  -1901,  -2370,
+     -2885,  -2370,  -1901,  -2463,  -2886,  -2276,  -1898,  -2561,  -2891,  -2171,  -1892,  -2676,  -2900,  -2042,  -1879,  -2824,
+     -2918,  -1864,  -1852,  -3048,  -2959,  -1567,  -1787,  -3477,  -3073,   -859,  -1562,  -4992,  -3539,   6878,  20107,  28310,
+     29304,  26501,  19084,   9595,   1033,  -4374,  -5961,  -4648,  -2261,   -546,   -373,  -1521,  -3036,  -3917,  -3707,  -2681,
+     -1581,  -1111,  -1508,  -2445,  -3279,  -3485,  -2969,  -2106,  -1470,  -1464,  -2066,  -2865,  -3333,  -3173,  -2499,  -1762,
+     -1448,  -1762,  -2499,  -3173,  -3333,  -2865,  -2066,  -1464,  -1470,  -2106,  -2969,  -3485,  -3279,  -2445,  -1508,  -1111,
+     -1581,  -2681,  -3707,  -3917,  -3036,  -1521,   -373,   -546,  -2261,  -4648,  -5961,  -4374,   1033,   9595,  19084,  26501,
+     17688,  17084,  15338,  12641,   9282,   5613,   2003,  -1206,  -3744,  -5437,  -6229,  -6179,  -5446,  -4260,  -2886,  -1582,
+      -567,     12,     95,   -292,  -1041,  -1995,  -2967,  -3781,  -4296,  -4431,  -4177,  -3592,  -2795,  -1936,  -1178,   -659,
+      -474,   -659,  -1178,  -1936,  -2795,  -3592,  -4177,  -4431,  -4296,  -3781,  -2967,  -1995,  -1041,   -292,     95,     12,
+      -567,  -1582,  -2886,  -4260,  -5446,  -6179,  -6229,  -5437,  -3744,  -1206,   2003,   5613,   9282,  12641,  15338,  17084,
+      9323,   9212,   8883,   8346,   7619,   6725,   5693,   4556,   3349,   2110,    876,   -316,  -1431,  -2439,  -3314,  -4035,
+     -4587,  -4963,  -5162,  -5189,  -5056,  -4781,  -4387,  -3899,  -3349,  -2766,  -2182,  -1628,  -1132,   -718,   -407,   -214,
+      -149,   -214,   -407,   -718,  -1132,  -1628,  -2182,  -2766,  -3349,  -3899,  -4387,  -4781,  -5056,  -5189,  -5162,  -4963,
+     -4587,  -4035,  -3314,  -2439,  -1431,   -316,    876,   2110,   3349,   4556,   5693,   6725,   7619,   8346,   8883,   9212,
+      4736,   4713,   4645,   4532,   4375,   4177,   3938,   3661,   3349,   3004,   2631,   2233,   1812,   1375,    924,    464,
+         0,   -464,   -924,  -1375,  -1812,  -2233,  -2631,  -3004,  -3349,  -3661,  -3938,  -4177,  -4375,  -4532,  -4645,  -4713,
+     -4736,  -4713,  -4645,  -4532,  -4375,  -4177,  -3938,  -3661,  -3349,  -3004,  -2631,  -2233,  -1812,  -1375,   -924,   -464,
+         0,    464,    924,   1375,   1812,   2233,   2631,   3004,   3349,   3661,   3938,   4177,   4375,   4532,   4645,   4713,
+    
+    // Frame 15
+     28012,  28834,  27967,  28945,  27725,  29581,  24274,  -1155,  -1388,  -1586,  -1438,  -1528,  -1482,  -1495,  -1507,  -1476,
+     -1522,  -1464,  -1532,  -1456,  -1539,  -1450,  -1544,  -1446,  -1547,  -1442,  -1550,  -1440,  -1553,  -1438,  -1554,  -1436,
+     -1556,  -1435,  -1557,  -1434,  -1558,  -1433,  -1559,  -1432,  -1559,  -1432,  -1560,  -1431,  -1561,  -1431,  -1561,  -1430,
+     -1561,  -1430,  -1562,  -1429,  -1562,  -1429,  -1562,  -1429,  -1563,  -1429,  -1563,  -1428,  -1563,  -1428,  -1563,  -1428,
+     -1563,  -1428,  -1563,  -1428,  -1564,  -1428,  -1564,  -1428,  -1564,  -1427,  -1564,  -1427,  -1564,  -1427,  -1564,  -1427,
+     -1564,  -1427,  -1564,  -1427,  -1564,  -1427,  -1564,  -1427,  -1564,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,
+     -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,
+     -1565,  -1427,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,
+     -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1426,  -1565,  -1427,
+     -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,
+     -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1565,  -1427,  -1564,  -1427,  -1564,  -1427,  -1564,  -1427,  -1564,  -1427,
+     -1564,  -1427,  -1564,  -1427,  -1564,  -1427,  -1564,  -1427,  -1564,  -1428,  -1564,  -1428,  -1564,  -1428,  -1563,  -1428,
+     -1563,  -1428,  -1563,  -1428,  -1563,  -1428,  -1563,  -1429,  -1563,  -1429,  -1562,  -1429,  -1562,  -1429,  -1562,  -1430,
+     -1561,  -1430,  -1561,  -1431,  -1561,  -1431,  -1560,  -1432,  -1559,  -1432,  -1559,  -1433,  -1558,  -1434,  -1557,  -1435,
+     -1556,  -1436,  -1554,  -1438,  -1553,  -1440,  -1550,  -1442,  -1547,  -1446,  -1544,  -1450,  -1539,  -1456,  -1532,  -1464,
+     -1522,  -1476,  -1507,  -1495,  -1482,  -1528,  -1438,  -1586,  -1388,  -1155,  24274,  29581,  27725,  28945,  27967,  28834,
+     30113,  26543,  31156,  18822,  -3069,   -743,  -1927,  -1226,  -1671,  -1381,  -1569,  -1451,  -1518,  -1490,  -1489,  -1513,
+     -1470,  -1528,  -1457,  -1539,  -1448,  -1546,  -1442,  -1552,  -1437,  -1556,  -1433,  -1560,  -1430,  -1562,  -1428,  -1565,
+     -1426,  -1566,  -1424,  -1568,  -1423,  -1569,  -1422,  -1570,  -1421,  -1571,  -1420,  -1572,  -1420,  -1572,  -1419,  -1573,
+     -1419,  -1573,  -1418,  -1573,  -1418,  -1574,  -1418,  -1574,  -1417,  -1574,  -1417,  -1574,  -1417,  -1574,  -1417,  -1574,
+     -1417,  -1574,  -1417,  -1574,  -1417,  -1574,  -1417,  -1574,  -1417,  -1574,  -1418,  -1574,  -1418,  -1573,  -1418,  -1573,
+     -1419,  -1573,  -1419,  -1572,  -1420,  -1572,  -1420,  -1571,  -1421,  -1570,  -1422,  -1569,  -1423,  -1568,  -1424,  -1566,
+     -1426,  -1565,  -1428,  -1562,  -1430,  -1560,  -1433,  -1556,  -1437,  -1552,  -1442,  -1546,  -1448,  -1539,  -1457,  -1528,
+     -1470,  -1513,  -1489,  -1490,  -1518,  -1451,  -1569,  -1381,  -1671,  -1226,  -1927,   -743,  -3069,  18822,  31156,  26543,
+     28211,  28160,   2595,  -2627,   -821,  -2009,  -1059,  -1889,  -1128,  -1845,  -1158,  -1824,  -1174,  -1812,  -1183,  -1805,
+     -1189,  -1800,  -1193,  -1797,  -1196,  -1795,  -1198,  -1793,  -1199,  -1792,  -1200,  -1791,  -1201,  -1791,  -1201,  -1790,
+     -1201,  -1790,  -1201,  -1791,  -1201,  -1791,  -1200,  -1792,  -1199,  -1793,  -1198,  -1795,  -1196,  -1797,  -1193,  -1800,
+     -1189,  -1805,  -1183,  -1812,  -1174,  -1824,  -1158,  -1845,  -1128,  -1889,  -1059,  -2009,   -821,  -2627,   2595,  28160,
+     32767,  23628,   6131,  -3472,  -2539,   -166,  -1246,  -2450,  -1485,   -767,  -1623,  -2074,  -1305,  -1027,  -1724,  -1879,
+     -1244,  -1180,  -1764,  -1754,  -1217,  -1287,  -1783,  -1661,  -1203,  -1371,  -1792,  -1583,  -1197,  -1444,  -1796,  -1513,
+     -1195,  -1513,  -1796,  -1444,  -1197,  -1583,  -1792,  -1371,  -1203,  -1661,  -1783,  -1287,  -1217,  -1754,  -1764,  -1180,
+     -1244,  -1879,  -1724,  -1027,  -1305,  -2074,  -1623,   -767,  -1485,  -2450,  -1246,   -166,  -2539,  -3472,   6131,  23628,
+     21551,  19178,  12967,   5216,  -1414,  -5047,  -5298,  -3232,   -656,    847,    637,   -840,  -2491,  -3296,  -2880,  -1647,
+      -448,    -22,   -564,  -1655,  -2567,  -2737,  -2102,  -1111,   -413,   -442,  -1152,  -2064,  -2584,  -2385,  -1607,   -764,
+      -406,   -764,  -1607,  -2385,  -2584,  -2064,  -1152,   -442,   -413,  -1111,  -2102,  -2737,  -2567,  -1655,   -564,    -22,
+      -448,  -1647,  -2880,  -3296,  -2491,   -840,    637,    847,   -656,  -3232,  -5298,  -5047,  -1414,   5216,  12967,  19178,
+     11602,  11194,  10015,   8196,   5936,   3474,   1062,  -1067,  -2730,  -3811,  -4276,  -4169,  -3603,  -2739,  -1760,   -845,
+      -144,    244,    280,    -13,   -558,  -1242,  -1933,  -2508,  -2867,  -2956,  -2768,  -2346,  -1775,  -1162,   -621,   -251,
+      -120,   -251,   -621,  -1162,  -1775,  -2346,  -2768,  -2956,  -2867,  -2508,  -1933,  -1242,   -558,    -13,    280,    244,
+      -144,   -845,  -1760,  -2739,  -3603,  -4169,  -4276,  -3811,  -2730,  -1067,   1062,   3474,   5936,   8196,  10015,  11194,
+      5921,   5851,   5640,   5297,   4833,   4262,   3603,   2877,   2107,   1316,    529,   -230,   -941,  -1582,  -2137,  -2594,
+     -2942,  -3178,  -3300,  -3311,  -3221,  -3039,  -2781,  -2464,  -2107,  -1729,  -1351,   -993,   -672,   -404,   -203,    -79,
+       -37,    -79,   -203,   -404,   -672,   -993,  -1351,  -1729,  -2107,  -2464,  -2781,  -3039,  -3221,  -3311,  -3300,  -3178,
+     -2942,  -2594,  -2137,  -1582,   -941,   -230,    529,   1316,   2107,   2877,   3603,   4262,   4833,   5297,   5640,   5851,
+      2979,   2965,   2922,   2851,   2752,   2627,   2477,   2303,   2107,   1890,   1655,   1404,   1140,    865,    581,    292,
+         0,   -292,   -581,   -865,  -1140,  -1404,  -1655,  -1890,  -2107,  -2303,  -2477,  -2627,  -2752,  -2851,  -2922,  -2965,
+     -2979,  -2965,  -2922,  -2851,  -2752,  -2627,  -2477,  -2303,  -2107,  -1890,  -1655,  -1404,  -1140,   -865,   -581,   -292,
+         0,    292,    581,    865,   1140,   1404,   1655,   1890,   2107,   2303,   2477,   2627,   2752,   2851,   2922,   2965,
+    
+};
+
+alignas(4) const int16_t wavetableSet_Sync[32 * FrameMip::FRAME_SIZE] = {
+    // Frame 0
+     -1742, -32767, -24834, -29184, -25711, -28022, -25734, -27267, -25530, -26651, -25233, -26100, -24890, -25583, -24521, -25087,
+    -24134, -24605, -23737, -24132, -23331, -23666, -22920, -23205, -22505, -22747, -22086, -22293, -21665, -21840, -21242, -21390,
+    -20817, -20941, -20390, -20493, -19963, -20047, -19534, -19601, -19105, -19156, -18675, -18712, -18245, -18268, -17813, -17825,
+    -17382, -17382, -16950, -16939, -16518, -16497, -16085, -16055, -15652, -15614, -15219, -15173, -14785, -14732, -14352, -14291,
+    -13918, -13850, -13484, -13409, -13050, -12969, -12615, -12529, -12181, -12088, -11746, -11648, -11312, -11208, -10877, -10769,
+    -10442, -10329, -10007,  -9889,  -9572,  -9449,  -9137,  -9010,  -8702,  -8570,  -8267,  -8131,  -7832,  -7692,  -7397,  -7252,
+     -6961,  -6813,  -6526,  -6374,  -6091,  -5934,  -5655,  -5495,  -5220,  -5056,  -4784,  -4617,  -4349,  -4178,  -3913,  -3739,
+     -3478,  -3300,  -3042,  -2861,  -2607,  -2421,  -2171,  -1982,  -1736,  -1543,  -1300,  -1104,   -864,   -665,   -429,   -226,
+         7,    213,    442,    652,    878,   1091,   1314,   1530,   1749,   1969,   2185,   2408,   2620,   2847,   3056,   3286,
+      3492,   3725,   3927,   4164,   4363,   4603,   4798,   5042,   5234,   5482,   5669,   5921,   6104,   6360,   6540,   6799,
+      6975,   7239,   7410,   7678,   7846,   8117,   8281,   8557,   8716,   8996,   9151,   9436,   9586,   9875,  10021,  10315,
+     10456,  10755,  10891,  11195,  11326,  11635,  11760,  12075,  12195,  12515,  12629,  12955,  13063,  13396,  13497,  13836,
+     13931,  14277,  14365,  14718,  14799,  15159,  15232,  15600,  15666,  16042,  16099,  16484,  16531,  16926,  16964,  17368,
+     17396,  17811,  17827,  18254,  18258,  18698,  18689,  19142,  19119,  19587,  19548,  20033,  19977,  20480,  20404,  20927,
+     20830,  21376,  21255,  21827,  21679,  22279,  22100,  22734,  22518,  23191,  22934,  23653,  23345,  24119,  23750,  24592,
+     24148,  25074,  24534,  25569,  24904,  26086,  25247,  26637,  25543,  27253,  25748,  28008,  25725,  29171,  24847,  32753,
+      -868, -32561, -24391, -28530, -24837, -26927, -24425, -25732, -23786, -24677, -23054, -23686, -22276, -22730, -21471, -21795,
+    -20649, -20874, -19816, -19962, -18975, -19057, -18128, -18156, -17278, -17259, -16424, -16366, -15567, -15474, -14708, -14584,
+    -13848, -13696, -12987, -12809, -12124, -11923, -11260, -11038, -10396, -10153,  -9531,  -9269,  -8665,  -8386,  -7799,  -7503,
+     -6933,  -6620,  -6066,  -5738,  -5199,  -4856,  -4331,  -3974,  -3464,  -3092,  -2596,  -2211,  -1729,  -1329,   -861,   -448,
+         7,    434,    875,   1315,   1742,   2197,   2610,   3078,   3478,   3960,   4345,   4842,   5212,   5724,   6079,   6607,
+      6946,   7489,   7813,   8372,   8679,   9256,   9544,  10139,  10409,  11024,  11274,  11909,  12137,  12795,  13000,  13682,
+     13862,  14571,  14722,  15460,  15581,  16352,  16437,  17246,  17291,  18143,  18142,  19043,  18989,  19948,  19829,  20860,
+     20662,  21782,  21484,  22717,  22289,  23673,  23068,  24663,  23799,  25718,  24438,  26914,  24850,  28517,  24405,  32547,
+      -430, -32124, -23522, -27209, -23100, -24724, -21821, -22647, -20314, -20710, -18715, -18838, -17070, -17000, -15398, -15182,
+    -13709, -13378, -12010, -11583, -10303,  -9794,  -8591,  -8010,  -6875,  -6229,  -5157,  -4450,  -3436,  -2672,  -1715,   -895,
+         7,    881,   1729,   2658,   3450,   4436,   5170,   6215,   6889,   7996,   8604,   9781,  10316,  11570,  12023,  13365,
+     13723,  15169,  15411,  16986,  17083,  18824,  18729,  20697,  20328,  22633,  21835,  24711,  23114,  27196,  23536,  32110,
+      -225, -24239, -31223, -25437, -21813, -23926, -24531, -21437, -19670, -20595, -20268, -17864, -16671, -17135, -16412, -14343,
+    -13446, -13651, -12693, -10835, -10131, -10158,  -9036,  -7333,  -6774,  -6662,  -5409,  -3833,  -3395,  -3164,  -1797,   -335,
+        -7,    336,   1811,   3162,   3381,   3837,   5423,   6657,   6760,   7339,   9050,  10150,  10118,  10845,  12707,  13638,
+     13433,  14358,  16425,  17117,  16658,  17886,  20282,  20566,  19657,  21475,  24544,  23872,  21800,  25529,  31236,  23961,
+      -116, -13536, -23834, -29134, -29419, -26335, -22297, -19363, -18425, -19067, -20077, -20262, -19115, -16992, -14788, -13331,
+    -12903, -13124, -13250, -12659, -11225,  -9359,  -7717,  -6777,  -6547,  -6582,  -6288,  -5301,  -3711,  -1997,   -705,   -102,
+        -7,     93,    706,   2008,   3725,   5308,   6284,   6569,   6533,   6772,   7725,   9374,  11238,  12661,  13239,  13106,
+     12890,  13332,  14805,  17015,  19128,  20256,  20052,  19037,  18412,  19381,  22342,  26383,  29433,  29079,  23696,  13329,
+       -61,  -6973, -13389, -18873, -23094, -25855, -27116, -26985, -25701, -23594, -21041, -18411, -16023, -14111, -12796, -12085,
+    -11885, -12024, -12286, -12456, -12348, -11841, -10890,  -9535,  -7883,  -6092,  -4337,  -2783,  -1550,   -700,   -221,    -34,
+        -7,     22,    212,    697,   1553,   2791,   4350,   6106,   7897,   9545,  10895,  11838,  12339,  12441,  12269,  12006,
+     11872,  12078,  12798,  14123,  16044,  18437,  21068,  23618,  25714,  26983,  27093,  25810,  23025,  18783,  13281,   6854,
+       -34,  -3518,  -6918, -10153, -13147, -15833, -18153, -20061, -21524, -22524, -23055, -23127, -22763, -21999, -20882, -19465,
+    -17811, -15986, -14058, -12093, -10154,  -8299,  -6578,  -5031,  -3687,  -2565,  -1669,   -994,   -523,   -228,    -73,    -15,
+        -7,      2,     61,    218,    515,    989,   1668,   2567,   3693,   5040,   6590,   8314,  10170,  12110,  14075,  16002,
+     17825,  19475,  20888,  22001,  22759,  23116,  23036,  22498,  21491,  20021,  18106,  15780,  13089,  10090,   6852,   3451,
+       -20,  -1767,  -3496,  -5192,  -6838,  -8418,  -9917, -11321, -12616, -13789, -14829, -15727, -16474, -17061, -17485, -17740,
+    -17825, -17737, -17480, -17053, -16463, -15714, -14814, -13771, -12596, -11300,  -9894,  -8394,  -6813,  -5166,  -3469,  -1740,
+         7,   1753,   3483,   5178,   6824,   8404,   9904,  11307,  12602,  13775,  14816,  15713,  16460,  17048,  17471,  17726,
+     17811,  17724,  17466,  17040,  16449,  15701,  14800,  13758,  12583,  11286,   9881,   8380,   6799,   5152,   3456,   1726,
+    
+    // Frame 1
+    -25449, -28234, -27241, -27455, -26884, -26910, -26444, -26403, -25984, -25910, -25514, -25422, -25041, -24938, -24565, -24455,
+    -24088, -23973, -23610, -23492, -23132, -23012, -22653, -22531, -22173, -22051, -21694, -21572, -21215, -21092, -20735, -20612,
+    -20255, -20133, -19775, -19653, -19296, -19174, -18816, -18695, -18336, -18215, -17856, -17736, -17376, -17257, -16896, -16777,
+    -16416, -16298, -15936, -15819, -15456, -15339, -14976, -14860, -14496, -14381, -14016, -13901, -13536, -13422, -13057, -12943,
+    -12577, -12463, -12097, -11984, -11617, -11505, -11137, -11025, -10657, -10546, -10177, -10067,  -9697,  -9587,  -9217,  -9108,
+     -8737,  -8629,  -8257,  -8149,  -7777,  -7670,  -7297,  -7191,  -6817,  -6711,  -6337,  -6232,  -5857,  -5753,  -5377,  -5273,
+     -4898,  -4794,  -4418,  -4315,  -3938,  -3835,  -3458,  -3356,  -2978,  -2877,  -2498,  -2397,  -2018,  -1918,  -1538,  -1439,
+     -1058,   -960,   -578,   -480,    -98,     -1,    382,    478,    862,    958,   1342,   1437,   1822,   1916,   2302,   2395,
+      2782,   2875,   3262,   3354,   3742,   3833,   4222,   4312,   4702,   4792,   5182,   5271,   5662,   5750,   6142,   6229,
+      6622,   6708,   7102,   7188,   7583,   7667,   8063,   8146,   8543,   8625,   9023,   9104,   9503,   9583,   9983,  10062,
+     10464,  10541,  10944,  11020,  11424,  11499,  11905,  11978,  12385,  12457,  12865,  12936,  13346,  13414,  13826,  13893,
+     14307,  14372,  14788,  14850,  15268,  15329,  15749,  15807,  16230,  16286,  16711,  16764,  17192,  17242,  17673,  17720,
+     18155,  18198,  18636,  18675,  19118,  19152,  19600,  19630,  20083,  20106,  20565,  20583,  21049,  21058,  21532,  21534,
+     22017,  22008,  22502,  22482,  22988,  22954,  23476,  23424,  23966,  23892,  24459,  24357,  24956,  24816,  25460,  25266,
+     25976,  25701,  26513,  26104,  27099,  26426,  27835,  26425,  29498,  20648, -27272, -27251, -27708, -26843, -27126, -26445,
+    -26584, -26014, -26067, -25562, -25566, -25099, -25075, -24626, -24594, -24142, -24125, -23642, -23680, -23101, -23320, -22324,
+    -25778, -27605, -27130, -26383, -26262, -25385, -25320, -24420, -24361, -23464, -23397, -22510, -22431, -21557, -21465, -20605,
+    -20500, -19652, -19534, -18698, -18569, -17745, -17604, -16791, -16640, -15837, -15676, -14882, -14712, -13927, -13748, -12972,
+    -12785, -12017, -11822, -11062, -10858, -10106,  -9895,  -9151,  -8933,  -8195,  -7970,  -7239,  -7007,  -6283,  -6044,  -5327,
+     -5082,  -4372,  -4119,  -3416,  -3156,  -2460,  -2194,  -1504,  -1231,   -548,   -269,    408,    694,   1364,   1657,   2319,
+      2620,   3275,   3583,   4230,   4546,   5186,   5510,   6141,   6473,   7095,   7437,   8050,   8401,   9004,   9365,   9958,
+     10330,  10912,  11295,  11865,  12261,  12817,  13228,  13769,  14195,  14720,  15163,  15669,  16133,  16618,  17104,  17564,
+     18077,  18508,  19053,  19449,  20033,  20385,  21018,  21316,  22010,  22236,  23015,  23142,  24038,  24022,  25097,  24852,
+     26232,  25561,  27574,  25875,  29636, -15537, -30616, -25043, -27720, -24888, -26331, -24184, -25219, -23298, -24278, -22121,
+    -25184, -27596, -25767, -25294, -24040, -23252, -22211, -21263, -20349, -19297, -18472, -17343, -16585, -15396, -14693, -13453,
+    -12796, -11514, -10897,  -9577,  -8997,  -7641,  -7095,  -5706,  -5192,  -3772,  -3289,  -1839,  -1385,     95,    518,   2029,
+      2421,   3964,   4323,   5900,   6223,   7837,   8122,   9776,  10018,  11719,  11910,  13666,  13797,  15620,  15676,  17584,
+     17541,  19566,  19383,  21580,  21178,  23665,  22859,  25956,  24104,  29470,  17718, -27923, -25841, -25741, -24436, -23258,
+    -27106, -27262, -25139, -24867, -25058, -23309, -21412, -21256, -21050, -19293, -17733, -17561, -17075, -15341, -14017, -13820,
+    -13130, -11420, -10278, -10057,  -9202,  -7516,  -6527,  -6283,  -5282,  -3619,  -2772,  -2504,  -1363,    276,    982,   1275,
+      2560,   4172,   4728,   5050,   6496,   8075,   8456,   8815,  10457,  11993,  12149,  12559,  14468,  15941,  15768,  16260,
+     18593,  19952,  19199,  19860,  23056,  24135,  21915,  23153,  29548,  28670,   9802, -16961, -30998, -27727, -21473, -22827,
+    -25945, -23740, -23066, -23767, -24829, -25115, -24057, -21915, -19537, -17806, -17118, -17201, -17338, -16844, -15477, -13553,
+    -11717, -10517, -10076, -10027,  -9774,  -8871,  -7299,  -5471,  -3953,  -3103,  -2845,  -2718,  -2178,   -949,    799,   2555,
+      3793,   4315,   4389,   4589,   5425,   7012,   8969,  10647,  11540,  11634,  11450,  11744,  13023,  15181,  17498,  19047,
+     19287,  18493,  17714,  18220,  20703,  24654,  28323,  29347,  25805,  17195,   4825,  -8598, -20024, -27258, -29750, -28617,
+    -29063, -30079, -29796, -28474, -26446, -24070, -21686, -19570, -17909, -16783, -16169, -15955, -15967, -16009, -15891, -15468,
+    -14657, -13452, -11916, -10171,  -8373,  -6680,  -5230,  -4109,  -3342,  -2890,  -2653,  -2493,  -2259,  -1810,  -1046,     77,
+      1534,   3239,   5056,   6822,   8378,   9595,  10405,  10810,  10891,  10796,  10721,  10873,  11441,  12554,  14253,  16472,
+     19038,  21678,  24051,  25786,  26532,  26001,  24013,  20527,  15648,   9630,   2846,  -4248, -11166, -17440, -22678, -26599,
+    -19593, -21991, -23946, -25426, -26415, -26910, -26924, -26484, -25629, -24409, -22884, -21120, -19186, -17153, -15089, -13061,
+    -11127,  -9337,  -7731,  -6337,  -5172,  -4240,  -3532,  -3028,  -2697,  -2501,  -2394,  -2326,  -2245,  -2100,  -1842,  -1430,
+      -827,     -7,   1043,   2328,   3836,   5547,   7427,   9430,  11502,  13581,  15599,  17486,  19171,  20586,  21667,  22360,
+     22617,  22405,  21704,  20506,  18821,  16673,  14099,  11152,   7894,   4400,    750,  -2969,  -6669, -10263, -13665, -16798,
+    -11616, -13224, -14727, -16109, -17358, -18461, -19408, -20189, -20798, -21227, -21474, -21535, -21411, -21102, -20611, -19943,
+    -19104, -18103, -16950, -15654, -14229, -12689, -11048,  -9322,  -7528,  -5683,  -3804,  -1911,    -20,   1849,   3679,   5452,
+      7151,   8759,  10262,  11644,  12893,  13996,  14943,  15724,  16333,  16762,  17009,  17071,  16946,  16637,  16146,  15478,
+     14640,  13639,  12485,  11189,   9764,   8224,   6583,   4857,   3063,   1218,   -661,  -2554,  -4445,  -6314,  -8144,  -9917,
+    
+    // Frame 2
+    -22967, -28636, -26999, -27504, -26732, -26842, -26300, -26258, -25823, -25701, -25329, -25156, -24826, -24619, -24317, -24085,
+    -23806, -23554, -23292, -23025, -22776, -22497, -22260, -21970, -21742, -21444, -21224, -20918, -20706, -20393, -20187, -19868,
+    -19667, -19344, -19148, -18820, -18628, -18296, -18108, -17772, -17588, -17248, -17068, -16725, -16547, -16201, -16027, -15678,
+    -15506, -15155, -14985, -14632, -14464, -14108, -13944, -13585, -13423, -13063, -12902, -12540, -12381, -12017, -11860, -11494,
+    -11338, -10971, -10817, -10448, -10296,  -9926,  -9775,  -9403,  -9254,  -8880,  -8733,  -8358,  -8211,  -7835,  -7690,  -7312,
+     -7169,  -6790,  -6647,  -6267,  -6126,  -5745,  -5605,  -5222,  -5083,  -4700,  -4562,  -4177,  -4041,  -3654,  -3519,  -3132,
+     -2998,  -2609,  -2476,  -2087,  -1955,  -1564,  -1434,  -1042,   -912,   -519,   -391,      3,    131,    526,    652,   1048,
+      1174,   1571,   1695,   2093,   2216,   2616,   2738,   3138,   3259,   3661,   3781,   4183,   4302,   4706,   4823,   5228,
+      5345,   5751,   5866,   6273,   6388,   6796,   6909,   7318,   7430,   7841,   7952,   8363,   8473,   8886,   8994,   9408,
+      9516,   9931,  10037,  10454,  10558,  10976,  11079,  11499,  11601,  12022,  12122,  12544,  12643,  13067,  13164,  13590,
+     13685,  14113,  14206,  14636,  14727,  15158,  15248,  15681,  15769,  16204,  16290,  16728,  16811,  17251,  17332,  17774,
+     17852,  18297,  18373,  18821,  18893,  19344,  19413,  19868,  19933,  20392,  20453,  20917,  20973,  21441,  21492,  21966,
+     22010,  22492,  22528,  23018,  23046,  23545,  23562,  24074,  24076,  24604,  24588,  25138,  25096,  25677,  25596,  26228,
+     26079,  26805,  26517,  27469,  26758,  28735,  23068, -25288, -27987, -27193, -27148, -26751, -26603, -26234, -26083, -25707,
+    -25567, -25179, -25052, -24651, -24536, -24123, -24020, -23595, -23504, -23066, -22989, -22538, -22474, -22008, -21960, -21478,
+    -21447, -20946, -20936, -20412, -20428, -19873, -19926, -19328, -19432, -18771, -18956, -18187, -18524, -17524, -18257, -16392,
+    -22827, -28358, -26486, -26721, -25681, -25551, -24713, -24458, -23702, -23391, -22674, -22336, -21639, -21286, -20599, -20239,
+    -19557, -19194, -18514, -18150, -17469, -17108, -16424, -16065, -15378, -15024, -14332, -13982, -13285, -12941, -12239, -11899,
+    -11192, -10858, -10145,  -9817,  -9099,  -8776,  -8052,  -7736,  -7005,  -6695,  -5957,  -5654,  -4910,  -4614,  -3863,  -3573,
+     -2815,  -2533,  -1768,  -1493,   -720,   -453,    328,    587,   1376,   1627,   2424,   2666,   3473,   3705,   4521,   4744,
+      5571,   5783,   6620,   6821,   7670,   7859,   8720,   8896,   9771,   9932,  10823,  10968,  11876,  12002,  12930,  13036,
+     13985,  14068,  15041,  15098,  16100,  16126,  17161,  17151,  18226,  18171,  19296,  19186,  20373,  20193,  21459,  21187,
+     22561,  22162,  23689,  23102,  24865,  23972,  26146,  24672,  27734,  24728,  31123,  12558, -30814, -25190, -27845, -25045,
+    -26294, -24324, -25028, -23440, -23866, -22485, -22756, -21489, -21680, -20461, -20637, -19394, -19649, -18240, -18833, -16610,
+    -22199, -28348, -24958, -25614, -23157, -23358, -21183, -21186, -19160, -19045, -17117, -16919, -15063, -14801, -13003, -12688,
+    -10938, -10579,  -8870,  -8472,  -6801,  -6366,  -4730,  -4262,  -2658,  -2158,   -587,    -54,   1485,   2050,   3557,   4154,
+      5627,   6259,   7697,   8366,   9765,  10476,  11830,  12588,  13891,  14705,  15946,  16829,  17993,  18965,  20024,  21120,
+     22029,  23314,  23977,  25589,  25838,  27274, -19224, -28782, -24274, -25302, -22792, -22847, -20986, -20486, -19251, -17712,
+    -23155, -25478, -26494, -25698, -23539, -22067, -21927, -21306, -19444, -18024, -17755, -17028, -15233, -13934, -13627, -12777,
+    -11005,  -9828,  -9507,  -8535,  -6771,  -5716,  -5392,  -4297,  -2532,  -1603,  -1283,    -57,   1714,   2504,   2817,   4192,
+      5974,   6599,   6898,   8459,  10258,  10670,  10945,  12761,  14591,  14687,  14922,  17145,  19030,  18571,  18723,  21770,
+     23786,  21943,  21866,  27833,  30300,  16113, -10220, -28806, -29559, -22753, -21161, -23722, -23025, -19086, -17490, -19825,
+    -23970, -26263, -26661, -25419, -23475, -21812, -20920, -20629, -20355, -19555, -18084, -16262, -14627, -13570, -13081, -12776,
+    -12160, -10953,  -9273,  -7546,  -6228,  -5499,  -5152,  -4725,  -3805,  -2301,   -509,   1077,   2085,   2519,   2766,   3358,
+      4621,   6445,   8335,   9714,  10310,  10362,  10505,  11378,  13191,  15526,  17540,  18484,  18229,  17477,  17447,  19156,
+     22661,  26700,  29023,  27325,  20372,   8760,  -5108, -17874, -26545, -29676, -27865, -23354, -18950, -16803, -17608, -20553,
+    -23714, -22479, -21490, -20855, -20588, -20620, -20814, -21000, -21003, -20680, -19938, -18757, -17184, -15331, -13352, -11417,
+     -9681,  -8263,  -7221,  -6548,  -6170,  -5962,  -5770,  -5436,  -4829,  -3864,  -2522,   -852,   1036,   2991,   4841,   6430,
+      7641,   8424,   8803,   8878,   8813,   8812,   9083,   9806,  11093,  12968,  15348,  18046,  20784,  23229,  25024,  25842,
+     25425,  23623,  20418,  15928,  10405,   4203,  -2260,  -8548, -14255, -19053, -22719, -25163, -26420, -26644, -26074, -24999,
+    -26799, -27378, -27518, -27241, -26584, -25591, -24314, -22811, -21145, -19376, -17565, -15769, -14039, -12417, -10939,  -9627,
+     -8495,  -7546,  -6771,  -6153,  -5665,  -5272,  -4937,  -4616,  -4265,  -3843,  -3310,  -2631,  -1780,   -739,    502,   1939,
+      3560,   5340,   7245,   9232,  11248,  13236,  15133,  16876,  18401,  19647,  20560,  21090,  21200,  20862,  20061,  18794,
+     17073,  14923,  12383,   9501,   6339,   2966,   -544,  -4110,  -7652, -11090, -14347, -17352, -20043, -22368, -24285, -25767,
+    -18844, -20024, -21047, -21902, -22581, -23078, -23389, -23509, -23438, -23177, -22728, -22095, -21285, -20305, -19165, -17876,
+    -16449, -14900, -13242, -11493,  -9667,  -7784,  -5862,  -3918,  -1972,    -42,   1853,   3695,   5466,   7149,   8728,  10188,
+     11514,  12694,  13716,  14571,  15250,  15748,  16058,  16178,  16107,  15846,  15397,  14764,  13954,  12974,  11834,  10545,
+      9119,   7569,   5912,   4162,   2337,    454,  -1469,  -3413,  -5359,  -7289,  -9184, -11026, -12797, -14480, -16059, -17518,
+    
+    // Frame 3
+    -20412, -29113, -26680, -27634, -26498, -26858, -26068, -26201, -25573, -25584, -25050, -24985, -24514, -24397, -23971, -23815,
+    -23422, -23237, -22870, -22662, -22316, -22088, -21760, -21517, -21203, -20946, -20644, -20376, -20085, -19806, -19526, -19238,
+    -18966, -18669, -18405, -18102, -17844, -17534, -17283, -16967, -16722, -16400, -16160, -15833, -15599, -15266, -15037, -14700,
+    -14475, -14133, -13912, -13567, -13350, -13001, -12788, -12435, -12225, -11869, -11663, -11303, -11100, -10737, -10537, -10171,
+     -9974,  -9605,  -9412,  -9039,  -8849,  -8474,  -8286,  -7908,  -7723,  -7342,  -7160,  -6777,  -6597,  -6211,  -6034,  -5646,
+     -5471,  -5080,  -4908,  -4515,  -4345,  -3949,  -3782,  -3384,  -3219,  -2819,  -2655,  -2253,  -2092,  -1688,  -1529,  -1122,
+      -966,   -557,   -403,      9,    160,    574,    723,   1139,   1286,   1705,   1850,   2270,   2413,   2836,   2976,   3401,
+      3539,   3966,   4102,   4532,   4665,   5097,   5228,   5663,   5791,   6228,   6354,   6794,   6917,   7360,   7480,   7925,
+      8043,   8491,   8606,   9057,   9169,   9622,   9732,  10188,  10294,  10754,  10857,  11320,  11420,  11886,  11982,  12452,
+     12545,  13018,  13107,  13584,  13669,  14150,  14231,  14717,  14794,  15284,  15355,  15850,  15917,  16417,  16479,  16984,
+     17040,  17552,  17601,  18119,  18162,  18687,  18722,  19256,  19282,  19825,  19841,  20394,  20400,  20964,  20958,  21536,
+     21515,  22108,  22070,  22682,  22624,  23258,  23175,  23837,  23722,  24420,  24264,  25011,  24798,  25613,  25315,  26237,
+     25800,  26910,  26204,  27733,  26286,  29484,  20590, -27198, -27228, -27546, -26739, -26875, -26262, -26243, -25751, -25635,
+    -25222, -25041, -24684, -24455, -24139, -23873, -23590, -23295, -23038, -22719, -22485, -22144, -21930, -21571, -21375, -20998,
+    -20819, -20425, -20263, -19853, -19707, -19281, -19150, -18708, -18595, -18135, -18040, -17561, -17485, -16986, -16933, -16410,
+    -16382, -15830, -15834, -15247, -15292, -14658, -14756, -14059, -14234, -13442, -13739, -12784, -13310, -12008, -13128, -10529,
+    -20161, -28838, -26104, -26805, -25347, -25475, -24343, -24263, -23274, -23091, -22178, -21937, -21070, -20793, -19954, -19654,
+    -18833, -18519, -17710, -17386, -16585, -16255, -15459, -15125, -14331, -13996, -13203, -12867, -12074, -11739, -10944, -10612,
+     -9814,  -9485,  -8684,  -8358,  -7553,  -7232,  -6422,  -6106,  -5291,  -4980,  -4160,  -3854,  -3028,  -2729,  -1896,  -1604,
+      -764,   -479,    368,    645,   1501,   1769,   2634,   2893,   3768,   4017,   4902,   5139,   6036,   6262,   7171,   7383,
+      8307,   8504,   9444,   9624,  10581,  10743,  11720,  11861,  12860,  12977,  14002,  14091,  15146,  15203,  16294,  16311,
+     17445,  17414,  18601,  18512,  19765,  19600,  20939,  20675,  22131,  21729,  23350,  22745,  24621,  23686,  26006,  24444,
+     27721,  24509,  31375,  10966, -31219, -24885, -27838, -24762, -26147, -23992, -24772, -23043, -23508, -22019, -22296, -20957,
+    -21115, -19870, -19953, -18766, -18808, -17647, -17677, -16512, -16566, -15354, -15485, -14151, -14473, -12828, -13712, -10797,
+    -19611, -28680, -24586, -25486, -22731, -23000, -20624, -20635, -18449, -18312, -16246, -16009, -14029, -13716, -11804, -11431,
+     -9573,  -9149,  -7339,  -6870,  -5103,  -4593,  -2865,  -2317,   -627,    -41,   1612,   2234,   3850,   4510,   6088,   6788,
+      8325,   9066,  10559,  11347,  12790,  13632,  15017,  15923,  17236,  18224,  19443,  20540,  21628,  22887,  23772,  25287,
+     25893,  26810, -19831, -28462, -24143, -24936, -22425, -22369, -20383, -19940, -18282, -17522, -16213, -15009, -14377, -11803,
+    -20152, -25259, -27052, -25333, -22742, -21774, -21760, -20583, -18492, -17389, -17139, -15973, -14019, -12956, -12618, -11386,
+     -9492,  -8510,  -8129,  -6805,  -4942,  -4062,  -3658,  -2223,   -377,    381,    796,   2368,   4206,   4811,   5230,   6976,
+      8816,   9216,   9628,  11621,  13475,  13567,  13956,  16350,  18241,  17780,  18110,  21329,  23317,  21466,  21619,  27784,
+     30098,  15648, -10588, -28762, -29239, -22448, -20861, -23195, -22292, -18560, -17229, -18337, -17547, -14155, -12195, -14615,
+    -18594, -21440, -24331, -26146, -26126, -24293, -21446, -18739, -17064, -16616, -16852, -16879, -16001, -14125, -11778,  -9749,
+     -8594,  -8300,  -8308,  -7884,  -6581,  -4521,  -2310,   -652,    105,    190,    275,   1049,   2766,   5073,   7213,   8503,
+      8782,   8554,   8695,   9908,  12239,  14987,  17086,  17772,  17131,  16176,  16334,  18581,  22689,  27044,  29201,  26959,
+     19453,   7697,  -5709, -17592, -25451, -28362, -27126, -23672, -20055, -17590, -16520, -16294, -16211, -15989, -15940, -16678,
+    -16928, -18440, -20258, -22064, -23540, -24422, -24535, -23817, -22327, -20228, -17760, -15198, -12811, -10816,  -9347,  -8441,
+     -8031,  -7965,  -8033,  -8008,  -7685,  -6914,  -5629,  -3862,  -1729,    582,   2847,   4846,   6405,   7422,   7896,   7927,
+      7702,   7472,   7502,   8033,   9231,  11156,  13735,  16765,  19926,  22822,  25030,  26155,  25889,  24053,  20635,  15793,
+      9844,   3230,  -3535,  -9924, -15466, -19795, -22696, -24127, -24215, -23231, -21551, -19597, -17779, -16442, -15816, -15994,
+    -24831, -24326, -23584, -22650, -21569, -20386, -19148, -17894, -16661, -15481, -14376, -13363, -12449, -11635, -10912, -10265,
+     -9673,  -9111,  -8548,  -7955,  -7301,  -6555,  -5693,  -4693,  -3539,  -2226,   -752,    873,   2632,   4498,   6439,   8412,
+     10373,  12270,  14050,  15661,  17050,  18168,  18971,  19423,  19493,  19163,  18424,  17277,  15736,  13824,  11576,   9035,
+      6253,   3288,    203,  -2935,  -6059,  -9105, -12009, -14715, -17171, -19335, -21175, -22666, -23797, -24566, -24982, -25061,
+    -22072, -22767, -23287, -23625, -23779, -23747, -23529, -23128, -22547, -21792, -20870, -19790, -18562, -17199, -15714, -14120,
+    -12433, -10669,  -8846,  -6980,  -5090,  -3195,  -1311,    541,   2346,   4085,   5742,   7300,   8745,  10063,  11241,  12267,
+     13132,  13828,  14348,  14686,  14840,  14808,  14590,  14188,  13607,  12852,  11930,  10850,   9623,   8260,   6774,   5180,
+      3493,   1730,    -94,  -1959,  -3849,  -5745,  -7628,  -9481, -11285, -13025, -14681, -16239, -17684, -19002, -20180, -21206,
+    
+    // Frame 4
+    -17904, -29544, -26405, -27720, -26307, -26833, -25878, -26104, -25362, -25428, -24809, -24778, -24239, -24141, -23658, -23512,
+    -23071, -22888, -22480, -22268, -21885, -21650, -21289, -21035, -20690, -20421, -20091, -19807, -19490, -19195, -18889, -18584,
+    -18287, -17973, -17684, -17362, -17081, -16752, -16478, -16143, -15874, -15533, -15270, -14924, -14666, -14315, -14062, -13707,
+    -13457, -13098, -12853, -12490, -12248, -11881, -11643, -11273, -11038, -10665, -10433, -10057,  -9827,  -9449,  -9222,  -8841,
+     -8617,  -8234,  -8011,  -7626,  -7405,  -7018,  -6800,  -6411,  -6194,  -5803,  -5589,  -5196,  -4983,  -4588,  -4377,  -3981,
+     -3771,  -3373,  -3165,  -2766,  -2560,  -2159,  -1954,  -1552,  -1348,   -944,   -742,   -337,   -136,    270,    470,    877,
+      1076,   1484,   1682,   2092,   2288,   2699,   2894,   3306,   3500,   3913,   4107,   4520,   4713,   5127,   5319,   5734,
+      5925,   6341,   6531,   6948,   7137,   7555,   7744,   8162,   8350,   8769,   8956,   9376,   9562,   9983,  10169,  10590,
+     10775,  11197,  11381,  11804,  11988,  12410,  12594,  13017,  13200,  13624,  13807,  14231,  14413,  14837,  15020,  15444,
+     15626,  16051,  16233,  16657,  16839,  17264,  17446,  17870,  18053,  18477,  18660,  19083,  19266,  19689,  19874,  20296,
+     20481,  20901,  21088,  21507,  21696,  22113,  22303,  22718,  22911,  23323,  23520,  23927,  24129,  24531,  24738,  25135,
+     25348,  25739,  25956,  26346,  26555,  26979,  27079,  27905,  25256, -23064, -28684, -26667, -27336, -26338, -26590, -25813,
+    -25931, -25243, -25298, -24656, -24676, -24062, -24060, -23463, -23447, -22861, -22836, -22258, -22227, -21653, -21619, -21048,
+    -21011, -20442, -20405, -19835, -19798, -19228, -19193, -18620, -18587, -18012, -17983, -17403, -17378, -16794, -16774, -16185,
+    -16171, -15574, -15569, -14964, -14967, -14352, -14366, -13739, -13766, -13125, -13167, -12510, -12570, -11893, -11975, -11273,
+    -11383, -10650, -10796, -10021, -10215,  -9384,  -9645,  -8734,  -9092,  -8058,  -8576,  -7329,  -8147,  -6442,  -8049,  -4618,
+    -17517, -29290, -25755, -26848, -25060, -25347, -24032, -24003, -22916, -22714, -21764, -21450, -20594, -20200, -19413, -18959,
+    -18225, -17722, -17033, -16490, -15838, -15260, -14640, -14032, -13441, -12806, -12240, -11580, -11039, -10356,  -9836,  -9132,
+     -8633,  -7909,  -7430,  -6687,  -6226,  -5464,  -5022,  -4242,  -3817,  -3020,  -2613,  -1798,  -1409,   -576,   -204,    646,
+      1000,   1868,   2204,   3091,   3408,   4313,   4611,   5536,   5814,   6760,   7017,   7984,   8219,   9209,   9419,  10436,
+     10619,  11663,  11818,  12892,  13014,  14123,  14208,  15356,  15400,  16593,  16587,  17834,  17770,  19082,  18944,  20339,
+     20107,  21610,  21251,  22906,  22364,  24246,  23412,  25682,  24304,  27401,  24603,  30774,  13993, -30145, -25396, -27377,
+    -24974, -25703, -24062, -24277, -23008, -22939, -21896, -21642, -20754, -20367, -19596, -19103, -18429, -17847, -17256, -16595,
+    -16082, -15343, -14908, -14089, -13738, -12830, -12575, -11559, -11430, -10264, -10318,  -8917,  -9294,  -7413,  -8600,  -4969,
+    -17225, -28790, -24453, -25102, -22574, -22359, -20361, -19776, -18056, -17250, -15715, -14750, -13354, -12264, -10983,  -9786,
+     -8605,  -7313,  -6223,  -4843,  -3840,  -2374,  -1456,     95,    927,   2566,   3307,   5040,   5684,   7519,   8054,  10007,
+     10414,  12506,  12759,  15024,  15080,  17574,  17357,  20184,  19550,  22923,  21533,  26036,  22732,  31354,   6995, -31208,
+    -23492, -25962, -22286, -22842, -20317, -20083, -18152, -17437, -15920, -14826, -13682, -12191, -11509,  -9418,  -9651,  -5716,
+    -17802, -25230, -27013, -24828, -22505, -21574, -21062, -19813, -18051, -16758, -16030, -14958, -13281, -11896, -11147, -10119,
+     -8427,  -7026,  -6317,  -5285,  -3534,  -2153,  -1520,   -454,   1390,   2723,   3245,   4374,   6352,   7603,   7962,   9197,
+     11377,  12489,  12589,  14011,  16537,  17386,  16998,  18817,  22091,  22273,  20575,  23754,  30005,  25582,   3833, -21200,
+    -30927, -25642, -20304, -21704, -23074, -19779, -16636, -17271, -17667, -14677, -11975, -12626, -12990,  -9517,  -6154,  -9161,
+    -18097, -22822, -25479, -25687, -24087, -21841, -19967, -18866, -18286, -17650, -16514, -14853, -13032, -11511, -10518,  -9889,
+     -9204,  -8078,  -6437,  -4572,  -2939,  -1848,  -1238,   -708,    222,   1780,   3768,   5670,   6987,   7589,   7837,   8384,
+      9750,  11937,  14361,  16170,  16806,  16456,  16072,  16877,  19568,  23654,  27361,  28253,  24340,  15149,   2189, -11487,
+    -22460, -28338, -28689, -25082, -20217, -16606, -15464, -16340, -17622, -17599, -15489, -11892,  -8460,  -7003,  -8524, -12708,
+    -17060, -19930, -22354, -24031, -24776, -24541, -23410, -21577, -19310, -16904, -14632, -12709, -11257, -10296,  -9746,  -9453,
+     -9217,  -8833,  -8133,  -7012,  -5451,  -3516,  -1352,    851,   2890,   4588,   5829,   6584,   6917,   6983,   7003,   7222,
+      7872,   9121,  11037,  13563,  16510,  19572,  22359,  24445,  25429,  24989,  22939,  19258,  14110,   7828,    885,  -6158,
+    -12724, -18283, -22418, -24878, -25602, -24729, -22570, -19570, -16245, -13114, -10633,  -9141,  -8816,  -9667, -11534, -14125,
+    -19132, -18517, -17887, -17269, -16686, -16152, -15676, -15261, -14900, -14581, -14288, -13999, -13686, -13321, -12876, -12322,
+    -11633, -10786,  -9764,  -8556,  -7158,  -5572,  -3812,  -1896,    147,   2283,   4470,   6663,   8810,  10861,  12763,  14464,
+     15917,  17079,  17913,  18389,  18488,  18199,  17521,  16463,  15045,  13295,  11252,   8960,   6470,   3837,   1120,  -1623,
+     -4335,  -6958,  -9444, -11746, -13827, -15657, -17215, -18489, -19475, -20180, -20617, -20807, -20778, -20560, -20189, -19701,
+    -22320, -22593, -22695, -22625, -22383, -21971, -21394, -20657, -19768, -18734, -17566, -16275, -14873, -13375, -11794, -10145,
+     -8445,  -6710,  -4956,  -3201,  -1461,    247,   1906,   3501,   5016,   6436,   7748,   8939,   9998,  10915,  11680,  12287,
+     12729,  13002,  13104,  13034,  12791,  12380,  11803,  11066,  10176,   9143,   7975,   6684,   5282,   3784,   2202,    554,
+     -1146,  -2882,  -4635,  -6391,  -8131,  -9838, -11498, -13092, -14607, -16027, -17339, -18531, -19590, -20506, -21272, -21878,
+    
+    // Frame 5
+    -15362, -30008, -26098, -27837, -26085, -26838, -25659, -26035, -25122, -25300, -24541, -24596, -23938, -23909, -23321, -23232,
+    -22697, -22562, -22067, -21896, -21433, -21233, -20797, -20573, -20159, -19914, -19518, -19257, -18877, -18601, -18235, -17946,
+    -17592, -17292, -16948, -16638, -16304, -15985, -15659, -15332, -15014, -14680, -14368, -14027, -13722, -13376, -13076, -12724,
+    -12430, -12073, -11783, -11421, -11137, -10770, -10490, -10119,  -9843,  -9469,  -9196,  -8818,  -8549,  -8167,  -7901,  -7517,
+     -7254,  -6866,  -6606,  -6216,  -5959,  -5566,  -5311,  -4916,  -4663,  -4266,  -4016,  -3616,  -3368,  -2966,  -2720,  -2316,
+     -2072,  -1666,  -1424,  -1016,   -776,   -366,   -128,    284,    520,    934,   1168,   1583,   1816,   2233,   2464,   2883,
+      3112,   3532,   3761,   4182,   4409,   4832,   5057,   5481,   5705,   6131,   6354,   6780,   7002,   7430,   7650,   8079,
+      8299,   8729,   8947,   9378,   9596,  10027,  10244,  10677,  10893,  11326,  11541,  11975,  12190,  12625,  12838,  13274,
+     13487,  13923,  14135,  14572,  14784,  15221,  15433,  15870,  16082,  16519,  16731,  17168,  17379,  17817,  18028,  18466,
+     18678,  19115,  19327,  19763,  19976,  20411,  20626,  21060,  21276,  21708,  21926,  22355,  22576,  23003,  23227,  23649,
+     23878,  24296,  24530,  24942,  25181,  25588,  25832,  26238,  26473,  26912,  27040,  27881,  25259, -23045, -28639, -26606,
+    -27249, -26235, -26460, -25668, -25759, -25055, -25083, -24426, -24419, -23789, -23761, -23148, -23106, -22504, -22452, -21859,
+    -21801, -21212, -21150, -20565, -20500, -19917, -19850, -19268, -19201, -18619, -18553, -17969, -17905, -17320, -17257, -16670,
+    -16609, -16019, -15962, -15368, -15315, -14717, -14669, -14066, -14023, -13414, -13377, -12761, -12732, -12109, -12087, -11455,
+    -11443, -10801, -10799, -10146, -10157,  -9491,  -9515,  -8834,  -8875,  -8176,  -8236,  -7515,  -7599,  -6853,  -6966,  -6187,
+     -6336,  -5517,  -5711,  -4840,  -5095,  -4153,  -4491,  -3449,  -3910,  -2714,  -3374,  -1912,  -2947,   -912,  -2934,   1258,
+    -14913, -29713, -25427, -26882, -24773, -25226, -23705, -23768, -22526, -22378, -21302, -21019, -20056, -19677, -18797, -18345,
+    -17529, -17020, -16256, -15699, -14979, -14382, -13700, -13067, -12418, -11754, -11135, -10442,  -9850,  -9131,  -8565,  -7821,
+     -7279,  -6512,  -5992,  -5203,  -4705,  -3894,  -3418,  -2586,  -2131,  -1278,   -843,     30,    444,   1339,   1731,   2647,
+      3018,   3956,   4305,   5265,   5591,   6575,   6877,   7886,   8161,   9197,   9445,  10510,  10727,  11824,  12008,  13140,
+     13286,  14459,  14562,  15781,  15833,  17107,  17099,  18440,  18358,  19782,  19605,  21139,  20834,  22520,  22031,  23944,
+     23163,  25466,  24139,  27269,  24523,  30727,  13998, -30107, -25307, -27254, -24800, -25496, -23803, -23986, -22664, -22564,
+    -21466, -21183, -20239, -19824, -18995, -18478, -17741, -17140, -16481, -15806, -15217, -14476, -13952, -13146, -12686, -11815,
+    -11422, -10482, -10162,  -9143,  -8909,  -7796,  -7667,  -6433,  -6447,  -5039,  -5271,  -3579,  -4205,  -1921,  -3552,    910,
+    -14693, -29092, -24085, -24995, -22103, -22071, -19707, -19344, -17203, -16683, -14655, -14052, -12084, -11439,  -9500,  -8836,
+     -6908,  -6240,  -4309,  -3651,  -1705,  -1066,    905,   1512,   3521,   4085,   6143,   6649,   8775,   9203,  11419,  11741,
+     14083,  14255,  16778,  16727,  19532,  19114,  22414,  21294,  25668,  22692,  31123,   7158, -31305, -23121, -25931, -21700,
+    -22692, -19505, -19827, -17098, -17098, -14596, -14440, -12035, -11836,  -9419,  -9295,  -6721,  -6877,  -3814,  -4882,    274,
+    -15006, -25705, -27335, -23789, -21985, -21930, -20570, -18472, -17476, -16708, -14985, -13353, -12549, -11428,  -9598,  -8259,
+     -7512,  -6132,  -4278,  -3180,  -2433,   -818,   1014,   1875,   2665,   4527,   6294,   6887,   7769,   9933,  11575,  11811,
+     12868,  15475,  16862,  16513,  17960,  21415,  22141,  20378,  23181,  29724,  25847,   3910, -21499, -30794, -24966, -19978,
+    -21745, -22490, -18670, -16120, -17087, -16537, -13092, -11440, -12271, -10952,  -7438,  -6610,  -7804,  -5277,   -649,  -3248,
+    -14380, -19163, -23095, -25348, -25521, -23812, -20974, -18027, -15840, -14774, -14564, -14513, -13893, -12346, -10068,  -7674,
+     -5831,  -4860,  -4552,  -4292,  -3431,  -1688,    679,   3008,   4639,   5323,   5403,   5629,   6713,   8871,  11645,  14122,
+     15474,  15494,  14828,  14696,  16221,  19692,  24158,  27634,  27870,  23351,  14070,   1685, -11038, -21239, -27008, -27994,
+    -25347, -21086, -17199, -14909, -14369, -14863, -15314, -14841, -13111, -10391,  -7364,  -4845,  -3541,  -3897,  -6032,  -9718,
+    -16670, -19126, -20927, -21962, -22222, -21788, -20806, -19460, -17934, -16386, -14930, -13617, -12443, -11359, -10286,  -9140,
+     -7857,  -6404,  -4793,  -3079,  -1348,    297,   1761,   2979,   3931,   4654,   5240,   5827,   6570,   7621,   9090,  11023,
+     13375,  16004,  18679,  21097,  22917,  23807,  23484,  21761,  18581,  14036,   8368,   1949,  -4751, -11215, -16937, -21478,
+    -24516, -25884, -25589, -23807, -20865, -17193, -13280,  -9608,  -6604,  -4588,  -3743,  -4101,  -5552,  -7863, -10720, -13771,
+    -13271, -13214, -13286, -13478, -13772, -14144, -14562, -14986, -15377, -15688, -15876, -15899, -15717, -15299, -14618, -13657,
+    -12409, -10878,  -9077,  -7032,  -4777,  -2356,    178,   2767,   5348,   7856,  10226,  12395,  14301,  15894,  17128,  17966,
+     18386,  18374,  17930,  17065,  15803,  14179,  12236,  10028,   7614,   5057,   2423,   -221,  -2812,  -5290,  -7602,  -9702,
+    -11553, -13129, -14414, -15402, -16101, -16525, -16699, -16655, -16432, -16072, -15620, -15121, -14619, -14152, -13755, -13455,
+    -20540, -20506, -20320, -19983, -19499, -18873, -18110, -17219, -16207, -15084, -13861, -12551, -11164,  -9716,  -8219,  -6689,
+     -5140,  -3586,  -2043,   -526,    950,   2373,   3726,   4999,   6178,   7253,   8212,   9046,   9748,  10311,  10729,  10999,
+     11117,  11083,  10896,  10560,  10076,   9450,   8687,   7795,   6783,   5661,   4438,   3127,   1741,    293,  -1204,  -2734,
+     -4284,  -5837,  -7380,  -8897, -10374, -11796, -13150, -14423, -15602, -16676, -17635, -18470, -19172, -19735, -20153, -20422,
+    
+    // Frame 6
+    -12711, -30581, -25684, -28061, -25758, -26947, -25336, -26069, -24782, -25273, -24174, -24513, -23539, -23774, -22889, -23047,
+    -22229, -22328, -21563, -21615, -20892, -20905, -20218, -20198, -19541, -19493, -18862, -18790, -18182, -18089, -17501, -17388,
+    -16819, -16688, -16135, -15989, -15452, -15291, -14767, -14593, -14082, -13896, -13397, -13199, -12711, -12502, -12025, -11806,
+    -11339, -11109, -10653, -10413,  -9966,  -9718,  -9280,  -9022,  -8593,  -8326,  -7906,  -7631,  -7219,  -6936,  -6531,  -6240,
+     -5844,  -5545,  -5157,  -4850,  -4469,  -4155,  -3782,  -3460,  -3095,  -2765,  -2407,  -2070,  -1720,  -1375,  -1032,   -680,
+      -345,     15,    343,    710,   1030,   1405,   1717,   2101,   2405,   2796,   3092,   3491,   3779,   4187,   4466,   4882,
+      5153,   5578,   5840,   6274,   6526,   6969,   7213,   7666,   7899,   8362,   8585,   9058,   9271,   9755,   9956,  10452,
+     10642,  11150,  11326,  11847,  12011,  12546,  12695,  13244,  13378,  13944,  14061,  14643,  14744,  15344,  15425,  16046,
+     16105,  16748,  16785,  17452,  17463,  18157,  18139,  18865,  18813,  19574,  19485,  20287,  20153,  21003,  20817,  21724,
+     21475,  22452,  22126,  23189,  22765,  23940,  23387,  24711,  23983,  25518,  24533,  26388,  24989,  27399,  25220,  28816,
+     24595,  32654,  -1742, -32611, -24581, -28774, -25206, -27356, -24976, -26346, -24519, -25475, -23970, -24668, -23374, -23896,
+    -22752, -23145, -22113, -22408, -21463, -21679, -20805, -20958, -20142, -20241, -19474, -19528, -18804, -18817, -18130, -18109,
+    -17455, -17403, -16778, -16698, -16100, -15994, -15421, -15291, -14741, -14589, -14060, -13887, -13379, -13186, -12697, -12486,
+    -12015, -11785, -11333, -11085, -10651, -10385,  -9969,  -9685,  -9286,  -8985,  -8604,  -8284,  -7922,  -7584,  -7240,  -6883,
+     -6559,  -6181,  -5879,  -5479,  -5199,  -4776,  -4520,  -4071,  -3843,  -3365,  -3167,  -2657,  -2494,  -1947,  -1824,  -1232,
+     -1158,   -512,   -499,    215,    150,    955,    784,   1715,   1392,   2512,   1945,   3390,   2367,   4504,   2293,   7024,
+    -12309, -30142, -25085, -26934, -24462, -25136, -23341, -23575, -22088, -22095, -20781, -20652, -19447, -19230, -18098, -17819,
+    -16740, -16416, -15375, -15019, -14005, -13625, -12632, -12235, -11256, -10847,  -9879,  -9460,  -8499,  -8075,  -7119,  -6691,
+     -5737,  -5309,  -4354,  -3927,  -2970,  -2547,  -1585,  -1167,   -199,    211,   1187,   1589,   2575,   2966,   3964,   4341,
+      5354,   5715,   6746,   7088,   8139,   8459,   9534,   9827,  10932,  11193,  12332,  12556,  13737,  13914,  15146,  15267,
+     16562,  16612,  17987,  17945,  19426,  19262,  20885,  20553,  22380,  21796,  23939,  22947,  25638,  23871,  27744,  23938,
+     32278,   -822, -32327, -23833, -27794, -23765, -25688, -22840, -23990, -21687, -22433, -20442, -20941, -19149, -19484, -17829,
+    -18049, -16491, -16628, -15141, -15218, -13783, -13815, -12417, -12419, -11046, -11028,  -9669,  -9643,  -8287,  -8263,  -6898,
+     -6889,  -5503,  -5524,  -4099,  -4169,  -2681,  -2831,  -1242,  -1521,    235,   -266,   1794,    857,   3590,   1482,   6797,
+    -12267, -29234, -23926, -24631, -21933, -21438, -19441, -18482, -16818, -15608, -14141, -12770, -11437,  -9953,  -8718,  -7148,
+     -5989,  -4350,  -3254,  -1557,   -515,   1233,   2226,   4020,   4969,   6807,   7713,   9593,  10456,  12380,  13198,  15170,
+     15935,  17967,  18661,  20782,  21356,  23660,  23899,  27024,  23124, -23643, -26839, -23934, -23621, -21301, -20813, -18544,
+    -18057, -15760, -15319, -12960, -12596, -10146,  -9889,  -7311,  -7211,  -4437,  -4587,  -1482,  -2095,   1710,   -101,   6313,
+    -11317, -25171, -28624, -23605, -20439, -21575, -21158, -17704, -15775, -16219, -15106, -12055, -10614, -10789,  -9287,  -6432,
+     -5329,  -5350,  -3537,   -808,     -7,     79,   2199,   4833,   5308,   5481,   7962,  10514,  10571,  10824,  13817,  16286,
+     15674,  16020,  19967,  22318,  20153,  20694,  27865,  29568,  12899, -13721, -29174, -27340, -21151, -20551, -21735, -19563,
+    -16615, -15978, -15558, -13500, -11589, -10785,  -9572,  -7746,  -6540,  -5396,  -3443,  -2173,  -1927,    327,   4053,   1489,
+    -10963, -18731, -24650, -27106, -25942, -22426, -18521, -15864, -15020, -15368, -15646, -14790, -12555,  -9600,  -7001,  -5544,
+     -5240,  -5341,  -4848,  -3169,   -499,   2304,   4278,   4993,   4855,   4867,   5988,   8481,  11688,  14394,  15597,  15219,
+     14284,  14396,  16744,  21200,  26048,  28594,  26405,  18568,   6304,  -7409, -19050, -26015, -27609, -25102, -20902, -17297,
+    -15462, -15176, -15317, -14748, -13047, -10667,  -8500,  -7181,  -6611,  -6026,  -4576,  -2049,    755,   2277,    985,  -3710,
+    -13075, -15345, -17276, -18788, -19833, -20392, -20465, -20069, -19236, -18006, -16432, -14581, -12530, -10369,  -8195,  -6107,
+     -4195,  -2535,  -1171,   -113,    671,   1256,   1753,   2297,   3029,   4080,   5545,   7464,   9811,  12485,  15310,  18054,
+     20440,  22184,  23021,  22738,  21205,  18396,  14395,   9400,   3710,  -2309,  -8248, -13700, -18295, -21742, -23848, -24543,
+    -23877, -22017, -19221, -15816, -12157,  -8595,  -5445,  -2957,  -1302,   -560,   -724,  -1712,  -3379,  -5545,  -8012, -10581,
+     -8655,  -9443, -10408, -11503, -12671, -13851, -14979, -15986, -16808, -17387, -17667, -17607, -17174, -16348, -15126, -13516,
+    -11543,  -9245,  -6674,  -3892,   -970,   2011,   4970,   7823,  10487,  12884,  14944,  16605,  17821,  18555,  18787,  18514,
+     17747,  16512,  14850,  12816,  10473,   7896,   5163,   2355,   -445,  -3158,  -5710,  -8036, -10082, -11804, -13172, -14172,
+    -14803, -15077, -15022, -14675, -14086, -13309, -12408, -11446, -10487,  -9593,  -8820,  -8216,  -7819,  -7656,  -7743,  -8080,
+    -17514, -17291, -16943, -16473, -15886, -15187, -14384, -13484, -12495, -11428, -10292,  -9099,  -7859,  -6586,  -5290,  -3985,
+     -2683,  -1397,   -139,   1078,   2244,   3347,   4376,   5321,   6174,   6925,   7568,   8097,   8506,   8792,   8952,   8984,
+      8887,   8664,   8316,   7846,   7259,   6560,   5757,   4857,   3868,   2801,   1665,    472,   -768,  -2041,  -3337,  -4642,
+     -5943,  -7229,  -8487,  -9705, -10871, -11974, -13003, -13948, -14800, -15552, -16195, -16724, -17133, -17419, -17579, -17610,
+    
+    // Frame 7
+    -10282, -30934, -25487, -28070, -25643, -26846, -25221, -25897, -24645, -25043, -24006, -24233, -23336, -23446, -22648, -22674,
+    -21948, -21910, -21241, -21153, -20528, -20401, -19812, -19651, -19093, -18905, -18372, -18160, -17648, -17417, -16924, -16675,
+    -16198, -15934, -15472, -15194, -14744, -14454, -14016, -13716, -13287, -12977, -12558, -12239, -11829, -11502, -11099, -10765,
+    -10369, -10028,  -9638,  -9292,  -8907,  -8556,  -8177,  -7819,  -7445,  -7084,  -6714,  -6348,  -5982,  -5612,  -5251,  -4877,
+     -4519,  -4142,  -3787,  -3407,  -3055,  -2672,  -2323,  -1937,  -1591,  -1202,   -858,   -467,   -126,    267,    607,   1002,
+      1340,   1736,   2072,   2471,   2805,   3205,   3538,   3939,   4271,   4673,   5004,   5407,   5737,   6141,   6470,   6875,
+      7204,   7609,   7937,   8342,   8671,   9076,   9404,   9809,  10138,  10542,  10872,  11276,  11606,  12009,  12340,  12741,
+     13075,  13474,  13809,  14207,  14544,  14939,  15279,  15671,  16014,  16402,  16750,  17134,  17486,  17865,  18222,  18595,
+     18960,  19324,  19698,  20053,  20437,  20781,  21177,  21507,  21919,  22231,  22663,  22952,  23411,  23669,  24163,  24380,
+     24924,  25081,  25698,  25763,  26497,  26413,  27335,  27073,  27154, -20572, -29361, -26097, -27444, -25844, -26454, -25268,
+    -25613, -24611, -24822, -23922, -24053, -23218, -23296, -22504, -22545, -21785, -21799, -21062, -21056, -20337, -20316, -19610,
+    -19576, -18881, -18838, -18152, -18101, -17421, -17365, -16690, -16629, -15959, -15894, -15226, -15159, -14494, -14425, -13760,
+    -13691, -13027, -12958, -12293, -12225, -11559, -11492, -10825, -10759, -10090, -10027,  -9355,  -9295,  -8620,  -8564,  -7884,
+     -7832,  -7148,  -7101,  -6412,  -6371,  -5675,  -5641,  -4938,  -4911,  -4200,  -4182,  -3462,  -3453,  -2723,  -2725,  -1983,
+     -1998,  -1242,  -1272,   -501,   -548,    242,    176,    987,    897,   1733,   1617,   2482,   2333,   3235,   3046,   3992,
+      3753,   4755,   4453,   5527,   5141,   6314,   5812,   7124,   6450,   7978,   7027,   8926,   7449,  10151,   7293,  13014,
+     -9703, -30559, -24768, -26950, -24200, -24985, -23050, -23297, -21747, -21703, -20380, -20153, -18983, -18627, -17567, -17115,
+    -16140, -15612, -14705, -14116, -13265, -12623, -11821, -11134, -10374,  -9648,  -8926,  -8163,  -7476,  -6680,  -6024,  -5197,
+     -4572,  -3716,  -3119,  -2235,  -1666,   -754,   -212,    727,   1241,   2207,   2695,   3688,   4148,   5170,   5601,   6651,
+      7053,   8134,   8504,   9618,   9953,  11103,  11401,  12591,  12846,  14082,  14288,  15576,  15726,  17076,  17156,  18584,
+     18576,  20105,  19980,  21648,  21356,  23230,  22674,  24899,  23850,  26823,  24491,  30246,  15476, -29484, -25440, -26902,
+    -24630, -25042, -23423, -23390, -22095, -21813, -20716, -20273, -19312, -18752, -17892, -17242, -16463, -15740, -15029, -14243,
+    -13590, -12748, -12149, -11255, -10707,  -9764,  -9264,  -8272,  -7822,  -6780,  -6380,  -5287,  -4941,  -3790,  -3504,  -2291,
+     -2073,   -785,   -648,    729,    766,   2257,   2162,   3808,   3527,   5403,   4830,   7092,   5979,   9058,   6547,  12667,
+     -9370, -29852, -23289, -24748, -21279, -21291, -18688, -18110, -15943, -15024, -13135, -11981, -10297,  -8960,  -7443,  -5951,
+     -4579,  -2948,  -1712,     52,   1155,   3054,   4020,   6061,   6877,   9078,   9722,  12112,  12543,  15176,  15324,  18297,
+     18023,  21543,  20518,  25154,  22247,  30917,   7806, -30892, -23085, -25234, -21337, -21626, -18845, -18374, -16155, -15242,
+    -13388, -12161, -10587,  -9101,  -7774,  -6046,  -4964,  -2980,  -2176,    123,    556,   3314,   3138,   6778,   5143,  11885,
+     -9474, -24083, -28194, -24140, -20488, -20346, -20270, -17958, -15432, -14566, -13991, -12064,  -9791,  -8698,  -7997,  -6206,
+     -3983,  -2812,  -2116,   -360,   1916,   3083,   3681,   5476,   7902,   8990,   9370,  11300,  14038,  14911,  14830,  17108,
+     20575,  20837,  19455,  23013,  29465,  25346,   4164, -20522, -30399, -25196, -19405, -20267, -21543, -18268, -14744, -14832,
+    -15056, -12161,  -9212,  -9122,  -9025,  -6172,  -3367,  -3361,  -3281,   -184,   2840,   2329,   1823,   6101,  10735,   5853,
+    -10098, -18316, -23773, -25629, -24436, -21637, -18756, -16707, -15562, -14795, -13794, -12278, -10412,  -8596,  -7126,  -5980,
+     -4862,  -3449,  -1659,    271,   1958,   3168,   4025,   4963,   6432,   8548,  10940,  12933,  14002,  14208,  14308,  15381,
+     18121,  22174,  25957,  27157,  23769,  15171,   2681, -10769, -21746, -27715, -28064, -24236, -18928, -14764, -13120, -13674,
+    -14861, -14931, -12991,  -9472,  -5786,  -3412,  -2972,  -3824,  -4438,  -3326,     -2,   4576,   8359,   9183,   5858,  -1199,
+     -8288, -11374, -14432, -17237, -19562, -21208, -22020, -21914, -20888, -19029, -16504, -13541, -10409,  -7378,  -4690,  -2527,
+      -987,    -69,    322,    366,    298,    379,    854,   1913,   3663,   6104,   9126,  12511,  15959,  19121,  21638,  23186,
+     23515,  22479,  20059,  16364,  11620,   6149,    334,  -5421, -10732, -15271, -18791, -21148, -22300, -22305, -21298, -19473,
+    -17056, -14275, -11344,  -8449,  -5736,  -3314,  -1261,    367,   1529,   2191,   2321,   1891,    886,   -690,  -2802,  -5375,
+     -5461,  -7113,  -8915, -10786, -12640, -14389, -15948, -17235, -18179, -18717, -18804, -18408, -17517, -16135, -14287, -12014,
+     -9374,  -6439,  -3294,    -32,   3246,   6440,   9449,  12179,  14543,  16467,  17891,  18770,  19080,  18815,  17986,  16627,
+     14785,  12526,   9928,   7080,   4076,   1016,  -2002,  -4883,  -7538,  -9891, -11878, -13448, -14571, -15232, -15436, -15203,
+    -14572, -13596, -12342, -10884,  -9304,  -7688,  -6121,  -4683,  -3448,  -2481,  -1831,  -1536,  -1614,  -2069,  -2885,  -4032,
+    -13779, -13475, -13077, -12588, -12013, -11358, -10629,  -9832,  -8976,  -8068,  -7119,  -6135,  -5128,  -4107,  -3081,  -2061,
+     -1056,    -77,    869,   1770,   2620,   3409,   4130,   4776,   5340,   5819,   6206,   6497,   6692,   6786,   6780,   6674,
+      6468,   6164,   5766,   5277,   4702,   4047,   3318,   2521,   1665,    758,   -192,  -1176,  -2183,  -3204,  -4230,  -5250,
+     -6254,  -7234,  -8179,  -9081,  -9931, -10720, -11441, -12087, -12651, -13129, -13516, -13808, -14003, -14097, -14091, -13985,
+    
+    // Frame 8
+     -7714, -31424, -25155, -28211, -25398, -26873, -24979, -25850, -24385, -24935, -23719, -24070, -23018, -23231, -22295, -22409,
+    -21560, -21597, -20816, -20793, -20066, -19994, -19311, -19198, -18554, -18405, -17793, -17615, -17031, -16826, -16267, -16039,
+    -15502, -15253, -14736, -14468, -13968, -13684, -13201, -12900, -12432, -12117, -11663, -11335, -10894, -10553, -10124,  -9771,
+     -9354,  -8990,  -8583,  -8209,  -7812,  -7428,  -7041,  -6647,  -6270,  -5866,  -5499,  -5086,  -4728,  -4306,  -3956,  -3525,
+     -3184,  -2745,  -2413,  -1965,  -1641,  -1185,   -869,   -405,    -97,    374,    675,   1154,   1446,   1934,   2218,   2714,
+      2990,   3494,   3762,   4274,   4534,   5054,   5305,   5834,   6077,   6615,   6848,   7395,   7619,   8176,   8390,   8956,
+      9161,   9737,   9932,  10519,  10702,  11300,  11473,  12082,  12242,  12864,  13012,  13647,  13780,  14430,  14549,  15214,
+     15316,  15999,  16083,  16784,  16848,  17571,  17612,  18359,  18375,  19150,  19135,  19942,  19893,  20738,  20647,  21538,
+     21396,  22344,  22138,  23159,  22869,  23988,  23582,  24839,  24265,  25732,  24888,  26717,  25361,  27971,  25270,  30803,
+     14912, -30114, -25806, -27993, -25753, -26794, -25253, -25823, -24622, -24936, -23934, -24088, -23219, -23261, -22487, -22447,
+    -21744, -21642, -20995, -20842, -20241, -20046, -19483, -19253, -18723, -18463, -17960, -17675, -17196, -16887, -16431, -16101,
+    -15665, -15316, -14898, -14532, -14130, -13748, -13362, -12965, -12594, -12182, -11825, -11399, -11055, -10617, -10286,  -9835,
+     -9516,  -9053,  -8746,  -8271,  -7976,  -7489,  -7207,  -6707,  -6437,  -5925,  -5667,  -5143,  -4897,  -4361,  -4127,  -3579,
+     -3358,  -2797,  -2588,  -2014,  -1819,  -1231,  -1051,   -448,   -282,    335,    486,   1120,   1253,   1904,   2020,   2690,
+      2785,   3476,   3550,   4264,   4314,   5053,   5076,   5844,   5836,   6637,   6593,   7432,   7347,   8232,   8097,   9037,
+      8841,   9848,   9576,  10671,  10299,  11509,  11000,  12375,  11666,  13290,  12260,  14313,  12679,  15651,  12436,  18863,
+     -7026, -31053, -24370, -27052, -23846, -24930, -22659, -23124, -21296, -21426, -19861, -19778, -18390, -18157, -16898, -16553,
+    -15394, -14958, -13881, -13371, -12362, -11789, -10838, -10210,  -9312,  -8634,  -7784,  -7060,  -6254,  -5487,  -4723,  -3915,
+     -3191,  -2344,  -1658,   -773,   -126,    798,   1407,   2370,   2939,   3941,   4470,   5514,   6000,   7088,   7529,   8664,
+      9056,  10242,  10580,  11823,  12101,  13408,  13616,  14999,  15124,  16599,  16623,  18211,  18106,  19841,  19566,  21504,
+     20982,  23224,  22315,  25072,  23442,  27289,  23795,  31684,   7599, -31656, -24197, -27352, -23826, -25141, -22696, -23295,
+    -21363, -21574, -19946, -19911, -18488, -18279, -17006, -16666, -15510, -15064, -14003, -13471, -12491, -11882, -10974, -10298,
+     -9454,  -8715,  -7932,  -7134,  -6408,  -5554,  -4885,  -3974,  -3362,  -2392,  -1841,   -809,   -322,    776,   1194,   2367,
+      2704,   3964,   4207,   5570,   5696,   7193,   7166,   8842,   8599,  10541,   9962,  12348,  11148,  14470,  11672,  18472,
+     -6660, -30295, -22815, -24714, -20766, -21014, -18054, -17629, -15165, -14353, -12206, -11125,  -9213,  -7921,  -6202,  -4731,
+     -3182,  -1546,   -158,   1637,   2864,   4825,   5879,   8022,   8882,  11237,  11860,  14484,  14795,  17793,  17640,  21238,
+     20263,  25080,  22051,  31285,   3714, -31300, -22478, -25105, -20690, -21260, -18071, -17810, -15233, -14492, -12309, -11233,
+     -9345,  -8001,  -6364,  -4778,  -3379,  -1552,   -405,   1691,   2541,   4979,   5421,   8370,   8128,  12075,  10173,  17658,
+     -6323, -24737, -28859, -22856, -19648, -21009, -20071, -16249, -14600, -14943, -13159,  -9973,  -8898,  -8777,  -6547,  -3738,
+     -3043,  -2592,    -12,   2487,   2839,   3600,   6536,   8707,   8665,   9797,  13198,  14917,  14283,  16018,  20253,  21058,
+     19058,  22516,  29716,  24931,   1824, -22653, -29879, -23572, -19350, -20788, -20403, -16595, -14599, -14872, -13313, -10244,
+     -9030,  -8746,  -6581,  -3991,  -3307,  -2559,    122,   2211,   2331,   3691,   7078,   8291,   7349,  10309,  15885,  11875,
+     -6691, -15354, -21987, -25435, -25536, -23069, -19383, -15859, -13430, -12313, -12062, -11875, -11018,  -9177,  -6580,  -3845,
+     -1642,   -336,    214,    576,   1448,   3263,   5927,   8833,  11168,  12368,  12488,  12263,  12789,  14932,  18753,  23239,
+     26529,  26595,  22102,  13086,   1108, -11208, -21084, -26580, -27242, -24152, -19366, -15019, -12482, -11937, -12519, -12901,
+    -12023,  -9605,  -6233,  -2988,   -849,   -172,   -490,   -752,    141,   2747,   6720,  10851,  13486,  13176,   9258,   2163,
+     -4434,  -8904, -13365, -17406, -20639, -22754, -23558, -22998, -21178, -18338, -14823, -11041,  -7399,  -4252,  -1856,   -329,
+       361,    383,     23,   -371,   -440,    126,   1536,   3862,   7018,  10768,  14750,  18523,  21622,  23626,  24209,  23185,
+     20539,  16427,  11160,   5166,  -1066,  -7037, -12301, -16512, -19455, -21057, -21388, -20628, -19036, -16901, -14502, -12069,
+     -9757,  -7642,  -5721,  -3940,  -2218,   -485,   1292,   3081,   4785,   6240,   7242,   7576,   7054,   5556,   3060,   -341,
+     -3332,  -5722,  -8190, -10631, -12938, -15011, -16754, -18084, -18931, -19246, -18995, -18169, -16779, -14858, -12457,  -9649,
+     -6521,  -3173,    285,   3739,   7073,  10176,  12942,  15278,  17105,  18364,  19014,  19034,  18429,  17223,  15462,  13211,
+     10553,   7583,   4406,   1136,  -2115,  -5235,  -8120, -10674, -12817, -14487, -15637, -16245, -16306, -15841, -14887, -13502,
+    -11760,  -9748,  -7562,  -5305,  -3081,   -990,    871,   2419,   3582,   4307,   4558,   4319,   3596,   2415,    821,  -1121,
+     -9708,  -9418,  -9063,  -8648,  -8177,  -7653,  -7082,  -6470,  -5822,  -5145,  -4444,  -3728,  -3002,  -2274,  -1550,   -839,
+      -146,    522,   1159,   1757,   2312,   2818,   3270,   3664,   3996,   4263,   4463,   4593,   4651,   4639,   4555,   4401,
+      4177,   3887,   3533,   3118,   2646,   2123,   1552,    940,    292,   -386,  -1086,  -1803,  -2529,  -3257,  -3980,  -4692,
+     -5385,  -6053,  -6689,  -7287,  -7842,  -8348,  -8800,  -9194,  -9527,  -9794,  -9993, -10123, -10182, -10169, -10085,  -9931,
+    
+    // Frame 9
+     -5169, -31893, -24842, -28337, -25167, -26888, -24748, -25795, -24131, -24823, -23434, -23907, -22697, -23021, -21936, -22153,
+    -21161, -21298, -20375, -20450, -19584, -19608, -18787, -18771, -17986, -17937, -17183, -17105, -16377, -16275, -15569, -15447,
+    -14760, -14620, -13950, -13795, -13138, -12970, -12326, -12146, -11513, -11323, -10700, -10501,  -9886,  -9679,  -9071,  -8857,
+     -8256,  -8036,  -7440,  -7215,  -6625,  -6395,  -5808,  -5575,  -4992,  -4755,  -4175,  -3936,  -3358,  -3117,  -2541,  -2298,
+     -1723,  -1479,   -905,   -661,    -87,    158,    731,    976,   1550,   1793,   2369,   2611,   3188,   3428,   4007,   4245,
+      4826,   5062,   5646,   5878,   6466,   6694,   7287,   7510,   8108,   8325,   8929,   9140,   9750,   9955,  10573,  10769,
+     11395,  11582,  12219,  12395,  13042,  13207,  13867,  14018,  14693,  14828,  15520,  15637,  16348,  16445,  17178,  17250,
+     18010,  18053,  18845,  18854,  19683,  19650,  20525,  20442,  21373,  21226,  22229,  22001,  23098,  22761,  23984,  23497,
+     24902,  24192,  25876,  24807,  26972,  25222,  28423,  24902,  31889,  -8530, -31950, -24660, -28364, -25006, -26904, -24595,
+    -25805, -23982, -24830, -23287, -23912, -22551, -23025, -21791, -22156, -21017, -21300, -20232, -20452, -19441, -19610, -18644,
+    -18772, -17844, -17938, -17040, -17106, -16234, -16276, -15427, -15448, -14618, -14622, -13807, -13796, -12996, -12972, -12183,
+    -12148, -11370, -11326, -10556, -10503,  -9742,  -9682,  -8927,  -8861,  -8111,  -8040,  -7295,  -7220,  -6478,  -6401,  -5661,
+     -5581,  -4844,  -4762,  -4026,  -3944,  -3208,  -3126,  -2390,  -2308,  -1571,  -1490,   -752,   -673,     67,    143,    887,
+       959,   1708,   1775,   2529,   2590,   3350,   3405,   4172,   4219,   4995,   5033,   5818,   5845,   6643,   6657,   7468,
+      7468,   8294,   8277,   9122,   9085,   9951,   9891,  10783,  10695,  11617,  11495,  12454,  12292,  13296,  13085,  14143,
+     13870,  14999,  14645,  15866,  15406,  16752,  16144,  17668,  16841,  18640,  17458,  19733,  17877,  21181,  17551,  24738,
+     -4500, -31400, -24115, -27014, -23630, -24741, -22398, -22824, -20969, -21028, -19458, -19289, -17907, -17580, -16333, -15890,
+    -14745, -14211, -13147, -12540, -11542, -10875,  -9932,  -9214,  -8318,  -7556,  -6702,  -5900,  -5084,  -4247,  -3464,  -2594,
+     -1843,   -943,   -221,    707,   1402,   2357,   3025,   4006,   4649,   5656,   6272,   7305,   7896,   8955,   9518,  10605,
+     11140,  12257,  12761,  13910,  14380,  15565,  15996,  17224,  17607,  18888,  19211,  20563,  20801,  22257,  22363,  23994,
+     23853,  25866,  25052,  28582,  20951, -26365, -26611, -25997, -24960, -24295, -23388, -22603, -21798, -20928, -20195, -19262,
+    -18585, -17602, -16970, -15945, -15353, -14291, -13733, -12639, -12113, -10987, -10492,  -9335,  -8870,  -7684,  -7249,  -6032,
+     -5628,  -4380,  -4008,  -2727,  -2389,  -1073,   -771,    584,    845,   2242,   2458,   3903,   4067,   5569,   5672,   7240,
+      7270,   8919,   8858,  10610,  10432,  12319,  11983,  14058,  13493,  15854,  14923,  17771,  16154,  20044,  16639,  24431,
+     -4136, -30555, -22521, -24503, -20426, -20568, -17584, -16987, -14546, -13527, -11428, -10122,  -8272,  -6744,  -5096,  -3381,
+     -1909,    -24,   1281,   3332,   4468,   6693,   7648,  10067,  10809,  13465,  13936,  16913,  16991,  20471,  19865,  24353,
+     22060,  30141,  10996, -30096, -23200, -24613, -20944, -20753, -18060, -17198, -15005, -13749, -11882, -10345,  -8727,  -6963,
+     -5559,  -3589,  -2386,   -214,    780,   3172,   3929,   6583,   7042,  10047,  10077,  13631,  12916,  17568,  15010,  23620,
+     -4040, -23349, -28875, -23659, -19241, -19543, -19653, -16712, -13768, -13106, -12554, -10139,  -7536,  -6555,  -5831,  -3616,
+     -1079,     25,    733,   2883,   5515,   6628,   7158,   9358,  12276,  13264,  13343,  15787,  19440,  19959,  18707,  22179,
+     28893,  25848,   5764, -19041, -29997, -25300, -18922, -19194, -20591, -17470, -13537, -13184, -13448, -10627,  -7324,  -6833,
+     -6725,  -3939,   -845,   -402,   -210,   2710,   5839,   6036,   6050,   9389,  12917,  12366,  11537,  16461,  22131,  15902,
+     -2703, -13638, -22437, -27004, -26782, -22936, -17751, -13534, -11584, -11725, -12619, -12650, -10871,  -7498,  -3704,   -867,
+       278,     67,   -307,    455,   2951,   6684,  10332,  12550,  12825,  11870,  11299,  12706,  16646,  22090,  26692,  27791,
+     23654,  14362,   1884, -10693, -20397, -25481, -25919, -23126, -19124, -15617, -13406, -12354, -11775, -10975,  -9613,  -7754,
+     -5673,  -3620,  -1696,     92,   1721,   3106,   4197,   5139,   6338,   8295,  11235,  14725,  17559,  18077,  14877,   7586,
+     -2022,  -7800, -13339, -18102, -21635, -23629, -23955, -22684, -20068, -16507, -12485,  -8501,  -4995,  -2291,   -549,    251,
+       299,    -82,   -493,   -525,    165,   1796,   4421,   7908,  11951,  16109,  19865,  22699,  24161,  23937,  21900,  18127,
+     12900,   6666,    -18,  -6551, -12369, -17012, -20173, -21733, -21758, -20479, -18246, -15466, -12542,  -9810,  -7497,  -5694,
+     -4361,  -3343,  -2418,  -1345,     73,   1950,   4276,   6910,   9590,  11969,  13665,  14322,  13674,  11590,   8108,   3446,
+     -1797,  -4757,  -7703, -10516, -13080, -15288, -17045, -18274, -18917, -18938, -18323, -17086, -15262, -12908, -10103,  -6943,
+     -3538,     -7,   3524,   6929,  10088,  12887,  15225,  17021,  18210,  18751,  18627,  17845,  16435,  14453,  11972,   9085,
+      5901,   2536,   -887,  -4242,  -7408, -10272, -12735, -14710, -16134, -16962, -17174, -16775, -15791, -14273, -12291,  -9932,
+     -7300,  -4506,  -1668,   1095,   3666,   5940,   7821,   9229,  10106,  10414,  10136,   9282,   7884,   5994,   3688,   1056,
+     -5533,  -5330,  -5092,  -4821,  -4520,  -4191,  -3839,  -3466,  -3075,  -2671,  -2258,  -1839,  -1419,  -1001,   -590,   -189,
+       197,    566,    912,   1234,   1527,   1790,   2019,   2212,   2368,   2485,   2562,   2598,   2592,   2546,   2459,   2331,
+      2166,   1963,   1725,   1454,   1153,    824,    472,     99,   -292,   -696,  -1109,  -1528,  -1948,  -2366,  -2777,  -3178,
+     -3565,  -3933,  -4279,  -4601,  -4894,  -5157,  -5386,  -5579,  -5735,  -5852,  -5929,  -5965,  -5959,  -5913,  -5826,  -5698,
+    
+    // Frame 10
+     -2608, -32375, -24518, -28469, -24932, -26905, -24518, -25735, -23885, -24700, -23162, -23728, -22395, -22789, -21601, -21870,
+    -20792, -20964, -19971, -20068, -19144, -19178, -18310, -18292, -17473, -17410, -16632, -16531, -15789, -15655, -14944, -14779,
+    -14097, -13906, -13249, -13033, -12400, -12162, -11550, -11291, -10699, -10421,  -9848,  -9552,  -8996,  -8683,  -8144,  -7814,
+     -7291,  -6946,  -6438,  -6078,  -5585,  -5211,  -4731,  -4343,  -3877,  -3476,  -3024,  -2609,  -2170,  -1742,  -1316,   -875,
+      -461,     -8,    393,    859,   1247,   1726,   2101,   2593,   2955,   3460,   3809,   4327,   4662,   5195,   5516,   6062,
+      6369,   6930,   7222,   7798,   8075,   8667,   8927,   9536,   9779,  10405,  10631,  11275,  11481,  12146,  12331,  13017,
+     13181,  13890,  14029,  14763,  14875,  15638,  15721,  16515,  16564,  17394,  17405,  18276,  18242,  19161,  19076,  20051,
+     19904,  20947,  20724,  21853,  21534,  22771,  22328,  23709,  23096,  24681,  23820,  25715,  24454,  26883,  24871,  28442,
+     24467,  32316,   5168, -32343, -24589, -28493, -24988, -26936, -24570, -25769, -23935, -24735, -23212, -23763, -22444, -22825,
+    -21650, -21907, -20840, -21001, -20019, -20105, -19191, -19215, -18358, -18329, -17520, -17448, -16679, -16569, -15836, -15692,
+    -14991, -14817, -14144, -13943, -13296, -13070, -12447, -12199, -11598, -11328, -10747, -10458,  -9896,  -9589,  -9044,  -8720,
+     -8192,  -7851,  -7339,  -6983,  -6486,  -6115,  -5633,  -5247,  -4780,  -4379,  -3926,  -3512,  -3072,  -2644,  -2219,  -1777,
+     -1365,   -910,   -511,    -43,    343,    825,   1196,   1692,   2050,   2559,   2903,   3427,   3757,   4295,   4610,   5163,
+      5463,   6031,   6315,   6900,   7168,   7769,   8019,   8638,   8871,   9509,   9721,  10379,  10571,  11251,  11420,  12123,
+     12268,  12997,  13115,  13872,  13960,  14749,  14803,  15628,  15643,  16510,  16481,  17396,  17314,  18286,  18142,  19183,
+     18962,  20088,  19772,  21007,  20565,  21946,  21333,  22918,  22055,  23953,  22689,  25123,  23102,  26687,  22689,  30593,
+     -1726, -31997, -23609, -27228, -23158, -24809, -21878, -22784, -20378, -20896, -18789, -19069, -17154, -17277, -15492, -15505,
+    -13815, -13747, -12126, -11998, -10430, -10255,  -8727,  -8518,  -7020,  -6785,  -5309,  -5056,  -3595,  -3329,  -1878,  -1605,
+      -159,    116,   1563,   1835,   3288,   3551,   5015,   5265,   6745,   6975,   8479,   8681,  10217,  10383,  11960,  12079,
+     13710,  13766,  15470,  15442,  17243,  17102,  19038,  18734,  20867,  20321,  22760,  21815,  24792,  23085,  27227,  23506,
+     32063,   2555, -32097, -23639, -27264, -23217, -24829, -21948, -22797, -20453, -20904, -18866, -19075, -17233, -17281, -15574,
+    -15508, -13897, -13749, -12209, -11999, -10513, -10256,  -8811,  -8519,  -7104,  -6786,  -5393,  -5056,  -3679,  -3330,  -1962,
+     -1606,   -242,    114,   1481,   1832,   3207,   3547,   4936,   5259,   6668,   6966,   8404,   8669,  10146,  10366,  11895,
+     12055,  13653,  13733,  15425,  15395,  17217,  17030,  19043,  18620,  20932,  20120,  22956,  21400,  25375,  21851,  30144,
+     -1602, -30834, -22197, -24331, -20038, -20179, -17049, -16421, -13840, -12800, -10541,  -9240,  -7197,  -5714,  -3828,  -2208,
+      -442,   1284,   2954,   4768,   6358,   8246,   9766,  11720,  13177,  15193,  16588,  18670,  19986,  22178,  23296,  26017,
+     24065, -22466, -26697, -22982, -22592, -19768, -19052, -16370, -15592, -12931, -12158,  -9473,  -8737,  -6004,  -5326,  -2526,
+     -1925,    963,   1464,   4466,   4835,   7990,   8181,  11548,  11481,  15169,  14690,  18925,  17680,  23077,  19840,  29580,
+      -716, -23862, -29737, -22478, -18184, -20142, -19685, -15026, -12694, -13506, -11973,  -7976,  -6389,  -6763,  -4634,   -955,
+       104,    -25,   2614,   6096,   6622,   6657,   9900,  13240,  13023,  13185,  17439,  20659,  18848,  19152,  26637,  29454,
+     13608, -13011, -28592, -26512, -20011, -19193, -19976, -17280, -14067, -13312, -12481,  -9833,  -7644,  -6792,  -5208,  -2693,
+     -1119,    -96,   2035,   4334,   5378,   6682,   9372,  11287,  11684,  13549,  17083,  18079,  17175,  20883,  27135,  21747,
+      -572, -13533, -23208, -27396, -26116, -21405, -16159, -12687, -11712, -12314, -12749, -11615,  -8674,  -4887,  -1706,   -104,
+        41,   -160,    635,   3103,   6777,  10324,  12408,  12617,  11839,  11808,  14021,  18640,  24058,  27450,  26104,  18843,
+      6792,  -6962, -18661, -25483, -26656, -23552, -18772, -14779, -12789, -12478, -12540, -11685,  -9449,  -6378,  -3537,  -1734,
+      -976,   -504,    647,   2944,   5996,   8800,  10443,  10808,  10780,  11750,  14667,  19176,  23437,  24816,  21181,  12124,
+      -509,  -7190, -13313, -18306, -21738, -23371, -23191, -21394, -18358, -14574, -10577,  -6863,  -3817,  -1663,   -436,     10,
+       -26,   -160,     16,    849,   2566,   5222,   8681,  12630,  16613,  20100,  22560,  23544,  22754,  20094,  15691,   9887,
+      3199,  -3749, -10303, -15863, -19960, -22313, -22858, -21744, -19304, -15994, -12324,  -8778,  -5742,  -3456,  -1982,  -1210,
+      -887,   -670,   -198,    839,   2639,   5239,   8501,  12118,  15658,  18624,  20527,  20964,  19685,  16636,  11982,   6090,
+      -479,  -3849,  -7113, -10144, -12824, -15047, -16725, -17791, -18202, -17938, -17006, -15440, -13297, -10656,  -7615,  -4288,
+      -801,   2715,   6129,   9310,  12139,  14509,  16330,  17535,  18078,  17939,  17124,  15664,  13617,  11059,   8089,   4821,
+      1378,  -2109,  -5507,  -8687, -11530, -13929, -15794, -17055, -17668, -17612, -16891, -15537, -13605, -11172,  -8334,  -5204,
+     -1904,   1436,   4685,   7716,  10409,  12661,  14382,  15505,  15985,  15804,  14967,  13507,  11479,   8962,   6053,   2865,
+     -1380,  -1322,  -1255,  -1180,  -1098,  -1011,   -917,   -820,   -718,   -615,   -509,   -403,   -298,   -194,    -92,      6,
+       100,    188,    270,    345,    413,    472,    523,    563,    595,    616,    627,    627,    617,    597,    567,    526,
+       477,    418,    351,    277,    195,    107,     14,    -84,   -185,   -289,   -394,   -500,   -606,   -710,   -811,   -909,
+     -1003,  -1091,  -1173,  -1249,  -1316,  -1375,  -1426,  -1467,  -1498,  -1519,  -1530,  -1530,  -1520,  -1500,  -1470,  -1430,
+    
+    // Frame 11
+    -25582, -28492, -26340, -27271, -25618, -26240, -24814, -25257, -23979, -24296, -23127, -23348, -22264, -22410, -21393, -21478,
+    -20517, -20550, -19638, -19625, -18755, -18704, -17870, -17784, -16982, -16867, -16094, -15951, -15204, -15035, -14313, -14121,
+    -13421, -13208, -12528, -12295, -11635, -11383, -10741, -10472,  -9847,  -9560,  -8952,  -8650,  -8057,  -7739,  -7162,  -6829,
+     -6266,  -5919,  -5370,  -5009,  -4474,  -4099,  -3578,  -3189,  -2682,  -2280,  -1786,  -1370,   -890,   -461,      6,    449,
+       902,   1359,   1798,   2268,   2694,   3178,   3589,   4088,   4485,   4999,   5380,   5909,   6275,   6820,   7170,   7731,
+      8064,   8643,   8958,   9555,   9851,  10468,  10744,  11381,  11635,  12296,  12526,  13211,  13416,  14127,  14305,  15045,
+     15191,  15965,  16076,  16887,  16958,  17812,  17837,  18741,  18712,  19675,  19581,  20615,  20442,  21564,  21292,  22527,
+     22126,  23511,  22932,  24530,  23693,  25613,  24361,  26836,  24802,  28466,  24388,  32516,  -1738, -32537, -24366, -28487,
+    -24780, -26858, -24339, -25635, -23671, -24552, -22911, -23533, -22104, -22549, -21271, -21586, -20421, -20636, -19560, -19696,
+    -18691, -18762, -17816, -17834, -16937, -16909, -16055, -15986, -15170, -15066, -14284, -14148, -13395, -13232, -12506, -12316,
+    -11615, -11402, -10723, -10488,  -9831,  -9575,  -8938,  -8663,  -8044,  -7751,  -7150,  -6839,  -6256,  -5928,  -5361,  -5017,
+     -4466,  -4107,  -3571,  -3196,  -2676,  -2286,  -1781,  -1376,   -885,   -465,     10,    445,    906,   1355,   1801,   2265,
+      2696,   3176,   3592,   4086,   4487,   4997,   5382,   5908,   6276,   6819,   7170,   7731,   8064,   8643,   8958,   9556,
+      9850,  10469,  10743,  11383,  11634,  12297,  12524,  13213,  13414,  14130,  14302,  15049,  15188,  15969,  16072,  16892,
+     16953,  17818,  17832,  18747,  18705,  19682,  19573,  20623,  20434,  21574,  21282,  22538,  22114,  23524,  22919,  24545,
+     23676,  25631,  24341,  26857,  24778,  28492,  24358,  32549,  -1777, -32492, -24420, -28422, -24863, -26746, -24507, -25320,
+    -24836, -28531, -25074, -26194, -23596, -24154, -21970, -22204, -20283, -20298, -18564, -18418, -16825, -16552, -15073, -14697,
+    -13313, -12849, -11546, -11007,  -9776,  -9168,  -8002,  -7331,  -6226,  -5497,  -4449,  -3663,  -2670,  -1830,   -892,      3,
+       887,   1836,   2664,   3670,   4441,   5505,   6216,   7343,   7988,   9184,   9756,  11029,  11520,  12881,  13275,  14742,
+     15020,  16616,  16748,  18510,  18450,  20440,  20105,  22433,  21668,  24567,  23004,  27108,  23482,  32077,   -867, -32093,
+    -23467, -27124, -22988, -24582, -21653, -22448, -20090, -20454, -18435, -18525, -16734, -16630, -15006, -14755, -13262, -12894,
+    -11507, -11042,  -9745,  -9195,  -7977,  -7353,  -6206,  -5514,  -4433,  -3677,  -2658,  -1842,   -882,     -6,    894,   1829,
+      2670,   3665,   4445,   5502,   6218,   7342,   7989,   9184,   9755,  11032,  11517,  12885,  13270,  14748,  15013,  16624,
+     16738,  18522,  18437,  20455,  20088,  22454,  21645,  24594,  22971,  27147,  23435,  32137,   -944, -31987, -23628, -26815,
+    -23486, -28371, -22778, -23848, -19694, -19890, -16325, -16101, -12848, -12387,  -9315,  -8717,  -5748,  -5074,  -2156,  -1453,
+      1456,   2147,   5090,   5723,   8750,   9269,  12449,  12764,  16215,  16165,  20123,  19337,  24441,  21650,  31188,   -425,
+    -31213, -21625, -24466, -19311, -20150, -16138, -16243, -12735, -12480,  -9237,  -8784,  -5687,  -5129,  -2105,  -1502,   1504,
+      2100,   5137,   5676,   8799,   9219,  12502,  12708,  16276,  16099,  20196,  19255,  24535,  21537,  31332,   -625, -30864,
+    -31720, -26008, -21484, -23005, -22920, -18375, -15414, -16036, -15016, -10961,  -8647,  -8988,  -7460,  -3559,  -1685,  -1962,
+       -21,   3891,   5349,   4982,   7378,  11475,  12391,  11703,  14810,  19463,  19310,  17570,  22694,  29879,  23020,   -730,
+    -23247, -28857, -22757, -18591, -19103, -18444, -15145, -12720, -11927, -10463,  -7980,  -5989,  -4594,  -2892,   -908,    973,
+      2823,   4532,   6064,   8041,  10380,  11865,  12814,  15210,  18332,  19030,  18732,  22856,  28661,  22992,    637, -23518,
+    -24567, -30120, -29767, -25308, -19705, -15597, -14113, -14602, -15312, -14586, -11854,  -7879,  -4178,  -2007,  -1570,  -1913,
+     -1568,    481,   4117,   8135,  10996,  11852,  11174,  10574,  11852,  15799,  21448,  26276,  27317,  22646,  12459,   -848,
+    -13648, -22639, -26182, -24800, -20629, -16204, -13243, -12047, -11739, -11084,  -9344,  -6667,  -3847,  -1683,   -406,    456,
+      1693,   3807,   6606,   9311,  11109,  11809,  12110,  13244,  16130,  20527,  24755,  26251,  22780,  13682,    492, -13501,
+    -14189, -19929, -24079, -26338, -26633, -25121, -22162, -18257, -13972,  -9856,  -6361,  -3778,  -2206,  -1545,  -1523,  -1750,
+     -1793,  -1252,    164,   2581,   5932,   9951,  14214,  18189,  21319,  23099,  23162,  21327,  17644,  12383,   6014,   -860,
+     -7579, -13509, -18125, -21076, -22223, -21647, -19626, -16580, -13008,  -9405,  -6187,  -3637,  -1864,   -805,   -240,    149,
+       722,   1797,   3596,   6182,   9445,  13099,  16721,  19805,  21842,  22395,  21172,  18080,  13248,   7026,    -57,  -7356,
+     -7737, -11137, -14194, -16791, -18830, -20233, -20947, -20943, -20222, -18808, -16755, -14140, -11059,  -7628,  -3974,   -235,
+      3450,   6946,  10122,  12861,  15064,  16652,  17568,  17784,  17296,  16128,  14331,  11979,   9166,   6005,   2621,   -852,
+     -4276,  -7519, -10452, -12962, -14951, -16341, -17079, -17137, -16514, -15234, -13350, -10936,  -8087,  -4917,  -1550,   1878,
+      5234,   8381,  11195,  13563,  15387,  16593,  17128,  16967,  16110,  14585,  12445,   9767,   6651,   3211,   -425,  -4121,
+     -2563,  -2642,  -2703,  -2747,  -2772,  -2779,  -2766,  -2736,  -2686,  -2619,  -2535,  -2434,  -2318,  -2188,  -2044,  -1889,
+     -1724,  -1550,  -1369,  -1183,   -994,   -803,   -612,   -424,   -239,    -60,    111,    273,    425,    565,    691,    802,
+       898,    977,   1039,   1082,   1108,   1114,   1102,   1071,   1022,    955,    870,    770,    654,    523,    380,    225,
+        59,   -115,   -295,   -481,   -671,   -862,  -1052,  -1241,  -1425,  -1604,  -1776,  -1938,  -2090,  -2229,  -2355,  -2467,
+    
+    // Frame 12
+    -24126, -27965, -26949, -26537, -26193, -25496, -25302, -24517, -24378, -23559, -23442, -22608, -22499, -21662, -21554, -20718,
+    -20607, -19775, -19660, -18832, -18712, -17890, -17764, -16948, -16816, -16006, -15867, -15063, -14919, -14121, -13971, -13179,
+    -13023, -12236, -12076, -11294, -11128, -10351, -10180,  -9408,  -9233,  -8465,  -8286,  -7522,  -7338,  -6579,  -6391,  -5636,
+     -5444,  -4692,  -4497,  -3749,  -3550,  -2806,  -2604,  -1862,  -1657,   -918,   -710,     25,    236,    969,   1183,   1913,
+      2129,   2857,   3076,   3801,   4022,   4745,   4968,   5689,   5914,   6633,   6860,   7578,   7806,   8522,   8752,   9467,
+      9698,  10411,  10643,  11356,  11589,  12301,  12534,  13246,  13479,  14191,  14424,  15137,  15369,  16083,  16313,  17029,
+     17257,  17975,  18201,  18923,  19143,  19871,  20085,  20821,  21024,  21772,  21962,  22727,  22895,  23687,  23820,  24659,
+     24729,  25657,  25593,  26741,  26260,  28428,  22996, -25174, -27634, -26659, -26369, -25797, -25397, -24860, -24451, -23913,
+    -23508, -22966, -22566, -22018, -21622, -21071, -20679, -20125, -19735, -19179, -18790, -18233, -17845, -17288, -16900, -16343,
+    -15954, -15398, -15009, -14454, -14063, -13509, -13117, -12565, -12171, -11621, -11225, -10677, -10278,  -9733,  -9332,  -8789,
+     -8385,  -7846,  -7438,  -6902,  -6491,  -5959,  -5544,  -5016,  -4597,  -4073,  -3650,  -3130,  -2702,  -2187,  -1755,  -1244,
+      -807,   -302,    141,    640,   1089,   1582,   2038,   2524,   2987,   3465,   3936,   4406,   4885,   5347,   5835,   6288,
+      6785,   7228,   7735,   8167,   8686,   9106,   9638,  10045,  10590,  10982,  11544,  11919,  12498,  12854,  13453,  13789,
+     14410,  14721,  15368,  15652,  16329,  16581,  17292,  17506,  18259,  18427,  19231,  19343,  20208,  20252,  21195,  21150,
+     22194,  22032,  23213,  22889,  24266,  23702,  25379,  24426,  26627,  24933,  28263,  24625,  32191,  -5041, -32390, -24248,
+    -28440, -24558, -26806, -24046, -25566, -23312, -24465, -22484, -23433, -21600, -22449, -20669, -21522, -19655, -20746, -18241,
+    -23580, -27883, -25629, -25481, -23953, -23472, -22138, -21530, -20285, -19611, -18416, -17704, -16539, -15804, -14656, -13907,
+    -12771, -12014, -10883, -10122,  -8993,  -8232,  -7101,  -6344,  -5208,  -4458,  -3313,  -2572,  -1417,   -688,    481,   1194,
+      2380,   3074,   4281,   4952,   6185,   6828,   8092,   8700,  10002,  10568,  11918,  12430,  13840,  14283,  15773,  16124,
+     17722,  17945,  19697,  19730,  21720,  21446,  23849,  22991,  26285,  23891,  30523,  12564, -30565, -24341, -26745, -23355,
+    -24341, -21795, -22221, -20073, -20202, -18285, -18229, -16463, -16281, -14621, -14349, -12767, -12427, -10905, -10512,  -9037,
+     -8602,  -7164,  -6695,  -5288,  -4792,  -3410,  -2891,  -1529,   -992,    353,    906,   2237,   2801,   4123,   4696,   6010,
+      6588,   7899,   8479,   9789,  10369,  11682,  12256,  13576,  14140,  15475,  16020,  17378,  17894,  19289,  19757,  21216,
+     21598,  23176,  23383,  25241,  24937,  27992,  22111, -25343, -26807, -25462, -24732, -23558, -22915, -21543, -21246, -19136,
+    -23933, -26651, -23927, -22530, -20230, -18733, -16444, -14966, -12648, -11200,  -8853,  -7432,  -5063,  -3658,  -1277,    120,
+      2503,   3904,   6276,   7697,  10040,  11501,  13789,  15324,  17512,  19184,  21181,  23122,  24766,  26467, -18567, -27936,
+    -21878, -22818, -18639, -18753, -15029, -14862, -11322, -11032,  -7574,  -7231,  -3804,  -3448,    -17,    318,   3786,   4068,
+      7608,   7795,  11457,  11487,  15355,  15109,  19357,  18562,  23666,  21367,  29798,  11626, -29670, -22816, -24091, -19453,
+    -22608, -27116, -25593, -21252, -19556, -19424, -17309, -14003, -12303, -11636,  -9602,  -6594,  -4796,  -3981,  -2051,    926,
+      2833,   3568,   5380,   8566,  10605,  10955,  12608,  16468,  18717,  17816,  19155,  25817,  28611,  15468,  -9558, -27530,
+    -27821, -19922, -17206, -19136, -17697, -12856, -10706, -11327,  -9567,  -5404,  -3486,  -3749,  -1791,   2217,   3942,   3674,
+      5841,  10016,  11488,  10851,  13359,  18220,  19163,  17207,  20746,  28705,  26258,   5624, -19166, -28951, -23761, -19087,
+    -27865, -24490, -21092, -19140, -18849, -19295, -19103, -17316, -13957,  -9984,  -6694,  -4939,  -4620,  -4748,  -4048,  -1739,
+      1971,   5974,   8909,   9999,   9587,   9030,   9968,  13336,  18657,  24035,  26885,  25095,  18036,   6943,  -5528, -16336,
+    -23205, -25364, -23599, -19672, -15458, -12220, -10309,  -9330,  -8571,  -7443,  -5703,  -3436,   -902,   1624,   3926,   5852,
+      7327,   8417,   9406,  10782,  13054,  16407,  20377,  23739,  24809,  22077,  14954,   4242,  -7950, -18899, -26284, -29074,
+    -26731, -28835, -29046, -27520, -24605, -20777, -16580, -12537,  -9085,  -6507,  -4907,  -4195,  -4118,  -4304,  -4331,  -3805,
+     -2426,    -45,   3299,   7382,  11816,  16101,  19697,  22100,  22917,  21926,  19109,  14665,   8982,   2593,  -3896,  -9881,
+    -14838, -18384, -20318, -20636, -19520, -17291, -14360, -11154,  -8055,  -5339,  -3151,  -1487,   -213,    894,   2096,   3631,
+      5656,   8207,  11171,  14295,  17210,  19486,  20693,  20471,  18593,  15010,   9874,   3529,  -3520, -10669, -17285, -22791,
+    -16866, -19633, -21829, -23373, -24205, -24294, -23636, -22254, -20197, -17540, -14380, -10831,  -7023,  -3094,    815,   4563,
+      8016,  11052,  13567,  15474,  16713,  17247,  17068,  16195,  14671,  12567,   9974,   7002,   3773,    421,  -2919,  -6110,
+     -9026, -11549, -13580, -15036, -15862, -16025, -15520, -14369, -12620, -10343,  -7633,  -4599,  -1366,   1935,   5166,   8194,
+     10892,  13146,  14858,  15951,  16370,  16088,  15105,  13445,  11162,   8332,   5054,   1444,  -2369,  -6246, -10046, -13630,
+     -5666,  -5788,  -5871,  -5914,  -5918,  -5881,  -5804,  -5688,  -5534,  -5344,  -5119,  -4862,  -4575,  -4260,  -3921,  -3561,
+     -3184,  -2793,  -2392,  -1984,  -1575,  -1167,   -764,   -371,      9,    372,    714,   1033,   1325,   1587,   1818,   2014,
+      2174,   2296,   2379,   2422,   2426,   2389,   2312,   2196,   2043,   1852,   1627,   1370,   1083,    768,    429,     69,
+      -308,   -699,  -1100,  -1508,  -1917,  -2325,  -2728,  -3121,  -3501,  -3864,  -4206,  -4525,  -4817,  -5079,  -5310,  -5506,
+    
+    // Frame 13
+    -21321, -28683, -26396, -26893, -25739, -25726, -24863, -24664, -23929, -23637, -22971, -22626, -22002, -21623, -21027, -20626,
+    -20048, -19632, -19066, -18640, -18082, -17649, -17097, -16660, -16111, -15671, -15124, -14683, -14137, -13696, -13150, -12708,
+    -12162, -11721, -11174, -10735, -10186,  -9748,  -9197,  -8762,  -8208,  -7775,  -7219,  -6789,  -6230,  -5803,  -5241,  -4818,
+     -4252,  -3832,  -3263,  -2846,  -2273,  -1861,  -1284,   -876,   -294,    109,    696,   1094,   1686,   2079,   2676,   3064,
+      3666,   4048,   4657,   5033,   5648,   6017,   6639,   7001,   7630,   7984,   8622,   8967,   9614,   9950,  10606,  10932,
+     11599,  11914,  12593,  12895,  13587,  13875,  14582,  14854,  15579,  15832,  16577,  16809,  17576,  17783,  18578,  18754,
+     19583,  19722,  20593,  20684,  21610,  21638,  22637,  22578,  23681,  23495,  24758,  24366,  25906,  25119,  27266,  25426,
+     29882,  17843, -28771, -26174, -27442, -25611, -26179, -24810, -25057, -23924, -23991, -22999, -22952, -22055, -21928, -21099,
+    -20913, -20135, -19904, -19167, -18899, -18195, -17898, -17221, -16898, -16244, -15900, -15266, -14904, -14287, -13909, -13307,
+    -12914, -12327, -11920, -11345, -10927, -10364,  -9934,  -9381,  -8941,  -8399,  -7949,  -7416,  -6956,  -6433,  -5965,  -5450,
+     -4973,  -4467,  -3981,  -3483,  -2990,  -2500,  -1998,  -1516,  -1007,   -533,    -15,    451,    976,   1434,   1968,   2418,
+      2959,   3401,   3951,   4384,   4943,   5367,   5935,   6350,   6927,   7333,   7920,   8315,   8912,   9297,   9906,  10278,
+     10899,  11259,  11894,  12240,  12889,  13219,  13885,  14198,  14882,  15175,  15880,  16151,  16880,  17125,  17882,  18096,
+     18888,  19064,  19897,  20027,  20912,  20983,  21935,  21929,  22971,  22859,  24028,  23761,  25124,  24607,  26303,  25321,
+     27710,  25590,  30039, -14913, -30670, -25055, -27631, -24929, -26171, -24239, -24981, -23398, -23883, -22495, -22829, -21560,
+    -21800, -20606, -20787, -19637, -19787, -18655, -18801, -17660, -17830, -16644, -16886, -15589, -16004, -14428, -15344, -12640,
+    -21121, -28174, -25420, -25405, -23766, -23260, -21894, -21218, -19965, -19210, -18014, -17218, -16051, -15234, -14083, -13255,
+    -12110, -11279, -10135,  -9305,  -8158,  -7333,  -6180,  -5362,  -4200,  -3392,  -2220,  -1423,   -238,    544,   1746,   2510,
+      3730,   4475,   5716,   6437,   7705,   8398,   9695,  10355,  11690,  12309,  13689,  14257,  15694,  16197,  17710,  18123,
+     19743,  20028,  21806,  21890,  23932,  23653,  26222,  25125,  28806, -17035, -29394, -24258, -25680, -23012, -23304, -21290,
+    -21155, -19444, -19081, -17547, -17043, -15625, -15023, -13688, -13014, -11744, -11012,  -9793,  -9015,  -7839,  -7021,  -5882,
+     -5029,  -3923,  -3039,  -1963,  -1049,     -2,    940,   1960,   2928,   3921,   4917,   5881,   6907,   7840,   8899,   9798,
+     10892,  11753,  12889,  13703,  14892,  15647,  16903,  17579,  18929,  19491,  20984,  21361,  23104,  23124,  25418,  24473,
+     28905,  18480, -28193, -25392, -26188, -23739, -24000, -21901, -21940, -19972, -19952, -17974, -18047, -15853, -16377, -13095,
+    -21807, -26426, -24178, -21728, -20518, -17629, -16658, -13619, -12752,  -9634,  -8832,  -5656,  -4909,  -1679,   -988,   2303,
+      2926,   6294,   6827,  10302,  10706,  14343,  14536,  18458,  18246,  22790,  21495,  28419,  16561, -27538, -24052, -23122,
+    -20559, -18883, -16801, -14798, -12950, -10774,  -9056,  -6781,  -5139,  -2807,  -1206,   1153,   2741,   5099,   6702,   9029,
+     10682,  12936,  14693,  16799,  18768,  20562,  23013,  24014,  27651, -15674, -28910, -21142, -23300, -17744, -19290, -13228,
+    -19566, -24905, -26410, -22161, -18453, -18325, -17419, -13755, -11147, -10777,  -9085,  -5565,  -3620,  -3137,   -829,   2584,
+      3907,   4507,   7498,  10763,  11270,  12078,  16155,  19086,  17908,  19381,  26883,  27638,   9316, -17184, -29531, -24383,
+    -17838, -18448, -18955, -14644, -11176, -11404, -10297,  -6197,  -3825,  -3929,  -1947,   2082,   3666,   3591,   6364,  10405,
+     11105,  10966,  14853,  19042,  18104,  17641,  24628,  29639,  17021,  -9008, -26925, -26993, -20324, -17814, -17689, -17138,
+    -18133, -19554, -21897, -23621, -23464, -21062, -17085, -12842,  -9604,  -7970,  -7622,  -7560,  -6670,  -4344,   -793,   3068,
+      6131,   7702,   7917,   7714,   8379,  10871,  15238,  20422,  24553,  25641,  22370,  14676,   3867,  -7758, -17660, -23877,
+    -25619, -23424, -18851, -13835,  -9969,  -7979,  -7583,  -7766,  -7328,  -5476,  -2191,   1781,   5315,   7496,   8110,   7822,
+      7895,   9563,  13339,  18579,  23558,  26068,  24319,  17755,   7406,  -4403, -14891, -21863, -24498, -23552, -20901, -18633,
+    -27865, -26959, -24868, -21962, -18668, -15405, -12529, -10282,  -8762,  -7917,  -7555,  -7387,  -7075,  -6292,  -4779,  -2399,
+       840,   4770,   9083,  13365,  17152,  19993,  21509,  21450,  19732,  16448,  11863,   6380,    492,  -5280, -10447, -14611,
+    -17503, -19007, -19159, -18129, -16181, -13629, -10784,  -7910,  -5193,  -2722,   -495,   1564,   3570,   5639,   7847,  10198,
+     12607,  14898,  16820,  18083,  18396,  17525,  15326,  11791,   7055,   1399,  -4779, -11004, -16777, -21641, -25232, -27327,
+    -22552, -24361, -25486, -25885, -25542, -24469, -22705, -20312, -17376, -14002, -10312,  -6436,  -2512,   1321,   4928,   8187,
+     10986,  13232,  14855,  15809,  16073,  15652,  14578,  12908,  10720,   8113,   5199,   2103,  -1044,  -4113,  -6975,  -9515,
+    -11628, -13228, -14251, -14657, -14429, -13579, -12142, -10177,  -7768,  -5013,  -2027,   1063,   4129,   7041,   9672,  11909,
+     13649,  14812,  15337,  15187,  14353,  12851,  10724,   8036,   4879,   1357,  -2405,  -6276, -10118, -13794, -17171, -20126,
+     -7849,  -7953,  -8004,  -8000,  -7943,  -7832,  -7668,  -7454,  -7191,  -6881,  -6528,  -6136,  -5707,  -5246,  -4758,  -4247,
+     -3718,  -3176,  -2627,  -2075,  -1526,   -986,   -459,     49,    534,    991,   1416,   1803,   2151,   2454,   2711,   2919,
+      3076,   3180,   3231,   3228,   3170,   3059,   2896,   2681,   2418,   2109,   1756,   1363,    935,    474,    -14,   -525,
+     -1054,  -1596,  -2146,  -2697,  -3246,  -3787,  -4314,  -4822,  -5307,  -5764,  -6188,  -6576,  -6923,  -7227,  -7484,  -7692,
+    
+    // Frame 14
+    -18690, -29233, -26006, -27091, -25439, -25807, -24570, -24667, -23620, -23577, -22637, -22509, -21638, -21454, -20630, -20406,
+    -19615, -19363, -18597, -18323, -17576, -17285, -16553, -16249, -15529, -15215, -14503, -14181, -13477, -13149, -12449, -12117,
+    -11421, -11085, -10393, -10054,  -9364,  -9024,  -8335,  -7994,  -7305,  -6964,  -6275,  -5934,  -5245,  -4905,  -4215,  -3876,
+     -3184,  -2847,  -2153,  -1819,  -1122,   -790,    -91,    238,    941,   1266,   1973,   2293,   3005,   3320,   4038,   4347,
+      5071,   5374,   6104,   6400,   7138,   7426,   8172,   8451,   9206,   9475,  10242,  10500,  11278,  11523,  12314,  12545,
+     13352,  13566,  14391,  14586,  15431,  15605,  16474,  16621,  17518,  17635,  18566,  18644,  19618,  19650,  20676,  20648,
+     21742,  21635,  22821,  22607,  23921,  23549,  25061,  24437,  26284,  25192,  27735,  25500,  30108, -14962, -30555, -25065,
+    -27471, -24900, -25965, -24172, -24727, -23294, -23582, -22356, -22478, -21387, -21397, -20401, -20329, -19404, -19271, -18400,
+    -18218, -17390, -17170, -16378, -16124, -15362, -15081, -14344, -14040, -13325, -13001, -12304, -11962, -11283, -10925, -10260,
+     -9888,  -9237,  -8852,  -8213,  -7817,  -7188,  -6782,  -6163,  -5747,  -5138,  -4713,  -4113,  -3679,  -3087,  -2645,  -2061,
+     -1612,  -1035,   -578,     -9,    455,   1018,   1488,   2044,   2521,   3071,   3554,   4097,   4587,   5124,   5620,   6150,
+      6653,   7177,   7687,   8203,   8720,   9229,   9753,  10255,  10787,  11281,  11821,  12306,  12855,  13332,  13890,  14356,
+     14926,  15380,  15962,  16403,  16999,  17424,  18038,  18444,  19079,  19462,  20122,  20476,  21170,  21485,  22225,  22485,
+     23291,  23469,  24379,  24422,  25515,  25294,  26802,  25843,  29015,  20615, -27204, -26734, -27089, -25776, -25956, -24829,
+    -24863, -23848, -23795, -22849, -22740, -21839, -21695, -20822, -20655, -19799, -19620, -18773, -18589, -17742, -17562, -16708,
+    -16538, -15670, -15520, -14625, -14508, -13573, -13507, -12508, -12522, -11419, -11571, -10281, -10700,  -8998, -10133,  -6855,
+    -18784, -28325, -25366, -25159, -23763, -22852, -21857, -20688, -19873, -18572, -17858, -16477, -15827, -14393, -13788, -12315,
+    -11744, -10242,  -9697,  -8170,  -7649,  -6101,  -5599,  -4032,  -3548,  -1963,  -1498,    106,    553,   2175,   2602,   4245,
+      4651,   6316,   6698,   8389,   8743,  10465,  10785,  12545,  12821,  14631,  14851,  16726,  16868,  18837,  18864,  20977,
+     20817,  23184,  22662,  25586,  24091,  29163,  18176, -27842, -25621, -25740, -23900, -23448, -22001, -21272, -20028, -19145,
+    -18022, -17042, -15998, -14953, -13964, -12872, -11922, -10797,  -9876,  -8726,  -7826,  -6658,  -5774,  -4592,  -3718,  -2529,
+     -1661,   -468,    398,   1591,   2459,   3648,   4522,   5702,   6588,   7754,   8658,   9802,  10731,  11846,  12809,  13883,
+     14895,  15911,  16993,  17924,  19110,  19911,  21263,  21847,  23492,  23663,  25928,  25084,  29083, -15221, -30074, -23622,
+    -26081, -22364, -23591, -20566, -21362, -18619, -19229, -16603, -17153, -14535, -15130, -12401, -13201, -10111, -11585,  -6954,
+    -18025, -27880, -22739, -22625, -19097, -18244, -15141, -14016, -11097,  -9846,  -7011,  -5708,  -2898,  -1593,   1236,   2499,
+      5396,   6564,   9589,  10584,  13840,  14524,  18211,  18269,  22931,  21287,  29686,   9621, -30418, -21862, -23853, -18804,
+    -19149, -15051, -14783, -11107, -10535,  -7083,  -6345,  -3015,  -2190,   1082,   1938,   5204,   6042,   9353,  10114,  13542,
+     14133,  17807,  18033,  22283,  21492,  27984,  17319, -27220, -24024, -22866, -20351, -18396, -16554, -13909, -12981,  -8613,
+    -19857, -24989, -24074, -21926, -20250, -17562, -14900, -13793, -12343,  -9112,  -6507,  -5804,  -4191,   -592,   1790,   2105,
+      3999,   8054,  10077,   9804,  12180,  17084,  18382,  16685,  20403,  28433,  25571,   4461, -19893, -28779, -23317, -17789,
+    -17729, -17445, -13992, -10919,  -9873,  -8393,  -5610,  -3253,  -1655,    300,   2556,   4586,   6753,   8925,  10492,  12410,
+     15524,  17663,  17699,  19967,  26326,  26725,  10078, -15860, -29899, -25183, -16801, -17169, -19648, -14860,  -8519, -11005,
+    -17461, -21697, -24286, -24327, -21997, -18305, -14543, -11692, -10058,  -9253,  -8494,  -7038,  -4562,  -1308,   2053,   4767,
+      6395,   7072,   7500,   8646,  11256,  15386,  20168,  23957,  24872,  21536,  13739,   2704,  -9182, -19139, -24962, -25816,
+    -22483, -16973, -11642,  -8214,  -7133,  -7544,  -7879,  -6743,  -3658,    710,   4948,   7704,   8476,   7943,   7656,   9194,
+     13229,  18959,  24259,  26505,  23742,  15631,   3752,  -8918, -19125, -24577, -24765, -21038, -15927, -12059, -11118, -13307,
+    -22186, -20489, -18528, -16574, -14847, -13489, -12544, -11955, -11573, -11186, -10551,  -9439,  -7673,  -5162,  -1925,   1904,
+      6082,  10285,  14142,  17283,  19379,  20187,  19582,  17570,  14291,  10006,   5062,   -143,  -5201,  -9741, -13461, -16152,
+    -17713, -18143, -17531, -16034, -13842, -11158,  -8169,  -5031,  -1862,   1257,   4271,   7135,   9801,  12201,  14240,  15799,
+     16738,  16916,  16215,  14559,  11938,   8421,   4163,   -604,  -5584, -10454, -14887, -18595, -21363, -23067, -23694, -23338,
+    -24754, -25587, -25726, -25165, -23924, -22047, -19601, -16672, -13364,  -9794,  -6088,  -2375,   1216,   4563,   7553,  10087,
+     12086,  13491,  14266,  14399,  13904,  12816,  11194,   9119,   6685,   4002,   1185,  -1644,  -4365,  -6864,  -9036, -10791,
+    -12057, -12781, -12934, -12511, -11530, -10032,  -8080,  -5756,  -3159,   -398,   2408,   5140,   7678,   9908,  11731,  13058,
+     13821,  13973,  13490,  12373,  10647,   8360,   5582,   2405,  -1066,  -4713,  -8409, -12025, -15432, -18511, -21151, -23257,
+     -9075,  -9129,  -9122,  -9053,  -8923,  -8734,  -8486,  -8184,  -7828,  -7424,  -6974,  -6483,  -5957,  -5399,  -4815,  -4211,
+     -3593,  -2967,  -2338,  -1713,  -1098,   -498,     80,    631,   1150,   1631,   2071,   2464,   2808,   3098,   3332,   3507,
+      3623,   3677,   3670,   3601,   3471,   3282,   3035,   2732,   2376,   1972,   1522,   1032,    505,    -53,   -637,  -1241,
+     -1859,  -2485,  -3114,  -3739,  -4354,  -4954,  -5532,  -6083,  -6602,  -7083,  -7523,  -7916,  -8259,  -8549,  -8783,  -8959,
+    
+    // Frame 15
+    -16336, -29511, -25885, -27022, -25403, -25627, -24535, -24414, -23564, -23265, -22553, -22144, -21520, -21039, -20476, -19943,
+    -19424, -18854, -18368, -17768, -17308, -16685, -16245, -15604, -15181, -14524, -14116, -13446, -13049, -12369, -11982, -11292,
+    -10914, -10216,  -9846,  -9141,  -8777,  -8066,  -7707,  -6991,  -6638,  -5916,  -5568,  -4842,  -4498,  -3767,  -3428,  -2693,
+     -2358,  -1619,  -1288,   -545,   -218,    529,    853,   1603,   1923,   2677,   2993,   3751,   4063,   4825,   5133,   5899,
+      6203,   6974,   7273,   8048,   8343,   9123,   9412,  10198,  10481,  11274,  11550,  12349,  12618,  13426,  13685,  14503,
+     14752,  15581,  15818,  16660,  16882,  17740,  17945,  18823,  19005,  19909,  20062,  20999,  21113,  22095,  22156,  23204,
+     23183,  24334,  24177,  25514,  25091,  26843,  25682,  29099,  20496, -27077, -26812, -26919, -25813, -25742, -24826, -24604,
+    -23805, -23491, -22766, -22392, -21717, -21301, -20661, -20214, -19601, -19131, -18538, -18051, -17474, -16972, -16407, -15895,
+    -15340, -14818, -14272, -13743, -13203, -12668, -12133, -11594, -11062, -10520,  -9992,  -9447,  -8920,  -8374,  -7849,  -7302,
+     -6777,  -6230,  -5705,  -5158,  -4632,  -4086,  -3559,  -3015,  -2486,  -1944,  -1412,   -874,   -339,    197,    736,   1267,
+      1810,   2336,   2885,   3405,   3960,   4474,   5036,   5542,   6112,   6610,   7189,   7677,   8267,   8743,   9346,   9808,
+     10425,  10872,  11505,  11936,  12587,  12997,  13671,  14057,  14756,  15115,  15844,  16169,  16935,  17220,  18031,  18266,
+     19132,  19305,  20242,  20335,  21363,  21349,  22503,  22341,  23674,  23291,  24901,  24160,  26250,  24831,  27953,  24766,
+     31671,  -8411, -31915, -24285, -28077, -24375, -26365, -23708, -25014, -22839, -23788, -21887, -22619, -20894, -21481, -19877,
+    -20363, -18844, -19257, -17801, -18160, -16750, -17070, -15693, -15986, -14630, -14906, -13563, -13831, -12492, -12761, -11416,
+    -11695, -10334, -10636,  -9245,  -9586,  -8145,  -8549,  -7029,  -7533,  -5883,  -6560,  -4673,  -5690,  -3279,  -5207,   -791,
+    -15944, -28969, -24829, -25389, -23291, -22906, -21366, -20606, -19339, -18370, -17269, -16163, -15179, -13972, -13077, -11789,
+    -10968,  -9612,  -8854,  -7439,  -6738,  -5268,  -4620,  -3098,  -2501,   -928,   -383,   1242,   1735,   3414,   3851,   5588,
+      5964,   7765,   8074,   9946,  10177,  12135,  12272,  14334,  14354,  16550,  16415,  18794,  18437,  21090,  20386,  23499,
+     22150,  26239,  23221,  30919,  10685, -30650, -24161, -26243, -23033, -23525, -21259, -21122, -19307, -18829, -17282, -16587,
+    -15220, -14372, -13137, -12174, -11041,  -9986,  -8936,  -7806,  -6825,  -5630,  -4710,  -3458,  -2593,  -1288,   -473,    880,
+      1648,   3047,   3769,   5214,   5891,   7381,   8012,   9549,  10131,  11720,  12248,  13893,  14360,  16073,  16465,  18262,
+     18556,  20471,  20618,  22724,  22608,  25111,  24306,  28345,  20704, -26084, -26361, -25198, -24214, -22974, -22149, -20758,
+    -20069, -18555, -17982, -16355, -15893, -14152, -13813, -11937, -11750,  -9696,  -9727,  -7393,  -7805,  -4907,  -6268,  -1326,
+    -15555, -28048, -22575, -22246, -18965, -17549, -14963, -13039, -10858,  -8591,  -6714,  -4167,  -2556,    251,   1600,   4679,
+      5739,   9131,   9841,  13641,  13858,  18280,  17661,  23305,  20653,  30621,   5143, -30465, -21684, -23182, -18687, -18157,
+    -14885, -13514, -10873,  -8999,  -6779,  -4537,  -2650,    -97,   1491,   4341,   5624,   8795,   9729,  13293,  13766,  17901,
+     17623,  22833,  20797,  29673,  10709, -29503, -22522, -22947, -19319, -17986, -15528, -13270, -11667,  -8477,  -8121,  -2635,
+    -14409, -24215, -26908, -21872, -17293, -17158, -16821, -13009,  -9345,  -8701,  -7930,  -4364,   -909,   -168,    660,   4243,
+      7784,   8386,   8951,  12845,  16928,  16908,  16365,  21647,  28484,  23517,   2607, -20336, -28920, -23347, -16823, -16559,
+    -17384, -13926,  -9383,  -8284,  -8276,  -5219,  -1040,    241,    341,   3362,   7663,   8851,   8599,  11869,  16854,  17539,
+     15969,  20328,  28394,  25424,   4966, -18823, -28325, -23738, -17901, -16882, -16547, -13985, -11101,  -8568,  -5917,  -6674,
+    -16129, -19864, -22275, -22819, -21441, -18595, -15110, -11883,  -9516,  -8060,  -7017,  -5646,  -3406,   -313,   3031,   5782,
+      7396,   8058,   8688,  10464,  14044,  18944,  23434,  25140,  22112,  13874,   1892, -10828, -20887, -25865, -25279, -20653,
+    -14687,  -9950,  -7745,  -7695,  -8220,  -7574,  -4880,   -590,   3854,   6926,   7962,   7600,   7442,   9128,  13298,  19038,
+     24114,  25915,  22652,  14235,   2411,  -9883, -19633, -24824, -25037, -21377, -15877, -10681,  -7383,  -6695,  -8475, -11970,
+    -15189, -14537, -14188, -14155, -14374, -14711, -14987, -14994, -14530, -13428, -11581,  -8959,  -5625,  -1728,   2503,   6785,
+     10806,  14255,  16856,  18397,  18746,  17866,  15818,  12751,   8891,   4511,    -85,  -4593,  -8731, -12258, -14986, -16789,
+    -17602, -17419, -16287, -14295, -11566,  -8253,  -4526,   -571,   3418,   7242,  10704,  13617,  15811,  17148,  17528,  16906,
+     15292,  12766,   9466,   5590,   1375,  -2916,  -7020, -10697, -13752, -16055, -17552, -18269, -18303, -17814, -16996, -16058,
+    -24128, -24147, -23536, -22316, -20532, -18246, -15538, -12504,  -9250,  -5889,  -2537,    691,   3687,   6353,   8602,  10367,
+     11597,  12265,  12362,  11905,  10927,   9486,   7653,   5515,   3170,    723,  -1721,  -4055,  -6178,  -8002,  -9448, -10456,
+    -10983, -11008, -10530,  -9569,  -8165,  -6378,  -4284,  -1973,    457,   2901,   5251,   7402,   9256,  10727,  11739,  12236,
+     12181,  11557,  10370,   8648,   6437,   3805,    836,  -2372,  -5711,  -9068, -12326, -15372, -18099, -20411, -22226, -23480,
+     -9405,  -9402,  -9336,  -9207,  -9017,  -8767,  -8460,  -8099,  -7687,  -7228,  -6727,  -6189,  -5618,  -5020,  -4402,  -3768,
+     -3125,  -2480,  -1837,  -1205,   -588,      7,    575,   1110,   1608,   2062,   2469,   2825,   3127,   3371,   3556,   3679,
+      3739,   3736,   3669,   3541,   3350,   3100,   2793,   2432,   2020,   1562,   1061,    522,    -49,   -646,  -1265,  -1899,
+     -2541,  -3187,  -3829,  -4462,  -5079,  -5674,  -6242,  -6777,  -7274,  -7728,  -8136,  -8492,  -8793,  -9038,  -9222,  -9345,
+    
+    // Frame 16
+    -13771, -29998, -25555, -27162, -25158, -25654, -24293, -24368, -23303, -23159, -22263, -21985, -21197, -20830, -20117, -19686,
+    -19028, -18550, -17933, -17418, -16833, -16290, -15731, -15165, -14626, -14042, -13520, -12920, -12412, -11799, -11304, -10679,
+    -10194,  -9560,  -9084,  -8442,  -7973,  -7324,  -6862,  -6206,  -5751,  -5089,  -4639,  -3973,  -3526,  -2856,  -2414,  -1740,
+     -1301,   -623,   -189,    493,    924,   1609,   2037,   2724,   3150,   3840,   4264,   4956,   5377,   6072,   6490,   7187,
+      7603,   8303,   8716,   9419,   9830,  10534,  10943,  11650,  12055,  12767,  13168,  13883,  14280,  15000,  15392,  16117,
+     16504,  17234,  17615,  18353,  18725,  19473,  19833,  20594,  20939,  21719,  22040,  22850,  23134,  23991,  24212,  25159,
+     25244,  26413,  26079,  28270,  22984, -25162, -27477, -26477, -26043, -25445, -24903, -24338, -23788, -23222, -22676, -22105,
+    -21565, -20988, -20453, -19871, -19340, -18755, -18227, -17640, -17113, -16524, -15999, -15410, -14885, -14295, -13770, -13181,
+    -12655, -12067, -11540, -10954, -10425,  -9840,  -9309,  -8727,  -8193,  -7614,  -7077,  -6501,  -5961,  -5389,  -4845,  -4277,
+     -3728,  -3165,  -2611,  -2053,  -1494,   -941,   -376,    170,    742,   1281,   1860,   2391,   2979,   3501,   4098,   4610,
+      5218,   5719,   6338,   6827,   7459,   7935,   8581,   9041,   9704,  10146,  10828,  11251,  11954,  12353,  13081,  13454,
+     14211,  14552,  15343,  15647,  16479,  16738,  17619,  17823,  18766,  18901,  19922,  19968,  21091,  21020,  22279,  22046,
+     23501,  23027,  24785,  23919,  26203,  24595,  28010,  24454,  32109,  -5045, -32300, -24085, -28177, -24231, -26368, -23556,
+    -24951, -22663, -23668, -21680, -22448, -20653, -21261, -19599, -20095, -18529, -18942, -17448, -17798, -16359, -16661, -15264,
+    -15530, -14165, -14403, -13061, -13280, -11953, -12160, -10843, -11043,  -9729,  -9930,  -8612,  -8820,  -7491,  -7714,  -6365,
+     -6614,  -5234,  -5520,  -4094,  -4436,  -2942,  -3367,  -1771,  -2325,   -564,  -1333,    720,   -466,   2227,    -68,   5062,
+    -13361, -29372, -24520, -25404, -23023, -22768, -21056, -20355, -18964, -18018, -16823, -15717, -14655, -13434, -12474, -11163,
+    -10284,  -8898,  -8089,  -6637,  -5891,  -4379,  -3690,  -2122,  -1489,    134,    712,   2391,   2912,   4650,   5111,   6911,
+      7305,   9176,   9495,  11448,  11677,  13729,  13847,  16025,  15997,  18347,  18113,  20718,  20159,  23193,  22034,  25976,
+     23266,  30560,  12270, -30182, -24305, -26016, -22987, -23266, -21096, -20800, -19043, -18435, -16924, -16116, -14771, -13822,
+    -12599, -11543, -10414,  -9274,  -8222,  -7012,  -6024,  -4754,  -3822,  -2499,  -1618,   -247,    588,   2004,   2796,   4254,
+      5004,   6504,   7212,   8754,   9419,  11005,  11625,  13258,  13828,  15515,  16026,  17779,  18214,  20056,  20382,  22366,
+     22495,  24779,  24380,  27875,  21887, -25120, -26689, -24908, -24260, -22695, -22053, -20434, -19858, -18171, -17665, -15906,
+    -15473, -13638, -13285, -11364, -11105,  -9081,  -8939,  -6778,  -6798,  -4442,  -4707,  -2028,  -2740,    608,  -1243,   4576,
+    -12609, -28764, -21790, -22560, -18065, -17699, -13860, -13071,  -9520,  -8531,  -5119,  -4038,   -678,    419,   3798,   4839,
+      8317,   9207,  12902,  13484,  17622,  17546,  22725,  20807,  30079,   6356, -30726, -21130, -23426, -17857, -18329, -13791,
+    -13613,  -9509,  -9034,  -5135,  -4522,   -706,    -57,   3764,   4369,   8277,   8744,  12850,  13039,  17541,  17150,  22553,
+     20597,  29411,  11466, -29286, -22441, -22784, -18952, -17750, -14897, -12973, -10727,  -8221,  -6613,  -3293,  -2935,   2940,
+    -13026, -24040, -26124, -21464, -17641, -16928, -15651, -12185,  -9297,  -8226,  -6473,  -3064,   -507,    445,   2496,   6173,
+      8398,   8902,  11397,  15806,  17324,  16521,  20433,  27818,  24531,   3396, -20895, -29073, -22243, -16272, -17141, -17078,
+    -12297,  -8636,  -8712,  -7471,  -3038,   -142,   -114,   1713,   6232,   8609,   8342,  10711,  15836,  17521,  16035,  19577,
+     27660,  25814,   5866, -18741, -28795, -23376, -16830, -16717, -17203, -13183,  -8775,  -8356,  -8298,  -3765,   1406,  -1394,
+    -11468, -17172, -21989, -24172, -22963, -19007, -14028,  -9910,  -7716,  -7192,  -7047,  -5831,  -2875,   1282,   5258,   7747,
+      8442,   8337,   9169,  12274,  17522,  23003,  25755,  23218,  14676,   1869, -11587, -21748, -26075, -24468, -19096, -13139,
+     -9152,  -7917,  -8350,  -8440,  -6601,  -2650,   2153,   5974,   7628,   7391,   6898,   8142,  12172,  18234,  23901,  26168,
+     22951,  14190,   1987, -10301, -19506, -23899, -23642, -20329, -15955, -11966,  -8861,  -6479,  -4629,  -3587,  -4071,  -6726,
+     -9905, -11052, -12589, -14280, -15850, -17018, -17534, -17202, -15914, -13654, -10505,  -6640,  -2305,   2210,   6592,  10540,
+     13791,  16134,  17432,  17623,  16721,  14809,  12028,   8563,   4627,    453,  -3726,  -7680, -11194, -14075, -16158, -17313,
+    -17454, -16542, -14598, -11705,  -8008,  -3717,    907,   5563,   9929,  13689,  16559,  18311,  18801,  17980,  15908,  12747,
+      8750,   4240,   -426,  -4888,  -8822, -11969, -14167, -15359, -15600, -15044, -13923, -12518, -11120,  -9995,  -9352,  -9313,
+    -21454, -20914, -19855, -18312, -16340, -14008, -11398,  -8600,  -5710,  -2828,    -50,   2532,   4833,   6783,   8322,   9409,
+     10020,  10149,   9809,   9030,   7859,   6357,   4599,   2665,    645,  -1372,  -3297,  -5045,  -6542,  -7722,  -8535,  -8947,
+     -8940,  -8513,  -7685,  -6492,  -4983,  -3224,  -1290,    734,   2760,   4697,   6458,   7959,   9128,   9903,  10239,  10103,
+      9485,   8390,   6843,   4885,   2576,    -14,  -2799,  -5687,  -8582, -11385, -13999, -16334, -18308, -19852, -20913, -21453,
+     -8979,  -8923,  -8807,  -8632,  -8400,  -8114,  -7776,  -7389,  -6957,  -6485,  -5976,  -5436,  -4869,  -4282,  -3680,  -3069,
+     -2454,  -1842,  -1239,   -650,    -80,    464,    977,   1454,   1892,   2284,   2629,   2922,   3161,   3343,   3467,   3531,
+      3535,   3479,   3363,   3188,   2956,   2670,   2332,   1945,   1513,   1041,    532,     -8,   -575,  -1162,  -1764,  -2375,
+     -2990,  -3602,  -4205,  -4794,  -5364,  -5907,  -6421,  -6898,  -7336,  -7728,  -8073,  -8366,  -8605,  -8787,  -8911,  -8975,
+    
+    // Frame 17
+    -11001, -30689, -25023, -27504, -24713, -25881, -23852, -24520, -22844, -23250, -21777, -22021, -20680, -20814, -19565, -19621,
+    -18439, -18437, -17307, -17259, -16169, -16086, -15027, -14915, -13883, -13748, -12736, -12582, -11587, -11417, -10438, -10254,
+     -9286,  -9092,  -8134,  -7931,  -6981,  -6771,  -5827,  -5612,  -4673,  -4453,  -3518,  -3295,  -2362,  -2138,  -1206,   -981,
+       -49,    176,   1108,   1331,   2266,   2487,   3425,   3641,   4584,   4795,   5744,   5949,   6905,   7101,   8066,   8253,
+      9229,   9403,  10392,  10553,  11557,  11701,  12723,  12847,  13891,  13992,  15062,  15133,  16235,  16272,  17412,  17406,
+     18595,  18533,  19784,  19653,  20984,  20759,  22201,  21845,  23443,  22895,  24735,  23875,  26133,  24685,  27831,  24882,
+     31093, -11852, -31125, -24626, -27527, -24499, -25803, -23701, -24399, -22726, -23104, -21678, -21859, -20593, -20642, -19488,
+    -19441, -18369, -18250, -17242, -17067, -16109, -15889, -14971, -14715, -13830, -13544, -12687, -12375, -11541, -11208, -10394,
+    -10043,  -9245,  -8878,  -8096,  -7715,  -6945,  -6552,  -5794,  -5390,  -4642,  -4229,  -3489,  -3068,  -2336,  -1908,  -1183,
+      -748,    -29,    411,   1125,   1570,   2280,   2729,   3435,   3887,   4590,   5046,   5745,   6204,   6901,   7361,   8057,
+      8519,   9213,   9676,  10370,  10833,  11526,  11990,  12683,  13146,  13841,  14302,  14998,  15458,  16156,  16613,  17314,
+     17768,  18473,  18923,  19633,  20077,  20792,  21230,  21953,  22383,  23114,  23536,  24274,  24692,  25424,  25873,  26500,
+     27348,  25228, -23072, -28160, -26127, -26259, -25251, -24961, -24178, -23749, -23060, -22563, -21926, -21388, -20785, -20218,
+    -19639, -19052, -18491, -17886, -17342, -16722, -16192, -15559, -15042, -14396, -13892, -13232, -12742, -12069, -11592, -10905,
+    -10442,  -9741,  -9294,  -8575,  -8146,  -7409,  -6999,  -6241,  -5854,  -5072,  -4711,  -3900,  -3571,  -2725,  -2434,  -1546,
+     -1302,   -361,   -178,    832,    936,   2039,   2033,   3269,   3100,   4540,   4107,   5901,   4968,   7524,   5278,  10709,
+    -10844, -29714, -24264, -25371, -22796, -22594, -20776, -20078, -18609, -17653, -16384, -15268, -14130, -12904, -11859, -10554,
+     -9577,  -8212,  -7290,  -5875,  -4998,  -3541,  -2703,  -1210,   -407,   1121,   1890,   3450,   4187,   5780,   6484,   8112,
+      8778,  10446,  11070,  12784,  13356,  15129,  15632,  17487,  17892,  19868,  20116,  22304,  22250,  24905,  24032,  28515,
+     19524, -27037, -25708, -25308, -23558, -22846, -21355, -20450, -19105, -18088, -16830, -15743, -14542, -13408, -12246, -11080,
+     -9945,  -8757,  -7638,  -6438,  -5329,  -4122,  -3016,  -1809,   -701,    501,   1618,   2808,   3940,   5111,   6266,   7410,
+      8597,   9702,  10935,  11986,  13284,  14258,  15647,  16511,  18036,  18730,  20472,  20882,  23007,  22874,  25826,  24292,
+     30060, -12181, -30615, -23075, -25964, -21740, -23117, -19759, -20578, -17606, -18147, -15380, -15768, -13116, -13417, -10828,
+    -11088,  -8522,  -8776,  -6198,  -6482,  -3855,  -4210,  -1485,  -1972,    929,    204,   3437,   2231,   6210,   3703,  10550,
+    -10628, -28466, -22072, -21752, -18346, -16604, -14070, -11715,  -9653,  -6911,  -5183,  -2138,   -696,   2629,   3786,   7411,
+      8240,  12238,  12626,  17174,  16829,  22442,  20331,  29680,   9870, -29539, -22071, -22546, -18516, -17300, -14301, -12373,
+     -9906,  -7556,  -5441,  -2785,   -946,   1966,   3560,   6715,   8060,  11481,  12529,  16299,  16907,  21287,  20916,  27328,
+     18375, -26151, -24192, -21875, -19850, -16994, -15440, -12170, -11006,  -7340,  -6606,  -2439,  -2340,   2716,   1381,   9432,
+     -9359, -24545, -27150, -20293, -16574, -17492, -15554, -10581,  -8485,  -8475,  -5492,  -1149,     87,    618,   4428,   8267,
+      8598,   9698,  14643,  17716,  16351,  18779,  27123,  26209,   5423, -20213, -28862, -21847, -16395, -17455, -16405, -11282,
+     -8648,  -8806,  -6172,  -1634,   -167,    127,   3792,   7931,   8336,   9033,  13972,  17635,  16202,  17616,  26101,  27879,
+      9938, -16224, -28319, -23644, -17429, -16999, -16335, -12496,  -9677,  -8526,  -5867,  -2881,  -1808,    760,   5847,   4415,
+     -8912, -17479, -23586, -25207, -22388, -17068, -11901,  -8791,  -7973,  -8130,  -7416,  -4719,   -372,   4114,   7100,   7983,
+      7690,   8152,  11025,  16407,  22395,  25815,  23820,  15508,   2631, -11024, -21326, -25657, -23987, -18628, -12832,  -9077,
+     -7944,  -8173,  -7756,  -5340,  -1084,   3520,   6719,   7742,   7405,   7653,  10277,  15571,  21784,  25769,  24560,  17025,
+      4666,  -8907, -19603, -24701, -23966, -19463, -14229, -10594,  -9099,  -8564,  -7201,  -4039,    226,   3485,   3421,  -1039,
+     -6828,  -9626, -12585, -15322, -17475, -18739, -18905, -17875, -15672, -12434,  -8393,  -3847,    869,   5418,   9491,  12833,
+     15252,  16637,  16945,  16206,  14503,  11966,   8755,   5054,   1063,  -3010,  -6950, -10541, -13571, -15841, -17177, -17445,
+    -16564, -14527, -11407,  -7369,  -2661,   2391,   7410,  11996,  15761,  18373,  19586,  19272,  17439,  14237,   9943,   4941,
+      -324,  -5386,  -9812, -13245, -15446, -16318, -15912, -14420, -12152,  -9490,  -6849,  -4618,  -3122,  -2577,  -3069,  -4547,
+    -17472, -16650, -15437, -13874, -12017,  -9929,  -7682,  -5354,  -3022,   -766,   1342,   3234,   4850,   6145,   7083,   7643,
+      7821,   7623,   7074,   6209,   5076,   3733,   2244,    679,   -891,  -2396,  -3768,  -4947,  -5882,  -6532,  -6868,  -6876,
+     -6554,  -5917,  -4992,  -3818,  -2446,   -935,    647,   2231,   3745,   5119,   6288,   7192,   7784,   8025,   7892,   7373,
+      6474,   5213,   3623,   1751,   -346,  -2601,  -4941,  -7288,  -9564, -11690, -13594, -15211, -16484, -17370, -17839, -17873,
+     -7892,  -7800,  -7656,  -7461,  -7219,  -6930,  -6598,  -6225,  -5817,  -5375,  -4906,  -4412,  -3900,  -3373,  -2837,  -2298,
+     -1759,  -1228,   -707,   -204,    278,    734,   1160,   1551,   1903,   2214,   2480,   2699,   2868,   2986,   3052,   3066,
+      3026,   2934,   2790,   2595,   2353,   2064,   1732,   1359,    951,    509,     40,   -454,   -966,  -1493,  -2029,  -2568,
+     -3107,  -3638,  -4159,  -4662,  -5144,  -5600,  -6026,  -6417,  -6769,  -7080,  -7346,  -7565,  -7734,  -7852,  -7918,  -7932,
+    
+    // Frame 18
+     -8532, -31081, -24787, -27552, -24560, -25817, -23700, -24385, -22671, -23056, -21574, -21775, -20442, -20520, -19290, -19280,
+    -18126, -18051, -16954, -16828, -15776, -15610, -14593, -14396, -13408, -13185, -12220, -11976, -11030, -10768,  -9838,  -9562,
+     -8645,  -8358,  -7452,  -7154,  -6257,  -5951,  -5061,  -4749,  -3865,  -3548,  -2667,  -2347,  -1470,  -1147,   -271,     53,
+       927,   1252,   2127,   2451,   3326,   3649,   4527,   4846,   5728,   6043,   6929,   7239,   8132,   8435,   9335,   9630,
+     10539,  10823,  11744,  12016,  12950,  13207,  14157,  14397,  15367,  15584,  16579,  16769,  17795,  17949,  19015,  19124,
+     20242,  20291,  21479,  21444,  22734,  22574,  24021,  23657,  25380,  24623,  26950,  25143,  29777,  17773, -28665, -26032,
+    -27125, -25257, -25651, -24244, -24319, -23145, -23042, -22008, -21792, -20852, -20557, -19683, -19331, -18508, -18111, -17327,
+    -16895, -16143, -15682, -14957, -14472, -13768, -13263, -12579, -12055, -11388, -10848, -10196,  -9642,  -9004,  -8436,  -7811,
+     -7231,  -6617,  -6027,  -5424,  -4822,  -4230,  -3618,  -3036,  -2414,  -1842,  -1210,   -648,     -6,    546,   1199,   1740,
+      2403,   2934,   3607,   4128,   4812,   5321,   6017,   6514,   7223,   7706,   8429,   8898,   9635,  10089,  10843,  11279,
+     12052,  12468,  13262,  13655,  14473,  14841,  15687,  16024,  16904,  17203,  18125,  18377,  19352,  19545,  20587,  20702,
+     21835,  21844,  23104,  22956,  24412,  24014,  25803,  24939,  27423,  25418,  29965, -14874, -30531, -24806, -27279, -24472,
+    -25605, -23572, -24199, -22523, -22886, -21414, -21615, -20274, -20367, -19116, -19133, -17947, -17907, -16771, -16688, -15590,
+    -15474, -14404, -14262, -13216, -13054, -12025, -11848, -10831, -10644,  -9636,  -9442,  -8440,  -8241,  -7242,  -7042,  -6042,
+     -5844,  -4841,  -4648,  -3638,  -3453,  -2433,  -2261,  -1226,  -1071,    -17,    117,   1195,   1301,   2412,   2480,   3633,
+      3654,   4861,   4819,   6100,   5971,   7355,   7104,   8635,   8202,   9963,   9231,  11395,  10092,  13129,  10318,  16659,
+     -7879, -30498, -23574, -25767, -22146, -22838, -20082, -20211, -17850, -17687, -15549, -15212, -13213, -12764, -10856, -10331,
+     -8487,  -7908,  -6109,  -5494,  -3724,  -3085,  -1334,   -681,   1061,   1719,   3460,   4114,   5863,   6505,   8271,   8890,
+     10685,  11269,  13106,  13639,  15539,  15995,  17989,  18329,  20469,  20619,  23014,  22810,  25723,  24709,  28726, -17024,
+    -29054, -23819, -24920, -22148, -22125, -20000, -19555, -17727, -17061, -15405, -14601, -13058, -12160, -10697,  -9729,  -8328,
+     -7305,  -5953,  -4884,  -3575,  -2467,  -1196,    -51,   1185,   2365,   3565,   4782,   5944,   7200,   8321,   9621,  10694,
+     12047,  13061,  14482,  15416,  16932,  17750,  19411,  20042,  21955,  22227,  24694,  23996,  28608,  18422, -28061, -25034,
+    -25624, -22969, -22998, -20727, -20490, -18409, -18031, -16056, -15599, -13684, -13182, -11298, -10777,  -8902,  -8381,  -6497,
+     -5995,  -4082,  -3619,  -1654,  -1258,    791,   1081,   3263,   3385,   5784,   5619,   8409,   7684,  11338,   9113,  16068,
+     -7606, -29265, -21197, -22162, -17345, -16861, -12855, -11864,  -8194,  -6976,  -3459,  -2143,   1321,   2652,   6138,   7407,
+     11000,  12104,  15945,  16673,  21114,  20776,  27585,  16691, -27526, -23077, -22260, -18744, -17166, -14151, -12221,  -9471,
+     -7330,  -4756,  -2460,    -28,   2403,   4699,   7274,   9412,  12169,  14087,  17124,  18663,  22248,  22927,  27771, -15960,
+    -27888, -20654, -21327, -16577, -16158, -11992, -11242,  -7253,  -6440,  -2414,  -1742,   2555,   2768,   7841,   6631,  14937,
+     -8676, -23612, -25610, -20831, -17691, -16106, -13637, -11149,  -9132,  -6335,  -3429,  -1843,     16,   3639,   6541,   7237,
+      9235,  13979,  16566,  15567,  18247,  26409,  26773,   8651, -16569, -28287, -23629, -16846, -16046, -15970, -12315,  -8554,
+     -7159,  -5534,  -2369,    372,   2268,   4678,   7241,   9295,  12024,  15123,  16334,  17564,  23089,  27502,  17376,  -7483,
+    -27275, -27323, -17603, -14803, -17528, -14830,  -8146,  -6531,  -8060,  -4405,   1858,   2385,    628,   6012,  13755,   9105,
+     -8620, -17844, -23171, -23606, -20310, -15684, -11934,  -9948,  -9098,  -7968,  -5479,  -1668,   2362,   5261,   6454,   6656,
+      7509,  10486,  15728,  21573,  25130,  23698,  16263,   4248,  -8955, -19450, -24566, -23934, -19391, -13823,  -9623,  -7620,
+     -7007,  -6203,  -4034,   -493,   3363,   6269,   7735,   8481,   9988,  13381,  18379,  23001,  24355,  20164,  10192,  -3261,
+    -16173, -24580, -26398, -22333, -15381,  -9187,  -6156,  -6338,  -7673,  -7416,  -3926,   2227,   8437,  11434,   9074,   1552,
+     -5091,  -9007, -12776, -15971, -18228, -19288, -19016, -17409, -14590, -10792,  -6320,  -1528,   3225,   7602,  11317,  14149,
+     15953,  16662,  16277,  14864,  12536,   9448,   5785,   1754,  -2420,  -6499, -10240, -13404, -15765, -17128, -17346, -16336,
+    -14099, -10732,  -6429,  -1481,   3747,   8837,  13354,  16893,  19115,  19788,  18817,  16260,  12328,   7369,   1836,  -3760,
+     -8905, -13132, -16079, -17521, -17401, -15831, -13082,  -9546,  -5694,  -2019,   1019,   3050,   3827,   3261,   1421,  -1476,
+    -12811, -11966, -10858,  -9523,  -8010,  -6369,  -4657,  -2930,  -1246,    339,   1777,   3021,   4038,   4798,   5286,   5495,
+      5428,   5102,   4540,   3775,   2849,   1807,    700,   -422,  -1505,  -2503,  -3369,  -4065,  -4560,  -4833,  -4870,  -4670,
+     -4241,  -3601,  -2777,  -1807,   -731,    402,   1542,   2636,   3633,   4485,   5150,   5589,   5775,   5688,   5320,   4673,
+      3758,   2600,   1230,   -311,  -1974,  -3706,  -5450,  -7150,  -8747, -10187, -11423, -12411, -13118, -13519, -13602, -13363,
+     -6252,  -6149,  -6006,  -5825,  -5606,  -5352,  -5066,  -4749,  -4406,  -4040,  -3653,  -3250,  -2835,  -2411,  -1983,  -1555,
+     -1131,   -715,   -311,     77,    445,    790,   1109,   1398,   1654,   1876,   2061,   2207,   2312,   2377,   2400,   2380,
+      2319,   2216,   2074,   1892,   1673,   1419,   1133,    817,    473,    107,   -280,   -683,  -1098,  -1521,  -1949,  -2377,
+     -2801,  -3217,  -3621,  -4009,  -4378,  -4723,  -5041,  -5330,  -5587,  -5809,  -5993,  -6139,  -6245,  -6310,  -6332,  -6313,
+    
+    // Frame 19
+     -6077, -31456, -24572, -27574, -24437, -25721, -23584, -24210, -22541, -22815, -21421, -21475, -20262, -20164, -19081, -18870,
+    -17886, -17588, -16681, -16313, -15470, -15044, -14254, -13779, -13035, -12517, -11813, -11257, -10589,  -9999,  -9364,  -8742,
+     -8137,  -7487,  -6909,  -6232,  -5681,  -4978,  -4452,  -3724,  -3222,  -2471,  -1993,  -1218,   -763,     35,    467,   1288,
+      1697,   2541,   2927,   3794,   4156,   5048,   5385,   6302,   6613,   7557,   7841,   8813,   9067,  10070,  10292,  11329,
+     11515,  12589,  12737,  13852,  13955,  15118,  15170,  16388,  16380,  17664,  17582,  18949,  18776,  20245,  19954,  21560,
+     21109,  22906,  22222,  24308,  23253,  25835,  24083,  27723,  24156,  31737,   8446, -31675, -24568, -27782, -24469, -25904,
+    -23635, -24380, -22601, -22978, -21487, -21633, -20332, -20319, -19153, -19023, -17959, -17739, -16756, -16463, -15546, -15194,
+    -14331, -13928, -13112, -12666, -11890, -11406, -10666, -10148,  -9440,  -8892,  -8213,  -7637,  -6984,  -6383,  -5755,  -5129,
+     -4525,  -3877,  -3295,  -2625,  -2064,  -1373,   -833,   -122,    399,   1129,   1631,   2381,   2862,   3632,   4094,   4883,
+      5326,   6134,   6557,   7386,   7788,   8638,   9018,   9890,  10248,  11144,  11477,  12398,  12705,  13654,  13931,  14911,
+     15156,  16171,  16378,  17434,  17595,  18701,  18808,  19975,  20012,  21260,  21203,  22561,  22371,  23896,  23491,  25301,
+     24495,  26918,  25053,  29792,  17720, -28604, -26046, -27017, -25233, -25497, -24182, -24117, -23045, -22794, -21870, -21497,
+    -20676, -20215, -19470, -18943, -18256, -17676, -17038, -16414, -15816, -15154, -14592, -13896, -13366, -12640, -12139, -11384,
+    -10911, -10130,  -9683,  -8876,  -8454,  -7622,  -7225,  -6368,  -5996,  -5115,  -4766,  -3861,  -3538,  -2606,  -2310,  -1351,
+     -1082,    -96,    145,   1161,   1370,   2419,   2594,   3679,   3816,   4941,   5035,   6206,   6251,   7476,   7462,   8750,
+      8667,  10033,   9862,  11326,  11043,  12638,  12202,  13978,  13322,  15372,  14365,  16883,  15217,  18736,  15353,  22619,
+     -5123, -31067, -23104, -25938, -21727, -22845, -19631, -20096, -17342, -17465, -14975, -14890, -12568, -12345, -10137,  -9819,
+     -7690,  -7306,  -5232,  -4804,  -2764,  -2309,   -290,    178,   2192,   2658,   4682,   5130,   7180,   7593,   9689,  10043,
+     12212,  12475,  14757,  14881,  17336,  17241,  19979,  19510,  22758,  21559,  25933,  22776,  31456,   4280, -31732, -22939,
+    -26224, -21718, -23050, -19670, -20271, -17400, -17629, -15040, -15050, -12634, -12505, -10201,  -9982,  -7751,  -7473,  -5288,
+     -4976,  -2816,  -2486,   -335,     -5,   2152,   2470,   4647,   4936,   7151,   7394,   9664,   9840,  12191,  12269,  14738,
+     14675,  17316,  17039,  19950,  19322,  22707,  21408,  25816,  22756,  30992,   9055, -30884, -23628, -25872, -22248, -22771,
+    -20161, -20012, -17884, -17369, -15529, -14780, -13137, -12218, -10724,  -9672,  -8300,  -7134,  -5870,  -4600,  -3438,  -2066,
+     -1007,    471,   1417,   3017,   3831,   5577,   6224,   8165,   8581,  10805,  10861,  13561,  12952,  16658,  14325,  21790,
+     -5264, -29340, -21091, -21759, -17201, -16213, -12594, -11007,  -7798,  -5918,  -2925,   -882,   1987,   4124,   6923,   9112,
+     11873,  14089,  16828,  19074,  21730,  24311,  24461, -21907, -25455, -21414, -19678, -16770, -14536, -11922,  -9479,  -7035,
+     -4438,  -2147,    610,   2726,   5685,   7559,  10817,  12306,  16081,  16838,  21735,  20549,  29713,   4957, -30927, -20217,
+    -22981, -16483, -17354, -11917, -12134,  -7114,  -7071,  -2193,  -2110,   2827,   2741,   7990,   7382,  13511,  11290,  21080,
+     -4451, -22063, -27519, -21613, -15428, -14826, -15054, -11270,  -6467,  -4991,  -4683,  -1365,   3303,   5060,   5195,   8330,
+     13539,  15419,  14375,  17436,  25483,  27226,  12752, -11099, -26689, -26029, -18067, -14436, -15324, -13882,  -8848,  -5315,
+     -4999,  -3641,    845,   4591,   5080,   6068,  10694,  15070,  15013,  14826,  20852,  28019,  22799,   1956, -20165, -28020,
+    -22398, -15738, -14718, -15038, -11790,  -7039,  -4882,  -4474,  -2038,   2555,   5515,   5568,   6901,  12767,  17995,  12768,
+     -7076, -15664, -20622, -21639, -19802, -16728, -13644, -10940,  -8334,  -5440,  -2272,    679,   2825,   4042,   4959,   6710,
+     10207,  15367,  20774,  24100,  23125,  16896,   6368,  -5814, -16361, -22679, -23860, -20853, -15788, -10858,  -7361,  -5374,
+     -4100,  -2606,   -435,   2247,   4986,   7537,  10124,  13209,  16919,  20514,  22361,  20565,  14019,   3293,  -9198, -19969,
+    -25904, -25650, -20249, -12627,  -6177,  -3119,  -3505,  -5363,  -5902,  -3133,   2963,  10319,  15774,  16638,  12006,   3160,
+     -3629,  -8175, -12347, -15728, -17989, -18913, -18417, -16547, -13469,  -9448,  -4816,     58,   4806,   9084,  12600,  15131,
+     16531,  16736,  15761,  13691,  10680,   6930,   2689,  -1766,  -6142, -10141, -13480, -15904, -17210, -17261, -16004, -13479,
+     -9833,  -5308,   -236,   4986,   9927,  14156,  17286,  19013,  19146,  17639,  14596,  10269,   5038,   -622,  -6193, -11159,
+    -15064, -17558, -18436, -17661, -15365, -11836,  -7488,  -2814,   1665,   5460,   8164,   9494,   9317,   7667,   4731,    827,
+     -7916,  -7262,  -6459,  -5536,  -4524,  -3457,  -2371,  -1301,   -283,    653,   1476,   2163,   2696,   3062,   3256,   3278,
+      3136,   2843,   2419,   1887,   1275,    614,    -65,   -731,  -1351,  -1899,  -2348,  -2679,  -2877,  -2932,  -2842,  -2611,
+     -2247,  -1768,  -1193,   -549,    137,    832,   1506,   2126,   2661,   3085,   3373,   3507,   3474,   3267,   2885,   2335,
+      1630,    789,   -164,  -1200,  -2286,  -3387,  -4467,  -5491,  -6425,  -7236,  -7898,  -8389,  -8691,  -8794,  -8696,  -8400,
+     -4184,  -4096,  -3982,  -3843,  -3680,  -3494,  -3288,  -3063,  -2821,  -2565,  -2298,  -2021,  -1738,  -1452,  -1164,   -878,
+      -596,   -322,    -58,    194,    431,    651,    852,   1031,   1187,   1319,   1426,   1505,   1557,   1582,   1578,   1545,
+      1485,   1398,   1284,   1144,    981,    795,    589,    364,    122,   -133,   -401,   -677,   -960,  -1247,  -1535,  -1821,
+     -2103,  -2377,  -2641,  -2893,  -3130,  -3350,  -3550,  -3730,  -3886,  -4018,  -4125,  -4204,  -4256,  -4280,  -4276,  -4244,
+    
+    // Frame 20
+     -3416, -32042, -24142, -27817, -24087, -25856, -23232, -24276, -22165, -22827, -21012, -21438, -19815, -20081, -18593, -18744,
+    -17355, -17420, -16107, -16105, -14851, -14797, -13590, -13492, -12325, -12192, -11056, -10894,  -9785,  -9599,  -8512,  -8306,
+     -7237,  -7014,  -5961,  -5724,  -4683,  -4435,  -3404,  -3147,  -2124,  -1860,   -843,   -574,    439,    711,   1722,   1995,
+      3006,   3278,   4291,   4561,   5576,   5842,   6863,   7122,   8152,   8400,   9441,   9677,  10732,  10952,  12026,  12225,
+     13321,  13496,  14620,  14763,  15923,  16025,  17231,  17281,  18546,  18528,  19872,  19762,  21215,  20975,  22585,  22152,
+     24005,  23256,  25535,  24182,  27385,  24438,  31108,  11792, -30984, -24814, -27596, -24489, -25772, -23551, -24249, -22443,
+    -22831, -21265, -21462, -20051, -20120, -18817, -18794, -17570, -17478, -16314, -16170, -15052, -14866, -13786, -13567, -12517,
+    -12270, -11245, -10976,  -9971,  -9683,  -8695,  -8392,  -7418,  -7102,  -6140,  -5813,  -4861,  -4525,  -3581,  -3238,  -2300,
+     -1952,  -1019,   -666,    264,    619,   1546,   1903,   2829,   3187,   4113,   4471,   5397,   5754,   6682,   7036,   7968,
+      8318,   9254,   9598,  10541,  10878,  11829,  12158,  13118,  13436,  14408,  14712,  15700,  15986,  16994,  17258,  18291,
+     18526,  19593,  19789,  20902,  21042,  22223,  22280,  23565,  23486,  24957,  24610,  26499,  25412,  28968,  20436, -26995,
+    -26662, -26624, -25453, -25234, -24255, -23883, -23025, -22556, -21776, -21243, -20518, -19938, -19253, -18637, -17984, -17340,
+    -16713, -16045, -15439, -14752, -14165, -13459, -12889, -12168, -11613, -10877, -10337,  -9586,  -9060,  -8295,  -7783,  -7005,
+     -6506,  -5714,  -5229,  -4424,  -3952,  -3133,  -2676,  -1842,  -1400,   -550,   -124,    742,   1151,   2035,   2425,   3328,
+      3699,   4623,   4971,   5919,   6241,   7217,   7510,   8517,   8777,   9819,  10040,  11125,  11300,  12435,  12554,  13752,
+     13801,  15077,  15037,  16415,  16259,  17772,  17455,  19162,  18607,  20611,  19674,  22192,  20528,  24153,  20583,  28378,
+     -2498, -31513, -22751, -25997, -21414, -22752, -19276, -19887, -16926, -17154, -14490, -14480, -12011, -11838,  -9508,  -9214,
+     -6989,  -6603,  -4461,  -4000,  -1926,  -1402,    613,   1192,   3154,   3785,   5697,   6376,   8240,   8969,  10782,  11564,
+     13320,  14163,  15852,  16771,  18372,  19394,  20871,  22050,  23323,  24769,  25723,  26756, -19258, -28541, -23512, -24677,
+    -21477, -21823, -19087, -19135, -16606, -16504, -14088, -13897, -11551, -11306,  -9003,  -8723,  -6447,  -6147,  -3885,  -3577,
+     -1318,  -1011,   1254,   1549,   3831,   4103,   6415,   6651,   9008,   9188,  11611,  11711,  14233,  14213,  16882,  16676,
+     19584,  19064,  22400,  21268,  25546,  22780,  30632,  10684, -30531, -23721, -25719, -22152, -22596, -19936, -19788, -17541,
+    -17092, -15072, -14448, -12565, -11833, -10035,  -9236,  -7489,  -6653,  -4932,  -4081,  -2365,  -1517,    211,   1037,   2796,
+      3581,   5393,   6112,   8005,   8626,  10638,  11113,  13305,  13555,  16033,  15910,  18893,  18051,  22136,  19390,  27651,
+     -1843, -30452, -19989, -22313, -16141, -16442, -11496, -10946,  -6647,  -5571,  -1724,   -240,   3221,   5087,   8153,  10446,
+     13026,  15905,  17728,  21679,  21774,  29194,  -9672, -29506, -19635, -21752, -15632, -15970, -10926, -10523,  -6034,  -5188,
+     -1070,     99,   3925,   5366,   8930,  10633,  13927,  15918,  18891,  21250,  23838,  25701, -19055, -26648, -20534, -20200,
+    -15981, -14715, -11098,  -9376,  -6143,  -4070,  -1180,   1245,   3757,   6608,   8617,  12095,  13268,  17961,  17119,  26098,
+     -1589, -22945, -27953, -20151, -14751, -15642, -14767,  -9409,  -5637,  -5554,  -3950,    989,   4417,   4568,   6268,  11491,
+     15067,  14387,  15551,  22923,  28067,  18309,  -4805, -24270, -27336, -19507, -14280, -14936, -14297,  -9212,  -5018,  -4703,
+     -3621,   1171,   5164,   5345,   6489,  11841,  15883,  14838,  15806,  24011,  28417,  14810, -10690, -26807, -25071, -17512,
+    -15360, -15491, -12131,  -7881,  -6342,  -4826,  -1009,   2105,   3157,   5692,  10163,  12077,  12045,  16569,  23485,  19093,
+     -3193, -12153, -18556, -21598, -21391, -18685, -14508,  -9878,  -5640,  -2368,   -296,    770,   1449,   2643,   5187,   9416,
+     14826,  20042,  23201,  22635,  17597,   8691,  -2213, -12572, -20043, -23265, -22228, -18110, -12700,  -7676,  -4059,  -2021,
+     -1048,   -298,   1026,   3432,   7035,  11547,  16288,  20234,  22162,  20940,  15947,   7480,  -3075, -13477, -21272, -24651,
+    -23150, -17866, -11034,  -5110,  -1752,  -1164,  -2106,  -2566,   -797,   3794,  10290,  16615,  20406,  19983,  15019,   6611,
+     -1716,  -6641, -11106, -14710, -17136, -18177, -17748, -15894, -12778,  -8666,  -3903,   1123,   6007,  10363,  13855,  16218,
+     17277,  16961,  15302,  12436,   8588,   4056,   -807,  -5623, -10015, -13632, -16181, -17444, -17303, -15749, -12885,  -8925,
+     -4178,    975,   6107,  10785,  14601,  17215,  18383,  17982,  16028,  12674,   8202,   3000,  -2473,  -7731, -12300, -15772,
+    -17835, -18311, -17171, -14538, -10676,  -5965,   -863,   4138,   8560,  11984,  14091,  14690,  13736,  11330,   7709,   3219,
+     -3109,  -2809,  -2456,  -2063,  -1642,  -1208,   -775,   -356,     35,    386,    687,    929,   1108,   1219,   1262,   1239,
+      1154,   1014,    827,    605,    358,     98,   -161,   -408,   -630,   -819,   -964,  -1060,  -1101,  -1087,  -1016,   -893,
+      -723,   -513,   -273,    -13,    254,    517,    763,    978,   1153,   1278,   1344,   1345,   1278,   1142,    939,    673,
+       350,    -20,   -427,   -857,  -1298,  -1736,  -2155,  -2543,  -2886,  -3173,  -3395,  -3543,  -3613,  -3603,  -3513,  -3347,
+     -1775,  -1730,  -1674,  -1607,  -1530,  -1445,  -1351,  -1249,  -1141,  -1028,   -911,   -790,   -667,   -544,   -421,   -299,
+      -180,    -65,     45,    149,    246,    335,    415,    485,    546,    595,    633,    660,    674,    676,    666,    645,
+       611,    566,    510,    443,    366,    280,    186,     85,    -23,   -136,   -254,   -374,   -497,   -621,   -744,   -865,
+      -984,  -1099,  -1209,  -1313,  -1410,  -1499,  -1579,  -1650,  -1710,  -1759,  -1797,  -1824,  -1838,  -1840,  -1831,  -1809,
+    
+    // Frame 21
+    -28351, -26537, -27360, -25385, -25882, -24180, -24460, -22932, -23070, -21660, -21698, -20373, -20337, -19077, -18985, -17775,
+    -17637, -16469, -16293, -15159, -14953, -13846, -13614, -12532, -12277, -11216, -10942,  -9898,  -9608,  -8580,  -8274,  -7260,
+     -6942,  -5940,  -5610,  -4620,  -4279,  -3298,  -2949,  -1976,  -1619,   -654,   -290,    669,   1039,   1993,   2368,   3316,
+      3696,   4641,   5023,   5966,   6350,   7291,   7676,   8617,   9002,   9944,  10327,  11271,  11651,  12600,  12974,  13930,
+     14296,  15261,  15615,  16595,  16933,  17931,  18246,  19272,  19554,  20620,  20853,  21980,  22137,  23361,  23388,  24792,
+     24558,  26373,  25406,  28880,  20476, -27044, -26575, -26635, -25320, -25207, -24076, -23818, -22799, -22453, -21503, -21103,
+    -20197, -19760, -18885, -18422, -17569, -17088, -16250, -15756, -14928, -14426, -13605, -13098, -12281, -11771, -10956, -10444,
+     -9629,  -9119,  -8303,  -7794,  -6975,  -6470,  -5647,  -5146,  -4318,  -3824,  -2988,  -2501,  -1658,  -1179,   -328,    142,
+      1004,   1462,   2336,   2782,   3669,   4100,   5003,   5418,   6338,   6735,   7674,   8050,   9011,   9364,  10350,  10676,
+     11692,  11985,  13036,  13292,  14383,  14594,  15735,  15892,  17093,  17183,  18458,  18463,  19836,  19729,  21233,  20971,
+     22660,  22173,  24144,  23293,  25751,  24214,  27712,  24399,  31687,  -8527, -31642, -24151, -27546, -23992, -25575, -23075,
+    -23966, -21957, -22480, -20757, -21052, -19516, -19654, -18251, -18275, -16971, -16908, -15682, -15549, -14386, -14196, -13085,
+    -12847, -11780, -11501, -10472, -10158,  -9162,  -8816,  -7851,  -7476,  -6538,  -6138,  -5224,  -4800,  -3910,  -3463,  -2595,
+     -2126,  -1279,   -790,     37,    546,   1353,   1882,   2669,   3218,   3985,   4555,   5301,   5891,   6616,   7228,   7931,
+      8566,   9245,   9904,  10558,  11244,  11870,  12585,  13180,  13929,  14487,  15275,  15791,  16625,  17090,  17982,  18382,
+     19346,  19664,  20724,  20929,  22123,  22164,  23564,  23340,  25095,  24369,  26892,  24838,  30259,  15054, -30150, -25013,
+    -29873, -25161, -26499, -23029, -23555, -20558, -20781, -17993, -18066, -15388, -15378, -12762, -12706, -10125, -10044,  -7479,
+     -7389,  -4826,  -4740,  -2168,  -2097,    495,    541,   3164,   3173,   5839,   5798,   8524,   8413,  11220,  11013,  13933,
+     13591,  16676,  16130,  19471,  18595,  22380,  20874,  25621,  22460,  30801,  10439, -30266, -23893, -25358, -22252, -22137,
+    -19964, -19232, -17498, -16436, -14960, -13691, -12386, -10973,  -9791,  -8271,  -7183,  -5579,  -4566,  -2894,  -1945,   -214,
+       680,   2464,   3307,   5141,   5934,   7819,   8560,  10498,  11184,  13181,  13801,  15874,  16405,  18584,  18982,  21338,
+     21488,  24224,  23703,  27955,  20620, -25979, -25924, -24598, -23254, -21884, -20663, -19180, -18052, -16494, -15428, -13819,
+    -12796, -11150, -10158,  -8485,  -7517,  -5824,  -4872,  -3167,  -2224,   -511,    426,   2141,   3079,   4791,   5735,   7437,
+      8396,  10078,  11061,  12714,  13735,  15339,  16421,  17947,  19129,  20525,  21883,  23033,  24746,  25378,  27390, -17717,
+    -28312, -24690, -23057, -19843, -17440, -14764, -11961,  -9606,  -6527,  -4424,  -1101,    754,   4341,   5900,   9835,  10966,
+     15454,  15823,  21455,  19872,  29743,   5424, -30376, -20335, -22133, -16262, -16157, -11375, -10576,  -6261,  -5141,  -1042,
+       212,   4247,   5495,   9613,  10685,  15106,  15683,  20932,  19992,  28670,  11039, -29613, -21048, -22178, -16681, -16367,
+    -11683, -10868,  -6505,  -5484,  -1246,   -163,   4068,   5106,   9437,  10308,  14895,  15374,  20590,  19953,  27643,  15843,
+    -17332, -29576, -25135, -17529, -16143, -16565, -12885,  -7888,  -6157,  -5534,  -1984,   2607,   4306,   4927,   8697,  13697,
+     14859,  14425,  19496,  27255,  23560,   2710, -20542, -28117, -21159, -14701, -14879, -14524,  -9519,  -5268,  -4819,  -3333,
+      1554,   5036,   5261,   7415,  12905,  15624,  14590,  17982,  26501,  25506,   5644, -19142, -28272, -21581, -15025, -15263,
+    -14767,  -9617,  -5602,  -5314,  -3550,   1488,   4685,   4777,   7186,  12792,  15345,  14205,  17516,  26157,  26284,   7972,
+     -8471, -17528, -23038, -24381, -22061, -17390, -11968,  -7168,  -3787,  -1921,  -1072,   -386,   1031,   3810,   8070,  13295,
+     18367,  21816,  22232,  18760,  11496,   1618,  -8843, -17573, -22691, -23359, -20040, -14282,  -8122,  -3322,   -752,   -152,
+      -357,    132,   2464,   6930,  12795,  18537,  22353,  22771,  19131,  11808,   2131,  -7964, -16444, -21699, -22955, -20456,
+    -15364,  -9377,  -4178,   -879,    348,    293,    359,   1939,   5768,  11504,  17735,  22430,  23670,  20388,  12809,   2425,
+     -4389,  -9420, -13720, -16936, -18810, -19196, -18071, -15536, -11804,  -7186,  -2061,   3155,   8038,  12193,  15287,  17070,
+     17400,  16256,  13733,  10043,   5494,    469,  -4609,  -9306, -13220, -16008, -17423, -17331, -15729, -12744,  -8626,  -3728,
+      1525,   6672,  11255,  14864,  17169,  17958,  17150,  14810,  11142,   6468,   1207,  -4170,  -9180, -13371, -16367, -17900,
+    -17832, -16174, -13079,  -8828,  -3805,   1537,   6722,  11288,  14833,  17048,  17741,  16857,  14477,  10808,   6169,    957,
+     -1477,  -1594,  -1678,  -1726,  -1737,  -1710,  -1646,  -1547,  -1416,  -1258,  -1079,   -883,   -677,   -469,   -265,    -71,
+       108,    264,    395,    497,    568,    607,    613,    589,    537,    460,    364,    252,    132,      8,   -113,   -226,
+      -325,   -407,   -467,   -504,   -514,   -499,   -458,   -393,   -308,   -207,    -94,     26,    146,    262,    366,    455,
+       522,    564,    577,    560,    510,    429,    318,    178,     15,   -167,   -364,   -568,   -773,   -974,  -1162,  -1331,
+      -869,   -887,   -898,   -904,   -905,   -899,   -887,   -870,   -847,   -819,   -785,   -747,   -705,   -659,   -609,   -556,
+      -500,   -443,   -384,   -324,   -264,   -204,   -146,    -88,    -32,     21,     71,    117,    160,    198,    231,    260,
+       283,    300,    312,    318,    318,    312,    301,    284,    261,    232,    199,    161,    119,     72,     22,    -30,
+       -86,   -143,   -202,   -262,   -322,   -382,   -441,   -498,   -554,   -607,   -657,   -703,   -746,   -784,   -818,   -846,
+    
+    // Frame 22
+    -24497, -28053, -26164, -26279, -24966, -24817, -23657, -23407, -22320, -22015, -20971, -20630, -19616, -19249, -18259, -17871,
+    -16899, -16495, -15539, -15119, -14177, -13744, -12815, -12369, -11453, -10995, -10091,  -9620,  -8729,  -8246,  -7366,  -6871,
+     -6004,  -5497,  -4642,  -4122,  -3281,  -2747,  -1919,  -1371,   -558,      5,    802,   1381,   2162,   2758,   3522,   4136,
+      4880,   5515,   6238,   6895,   7594,   8276,   8949,   9659,  10302,  11043,  11652,  12431,  13000,  13821,  14344,  15216,
+     15683,  16617,  17016,  18026,  18338,  19447,  19645,  20887,  20929,  22357,  22172,  23884,  23334,  25534,  24297,  27537,
+     24524,  31555,  -8361, -31731, -23943, -27592, -23741, -25578, -22783, -23926, -21623, -22398, -20381, -20927, -19098, -19487,
+    -17791, -18065, -16469, -16655, -15138, -15254, -13800, -13858, -12456, -12466, -11109, -11078,  -9760,  -9692,  -8408,  -8309,
+     -7054,  -6926,  -5699,  -5545,  -4343,  -4165,  -2986,  -2785,  -1628,  -1406,   -270,    -28,   1088,   1350,   2447,   2728,
+      3805,   4106,   5164,   5485,   6522,   6863,   7881,   8242,   9238,   9621,  10595,  11001,  11951,  12383,  13306,  13765,
+     14659,  15150,  16010,  16538,  17357,  17930,  18699,  19328,  20034,  20734,  21357,  22156,  22661,  23605,  23927,  25109,
+     25106,  26755,  26049,  28467, -17589, -29804, -24792, -26805, -24106, -25064, -22973, -23533, -21723, -22074, -20426, -20648,
+    -19106, -19239, -17773, -17840, -16431, -16448, -15084, -15061, -13732, -13677, -12378, -12295, -11022, -10916,  -9664,  -9537,
+     -8305,  -8160,  -6945,  -6784,  -5584,  -5409,  -4223,  -4034,  -2860,  -2660,  -1498,  -1286,   -134,     87,   1229,   1460,
+      2593,   2833,   3957,   4206,   5322,   5578,   6687,   6949,   8052,   8321,   9417,   9692,  10783,  11063,  12149,  12434,
+     13515,  13804,  14882,  15173,  16250,  16542,  17619,  17909,  18989,  19274,  20363,  20635,  21741,  21989,  23130,  23327,
+     24544,  24621,  26044,  25721,  28143,  22892, -25049, -27298, -26131, -25586, -24877, -24148, -23578, -22684, -22379, -20910,
+    -25174, -26710, -25363, -23730, -22670, -21001, -19909, -18294, -17142, -15587, -14375, -12879, -11611, -10170,  -8847,  -7460,
+     -6084,  -4750,  -3319,  -2042,   -552,    663,   2218,   3364,   4993,   6059,   7777,   8743,  10573,  11412,  13388,  14055,
+     16237,  16654,  19148,  19164,  22194,  21454,  25634,  22916,  31407,  -4059, -31516, -22311, -25730, -20850, -22291, -18557,
+    -19249, -16042, -16345, -13436, -13504, -10784, -10698,  -8104,  -7914,  -5406,  -5146,  -2694,  -2390,     28,    356,   2760,
+      3093,   5502,   5819,   8255,   8533,  11022,  11231,  13808,  13904,  16626,  16536,  19500,  19089,  22493,  21449,  25829,
+     23100,  31079,  -9313, -30558, -22746, -25142, -21130, -21792, -18777, -18794, -16229, -15917, -13600, -13095, -10930, -10305,
+     -8237,  -7534,  -5527,  -4775,  -2807,  -2027,    -78,    713,   2659,   3446,   5404,   6171,   8157,   8886,  10921,  11590,
+     13699,  14275,  16500,  16930,  19341,  19528,  22270,  21987,  25441,  23962,  29696, -13857, -29763, -22846, -25040, -20612,
+    -25306, -25164, -22797, -19459, -17360, -13997, -11861,  -8553,  -6358,  -3107,   -860,   2346,   4628,   7813,  10096,  13310,
+     15515,  18900,  20723,  25132,  21775, -24326, -23886, -21135, -18093, -15774, -12550, -10363,  -7011,  -4962,  -1453,    412,
+      4139,   5740,   9795,  10977,  15587,  15995,  21773,  20189,  30270,  -4519, -29823, -19640, -21300, -15457, -15103, -10453,
+     -9295,  -5235,  -3614,     61,   2018,   5385,   7641,  10697,  13302,  15931,  19126,  20793,  26045,  18638, -27385, -21797,
+    -26142, -22881, -22676, -20957, -16747, -13681, -11919,  -9063,  -5758,  -3454,   -873,   2527,   4934,   6837,  10562,  14243,
+     14923,  16718,  23853,  26969,  12486, -13437, -28277, -23817, -15142, -14445, -15341, -10404,  -5144,  -4784,  -3822,   1508,
+      5383,   5238,   7509,  13548,  15853,  14559,  19399,  27908,  22127,  -2468, -24653, -26762, -17954, -14696, -15817, -12386,
+     -6767,  -5400,  -4939,   -308,   4242,   4563,   5902,  11703,  15388,  14038,  16471,  25580,  26874,   9153, -15555, -27769,
+    -25114, -26999, -25278, -21512, -17253, -13478, -10440,  -7907,  -5555,  -3239,   -990,   1186,   3513,   6422,  10257,  14846,
+     19238,  21832,  20961,  15691,   6458,  -4833, -15355, -22381, -24323, -21328, -15142,  -8317,  -3114,   -612,   -396,   -927,
+      -378,   2470,   7664,  14051,  19744,  22837,  22058,  17158,   8941,   -991, -10662, -18190, -22221, -22244, -18727, -13004,
+     -6882,  -2046,    550,   1066,    709,   1196,   3923,   9196,  15902,  21811,  24431,  22053,  14525,   3392,  -8664, -18821,
+    -15180, -18851, -21269, -22297, -21900, -20144, -17184, -13248,  -8621,  -3622,   1409,   6136,  10243,  13453,  15543,  16364,
+     15849,  14028,  11027,   7068,   2458,  -2428,  -7178, -11371, -14618, -16598, -17093, -16015, -13419,  -9510,  -4626,    786,
+      6215,  11132,  15047,  17557,  18390,  17441,  14782,  10659,   5471,   -274,  -6006, -11155, -15210, -17770, -18586, -17588,
+    -14887, -10760,  -5627,      2,   5576,  10561,  14486,  16994,  17866,  17040,  14608,  10799,   5956,    492,  -5141, -10500,
+     -5568,  -5876,  -6058,  -6107,  -6022,  -5806,  -5465,  -5011,  -4459,  -3828,  -3138,  -2412,  -1674,   -948,   -255,    382,
+       945,   1417,   1788,   2047,   2193,   2225,   2148,   1971,   1706,   1369,    978,    554,    115,   -316,   -719,  -1077,
+     -1373,  -1593,  -1729,  -1774,  -1726,  -1588,  -1367,  -1071,   -716,   -317,    106,    534,    946,   1322,   1641,   1887,
+      2043,   2100,   2047,   1881,   1603,   1217,    731,    159,   -483,  -1176,  -1899,  -2628,  -3340,  -4011,  -4619,  -5144,
+     -3086,  -3129,  -3152,  -3155,  -3136,  -3097,  -3037,  -2958,  -2860,  -2743,  -2610,  -2461,  -2298,  -2123,  -1936,  -1740,
+     -1538,  -1329,  -1118,   -905,   -693,   -484,   -280,    -82,    106,    285,    451,    603,    739,    859,    962,   1045,
+      1109,   1153,   1176,   1178,   1160,   1121,   1061,    982,    883,    767,    634,    485,    322,    146,    -40,   -236,
+      -439,   -647,   -858,  -1071,  -1283,  -1492,  -1697,  -1894,  -2083,  -2261,  -2427,  -2579,  -2716,  -2836,  -2938,  -3022,
+    
+    // Frame 23
+    -21772, -28685, -25703, -26539, -24612, -24944, -23324, -23445, -21981, -21980, -20615, -20532, -19237, -19093, -17850, -17661,
+    -16459, -16233, -15064, -14808, -13666, -13385, -12266, -11965, -10864, -10546,  -9461,  -9129,  -8056,  -7712,  -6651,  -6297,
+     -5244,  -4883,  -3837,  -3469,  -2429,  -2056,  -1020,   -644,    390,    767,   1800,   2178,   3212,   3587,   4624,   4996,
+      6036,   6404,   7450,   7811,   8865,   9217,  10282,  10621,  11700,  12024,  13120,  13424,  14542,  14821,  15968,  16214,
+     17399,  17602,  18836,  18981,  20284,  20347,  21750,  21689,  23248,  22985,  24817,  24163,  26598,  24895,  29636,  17737,
+    -28595, -25855, -26844, -24867, -25159, -23643, -23615, -22332, -22127, -20983, -20666, -19614, -19220, -18234, -17783, -16846,
+    -16352, -15454, -14924, -14058, -13500, -12660, -12078, -11260, -10657,  -9859,  -9238,  -8456,  -7819,  -7053,  -6401,  -5650,
+     -4983,  -4246,  -3566,  -2842,  -2149,  -1437,   -732,    -33,    685,   1371,   2102,   2775,   3520,   4179,   4938,   5582,
+      6356,   6985,   7776,   8386,   9196,   9787,  10618,  11186,  12041,  12583,  13466,  13977,  14895,  15368,  16327,  16755,
+     17765,  18134,  19212,  19504,  20671,  20857,  22151,  22181,  23671,  23450,  25273,  24588,  27104,  25279,  29857, -14802,
+    -30428, -24522, -26964, -23975, -25079, -22863, -23463, -21602, -21938, -20281, -20456, -18929, -18997, -17559, -17551, -16178,
+    -16114, -14790, -14684, -13397, -13258, -11999, -11836, -10599, -10416,  -9196,  -8998,  -7792,  -7583,  -6385,  -6169,  -4977,
+     -4756,  -3568,  -3344,  -2157,  -1934,   -745,   -525,    668,    883,   2082,   2289,   3497,   3694,   4914,   5098,   6333,
+      6500,   7753,   7900,   9176,   9297,  10601,  10692,  12029,  12084,  13461,  13471,  14898,  14852,  16342,  16225,  17795,
+     17588,  19261,  18933,  20748,  20253,  22269,  21527,  23853,  22712,  25571,  23678,  27682,  23823,  32108,   5071, -31997,
+    -24140, -27591, -23996, -25475, -23040, -23743, -21872, -22138, -20626, -20580, -19356, -19024, -18112, -17396, -17044, -15234,
+    -22280, -27355, -24855, -23914, -22253, -20994, -19480, -18150, -16669, -15325, -13847, -12506, -11022,  -9688,  -8197,  -6870,
+     -5373,  -4050,  -2552,  -1228,    268,   1597,   3084,   4425,   5895,   7259,   8701,  10100,  11498,  12951,  14283,  15819,
+     17044,  18718,  19763,  21680,  22384,  24805,  24713,  28225, -16590, -29140, -22954, -24591, -20851, -21381, -18270, -18397,
+    -15564, -15491, -12808, -12620, -10025,  -9768,  -7227,  -6929,  -4418,  -4099,  -1602,  -1275,   1220,   1542,   4049,   4353,
+      6884,   7157,   9727,   9952,  12581,  12733,  15452,  15491,  18355,  18205,  21324,  20810,  24490,  22999,  28832,  17841,
+    -27406, -25199, -24537, -22722, -21476, -20069, -18531, -17343, -15632, -14586, -12756, -11812,  -9892,  -9030,  -7033,  -6245,
+     -4178,  -3457,  -1322,   -671,   1535,   2113,   4397,   4891,   7266,   7660,  10146,  10414,  13045,  13144,  15976,  15830,
+     18969,  18427,  22098,  20802,  25626,  22335,  31547,   2503, -31537, -22556, -25651, -20968, -22214, -18439, -19374, -15137,
+    -21034, -26958, -21128, -20497, -15877, -14601, -10426,  -8796,  -4932,  -3009,    564,   2790,   6032,   8636,  11428,  14597,
+     16632,  20904,  21116,  29170,  -7989, -29648, -18955, -21234, -14505, -14911,  -9314,  -8938,  -3931,  -3077,   1518,   2745,
+      6986,   8568,  12432,  14439,  17788,  20475,  22835,  26907, -15269, -27841, -19184, -20362, -14337, -14264,  -8997,  -8400,
+     -3528,  -2614,   1992,   3138,   7536,   8872,  13095,  14588,  18685,  20222,  24592,  23343, -21874, -24976, -20564, -17880,
+    -20674, -27066, -23722, -17344, -16343, -15896, -10835,  -6403,  -6095,  -4253,   1329,   4510,   4296,   7471,  13695,  15166,
+     13974,  20033,  28317,  20415,  -4983, -25259, -25712, -17467, -14798, -14965, -11047,  -6405,  -5168,  -3344,   1395,   4474,
+      5096,   8478,  13795,  14916,  14844,  21569,  28056,  17314,  -8689, -26748, -24900, -16360, -14499, -14861, -10516,  -5753,
+     -4755,  -2996,   1856,   4944,   5569,   9012,  14176,  15124,  15478,  22651,  27847,  14233, -12868, -28050, -22731, -15752,
+    -24826, -22708, -20383, -18543, -16995, -15054, -12175,  -8418,  -4467,  -1191,    955,   2317,   3914,   6835,  11462,  16969,
+     21433,  22590,  18891,  10371,  -1141, -12607, -20921, -24109, -22035, -16319,  -9534,  -4065,  -1159,   -560,   -828,   -164,
+      2694,   7861,  14225,  19873,  22798,  21623,  16075,   7090,  -3443, -13207, -20102, -22827, -21239, -16376, -10092,  -4395,
+      -708,    666,    630,    847,   2912,   7500,  13879,  20057,  23542,  22402,  16138,   5976,  -5586, -15761, -22527, -25285,
+    -21038, -22804, -23331, -22654, -20871, -18124, -14589, -10466,  -5973,  -1345,   3169,   7316,  10841,  13504,  15098,  15470,
+     14545,  12342,   8992,   4737,    -81,  -5036,  -9662, -13493, -16115, -17213, -16618, -14326, -10518,  -5541,    115,   5870,
+     11117,  15287,  17913,  18690,  17511,  14480,   9906,   4270,  -1826,  -7732, -12817, -16543, -18523, -18563, -16678, -13092,
+     -8203,  -2539,   3302,   8724,  13186,  16266,  17690,  17359,  15339,  11852,   7236,   1904,  -3698,  -9138, -14032, -18072,
+     -8797,  -9105,  -9216,  -9125,  -8835,  -8356,  -7704,  -6902,  -5975,  -4954,  -3874,  -2769,  -1675,   -627,    344,   1208,
+      1940,   2522,   2941,   3189,   3266,   3179,   2939,   2565,   2079,   1508,    881,    229,   -417,  -1027,  -1572,  -2028,
+     -2373,  -2594,  -2679,  -2626,  -2436,  -2120,  -1690,  -1167,   -575,     58,    703,   1329,   1904,   2399,   2787,   3044,
+      3153,   3100,   2877,   2485,   1929,   1220,    379,   -573,  -1605,  -2688,  -3786,  -4865,  -5888,  -6822,  -7635,  -8301,
+     -4731,  -4775,  -4787,  -4768,  -4718,  -4637,  -4526,  -4386,  -4219,  -4025,  -3808,  -3568,  -3308,  -3032,  -2740,  -2437,
+     -2126,  -1808,  -1487,  -1167,   -850,   -540,   -239,     50,    323,    579,    814,   1027,   1216,   1378,   1512,   1618,
+      1692,   1736,   1749,   1730,   1680,   1599,   1488,   1348,   1181,    987,    769,    530,    270,     -7,   -298,   -601,
+      -913,  -1230,  -1551,  -1871,  -2188,  -2498,  -2799,  -3088,  -3361,  -3617,  -3853,  -4066,  -4254,  -4416,  -4551,  -4656,
+    
+    // Frame 24
+    -19624, -28780, -25745, -26327, -24702, -24654, -23384, -23110, -21995, -21611, -20577, -20131, -19144, -18662, -17704, -17199,
+    -16259, -15740, -14810, -14284, -13359, -12830, -11907, -11377, -10453,  -9925,  -8999,  -8474,  -7543,  -7024,  -6087,  -5575,
+     -4630,  -4126,  -3172,  -2678,  -1713,  -1231,   -254,    215,   1206,   1661,   2667,   3105,   4130,   4548,   5593,   5990,
+      7058,   7430,   8525,   8868,   9994,  10303,  11467,  11735,  12942,  13163,  14423,  14585,  15911,  16000,  17407,  17403,
+     18917,  18790,  20449,  20150,  22014,  21463,  23644,  22684,  25414,  23679,  27590,  23819,  32187,   1745, -32319, -23828,
+    -27723, -23688, -25546, -22693, -23777, -21471, -22148, -20157, -20583, -18796, -19053, -17408, -17544, -16003, -16049, -14587,
+    -14563, -13163, -13085, -11733, -11611, -10299, -10141,  -8861,  -8675,  -7420,  -7211,  -5976,  -5749,  -4531,  -4290,  -3084,
+     -2832,  -1635,  -1376,   -184,     79,   1268,   1532,   2722,   2984,   4177,   4434,   5634,   5882,   7093,   7328,   8554,
+      8772,  10017,  10213,  11484,  11650,  12954,  13083,  14430,  14511,  15912,  15931,  17403,  17340,  18907,  18732,  20432,
+     20099,  21990,  21421,  23610,  22654,  25365,  23669,  27510,  23864,  31971,   5163, -32102, -23995, -27666, -23795, -25522,
+    -22779, -23768, -21546, -22148, -20224, -20589, -18857, -19065, -17465, -17560, -16056, -16069, -14637, -14586, -13210, -13110,
+    -11777, -11639, -10340, -10172,  -8899,  -8708,  -7456,  -7246,  -6011,  -5786,  -4564,  -4328,  -3115,  -2872,  -1664,  -1417,
+      -212,     36,   1241,   1488,   2696,   2938,   4152,   4387,   5610,   5835,   7069,   7280,   8531,   8724,   9994,  10165,
+     11461,  11603,  12931,  13037,  14405,  14466,  15886,  15888,  17374,  17300,  18875,  18697,  20394,  20071,  21944,  21403,
+     23550,  22654,  25281,  23703,  27372,  23997,  31589,   8507, -31621, -24285, -27527, -23964, -25448, -22906, -23726, -21647,
+    -22128, -20303, -20591, -18915, -19090, -17496, -17616, -16051, -16168, -14576, -14758, -13049, -13428, -11386, -12377,  -8939,
+    -19146, -28238, -24122, -24306, -21648, -21160, -18895, -18148, -16066, -15183, -13206, -12240, -10330,  -9310,  -7445,  -6387,
+     -4553,  -3468,  -1657,   -554,   1242,   2358,   4143,   5268,   7046,   8176,   9951,  11083,  12855,  13991,  15760,  16900,
+     18660,  19817,  21543,  22774,  24322,  26099,  24375, -23334, -26533, -24183, -22985, -21513, -19960, -18679, -17004, -15811,
+    -14068, -12931, -11138, -10048,  -8209,  -7164,  -5280,  -4282,  -2349,  -1404,    587,   1470,   3528,   4337,   6478,   7193,
+      9441,  10033,  12425,  12846,  15443,  15614,  18525,  18290,  21745,  20741,  25368,  22345,  31392,   2576, -31581, -22435,
+    -25561, -20830, -21939, -18377, -18720, -15699, -15642, -12928, -12627, -10111,  -9647,  -7267,  -6690,  -4404,  -3746,  -1530,
+      -813,   1353,   2111,   4244,   5029,   7142,   7940,  10046,  10845,  12958,  13741,  15878,  16626,  18812,  19495,  21766,
+     22341,  24735,  25263,  26374, -21035, -27293, -23881, -23285, -21443, -20102, -18745, -17006, -16048, -13822, -13599,  -9874,
+    -18148, -27555, -20508, -20610, -15203, -14507,  -9575,  -8575,  -3839,  -2723,   1965,   3066,   7837,   8771,  13822,  14303,
+     20106,  19224,  28087,  12903, -28485, -21404, -21052, -16382, -14795, -10850,  -8793,  -5172,  -2884,    567,   2983,   6340,
+      8822,  12137,  14632,  17981,  20340,  24166,  23498, -21962, -24883, -20114, -18407, -14526, -12506,  -8743,  -6700,  -2900,
+      -941,   2989,   4768,   8938,  10395,  15005,  15837,  21393,  20635,  29426, -11051, -28215, -19678, -19701, -15321, -12311,
+    -21716, -22824, -21552, -20692, -17451, -12059,  -9367,  -9147,  -5947,   -154,   2290,   2024,   5643,  12190,  13991,  12370,
+     17128,  26776,  25284,   5562, -17586, -26560, -21886, -15601, -13300, -11967,  -9065,  -5368,  -1972,    573,   2481,   5483,
+     10040,  13020,  13237,  15982,  23838,  26708,  12839, -11557, -26722, -24432, -16000, -13055, -13372, -10435,  -5356,  -2421,
+     -1030,   1681,   5589,   9015,  11417,  13149,  15917,  21600,  25948,  18374,  -3621, -24780, -28144, -17352, -10597, -15146,
+    -17582, -17943, -19398, -20484, -19717, -16475, -11377,  -5952,  -1796,    321,    900,   1441,   3592,   8146,  14410,  20327,
+     23293,  21342,  14105,   3114,  -8710, -18161, -22949, -22478, -17913, -11540,  -5739,  -2032,   -592,   -363,    301,   2782,
+      7507,  13657,  19416,  22619,  21574,  15759,   6120,  -5139, -15226, -21680, -23196, -20059, -13979,  -7378,  -2400,    -40,
+       206,     10,   1319,   5295,  11601,  18371,  22944,  23027,  17764,   8200,  -3099, -13101, -19545, -21790, -20880, -18843,
+    -21845, -22123, -21556, -20231, -18227, -15614, -12461,  -8844,  -4869,   -682,   3516,   7476,  10908,  13515,  15018,  15205,
+     13965,  11321,   7445,   2659,  -2587,  -7760, -12296, -15668, -17454, -17390, -15418, -11696,  -6594,   -654,   5464,  11067,
+     15503,  18249,  18969,  17562,  14178,   9195,   3182,  -3174,  -9148, -14066, -17382, -18744, -18027, -15348, -11043,  -5623,
+       294,   6055,  11050,  14776,  16892,  17239,  15848,  12921,   8792,   3876,  -1384,  -6565, -11305, -15332, -18473, -20645,
+    -10936, -11125, -11071, -10777, -10252,  -9514,  -8588,  -7504,  -6300,  -5013,  -3687,  -2365,  -1088,    104,   1175,   2095,
+      2840,   3390,   3738,   3879,   3821,   3576,   3165,   2613,   1951,   1214,    439,   -337,  -1077,  -1748,  -2317,  -2759,
+     -3054,  -3190,  -3160,  -2965,  -2614,  -2125,  -1518,   -821,    -68,    706,   1465,   2171,   2788,   3283,   3626,   3794,
+      3770,   3544,   3113,   2482,   1665,    682,   -440,  -1668,  -2964,  -4288,  -5597,  -6849,  -8003,  -9020,  -9865, -10511,
+     -5786,  -5813,  -5801,  -5751,  -5664,  -5540,  -5380,  -5187,  -4961,  -4705,  -4422,  -4113,  -3783,  -3435,  -3070,  -2695,
+     -2311,  -1922,  -1533,  -1147,   -767,   -398,    -43,    295,    612,    906,   1173,   1411,   1618,   1791,   1929,   2031,
+      2096,   2122,   2111,   2061,   1974,   1850,   1690,   1496,   1271,   1015,    731,    423,     93,   -256,   -620,   -996,
+     -1380,  -1768,  -2157,  -2544,  -2923,  -3292,  -3648,  -3985,  -4303,  -4596,  -4863,  -5101,  -5308,  -5481,  -5619,  -5721,
+    
+    // Frame 25
+    -17020, -29300, -25387, -26491, -24438, -24696, -23132, -23071, -21730, -21505, -20290, -19966, -18830, -18441, -17359, -16926,
+    -15881, -15415, -14398, -13909, -12912, -12406, -11423, -10905,  -9933,  -9406,  -8441,  -7908,  -6947,  -6412,  -5452,  -4916,
+     -3956,  -3422,  -2460,  -1929,   -962,   -437,    537,   1055,   2037,   2545,   3538,   4034,   5041,   5521,   6545,   7007,
+      8050,   8491,   9558,   9972,  11069,  11451,  12583,  12925,  14101,  14395,  15626,  15857,  17158,  17310,  18703,  18748,
+     20266,  20162,  21860,  21535,  23510,  22828,  25283,  23921,  27411,  24278,  31552,  -8476, -31610, -23927, -27348, -23595,
+    -25211, -22506, -23436, -21215, -21785, -19843, -20191, -18428, -18628, -16990, -17083, -15537, -15551, -14074, -14027, -12604,
+    -12509, -11129, -10996,  -9650,  -9486,  -8168,  -7979,  -6683,  -6474,  -5196,  -4972,  -3707,  -3471,  -2217,  -1971,   -725,
+      -473,    768,   1024,   2262,   2520,   3758,   4014,   5255,   5507,   6753,   6999,   8253,   8489,   9755,   9977,  11259,
+     11462,  12765,  12945,  14275,  14424,  15789,  15898,  17309,  17364,  18838,  18820,  20380,  20260,  21943,  21671,  23546,
+     23026,  25231,  24249,  27146,  25026,  29982, -14969, -30218, -24604, -26671, -23972, -24701, -22776, -23000, -21430, -21391,
+    -20024, -19824, -18588, -18279, -17134, -16748, -15669, -15226, -14198, -13710, -12721, -12198, -11240, -10690,  -9757,  -9184,
+     -8271,  -7679,  -6784,  -6177,  -5296,  -4675,  -3806,  -3175,  -2315,  -1675,   -824,   -176,    669,   1322,   2162,   2819,
+      3656,   4315,   5150,   5811,   6645,   7307,   8141,   8801,   9637,  10295,  11135,  11788,  12633,  13279,  14133,  14769,
+     15634,  16257,  17138,  17743,  18645,  19224,  20158,  20699,  21678,  22164,  23211,  23611,  24769,  25025,  26365,  26451,
+     26942, -20429, -28815, -25188, -26140, -24168, -24394, -22825, -22798, -21399, -21253, -19940, -19732, -18463, -18224, -16975,
+    -16726, -15477, -15238, -13970, -13759, -12452, -12294, -10918, -10850,  -9355,  -9445,  -7733,  -8136,  -5940,  -7187,  -3131,
+    -16461, -28740, -23716, -24414, -21290, -21109, -18500, -17978, -15612, -14909, -12683, -11869,  -9732,  -8846,  -6768,  -5834,
+     -3795,  -2829,   -815,    170,   2170,   3162,   5162,   6150,   8159,   9130,  11165,  12100,  14182,  15056,  17220,  17982,
+     20302,  20834,  23520,  23394,  27585,  20654, -26013, -25549, -24296, -22540, -21242, -19612, -18198, -16666, -15169, -13709,
+    -12148, -10747,  -9131,  -7782,  -6114,  -4817,  -3098,  -1854,    -78,   1106,   2946,   4060,   5977,   7005,   9020,   9935,
+     12081,  12843,  15173,  15709,  18322,  18492,  21596,  21072,  25233,  22894,  30965,  -7452, -30949, -22195, -25129, -20390,
+    -21487, -17810, -18216, -15022, -15073, -12149, -11990,  -9232,  -8940,  -6288,  -5911,  -3327,  -2898,   -353,    103,   2633,
+      3092,   5631,   6070,   8641,   9033,  11668,  11977,  14719,  14889,  17813,  17740,  20997,  20448,  24439,  22616,  29384,
+     15124, -28819, -24275, -24705, -21954, -21303, -19248, -18094, -16440, -14935, -13621, -11752, -10871,  -8418,  -8465,  -4078,
+    -15794, -27679, -20330, -20296, -14958, -13970,  -9196,  -7843,  -3311,  -1803,   2643,   4175,   8661,  10079,  14776,  15843,
+     21119,  21177,  28288, -14744, -27200, -19546, -19240, -14388, -12812,  -8686,  -6639,  -2846,   -545,   3039,   5525,   8929,
+     11612,  14770,  17810,  20349,  24801,  20874, -25494, -22714, -21005, -16625, -15032, -10636,  -9074,  -4612,  -3155,   1456,
+      2710,   7593,   8481,  13865,  14039,  20513,  18819,  29328,   7408, -29401, -20490, -20608, -15843, -13695, -10806,  -6125,
+    -14891, -22881, -25347, -19916, -13761, -12288, -11893,  -7803,  -2398,   -236,    299,   3893,   9614,  12249,  11833,  14808,
+     22965,  26811,  15782,  -6671, -24356, -26202, -17849, -12084, -12296, -11631,  -6266,  -1033,    -17,    602,   5377,  11108,
+     12357,  11794,  16677,  25341,  25526,   9775, -12968, -26252, -24212, -15845, -11794, -12213, -10470,  -4810,   -345,    268,
+      1472,   6820,  12085,  12454,  12278,  18720,  27071,  23105,   2985, -18721, -26467, -21411, -14988, -12129, -10234,  -9850,
+    -13385, -17771, -21633, -22790, -20337, -15016,  -8760,  -3667,   -933,   -296,   -238,   1141,   5048,  11231,  17925,  22535,
+     22751,  17601,   7952,  -3738, -14314, -21081, -22738, -19735, -13925,  -7707,  -3026,   -640,     51,    570,   2535,   6778,
+     12806,  18852,  22511,  21726,  15731,   5520,  -6356, -16666, -22671, -23154, -18835, -11986,  -5404,  -1182,    169,   -176,
+       -57,   2460,   7962,  15202,  21516,  23983,  20791,  12173,    435, -10945, -18762, -21400, -19425, -15181, -11611, -10872,
+    -18990, -18720, -18130, -17213, -15902, -14100, -11711,  -8682,  -5043,   -927,   3421,   7658,  11374,  14151,  15615,  15502,
+     13708,  10323,   5638,    126,  -5609, -10898, -15090, -17642, -18189, -16604, -13019,  -7822,  -1609,   4881,  10863,  15602,
+     18510,  19221,  17639,  13954,   8615,   2275,  -4295, -10300, -15028, -17931, -18696, -17275, -13889,  -8985,  -3178,   2831,
+      8348,  12770,  15651,  16747,  16031,  13678,  10026,   5516,    627,  -4190,  -8562, -12231, -15067, -17059, -18287, -18883,
+    -11925, -11940, -11697, -11204, -10477,  -9541,  -8427,  -7173,  -5820,  -4412,  -2994,  -1613,   -310,    874,   1905,   2756,
+      3406,   3841,   4057,   4057,   3855,   3468,   2924,   2254,   1493,    680,   -145,   -942,  -1675,  -2308,  -2814,  -3169,
+     -3357,  -3370,  -3207,  -2876,  -2392,  -1776,  -1058,   -269,    551,   1366,   2134,   2816,   3377,   3784,   4011,   4036,
+      3848,   3441,   2819,   1994,    985,   -180,  -1468,  -2840,  -4253,  -5662,  -7023,  -8290,  -9421, -10378, -11131, -11652,
+     -6291,  -6292,  -6252,  -6171,  -6050,  -5889,  -5692,  -5459,  -5193,  -4896,  -4571,  -4222,  -3851,  -3462,  -3060,  -2647,
+     -2228,  -1807,  -1388,   -975,   -572,   -183,    189,    539,    866,   1164,   1432,   1667,   1866,   2028,   2151,   2234,
+      2277,   2278,   2238,   2156,   2035,   1875,   1678,   1445,   1178,    882,    557,    207,   -163,   -552,   -954,  -1367,
+     -1786,  -2207,  -2626,  -3039,  -3442,  -3831,  -4203,  -4554,  -4880,  -5178,  -5446,  -5681,  -5880,  -6042,  -6166,  -6249,
+    
+    // Frame 26
+    -14399, -29841, -25006, -26680, -24147, -24768, -22847, -23066, -21429, -21437, -19964, -19841, -18474, -18263, -16970, -16697,
+    -15458, -15137, -13939, -13583, -12416, -12032, -10890, -10485,  -9361,  -8939,  -7830,  -7395,  -6298,  -5853,  -4764,  -4313,
+     -3228,  -2773,  -1692,  -1235,   -154,    302,   1385,   1837,   2925,   3372,   4467,   4905,   6010,   6436,   7555,   7965,
+      9102,   9493,  10651,  11017,  12204,  12538,  13760,  14055,  15322,  15565,  16890,  17067,  18470,  18555,  20066,  20023,
+     21688,  21456,  23359,  22818,  25136,  24011,  27214,  24590,  30855, -11762, -30983, -24154, -27006, -23644, -24902, -22465,
+    -23118, -21107, -21443, -19677, -19819, -18210, -18222, -16722, -16642, -15222, -15072, -13712, -13509, -12197, -11952, -10676,
+    -10399,  -9153,  -8848,  -7627,  -7300,  -6098,  -5754,  -4568,  -4210,  -3037,  -2667,  -1504,  -1125,     30,    416,   1564,
+      1956,   3100,   3495,   4637,   5034,   6174,   6571,   7713,   8107,   9252,   9643,  10793,  11177,  12335,  12709,  13878,
+     14240,  15423,  15769,  16971,  17295,  18523,  18816,  20079,  20331,  21644,  21836,  23223,  23322,  24826,  24775,  26468,
+     26239,  27092, -20603, -28617, -25324, -25895, -24268, -24100, -22890, -22454, -21430, -20858, -19939, -19283, -18432, -17720,
+    -16916, -16163, -15395, -14611, -13870, -13061, -12343, -11514, -10815,  -9968,  -9285,  -8423,  -7754,  -6878,  -6223,  -5334,
+     -4692,  -3791,  -3160,  -2248,  -1628,   -704,    -96,    839,   1436,   2382,   2968,   3926,   4500,   5470,   6031,   7014,
+      7561,   8560,   9091,  10106,  10620,  11653,  12147,  13201,  13673,  14752,  15196,  16306,  16715,  17865,  18229,  19430,
+     19734,  21007,  21223,  22606,  22680,  24255,  24055,  26053,  25108,  28780,  20382, -26926, -26465, -26297, -25005, -24650,
+    -23558, -23040, -22079, -21455, -20581, -19882, -19075, -18316, -17564, -16753, -16050, -15192, -14536, -13631, -13022, -12068,
+    -11511, -10502, -10005,  -8930,  -8506,  -7348,  -7020,  -5748,  -5558,  -4116,  -4143,  -2412,  -2844,   -499,  -1986,   2663,
+    -14408, -28633, -23899, -23952, -21483, -20521, -18628, -17297, -15659, -14143, -12645, -11019,  -9609,  -7911,  -6561,  -4812,
+     -3507,  -1717,   -450,   1376,   2607,   4470,   5663,   7566,   8715,  10669,  11758,  13783,  14785,  16921,  17777,  20112,
+     20679,  23468,  23230,  27832,  19492, -26967, -24971, -24484, -22050, -21270, -19075, -18123, -16052, -15010, -13004, -11915,
+     -9941,  -8833,  -6868,  -5760,  -3787,  -2694,   -698,    364,   2399,   3414,   5505,   6452,   8623,   9477,  11759,  12478,
+     14925,  15442,  18142,  18331,  21470,  21043,  25114,  23106,  30448, -10805, -30193, -22407, -24585, -20403, -20916, -17707,
+    -17576, -14828, -14348, -11876, -11170,  -8888,  -8019,  -5880,  -4882,  -2863,  -1752,    160,   1376,   3182,   4505,   6201,
+      7641,   9210,  10790,  12201,  13964,  15158,  17187,  18042,  20521,  20744,  24183,  22757,  29782,  11166, -30872, -22731,
+    -25555, -20648, -21933, -17911, -18635, -14986, -15461, -11968, -12363,  -8880,  -9341,  -5698,  -6454,  -2292,  -4020,   2377,
+    -14822, -26441, -21500, -18638, -16063, -12069, -10204,  -5688,  -4255,    654,   1701,   7018,   7601,  13482,  13326,  20274,
+     18353,  29033,   9419, -28666, -20996, -20152, -15916, -13383, -10178,  -6930,  -4266,   -578,   1705,   5744,   7681,  12089,
+     13593,  18573,  19181,  26015,  18742, -25344, -23107, -19911, -17108, -13603, -11083,  -7352,  -5013,  -1137,   1086,   5054,
+      7208,  11220,  13360,  17346,  19561,  23460,  24870, -18252, -26642, -18515, -19410, -12668, -13265,  -6270,  -7722,   1470,
+    -14010, -23676, -24220, -18713, -14339, -12736, -10596,  -6379,  -2362,   -324,   1611,   5774,  10404,  12144,  12829,  17940,
+     25553,  23634,   5310, -17938, -27751, -21463, -13070, -12018, -12683,  -8004,  -1761,   -113,    -57,   4395,  10677,  12316,
+     11499,  16270,  25270,  25478,   9156, -13846, -26427, -23485, -15108, -11651, -12038,  -9507,  -3592,    151,    532,   2821,
+      8792,  12795,  12297,  14243,  22781,  27300,  14518, -10168, -26270, -24201, -15391, -12797, -13592,  -9081,  -2126,  -3324,
+    -12747, -18768, -22503, -22480, -18839, -13115,  -7411,  -3386,  -1519,   -973,   -111,   2589,   7650,  14163,  20022,  22744,
+     20544,  13197,   2282,  -9298, -18367, -22654, -21613, -16524,  -9845,  -4090,   -746,    291,    505,   1868,   5693,  11791,
+     18341,  22596,  22110,  15930,   5200,  -7149, -17506, -23010, -22660, -17614, -10541,  -4337,   -819,      4,   -249,    670,
+      4342,  10695,  17850,  22865,  23067,  17339,   6765,  -5684, -16296, -22095, -22011, -17238, -10638,  -5487,  -4112,  -7003,
+    -14331, -14525, -14822, -15016, -14828, -13972, -12215,  -9438,  -5683,  -1165,   3733,   8503,  12581,  15426,  16601,  15855,
+     13166,   8770,   3140,  -3065,  -9077, -14124, -17530, -18815, -17762, -14458,  -9285,  -2880,   3951,  10334,  15446,  18625,
+     19456,  17835,  13972,   8371,   1760,  -5011, -11081, -15690, -18281, -18568, -16568, -12589,  -7184,  -1067,   4985,  10236,
+     14087,  16146,  16264,  14545,  11306,   7023,   2245,  -2481,  -6695, -10076, -12474, -13911, -14550, -14649, -14493, -14333,
+    -11801, -11646, -11242, -10604,  -9753,  -8717,  -7531,  -6233,  -4868,  -3478,  -2109,   -803,    400,   1464,   2361,   3067,
+      3567,   3854,   3930,   3802,   3488,   3011,   2400,   1689,    915,    116,   -669,  -1402,  -2050,  -2582,  -2974,  -3208,
+     -3274,  -3168,  -2895,  -2468,  -1906,  -1235,   -485,    307,   1105,   1869,   2561,   3145,   3588,   3862,   3945,   3822,
+      3487,   2938,   2187,   1250,    150,  -1080,  -2404,  -3783,  -5172,  -6527,  -7804,  -8960,  -9958, -10765, -11353, -11702,
+     -6269,  -6244,  -6179,  -6073,  -5929,  -5746,  -5528,  -5275,  -4991,  -4679,  -4340,  -3979,  -3600,  -3204,  -2797,  -2383,
+     -1965,  -1547,  -1134,   -729,   -336,     40,    397,    731,   1038,   1316,   1562,   1774,   1949,   2086,   2184,   2242,
+      2258,   2234,   2168,   2063,   1918,   1736,   1517,   1265,    981,    668,    330,    -31,   -411,   -806,  -1213,  -1627,
+     -2045,  -2463,  -2876,  -3281,  -3674,  -4050,  -4407,  -4741,  -5048,  -5326,  -5572,  -5784,  -5959,  -6097,  -6195,  -6252,
+    
+    // Frame 27
+    -11924, -30241, -24761, -26737, -23983, -24716, -22682, -22945, -21241, -21259, -19744, -19612, -18219, -17987, -16676, -16376,
+    -15124, -14772, -13564, -13174, -11999, -11581, -10431,  -9991,  -8860,  -8404,  -7286,  -6818,  -5711,  -5235,  -4133,  -3653,
+     -2554,  -2073,   -974,   -494,    608,   1084,   2191,   2660,   3776,   4234,   5362,   5806,   6951,   7376,   8542,   8944,
+     10136,  10509,  11733,  12069,  13334,  13625,  14942,  15173,  16558,  16712,  18186,  18235,  19833,  19735,  21511,  21194,
+     23245,  22572,  25101,  23751,  27313,  24194,  31538,  -8475, -31541, -23841, -27195, -23424, -24974, -22249, -23115, -20873,
+    -21380, -19415, -19702, -17915, -18055, -16392, -16427, -14853, -14811, -13305, -13203, -11750, -11601, -10189, -10004,  -8624,
+     -8411,  -7056,  -6820,  -5486,  -5232,  -3913,  -3645,  -2339,  -2061,   -762,   -478,    815,   1104,   2395,   2684,   3975,
+      4262,   5558,   5839,   7142,   7414,   8728,   8987,  10316,  10557,  11907,  12125,  13501,  13689,  15099,  15247,  16704,
+     16798,  18317,  18339,  19944,  19864,  21592,  21359,  23279,  22799,  25049,  24107,  27049,  24968,  29970, -14942, -30146,
+    -24492, -26514, -23776, -24460, -22495, -22674, -21065, -20980, -19574, -19328, -18053, -17699, -16515, -16084, -14966, -14477,
+    -13410, -12876, -11848, -11279, -10283,  -9686,  -8715,  -8095,  -7145,  -6506,  -5573,  -4919,  -4000,  -3333,  -2425,  -1748,
+      -850,   -164,    726,   1419,   2304,   3002,   3882,   4583,   5461,   6164,   7040,   7744,   8621,   9323,  10202,  10901,
+     11785,  12477,  13369,  14052,  14955,  15625,  16543,  17196,  18134,  18762,  19731,  20321,  21336,  21871,  22954,  23403,
+     24596,  24901,  26278,  26411,  26940, -20385, -28731, -25060, -25971, -23957, -24139, -22531, -22456, -21024, -20823, -19483,
+    -19213, -17927, -17615, -16360, -16025, -14787, -14441, -13209, -12861, -11627, -11285, -10041,  -9713,  -8451,  -8146,  -6855,
+     -6584,  -5254,  -5030,  -3643,  -3487,  -2019,  -1960,   -373,   -462,   1312,    978,   3083,   2280,   5104,   3058,   8608,
+    -11256, -29586, -23055, -24488, -20706, -20880, -17831, -17524, -14814, -14255, -11739, -11027,  -8634,  -7823,  -5511,  -4633,
+     -2375,  -1453,    770,   1718,   3922,   4881,   7083,   8036,  10252,  11181,  13435,  14309,  16638,  17408,  19887,  20432,
+     23272,  23164,  27503,  20595, -25927, -25438, -24042, -22258, -20820, -19159, -17607, -16044, -14409, -12918, -11218,  -9787,
+     -8031,  -6654,  -4844,  -3522,  -1655,   -392,   1538,   2731,   4738,   5846,   7949,   8947,  11179,  12025,  14438,  15061,
+     17755,  18015,  21198,  20765,  25003,  22758,  30902,  -7417, -30844, -21989, -24856, -20013, -21047, -17261, -17608, -14302,
+    -14298, -11257, -11049,  -8168,  -7833,  -5052,  -4639,  -1917,  -1461,   1232,   1703,   4394,   4854,   7570,   7989,  10764,
+     11105,  13983,  14188,  17244,  17210,  20596,  20089,  24204,  22429,  29315,  15110, -28723, -24114, -24447, -21615, -20887,
+    -18724, -17529, -15720, -14240, -12675, -10972,  -9620,  -7704,  -6579,  -4407,  -3585,  -1033,   -724,   2587,   1617,   7690,
+    -11040, -27988, -19890, -19770, -14354, -13018,  -8314,  -6494,  -2158,    -30,   4022,   6437,  10174,  12965,  16214,  19700,
+     21843,  27245, -13771, -27881, -18252, -19569, -12762, -12803,  -6715,  -6307,   -510,     85,   5774,   6407,  12130,  12637,
+     18632,  18575,  25953,  19436, -23989, -23840, -19123, -17463, -12746, -11218,  -6347,  -4984,     71,   1219,   6536,   7349,
+     13118,  13284,  20055,  18465,  29131,   7491, -29384, -19909, -20464, -14627, -13655,  -8510,  -7346,  -1940,  -1689,   6204,
+    -10421, -22277, -25386, -19181, -12929, -11897, -11040,  -5939,   -811,    315,   1646,   7173,  12169,  12235,  13352,  21403,
+     27337,  16731,  -7407, -25173, -25021, -16226, -12139, -12509,  -9757,  -3790,   -450,    110,   3230,   9151,  12220,  11945,
+     15426,  24036,  25952,  10676, -13507, -26998, -23076, -14098, -11756, -12515,  -8480,  -2060,     90,    169,   4582,  10986,
+     12455,  11726,  17523,  26547,  23491,   3269, -18979, -26587, -20603, -13491, -11487, -11034,  -7714,  -1789,   2637,    237,
+    -11676, -17658, -21138, -21143, -17943, -12852,  -7621,  -3666,  -1445,   -282,   1227,   4408,   9638,  15878,  20898,  22186,
+     18137,   8992,  -3003, -14352, -21694, -23197, -19280, -12317,  -5434,  -1000,    447,    295,    927,   4252,  10461,  17688,
+     22777,  22802,  16573,   5380,  -7434, -17868, -22958, -21961, -16479,  -9502,  -3890,  -1054,   -468,   -201,   1841,   6640,
+     13387,  19736,  22853,  20726,  13142,   1884,  -9918, -18957, -22950, -21391, -15605,  -8163,  -1913,    980,   -314,  -5136,
+     -9494, -10901, -12593, -14128, -15022, -14845, -13302, -10304,  -5996,   -759,   4834,  10098,  14328,  16911,  17423,  15701,
+     11883,   6402,    -61,  -6670, -12540, -16866, -19035, -18716, -15915, -10975,  -4538,   2542,   9319,  14881,  18477,  19624,
+     18174,  14329,   8617,   1818,  -5152, -11361, -15994, -18462, -18479, -16096, -11683,  -5877,    521,   6655,  11738,  15157,
+     16548,  15836,  13233,   9186,   4301,   -755,  -5357,  -9014, -11433, -12550, -12523, -11683, -10468,  -9333,  -8662,  -8699,
+    -10695, -10417,  -9920,  -9223,  -8348,  -7324,  -6185,  -4969,  -3716,  -2465,  -1256,   -127,    890,   1766,   2477,   3007,
+      3347,   3495,   3456,   3242,   2873,   2373,   1770,   1097,    389,   -321,   -997,  -1607,  -2124,  -2523,  -2785,  -2899,
+     -2859,  -2667,  -2332,  -1869,  -1298,   -647,     54,    773,   1474,   2122,   2684,   3129,   3430,   3565,   3518,   3281,
+      2850,   2233,   1440,    493,   -584,  -1759,  -2996,  -4257,  -5503,  -6693,  -7788,  -8752,  -9553, -10165, -10567, -10745,
+     -5757,  -5714,  -5633,  -5516,  -5364,  -5177,  -4959,  -4710,  -4434,  -4133,  -3809,  -3467,  -3109,  -2739,  -2360,  -1976,
+     -1591,  -1208,   -831,   -464,   -111,    227,    544,    838,   1107,   1347,   1556,   1733,   1875,   1982,   2052,   2084,
+      2079,   2035,   1955,   1838,   1685,   1499,   1281,   1032,    756,    454,    131,   -211,   -569,   -939,  -1318,  -1702,
+     -2087,  -2470,  -2847,  -3214,  -3568,  -3905,  -4222,  -4516,  -4785,  -5025,  -5235,  -5411,  -5554,  -5660,  -5730,  -5762,
+    
+    // Frame 28
+     -9386, -30702, -24455, -26854, -23760, -24724, -22458, -22882, -20995, -21139, -19467, -19442, -17905, -17770, -16325, -16112,
+    -14732, -14464, -13132, -12823, -11526, -11187,  -9915,  -9555,  -8302,  -7925,  -6685,  -6298,  -5066,  -4673,  -3446,  -3050,
+     -1823,  -1429,   -199,    190,   1427,   1808,   3055,   3423,   4685,   5037,   6318,   6648,   7953,   8256,   9591,   9860,
+     11233,  11461,  12880,  13055,  14534,  14641,  16197,  16216,  17874,  17774,  19572,  19306,  21305,  20791,  23103,  22183,
+     25040,  23349,  27384,  23660,  32148,   1757, -32191, -23645, -27427, -23333, -25083, -22167, -23147, -20775, -21350, -19289,
+    -19617, -17757, -17920, -16198, -16244, -14623, -14581, -13035, -12928, -11440, -11282,  -9839,  -9641,  -8233,  -8005,  -6623,
+     -6371,  -5010,  -4741,  -3395,  -3113,  -1777,  -1488,   -157,    136,   1466,   1757,   3090,   3376,   4717,   4992,   6346,
+      6606,   7978,   8217,   9614,   9824,  11254,  11427,  12898,  13023,  14550,  14612,  16212,  16189,  17887,  17749,  19583,
+     19282,  21314,  20769,  23110,  22163,  25045,  23330,  27388,  23642,  32150,   1741, -32190, -23659, -27427, -23347, -25085,
+    -22180, -23149, -20786, -21354, -19299, -19622, -17766, -17926, -16206, -16251, -14629, -14589, -13041, -12937, -11445, -11292,
+     -9842,  -9652,  -8235,  -8017,  -6625,  -6384,  -5011,  -4755,  -3395,  -3128,  -1776,  -1503,   -155,    120,   1468,   1740,
+      3093,   3358,   4721,   4974,   6350,   6588,   7983,   8198,   9619,   9805,  11260,  11406,  12905,  13002,  14557,  14590,
+     16219,  16167,  17895,  17727,  19591,  19260,  21323,  20746,  23118,  22140,  25054,  23307,  27396,  23620,  32159,   1718,
+    -32182, -23681, -27419, -23369, -25077, -22201, -23143, -20806, -21348, -19318, -19618, -17784, -17923, -16222, -16250, -14643,
+    -14591, -13051, -12942, -11451, -11301,  -9845,  -9667,  -8232,  -8038,  -6614,  -6413,  -4991,  -4795,  -3362,  -3182,  -1728,
+     -1576,    -85,     21,   1569,   1606,   3238,   3170,   4932,   4701,   6673,   6165,   8513,   7469,  10643,   8165,  14490,
+     -8734, -29932, -22799, -24453, -20485, -20698, -17562, -17232, -14478, -13866, -11328, -10546,  -8145,  -7250,  -4943,  -3970,
+     -1729,   -700,   1494,   2564,   4722,   5822,   7954,   9078,  11190,  12331,  14426,  15584,  17659,  18845,  20876,  22144,
+     23991,  25811,  24379, -23282, -26191, -23790, -22306, -20782, -18942, -17610, -15647, -14404, -12370, -11188,  -9098,  -7970,
+     -5827,  -4754,  -2552,  -1542,    728,   1664,   4017,   4858,   7318,   8037,  10641,  11189,  13998,  14294,  17419,  17307,
+     20980,  20093,  24949,  22022,  31345,    873, -31398, -22025, -25002, -20095, -21034, -17309, -17474, -14294, -14054, -11187,
+    -10699,  -8033,  -7380,  -4852,  -4081,  -1654,   -796,   1556,   2479,   4774,   5747,   7998,   9010,  11226,  12270,  14456,
+     15528,  17685,  18793,  20898,  22096,  24010,  25764,  24397, -23327, -26174, -23836, -22287, -20830, -18919, -17663, -15618,
+    -14466, -12329, -11265,  -9040,  -8070,  -5738,  -4892,  -2414,  -1745,    954,   1337,   4421,   4258,   8178,   6572,  13656,
+     -7843, -28876, -19000, -20134, -13449, -13137,  -7268,  -6454,   -895,     91,   5592,   6523,  12214,  12768,  19144,  18392,
+     27779,  12770, -28135, -20842, -20043, -15126, -13125,  -8900,  -6464,  -2526,    103,   3912,   6621,  10394,  13092,  16943,
+     19426,  23914,  22827, -22288, -24159, -19290, -17125, -12961, -10592,  -6463,  -4145,     96,   2247,   6714,   8563,  13440,
+     14713,  20451,  20300,  28811, -12498, -27426, -18931, -18564, -13503, -11423,  -7508,  -4485,  -1505,   2637,   3961,  11432,
+     -7480, -23391, -25773, -17586, -12404, -12774, -10497,  -4064,   -358,   -237,   2929,   9535,  12442,  11605,  15892,  25303,
+     25054,   6356, -17506, -26919, -20652, -13167, -12058, -11325,  -6173,  -1129,    154,   1962,   7490,  11961,  12151,  14326,
+     22665,  26568,  12875, -12066, -26949, -23177, -13886, -11768, -12522,  -7878,  -1400,    132,    450,   5874,  12014,  12262,
+     12340,  20413,  27807,  17867,  -6920, -24838, -24275, -16147, -12915, -12122,  -7950,  -3534,  -2019,   1409,   7869,   6940,
+     -8394, -14995, -19698, -21022, -18623, -13516,  -7633,  -2891,   -206,    971,   2282,   5393,  10796,  17171,  21770,  21711,
+     15562,   4346,  -8628, -19113, -23827, -21926, -15286,  -7436,  -1689,    520,    215,     63,   2636,   8711,  16568,  22709,
+     23629,  17709,   6213,  -7161, -17943, -22918, -21472, -15606,  -8681,  -3604,  -1433,  -1097,   -315,   2876,   8824,  15911,
+     21286,  22271,  17681,   8405,  -2979, -13293, -19974, -21865, -19323, -13776,  -7070,   -937,   3268,   4649,   2838,  -1867,
+     -5447,  -8439, -11634, -14371, -16014, -16072, -14281, -10666,  -5550,    482,   6664,  12156,  16174,  18109,  17624,  14718,
+      9734,   3321,  -3654, -10225, -15468, -18630, -19243, -17196, -12753,  -6518,    647,   7743,  13778,  17908,  19559,  18506,
+     14904,   9271,   2403,  -4733, -11143, -15945, -18495, -18474, -15931, -11264,  -5166,   1490,   7773,  12831,  16011,  16946,
+     15599,  12256,   7471,   1972,  -3454,  -8084, -11365, -12996, -12958, -11511,  -9132,  -6434,  -4047,  -2519,  -2211,  -3238,
+     -8808,  -8470,  -7959,  -7293,  -6493,  -5586,  -4602,  -3573,  -2532,  -1512,   -545,    341,   1119,   1770,   2277,   2629,
+      2824,   2862,   2751,   2505,   2141,   1683,   1156,    587,      4,   -562,  -1086,  -1543,  -1911,  -2173,  -2317,  -2336,
+     -2230,  -2003,  -1665,  -1233,   -725,   -166,    418,    998,   1547,   2035,   2436,   2727,   2889,   2905,   2766,   2468,
+      2014,   1411,    673,   -180,  -1124,  -2132,  -3172,  -4213,  -5220,  -6161,  -7006,  -7726,  -8298,  -8703,  -8927,  -8962,
+     -4839,  -4784,  -4697,  -4580,  -4434,  -4260,  -4060,  -3836,  -3590,  -3324,  -3041,  -2744,  -2435,  -2117,  -1795,  -1470,
+     -1145,   -825,   -511,   -208,     83,    357,    614,    849,   1062,   1249,   1410,   1541,   1644,   1715,   1755,   1763,
+      1739,   1683,   1597,   1480,   1334,   1160,    960,    735,    489,    223,    -60,   -357,   -666,   -983,  -1306,  -1631,
+     -1955,  -2276,  -2589,  -2893,  -3183,  -3458,  -3714,  -3950,  -4162,  -4350,  -4510,  -4642,  -4744,  -4815,  -4855,  -4863,
+    
+    // Frame 29
+     -6684, -31324, -23995, -27122, -23392, -24872, -22099, -22950, -20622, -21141, -19071, -19385, -17483, -17657, -15872, -15946,
+    -14247, -14246, -12614, -12554, -10973, -10868,  -9328,  -9186,  -7679,  -7508,  -6027,  -5832,  -4372,  -4159,  -2715,  -2488,
+     -1056,   -818,    605,    849,   2268,   2515,   3932,   4178,   5599,   5840,   7267,   7500,   8938,   9157,  10612,  10811,
+     12289,  12461,  13971,  14105,  15659,  15742,  17357,  17367,  19068,  18976,  20802,  20553,  22578,  22070,  24447,  23437,
+     26584,  24240,  30299,  14776, -29733, -25049, -26729, -24102, -24645, -22709, -22791, -21184, -21020, -19603, -19287, -17994,
+    -17576, -16369, -15878, -14734, -14188, -13091, -12504, -11444, -10823,  -9793,  -9146,  -8140,  -7471,  -6485,  -5798,  -4828,
+     -4127,  -3170,  -2456,  -1511,   -786,    149,    883,   1810,   2551,   3471,   4219,   5132,   5887,   6794,   7554,   8456,
+      9221,  10118,  10888,  11780,  12555,  13442,  14222,  15105,  15890,  16766,  17557,  18428,  19225,  20089,  20893,  21751,
+     22559,  23417,  24216,  25108,  25797,  27092,  25031, -22817, -27852, -25361, -25446, -23974, -23643, -22390, -21927, -20761,
+    -20238, -19114, -18560, -17460, -16887, -15801, -15218, -14139, -13552, -12476, -11887, -10811, -10223,  -9144,  -8561,  -7477,
+     -6899,  -5809,  -5239,  -4140,  -3579,  -2470,  -1920,   -799,   -262,    873,   1394,   2546,   3050,   4220,   4704,   5897,
+      6356,   7575,   8006,   9255,   9653,  10939,  11297,  12626,  12937,  14319,  14570,  16019,  16194,  17729,  17806,  19456,
+     19397,  21209,  20952,  23012,  22437,  24920,  23752,  27129,  24453,  30903, -11777, -30803, -24047, -26694, -23415, -24458,
+    -22115, -22541, -20636, -20733, -19085, -18976, -17498, -17245, -15891, -15530, -14271, -13825, -12643, -12127, -11010, -10433,
+     -9373,  -8741,  -7734,  -7052,  -6094,  -5363,  -4453,  -3674,  -2813,  -1985,  -1174,   -293,    462,   1401,   2095,   3100,
+      3723,   4805,   5342,   6521,   6948,   8254,   8533,  10013,  10081,  11825,  11555,  13748,  12846,  15999,  13449,  20202,
+     -6163, -30326, -22494, -24466, -20216, -20561, -17250, -16983, -14102, -13516, -10881, -10099,  -7624,  -6708,  -4349,  -3331,
+     -1062,     37,   2230,   3403,   5523,   6768,   8815,  10138,  12099,  13518,  15369,  16919,  18608,  20366,  21775,  23928,
+     24768,  27298, -17758, -28440, -22399, -23599, -19694, -19935, -16571, -16468, -13337, -13070, -10058,  -9704,  -6755,  -6358,
+     -3436,  -3025,   -104,    296,   3240,   3604,   6597,   6898,   9971,  10171,  13371,  13409,  16818,  16582,  20363,  19597,
+     24191,  22018,  29675,  13528, -29131, -23742, -24250, -21201, -20462, -18172, -16920, -15003, -13464, -11777, -10048,  -8524,
+     -6651,  -5257,  -3263,  -1985,    123,   1288,   3510,   4555,   6906,   7811,  10317,  11046,  13759,  14239,  17258,  17347,
+     20887,  20245,  24895,  22346,  31134,  -5841, -30876, -21848, -24600, -19748, -20599, -16838, -16987, -13710, -13511, -10488,
+    -10103,  -7214,  -6738,  -3904,  -3406,   -561,   -109,   2821,   3142,   6263,   6311,   9824,   9291,  13718,  11577,  19573,
+     -5658, -28818, -19006, -19639, -13379, -12434,  -7043,  -5581,   -494,   1121,   6183,   7693,  13014,  14050,  20200,  19699,
+     29258,  -9202, -28348, -18290, -19092, -12693, -11874,  -6366,  -5008,    163,   1723,   6793,   8371,  13505,  14922,  20344,
+     21308,  26876, -18305, -25240, -19328, -17115, -13285, -10113,  -6852,  -3287,   -331,   3495,   6203,  10290,  12695,  17185,
+     18947,  24802,  20594, -24064, -23202, -19177, -16454, -12436,  -9926,  -5615,  -3471,   1312,   2809,   8559,   8405,  17758,
+     -5850, -22583, -25197, -17750, -12593, -12014,  -9421,  -3743,   -318,    727,   4565,  10345,  12322,  12722,  19129,  26721,
+     19493,  -4427, -24679, -25412, -15660, -11604, -12547,  -8907,  -2132,    199,    473,   5506,  11726,  12335,  12749,  20914,
+     27475,  15801,  -9813, -26224, -23270, -14416, -12218, -12109,  -7147,  -1588,   -290,   1385,   7259,  11826,  11717,  14226,
+     23144,  26318,  11224, -13543, -26842, -22314, -13437, -11406, -11745,  -7013,   -558,   1048,   1108,   7058,  14909,  11500,
+     -4297, -13023, -19805, -22211, -19578, -13373,  -6405,  -1294,    954,   1410,   2426,   6002,  12279,  19074,  22846,  20595,
+     11680,  -1509, -14473, -22694, -23784, -18547, -10367,  -3278,    212,    336,   -353,   1247,   6687,  14765,  21948,  24207,
+     19263,   7976,  -5887, -17421, -22920, -21539, -15419,  -8274,  -3282,  -1464,  -1421,   -491,   3386,  10218,  17742,  22543,
+     21873,  15128,   4209,  -7400, -16253, -20381, -19822, -16092, -11074,  -6039,  -1379,   2941,   6642,   8756,   7948,   3407,
+     -2635,  -7208, -11675, -15220, -17143, -16980, -14584, -10157,  -4227,   2423,   8867,  14179,  17572,  18520,  16841,  12738,
+      6767,   -231,  -7257, -13297, -17468, -19154, -18096, -14433,  -8684,  -1673,   5590,  12056,  16792,  19116,  18696,  15602,
+     10291,   3537,  -3676, -10308, -15408, -18257, -18468, -16043, -11366,  -5139,   1717,   8208,  13411,  16609,  17390,  15709,
+     11877,   6514,    442,  -5440, -10298, -13489, -14652, -13765, -11131,  -7329,  -3113,    715,   3435,   4530,   3767,   1243,
+     -6287,  -5976,  -5547,  -5013,  -4394,  -3708,  -2980,  -2231,  -1486,   -768,    -99,    501,   1017,   1434,   1744,   1942,
+      2026,   2001,   1873,   1656,   1362,   1010,    619,    208,   -201,   -588,   -936,  -1227,  -1449,  -1590,  -1643,  -1608,
+     -1484,  -1277,   -998,   -659,   -275,    135,    551,    953,   1321,   1634,   1876,   2030,   2085,   2031,   1863,   1583,
+      1192,    700,    118,   -537,  -1247,  -1990,  -2743,  -3484,  -4187,  -4831,  -5394,  -5857,  -6206,  -6428,  -6517,  -6470,
+     -3540,  -3488,  -3413,  -3316,  -3198,  -3060,  -2904,  -2730,  -2542,  -2340,  -2126,  -1903,  -1672,  -1436,  -1198,   -959,
+      -721,   -488,   -261,    -42,    166,    362,    543,    708,    855,    983,   1090,   1177,   1240,   1281,   1299,   1293,
+      1264,   1211,   1136,   1039,    921,    783,    627,    454,    265,     63,   -151,   -374,   -604,   -840,  -1079,  -1318,
+     -1555,  -1789,  -2016,  -2235,  -2443,  -2638,  -2819,  -2984,  -3131,  -3259,  -3367,  -3453,  -3517,  -3558,  -3575,  -3569,
+    
+    // Frame 30
+     -4309, -31623, -23850, -27079, -23328, -24720, -22033, -22729, -20534, -20864, -18951, -19057, -17327, -17281, -15679, -15523,
+    -14016, -13778, -12343, -12041, -10663, -10310,  -8978,  -8583,  -7289,  -6859,  -5598,  -5138,  -3904,  -3418,  -2209,  -1700,
+      -512,     17,   1185,   1733,   2883,   3448,   4581,   5164,   6280,   6879,   7978,   8595,   9677,  10310,  11374,  12027,
+     13071,  13745,  14766,  15465,  16458,  17188,  18147,  18916,  19830,  20651,  21503,  22399,  23158,  24172,  24780,  25984,
+     26414,  26777, -20259, -28765, -24810, -25875, -23583, -23912, -22033, -22099, -20402, -20336, -18738, -18595, -17058, -16866,
+    -15370, -15144, -13675, -13427, -11976, -11713, -10275, -10002,  -8571,  -8293,  -6865,  -6586,  -5157,  -4881,  -3448,  -3177,
+     -1738,  -1474,    -25,    227,   1688,   1926,   3404,   3624,   5121,   5319,   6841,   7011,   8564,   8701,  10290,  10386,
+     12021,  12067,  13758,  13740,  15503,  15403,  17261,  17051,  19037,  18675,  20845,  20257,  22709,  21758,  24698,  23056,
+     27049,  23598,  31525,   8356, -31424, -24189, -27068, -23623, -24727, -22320, -22740, -20819, -20875, -19238, -19066, -17615,
+    -17288, -15969, -15528, -14309, -13780, -12639, -12040, -10962, -10305,  -9281,  -8574,  -7596,  -6846,  -5909,  -5120,  -4220,
+     -3396,  -2530,  -1673,   -839,     50,    852,   1773,   2543,   3496,   4234,   5219,   5924,   6944,   7612,   8670,   9299,
+     10398,  10983,  12130,  12663,  13866,  14337,  15610,  16003,  17363,  17657,  19132,  19291,  20927,  20889,  22771,  22418,
+     24719,  23777,  26969,  24524,  30782, -11661, -30886, -23885, -26738, -23207, -24464, -21859, -22510, -20332, -20666, -18733,
+    -18873, -17096, -17107, -15439, -15359, -13767, -13621, -12086, -11892, -10399, -10168,  -8706,  -8449,  -7009,  -6734,  -5309,
+     -5022,  -3605,  -3314,  -1899,  -1608,   -189,     95,   1524,   1794,   3240,   3489,   4961,   5180,   6687,   6865,   8419,
+      8543,  10160,  10209,  11914,  11861,  13688,  13488,  15493,  15072,  17356,  16573,  19346,  17868,  21704,  18392,  26248,
+     -3412, -30889, -22031, -24630, -19803, -20565, -16799, -16870, -13588, -13305, -10290,  -9800,  -6948,  -6331,  -3577,  -2885,
+      -185,    542,   3224,   3952,   6651,   7343,  10100,  10708,  13580,  14033,  17114,  17282,  20761,  20351,  24724,  22772,
+     30377, -10781, -29944, -22026, -24017, -19663, -20029, -16609, -16371, -13370, -12827, -10056,  -9335,  -6703,  -5872,  -3329,
+     -2427,     61,   1005,   3461,   4428,   6870,   7843,  10287,  11249,  13714,  14644,  17154,  18024,  20612,  21382,  24083,
+     24820,  26220, -20959, -26955, -23277, -22465, -20298, -18819, -17029, -15305, -13689, -11833, -10323,  -8378,  -6945,  -4931,
+     -3562,  -1487,   -178,   1957,   3205,   5404,   6582,   8857,   9951,  12324,  13303,  15814,  16619,  19359,  19844,  23070,
+     22715,  27792,  19297, -26648, -24849, -23804, -21614, -20226, -18328, -16711, -14997, -13225, -11647,  -9753,  -8289,  -6284,
+     -4930,  -2814,  -1576,    665,   1766,   4159,   5088,   7682,   8369,  11261,  11569,  14966,  14565,  19037,  16788,  25299,
+     -3726, -28496, -19289, -18849, -13627, -11383,  -7204,  -4270,   -595,   2741,   6063,   9746,  12677,  16875,  18980,  24951,
+     19265, -25782, -21850, -19733, -15106, -12823,  -8320,  -5991,  -1463,    773,   5469,   7445,  12524,  13931,  19898,  19778,
+     28906, -10839, -27795, -18336, -18458, -12588, -11009,  -6182,  -3858,    369,   3233,   6919,  10386,  13322,  17843,  19048,
+     27248,  10831, -29823, -18846, -20704, -13003, -13362,  -6461,  -6387,    323,    388,   7312,   6903,  14710,  12612,  24327,
+     -2215, -22228, -26283, -17347, -11405, -11883,  -9474,  -2782,    630,   1104,   5494,  11583,  12723,  13823,  22069,  26585,
+     11212, -15431, -27805, -20494, -12149, -12481, -11590,  -4445,    176,   -242,   3042,  10520,  12831,  11704,  18327,  27507,
+     19516,  -6310, -25487, -23838, -14784, -12606, -12325,  -6747,  -1422,   -787,   1596,   8431,  12020,  11041,  15473,  25512,
+     24518,   4392, -18701, -26006, -19599, -13041, -11000,  -9181,  -5310,   -791,   2985,   5223,   7245,  12697,  19514,  16337,
+     -1370, -12717, -20944, -23196, -19344, -11927,  -4638,   -226,    952,    904,   2505,   7434,  14801,  21335,  23094,  17753,
+      6146,  -7861, -19165, -23927, -21395, -14073,  -6132,  -1034,    305,   -246,    513,   4865,  12471,  20255,  23981,  20653,
+     10348,  -3573, -16028, -22716, -22155, -16173,  -8624,  -3107,  -1030,  -1081,   -376,   3465,  10568,  18438,  23208,  21778,
+     13630,   1258, -11014, -19144, -21237, -18157, -12621,  -7430,  -3914,  -1503,   1388,   5814,  11134,  15030,  14762,   8927,
+      -967,  -6860, -12197, -16092, -17865, -17161, -14000,  -8785,  -2241,   4688,  10987,  15716,  18162,  17942,  15070,   9955,
+      3344,  -3789, -10387, -15466, -18268, -18369, -15749, -10792,  -4232,   2958,   9709,  15018,  18098,  18493,  16148,  11415,
+      5005,  -2128,  -8923, -14372, -17674, -18349, -16313, -11884,  -5735,   1208,   7912,  13384,  16828,  17756,  16065,  12040,
+      6316,   -229,  -6607, -11873, -15269, -16337, -14990, -11516,  -6534,   -894,   4461,   8639,  10943,  10981,   8725,   4521,
+     -3319,  -3122,  -2865,  -2557,  -2208,  -1830,  -1434,  -1033,   -641,   -268,     73,    374,    626,    823,    961,   1039,
+      1057,   1018,    927,    792,    621,    423,    210,     -9,   -222,   -419,   -590,   -728,   -825,   -878,   -883,   -842,
+      -754,   -625,   -460,   -267,    -54,    166,    386,    592,    774,    923,   1030,   1086,   1087,   1028,    909,    730,
+       493,    206,   -125,   -491,   -881,  -1282,  -1684,  -2072,  -2434,  -2759,  -3035,  -3255,  -3410,  -3496,  -3509,  -3449,
+     -1913,  -1879,  -1833,  -1776,  -1708,  -1629,  -1540,  -1443,  -1338,  -1226,  -1109,   -987,   -861,   -733,   -605,   -476,
+      -349,   -225,   -104,     11,    120,    222,    316,    401,    475,    539,    592,    633,    662,    678,    682,    673,
+       652,    618,    572,    515,    446,    368,    279,    182,     77,    -35,   -152,   -274,   -400,   -528,   -657,   -785,
+      -912,  -1037,  -1157,  -1272,  -1381,  -1483,  -1577,  -1662,  -1736,  -1800,  -1853,  -1894,  -1923,  -1939,  -1943,  -1934,
+    
+    // Frame 31
+     -1722, -32127, -23510, -27224, -23084, -24741, -21803, -22665, -20296, -20729, -18696, -18857, -17051, -17019, -15378, -15202,
+    -13689, -13398, -11990, -11603, -10283,  -9814,  -8571,  -8030,  -6855,  -6249,  -5136,  -4470,  -3416,  -2692,  -1695,   -916,
+        27,    861,   1749,   2638,   3471,   4415,   5191,   6194,   6909,   7975,   8625,   9760,  10338,  11548,  12045,  13343,
+     13744,  15147,  15433,  16964,  17105,  18802,  18751,  20674,  20351,  22611,  21858,  24687,  23139,  27170,  23565,  32073,
+     -1722, -32127, -23510, -27224, -23084, -24741, -21803, -22665, -20296, -20729, -18696, -18857, -17051, -17019, -15378, -15202,
+    -13689, -13398, -11990, -11603, -10283,  -9814,  -8571,  -8030,  -6855,  -6249,  -5136,  -4470,  -3416,  -2692,  -1695,   -916,
+        27,    861,   1749,   2638,   3471,   4415,   5191,   6194,   6909,   7975,   8625,   9760,  10338,  11548,  12045,  13343,
+     13744,  15147,  15433,  16964,  17105,  18802,  18751,  20674,  20351,  22611,  21858,  24687,  23139,  27170,  23565,  32073,
+     -1722, -32127, -23510, -27224, -23084, -24741, -21803, -22665, -20296, -20729, -18696, -18857, -17051, -17019, -15378, -15202,
+    -13689, -13398, -11990, -11603, -10283,  -9814,  -8571,  -8030,  -6855,  -6249,  -5136,  -4470,  -3416,  -2692,  -1695,   -916,
+        27,    861,   1749,   2638,   3471,   4415,   5191,   6194,   6909,   7975,   8625,   9760,  10338,  11548,  12045,  13343,
+     13744,  15147,  15433,  16964,  17105,  18802,  18751,  20674,  20351,  22611,  21858,  24687,  23139,  27170,  23565,  32073,
+     -1722, -32127, -23510, -27224, -23084, -24741, -21803, -22665, -20296, -20729, -18696, -18857, -17051, -17019, -15378, -15202,
+    -13689, -13398, -11990, -11603, -10283,  -9814,  -8571,  -8030,  -6855,  -6249,  -5136,  -4470,  -3416,  -2692,  -1695,   -916,
+        27,    861,   1749,   2638,   3471,   4415,   5191,   6194,   6909,   7975,   8625,   9760,  10338,  11548,  12045,  13343,
+     13744,  15147,  15433,  16964,  17105,  18802,  18751,  20674,  20351,  22611,  21858,  24687,  23139,  27170,  23565,  32073,
+      -847, -31253, -21781, -24564, -19637, -20301, -16638, -16445, -13412, -12727, -10097,  -9070,  -6740,  -5444,  -3361,  -1831,
+        27,   1777,   3415,   5389,   6794,   9016,  10152,  12673,  13467,  16391,  16692,  20247,  19692,  24509,  21836,  31198,
+      -847, -31253, -21781, -24564, -19637, -20301, -16638, -16445, -13412, -12727, -10097,  -9070,  -6740,  -5444,  -3361,  -1831,
+        27,   1777,   3415,   5389,   6794,   9016,  10152,  12673,  13467,  16391,  16692,  20247,  19692,  24509,  21836,  31198,
+      -847, -31253, -21781, -24564, -19637, -20301, -16638, -16445, -13412, -12727, -10097,  -9070,  -6740,  -5444,  -3361,  -1831,
+        27,   1777,   3415,   5389,   6794,   9016,  10152,  12673,  13467,  16391,  16692,  20247,  19692,  24509,  21836,  31198,
+      -847, -31253, -21781, -24564, -19637, -20301, -16638, -16445, -13412, -12727, -10097,  -9070,  -6740,  -5444,  -3361,  -1831,
+        27,   1777,   3415,   5389,   6794,   9016,  10152,  12673,  13467,  16391,  16692,  20247,  19692,  24509,  21836,  31198,
+      -410, -29452, -18392, -19148, -12870, -11259,  -6513,  -3746,     27,   3691,   6567,  11204,  12924,  19094,  18446,  29397,
+      -410, -29452, -18392, -19148, -12870, -11259,  -6513,  -3746,     27,   3691,   6567,  11204,  12924,  19094,  18446,  29397,
+      -410, -29452, -18392, -19148, -12870, -11259,  -6513,  -3746,     27,   3691,   6567,  11204,  12924,  19094,  18446,  29397,
+      -410, -29452, -18392, -19148, -12870, -11259,  -6513,  -3746,     27,   3691,   6567,  11204,  12924,  19094,  18446,  29397,
+      -246, -23197, -25680, -15993, -11906, -12362,  -7862,  -1546,    -27,   1557,   7917,  12325,  11851,  16075,  25735,  22922,
+      -246, -23197, -25680, -15993, -11906, -12362,  -7862,  -1546,    -27,   1557,   7917,  12325,  11851,  16075,  25735,  22922,
+      -246, -23197, -25680, -15993, -11906, -12362,  -7862,  -1546,    -27,   1557,   7917,  12325,  11851,  16075,  25735,  22922,
+      -246, -23197, -25680, -15993, -11906, -12362,  -7862,  -1546,    -27,   1557,   7917,  12325,  11851,  16075,  25735,  22922,
+      -137, -13234, -21574, -22770, -17790, -10130,  -3679,   -535,    -27,    504,   3702,  10194,  17845,  22751,  21442,  13001,
+      -137, -13234, -21574, -22770, -17790, -10130,  -3679,   -535,    -27,    504,   3702,  10194,  17845,  22751,  21442,  13001,
+      -137, -13234, -21574, -22770, -17790, -10130,  -3679,   -535,    -27,    504,   3702,  10194,  17845,  22751,  21442,  13001,
+      -137, -13234, -21574, -22770, -17790, -10130,  -3679,   -535,    -27,    504,   3702,  10194,  17845,  22751,  21442,  13001,
+       -82,  -6896, -12665, -16510, -17845, -16468, -12588,  -6795,     27,   6842,  12610,  16455,  17790,  16413,  12533,   6741,
+       -82,  -6896, -12665, -16510, -17845, -16468, -12588,  -6795,     27,   6842,  12610,  16455,  17790,  16413,  12533,   6741,
+       -82,  -6896, -12665, -16510, -17845, -16468, -12588,  -6795,     27,   6842,  12610,  16455,  17790,  16413,  12533,   6741,
+       -82,  -6896, -12665, -16510, -17845, -16468, -12588,  -6795,     27,   6842,  12610,  16455,  17790,  16413,  12533,   6741,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+       -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,    -27,
+    
+};
+
+alignas(4) const int16_t wavetableSet_Vowel[16 * FrameMip::FRAME_SIZE] = {
+    // Frame 0
+         0,  12639,  22091,  27422,  28665,  27231,  24938,  23476,  23558,  24867,  26131,  25858,  22891,  17030,   9049,    515,
+     -6877, -11829, -13938, -13702, -12299, -11016, -10789, -11808, -13558, -15039, -15271, -13677, -10368,  -6068,  -1866,   1237,
+      2665,   2483,   1306,     48,   -469,    193,   1926,   4183,   6202,   7355,   7367,   6434,   5098,   4032,   3739,   4374,
+      5669,   7070,   7939,   7818,   6581,   4477,   2000,   -294,  -2013,  -3039,  -3560,  -3937,  -4545,  -5588,  -7019,  -8539,
+     -9729, -10194,  -9728,  -8373,  -6409,  -4228,  -2209,   -578,    639,   1595,   2520,   3607,   4913,   6326,   7603,   8466,
+      8702,   8249,   7212,   5825,   4362,   3051,   1995,   1172,    456,   -297,  -1189,  -2217,  -3282,  -4217,  -4860,  -5105,
+     -4952,  -4494,  -3888,  -3291,  -2814,  -2486,  -2261,  -2041,  -1733,  -1279,   -685,    -15,    635,   1173,   1547,   1756,
+      1846,   1894,   1968,   2112,   2324,   2565,   2771,   2879,   2844,   2655,   2333,   1924,   1480,   1050,    660,    316,
+         0,   -316,   -660,  -1050,  -1480,  -1924,  -2333,  -2655,  -2844,  -2879,  -2771,  -2565,  -2324,  -2112,  -1968,  -1894,
+     -1846,  -1756,  -1547,  -1173,   -635,     15,    685,   1279,   1733,   2041,   2261,   2486,   2814,   3291,   3888,   4494,
+      4952,   5105,   4860,   4217,   3282,   2217,   1189,    297,   -456,  -1172,  -1995,  -3051,  -4362,  -5825,  -7212,  -8249,
+     -8702,  -8466,  -7603,  -6326,  -4913,  -3607,  -2520,  -1595,   -639,    578,   2209,   4228,   6409,   8373,   9728,  10194,
+      9729,   8539,   7019,   5588,   4545,   3937,   3560,   3039,   2013,    294,  -2000,  -4477,  -6581,  -7818,  -7939,  -7070,
+     -5669,  -4374,  -3739,  -4032,  -5098,  -6434,  -7367,  -7355,  -6202,  -4183,  -1926,   -193,    469,    -48,  -1306,  -2483,
+     -2665,  -1237,   1866,   6068,  10368,  13677,  15271,  15039,  13558,  11808,  10789,  11016,  12299,  13702,  13938,  11829,
+      6877,   -515,  -9049, -17030, -22891, -25858, -26131, -24867, -23558, -23476, -24938, -27231, -28665, -27422, -22091, -12639,
+         0,  22171,  28632,  24974,  23539,  26154,  22878,   9066,  -6887, -13925, -12307, -10778, -13564, -15262, -10373,  -1859,
+      2660,   1312,   -474,   1931,   6199,   7372,   5095,   3743,   5666,   7943,   6579,   2004,  -2015,  -3557,  -4547,  -7016,
+     -9731,  -9725,  -6410,  -2207,    637,   2522,   4911,   7605,   8701,   7214,   4361,   1997,    455,  -1187,  -3283,  -4858,
+     -4953,  -3887,  -2815,  -2260,  -1734,   -684,    634,   1548,   1846,   1969,   2324,   2771,   2844,   2333,   1480,    660,
+         0,   -660,  -1480,  -2333,  -2844,  -2771,  -2324,  -1969,  -1846,  -1548,   -634,    684,   1734,   2260,   2815,   3887,
+      4953,   4858,   3283,   1187,   -455,  -1997,  -4361,  -7214,  -8701,  -7605,  -4911,  -2522,   -637,   2207,   6410,   9725,
+      9731,   7016,   4547,   3557,   2015,  -2004,  -6579,  -7943,  -5666,  -3743,  -5095,  -7372,  -6199,  -1931,    474,  -1312,
+     -2660,   1859,  10373,  15262,  13564,  10778,  12307,  13925,   6887,  -9066, -22878, -26154, -23539, -24974, -28632, -22171,
+         0,  28955,  23318,  23103,  -7055, -12140, -13694, -10244,   2556,   -370,   6115,   5179,   5597,   6648,  -2073,  -4489,
+     -9779,  -6362,    597,   4951,   8668,   4393,    429,  -3257,  -4974,  -2795,  -1749,    648,   1836,   2332,   2839,   1483,
+         0,  -1483,  -2839,  -2332,  -1836,   -648,   1749,   2795,   4974,   3257,   -429,  -4393,  -8668,  -4951,   -597,   6362,
+      9779,   4489,   2073,  -6648,  -5597,  -5179,  -6115,    370,  -2556,  10244,  13694,  12140,   7055, -23103, -23318, -28955,
+         0,  24199,  30290,  16746,  -2716, -14159, -14104,  -7656,  -1070,   2753,   4375,   5532,   6381,   4956,      6,  -6151,
+     -9030,  -6309,     57,   5816,   7676,   5107,    286,  -3557,  -4542,  -3240,  -1306,    375,   1758,   2645,   2590,   1560,
+         0,  -1560,  -2590,  -2645,  -1758,   -375,   1306,   3240,   4542,   3557,   -286,  -5107,  -7676,  -5816,    -57,   6309,
+      9030,   6151,     -6,  -4956,  -6381,  -5532,  -4375,  -2753,   1070,   7656,  14104,  14159,   2716, -16746, -30290, -24199,
+         0,  12116,  18624,  16666,   7493,  -4259, -12944, -14709,  -9275,    141,   8649,  12212,   9576,   2650,  -4739,  -8937,
+     -8272,  -3672,   2106,   6084,   6591,   3919,   -120,  -3359,  -4426,  -3289,   -986,   1151,   2256,   2238,   1558,    739,
+         0,   -739,  -1558,  -2238,  -2256,  -1151,    986,   3289,   4426,   3359,    120,  -3919,  -6591,  -6084,  -2106,   3672,
+      8272,   8937,   4739,  -2650,  -9576, -12212,  -8649,   -141,   9275,  14709,  12944,   4259,  -7493, -16666, -18624, -12116,
+         0,    382,    720,    976,   1125,   1153,   1063,    873,    614,    323,     40,   -198,   -363,   -440,   -424,   -328,
+      -174,      8,    187,    332,    421,    441,    390,    281,    132,    -30,   -178,   -288,   -341,   -331,   -261,   -143,
+         0,    143,    261,    331,    341,    288,    178,     30,   -132,   -281,   -390,   -441,   -421,   -332,   -187,     -8,
+       174,    328,    424,    440,    363,    198,    -40,   -323,   -614,   -873,  -1063,  -1153,  -1125,   -976,   -720,   -382,
+         0,     64,    127,    185,    238,    284,    321,    349,    366,    373,    370,    356,    334,    303,    266,    223,
+       177,    129,     81,     35,     -7,    -45,    -76,   -100,   -116,   -124,   -125,   -117,   -103,    -83,    -58,    -30,
+         0,     30,     58,     83,    103,    117,    125,    124,    116,    100,     76,     45,      7,    -35,    -81,   -129,
+      -177,   -223,   -266,   -303,   -334,   -356,   -370,   -373,   -366,   -349,   -321,   -284,   -238,   -185,   -127,    -64,
+         0,     17,     34,     51,     68,     83,     98,    112,    125,    137,    147,    156,    163,    169,    173,    176,
+       177,    176,    173,    169,    163,    156,    147,    137,    125,    112,     98,     83,     68,     51,     34,     17,
+         0,    -17,    -34,    -51,    -68,    -83,    -98,   -112,   -125,   -137,   -147,   -156,   -163,   -169,   -173,   -176,
+      -177,   -176,   -173,   -169,   -163,   -156,   -147,   -137,   -125,   -112,    -98,    -83,    -68,    -51,    -34,    -17,
+    
+    // Frame 1
+         0,  12366,  21620,  26831,  27957,  26297,  23586,  21537,  21002,  21892,  23169,  23482,  21665,  17353,  11066,   4120,
+     -1930,  -5783,  -6907,  -5636,  -3056,   -524,    787,    330,  -1719,  -4563,  -7193,  -8765,  -8963,  -8056,  -6794,  -6036,
+     -6427,  -8094, -10620, -13167, -14812, -14854, -13084,  -9809,  -5746,  -1723,   1588,   3900,   5337,   6338,   7409,   8903,
+     10841,  12911,  14571,  15280,  14690,  12807,   9972,   6769,   3804,   1527,     92,   -643,  -1031,  -1456,  -2184,  -3249,
+     -4466,  -5503,  -6045,  -5916,  -5165,  -4047,  -2942,  -2204,  -2048,  -2468,  -3262,  -4103,  -4673,  -4764,  -4351,  -3575,
+     -2675,  -1882,  -1331,  -1004,   -761,   -392,    275,   1307,   2620,   4010,   5215,   6011,   6278,   6043,   5453,   4718,
+      4029,   3496,   3114,   2786,   2374,   1770,    946,    -21,   -982,  -1764,  -2236,  -2360,  -2204,  -1914,  -1663,  -1585,
+     -1733,  -2061,  -2449,  -2757,  -2876,  -2775,  -2504,  -2174,  -1907,  -1781,  -1801,  -1894,  -1933,  -1795,  -1406,   -776,
+         0,    776,   1406,   1795,   1933,   1894,   1801,   1781,   1907,   2174,   2504,   2775,   2876,   2757,   2449,   2061,
+      1733,   1585,   1663,   1914,   2204,   2360,   2236,   1764,    982,     21,   -946,  -1770,  -2374,  -2786,  -3114,  -3496,
+     -4029,  -4718,  -5453,  -6043,  -6278,  -6011,  -5215,  -4010,  -2620,  -1307,   -275,    392,    761,   1004,   1331,   1882,
+      2675,   3575,   4351,   4764,   4673,   4103,   3262,   2468,   2048,   2204,   2942,   4047,   5165,   5916,   6045,   5503,
+      4466,   3249,   2184,   1456,   1031,    643,    -92,  -1527,  -3804,  -6769,  -9972, -12807, -14690, -15280, -14571, -12911,
+    -10841,  -8903,  -7409,  -6338,  -5337,  -3900,  -1588,   1723,   5746,   9809,  13084,  14854,  14812,  13167,  10620,   8094,
+      6427,   6036,   6794,   8056,   8963,   8765,   7193,   4563,   1719,   -330,   -787,    524,   3056,   5636,   6907,   5783,
+      1930,  -4120, -11066, -17353, -21665, -23482, -23169, -21892, -21002, -21537, -23586, -26297, -27957, -26831, -21620, -12366,
+         0,  21699,  27924,  23623,  20983,  23192,  21652,  11082,  -1940,  -6894,  -3064,    797,  -1725,  -7185,  -8968,  -6786,
+     -6432, -10614, -14816, -13078,  -5750,   1593,   5334,   7414,  10838,  14575,  14688,   9976,   3801,     95,  -1033,  -2181,
+     -4468,  -6043,  -5166,  -2940,  -2050,  -3260,  -4674,  -4349,  -2677,  -1329,   -762,    277,   2618,   5217,   6277,   5454,
+      4028,   3115,   2373,    947,   -983,  -2235,  -2205,  -1662,  -1734,  -2449,  -2877,  -2504,  -1907,  -1801,  -1933,  -1406,
+         0,   1406,   1933,   1801,   1907,   2504,   2877,   2449,   1734,   1662,   2205,   2235,    983,   -947,  -2373,  -3115,
+     -4028,  -5454,  -6277,  -5217,  -2618,   -277,    762,   1329,   2677,   4349,   4674,   3260,   2050,   2940,   5166,   6043,
+      4468,   2181,   1033,    -95,  -3801,  -9976, -14688, -14575, -10838,  -7414,  -5334,  -1593,   5750,  13078,  14816,  10614,
+      6432,   6786,   8968,   7185,   1725,   -797,   3064,   6894,   1940, -11082, -21652, -23192, -20983, -23623, -27924, -21699,
+         0,  28235,  20777,  21861,  -2093,  -2912,  -1842,  -8852,  -6524, -14723,  -5825,   5410,  10777,  14750,   3751,   -982,
+     -4510,  -5124,  -2084,  -4639,  -2705,   -734,   2596,   6300,   4011,   2390,   -996,  -2192,  -1742,  -2870,  -1911,  -1931,
+         0,   1931,   1911,   2870,   1742,   2192,    996,  -2390,  -4011,  -6300,  -2596,    734,   2705,   4639,   2084,   5124,
+      4510,    982,  -3751, -14750, -10777,  -5410,   5825,  14723,   6524,   8852,   1842,   2912,   2093, -21861, -20777, -28235,
+         0,  23120,  28060,  15669,   1495,  -3788,  -3451,  -5386, -10360, -12195,  -6369,   4420,  12604,  12590,   5627,  -1856,
+     -4851,  -4067,  -3232,  -3670,  -3360,   -652,   3175,   5420,   4724,   1970,   -791,  -2112,  -2211,  -2217,  -2378,  -1762,
+         0,   1762,   2378,   2217,   2211,   2112,    791,  -1970,  -4724,  -5420,  -3175,    652,   3360,   3670,   3232,   4067,
+      4851,   1856,  -5627, -12590, -12604,  -4420,   6369,  12195,  10360,   5386,   3451,   3788,  -1495, -15669, -28060, -23120,
+         0,  11400,  18482,  18715,  12348,   2206,  -7599, -13422, -13511,  -8532,  -1037,   5798,   9515,   9244,   5778,    956,
+     -3254,  -5537,  -5565,  -3855,  -1344,   1067,   2776,   3532,   3334,   2333,    780,   -964,  -2446,  -3216,  -2991,  -1795,
+         0,   1795,   2991,   3216,   2446,    964,   -780,  -2333,  -3334,  -3532,  -2776,  -1067,   1344,   3855,   5565,   5537,
+      3254,   -956,  -5778,  -9244,  -9515,  -5798,   1037,   8532,  13511,  13422,   7599,  -2206, -12348, -18715, -18482, -11400,
+         0,    612,   1152,   1555,   1778,   1800,   1628,   1293,    848,    358,   -110,   -495,   -749,   -846,   -786,   -590,
+      -298,     37,    357,    612,    761,    785,    683,    476,    201,    -94,   -361,   -555,   -647,   -622,   -487,   -267,
+         0,    267,    487,    622,    647,    555,    361,     94,   -201,   -476,   -683,   -785,   -761,   -612,   -357,    -37,
+       298,    590,    786,    846,    749,    495,    110,   -358,   -848,  -1293,  -1628,  -1800,  -1778,  -1555,  -1152,   -612,
+         0,     85,    167,    244,    314,    374,    422,    458,    481,    489,    484,    465,    434,    392,    342,    284,
+       222,    158,     94,     33,    -24,    -73,   -114,   -146,   -166,   -176,   -175,   -164,   -144,   -115,    -80,    -41,
+         0,     41,     80,    115,    144,    164,    175,    176,    166,    146,    114,     73,     24,    -33,    -94,   -158,
+      -222,   -284,   -342,   -392,   -434,   -465,   -484,   -489,   -481,   -458,   -422,   -374,   -314,   -244,   -167,    -85,
+         0,     22,     43,     64,     85,    105,    123,    141,    157,    172,    185,    196,    205,    213,    218,    221,
+       222,    221,    218,    213,    205,    196,    185,    172,    157,    141,    123,    105,     85,     64,     43,     22,
+         0,    -22,    -43,    -64,    -85,   -105,   -123,   -141,   -157,   -172,   -185,   -196,   -205,   -213,   -218,   -221,
+      -222,   -221,   -218,   -213,   -205,   -196,   -185,   -172,   -157,   -141,   -123,   -105,    -85,    -64,    -43,    -22,
+    
+    // Frame 2
+         0,  12078,  21102,  26132,  27049,  25036,  21749,  18919,  17550,  17801,  18905,  19703,  19075,  16521,  12305,   7446,
+      3267,    973,   1134,   3544,   7228,  10841,  13069,  13108,  10836,   6843,   2122,  -2269,  -5611,  -7689,  -8825,  -9642,
+    -10784, -12595, -14986, -17429, -19184, -19549, -18160, -15109, -10956,  -6524,  -2660,     49,   1404,   1636,   1248,    830,
+       812,   1354,   2301,   3307,   3983,   4094,   3643,   2900,   2278,   2198,   2906,   4397,   6387,   8425,  10018,  10806,
+     10645,   9649,   8110,   6395,   4805,   3499,   2455,   1527,    525,   -677,  -2079,  -3537,  -4817,  -5669,  -5933,  -5589,
+     -4777,  -3747,  -2788,  -2134,  -1901,  -2065,  -2491,  -2984,  -3373,  -3554,  -3519,  -3338,  -3118,  -2943,  -2843,  -2773,
+     -2637,  -2322,  -1751,   -915,    116,   1211,   2213,   2987,   3451,   3599,   3489,   3219,   2895,   2599,   2372,   2215,
+      2101,   1999,   1888,   1769,   1663,   1599,   1602,   1675,   1801,   1937,   2030,   2027,   1888,   1596,   1159,    610,
+         0,   -610,  -1159,  -1596,  -1888,  -2027,  -2030,  -1937,  -1801,  -1675,  -1602,  -1599,  -1663,  -1769,  -1888,  -1999,
+     -2101,  -2215,  -2372,  -2599,  -2895,  -3219,  -3489,  -3599,  -3451,  -2987,  -2213,  -1211,   -116,    915,   1751,   2322,
+      2637,   2773,   2843,   2943,   3118,   3338,   3519,   3554,   3373,   2984,   2491,   2065,   1901,   2134,   2788,   3747,
+      4777,   5589,   5933,   5669,   4817,   3537,   2079,    677,   -525,  -1527,  -2455,  -3499,  -4805,  -6395,  -8110,  -9649,
+    -10645, -10806, -10018,  -8425,  -6387,  -4397,  -2906,  -2198,  -2278,  -2900,  -3643,  -4094,  -3983,  -3307,  -2301,  -1354,
+      -812,   -830,  -1248,  -1636,  -1404,    -49,   2660,   6524,  10956,  15109,  18160,  19549,  19184,  17429,  14986,  12595,
+     10784,   9642,   8825,   7689,   5611,   2269,  -2122,  -6843, -10836, -13108, -13069, -10841,  -7228,  -3544,  -1134,   -973,
+     -3267,  -7446, -12305, -16521, -19075, -19703, -18905, -17801, -17550, -18919, -21749, -25036, -27049, -26132, -21102, -12078,
+         0,  21180,  27017,  21784,  17532,  18927,  19062,  12321,   3258,   1147,   7221,  13080,  10829,   2131,  -5617,  -8818,
+    -10789, -14979, -19189, -18154, -10960,  -2654,   1401,   1253,    809,   2306,   3981,   3647,   2276,   2909,   6385,  10021,
+     10643,   8113,   4803,   2458,    523,  -2077,  -4818,  -5931,  -4778,  -2787,  -1902,  -2489,  -3374,  -3517,  -3119,  -2842,
+     -2638,  -1750,    115,   2214,   3450,   3489,   2895,   2373,   2100,   1888,   1663,   1602,   1801,   2030,   1888,   1159,
+         0,  -1159,  -1888,  -2030,  -1801,  -1602,  -1663,  -1888,  -2100,  -2373,  -2895,  -3489,  -3450,  -2214,   -115,   1750,
+      2638,   2842,   3119,   3517,   3374,   2489,   1902,   2787,   4778,   5931,   4818,   2077,   -523,  -2458,  -4803,  -8113,
+    -10643, -10021,  -6385,  -2909,  -2276,  -3647,  -3981,  -2306,   -809,  -1253,  -1401,   2654,  10960,  18154,  19189,  14979,
+     10789,   8818,   5617,  -2131, -10829, -13080,  -7221,  -1147,  -3258, -12321, -19062, -18927, -17532, -21784, -27017, -21180,
+         0,  27317,  17338,  19257,   3117,   7361,  10724,  -5510, -10872, -19104, -11027,   1469,    755,   4037,   2231,   6432,
+     10606,   4842,    492,  -4786,  -4804,  -1877,  -3395,  -3099,  -2653,    130,   3439,   2906,   2093,   1669,   1797,   1890,
+         0,  -1890,  -1797,  -1669,  -2093,  -2906,  -3439,   -130,   2653,   3099,   3395,   1877,   4804,   4786,   -492,  -4842,
+    -10606,  -6432,  -2231,  -4037,   -755,  -1469,  11027,  19104,  10872,   5510, -10724,  -7361,  -3117, -19257, -17338, -27317,
+         0,  21811,  24861,  13451,   5725,   7674,   8121,  -1589, -14355, -17728, -10082,   -673,   2957,   2311,   3088,   6812,
+      9229,   6284,   -262,  -4725,  -4465,  -2529,  -2553,  -3674,  -2697,    565,   3081,   3072,   1972,   1690,   2029,   1587,
+         0,  -1587,  -2029,  -1690,  -1972,  -3072,  -3081,   -565,   2697,   3674,   2553,   2529,   4465,   4725,    262,  -6284,
+     -9229,  -6812,  -3088,  -2311,  -2957,    673,  10082,  17728,  14355,   1589,  -8121,  -7674,  -5725, -13451, -24861, -21811,
+         0,  10099,  17190,  19299,  16117,   9012,    430,  -7013, -11401, -12019,  -9366,  -4763,    226,   4294,   6678,   7188,
+      6070,   3825,   1060,  -1609,  -3629,  -4602,  -4376,  -3104,  -1217,    712,   2162,   2843,   2766,   2178,   1401,    658,
+         0,   -658,  -1401,  -2178,  -2766,  -2843,  -2162,   -712,   1217,   3104,   4376,   4602,   3629,   1609,  -1060,  -3825,
+     -6070,  -7188,  -6678,  -4294,   -226,   4763,   9366,  12019,  11401,   7013,   -430,  -9012, -16117, -19299, -17190, -10099,
+         0,   1308,   2450,   3284,   3710,   3685,   3228,   2418,   1377,    258,   -782,  -1602,  -2099,  -2220,  -1968,  -1405,
+      -632,    219,   1010,   1617,   1948,   1961,   1660,   1103,    386,   -371,  -1045,  -1526,  -1739,  -1654,  -1287,   -702,
+         0,    702,   1287,   1654,   1739,   1526,   1045,    371,   -386,  -1103,  -1660,  -1961,  -1948,  -1617,  -1010,   -219,
+       632,   1405,   1968,   2220,   2099,   1602,    782,   -258,  -1377,  -2418,  -3228,  -3685,  -3710,  -3284,  -2450,  -1308,
+         0,    127,    250,    365,    468,    557,    629,    681,    713,    724,    713,    683,    634,    570,    491,    403,
+       307,    209,    112,     19,    -66,   -141,   -202,   -248,   -278,   -291,   -287,   -267,   -233,   -186,   -130,    -67,
+         0,     67,    130,    186,    233,    267,    287,    291,    278,    248,    202,    141,     66,    -19,   -112,   -209,
+      -307,   -403,   -491,   -570,   -634,   -683,   -713,   -724,   -713,   -681,   -629,   -557,   -468,   -365,   -250,   -127,
+         0,     30,     60,     89,    118,    145,    171,    195,    217,    238,    256,    271,    284,    294,    302,    306,
+       307,    306,    302,    294,    284,    271,    256,    238,    217,    195,    171,    145,    118,     89,     60,     30,
+         0,    -30,    -60,    -89,   -118,   -145,   -171,   -195,   -217,   -238,   -256,   -271,   -284,   -294,   -302,   -306,
+      -307,   -306,   -302,   -294,   -284,   -271,   -256,   -238,   -217,   -195,   -171,   -145,   -118,    -89,    -60,    -30,
+    
+    // Frame 3
+         0,  11841,  20642,  25430,  26003,  23451,  19384,  15585,  13229,  12734,  13609,  14892,  15505,  14822,  12831,  10222,
+      8029,   7291,   8560,  11729,  15965,  20019,  22574,  22712,  20151,  15353,   9307,   3243,  -1792,  -5183,  -6904,  -7393,
+     -7351,  -7414,  -7945,  -8899,  -9913, -10467, -10153,  -8847,  -6814,  -4617,  -2956,  -2408,  -3246,  -5319,  -8119, -10914,
+    -12993, -13855, -13358, -11703,  -9355,  -6846,  -4618,  -2886,  -1622,   -611,    411,   1634,   3068,   4540,   5744,   6379,
+      6251,   5383,   4008,   2523,   1357,    857,   1167,   2213,   3715,   5303,   6616,   7418,   7637,   7369,   6804,   6153,
+      5553,   5038,   4532,   3909,   3056,   1942,    649,   -639,  -1696,  -2317,  -2401,  -1977,  -1210,   -347,    350,    688,
+       580,     73,   -692,  -1527,  -2263,  -2800,  -3125,  -3294,  -3400,  -3515,  -3660,  -3791,  -3816,  -3636,  -3191,  -2493,
+     -1640,   -789,   -119,    231,    198,   -179,   -776,  -1416,  -1929,  -2192,  -2166,  -1892,  -1469,  -1008,   -597,   -269,
+         0,    269,    597,   1008,   1469,   1892,   2166,   2192,   1929,   1416,    776,    179,   -198,   -231,    119,    789,
+      1640,   2493,   3191,   3636,   3816,   3791,   3660,   3515,   3400,   3294,   3125,   2800,   2263,   1527,    692,    -73,
+      -580,   -688,   -350,    347,   1210,   1977,   2401,   2317,   1696,    639,   -649,  -1942,  -3056,  -3909,  -4532,  -5038,
+     -5553,  -6153,  -6804,  -7369,  -7637,  -7418,  -6616,  -5303,  -3715,  -2213,  -1167,   -857,  -1357,  -2523,  -4008,  -5383,
+     -6251,  -6379,  -5744,  -4540,  -3068,  -1634,   -411,    611,   1622,   2886,   4618,   6846,   9355,  11703,  13358,  13855,
+     12993,  10914,   8119,   5319,   3246,   2408,   2956,   4617,   6814,   8847,  10153,  10467,   9913,   8899,   7945,   7414,
+      7351,   7393,   6904,   5183,   1792,  -3243,  -9307, -15353, -20151, -22712, -22574, -20019, -15965, -11729,  -8560,  -7291,
+     -8029, -10222, -12831, -14822, -15505, -14892, -13609, -12734, -13229, -15585, -19384, -23451, -26003, -25430, -20642, -11841,
+         0,  20720,  25971,  19419,  13210,  13631,  15493,  12847,   8019,   8573,  15958,  22584,  20145,   9315,  -1797,  -6897,
+     -7356,  -7939,  -9918, -10147,  -6817,  -2951,  -3249,  -8115, -12996, -13354,  -9358,  -4615,  -1625,    414,   3066,   5747,
+      6249,   4011,   1355,   1170,   3713,   6619,   7636,   6806,   5551,   4534,   3054,    651,  -1697,  -2399,  -1211,    352,
+       579,   -691,  -2264,  -3124,  -3401,  -3660,  -3817,  -3190,  -1640,   -118,    198,   -775,  -1929,  -2166,  -1469,   -597,
+         0,    597,   1469,   2166,   1929,    775,   -198,    118,   1640,   3190,   3817,   3660,   3401,   3124,   2264,    691,
+      -579,   -352,   1211,   2399,   1697,   -651,  -3054,  -4534,  -5551,  -6806,  -7636,  -6619,  -3713,  -1170,  -1355,  -4011,
+     -6249,  -5747,  -3066,   -414,   1625,   4615,   9358,  13354,  12996,   8115,   3249,   2951,   6817,  10147,   9918,   7939,
+      7356,   6897,   1797,  -9315, -20145, -22584, -15958,  -8573,  -8019, -12847, -15493, -13631, -13210, -19419, -25971, -20720,
+         0,  26262,  13027,  15678,   7889,  16088,  20048,  -1698,  -7432,  -9840,  -6878,  -3186, -13045,  -9306,  -1666,   3109,
+      6216,   1390,   3685,   7665,   5528,   3078,  -1715,  -1192,    565,  -2250,  -3411,  -3807,  -1647,    204,  -1933,  -1467,
+         0,   1467,   1933,   -204,   1647,   3807,   3411,   2250,   -565,   1192,   1715,  -3078,  -5528,  -7665,  -3685,  -1390,
+     -6216,  -3109,   1666,   9306,  13045,   3186,   6878,   9840,   7432,   1698, -20048, -16088,  -7889, -15678, -13027, -26262,
+         0,  20213,  20840,  10409,   9384,  17479,  16764,   2333, -10258,  -9815,  -4534,  -5972, -11201, -10051,  -1925,   4419,
+      4400,   2525,   3851,   6745,   6425,   2360,  -1156,  -1228,   -143,  -1332,  -3825,  -3917,  -1423,    -96,  -1363,  -2032,
+         0,   2032,   1363,     96,   1423,   3917,   3825,   1332,    143,   1228,   1156,  -2360,  -6425,  -6745,  -3851,  -2525,
+     -4400,  -4419,   1925,  10051,  11201,   5972,   4534,   9815,  10258,  -2333, -16764, -17479,  -9384, -10409, -20840, -20213,
+         0,   8557,  15167,  18451,  17955,  14196,   8397,   2046,  -3538,  -7490,  -9476,  -9590,  -8184,  -5718,  -2677,    452,
+      3189,   5113,   5946,   5631,   4371,   2568,    695,   -857,  -1880,  -2371,  -2466,  -2330,  -2071,  -1720,  -1255,   -668,
+         0,    668,   1255,   1720,   2071,   2330,   2466,   2371,   1880,    857,   -695,  -2568,  -4371,  -5631,  -5946,  -5113,
+     -3189,   -452,   2677,   5718,   8184,   9590,   9476,   7490,   3538,  -2046,  -8397, -14196, -17955, -18451, -15167,  -8557,
+         0,   4002,   7466,   9929,  11075,  10772,   9098,   6319,   2856,   -784,  -4080,  -6573,  -7935,  -8010,  -6838,  -4645,
+     -1800,   1236,   3988,   6034,   7075,   6971,   5765,   3672,   1043,  -1693,  -4096,  -5786,  -6498,  -6129,  -4747,  -2586,
+         0,   2586,   4747,   6129,   6498,   5786,   4096,   1693,  -1043,  -3672,  -5765,  -6971,  -7075,  -6034,  -3988,  -1236,
+      1800,   4645,   6838,   8010,   7935,   6573,   4080,    784,  -2856,  -6319,  -9098, -10772, -11075,  -9929,  -7466,  -4002,
+         0,    224,    440,    642,    824,    979,   1103,   1192,   1245,   1259,   1235,   1176,   1083,    961,    816,    653,
+       478,    299,    122,    -46,   -199,   -332,   -439,   -519,   -568,   -585,   -571,   -528,   -458,   -365,   -253,   -130,
+         0,    130,    253,    365,    458,    528,    571,    585,    568,    519,    439,    332,    199,     46,   -122,   -299,
+      -478,   -653,   -816,   -961,  -1083,  -1176,  -1235,  -1259,  -1245,  -1192,  -1103,   -979,   -824,   -642,   -440,   -224,
+         0,     47,     93,    139,    183,    226,    266,    304,    338,    370,    398,    422,    442,    458,    469,    476,
+       478,    476,    469,    458,    442,    422,    398,    370,    338,    304,    266,    226,    183,    139,     93,     47,
+         0,    -47,    -93,   -139,   -183,   -226,   -266,   -304,   -338,   -370,   -398,   -422,   -442,   -458,   -469,   -476,
+      -478,   -476,   -469,   -458,   -442,   -422,   -398,   -370,   -338,   -304,   -266,   -226,   -183,   -139,    -93,    -47,
+    
+    // Frame 4
+         0,  11593,  20150,  24670,  24897,  21857,  17130,  12546,   9412,   8344,   9059,  10749,  12370,  13187,  12955,  12071,
+     11294,  11477,  13128,  16222,  20096,  23690,  25830,  25664,  22897,  17943,  11764,   5623,    678,  -2301,  -3145,  -2238,
+      -369,   1586,   2910,   3264,   2697,   1578,    366,   -569,  -1117,  -1439,  -1900,  -2883,  -4627,  -7084,  -9914, -12552,
+    -14399, -14990, -14168, -12116,  -9322,  -6425,  -4041,  -2586,  -2196,  -2705,  -3750,  -4888,  -5754,  -6143,  -6054,  -5628,
+     -5074,  -4557,  -4134,  -3731,  -3190,  -2334,  -1073,    559,   2371,   4079,   5372,   6022,   5942,   5224,   4108,   2915,
+      1952,   1438,   1444,   1903,   2638,   3439,   4117,   4566,   4764,   4765,   4652,   4495,   4316,   4088,   3747,   3233,
+      2520,   1650,    719,   -134,   -774,  -1107,  -1116,   -858,   -455,    -54,    209,    252,     55,   -335,   -835,  -1347,
+     -1790,  -2116,  -2315,  -2398,  -2391,  -2309,  -2158,  -1934,  -1633,  -1265,   -860,   -467,   -141,     71,    149,    109,
+         0,   -109,   -149,    -71,    141,    467,    860,   1265,   1633,   1934,   2158,   2309,   2391,   2398,   2315,   2116,
+      1790,   1347,    835,    335,    -55,   -252,   -209,     54,    455,    858,   1116,   1107,    774,    134,   -719,  -1650,
+     -2520,  -3233,  -3747,  -4088,  -4316,  -4495,  -4652,  -4765,  -4764,  -4566,  -4117,  -3439,  -2638,  -1903,  -1444,  -1438,
+     -1952,  -2915,  -4108,  -5224,  -5942,  -6022,  -5372,  -4079,  -2371,   -559,   1073,   2334,   3190,   3731,   4134,   4557,
+      5074,   5628,   6054,   6143,   5754,   4888,   3750,   2705,   2196,   2586,   4041,   6425,   9322,  12116,  14168,  14990,
+     14399,  12552,   9914,   7084,   4627,   2883,   1900,   1439,   1117,    569,   -366,  -1578,  -2697,  -3264,  -2910,  -1586,
+       369,   2238,   3145,   2301,   -678,  -5623, -11764, -17943, -22897, -25664, -25830, -23690, -20096, -16222, -13128, -11477,
+    -11294, -12071, -12955, -13187, -12370, -10749,  -9059,  -8344,  -9412, -12546, -17130, -21857, -24897, -24670, -20150, -11593,
+         0,  20228,  24865,  17166,   9394,   9082,  12358,  12971,  11284,  13141,  20088,  25840,  22890,  11773,    673,  -3138,
+      -374,   2917,   2693,    371,  -1121,  -1895,  -4631,  -9910, -14401, -14164,  -9325,  -4037,  -2199,  -3747,  -5756,  -6051,
+     -5076,  -4132,  -3192,  -1070,   2369,   5375,   5940,   4110,   1951,   1446,   2637,   4119,   4763,   4653,   4315,   3748,
+      2520,    720,   -774,  -1115,   -455,    210,     55,   -835,  -1790,  -2314,  -2391,  -2158,  -1633,   -860,   -141,    149,
+         0,   -149,    141,    860,   1633,   2158,   2391,   2314,   1790,    835,    -55,   -210,    455,   1115,    774,   -720,
+     -2520,  -3748,  -4315,  -4653,  -4763,  -4119,  -2637,  -1446,  -1951,  -4110,  -5940,  -5375,  -2369,   1070,   3192,   4132,
+      5076,   6051,   5756,   3747,   2199,   4037,   9325,  14164,  14401,   9910,   4631,   1895,   1121,   -371,  -2693,  -2917,
+       374,   3138,   -673, -11773, -22890, -25840, -20088, -13141, -11284, -12971, -12358,  -9082,  -9394, -17166, -24865, -20228,
+         0,  25151,   9217,  12536,  11160,  20213,  22798,    766,   -445,   2767,  -1178,  -4571, -14448,  -9276,  -2237,  -5716,
+     -5108,  -3158,   2343,   5968,   1929,   2659,   4745,   4332,   2506,   -761,   -465,     64,  -1797,  -2385,  -1636,   -139,
+         0,    139,   1636,   2385,   1797,    -64,    465,    761,  -2506,  -4332,  -4745,  -2659,  -1929,  -5968,  -2343,   3158,
+      5108,   5716,   2237,   9276,  14448,   4571,   1178,  -2767,    445,   -766, -22798, -20213, -11160, -12536,  -9217, -25151,
+         0,  18500,  17239,   7983,  11613,  22206,  19411,   4605,  -2639,   1686,   2080,  -7290, -13563,  -8989,  -3059,  -4275,
+     -6676,  -2741,   3426,   4607,   2467,   2670,   4775,   4523,   1775,   -126,   -270,   -552,  -1634,  -2177,  -1513,   -543,
+         0,    543,   1513,   2177,   1634,    552,    270,    126,  -1775,  -4523,  -4775,  -2670,  -2467,  -4607,  -3426,   2741,
+      6676,   4275,   3059,   8989,  13563,   7290,  -2080,  -1686,   2639,  -4605, -19411, -22206, -11613,  -7983, -17239, -18500,
+         0,   7297,  13259,  16904,  17830,  16240,  12794,   8346,   3698,   -548,  -4021,  -6525,  -7961,  -8288,  -7537,  -5861,
+     -3554,  -1027,   1284,   3026,   4012,   4241,   3853,   3048,   2016,    908,   -156,  -1059,  -1669,  -1870,  -1605,   -925,
+         0,    925,   1605,   1870,   1669,   1059,    156,   -908,  -2016,  -3048,  -3853,  -4241,  -4012,  -3026,  -1284,   1027,
+      3554,   5861,   7537,   8288,   7961,   6525,   4021,    548,  -3698,  -8346, -12794, -16240, -17830, -16904, -13259,  -7297,
+         0,   5171,   9720,  13106,  14947,  15061,  13495,  10507,   6534,   2123,  -2146,  -5736,  -8232,  -9386,  -9149,  -7668,
+     -5254,  -2329,    638,   3207,   5029,   5891,   5747,   4711,   3033,   1051,   -868,  -2389,  -3265,  -3377,  -2748,  -1534,
+         0,   1534,   2748,   3377,   3265,   2389,    868,  -1051,  -3033,  -4711,  -5747,  -5891,  -5029,  -3207,   -638,   2329,
+      5254,   7668,   9149,   9386,   8232,   5736,   2146,  -2123,  -6534, -10507, -13495, -15061, -14947, -13106,  -9720,  -5171,
+         0,    416,    817,   1192,   1527,   1812,   2037,   2196,   2285,   2301,   2246,   2122,   1936,   1696,   1411,   1093,
+       756,    410,     71,   -250,   -540,   -789,   -989,  -1133,  -1216,  -1238,  -1198,  -1100,   -949,   -753,   -523,   -267,
+         0,    267,    523,    753,    949,   1100,   1198,   1238,   1216,   1133,    989,    789,    540,    250,    -71,   -410,
+      -756,  -1093,  -1411,  -1696,  -1936,  -2122,  -2246,  -2301,  -2285,  -2196,  -2037,  -1812,  -1527,  -1192,   -817,   -416,
+         0,     74,    147,    219,    289,    356,    420,    479,    534,    584,    628,    666,    698,    723,    741,    752,
+       756,    752,    741,    723,    698,    666,    628,    584,    534,    479,    420,    356,    289,    219,    147,     74,
+         0,    -74,   -147,   -219,   -289,   -356,   -420,   -479,   -534,   -584,   -628,   -666,   -698,   -723,   -741,   -752,
+      -756,   -752,   -741,   -723,   -698,   -666,   -628,   -584,   -534,   -479,   -420,   -356,   -289,   -219,   -147,    -74,
+    
+    // Frame 5
+         0,  11661,  20249,  24737,  24857,  21640,  16687,  11860,   8506,   7281,   7935,   9678,  11472,  12564,  12680,  12171,
+     11747,  12216,  14047,  17192,  20984,  24381,  26245,  25771,  22719,  17560,  11299,   5229,    515,  -2085,  -2439,   -982,
+      1436,   3873,   5554,   6098,   5533,   4227,   2664,   1262,    187,   -653,  -1559,  -2860,  -4760,  -7197,  -9842, -12164,
+    -13618, -13801, -12624, -10329,  -7454,  -4661,  -2573,  -1583,  -1785,  -2955,  -4662,  -6396,  -7734,  -8428,  -8455,  -7957,
+     -7170,  -6300,  -5466,  -4654,  -3769,  -2686,  -1348,    194,   1761,   3096,   3938,   4115,   3601,   2548,   1240,     29,
+      -771,   -954,   -481,    533,   1854,   3211,   4363,   5161,   5556,   5598,   5383,   5012,   4552,   4031,   3436,   2756,
+      2002,   1233,    550,     73,    -96,     90,    597,   1317,   2079,   2703,   3034,   2989,   2566,   1840,    940,     13,
+      -811,  -1442,  -1835,  -1987,  -1921,  -1668,  -1267,   -753,   -170,    425,    962,   1362,   1553,   1491,   1172,    645,
+         0,   -645,  -1172,  -1491,  -1553,  -1362,   -962,   -425,    170,    753,   1267,   1668,   1921,   1987,   1835,   1442,
+       811,    -13,   -940,  -1840,  -2566,  -2989,  -3034,  -2703,  -2079,  -1317,   -597,    -90,     96,    -73,   -550,  -1233,
+     -2002,  -2756,  -3436,  -4031,  -4552,  -5012,  -5383,  -5598,  -5556,  -5161,  -4363,  -3211,  -1854,   -533,    481,    954,
+       771,    -29,  -1240,  -2548,  -3601,  -4115,  -3938,  -3096,  -1761,   -194,   1348,   2686,   3769,   4654,   5466,   6300,
+      7170,   7957,   8455,   8428,   7734,   6396,   4662,   2955,   1785,   1583,   2573,   4661,   7454,  10329,  12624,  13801,
+     13618,  12164,   9842,   7197,   4760,   2860,   1559,    653,   -187,  -1262,  -2664,  -4227,  -5533,  -6098,  -5554,  -3873,
+     -1436,    982,   2439,   2085,   -515,  -5229, -11299, -17560, -22719, -25771, -26245, -24381, -20984, -17192, -14047, -12216,
+    -11747, -12171, -12680, -12564, -11472,  -9678,  -7935,  -7281,  -8506, -11860, -16687, -21640, -24857, -24737, -20249, -11661,
+         0,  20327,  24825,  16723,   8487,   7957,  11460,  12696,  11738,  14059,  20976,  26255,  22713,  11307,    509,  -2432,
+      1431,   5561,   5529,   2670,    183,  -1554,  -4763,  -9838, -13620, -12620,  -7456,  -2569,  -1787,  -4658,  -7736,  -8452,
+     -7172,  -5463,  -3771,  -1346,   1759,   3940,   3600,   1242,   -772,   -479,   1853,   4365,   5555,   5384,   4551,   3437,
+      2001,    551,    -97,    598,   2078,   3035,   2565,    941,   -812,  -1835,  -1921,  -1267,   -170,    962,   1553,   1172,
+         0,  -1172,  -1553,   -962,    170,   1267,   1921,   1835,    812,   -941,  -2565,  -3035,  -2078,   -598,     97,   -551,
+     -2001,  -3437,  -4551,  -5384,  -5555,  -4365,  -1853,    479,    772,  -1242,  -3600,  -3940,  -1759,   1346,   3771,   5463,
+      7172,   8452,   7736,   4658,   1787,   2569,   7456,  12620,  13620,   9838,   4763,   1554,   -183,  -2670,  -5529,  -5561,
+     -1431,   2432,   -509, -11307, -22713, -26255, -20976, -14059, -11738, -12696, -11460,  -7957,  -8487, -16723, -24825, -20327,
+         0,  25112,   8310,  11639,  11613,  21102,  22621,    604,   1359,   5603,    126,  -4703, -13667,  -7407,  -1826,  -7695,
+     -7204,  -3737,   1733,   3627,   -794,   1875,   5538,   4569,   1987,    -84,   2068,   2574,   -818,  -1915,   -173,   1555,
+         0,  -1555,    173,   1915,    818,  -2574,  -2068,     84,  -1987,  -4569,  -5538,  -1875,    794,  -3627,  -1733,   3737,
+      7204,   7695,   1826,   7407,  13667,   4703,   -126,  -5603,  -1359,   -604, -22621, -21102, -11613, -11639,  -8310, -25112,
+         0,  18269,  16404,   7234,  11961,  22988,  19354,   4511,   -958,   4484,   3505,  -7410, -12896,  -7111,  -2542,  -6281,
+     -8866,  -3280,   2900,   2215,   -327,   1946,   5627,   4692,   1209,    624,   2299,   1881,   -679,  -1627,    -38,   1071,
+         0,  -1071,     38,   1627,    679,  -1881,  -2299,   -624,  -1209,  -4692,  -5627,  -1946,    327,  -2215,  -2900,   3280,
+      8866,   6281,   2542,   7111,  12896,   7410,  -3505,  -4484,    958,  -4511, -19354, -22988, -11961,  -7234, -16404, -18269,
+         0,   7028,  12819,  16460,  17571,  16326,  13316,   9303,   5004,    952,  -2518,  -5216,  -7021,  -7848,  -7669,  -6566,
+     -4761,  -2598,   -463,   1318,   2553,   3206,   3362,   3153,   2698,   2081,   1371,    648,     23,   -388,   -506,   -341,
+         0,    341,    506,    388,    -23,   -648,  -1371,  -2081,  -2698,  -3153,  -3362,  -3206,  -2553,  -1318,    463,   2598,
+      4761,   6566,   7669,   7848,   7021,   5216,   2518,   -952,  -5004,  -9303, -13316, -16326, -17571, -16460, -12819,  -7028,
+         0,   5107,   9628,  13051,  15006,  15312,  13994,  11276,   7548,   3309,   -902,  -4578,  -7312,  -8842,  -9084,  -8129,
+     -6221,  -3714,  -1015,   1480,   3441,   4648,   5017,   4602,   3575,   2190,    735,   -519,  -1364,  -1685,  -1481,   -857,
+         0,    857,   1481,   1685,   1364,    519,   -735,  -2190,  -3575,  -4602,  -5017,  -4648,  -3441,  -1480,   1015,   3714,
+      6221,   8129,   9084,   8842,   7312,   4578,    902,  -3309,  -7548, -11276, -13994, -15312, -15006, -13051,  -9628,  -5107,
+         0,    468,    920,   1342,   1719,   2039,   2292,   2470,   2568,   2584,   2519,   2377,   2164,   1890,   1567,   1206,
+       822,    431,     46,   -317,   -645,   -926,  -1151,  -1312,  -1405,  -1426,  -1378,  -1264,  -1090,   -865,   -600,   -307,
+         0,    307,    600,    865,   1090,   1264,   1378,   1426,   1405,   1312,   1151,    926,    645,    317,    -46,   -431,
+      -822,  -1206,  -1567,  -1890,  -2164,  -2377,  -2519,  -2584,  -2568,  -2470,  -2292,  -2039,  -1719,  -1342,   -920,   -468,
+         0,     81,    160,    239,    315,    388,    457,    522,    581,    636,    684,    725,    760,    787,    806,    818,
+       822,    818,    806,    787,    760,    725,    684,    636,    581,    522,    457,    388,    315,    239,    160,     81,
+         0,    -81,   -160,   -239,   -315,   -388,   -457,   -522,   -581,   -636,   -684,   -725,   -760,   -787,   -806,   -818,
+      -822,   -818,   -806,   -787,   -760,   -725,   -684,   -636,   -581,   -522,   -457,   -388,   -315,   -239,   -160,    -81,
+    
+    // Frame 6
+         0,  11688,  20274,  24713,  24729,  21361,  16231,  11230,   7739,   6445,   7121,   8987,  10997,  12378,  12819,  12631,
+     12480,  13136,  15043,  18145,  21786,  24951,  26542,  25806,  22553,  17297,  11074,   5189,    796,  -1377,  -1242,    707,
+      3562,   6327,   8188,   8743,   8018,   6406,   4432,   2569,   1044,   -176,  -1347,  -2766,  -4631,  -6892,  -9254, -11237,
+    -12353, -12261, -10920,  -8610,  -5886,  -3406,  -1764,  -1313,  -2090,  -3812,  -5993,  -8079,  -9619, -10357, -10284,  -9574,
+     -8506,  -7339,  -6244,  -5252,  -4299,  -3276,  -2122,   -864,    354,   1321,   1822,   1733,   1062,    -19,  -1218,  -2198,
+     -2669,  -2462,  -1579,   -179,   1469,   3069,   4365,   5211,   5574,   5527,   5197,   4722,   4199,   3679,   3165,   2648,
+      2131,   1656,   1296,   1146,   1278,   1716,   2411,   3243,   4044,   4642,   4898,   4746,   4203,   3365,   2373,   1382,
+       525,   -111,   -490,   -619,   -532,   -273,    112,    581,   1089,   1580,   1988,   2238,   2265,   2030,   1534,    826,
+         0,   -826,  -1534,  -2030,  -2265,  -2238,  -1988,  -1580,  -1089,   -581,   -112,    273,    532,    619,    490,    111,
+      -525,  -1382,  -2373,  -3365,  -4203,  -4746,  -4898,  -4642,  -4044,  -3243,  -2411,  -1716,  -1278,  -1146,  -1296,  -1656,
+     -2131,  -2648,  -3165,  -3679,  -4199,  -4722,  -5197,  -5527,  -5574,  -5211,  -4365,  -3069,  -1469,    179,   1579,   2462,
+      2669,   2198,   1218,     19,  -1062,  -1733,  -1822,  -1321,   -354,    864,   2122,   3276,   4299,   5252,   6244,   7339,
+      8506,   9574,  10284,  10357,   9619,   8079,   5993,   3812,   2090,   1313,   1764,   3406,   5886,   8610,  10920,  12261,
+     12353,  11237,   9254,   6892,   4631,   2766,   1347,    176,  -1044,  -2569,  -4432,  -6406,  -8018,  -8743,  -8188,  -6327,
+     -3562,   -707,   1242,   1377,   -796,  -5189, -11074, -17297, -22553, -25806, -26542, -24951, -21786, -18145, -15043, -13136,
+    -12480, -12631, -12819, -12378, -10997,  -8987,  -7121,  -6445,  -7739, -11230, -16231, -21361, -24729, -24713, -20274, -11688,
+         0,  20352,  24697,  16266,   7720,   7143,  10985,  12835,  12470,  15056,  21779,  26552,  22547,  11083,    790,  -1235,
+      3557,   8195,   8014,   4438,   1040,  -1342,  -4634,  -9250, -12356, -10916,  -5889,  -1761,  -2093,  -5990,  -9621, -10281,
+     -8508,  -6241,  -4301,  -2119,    352,   1825,   1060,  -1216,  -2670,  -1578,   1468,   4367,   5573,   5199,   4198,   3166,
+      2130,   1297,   1277,   2412,   4044,   4898,   4203,   2373,    524,   -490,   -532,    112,   1089,   1988,   2265,   1534,
+         0,  -1534,  -2265,  -1988,  -1089,   -112,    532,    490,   -524,  -2373,  -4203,  -4898,  -4044,  -2412,  -1277,  -1297,
+     -2130,  -3166,  -4198,  -5199,  -5573,  -4367,  -1468,   1578,   2670,   1216,  -1060,  -1825,   -352,   2119,   4301,   6241,
+      8508,  10281,   9621,   5990,   2093,   1761,   5889,  10916,  12356,   9250,   4634,   1342,  -1040,  -4438,  -8014,  -8195,
+     -3557,   1235,   -790, -11083, -22547, -26552, -21779, -15056, -12470, -12835, -10985,  -7143,  -7720, -16266, -24697, -20352,
+         0,  24985,   7542,  11165,  12345,  21905,  22454,    885,   3485,   8088,    983,  -4574, -12403,  -5839,  -2131,  -9580,
+     -8540,  -4268,    326,   1088,  -2692,   1490,   5555,   4216,   2117,   1291,   4034,   4212,    518,   -526,   1086,   2267,
+         0,  -2267,  -1086,    526,   -518,  -4212,  -4034,  -1291,  -2117,  -4216,  -5555,  -1490,   2692,  -1088,   -326,   4268,
+      8540,   9580,   2131,   5839,  12403,   4574,   -983,  -8088,  -3485,   -885, -22454, -21905, -12345, -11165,  -7542, -24985,
+         0,  17897,  15724,   6953,  12561,  23648,  19342,   4887,   1008,   6914,   4521,  -7261, -11784,  -5535,  -2707,  -8198,
+    -10330,  -3759,   1606,   -392,  -2323,   1641,   5727,   4248,   1272,   2097,   4314,   3414,    624,   -130,   1237,   1673,
+         0,  -1673,  -1237,    130,   -624,  -3414,  -4314,  -2097,  -1272,  -4248,  -5727,  -1641,   2323,    392,  -1606,   3759,
+     10330,   8198,   2707,   5535,  11784,   7261,  -4521,  -6914,  -1008,  -4887, -19342, -23648, -12561,  -6953, -15724, -17897,
+         0,   6845,  12536,  16218,  17528,  16613,  13998,  10367,   6360,   2453,  -1052,  -3966,  -6146,  -7467,  -7844,  -7294,
+     -5973,  -4160,  -2192,   -372,   1105,   2173,   2862,   3239,   3354,   3227,   2872,   2331,   1694,   1078,    581,    238,
+         0,   -238,   -581,  -1078,  -1694,  -2331,  -2872,  -3227,  -3354,  -3239,  -2862,  -2173,  -1105,    372,   2192,   4160,
+      5973,   7294,   7844,   7467,   6146,   3966,   1052,  -2453,  -6360, -10367, -13998, -16613, -17528, -16218, -12536,  -6845,
+         0,   5100,   9643,  13140,  15233,  15735,  14652,  12176,   8655,   4545,    349,  -3450,  -6449,  -8371,  -9094,  -8654,
+     -7234,  -5122,  -2668,   -228,   1885,   3441,   4318,   4512,   4117,   3309,   2299,   1299,    482,    -45,   -256,   -202,
+         0,    202,    256,     45,   -482,  -1299,  -2299,  -3309,  -4117,  -4512,  -4318,  -3441,  -1885,    228,   2668,   5122,
+      7234,   8654,   9094,   8371,   6449,   3450,   -349,  -4545,  -8655, -12176, -14652, -15735, -15233, -13140,  -9643,  -5100,
+         0,    531,   1043,   1521,   1948,   2310,   2595,   2795,   2904,   2920,   2843,   2679,   2434,   2120,   1749,   1337,
+       898,    452,     13,   -401,   -774,  -1094,  -1349,  -1531,  -1633,  -1655,  -1597,  -1463,  -1260,  -1000,   -693,   -355,
+         0,    355,    693,   1000,   1260,   1463,   1597,   1655,   1633,   1531,   1349,   1094,    774,    401,    -13,   -452,
+      -898,  -1337,  -1749,  -2120,  -2434,  -2679,  -2843,  -2920,  -2904,  -2795,  -2595,  -2310,  -1948,  -1521,  -1043,   -531,
+         0,     88,    175,    261,    344,    424,    499,    570,    635,    695,    747,    792,    830,    860,    881,    894,
+       898,    894,    881,    860,    830,    792,    747,    695,    635,    570,    499,    424,    344,    261,    175,     88,
+         0,    -88,   -175,   -261,   -344,   -424,   -499,   -570,   -635,   -695,   -747,   -792,   -830,   -860,   -881,   -894,
+      -898,   -894,   -881,   -860,   -830,   -792,   -747,   -695,   -635,   -570,   -499,   -424,   -344,   -261,   -175,    -88,
+    
+    // Frame 7
+         0,  11644,  20168,  24516,  24413,  20910,  15650,  10550,   7019,   5765,   6571,   8653,  10946,  12645,  13400,  13477,
+     13505,  14227,  16076,  19006,  22387,  25247,  26543,  25575,  22202,  16972,  10934,   5384,   1443,   -210,    449,   2860,
+      6055,   8995,  10842,  11196,  10113,   8035,   5552,   3207,   1295,   -168,  -1405,  -2710,  -4302,  -6179,  -8109,  -9683,
+    -10484, -10228,  -8913,  -6829,  -4516,  -2589,  -1583,  -1776,  -3133,  -5308,  -7767,  -9937, -11372, -11850, -11413, -10302,
+     -8869,  -7437,  -6224,  -5289,  -4567,  -3925,  -3251,  -2512,  -1782,  -1205,   -942,  -1088,  -1626,  -2399,  -3161,  -3628,
+     -3577,  -2906,  -1672,    -68,   1621,   3109,   4174,   4718,   4769,   4463,   3981,   3497,   3127,   2915,   2836,   2835,
+      2855,   2879,   2925,   3045,   3289,   3682,   4193,   4746,   5224,   5510,   5521,   5231,   4682,   3972,   3224,   2558,
+      2056,   1751,   1626,   1631,   1707,   1804,   1890,   1958,   2010,   2044,   2046,   1988,   1833,   1552,   1134,    600,
+         0,   -600,  -1134,  -1552,  -1833,  -1988,  -2046,  -2044,  -2010,  -1958,  -1890,  -1804,  -1707,  -1631,  -1626,  -1751,
+     -2056,  -2558,  -3224,  -3972,  -4682,  -5231,  -5521,  -5510,  -5224,  -4746,  -4193,  -3682,  -3289,  -3045,  -2925,  -2879,
+     -2855,  -2835,  -2836,  -2915,  -3127,  -3497,  -3981,  -4463,  -4769,  -4718,  -4174,  -3109,  -1621,     68,   1672,   2906,
+      3577,   3628,   3161,   2399,   1626,   1088,    942,   1205,   1782,   2512,   3251,   3925,   4567,   5289,   6224,   7437,
+      8869,  10302,  11413,  11850,  11372,   9937,   7767,   5308,   3133,   1776,   1583,   2589,   4516,   6829,   8913,  10228,
+     10484,   9683,   8109,   6179,   4302,   2710,   1405,    168,  -1295,  -3207,  -5552,  -8035, -10113, -11196, -10842,  -8995,
+     -6055,  -2860,   -449,    210,  -1443,  -5384, -10934, -16972, -22202, -25575, -26543, -25247, -22387, -19006, -16076, -14227,
+    -13505, -13477, -13400, -12645, -10946,  -8653,  -6571,  -5765,  -7019, -10550, -15650, -20910, -24413, -24516, -20168, -11644,
+         0,  20246,  24381,  15685,   7001,   6593,  10934,  13416,  13495,  16089,  22379,  26553,  22196,  10943,   1438,    456,
+      6050,  10849,  10109,   5558,   1291,  -1400,  -4305,  -8104, -10487,  -8909,  -4518,  -1579,  -3136,  -7764, -11375, -11410,
+     -8871,  -6221,  -4569,  -3249,  -1784,   -940,  -1627,  -3159,  -3579,  -1670,   1620,   4175,   4768,   3982,   3126,   2837,
+      2855,   2927,   3289,   4194,   5223,   5522,   4681,   3225,   2056,   1626,   1707,   1890,   2009,   2046,   1833,   1134,
+         0,  -1134,  -1833,  -2046,  -2009,  -1890,  -1707,  -1626,  -2056,  -3225,  -4681,  -5522,  -5223,  -4194,  -3289,  -2927,
+     -2855,  -2837,  -3126,  -3982,  -4768,  -4175,  -1620,   1670,   3579,   3159,   1627,    940,   1784,   3249,   4569,   6221,
+      8871,  11410,  11375,   7764,   3136,   1579,   4518,   8909,  10487,   8104,   4305,   1400,  -1291,  -5558, -10109, -10849,
+     -6050,   -456,  -1438, -10943, -22196, -26553, -22379, -16089, -13495, -13416, -10934,  -6593,  -7001, -15685, -24381, -20246,
+         0,  24670,   6822,  11114,  13370,  22505,  22103,   1533,   5978,  10183,   1233,  -4245, -10534,  -4469,  -3175, -11334,
+     -8903,  -4536,  -1810,  -1599,  -3601,   1642,   4750,   3144,   2841,   3302,   5213,   4691,   2049,   1713,   2006,   1835,
+         0,  -1835,  -2006,  -1713,  -2049,  -4691,  -5213,  -3302,  -2841,  -3144,  -4750,  -1642,   3601,   1599,   1810,   4536,
+      8903,  11334,   3175,   4469,  10534,   4245,  -1233, -10183,  -5978,  -1533, -22103, -22505, -13370, -11114,  -6822, -24670,
+         0,  17267,  15113,   7159,  13417,  24056,  19191,   5667,   3289,   8930,   4984,  -6899, -10120,  -4159,  -3558,  -9991,
+    -10868,  -3961,   -374,  -3169,  -3368,   1902,   5037,   3053,   1905,   4243,   5563,   3750,   2109,   2257,   2181,   1090,
+         0,  -1090,  -2181,  -2257,  -2109,  -3750,  -5563,  -4243,  -1905,  -3053,  -5037,  -1902,   3368,   3169,    374,   3961,
+     10868,   9991,   3558,   4159,  10120,   6899,  -4984,  -8930,  -3289,  -5667, -19191, -24056, -13417,  -7159, -15113, -17267,
+         0,   6725,  12367,  16118,  17628,  17018,  14756,  11456,   7692,   3893,    335,  -2792,  -5325,  -7101,  -7987,  -7942,
+     -7062,  -5571,  -3763,  -1917,   -232,   1199,   2361,   3260,   3885,   4198,   4166,   3795,   3157,   2365,   1538,    748,
+         0,   -748,  -1538,  -2365,  -3157,  -3795,  -4166,  -4198,  -3885,  -3260,  -2361,  -1199,    232,   1917,   3763,   5571,
+      7062,   7942,   7987,   7101,   5325,   2792,   -335,  -3893,  -7692, -11456, -14756, -17018, -17628, -16118, -12367,  -6725,
+         0,   5132,   9730,  13324,  15562,  16254,  15386,  13122,   9773,   5761,   1556,  -2376,  -5634,  -7927,  -9096,  -9132,
+     -8159,  -6407,  -4177,  -1789,    457,   2322,   3651,   4385,   4553,   4259,   3647,   2876,   2089,   1386,    815,    370,
+         0,   -370,   -815,  -1386,  -2089,  -2876,  -3647,  -4259,  -4553,  -4385,  -3651,  -2322,   -457,   1789,   4177,   6407,
+      8159,   9132,   9096,   7927,   5634,   2376,  -1556,  -5761,  -9773, -13122, -15386, -16254, -15562, -13324,  -9730,  -5132,
+         0,    606,   1191,   1736,   2223,   2635,   2959,   3185,   3307,   3322,   3231,   3039,   2756,   2393,   1966,   1490,
+       986,    472,    -32,   -507,   -935,  -1301,  -1591,  -1798,  -1913,  -1934,  -1863,  -1705,  -1468,  -1164,   -806,   -413,
+         0,    413,    806,   1164,   1468,   1705,   1863,   1934,   1913,   1798,   1591,   1301,    935,    507,     32,   -472,
+      -986,  -1490,  -1966,  -2393,  -2756,  -3039,  -3231,  -3322,  -3307,  -3185,  -2959,  -2635,  -2223,  -1736,  -1191,   -606,
+         0,     97,    192,    286,    377,    465,    548,    625,    697,    762,    820,    869,    911,    943,    967,    981,
+       986,    981,    967,    943,    911,    869,    820,    762,    697,    625,    548,    465,    377,    286,    192,     97,
+         0,    -97,   -192,   -286,   -377,   -465,   -548,   -625,   -697,   -762,   -820,   -869,   -911,   -943,   -967,   -981,
+      -986,   -981,   -967,   -943,   -911,   -869,   -820,   -762,   -697,   -625,   -548,   -465,   -377,   -286,   -192,    -97,
+    
+    // Frame 8
+         0,  11409,  19785,  24140,  24245,  21161,  16494,  12066,   9144,   8275,   9097,  10741,  12152,  12631,  12025,  10839,
+      9933,  10220,  12210,  15823,  20311,  24521,  27213,  27508,  25125,  20513,  14665,   8849,   4189,   1396,    575,   1303,
+      2805,   4279,   5128,   5154,   4522,   3653,   2980,   2771,   2979,   3281,   3180,   2229,    197,  -2794,  -6301,  -9654,
+    -12184, -13398, -13147, -11639,  -9381,  -6999,  -5068,  -3939,  -3688,  -4123,  -4909,  -5688,  -6223,  -6448,  -6471,  -6486,
+     -6678,  -7112,  -7707,  -8232,  -8403,  -7975,  -6846,  -5098,  -2998,   -909,    798,   1863,   2193,   1890,   1190,    395,
+      -232,   -527,   -467,   -137,    316,    755,   1105,   1380,   1661,   2055,   2636,   3405,   4272,   5081,   5653,   5852,
+      5623,   5021,   4189,   3323,   2605,   2161,   2024,   2141,   2402,   2682,   2885,   2974,   2972,   2938,   2938,   3007,
+      3130,   3246,   3267,   3115,   2753,   2203,   1546,    894,    357,     11,   -129,   -103,      8,    114,    152,    105,
+         0,   -105,   -152,   -114,     -8,    103,    129,    -11,   -357,   -894,  -1546,  -2203,  -2753,  -3115,  -3267,  -3246,
+     -3130,  -3007,  -2938,  -2938,  -2972,  -2974,  -2885,  -2682,  -2402,  -2141,  -2024,  -2161,  -2605,  -3323,  -4189,  -5021,
+     -5623,  -5852,  -5653,  -5081,  -4272,  -3405,  -2636,  -2055,  -1661,  -1380,  -1105,   -755,   -316,    137,    467,    527,
+       232,   -395,  -1190,  -1890,  -2193,  -1863,   -798,    909,   2998,   5098,   6846,   7975,   8403,   8232,   7707,   7112,
+      6678,   6486,   6471,   6448,   6223,   5688,   4909,   4123,   3688,   3939,   5068,   6999,   9381,  11639,  13147,  13398,
+     12184,   9654,   6301,   2794,   -197,  -2229,  -3180,  -3281,  -2979,  -2771,  -2980,  -3653,  -4522,  -5154,  -5128,  -4279,
+     -2805,  -1303,   -575,  -1396,  -4189,  -8849, -14665, -20513, -25125, -27508, -27213, -24521, -20311, -15823, -12210, -10220,
+     -9933, -10839, -12025, -12631, -12152, -10741,  -9097,  -8275,  -9144, -12066, -16494, -21161, -24245, -24140, -19785, -11409,
+         0,  19862,  24213,  16529,   9126,   9119,  12139,  12041,   9924,  12222,  20303,  27223,  25119,  14674,   4184,    582,
+      2800,   5135,   4518,   2986,   2975,   3185,    194,  -6296, -12187, -13143,  -9384,  -5064,  -3690,  -4906,  -6225,  -6468,
+     -6679,  -7704,  -8405,  -6843,  -2999,    800,   2192,   1192,   -233,   -465,    315,   1106,   1659,   2637,   4271,   5655,
+      5622,   4190,   2605,   2025,   2402,   2886,   2971,   2939,   3130,   3267,   2752,   1546,    357,   -128,      7,    152,
+         0,   -152,     -7,    128,   -357,  -1546,  -2752,  -3267,  -3130,  -2939,  -2971,  -2886,  -2402,  -2025,  -2605,  -4190,
+     -5622,  -5655,  -4271,  -2637,  -1659,  -1106,   -315,    465,    233,  -1192,  -2192,   -800,   2999,   6843,   8405,   7704,
+      6679,   6468,   6225,   4906,   3690,   5064,   9384,  13143,  12187,   6296,   -194,  -3185,  -2975,  -2986,  -4518,  -5135,
+     -2800,   -582,  -4184, -14674, -25119, -27223, -20303, -12222,  -9924, -12041, -12139,  -9119,  -9126, -16529, -24213, -19862,
+         0,  24500,   8947,  12320,   9798,  20430,  25025,   4279,   2727,   4593,   2917,    255, -12235,  -9334,  -3729,  -6184,
+     -6712,  -8371,  -3026,   2220,   -255,    337,   1642,   4289,   5608,   2618,   2392,   2981,   3123,   2758,    353,      9,
+         0,     -9,   -353,  -2758,  -3123,  -2981,  -2392,  -2618,  -5608,  -4289,  -1642,   -337,    255,  -2220,   3026,   8371,
+      6712,   6184,   3729,   9334,  12235,   -255,  -2917,  -4593,  -2727,  -4279, -25025, -20430,  -9798, -12320,  -8947, -24500,
+         0,  18086,  16889,   7471,  10693,  22152,  21680,   8238,    219,   3990,   5821,  -2541, -10903,  -9510,  -4315,  -4753,
+     -8457,  -7598,  -2332,   1004,    492,    -15,   1930,   4392,   4833,   3442,   2283,   2584,   3338,   2703,    725,   -507,
+         0,    507,   -725,  -2703,  -3338,  -2584,  -2283,  -3442,  -4833,  -4392,  -1930,     15,   -492,  -1004,   2332,   7598,
+      8457,   4753,   4315,   9510,  10903,   2541,  -5821,  -3990,   -219,  -8238, -21680, -22152, -10693,  -7471, -16889, -18086,
+         0,   6811,  12491,  16204,  17595,  16810,  14357,  10893,   7022,   3188,   -330,  -3350,  -5720,  -7289,  -7940,  -7653,
+     -6551,  -4891,  -2994,  -1158,    423,   1672,   2603,   3253,   3640,   3751,   3568,   3113,   2466,   1748,   1073,    498,
+         0,   -498,  -1073,  -1748,  -2466,  -3113,  -3568,  -3751,  -3640,  -3253,  -2603,  -1672,   -423,   1158,   2994,   4891,
+      6551,   7653,   7940,   7289,   5720,   3350,    330,  -3188,  -7022, -10893, -14357, -16810, -17595, -16204, -12491,  -6811,
+         0,   5117,   9689,  13236,  15403,  16003,  15029,  12660,   9226,   5164,    962,  -2907,  -6041,  -8155,  -9108,  -8912,
+     -7720,  -5791,  -3449,  -1032,   1153,   2872,   3986,   4461,   4358,   3816,   3011,   2129,   1325,    705,    305,     97,
+         0,    -97,   -305,   -705,  -1325,  -2129,  -3011,  -3816,  -4358,  -4461,  -3986,  -2872,  -1153,   1032,   3449,   5791,
+      7720,   8912,   9108,   8155,   6041,   2907,   -962,  -5164,  -9226, -12660, -15029, -16003, -15403, -13236,  -9689,  -5117,
+         0,    567,   1115,   1626,   2082,   2468,   2772,   2985,   3100,   3116,   3032,   2855,   2592,   2254,   1856,   1413,
+       943,    463,     -7,   -450,   -850,  -1192,  -1465,  -1658,  -1767,  -1789,  -1725,  -1579,  -1360,  -1078,   -747,   -382,
+         0,    382,    747,   1078,   1360,   1579,   1725,   1789,   1767,   1658,   1465,   1192,    850,    450,      7,   -463,
+      -943,  -1413,  -1856,  -2254,  -2592,  -2855,  -3032,  -3116,  -3100,  -2985,  -2772,  -2468,  -2082,  -1626,  -1115,   -567,
+         0,     92,    184,    274,    361,    444,    524,    598,    667,    729,    784,    831,    871,    902,    925,    938,
+       943,    938,    925,    902,    871,    831,    784,    729,    667,    598,    524,    444,    361,    274,    184,     92,
+         0,    -92,   -184,   -274,   -361,   -444,   -524,   -598,   -667,   -729,   -784,   -831,   -871,   -902,   -925,   -938,
+      -943,   -938,   -925,   -902,   -871,   -831,   -784,   -729,   -667,   -598,   -524,   -444,   -361,   -274,   -184,    -92,
+    
+    // Frame 9
+         0,  11000,  19113,  23475,  23964,  21696,  18251,  15317,  13917,  14286,  15748,  17202,  17501,  16039,  12913,   8983,
+      5489,   3667,   4240,   7219,  11841,  16879,  20994,  23210,  23139,  21092,  17856,  14417,  11558,   9651,   8537,   7691,
+      6445,   4321,   1209,  -2534,  -6228,  -9078, -10477, -10192,  -8465,  -5908,  -3321,  -1413,   -619,   -971,  -2162,  -3672,
+     -4999,  -5820,  -6105,  -6079,  -6121,  -6571,  -7599,  -9105, -10754, -12073, -12626, -12146, -10645,  -8388,  -5823,  -3421,
+     -1550,   -366,    198,    377,    462,    686,   1132,   1723,   2258,   2512,   2327,   1697,    770,   -179,   -848,   -998,
+      -535,    471,   1801,   3173,   4323,   5088,   5433,   5453,   5306,   5152,   5083,   5091,   5079,   4902,   4432,   3618,
+      2513,   1270,     96,   -807,  -1306,  -1371,  -1083,   -595,    -87,    297,    488,    502,    422,    352,    372,    503,
+       691,    831,    804,    524,    -23,   -770,  -1582,  -2294,  -2760,  -2897,  -2705,  -2262,  -1692,  -1124,   -646,   -284,
+         0,    284,    646,   1124,   1692,   2262,   2705,   2897,   2760,   2294,   1582,    770,     23,   -524,   -804,   -831,
+      -691,   -503,   -372,   -352,   -422,   -502,   -488,   -297,     87,    595,   1083,   1371,   1306,    807,    -96,  -1270,
+     -2513,  -3618,  -4432,  -4902,  -5079,  -5091,  -5083,  -5152,  -5306,  -5453,  -5433,  -5088,  -4323,  -3173,  -1801,   -471,
+       535,    998,    848,    179,   -770,  -1697,  -2327,  -2512,  -2258,  -1723,  -1132,   -686,   -462,   -377,   -198,    366,
+      1550,   3421,   5823,   8388,  10645,  12146,  12626,  12073,  10754,   9105,   7599,   6571,   6121,   6079,   6105,   5820,
+      4999,   3672,   2162,    971,    619,   1413,   3321,   5908,   8465,  10192,  10477,   9078,   6228,   2534,  -1209,  -4321,
+     -6445,  -7691,  -8537,  -9651, -11558, -14417, -17856, -21092, -23139, -23210, -20994, -16879, -11841,  -7219,  -4240,  -3667,
+     -5489,  -8983, -12913, -16039, -17501, -17202, -15748, -14286, -13917, -15317, -18251, -21696, -23964, -23475, -19113, -11000,
+         0,  19190,  23932,  18286,  13899,  15770,  17489,  12928,   5480,   4252,  11834,  21004,  23133,  17864,  11553,   8544,
+      6440,   1215,  -6232, -10472,  -8469,  -3316,   -622,  -2158,  -5002,  -6101,  -6123,  -7596, -10757, -12622, -10647,  -5820,
+     -1552,    200,    461,   1134,   2256,   2329,    769,   -846,   -536,   1802,   4322,   5435,   5305,   5084,   5078,   4433,
+      2512,     97,  -1307,  -1082,    -88,    489,    421,    373,    691,    804,    -23,  -1582,  -2760,  -2705,  -1692,   -646,
+         0,    646,   1692,   2705,   2760,   1582,     23,   -804,   -691,   -373,   -421,   -489,     88,   1082,   1307,    -97,
+     -2512,  -4433,  -5078,  -5084,  -5305,  -5435,  -4322,  -1802,    536,    846,   -769,  -2329,  -2256,  -1134,   -461,   -200,
+      1552,   5820,  10647,  12622,  10757,   7596,   6123,   6101,   5002,   2158,    622,   3316,   8469,  10472,   6232,  -1215,
+     -6440,  -8544, -11553, -17864, -23133, -21004, -11834,  -4252,  -5480, -12928, -17489, -15770, -13899, -18286, -23932, -19190,
+         0,  24217,  13720,  17671,   5351,  11963,  23036,  11651,   6365,  -6155,  -8530,   -560,  -5051,  -6072, -10797, -10605,
+     -1586,    496,   2228,    797,   -559,   4345,   5286,   5096,   2498,  -1293,    -98,    431,    684,    -18,  -2763,  -1690,
+         0,   1690,   2763,     18,   -684,   -431,     98,   1293,  -2498,  -5096,  -5286,  -4345,    559,   -797,  -2228,   -496,
+      1586,  10605,  10797,   6072,   5051,    560,   8530,   6155,  -6365, -11651, -23036, -11963,  -5351, -17671, -13720, -24217,
+         0,  18603,  21320,  12073,   7286,  13240,  19685,  15652,   3517,  -5798,  -6615,  -3263,  -2916,  -7109, -10940,  -9387,
+     -3297,   1722,   2074,    122,    378,   3469,   5910,   5023,   1917,   -464,   -622,    502,    890,   -422,  -2180,  -2174,
+         0,   2174,   2180,    422,   -890,   -502,    622,    464,  -1917,  -5023,  -5910,  -3469,   -378,   -122,  -2074,  -1722,
+      3297,   9387,  10940,   7109,   2916,   3263,   6615,   5798,  -3517, -15652, -19685, -13240,  -7286, -12073, -21320, -18603,
+         0,   7326,  13290,  16906,  17802,  16234,  12900,   8658,   4260,    226,  -3157,  -5741,  -7415,  -8079,  -7681,  -6300,
+     -4196,  -1777,    499,   2262,   3324,   3699,   3539,   3035,   2337,   1531,    674,   -153,   -822,  -1182,  -1133,   -688,
+         0,    688,   1133,   1182,    822,    153,   -674,  -1531,  -2337,  -3035,  -3539,  -3699,  -3324,  -2262,   -499,   1777,
+      4196,   6300,   7681,   8079,   7415,   5741,   3157,   -226,  -4260,  -8658, -12900, -16234, -17802, -16906, -13290,  -7326,
+         0,   5148,   9690,  13101,  15003,  15213,  13768,  10911,   7054,   2723,  -1523,  -5161,  -7777,  -9120,  -9120,  -7898,
+     -5732,  -3011,   -174,   2361,   4253,   5286,   5395,   4664,   3305,   1615,    -77,  -1468,  -2330,  -2545,  -2125,  -1202,
+         0,   1202,   2125,   2545,   2330,   1468,     77,  -1615,  -3305,  -4664,  -5395,  -5286,  -4253,  -2361,    174,   3011,
+      5732,   7898,   9120,   9120,   7777,   5161,   1523,  -2723,  -7054, -10911, -13768, -15213, -15003, -13101,  -9690,  -5148,
+         0,    444,    873,   1273,   1630,   1934,   2174,   2344,   2438,   2454,   2394,   2261,   2061,   1804,   1499,   1158,
+       797,    427,     64,   -279,   -590,   -856,  -1069,  -1223,  -1311,  -1333,  -1289,  -1183,  -1021,   -810,   -562,   -288,
+         0,    288,    562,    810,   1021,   1183,   1289,   1333,   1311,   1223,   1069,    856,    590,    279,    -64,   -427,
+      -797,  -1158,  -1499,  -1804,  -2061,  -2261,  -2394,  -2454,  -2438,  -2344,  -2174,  -1934,  -1630,  -1273,   -873,   -444,
+         0,     78,    155,    231,    305,    376,    443,    505,    563,    616,    662,    703,    736,    762,    781,    793,
+       797,    793,    781,    762,    736,    703,    662,    616,    563,    505,    443,    376,    305,    231,    155,     78,
+         0,    -78,   -155,   -231,   -305,   -376,   -443,   -505,   -563,   -616,   -662,   -703,   -736,   -762,   -781,   -793,
+      -797,   -793,   -781,   -762,   -736,   -703,   -662,   -616,   -563,   -505,   -443,   -376,   -305,   -231,   -155,    -78,
+    
+    // Frame 10
+         0,  10595,  18402,  22655,  23340,  21666,  19247,  17713,  17929,  19888,  22649,  24881,  25309,  23312,  19080,  13631,
+      8360,   4620,   3195,   4122,   6672,   9708,  12064,  13000,  12380,  10708,   8831,   7625,   7601,   8750,  10515,  12041,
+     12463,  11256,   8380,   4319,   -131,  -4119,  -7044,  -8711,  -9367,  -9540,  -9828, -10633, -12032, -13736, -15233, -15970,
+    -15588, -14037, -11616,  -8851,  -6332,  -4502,  -3540,  -3318,  -3496,  -3651,  -3463,  -2811,  -1822,   -788,    -60,    115,
+      -327,  -1220,  -2242,  -3013,  -3236,  -2779,  -1721,   -297,   1183,   2455,   3378,   3972,   4386,   4824,   5451,   6326,
+      7366,   8382,   9138,   9437,   9186,   8426,   7311,   6057,   4865,   3870,   3097,   2484,   1914,   1278,    517,   -343,
+     -1209,  -1944,  -2428,  -2592,  -2449,  -2084,  -1632,  -1231,   -986,   -940,  -1072,  -1316,  -1593,  -1838,  -2026,  -2174,
+     -2332,  -2555,  -2884,  -3321,  -3827,  -4330,  -4741,  -4980,  -4993,  -4764,  -4317,  -3703,  -2987,  -2227,  -1467,   -726,
+         0,    726,   1467,   2227,   2987,   3703,   4317,   4764,   4993,   4980,   4741,   4330,   3827,   3321,   2884,   2555,
+      2332,   2174,   2026,   1838,   1593,   1316,   1072,    940,    986,   1231,   1632,   2084,   2449,   2592,   2428,   1944,
+      1209,    343,   -517,  -1278,  -1914,  -2484,  -3097,  -3870,  -4865,  -6057,  -7311,  -8426,  -9186,  -9437,  -9138,  -8382,
+     -7366,  -6326,  -5451,  -4824,  -4386,  -3972,  -3378,  -2455,  -1183,    297,   1721,   2779,   3236,   3013,   2242,   1220,
+       327,   -115,     60,    788,   1822,   2811,   3463,   3651,   3496,   3318,   3540,   4502,   6332,   8851,  11616,  14037,
+     15588,  15970,  15233,  13736,  12032,  10633,   9828,   9540,   9367,   8711,   7044,   4119,    131,  -4319,  -8380, -11256,
+    -12463, -12041, -10515,  -8750,  -7601,  -7625,  -8831, -10708, -12380, -13000, -12064,  -9708,  -6672,  -4122,  -3195,  -4620,
+     -8360, -13631, -19080, -23312, -25309, -24881, -22649, -19888, -17929, -17713, -19247, -21666, -23340, -22655, -18402, -10595,
+         0,  18478,  23309,  19281,  17911,  22670,  25297,  19096,   8350,   3207,   6665,  12074,  12374,   8839,   7596,  10522,
+     12459,   8386,   -135,  -7039,  -9370,  -9823, -12035, -15229, -15591, -11612,  -6335,  -3536,  -3498,  -3459,  -1824,    -57,
+      -329,  -2240,  -3238,  -1719,   1182,   3380,   4385,   5453,   7365,   9140,   9185,   7312,   4864,   3098,   1914,    518,
+     -1210,  -2427,  -2450,  -1631,   -987,  -1071,  -1594,  -2026,  -2332,  -2884,  -3828,  -4741,  -4993,  -4317,  -2987,  -1467,
+         0,   1467,   2987,   4317,   4993,   4741,   3828,   2884,   2332,   2026,   1594,   1071,    987,   1631,   2450,   2427,
+      1210,   -518,  -1914,  -3098,  -4864,  -7312,  -9185,  -9140,  -7365,  -5453,  -4385,  -3380,  -1182,   1719,   3238,   2240,
+       329,     57,   1824,   3459,   3498,   3536,   6335,  11612,  15591,  15229,  12035,   9823,   9370,   7039,    135,  -8386,
+    -12459, -10522,  -7596,  -8839, -12374, -12074,  -6665,  -3207,  -8350, -19096, -25297, -22670, -17911, -19281, -23309, -18478,
+         0,  23594,  17729,  25482,   8218,   6798,  12273,   7697,  12380,    -54,  -9434, -11970, -15643,  -6281,  -3541,  -1779,
+      -364,  -3201,   1152,   4415,   7341,   9209,   4845,   1933,  -1225,  -2435,   -998,  -1583,  -2340,  -3821,  -4997,  -2985,
+         0,   2985,   4997,   3821,   2340,   1583,    998,   2435,   1225,  -1933,  -4845,  -9209,  -7341,  -4415,  -1152,   3201,
+       364,   1779,   3541,   6281,  15643,  11970,   9434,     54, -12380,  -7697, -12273,  -6798,  -8218, -25482, -17729, -23594,
+         0,  18376,  25090,  19555,  10889,   7355,   9372,  11621,   9122,   1165,  -8443, -14211, -13318,  -7946,  -2939,  -1196,
+     -1756,  -1809,    415,   4400,   7861,   8425,   5634,   1498,  -1344,  -1962,  -1441,  -1353,  -2381,  -3965,  -4680,  -3275,
+         0,   3275,   4680,   3965,   2381,   1353,   1441,   1962,   1344,  -1498,  -5634,  -8425,  -7861,  -4400,   -415,   1809,
+      1756,   1196,   2939,   7946,  13318,  14211,   8443,  -1165,  -9122, -11621,  -9372,  -7355, -10889, -19555, -25090, -18376,
+         0,   8609,  15328,  18871,  18911,  16045,  11433,   6298,   1536,  -2429,  -5511,  -7727,  -8991,  -9098,  -7876,  -5394,
+     -2075,   1366,   4162,   5774,   6065,   5293,   3925,   2396,    942,   -406,  -1696,  -2887,  -3769,  -4031,  -3433,  -1983,
+         0,   1983,   3433,   4031,   3769,   2887,   1696,    406,   -942,  -2396,  -3925,  -5293,  -6065,  -5774,  -4162,  -1366,
+      2075,   5394,   7876,   9098,   8991,   7727,   5511,   2429,  -1536,  -6298, -11433, -16045, -18911, -18871, -15328,  -8609,
+         0,   5344,  10008,  13407,  15130,  14997,  13080,   9692,   5333,    624,  -3790,  -7326,  -9548, -10226,  -9356,  -7160,
+     -4042,   -523,   2841,   5543,   7204,   7618,   6787,   4909,   2341,   -463,  -3025,  -4922,  -5853,  -5686,  -4478,  -2460,
+         0,   2460,   4478,   5686,   5853,   4922,   3025,    463,  -2341,  -4909,  -6787,  -7618,  -7204,  -5543,  -2841,    523,
+      4042,   7160,   9356,  10226,   9548,   7326,   3790,   -624,  -5333,  -9692, -13080, -14997, -15130, -13407, -10008,  -5344,
+         0,    360,    707,   1032,   1323,   1570,   1767,   1906,   1985,   2002,   1957,   1854,   1697,   1493,   1251,    980,
+       692,    397,    106,   -169,   -419,   -634,   -807,   -932,  -1007,  -1028,   -998,   -918,   -793,   -630,   -437,   -224,
+         0,    224,    437,    630,    793,    918,    998,   1028,   1007,    932,    807,    634,    419,    169,   -106,   -397,
+      -692,   -980,  -1251,  -1493,  -1697,  -1854,  -1957,  -2002,  -1985,  -1906,  -1767,  -1570,  -1323,  -1032,   -707,   -360,
+         0,     68,    135,    201,    265,    326,    384,    439,    489,    535,    575,    610,    639,    662,    679,    689,
+       692,    689,    679,    662,    639,    610,    575,    535,    489,    439,    384,    326,    265,    201,    135,     68,
+         0,    -68,   -135,   -201,   -265,   -326,   -384,   -439,   -489,   -535,   -575,   -610,   -639,   -662,   -679,   -689,
+      -692,   -689,   -679,   -662,   -639,   -610,   -575,   -535,   -489,   -439,   -384,   -326,   -265,   -201,   -135,    -68,
+    
+    // Frame 11
+         0,  10127,  17511,  21445,  22016,  20543,  18723,  18190,  19720,  23138,  27299,  30700,  31964,  30465,  26454,  21027,
+     15621,  11551,   9491,   9339,  10260,  11115,  10865,   9023,   5766,   1891,  -1562,  -3663,  -3986,  -2703,   -540,   1552,
+      2717,   2531,   1091,  -1028,  -3052,  -4294,  -4435,  -3608,  -2350,  -1358,  -1238,  -2258,  -4280,  -6804,  -9186, -10854,
+    -11529, -11282, -10499,  -9690,  -9300,  -9522, -10249, -11111, -11639, -11437, -10338,  -8452,  -6126,  -3799,  -1855,   -480,
+       373,    953,   1586,   2543,   3926,   5633,   7394,   8880,   9821,  10106,   9806,   9151,   8424,   7865,   7581,   7525,
+      7523,   7362,   6872,   6005,   4847,   3589,   2457,   1626,   1164,   1017,   1031,   1030,    870,    505,    -16,   -564,
+      -997,  -1212,  -1193,  -1009,   -794,   -691,   -798,  -1139,  -1657,  -2242,  -2775,  -3178,  -3436,  -3598,  -3752,  -3980,
+     -4325,  -4768,  -5234,  -5621,  -5838,  -5836,  -5624,  -5262,  -4830,  -4396,  -3987,  -3582,  -3125,  -2553,  -1828,   -958,
+         0,    958,   1828,   2553,   3125,   3582,   3987,   4396,   4830,   5262,   5624,   5836,   5838,   5621,   5234,   4768,
+      4325,   3980,   3752,   3598,   3436,   3178,   2775,   2242,   1657,   1139,    798,    691,    794,   1009,   1193,   1212,
+       997,    564,     16,   -505,   -870,  -1030,  -1031,  -1017,  -1164,  -1626,  -2457,  -3589,  -4847,  -6005,  -6872,  -7362,
+     -7523,  -7525,  -7581,  -7865,  -8424,  -9151,  -9806, -10106,  -9821,  -8880,  -7394,  -5633,  -3926,  -2543,  -1586,   -953,
+      -373,    480,   1855,   3799,   6126,   8452,  10338,  11437,  11639,  11111,  10249,   9522,   9300,   9690,  10499,  11282,
+     11529,  10854,   9186,   6804,   4280,   2258,   1238,   1358,   2350,   3608,   4435,   4294,   3052,   1028,  -1091,  -2531,
+     -2717,  -1552,    540,   2703,   3986,   3663,   1562,  -1891,  -5766,  -9023, -10865, -11115, -10260,  -9339,  -9491, -11551,
+    -15621, -21027, -26454, -30465, -31964, -30700, -27299, -23138, -19720, -18190, -18723, -20543, -22016, -21445, -17511, -10127,
+         0,  17586,  21985,  18757,  19703,  27321,  31952,  26470,  15611,   9503,  10253,  10875,   5760,  -1553,  -3991,   -533,
+      2713,   1097,  -3056,  -4429,  -2354,  -1233,  -4283,  -9182, -11532, -10495,  -9302, -10246, -11641, -10335,  -6128,  -1852,
+       371,   1588,   3924,   7396,   9820,   9809,   8423,   7583,   7522,   6874,   4845,   2458,   1163,   1033,    870,    -14,
+      -998,  -1192,   -795,   -797,  -1658,  -2774,  -3436,  -3751,  -4325,  -5233,  -5838,  -5624,  -4830,  -3986,  -3125,  -1828,
+         0,   1828,   3125,   3986,   4830,   5624,   5838,   5233,   4325,   3751,   3436,   2774,   1658,    797,    795,   1192,
+       998,     14,   -870,  -1033,  -1163,  -2458,  -4845,  -6874,  -7522,  -7583,  -8423,  -9809,  -9820,  -7396,  -3924,  -1588,
+      -371,   1852,   6128,  10335,  11641,  10246,   9302,  10495,  11532,   9182,   4283,   1233,   2354,   4429,   3056,  -1097,
+     -2713,    533,   3991,   1553,  -5760, -10875, -10253,  -9503, -15611, -26470, -31952, -27321, -19703, -18757, -21985, -17586,
+         0,  22271,  19515,  32143,  15473,  10392,   5654,  -3885,   2629,  -2972,  -2421,  -4214, -11587,  -9246, -11687,  -6081,
+       333,   3963,   9788,   8455,   7496,   4871,   1143,    890,  -1014,   -780,  -1670,  -3426,  -4333,  -5832,  -4834,  -3123,
+         0,   3123,   4834,   5832,   4333,   3426,   1670,    780,   1014,   -890,  -1143,  -4871,  -7496,  -8455,  -9788,  -3963,
+      -333,   6081,  11687,   9246,  11587,   4214,   2421,   2972,  -2629,   3885,  -5654, -10392, -15473, -32143, -19515, -22271,
+         0,  17329,  26693,  25976,  18798,  10158,   3378,   -185,   -947,   -945,  -2404,  -5755,  -9405, -11320, -10320,  -6336,
+      -455,   5229,   8666,   9130,   7331,   4527,   1863,    137,   -550,   -905,  -1752,  -3203,  -4681,  -5478,  -5035,  -3077,
+         0,   3077,   5035,   5478,   4681,   3203,   1752,    905,    550,   -137,  -1863,  -4527,  -7331,  -9130,  -8666,  -5229,
+       455,   6336,  10320,  11320,   9405,   5755,   2404,    945,    947,    185,  -3378, -10158, -18798, -25976, -26693, -17329,
+         0,  13973,  23370,  25613,  21115,  12809,   4511,   -964,  -2953,  -2834,  -2812,  -4391,  -7421, -10236, -10744,  -7788,
+     -1955,   4633,   9412,  10707,   8548,   4513,    751,  -1235,  -1312,   -584,   -514,  -1891,  -4276,  -6264,  -6379,  -4042,
+         0,   4042,   6379,   6264,   4276,   1891,    514,    584,   1312,   1235,   -751,  -4513,  -8548, -10707,  -9412,  -4633,
+      1955,   7788,  10744,  10236,   7421,   4391,   2812,   2834,   2953,    964,  -4511, -12809, -21115, -25613, -23370, -13973,
+         0,   5284,   9868,  13151,  14717,  14392,  12269,   8688,   4186,   -582,  -4943,  -8299, -10217, -10485,  -9138,  -6451,
+     -2888,    973,   4524,   7226,   8687,   8719,   7360,   4869,   1675,  -1688,  -4673,  -6801,  -7739,  -7350,  -5716,  -3120,
+         0,   3120,   5716,   7350,   7739,   6801,   4673,   1688,  -1675,  -4869,  -7360,  -8719,  -8687,  -7226,  -4524,   -973,
+      2888,   6451,   9138,  10485,  10217,   8299,   4943,    582,  -4186,  -8688, -12269, -14392, -14717, -13151,  -9868,  -5284,
+         0,    307,    603,    880,   1128,   1340,   1509,   1630,   1700,   1717,   1682,   1598,   1468,   1299,   1097,    870,
+       628,    381,    136,    -96,   -307,   -490,   -637,   -745,   -811,   -833,   -811,   -748,   -647,   -515,   -358,   -183,
+         0,    183,    358,    515,    647,    748,    811,    833,    811,    745,    637,    490,    307,     96,   -136,   -381,
+      -628,   -870,  -1097,  -1299,  -1468,  -1598,  -1682,  -1717,  -1700,  -1630,  -1509,  -1340,  -1128,   -880,   -603,   -307,
+         0,     62,    123,    182,    241,    296,    349,    399,    444,    486,    523,    554,    581,    601,    616,    625,
+       628,    625,    616,    601,    581,    554,    523,    486,    444,    399,    349,    296,    241,    182,    123,     62,
+         0,    -62,   -123,   -182,   -241,   -296,   -349,   -399,   -444,   -486,   -523,   -554,   -581,   -601,   -616,   -625,
+      -628,   -625,   -616,   -601,   -581,   -554,   -523,   -486,   -444,   -399,   -349,   -296,   -241,   -182,   -123,    -62,
+    
+    // Frame 12
+         0,   9751,  16885,  20743,  21369,  19978,  18166,  17532,  18909,  22257,  26591,  30504,  32602,  32110,  29049,  24279,
+     19090,  14804,  12248,  11563,  12153,  13007,  13053,  11612,   8589,   4532,    368,  -2906,  -4621,  -4617,  -3320,  -1515,
+       -92,    313,   -506,  -2251,  -4292,  -5890,  -6505,  -5964,  -4532,  -2781,  -1391,   -884,  -1468,  -2953,  -4869,  -6619,
+     -7724,  -7963,  -7452,  -6564,  -5790,  -5536,  -5988,  -7037,  -8342,  -9446,  -9957,  -9667,  -8629,  -7114,  -5509,  -4167,
+     -3293,  -2871,  -2699,  -2462,  -1871,   -760,    842,   2735,   4612,   6175,   7226,   7737,   7833,   7749,   7722,   7916,
+      8353,   8923,   9420,   9631,   9403,   8708,   7643,   6399,   5188,   4177,   3431,   2908,   2477,   1982,   1295,    375,
+      -726,  -1875,  -2910,  -3691,  -4150,  -4305,  -4254,  -4134,  -4071,  -4138,  -4337,  -4594,  -4801,  -4846,  -4666,  -4259,
+     -3693,  -3080,  -2537,  -2151,  -1951,  -1901,  -1918,  -1901,  -1768,  -1485,  -1076,   -615,   -199,     88,    200,    149,
+         0,   -149,   -200,    -88,    199,    615,   1076,   1485,   1768,   1901,   1918,   1901,   1951,   2151,   2537,   3080,
+      3693,   4259,   4666,   4846,   4801,   4594,   4337,   4138,   4071,   4134,   4254,   4305,   4150,   3691,   2910,   1875,
+       726,   -375,  -1295,  -1982,  -2477,  -2908,  -3431,  -4177,  -5188,  -6399,  -7643,  -8708,  -9403,  -9631,  -9420,  -8923,
+     -8353,  -7916,  -7722,  -7749,  -7833,  -7737,  -7226,  -6175,  -4612,  -2735,   -842,    760,   1871,   2462,   2699,   2871,
+      3293,   4167,   5509,   7114,   8629,   9667,   9957,   9446,   8342,   7037,   5988,   5536,   5790,   6564,   7452,   7963,
+      7724,   6619,   4869,   2953,   1468,    884,   1391,   2781,   4532,   5964,   6505,   5890,   4292,   2251,    506,   -313,
+        92,   1515,   3320,   4617,   4621,   2906,   -368,  -4532,  -8589, -11612, -13053, -13007, -12153, -11563, -12248, -14804,
+    -19090, -24279, -29049, -32110, -32602, -30504, -26591, -22257, -18909, -17532, -18166, -19978, -21369, -20743, -16885,  -9751,
+         0,  16960,  21339,  18200,  18891,  26612,  32590,  29064,  19081,  12260,  12146,  13063,   8583,    376,  -4626,  -3313,
+       -97,   -500,  -4296,  -6500,  -4535,  -1386,  -1471,  -4864,  -7727,  -7448,  -5793,  -5985,  -8344,  -9954,  -8631,  -5506,
+     -3295,  -2697,  -1873,    844,   4610,   7228,   7832,   7724,   8351,   9422,   9402,   7645,   5187,   3432,   2476,   1296,
+      -727,  -2909,  -4150,  -4253,  -4071,  -4336,  -4801,  -4665,  -3694,  -2537,  -1951,  -1918,  -1768,  -1076,   -199,    200,
+         0,   -200,    199,   1076,   1768,   1918,   1951,   2537,   3694,   4665,   4801,   4336,   4071,   4253,   4150,   2909,
+       727,  -1296,  -2476,  -3432,  -5187,  -7645,  -9402,  -9422,  -8351,  -7724,  -7832,  -7228,  -4610,   -844,   1873,   2697,
+      3295,   5506,   8631,   9954,   8344,   5985,   5793,   7448,   7727,   4864,   1471,   1386,   4535,   6500,   4296,    500,
+        97,   3313,   4626,   -376,  -8583, -13063, -12146, -12260, -19081, -29064, -32590, -26612, -18891, -18200, -21339, -16960,
+         0,  21612,  18718,  32767,  18955,  12273,   8488,  -4529,   -171,  -4219,  -4596,  -1409,  -7776,  -5742,  -8385,  -8589,
+     -3328,  -1838,   4582,   7861,   8329,   9425,   5169,   2495,   -741,  -4137,  -4082,  -4791,  -3701,  -1946,  -1772,   -197,
+         0,    197,   1772,   1946,   3701,   4791,   4082,   4137,    741,  -2495,  -5169,  -9425,  -8329,  -7861,  -4582,   1838,
+      3328,   8589,   8385,   5742,   7776,   1409,   4596,   4219,    171,   4529,  -8488, -12273, -18955, -32767, -18718, -21612,
+         0,  16419,  26068,  26895,  21395,  13233,   5238,   -552,  -3166,  -3412,  -3219,  -3897,  -5433,  -7152,  -8205,  -7632,
+     -4882,   -511,   4069,   7542,   9133,   8502,   5887,   2274,  -1100,  -3475,  -4630,  -4577,  -3593,  -2306,  -1275,   -575,
+         0,    575,   1275,   2306,   3593,   4577,   4630,   3475,   1100,  -2274,  -5887,  -8502,  -9133,  -7542,  -4069,    511,
+      4882,   7632,   8205,   7152,   5433,   3897,   3219,   3412,   3166,    552,  -5238, -13233, -21395, -26895, -26068, -16419,
+         0,  14150,  23985,  26914,  23005,  14724,   5657,  -1125,  -4268,  -4389,  -3355,  -3059,  -4353,  -6686,  -8543,  -8396,
+     -5600,   -777,   4479,   8377,   9734,   8425,   5288,   1618,  -1445,  -3316,  -4012,  -3904,  -3400,  -2732,  -1946,  -1025,
+         0,   1025,   1946,   2732,   3400,   3904,   4012,   3316,   1445,  -1618,  -5288,  -8425,  -9734,  -8377,  -4479,    777,
+      5600,   8396,   8543,   6686,   4353,   3059,   3355,   4389,   4268,   1125,  -5657, -14724, -23005, -26914, -23985, -14150,
+         0,   5509,  10306,  13780,  15503,  15293,  13230,   9650,   5087,    193,  -4350,  -7935, -10113, -10650,  -9561,  -7095,
+     -3695,     78,   3629,   6419,   8052,   8322,   7247,   5054,   2143,   -984,  -3805,  -5860,  -6824,  -6561,  -5137,  -2813,
+         0,   2813,   5137,   6561,   6824,   5860,   3805,    984,  -2143,  -5054,  -7247,  -8322,  -8052,  -6419,  -3629,    -78,
+      3695,   7095,   9561,  10650,  10113,   7935,   4350,   -193,  -5087,  -9650, -13230, -15293, -15503, -13780, -10306,  -5509,
+         0,    357,    701,   1023,   1312,   1558,   1753,   1893,   1973,   1991,   1949,   1849,   1695,   1496,   1258,    992,
+       709,    418,    132,   -140,   -386,   -599,   -771,   -896,   -971,   -994,   -966,   -890,   -770,   -612,   -425,   -218,
+         0,    218,    425,    612,    770,    890,    966,    994,    971,    896,    771,    599,    386,    140,   -132,   -418,
+      -709,   -992,  -1258,  -1496,  -1695,  -1849,  -1949,  -1991,  -1973,  -1893,  -1753,  -1558,  -1312,  -1023,   -701,   -357,
+         0,     69,    138,    206,    271,    334,    394,    450,    501,    548,    589,    625,    655,    678,    695,    705,
+       709,    705,    695,    678,    655,    625,    589,    548,    501,    450,    394,    334,    271,    206,    138,     69,
+         0,    -69,   -138,   -206,   -271,   -334,   -394,   -450,   -501,   -548,   -589,   -625,   -655,   -678,   -695,   -705,
+      -709,   -705,   -695,   -678,   -655,   -625,   -589,   -548,   -501,   -450,   -394,   -334,   -271,   -206,   -138,    -69,
+    
+    // Frame 13
+         0,   9307,  16166,  19971,  20693,  19383,  17469,  16464,  17266,  20031,  24026,  28047,  30754,  31241,  29243,  25290,
+     20419,  15883,  12663,  11224,  11340,  12283,  13055,  12806,  11084,   8019,   4215,    566,  -2097,  -3251,  -2876,  -1401,
+       426,   1839,   2281,   1603,     60,  -1779,  -3274,  -3918,  -3537,  -2310,   -720,    645,   1273,    919,   -349,  -2170,
+     -4043,  -5488,  -6220,  -6216,  -5720,  -5122,  -4830,  -5107,  -5998,  -7307,  -8689,  -9749, -10200,  -9929,  -9044,  -7807,
+     -6551,  -5551,  -4948,  -4698,  -4616,  -4436,  -3927,  -2961,  -1568,     86,   1748,   3172,   4188,   4758,   4969,   4999,
+      5039,   5235,   5628,   6155,   6672,   7009,   7032,   6689,   6021,   5154,   4246,   3442,   2827,   2408,   2118,   1856,
+      1518,   1045,    439,   -239,   -891,  -1414,  -1738,  -1843,  -1762,  -1567,  -1342,  -1153,  -1034,   -977,   -944,   -884,
+      -756,   -543,   -259,     59,    363,    609,    769,    839,    831,    770,    679,    578,    473,    364,    250,    128,
+         0,   -128,   -250,   -364,   -473,   -578,   -679,   -770,   -831,   -839,   -769,   -609,   -363,    -59,    259,    543,
+       756,    884,    944,    977,   1034,   1153,   1342,   1567,   1762,   1843,   1738,   1414,    891,    239,   -439,  -1045,
+     -1518,  -1856,  -2118,  -2408,  -2827,  -3442,  -4246,  -5154,  -6021,  -6689,  -7032,  -7009,  -6672,  -6155,  -5628,  -5235,
+     -5039,  -4999,  -4969,  -4758,  -4188,  -3172,  -1748,    -86,   1568,   2961,   3927,   4436,   4616,   4698,   4948,   5551,
+      6551,   7807,   9044,   9929,  10200,   9749,   8689,   7307,   5998,   5107,   4830,   5122,   5720,   6216,   6220,   5488,
+      4043,   2170,    349,   -919,  -1273,   -645,    720,   2310,   3537,   3918,   3274,   1779,    -60,  -1603,  -2281,  -1839,
+      -426,   1401,   2876,   3251,   2097,   -566,  -4215,  -8019, -11084, -12806, -13055, -12283, -11340, -11224, -12663, -15883,
+    -20419, -25290, -29243, -31241, -30754, -28047, -24026, -20031, -17266, -16464, -17469, -19383, -20693, -19971, -16166,  -9307,
+         0,  16239,  20664,  17502,  17250,  24047,  30742,  29258,  20410,  12675,  11333,  13064,  11078,   4223,  -2102,  -2869,
+       421,   2287,     56,  -3268,  -3541,   -716,   1270,   -345,  -4046,  -6216,  -5723,  -4827,  -6000,  -8685, -10202,  -9042,
+     -6553,  -4946,  -4617,  -3925,  -1569,   1750,   4186,   4971,   5038,   5629,   6671,   7034,   6020,   4247,   2826,   2120,
+      1517,    440,   -891,  -1737,  -1763,  -1341,  -1035,   -943,   -756,   -258,    363,    769,    831,    680,    473,    250,
+         0,   -250,   -473,   -680,   -831,   -769,   -363,    258,    756,    943,   1035,   1341,   1763,   1737,    891,   -440,
+     -1517,  -2120,  -2826,  -4247,  -6020,  -7034,  -6671,  -5629,  -5038,  -4971,  -4186,  -1750,   1569,   3925,   4617,   4946,
+      6553,   9042,  10202,   8685,   6000,   4827,   5723,   6216,   4046,    345,  -1270,    716,   3541,   3268,    -56,  -2287,
+      -421,   2869,   2102,  -4223, -11078, -13064, -11333, -12675, -20410, -29258, -30742, -24047, -17250, -17502, -20664, -16239,
+         0,  20921,  17093,  30902,  20300,  11445,  10996,  -2017,    358,    122,  -3592,   1324,  -4087,  -5679,  -6034, -10166,
+     -6582,  -4588,  -1593,   4211,   5019,   6691,   6004,   2842,   1505,   -879,  -1772,  -1026,   -762,    368,    828,    474,
+         0,   -474,   -828,   -368,    762,   1026,   1772,    879,  -1505,  -2842,  -6004,  -6691,  -5019,  -4211,   1593,   4588,
+      6582,  10166,   6034,   5679,   4087,  -1324,   3592,   -122,   -358,   2017, -10996, -11445, -20300, -30902, -17093, -20921,
+         0,  15371,  24562,  25748,  21191,  14083,   6870,   1484,   -976,  -1122,   -775,  -1304,  -2925,  -5223,  -7474,  -8573,
+     -7588,  -4611,   -674,   3067,   5723,   6627,   5624,   3395,   1029,   -717,  -1550,  -1405,   -540,    377,    744,    514,
+         0,   -514,   -744,   -377,    540,   1405,   1550,    717,  -1029,  -3395,  -5624,  -6627,  -5723,  -3067,    674,   4611,
+      7588,   8573,   7474,   5223,   2925,   1304,    775,   1122,    976,  -1484,  -6870, -14083, -21191, -25748, -24562, -15371,
+         0,  13335,  22743,  25841,  22638,  15326,   7156,    978,  -1888,  -1932,   -877,   -576,  -2016,  -4868,  -7786,  -9199,
+     -8163,  -4828,   -334,   3766,   6216,   6542,   5121,   2871,    757,   -594,  -1046,   -845,   -384,     15,    195,    160,
+         0,   -160,   -195,    -15,    384,    845,   1046,    594,   -757,  -2871,  -5121,  -6542,  -6216,  -3766,    334,   4828,
+      8163,   9199,   7786,   4868,   2016,    576,    877,   1932,   1888,   -978,  -7156, -15326, -22638, -25841, -22743, -13335,
+         0,   5365,  10095,  13639,  15602,  15795,  14259,  11253,   7213,   2691,  -1723,  -5482,  -8156,  -9485,  -9405,  -8050,
+     -5720,  -2832,    149,   2781,   4708,   5707,   5718,   4839,   3306,   1441,   -400,  -1891,  -2788,  -2969,  -2450,  -1377,
+         0,   1377,   2450,   2969,   2788,   1891,    400,  -1441,  -3306,  -4839,  -5718,  -5707,  -4708,  -2781,   -149,   2832,
+      5720,   8050,   9405,   9485,   8156,   5482,   1723,  -2691,  -7213, -11253, -14259, -15795, -15602, -13639, -10095,  -5365,
+         0,    465,    915,   1335,   1710,   2029,   2282,   2461,   2561,   2580,   2519,   2382,   2175,   1907,   1590,   1236,
+       859,    474,     95,   -263,   -588,   -867,  -1091,  -1252,  -1346,  -1371,  -1328,  -1219,  -1053,   -836,   -580,   -297,
+         0,    297,    580,    836,   1053,   1219,   1328,   1371,   1346,   1252,   1091,    867,    588,    263,    -95,   -474,
+      -859,  -1236,  -1590,  -1907,  -2175,  -2382,  -2519,  -2580,  -2561,  -2461,  -2282,  -2029,  -1710,  -1335,   -915,   -465,
+         0,     84,    168,    249,    329,    405,    477,    545,    607,    664,    714,    757,    793,    822,    842,    855,
+       859,    855,    842,    822,    793,    757,    714,    664,    607,    545,    477,    405,    329,    249,    168,     84,
+         0,    -84,   -168,   -249,   -329,   -405,   -477,   -545,   -607,   -664,   -714,   -757,   -793,   -822,   -842,   -855,
+      -859,   -855,   -842,   -822,   -793,   -757,   -714,   -664,   -607,   -545,   -477,   -405,   -329,   -249,   -168,    -84,
+    
+    // Frame 14
+         0,   8951,  15606,  19410,  20274,  19102,  17163,  15888,  16211,  18449,  22101,  26167,  29400,  30817,  29929,  26958,
+     22667,  18167,  14493,  12343,  11832,  12549,  13679,  14344,  13856,  11978,   8945,   5405,   2161,    -61,   -876,   -309,
+      1195,   2971,   4317,   4753,   4128,   2673,    872,   -682,  -1522,  -1426,   -507,    860,   2145,   2863,   2705,   1646,
+       -79,  -2044,  -3797,  -4987,  -5482,  -5385,  -4995,  -4682,  -4776,  -5438,  -6632,  -8122,  -9575, -10649, -11119, -10929,
+    -10206,  -9205,  -8224,  -7499,  -7142,  -7101,  -7202,  -7200,  -6881,  -6120,  -4932,  -3457,  -1922,   -553,    476,   1111,
+      1410,   1526,   1645,   1921,   2427,   3134,   3923,   4633,   5109,   5262,   5089,   4679,   4173,   3726,   3451,   3391,
+      3508,   3703,   3855,   3862,   3679,   3329,   2897,   2497,   2233,   2168,   2299,   2567,   2870,   3106,   3201,   3135,
+      2941,   2696,   2486,   2378,   2394,   2506,   2643,   2718,   2657,   2425,   2038,   1557,   1064,    637,    325,    127,
+         0,   -127,   -325,   -637,  -1064,  -1557,  -2038,  -2425,  -2657,  -2718,  -2643,  -2506,  -2394,  -2378,  -2486,  -2696,
+     -2941,  -3135,  -3201,  -3106,  -2870,  -2567,  -2299,  -2168,  -2233,  -2497,  -2897,  -3329,  -3679,  -3862,  -3855,  -3703,
+     -3508,  -3391,  -3451,  -3726,  -4173,  -4679,  -5089,  -5262,  -5109,  -4633,  -3923,  -3134,  -2427,  -1921,  -1645,  -1526,
+     -1410,  -1111,   -476,    553,   1922,   3457,   4932,   6120,   6881,   7200,   7202,   7101,   7142,   7499,   8224,   9205,
+     10206,  10929,  11119,  10649,   9575,   8122,   6632,   5438,   4776,   4682,   4995,   5385,   5482,   4987,   3797,   2044,
+        79,  -1646,  -2705,  -2863,  -2145,   -860,    507,   1426,   1522,    682,   -872,  -2673,  -4128,  -4753,  -4317,  -2971,
+     -1195,    309,    876,     61,  -2161,  -5405,  -8945, -11978, -13856, -14344, -13679, -12549, -11832, -12343, -14493, -18167,
+    -22667, -26958, -29929, -30817, -29400, -26167, -22101, -18449, -16211, -15888, -17163, -19102, -20274, -19410, -15606,  -8951,
+         0,  15678,  20245,  17196,  16194,  22122,  29388,  29944,  22658,  14504,  11825,  13688,  13850,   8952,   2156,   -869,
+      1191,   4323,   4125,    878,  -1526,   -502,   2142,   2709,    -81,  -3793,  -5485,  -4992,  -4778,  -6629,  -9577, -11116,
+    -10208,  -8222,  -7143,  -7199,  -6882,  -4930,  -1923,    478,   1408,   1646,   2426,   3925,   5108,   5090,   4172,   3452,
+      3507,   3856,   3678,   2898,   2232,   2300,   2869,   3202,   2941,   2486,   2394,   2643,   2657,   2039,   1064,    325,
+         0,   -325,  -1064,  -2039,  -2657,  -2643,  -2394,  -2486,  -2941,  -3202,  -2869,  -2300,  -2232,  -2898,  -3678,  -3856,
+     -3507,  -3452,  -4172,  -5090,  -5108,  -3925,  -2426,  -1646,  -1408,   -478,   1923,   4930,   6882,   7199,   7143,   8222,
+     10208,  11116,   9577,   6629,   4778,   4992,   5485,   3793,     81,  -2709,  -2142,    502,   1526,   -878,  -4125,  -4323,
+     -1191,    869,  -2156,  -8952, -13850, -13688, -11825, -14504, -22658, -29944, -29388, -22122, -16194, -17196, -20245, -15678,
+         0,  20488,  16052,  29534,  22560,  11926,  13778,   2231,   1136,   4183,  -1570,   2189,   -117,  -5446,  -4808,  -9545,
+    -10233,  -7117,  -6903,  -1901,   1392,   2443,   5094,   4186,   3497,   3688,   2225,   2877,   2936,   2398,   2654,   1065,
+         0,  -1065,  -2654,  -2398,  -2936,  -2877,  -2225,  -3688,  -3497,  -4186,  -5094,  -2443,  -1392,   1901,   6903,   7117,
+     10233,   9545,   4808,   5446,    117,  -2189,   1570,  -4183,  -1136,  -2231, -13778, -11926, -22560, -29534, -16052, -20488,
+         0,  14585,  23545,  25282,  21839,  15918,   9524,   4424,   1829,   1370,   1454,    806,   -892,  -3488,  -6516,  -8944,
+     -9662,  -8385,  -5694,  -2354,    922,   3349,   4415,   4340,   3777,   3181,   2740,   2619,   2785,   2812,   2281,   1241,
+         0,  -1241,  -2281,  -2812,  -2785,  -2619,  -2740,  -3181,  -3777,  -4340,  -4415,  -3349,   -922,   2354,   5694,   8385,
+      9662,   8944,   6516,   3488,    892,   -806,  -1454,  -1370,  -1829,  -4424,  -9524, -15918, -21839, -25282, -23545, -14585,
+         0,  12728,  21932,  25435,  23157,  16962,   9709,   3978,   1069,    683,   1372,   1449,   -111,  -3217,  -6807,  -9463,
+    -10127,  -8569,  -5410,  -1755,   1336,   3257,   3986,   3917,   3560,   3274,   3157,   3096,   2915,   2496,   1823,    960,
+         0,   -960,  -1823,  -2496,  -2915,  -3096,  -3157,  -3274,  -3560,  -3917,  -3986,  -3257,  -1336,   1755,   5410,   8569,
+     10127,   9463,   6807,   3217,    111,  -1449,  -1372,   -683,  -1069,  -3978,  -9709, -16962, -23157, -25435, -21932, -12728,
+         0,   5392,  10216,  13972,  16289,  16966,  15996,  13560,   9996,   5758,   1350,  -2734,  -6072,  -8363,  -9453,  -9346,
+     -8191,  -6249,  -3851,  -1344,    954,   2796,   4030,   4612,   4597,   4114,   3340,   2458,   1626,    954,    482,    189,
+         0,   -189,   -482,   -954,  -1626,  -2458,  -3340,  -4114,  -4597,  -4612,  -4030,  -2796,   -954,   1344,   3851,   6249,
+      8191,   9346,   9453,   8363,   6072,   2734,  -1350,  -5758,  -9996, -13560, -15996, -16966, -16289, -13972, -10216,  -5392,
+         0,    631,   1241,   1809,   2316,   2746,   3085,   3323,   3452,   3470,   3379,   3183,   2892,   2518,   2077,   1585,
+      1064,    532,     10,   -482,   -926,  -1307,  -1610,  -1826,  -1948,  -1973,  -1903,  -1743,  -1502,  -1191,   -826,   -422,
+         0,    422,    826,   1191,   1502,   1743,   1903,   1973,   1948,   1826,   1610,   1307,    926,    482,    -10,   -532,
+     -1064,  -1585,  -2077,  -2518,  -2892,  -3183,  -3379,  -3470,  -3452,  -3323,  -3085,  -2746,  -2316,  -1809,  -1241,   -631,
+         0,    104,    208,    309,    407,    501,    591,    675,    752,    822,    884,    938,    983,   1018,   1043,   1059,
+      1064,   1059,   1043,   1018,    983,    938,    884,    822,    752,    675,    591,    501,    407,    309,    208,    104,
+         0,   -104,   -208,   -309,   -407,   -501,   -591,   -675,   -752,   -822,   -884,   -938,   -983,  -1018,  -1043,  -1059,
+     -1064,  -1059,  -1043,  -1018,   -983,   -938,   -884,   -822,   -752,   -675,   -591,   -501,   -407,   -309,   -208,   -104,
+    
+    // Frame 15
+         0,   8653,  15152,  18997,  20044,  19063,  17171,  15700,  15596,  17308,  20542,  24508,  28085,  30275,  30424,  28482,
+     24929,  20674,  16711,  13877,  12567,  12695,  13711,  14845,  15314,  14613,  12620,   9654,   6325,   3373,   1404,    747,
+      1339,   2788,   4482,   5808,   6308,   5828,   4525,   2817,   1217,    191,     -7,    615,   1777,   3048,   3954,   4150,
+      3491,   2088,    241,  -1641,  -3183,  -4141,  -4480,  -4352,  -4060,  -3930,  -4230,  -5069,  -6382,  -7943,  -9449, -10600,
+    -11200, -11197, -10699,  -9923,  -9136,  -8556,  -8304,  -8360,  -8588,  -8777,  -8715,  -8253,  -7354,  -6096,  -4655,  -3240,
+     -2041,  -1170,   -637,   -350,   -158,    108,    573,   1285,   2198,   3195,   4119,   4827,   5228,   5313,   5151,   4868,
+      4608,   4486,   4561,   4816,   5170,   5507,   5709,   5699,   5457,   5033,   4523,   4044,   3699,   3542,   3568,   3714,
+      3881,   3964,   3883,   3608,   3169,   2641,   2124,   1712,   1461,   1377,   1413,   1483,   1490,   1355,   1042,    568,
+         0,   -568,  -1042,  -1355,  -1490,  -1483,  -1413,  -1377,  -1461,  -1712,  -2124,  -2641,  -3169,  -3608,  -3883,  -3964,
+     -3881,  -3714,  -3568,  -3542,  -3699,  -4044,  -4523,  -5033,  -5457,  -5699,  -5709,  -5507,  -5170,  -4816,  -4561,  -4486,
+     -4608,  -4868,  -5151,  -5313,  -5228,  -4827,  -4119,  -3195,  -2198,  -1285,   -573,   -108,    158,    350,    637,   1170,
+      2041,   3240,   4655,   6096,   7354,   8253,   8715,   8777,   8588,   8360,   8304,   8556,   9136,   9923,  10699,  11197,
+     11200,  10600,   9449,   7943,   6382,   5069,   4230,   3930,   4060,   4352,   4480,   4141,   3183,   1641,   -241,  -2088,
+     -3491,  -4150,  -3954,  -3048,  -1777,   -615,      7,   -191,  -1217,  -2817,  -4525,  -5828,  -6308,  -5808,  -4482,  -2788,
+     -1339,   -747,  -1404,  -3373,  -6325,  -9654, -12620, -14613, -15314, -14845, -13711, -12695, -12567, -13877, -16711, -20674,
+    -24929, -28482, -30424, -30275, -28085, -24508, -20542, -17308, -15596, -15700, -17171, -19063, -20044, -18997, -15152,  -8653,
+         0,  15224,  20016,  17203,  15580,  20562,  28073,  30439,  24920,  16722,  12560,  13720,  15308,  12628,   6320,   1410,
+      1335,   4488,   6304,   4530,   1213,     -2,   1775,   3958,   3489,    244,  -3185,  -4476,  -4062,  -4227,  -6384,  -9446,
+    -11202, -10696,  -9137,  -8302,  -8590,  -8713,  -7355,  -4653,  -2042,   -635,   -159,    574,   2197,   4120,   5227,   5152,
+      4607,   4561,   5169,   5710,   5457,   4523,   3698,   3568,   3881,   3883,   3169,   2125,   1460,   1413,   1490,   1042,
+         0,  -1042,  -1490,  -1413,  -1460,  -2125,  -3169,  -3883,  -3881,  -3568,  -3698,  -4523,  -5457,  -5710,  -5169,  -4561,
+     -4607,  -5152,  -5227,  -4120,  -2197,   -574,    159,    635,   2042,   4653,   7355,   8713,   8590,   8302,   9137,  10696,
+     11202,   9446,   6384,   4227,   4062,   4476,   3185,   -244,  -3489,  -3958,  -1775,      2,  -1213,  -4530,  -6304,  -4488,
+     -1335,  -1410,  -6320, -12628, -15308, -13720, -12560, -16722, -24920, -30439, -28073, -20562, -15580, -17203, -20016, -15224,
+         0,  20247,  15450,  28207,  24833,  12651,  15245,   6387,   1286,   6356,   1175,   1817,   3457,  -3151,  -4087,  -6356,
+    -11224,  -9114,  -8607,  -7336,  -2057,   -143,   2185,   5239,   4598,   5179,   5450,   3705,   3877,   3173,   1458,   1491,
+         0,  -1491,  -1458,  -3173,  -3877,  -3705,  -5450,  -5179,  -4598,  -5239,  -2185,    143,   2057,   7336,   8607,   9114,
+     11224,   6356,   4087,   3151,  -3457,  -1817,  -1175,  -6356,  -1286,  -6387, -15245, -12651, -24833, -28207, -15450, -20247,
+         0,  14015,  22836,  25048,  22517,  17519,  11681,   6662,   3824,   3055,   2997,   2496,   1151,  -1180,  -4371,  -7582,
+     -9645,  -9998,  -8796,  -6356,  -3097,    199,   2742,   4319,   5136,   5307,   4907,   4253,   3633,   2954,   2033,    986,
+         0,   -986,  -2033,  -2954,  -3633,  -4253,  -4907,  -5307,  -5136,  -4319,  -2742,   -199,   3097,   6356,   8796,   9998,
+      9645,   7582,   4371,   1180,  -1151,  -2496,  -2997,  -3055,  -3824,  -6662, -11681, -17519, -22517, -25048, -22836, -14015,
+         0,  12294,  21386,  25256,  23733,  18398,  11783,   6271,   3188,   2460,   2925,   3075,   1833,   -975,  -4645,  -8013,
+    -10024, -10160,  -8558,  -5832,  -2742,    101,   2369,   3976,   4961,   5375,   5257,   4670,   3744,   2672,   1645,    763,
+         0,   -763,  -1645,  -2672,  -3744,  -4670,  -5257,  -5375,  -4961,  -3976,  -2369,   -101,   2742,   5832,   8558,  10160,
+     10024,   8013,   4645,    975,  -1833,  -3075,  -2925,  -2460,  -3188,  -6271, -11783, -18398, -23733, -25256, -21386, -12294,
+         0,   5381,  10248,  14143,  16718,  17770,  17259,  15311,  12195,   8289,   4028,   -142,  -3818,  -6684,  -8536,  -9300,
+     -9027,  -7872,  -6071,  -3896,  -1626,    494,   2273,   3590,   4397,   4714,   4605,   4166,   3497,   2690,   1814,    910,
+         0,   -910,  -1814,  -2690,  -3497,  -4166,  -4605,  -4714,  -4397,  -3590,  -2273,   -494,   1626,   3896,   6071,   7872,
+      9027,   9300,   8536,   6684,   3818,    142,  -4028,  -8289, -12195, -15311, -17259, -17770, -16718, -14143, -10248,  -5381,
+         0,    893,   1756,   2559,   3275,   3880,   4354,   4683,   4856,   4870,   4727,   4435,   4007,   3461,   2819,   2107,
+      1353,    586,   -165,   -871,  -1507,  -2048,  -2477,  -2778,  -2942,  -2966,  -2850,  -2604,  -2239,  -1773,  -1228,   -628,
+         0,    628,   1228,   1773,   2239,   2604,   2850,   2966,   2942,   2778,   2477,   2048,   1507,    871,    165,   -586,
+     -1353,  -2107,  -2819,  -3461,  -4007,  -4435,  -4727,  -4870,  -4856,  -4683,  -4354,  -3880,  -3275,  -2559,  -1756,   -893,
+         0,    133,    264,    393,    518,    638,    752,    858,    957,   1046,   1125,   1193,   1250,   1295,   1327,   1347,
+      1353,   1347,   1327,   1295,   1250,   1193,   1125,   1046,    957,    858,    752,    638,    518,    393,    264,    133,
+         0,   -133,   -264,   -393,   -518,   -638,   -752,   -858,   -957,  -1046,  -1125,  -1193,  -1250,  -1295,  -1327,  -1347,
+     -1353,  -1347,  -1327,  -1295,  -1250,  -1193,  -1125,  -1046,   -957,   -858,   -752,   -638,   -518,   -393,   -264,   -133,
+    
+};
+
+alignas(4) const int16_t wavetableSet_Additive[16 * FrameMip::FRAME_SIZE] = {
+    // Frame 0
+         0,    437,    874,   1310,   1746,   2180,   2613,   3045,   3475,   3903,   4328,   4751,   5170,   5587,   6001,   6410,
+      6816,   7218,   7615,   8008,   8396,   8779,   9157,   9529,   9896,  10256,  10610,  10958,  11300,  11634,  11962,  12282,
+     12595,  12900,  13197,  13487,  13769,  14042,  14306,  14562,  14810,  15048,  15277,  15498,  15708,  15910,  16101,  16283,
+     16456,  16618,  16770,  16913,  17045,  17166,  17278,  17379,  17469,  17549,  17619,  17678,  17726,  17763,  17790,  17806,
+     17812,  17806,  17790,  17763,  17726,  17678,  17619,  17549,  17469,  17379,  17278,  17166,  17045,  16913,  16770,  16618,
+     16456,  16283,  16101,  15910,  15708,  15498,  15277,  15048,  14810,  14562,  14306,  14042,  13769,  13487,  13197,  12900,
+     12595,  12282,  11962,  11634,  11300,  10958,  10610,  10256,   9896,   9529,   9157,   8779,   8396,   8008,   7615,   7218,
+      6816,   6410,   6001,   5587,   5170,   4751,   4328,   3903,   3475,   3045,   2613,   2180,   1746,   1310,    874,    437,
+         0,   -437,   -874,  -1310,  -1746,  -2180,  -2613,  -3045,  -3475,  -3903,  -4328,  -4751,  -5170,  -5587,  -6001,  -6410,
+     -6816,  -7218,  -7615,  -8008,  -8396,  -8779,  -9157,  -9529,  -9896, -10256, -10610, -10958, -11300, -11634, -11962, -12282,
+    -12595, -12900, -13197, -13487, -13769, -14042, -14306, -14562, -14810, -15048, -15277, -15498, -15708, -15910, -16101, -16283,
+    -16456, -16618, -16770, -16913, -17045, -17166, -17278, -17379, -17469, -17549, -17619, -17678, -17726, -17763, -17790, -17806,
+    -17812, -17806, -17790, -17763, -17726, -17678, -17619, -17549, -17469, -17379, -17278, -17166, -17045, -16913, -16770, -16618,
+    -16456, -16283, -16101, -15910, -15708, -15498, -15277, -15048, -14810, -14562, -14306, -14042, -13769, -13487, -13197, -12900,
+    -12595, -12282, -11962, -11634, -11300, -10958, -10610, -10256,  -9896,  -9529,  -9157,  -8779,  -8396,  -8008,  -7615,  -7218,
+     -6816,  -6410,  -6001,  -5587,  -5170,  -4751,  -4328,  -3903,  -3475,  -3045,  -2613,  -2180,  -1746,  -1310,   -874,   -437,
+         0,    874,   1746,   2613,   3475,   4328,   5170,   6001,   6816,   7615,   8396,   9157,   9896,  10610,  11300,  11962,
+     12595,  13197,  13769,  14306,  14810,  15277,  15708,  16101,  16456,  16770,  17045,  17278,  17469,  17619,  17726,  17790,
+     17812,  17790,  17726,  17619,  17469,  17278,  17045,  16770,  16456,  16101,  15708,  15277,  14810,  14306,  13769,  13197,
+     12595,  11962,  11300,  10610,   9896,   9157,   8396,   7615,   6816,   6001,   5170,   4328,   3475,   2613,   1746,    874,
+         0,   -874,  -1746,  -2613,  -3475,  -4328,  -5170,  -6001,  -6816,  -7615,  -8396,  -9157,  -9896, -10610, -11300, -11962,
+    -12595, -13197, -13769, -14306, -14810, -15277, -15708, -16101, -16456, -16770, -17045, -17278, -17469, -17619, -17726, -17790,
+    -17812, -17790, -17726, -17619, -17469, -17278, -17045, -16770, -16456, -16101, -15708, -15277, -14810, -14306, -13769, -13197,
+    -12595, -11962, -11300, -10610,  -9896,  -9157,  -8396,  -7615,  -6816,  -6001,  -5170,  -4328,  -3475,  -2613,  -1746,   -874,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 1
+         0,    604,   1207,   1808,   2408,   3005,   3599,   4189,   4774,   5354,   5928,   6496,   7056,   7609,   8154,   8690,
+      9217,   9733,  10240,  10735,  11219,  11691,  12151,  12598,  13032,  13452,  13859,  14251,  14629,  14992,  15340,  15672,
+     15989,  16291,  16576,  16845,  17098,  17335,  17555,  17759,  17946,  18117,  18271,  18409,  18531,  18636,  18726,  18799,
+     18856,  18898,  18924,  18935,  18931,  18912,  18878,  18830,  18768,  18693,  18604,  18502,  18388,  18261,  18123,  17973,
+     17812,  17640,  17457,  17265,  17063,  16853,  16633,  16406,  16170,  15927,  15677,  15421,  15159,  14890,  14617,  14338,
+     14055,  13768,  13477,  13183,  12886,  12586,  12284,  11979,  11673,  11366,  11058,  10749,  10439,  10129,   9819,   9509,
+      9200,   8891,   8583,   8276,   7970,   7665,   7362,   7060,   6759,   6460,   6163,   5867,   5574,   5282,   4991,   4703,
+      4416,   4130,   3847,   3565,   3284,   3005,   2728,   2451,   2176,   1901,   1628,   1355,   1084,    812,    541,    271,
+         0,   -271,   -541,   -812,  -1084,  -1355,  -1628,  -1901,  -2176,  -2451,  -2728,  -3005,  -3284,  -3565,  -3847,  -4130,
+     -4416,  -4703,  -4991,  -5282,  -5574,  -5867,  -6163,  -6460,  -6759,  -7060,  -7362,  -7665,  -7970,  -8276,  -8583,  -8891,
+     -9200,  -9509,  -9819, -10129, -10439, -10749, -11058, -11366, -11673, -11979, -12284, -12586, -12886, -13183, -13477, -13768,
+    -14055, -14338, -14617, -14890, -15159, -15421, -15677, -15927, -16170, -16406, -16633, -16853, -17063, -17265, -17457, -17640,
+    -17812, -17973, -18123, -18261, -18388, -18502, -18604, -18693, -18768, -18830, -18878, -18912, -18931, -18935, -18924, -18898,
+    -18856, -18799, -18726, -18636, -18531, -18409, -18271, -18117, -17946, -17759, -17555, -17335, -17098, -16845, -16576, -16291,
+    -15989, -15672, -15340, -14992, -14629, -14251, -13859, -13452, -13032, -12598, -12151, -11691, -11219, -10735, -10240,  -9733,
+     -9217,  -8690,  -8154,  -7609,  -7056,  -6496,  -5928,  -5354,  -4774,  -4189,  -3599,  -3005,  -2408,  -1808,  -1207,   -604,
+         0,   1207,   2408,   3599,   4774,   5928,   7056,   8154,   9217,  10240,  11219,  12151,  13032,  13859,  14629,  15340,
+     15989,  16576,  17098,  17555,  17946,  18271,  18531,  18726,  18856,  18924,  18931,  18878,  18768,  18604,  18388,  18123,
+     17812,  17457,  17063,  16633,  16170,  15677,  15159,  14617,  14055,  13477,  12886,  12284,  11673,  11058,  10439,   9819,
+      9200,   8583,   7970,   7362,   6759,   6163,   5574,   4991,   4416,   3847,   3284,   2728,   2176,   1628,   1084,    541,
+         0,   -541,  -1084,  -1628,  -2176,  -2728,  -3284,  -3847,  -4416,  -4991,  -5574,  -6163,  -6759,  -7362,  -7970,  -8583,
+     -9200,  -9819, -10439, -11058, -11673, -12284, -12886, -13477, -14055, -14617, -15159, -15677, -16170, -16633, -17063, -17457,
+    -17812, -18123, -18388, -18604, -18768, -18878, -18931, -18924, -18856, -18726, -18531, -18271, -17946, -17555, -17098, -16576,
+    -15989, -15340, -14629, -13859, -13032, -12151, -11219, -10240,  -9217,  -8154,  -7056,  -5928,  -4774,  -3599,  -2408,  -1207,
+         0,   2408,   4774,   7056,   9217,  11219,  13032,  14629,  15989,  17098,  17946,  18531,  18856,  18931,  18768,  18388,
+     17812,  17063,  16170,  15159,  14055,  12886,  11673,  10439,   9200,   7970,   6759,   5574,   4416,   3284,   2176,   1084,
+         0,  -1084,  -2176,  -3284,  -4416,  -5574,  -6759,  -7970,  -9200, -10439, -11673, -12886, -14055, -15159, -16170, -17063,
+    -17812, -18388, -18768, -18931, -18856, -18531, -17946, -17098, -15989, -14629, -13032, -11219,  -9217,  -7056,  -4774,  -2408,
+         0,   2408,   4774,   7056,   9217,  11219,  13032,  14629,  15989,  17098,  17946,  18531,  18856,  18931,  18768,  18388,
+     17812,  17063,  16170,  15159,  14055,  12886,  11673,  10439,   9200,   7970,   6759,   5574,   4416,   3284,   2176,   1084,
+         0,  -1084,  -2176,  -3284,  -4416,  -5574,  -6759,  -7970,  -9200, -10439, -11673, -12886, -14055, -15159, -16170, -17063,
+    -17812, -18388, -18768, -18931, -18856, -18531, -17946, -17098, -15989, -14629, -13032, -11219,  -9217,  -7056,  -4774,  -2408,
+         0,   2408,   4774,   7056,   9217,  11219,  13032,  14629,  15989,  17098,  17946,  18531,  18856,  18931,  18768,  18388,
+     17812,  17063,  16170,  15159,  14055,  12886,  11673,  10439,   9200,   7970,   6759,   5574,   4416,   3284,   2176,   1084,
+         0,  -1084,  -2176,  -3284,  -4416,  -5574,  -6759,  -7970,  -9200, -10439, -11673, -12886, -14055, -15159, -16170, -17063,
+    -17812, -18388, -18768, -18931, -18856, -18531, -17946, -17098, -15989, -14629, -13032, -11219,  -9217,  -7056,  -4774,  -2408,
+         0,   2408,   4774,   7056,   9217,  11219,  13032,  14629,  15989,  17098,  17946,  18531,  18856,  18931,  18768,  18388,
+     17812,  17063,  16170,  15159,  14055,  12886,  11673,  10439,   9200,   7970,   6759,   5574,   4416,   3284,   2176,   1084,
+         0,  -1084,  -2176,  -3284,  -4416,  -5574,  -6759,  -7970,  -9200, -10439, -11673, -12886, -14055, -15159, -16170, -17063,
+    -17812, -18388, -18768, -18931, -18856, -18531, -17946, -17098, -15989, -14629, -13032, -11219,  -9217,  -7056,  -4774,  -2408,
+         0,   2408,   4774,   7056,   9217,  11219,  13032,  14629,  15989,  17098,  17946,  18531,  18856,  18931,  18768,  18388,
+     17812,  17063,  16170,  15159,  14055,  12886,  11673,  10439,   9200,   7970,   6759,   5574,   4416,   3284,   2176,   1084,
+         0,  -1084,  -2176,  -3284,  -4416,  -5574,  -6759,  -7970,  -9200, -10439, -11673, -12886, -14055, -15159, -16170, -17063,
+    -17812, -18388, -18768, -18931, -18856, -18531, -17946, -17098, -15989, -14629, -13032, -11219,  -9217,  -7056,  -4774,  -2408,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 2
+         0,    834,   1666,   2496,   3323,   4144,   4960,   5768,   6568,   7359,   8138,   8906,   9661,  10403,  11129,  11839,
+     12532,  13208,  13864,  14501,  15118,  15713,  16286,  16837,  17364,  17867,  18346,  18800,  19228,  19630,  20006,  20356,
+     20678,  20974,  21242,  21483,  21697,  21883,  22042,  22174,  22278,  22356,  22407,  22431,  22430,  22403,  22350,  22273,
+     22172,  22047,  21899,  21728,  21536,  21322,  21088,  20835,  20563,  20273,  19965,  19642,  19303,  18949,  18582,  18203,
+     17812,  17410,  16998,  16577,  16149,  15713,  15272,  14826,  14376,  13923,  13467,  13011,  12554,  12097,  11642,  11189,
+     10740,  10294,   9853,   9417,   8987,   8564,   8148,   7741,   7341,   6951,   6571,   6200,   5840,   5491,   5153,   4826,
+      4511,   4208,   3917,   3638,   3371,   3117,   2875,   2645,   2427,   2222,   2028,   1846,   1675,   1515,   1367,   1228,
+      1100,    982,    872,    772,    679,    595,    517,    446,    381,    322,    267,    216,    169,    124,     82,     40,
+         0,    -40,    -82,   -124,   -169,   -216,   -267,   -322,   -381,   -446,   -517,   -595,   -679,   -772,   -872,   -982,
+     -1100,  -1228,  -1367,  -1515,  -1675,  -1846,  -2028,  -2222,  -2427,  -2645,  -2875,  -3117,  -3371,  -3638,  -3917,  -4208,
+     -4511,  -4826,  -5153,  -5491,  -5840,  -6200,  -6571,  -6951,  -7341,  -7741,  -8148,  -8564,  -8987,  -9417,  -9853, -10294,
+    -10740, -11189, -11642, -12097, -12554, -13011, -13467, -13923, -14376, -14826, -15272, -15713, -16149, -16577, -16998, -17410,
+    -17812, -18203, -18582, -18949, -19303, -19642, -19965, -20273, -20563, -20835, -21088, -21322, -21536, -21728, -21899, -22047,
+    -22172, -22273, -22350, -22403, -22430, -22431, -22407, -22356, -22278, -22174, -22042, -21883, -21697, -21483, -21242, -20974,
+    -20678, -20356, -20006, -19630, -19228, -18800, -18346, -17867, -17364, -16837, -16286, -15713, -15118, -14501, -13864, -13208,
+    -12532, -11839, -11129, -10403,  -9661,  -8906,  -8138,  -7359,  -6568,  -5768,  -4960,  -4144,  -3323,  -2496,  -1666,   -834,
+         0,   1666,   3323,   4960,   6568,   8138,   9661,  11129,  12532,  13864,  15118,  16286,  17364,  18346,  19228,  20006,
+     20678,  21242,  21697,  22042,  22278,  22407,  22430,  22350,  22172,  21899,  21536,  21088,  20563,  19965,  19303,  18582,
+     17812,  16998,  16149,  15272,  14376,  13467,  12554,  11642,  10740,   9853,   8987,   8148,   7341,   6571,   5840,   5153,
+      4511,   3917,   3371,   2875,   2427,   2028,   1675,   1367,   1100,    872,    679,    517,    381,    267,    169,     82,
+         0,    -82,   -169,   -267,   -381,   -517,   -679,   -872,  -1100,  -1367,  -1675,  -2028,  -2427,  -2875,  -3371,  -3917,
+     -4511,  -5153,  -5840,  -6571,  -7341,  -8148,  -8987,  -9853, -10740, -11642, -12554, -13467, -14376, -15272, -16149, -16998,
+    -17812, -18582, -19303, -19965, -20563, -21088, -21536, -21899, -22172, -22350, -22430, -22407, -22278, -22042, -21697, -21242,
+    -20678, -20006, -19228, -18346, -17364, -16286, -15118, -13864, -12532, -11129,  -9661,  -8138,  -6568,  -4960,  -3323,  -1666,
+         0,   3323,   6568,   9661,  12532,  15118,  17364,  19228,  20678,  21697,  22278,  22430,  22172,  21536,  20563,  19303,
+     17812,  16149,  14376,  12554,  10740,   8987,   7341,   5840,   4511,   3371,   2427,   1675,   1100,    679,    381,    169,
+         0,   -169,   -381,   -679,  -1100,  -1675,  -2427,  -3371,  -4511,  -5840,  -7341,  -8987, -10740, -12554, -14376, -16149,
+    -17812, -19303, -20563, -21536, -22172, -22430, -22278, -21697, -20678, -19228, -17364, -15118, -12532,  -9661,  -6568,  -3323,
+         0,   3323,   6568,   9661,  12532,  15118,  17364,  19228,  20678,  21697,  22278,  22430,  22172,  21536,  20563,  19303,
+     17812,  16149,  14376,  12554,  10740,   8987,   7341,   5840,   4511,   3371,   2427,   1675,   1100,    679,    381,    169,
+         0,   -169,   -381,   -679,  -1100,  -1675,  -2427,  -3371,  -4511,  -5840,  -7341,  -8987, -10740, -12554, -14376, -16149,
+    -17812, -19303, -20563, -21536, -22172, -22430, -22278, -21697, -20678, -19228, -17364, -15118, -12532,  -9661,  -6568,  -3323,
+         0,   3323,   6568,   9661,  12532,  15118,  17364,  19228,  20678,  21697,  22278,  22430,  22172,  21536,  20563,  19303,
+     17812,  16149,  14376,  12554,  10740,   8987,   7341,   5840,   4511,   3371,   2427,   1675,   1100,    679,    381,    169,
+         0,   -169,   -381,   -679,  -1100,  -1675,  -2427,  -3371,  -4511,  -5840,  -7341,  -8987, -10740, -12554, -14376, -16149,
+    -17812, -19303, -20563, -21536, -22172, -22430, -22278, -21697, -20678, -19228, -17364, -15118, -12532,  -9661,  -6568,  -3323,
+         0,   3323,   6568,   9661,  12532,  15118,  17364,  19228,  20678,  21697,  22278,  22430,  22172,  21536,  20563,  19303,
+     17812,  16149,  14376,  12554,  10740,   8987,   7341,   5840,   4511,   3371,   2427,   1675,   1100,    679,    381,    169,
+         0,   -169,   -381,   -679,  -1100,  -1675,  -2427,  -3371,  -4511,  -5840,  -7341,  -8987, -10740, -12554, -14376, -16149,
+    -17812, -19303, -20563, -21536, -22172, -22430, -22278, -21697, -20678, -19228, -17364, -15118, -12532,  -9661,  -6568,  -3323,
+         0,   3323,   6568,   9661,  12532,  15118,  17364,  19228,  20678,  21697,  22278,  22430,  22172,  21536,  20563,  19303,
+     17812,  16149,  14376,  12554,  10740,   8987,   7341,   5840,   4511,   3371,   2427,   1675,   1100,    679,    381,    169,
+         0,   -169,   -381,   -679,  -1100,  -1675,  -2427,  -3371,  -4511,  -5840,  -7341,  -8987, -10740, -12554, -14376, -16149,
+    -17812, -19303, -20563, -21536, -22172, -22430, -22278, -21697, -20678, -19228, -17364, -15118, -12532,  -9661,  -6568,  -3323,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 3
+         0,   1151,   2300,   3443,   4577,   5701,   6810,   7903,   8977,  10029,  11057,  12059,  13032,  13974,  14883,  15758,
+     16596,  17396,  18156,  18875,  19552,  20186,  20776,  21321,  21820,  22274,  22682,  23043,  23358,  23628,  23852,  24031,
+     24166,  24257,  24306,  24313,  24280,  24208,  24099,  23953,  23773,  23560,  23317,  23044,  22744,  22418,  22070,  21700,
+     21311,  20904,  20482,  20047,  19601,  19146,  18683,  18215,  17743,  17270,  16796,  16325,  15856,  15392,  14934,  14484,
+     14042,  13610,  13189,  12779,  12381,  11997,  11626,  11269,  10927,  10599,  10287,   9989,   9706,   9437,   9183,   8943,
+      8716,   8502,   8301,   8112,   7934,   7766,   7608,   7459,   7317,   7183,   7054,   6930,   6811,   6694,   6580,   6467,
+      6354,   6241,   6126,   6009,   5889,   5765,   5637,   5504,   5365,   5219,   5068,   4909,   4743,   4569,   4388,   4198,
+      4001,   3796,   3584,   3364,   3136,   2902,   2661,   2414,   2161,   1903,   1640,   1373,   1103,    829,    554,    277,
+         0,   -277,   -554,   -829,  -1103,  -1373,  -1640,  -1903,  -2161,  -2414,  -2661,  -2902,  -3136,  -3364,  -3584,  -3796,
+     -4001,  -4198,  -4388,  -4569,  -4743,  -4909,  -5068,  -5219,  -5365,  -5504,  -5637,  -5765,  -5889,  -6009,  -6126,  -6241,
+     -6354,  -6467,  -6580,  -6694,  -6811,  -6930,  -7054,  -7183,  -7317,  -7459,  -7608,  -7766,  -7934,  -8112,  -8301,  -8502,
+     -8716,  -8943,  -9183,  -9437,  -9706,  -9989, -10287, -10599, -10927, -11269, -11626, -11997, -12381, -12779, -13189, -13610,
+    -14042, -14484, -14934, -15392, -15856, -16325, -16796, -17270, -17743, -18215, -18683, -19146, -19601, -20047, -20482, -20904,
+    -21311, -21700, -22070, -22418, -22744, -23044, -23317, -23560, -23773, -23953, -24099, -24208, -24280, -24313, -24306, -24257,
+    -24166, -24031, -23852, -23628, -23358, -23043, -22682, -22274, -21820, -21321, -20776, -20186, -19552, -18875, -18156, -17396,
+    -16596, -15758, -14883, -13974, -13032, -12059, -11057, -10029,  -8977,  -7903,  -6810,  -5701,  -4577,  -3443,  -2300,  -1151,
+         0,   2300,   4577,   6810,   8977,  11057,  13032,  14883,  16596,  18156,  19552,  20776,  21820,  22682,  23358,  23852,
+     24166,  24306,  24280,  24099,  23773,  23317,  22744,  22070,  21311,  20482,  19601,  18683,  17743,  16796,  15856,  14934,
+     14042,  13189,  12381,  11626,  10927,  10287,   9706,   9183,   8716,   8301,   7934,   7608,   7317,   7054,   6811,   6580,
+      6354,   6126,   5889,   5637,   5365,   5068,   4743,   4388,   4001,   3584,   3136,   2661,   2161,   1640,   1103,    554,
+         0,   -554,  -1103,  -1640,  -2161,  -2661,  -3136,  -3584,  -4001,  -4388,  -4743,  -5068,  -5365,  -5637,  -5889,  -6126,
+     -6354,  -6580,  -6811,  -7054,  -7317,  -7608,  -7934,  -8301,  -8716,  -9183,  -9706, -10287, -10927, -11626, -12381, -13189,
+    -14042, -14934, -15856, -16796, -17743, -18683, -19601, -20482, -21311, -22070, -22744, -23317, -23773, -24099, -24280, -24306,
+    -24166, -23852, -23358, -22682, -21820, -20776, -19552, -18156, -16596, -14883, -13032, -11057,  -8977,  -6810,  -4577,  -2300,
+         0,   4577,   8977,  13032,  16596,  19552,  21820,  23358,  24166,  24280,  23773,  22744,  21311,  19601,  17743,  15856,
+     14042,  12381,  10927,   9706,   8716,   7934,   7317,   6811,   6354,   5889,   5365,   4743,   4001,   3136,   2161,   1103,
+         0,  -1103,  -2161,  -3136,  -4001,  -4743,  -5365,  -5889,  -6354,  -6811,  -7317,  -7934,  -8716,  -9706, -10927, -12381,
+    -14042, -15856, -17743, -19601, -21311, -22744, -23773, -24280, -24166, -23358, -21820, -19552, -16596, -13032,  -8977,  -4577,
+         0,   4577,   8977,  13032,  16596,  19552,  21820,  23358,  24166,  24280,  23773,  22744,  21311,  19601,  17743,  15856,
+     14042,  12381,  10927,   9706,   8716,   7934,   7317,   6811,   6354,   5889,   5365,   4743,   4001,   3136,   2161,   1103,
+         0,  -1103,  -2161,  -3136,  -4001,  -4743,  -5365,  -5889,  -6354,  -6811,  -7317,  -7934,  -8716,  -9706, -10927, -12381,
+    -14042, -15856, -17743, -19601, -21311, -22744, -23773, -24280, -24166, -23358, -21820, -19552, -16596, -13032,  -8977,  -4577,
+         0,   4577,   8977,  13032,  16596,  19552,  21820,  23358,  24166,  24280,  23773,  22744,  21311,  19601,  17743,  15856,
+     14042,  12381,  10927,   9706,   8716,   7934,   7317,   6811,   6354,   5889,   5365,   4743,   4001,   3136,   2161,   1103,
+         0,  -1103,  -2161,  -3136,  -4001,  -4743,  -5365,  -5889,  -6354,  -6811,  -7317,  -7934,  -8716,  -9706, -10927, -12381,
+    -14042, -15856, -17743, -19601, -21311, -22744, -23773, -24280, -24166, -23358, -21820, -19552, -16596, -13032,  -8977,  -4577,
+         0,   4577,   8977,  13032,  16596,  19552,  21820,  23358,  24166,  24280,  23773,  22744,  21311,  19601,  17743,  15856,
+     14042,  12381,  10927,   9706,   8716,   7934,   7317,   6811,   6354,   5889,   5365,   4743,   4001,   3136,   2161,   1103,
+         0,  -1103,  -2161,  -3136,  -4001,  -4743,  -5365,  -5889,  -6354,  -6811,  -7317,  -7934,  -8716,  -9706, -10927, -12381,
+    -14042, -15856, -17743, -19601, -21311, -22744, -23773, -24280, -24166, -23358, -21820, -19552, -16596, -13032,  -8977,  -4577,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 4
+         0,   1590,   3173,   4744,   6296,   7823,   9319,  10778,  12194,  13563,  14880,  16140,  17338,  18470,  19535,  20527,
+     21445,  22287,  23051,  23735,  24340,  24864,  25308,  25673,  25959,  26169,  26304,  26367,  26360,  26286,  26149,  25952,
+     25699,  25394,  25042,  24646,  24213,  23745,  23247,  22725,  22183,  21625,  21056,  20480,  19901,  19324,  18751,  18187,
+     17634,  17096,  16576,  16075,  15596,  15140,  14710,  14305,  13928,  13578,  13255,  12960,  12692,  12451,  12235,  12043,
+     11874,  11727,  11600,  11490,  11396,  11316,  11248,  11189,  11137,  11091,  11047,  11004,  10960,  10913,  10860,  10801,
+     10733,  10655,  10566,  10466,  10351,  10224,  10081,   9925,   9753,   9567,   9366,   9151,   8922,   8680,   8427,   8162,
+      7887,   7603,   7312,   7014,   6712,   6405,   6097,   5787,   5478,   5170,   4866,   4565,   4270,   3981,   3699,   3424,
+      3157,   2900,   2651,   2412,   2182,   1962,   1750,   1547,   1352,   1165,    985,    811,    643,    478,    317,    158,
+         0,   -158,   -317,   -478,   -643,   -811,   -985,  -1165,  -1352,  -1547,  -1750,  -1962,  -2182,  -2412,  -2651,  -2900,
+     -3157,  -3424,  -3699,  -3981,  -4270,  -4565,  -4866,  -5170,  -5478,  -5787,  -6097,  -6405,  -6712,  -7014,  -7312,  -7603,
+     -7887,  -8162,  -8427,  -8680,  -8922,  -9151,  -9366,  -9567,  -9753,  -9925, -10081, -10224, -10351, -10466, -10566, -10655,
+    -10733, -10801, -10860, -10913, -10960, -11004, -11047, -11091, -11137, -11189, -11248, -11316, -11396, -11490, -11600, -11727,
+    -11874, -12043, -12235, -12451, -12692, -12960, -13255, -13578, -13928, -14305, -14710, -15140, -15596, -16075, -16576, -17096,
+    -17634, -18187, -18751, -19324, -19901, -20480, -21056, -21625, -22183, -22725, -23247, -23745, -24213, -24646, -25042, -25394,
+    -25699, -25952, -26149, -26286, -26360, -26367, -26304, -26169, -25959, -25673, -25308, -24864, -24340, -23735, -23051, -22287,
+    -21445, -20527, -19535, -18470, -17338, -16140, -14880, -13563, -12194, -10778,  -9319,  -7823,  -6296,  -4744,  -3173,  -1590,
+         0,   3173,   6296,   9319,  12194,  14880,  17338,  19535,  21445,  23051,  24340,  25308,  25959,  26304,  26360,  26149,
+     25699,  25042,  24213,  23247,  22183,  21056,  19901,  18751,  17634,  16576,  15596,  14710,  13928,  13255,  12692,  12235,
+     11874,  11600,  11396,  11248,  11137,  11047,  10960,  10860,  10733,  10566,  10351,  10081,   9753,   9366,   8922,   8427,
+      7887,   7312,   6712,   6097,   5478,   4866,   4270,   3699,   3157,   2651,   2182,   1750,   1352,    985,    643,    317,
+         0,   -317,   -643,   -985,  -1352,  -1750,  -2182,  -2651,  -3157,  -3699,  -4270,  -4866,  -5478,  -6097,  -6712,  -7312,
+     -7887,  -8427,  -8922,  -9366,  -9753, -10081, -10351, -10566, -10733, -10860, -10960, -11047, -11137, -11248, -11396, -11600,
+    -11874, -12235, -12692, -13255, -13928, -14710, -15596, -16576, -17634, -18751, -19901, -21056, -22183, -23247, -24213, -25042,
+    -25699, -26149, -26360, -26304, -25959, -25308, -24340, -23051, -21445, -19535, -17338, -14880, -12194,  -9319,  -6296,  -3173,
+         0,   6296,  12194,  17338,  21445,  24340,  25959,  26360,  25699,  24213,  22183,  19901,  17634,  15596,  13928,  12692,
+     11874,  11396,  11137,  10960,  10733,  10351,   9753,   8922,   7887,   6712,   5478,   4270,   3157,   2182,   1352,    643,
+         0,   -643,  -1352,  -2182,  -3157,  -4270,  -5478,  -6712,  -7887,  -8922,  -9753, -10351, -10733, -10960, -11137, -11396,
+    -11874, -12692, -13928, -15596, -17634, -19901, -22183, -24213, -25699, -26360, -25959, -24340, -21445, -17338, -12194,  -6296,
+         0,   6296,  12194,  17338,  21445,  24340,  25959,  26360,  25699,  24213,  22183,  19901,  17634,  15596,  13928,  12692,
+     11874,  11396,  11137,  10960,  10733,  10351,   9753,   8922,   7887,   6712,   5478,   4270,   3157,   2182,   1352,    643,
+         0,   -643,  -1352,  -2182,  -3157,  -4270,  -5478,  -6712,  -7887,  -8922,  -9753, -10351, -10733, -10960, -11137, -11396,
+    -11874, -12692, -13928, -15596, -17634, -19901, -22183, -24213, -25699, -26360, -25959, -24340, -21445, -17338, -12194,  -6296,
+         0,   6296,  12194,  17338,  21445,  24340,  25959,  26360,  25699,  24213,  22183,  19901,  17634,  15596,  13928,  12692,
+     11874,  11396,  11137,  10960,  10733,  10351,   9753,   8922,   7887,   6712,   5478,   4270,   3157,   2182,   1352,    643,
+         0,   -643,  -1352,  -2182,  -3157,  -4270,  -5478,  -6712,  -7887,  -8922,  -9753, -10351, -10733, -10960, -11137, -11396,
+    -11874, -12692, -13928, -15596, -17634, -19901, -22183, -24213, -25699, -26360, -25959, -24340, -21445, -17338, -12194,  -6296,
+         0,   6296,  12194,  17338,  21445,  24340,  25959,  26360,  25699,  24213,  22183,  19901,  17634,  15596,  13928,  12692,
+     11874,  11396,  11137,  10960,  10733,  10351,   9753,   8922,   7887,   6712,   5478,   4270,   3157,   2182,   1352,    643,
+         0,   -643,  -1352,  -2182,  -3157,  -4270,  -5478,  -6712,  -7887,  -8922,  -9753, -10351, -10733, -10960, -11137, -11396,
+    -11874, -12692, -13928, -15596, -17634, -19901, -22183, -24213, -25699, -26360, -25959, -24340, -21445, -17338, -12194,  -6296,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 5
+         0,   2195,   4375,   6526,   8634,  10684,  12664,  14562,  16365,  18063,  19648,  21111,  22444,  23643,  24703,  25622,
+     26398,  27032,  27525,  27879,  28099,  28190,  28159,  28013,  27760,  27410,  26972,  26457,  25875,  25237,  24555,  23839,
+     23101,  22350,  21598,  20852,  20123,  19419,  18747,  18113,  17523,  16982,  16493,  16058,  15679,  15357,  15091,  14879,
+     14721,  14611,  14547,  14525,  14538,  14583,  14653,  14742,  14844,  14953,  15063,  15168,  15263,  15342,  15400,  15433,
+     15437,  15409,  15346,  15246,  15109,  14933,  14719,  14467,  14180,  13858,  13505,  13123,  12716,  12288,  11843,  11386,
+     10920,  10451,   9983,   9520,   9066,   8627,   8204,   7803,   7425,   7074,   6750,   6456,   6193,   5961,   5760,   5589,
+      5447,   5332,   5243,   5176,   5128,   5097,   5079,   5071,   5067,   5065,   5061,   5051,   5031,   4997,   4947,   4878,
+      4787,   4671,   4530,   4362,   4166,   3942,   3690,   3411,   3106,   2776,   2424,   2052,   1663,   1260,    846,    425,
+         0,   -425,   -846,  -1260,  -1663,  -2052,  -2424,  -2776,  -3106,  -3411,  -3690,  -3942,  -4166,  -4362,  -4530,  -4671,
+     -4787,  -4878,  -4947,  -4997,  -5031,  -5051,  -5061,  -5065,  -5067,  -5071,  -5079,  -5097,  -5128,  -5176,  -5243,  -5332,
+     -5447,  -5589,  -5760,  -5961,  -6193,  -6456,  -6750,  -7074,  -7425,  -7803,  -8204,  -8627,  -9066,  -9520,  -9983, -10451,
+    -10920, -11386, -11843, -12288, -12716, -13123, -13505, -13858, -14180, -14467, -14719, -14933, -15109, -15246, -15346, -15409,
+    -15437, -15433, -15400, -15342, -15263, -15168, -15063, -14953, -14844, -14742, -14653, -14583, -14538, -14525, -14547, -14611,
+    -14721, -14879, -15091, -15357, -15679, -16058, -16493, -16982, -17523, -18113, -18747, -19419, -20123, -20852, -21598, -22350,
+    -23101, -23839, -24555, -25237, -25875, -26457, -26972, -27410, -27760, -28013, -28159, -28190, -28099, -27879, -27525, -27032,
+    -26398, -25622, -24703, -23643, -22444, -21111, -19648, -18063, -16365, -14562, -12664, -10684,  -8634,  -6526,  -4375,  -2195,
+         0,   4375,   8634,  12664,  16365,  19648,  22444,  24703,  26398,  27525,  28099,  28159,  27760,  26972,  25875,  24555,
+     23101,  21598,  20123,  18747,  17523,  16493,  15679,  15091,  14721,  14547,  14538,  14653,  14844,  15063,  15263,  15400,
+     15437,  15346,  15109,  14719,  14180,  13505,  12716,  11843,  10920,   9983,   9066,   8204,   7425,   6750,   6193,   5760,
+      5447,   5243,   5128,   5079,   5067,   5061,   5031,   4947,   4787,   4530,   4166,   3690,   3106,   2424,   1663,    846,
+         0,   -846,  -1663,  -2424,  -3106,  -3690,  -4166,  -4530,  -4787,  -4947,  -5031,  -5061,  -5067,  -5079,  -5128,  -5243,
+     -5447,  -5760,  -6193,  -6750,  -7425,  -8204,  -9066,  -9983, -10920, -11843, -12716, -13505, -14180, -14719, -15109, -15346,
+    -15437, -15400, -15263, -15063, -14844, -14653, -14538, -14547, -14721, -15091, -15679, -16493, -17523, -18747, -20123, -21598,
+    -23101, -24555, -25875, -26972, -27760, -28159, -28099, -27525, -26398, -24703, -22444, -19648, -16365, -12664,  -8634,  -4375,
+         0,   8634,  16365,  22444,  26398,  28099,  27760,  25875,  23101,  20123,  17523,  15679,  14721,  14538,  14844,  15263,
+     15437,  15109,  14180,  12716,  10920,   9066,   7425,   6193,   5447,   5128,   5067,   5031,   4787,   4166,   3106,   1663,
+         0,  -1663,  -3106,  -4166,  -4787,  -5031,  -5067,  -5128,  -5447,  -6193,  -7425,  -9066, -10920, -12716, -14180, -15109,
+    -15437, -15263, -14844, -14538, -14721, -15679, -17523, -20123, -23101, -25875, -27760, -28099, -26398, -22444, -16365,  -8634,
+         0,   8634,  16365,  22444,  26398,  28099,  27760,  25875,  23101,  20123,  17523,  15679,  14721,  14538,  14844,  15263,
+     15437,  15109,  14180,  12716,  10920,   9066,   7425,   6193,   5447,   5128,   5067,   5031,   4787,   4166,   3106,   1663,
+         0,  -1663,  -3106,  -4166,  -4787,  -5031,  -5067,  -5128,  -5447,  -6193,  -7425,  -9066, -10920, -12716, -14180, -15109,
+    -15437, -15263, -14844, -14538, -14721, -15679, -17523, -20123, -23101, -25875, -27760, -28099, -26398, -22444, -16365,  -8634,
+         0,   8634,  16365,  22444,  26398,  28099,  27760,  25875,  23101,  20123,  17523,  15679,  14721,  14538,  14844,  15263,
+     15437,  15109,  14180,  12716,  10920,   9066,   7425,   6193,   5447,   5128,   5067,   5031,   4787,   4166,   3106,   1663,
+         0,  -1663,  -3106,  -4166,  -4787,  -5031,  -5067,  -5128,  -5447,  -6193,  -7425,  -9066, -10920, -12716, -14180, -15109,
+    -15437, -15263, -14844, -14538, -14721, -15679, -17523, -20123, -23101, -25875, -27760, -28099, -26398, -22444, -16365,  -8634,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 6
+         0,   3029,   6022,   8944,  11761,  14441,  16955,  19278,  21387,  23264,  24896,  26274,  27394,  28255,  28863,  29227,
+     29360,  29279,  29005,  28559,  27967,  27254,  26447,  25574,  24660,  23731,  22812,  21923,  21085,  20313,  19622,  19020,
+     18515,  18111,  17807,  17600,  17486,  17454,  17496,  17599,  17750,  17934,  18136,  18342,  18538,  18711,  18849,  18941,
+     18980,  18959,  18873,  18721,  18503,  18222,  17881,  17486,  17046,  16569,  16064,  15543,  15015,  14491,  13980,  13494,
+     13038,  12621,  12249,  11924,  11649,  11426,  11252,  11125,  11042,  10996,  10981,  10989,  11012,  11043,  11072,  11091,
+     11093,  11070,  11016,  10927,  10798,  10627,  10414,  10159,   9864,   9531,   9166,   8774,   8361,   7934,   7500,   7066,
+      6641,   6230,   5840,   5477,   5144,   4847,   4586,   4364,   4179,   4031,   3916,   3831,   3771,   3730,   3703,   3682,
+      3661,   3633,   3592,   3532,   3447,   3333,   3187,   3005,   2788,   2535,   2248,   1928,   1579,   1207,    815,    411,
+         0,   -411,   -815,  -1207,  -1579,  -1928,  -2248,  -2535,  -2788,  -3005,  -3187,  -3333,  -3447,  -3532,  -3592,  -3633,
+     -3661,  -3682,  -3703,  -3730,  -3771,  -3831,  -3916,  -4031,  -4179,  -4364,  -4586,  -4847,  -5144,  -5477,  -5840,  -6230,
+     -6641,  -7066,  -7500,  -7934,  -8361,  -8774,  -9166,  -9531,  -9864, -10159, -10414, -10627, -10798, -10927, -11016, -11070,
+    -11093, -11091, -11072, -11043, -11012, -10989, -10981, -10996, -11042, -11125, -11252, -11426, -11649, -11924, -12249, -12621,
+    -13038, -13494, -13980, -14491, -15015, -15543, -16064, -16569, -17046, -17486, -17881, -18222, -18503, -18721, -18873, -18959,
+    -18980, -18941, -18849, -18711, -18538, -18342, -18136, -17934, -17750, -17599, -17496, -17454, -17486, -17600, -17807, -18111,
+    -18515, -19020, -19622, -20313, -21085, -21923, -22812, -23731, -24660, -25574, -26447, -27254, -27967, -28559, -29005, -29279,
+    -29360, -29227, -28863, -28255, -27394, -26274, -24896, -23264, -21387, -19278, -16955, -14441, -11761,  -8944,  -6022,  -3029,
+         0,   6022,  11761,  16955,  21387,  24896,  27394,  28863,  29360,  29005,  27967,  26447,  24660,  22812,  21085,  19622,
+     18515,  17807,  17486,  17496,  17750,  18136,  18538,  18849,  18980,  18873,  18503,  17881,  17046,  16064,  15015,  13980,
+     13038,  12249,  11649,  11252,  11042,  10981,  11012,  11072,  11093,  11016,  10798,  10414,   9864,   9166,   8361,   7500,
+      6641,   5840,   5144,   4586,   4179,   3916,   3771,   3703,   3661,   3592,   3447,   3187,   2788,   2248,   1579,    815,
+         0,   -815,  -1579,  -2248,  -2788,  -3187,  -3447,  -3592,  -3661,  -3703,  -3771,  -3916,  -4179,  -4586,  -5144,  -5840,
+     -6641,  -7500,  -8361,  -9166,  -9864, -10414, -10798, -11016, -11093, -11072, -11012, -10981, -11042, -11252, -11649, -12249,
+    -13038, -13980, -15015, -16064, -17046, -17881, -18503, -18873, -18980, -18849, -18538, -18136, -17750, -17496, -17486, -17807,
+    -18515, -19622, -21085, -22812, -24660, -26447, -27967, -29005, -29360, -28863, -27394, -24896, -21387, -16955, -11761,  -6022,
+         0,  11761,  21387,  27394,  29360,  27967,  24660,  21085,  18515,  17486,  17750,  18538,  18980,  18503,  17046,  15015,
+     13038,  11649,  11042,  11012,  11093,  10798,   9864,   8361,   6641,   5144,   4179,   3771,   3661,   3447,   2788,   1579,
+         0,  -1579,  -2788,  -3447,  -3661,  -3771,  -4179,  -5144,  -6641,  -8361,  -9864, -10798, -11093, -11012, -11042, -11649,
+    -13038, -15015, -17046, -18503, -18980, -18538, -17750, -17486, -18515, -21085, -24660, -27967, -29360, -27394, -21387, -11761,
+         0,  11761,  21387,  27394,  29360,  27967,  24660,  21085,  18515,  17486,  17750,  18538,  18980,  18503,  17046,  15015,
+     13038,  11649,  11042,  11012,  11093,  10798,   9864,   8361,   6641,   5144,   4179,   3771,   3661,   3447,   2788,   1579,
+         0,  -1579,  -2788,  -3447,  -3661,  -3771,  -4179,  -5144,  -6641,  -8361,  -9864, -10798, -11093, -11012, -11042, -11649,
+    -13038, -15015, -17046, -18503, -18980, -18538, -17750, -17486, -18515, -21085, -24660, -27967, -29360, -27394, -21387, -11761,
+         0,  11761,  21387,  27394,  29360,  27967,  24660,  21085,  18515,  17486,  17750,  18538,  18980,  18503,  17046,  15015,
+     13038,  11649,  11042,  11012,  11093,  10798,   9864,   8361,   6641,   5144,   4179,   3771,   3661,   3447,   2788,   1579,
+         0,  -1579,  -2788,  -3447,  -3661,  -3771,  -4179,  -5144,  -6641,  -8361,  -9864, -10798, -11093, -11012, -11042, -11649,
+    -13038, -15015, -17046, -18503, -18980, -18538, -17750, -17486, -18515, -21085, -24660, -27967, -29360, -27394, -21387, -11761,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 7
+         0,   4177,   8264,  12175,  15830,  19158,  22101,  24614,  26667,  28246,  29353,  30005,  30234,  30083,  29605,  28861,
+     27916,  26837,  25689,  24534,  23427,  22415,  21534,  20813,  20265,  19896,  19699,  19659,  19754,  19955,  20230,  20543,
+     20860,  21151,  21385,  21540,  21598,  21549,  21389,  21122,  20755,  20305,  19789,  19230,  18649,  18069,  17513,  17000,
+     16545,  16158,  15848,  15615,  15457,  15366,  15332,  15340,  15374,  15419,  15457,  15474,  15455,  15391,  15274,  15101,
+     14871,  14588,  14258,  13889,  13494,  13083,  12671,  12267,  11884,  11531,  11215,  10939,  10706,  10514,  10360,  10238,
+     10141,  10060,   9985,   9907,   9818,   9709,   9576,   9413,   9219,   8994,   8739,   8459,   8159,   7845,   7524,   7202,
+      6888,   6586,   6301,   6038,   5796,   5578,   5381,   5203,   5040,   4887,   4739,   4591,   4438,   4275,   4099,   3909,
+      3702,   3478,   3240,   2990,   2730,   2465,   2198,   1934,   1677,   1429,   1192,    967,    755,    555,    364,    180,
+         0,   -180,   -364,   -555,   -755,   -967,  -1192,  -1429,  -1677,  -1934,  -2198,  -2465,  -2730,  -2990,  -3240,  -3478,
+     -3702,  -3909,  -4099,  -4275,  -4438,  -4591,  -4739,  -4887,  -5040,  -5203,  -5381,  -5578,  -5796,  -6038,  -6301,  -6586,
+     -6888,  -7202,  -7524,  -7845,  -8159,  -8459,  -8739,  -8994,  -9219,  -9413,  -9576,  -9709,  -9818,  -9907,  -9985, -10060,
+    -10141, -10238, -10360, -10514, -10706, -10939, -11215, -11531, -11884, -12267, -12671, -13083, -13494, -13889, -14258, -14588,
+    -14871, -15101, -15274, -15391, -15455, -15474, -15457, -15419, -15374, -15340, -15332, -15366, -15457, -15615, -15848, -16158,
+    -16545, -17000, -17513, -18069, -18649, -19230, -19789, -20305, -20755, -21122, -21389, -21549, -21598, -21540, -21385, -21151,
+    -20860, -20543, -20230, -19955, -19754, -19659, -19699, -19896, -20265, -20813, -21534, -22415, -23427, -24534, -25689, -26837,
+    -27916, -28861, -29605, -30083, -30234, -30005, -29353, -28246, -26667, -24614, -22101, -19158, -15830, -12175,  -8264,  -4177,
+         0,   8264,  15830,  22101,  26667,  29353,  30234,  29605,  27916,  25689,  23427,  21534,  20265,  19699,  19754,  20230,
+     20860,  21385,  21598,  21389,  20755,  19789,  18649,  17513,  16545,  15848,  15457,  15332,  15374,  15457,  15455,  15274,
+     14871,  14258,  13494,  12671,  11884,  11215,  10706,  10360,  10141,   9985,   9818,   9576,   9219,   8739,   8159,   7524,
+      6888,   6301,   5796,   5381,   5040,   4739,   4438,   4099,   3702,   3240,   2730,   2198,   1677,   1192,    755,    364,
+         0,   -364,   -755,  -1192,  -1677,  -2198,  -2730,  -3240,  -3702,  -4099,  -4438,  -4739,  -5040,  -5381,  -5796,  -6301,
+     -6888,  -7524,  -8159,  -8739,  -9219,  -9576,  -9818,  -9985, -10141, -10360, -10706, -11215, -11884, -12671, -13494, -14258,
+    -14871, -15274, -15455, -15457, -15374, -15332, -15457, -15848, -16545, -17513, -18649, -19789, -20755, -21389, -21598, -21385,
+    -20860, -20230, -19754, -19699, -20265, -21534, -23427, -25689, -27916, -29605, -30234, -29353, -26667, -22101, -15830,  -8264,
+         0,  15830,  26667,  30234,  27916,  23427,  20265,  19754,  20860,  21598,  20755,  18649,  16545,  15457,  15374,  15455,
+     14871,  13494,  11884,  10706,  10141,   9818,   9219,   8159,   6888,   5796,   5040,   4438,   3702,   2730,   1677,    755,
+         0,   -755,  -1677,  -2730,  -3702,  -4438,  -5040,  -5796,  -6888,  -8159,  -9219,  -9818, -10141, -10706, -11884, -13494,
+    -14871, -15455, -15374, -15457, -16545, -18649, -20755, -21598, -20860, -19754, -20265, -23427, -27916, -30234, -26667, -15830,
+         0,  15830,  26667,  30234,  27916,  23427,  20265,  19754,  20860,  21598,  20755,  18649,  16545,  15457,  15374,  15455,
+     14871,  13494,  11884,  10706,  10141,   9818,   9219,   8159,   6888,   5796,   5040,   4438,   3702,   2730,   1677,    755,
+         0,   -755,  -1677,  -2730,  -3702,  -4438,  -5040,  -5796,  -6888,  -8159,  -9219,  -9818, -10141, -10706, -11884, -13494,
+    -14871, -15455, -15374, -15457, -16545, -18649, -20755, -21598, -20860, -19754, -20265, -23427, -27916, -30234, -26667, -15830,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 8
+         0,   5752,  11280,  16374,  20854,  24582,  27467,  29474,  30619,  30972,  30642,  29772,  28523,  27064,  25556,  24141,
+     22933,  22012,  21418,  21156,  21196,  21480,  21930,  22460,  22981,  23415,  23699,  23789,  23667,  23338,  22829,  22184,
+     21458,  20712,  20004,  19385,  18894,  18553,  18366,  18321,  18392,  18540,  18722,  18892,  19008,  19036,  18954,  18753,
+     18435,  18018,  17528,  16997,  16462,  15957,  15512,  15149,  14880,  14708,  14622,  14605,  14632,  14674,  14704,  14693,
+     14622,  14477,  14252,  13951,  13586,  13176,  12742,  12309,  11899,  11533,  11225,  10983,  10806,  10687,  10615,  10572,
+     10538,  10493,  10419,  10302,  10131,   9905,   9625,   9299,   8941,   8566,   8191,   7833,   7506,   7220,   6981,   6790,
+      6643,   6530,   6441,   6361,   6274,   6169,   6033,   5859,   5643,   5386,   5092,   4771,   4434,   4092,   3758,   3445,
+      3161,   2913,   2702,   2528,   2386,   2266,   2160,   2055,   1940,   1804,   1641,   1443,   1210,    942,    646,    328,
+         0,   -328,   -646,   -942,  -1210,  -1443,  -1641,  -1804,  -1940,  -2055,  -2160,  -2266,  -2386,  -2528,  -2702,  -2913,
+     -3161,  -3445,  -3758,  -4092,  -4434,  -4771,  -5092,  -5386,  -5643,  -5859,  -6033,  -6169,  -6274,  -6361,  -6441,  -6530,
+     -6643,  -6790,  -6981,  -7220,  -7506,  -7833,  -8191,  -8566,  -8941,  -9299,  -9625,  -9905, -10131, -10302, -10419, -10493,
+    -10538, -10572, -10615, -10687, -10806, -10983, -11225, -11533, -11899, -12309, -12742, -13176, -13586, -13951, -14252, -14477,
+    -14622, -14693, -14704, -14674, -14632, -14605, -14622, -14708, -14880, -15149, -15512, -15957, -16462, -16997, -17528, -18018,
+    -18435, -18753, -18954, -19036, -19008, -18892, -18722, -18540, -18392, -18321, -18366, -18553, -18894, -19385, -20004, -20712,
+    -21458, -22184, -22829, -23338, -23667, -23789, -23699, -23415, -22981, -22460, -21930, -21480, -21196, -21156, -21418, -22012,
+    -22933, -24141, -25556, -27064, -28523, -29772, -30642, -30972, -30619, -29474, -27467, -24582, -20854, -16374, -11280,  -5752,
+         0,  11280,  20854,  27467,  30619,  30642,  28523,  25556,  22933,  21418,  21196,  21930,  22981,  23699,  23667,  22829,
+     21458,  20004,  18894,  18366,  18392,  18722,  19008,  18954,  18435,  17528,  16462,  15512,  14880,  14622,  14632,  14704,
+     14622,  14252,  13586,  12742,  11899,  11225,  10806,  10615,  10538,  10419,  10131,   9625,   8941,   8191,   7506,   6981,
+      6643,   6441,   6274,   6033,   5643,   5092,   4434,   3758,   3161,   2702,   2386,   2160,   1940,   1641,   1210,    646,
+         0,   -646,  -1210,  -1641,  -1940,  -2160,  -2386,  -2702,  -3161,  -3758,  -4434,  -5092,  -5643,  -6033,  -6274,  -6441,
+     -6643,  -6981,  -7506,  -8191,  -8941,  -9625, -10131, -10419, -10538, -10615, -10806, -11225, -11899, -12742, -13586, -14252,
+    -14622, -14704, -14632, -14622, -14880, -15512, -16462, -17528, -18435, -18954, -19008, -18722, -18392, -18366, -18894, -20004,
+    -21458, -22829, -23667, -23699, -22981, -21930, -21196, -21418, -22933, -25556, -28523, -30642, -30619, -27467, -20854, -11280,
+         0,  20854,  30619,  28523,  22933,  21196,  22981,  23667,  21458,  18894,  18392,  19008,  18435,  16462,  14880,  14632,
+     14622,  13586,  11899,  10806,  10538,  10131,   8941,   7506,   6643,   6274,   5643,   4434,   3161,   2386,   1940,   1210,
+         0,  -1210,  -1940,  -2386,  -3161,  -4434,  -5643,  -6274,  -6643,  -7506,  -8941, -10131, -10538, -10806, -11899, -13586,
+    -14622, -14632, -14880, -16462, -18435, -19008, -18392, -18894, -21458, -23667, -22981, -21196, -22933, -28523, -30619, -20854,
+         0,  20854,  30619,  28523,  22933,  21196,  22981,  23667,  21458,  18894,  18392,  19008,  18435,  16462,  14880,  14632,
+     14622,  13586,  11899,  10806,  10538,  10131,   8941,   7506,   6643,   6274,   5643,   4434,   3161,   2386,   1940,   1210,
+         0,  -1210,  -1940,  -2386,  -3161,  -4434,  -5643,  -6274,  -6643,  -7506,  -8941, -10131, -10538, -10806, -11899, -13586,
+    -14622, -14632, -14880, -16462, -18435, -19008, -18392, -18894, -21458, -23667, -22981, -21196, -22933, -28523, -30619, -20854,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 9
+         0,   7900,  15236,  21513,  26368,  29611,  31239,  31425,  30483,  28815,  26845,  24964,  23474,  22556,  22260,  22514,
+     23153,  23962,  24718,  25235,  25392,  25150,  24553,  23709,  22764,  21872,  21164,  20724,  20575,  20682,  20961,  21299,
+     21581,  21709,  21623,  21310,  20803,  20171,  19506,  18901,  18429,  18135,  18024,  18065,  18198,  18346,  18434,  18403,
+     18221,  17888,  17434,  16913,  16389,  15925,  15566,  15337,  15235,  15229,  15273,  15312,  15293,  15178,  14952,  14619,
+     14208,  13760,  13324,  12943,  12646,  12448,  12339,  12294,  12275,  12242,  12157,  11997,  11751,  11429,  11055,  10662,
+     10284,   9954,   9692,   9504,   9380,   9301,   9235,   9154,   9029,   8845,   8596,   8291,   7949,   7595,   7257,   6957,
+      6710,   6519,   6378,   6269,   6170,   6058,   5912,   5719,   5477,   5191,   4875,   4550,   4235,   3948,   3703,   3502,
+      3342,   3210,   3089,   2960,   2808,   2619,   2389,   2121,   1825,   1515,   1209,    924,    670,    455,    278,    131,
+         0,   -131,   -278,   -455,   -670,   -924,  -1209,  -1515,  -1825,  -2121,  -2389,  -2619,  -2808,  -2960,  -3089,  -3210,
+     -3342,  -3502,  -3703,  -3948,  -4235,  -4550,  -4875,  -5191,  -5477,  -5719,  -5912,  -6058,  -6170,  -6269,  -6378,  -6519,
+     -6710,  -6957,  -7257,  -7595,  -7949,  -8291,  -8596,  -8845,  -9029,  -9154,  -9235,  -9301,  -9380,  -9504,  -9692,  -9954,
+    -10284, -10662, -11055, -11429, -11751, -11997, -12157, -12242, -12275, -12294, -12339, -12448, -12646, -12943, -13324, -13760,
+    -14208, -14619, -14952, -15178, -15293, -15312, -15273, -15229, -15235, -15337, -15566, -15925, -16389, -16913, -17434, -17888,
+    -18221, -18403, -18434, -18346, -18198, -18065, -18024, -18135, -18429, -18901, -19506, -20171, -20803, -21310, -21623, -21709,
+    -21581, -21299, -20961, -20682, -20575, -20724, -21164, -21872, -22764, -23709, -24553, -25150, -25392, -25235, -24718, -23962,
+    -23153, -22514, -22260, -22556, -23474, -24964, -26845, -28815, -30483, -31425, -31239, -29611, -26368, -21513, -15236,  -7900,
+         0,  15236,  26368,  31239,  30483,  26845,  23474,  22260,  23153,  24718,  25392,  24553,  22764,  21164,  20575,  20961,
+     21581,  21623,  20803,  19506,  18429,  18024,  18198,  18434,  18221,  17434,  16389,  15566,  15235,  15273,  15293,  14952,
+     14208,  13324,  12646,  12339,  12275,  12157,  11751,  11055,  10284,   9692,   9380,   9235,   9029,   8596,   7949,   7257,
+      6710,   6378,   6170,   5912,   5477,   4875,   4235,   3703,   3342,   3089,   2808,   2389,   1825,   1209,    670,    278,
+         0,   -278,   -670,  -1209,  -1825,  -2389,  -2808,  -3089,  -3342,  -3703,  -4235,  -4875,  -5477,  -5912,  -6170,  -6378,
+     -6710,  -7257,  -7949,  -8596,  -9029,  -9235,  -9380,  -9692, -10284, -11055, -11751, -12157, -12275, -12339, -12646, -13324,
+    -14208, -14952, -15293, -15273, -15235, -15566, -16389, -17434, -18221, -18434, -18198, -18024, -18429, -19506, -20803, -21623,
+    -21581, -20961, -20575, -21164, -22764, -24553, -25392, -24718, -23153, -22260, -23474, -26845, -30483, -31239, -26368, -15236,
+         0,  26368,  30483,  23474,  23153,  25392,  22764,  20575,  21581,  20803,  18429,  18198,  18221,  16389,  15235,  15293,
+     14208,  12646,  12275,  11751,  10284,   9380,   9029,   7949,   6710,   6170,   5477,   4235,   3342,   2808,   1825,    670,
+         0,   -670,  -1825,  -2808,  -3342,  -4235,  -5477,  -6170,  -6710,  -7949,  -9029,  -9380, -10284, -11751, -12275, -12646,
+    -14208, -15293, -15235, -16389, -18221, -18198, -18429, -20803, -21581, -20575, -22764, -25392, -23153, -23474, -30483, -26368,
+         0,  24092,  31219,  25474,  21799,  23891,  24529,  21448,  19657,  20573,  20268,  17869,  16659,  17120,  16413,  14345,
+     13435,  13640,  12696,  10836,  10121,  10151,   9040,   7334,   6765,   6657,   5414,   3833,   3387,   3162,   1803,    335,
+         0,   -335,  -1803,  -3162,  -3387,  -3833,  -5414,  -6657,  -6765,  -7334,  -9040, -10151, -10121, -10836, -12696, -13640,
+    -13435, -14345, -16413, -17120, -16659, -17869, -20268, -20573, -19657, -21448, -24529, -23891, -21799, -25474, -31219, -24092,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 10
+         0,  10798,  20181,  27063,  30923,  31887,  30644,  28216,  25663,  23815,  23085,  23439,  24485,  25659,  26445,  26534,
+     25907,  24800,  23593,  22658,  22229,  22333,  22800,  23344,  23676,  23611,  23123,  22346,  21510,  20849,  20515,  20528,
+     20779,  21077,  21225,  21096,  20673,  20051,  19391,  18862,  18572,  18536,  18671,  18835,  18884,  18722,  18340,  17808,
+     17253,  16802,  16536,  16466,  16527,  16607,  16594,  16414,  16060,  15591,  15106,  14704,  14453,  14357,  14364,  14386,
+     14331,  14142,  13812,  13389,  12953,  12586,  12341,  12223,  12190,  12169,  12086,  11892,  11583,  11196,  10797,  10453,
+     10210,  10073,  10007,   9954,   9852,   9658,   9368,   9010,   8639,   8311,   8066,   7911,   7819,   7741,   7626,   7436,
+      7163,   6829,   6480,   6163,   5913,   5740,   5625,   5529,   5406,   5222,   4966,   4654,   4320,   4008,   3751,   3561,
+      3427,   3317,   3191,   3016,   2777,   2482,   2160,   1849,   1581,   1375,   1225,   1106,    981,    817,    594,    315,
+         0,   -315,   -594,   -817,   -981,  -1106,  -1225,  -1375,  -1581,  -1849,  -2160,  -2482,  -2777,  -3016,  -3191,  -3317,
+     -3427,  -3561,  -3751,  -4008,  -4320,  -4654,  -4966,  -5222,  -5406,  -5529,  -5625,  -5740,  -5913,  -6163,  -6480,  -6829,
+     -7163,  -7436,  -7626,  -7741,  -7819,  -7911,  -8066,  -8311,  -8639,  -9010,  -9368,  -9658,  -9852,  -9954, -10007, -10073,
+    -10210, -10453, -10797, -11196, -11583, -11892, -12086, -12169, -12190, -12223, -12341, -12586, -12953, -13389, -13812, -14142,
+    -14331, -14386, -14364, -14357, -14453, -14704, -15106, -15591, -16060, -16414, -16594, -16607, -16527, -16466, -16536, -16802,
+    -17253, -17808, -18340, -18722, -18884, -18835, -18671, -18536, -18572, -18862, -19391, -20051, -20673, -21096, -21225, -21077,
+    -20779, -20528, -20515, -20849, -21510, -22346, -23123, -23611, -23676, -23344, -22800, -22333, -22229, -22658, -23593, -24800,
+    -25907, -26534, -26445, -25659, -24485, -23439, -23085, -23815, -25663, -28216, -30644, -31887, -30923, -27063, -20181, -10798,
+         0,  20181,  30923,  30644,  25663,  23085,  24485,  26445,  25907,  23593,  22229,  22800,  23676,  23123,  21510,  20515,
+     20779,  21225,  20673,  19391,  18572,  18671,  18884,  18340,  17253,  16536,  16527,  16594,  16060,  15106,  14453,  14364,
+     14331,  13812,  12953,  12341,  12190,  12086,  11583,  10797,  10210,  10007,   9852,   9368,   8639,   8066,   7819,   7626,
+      7163,   6480,   5913,   5625,   5406,   4966,   4320,   3751,   3427,   3191,   2777,   2160,   1581,   1225,    981,    594,
+         0,   -594,   -981,  -1225,  -1581,  -2160,  -2777,  -3191,  -3427,  -3751,  -4320,  -4966,  -5406,  -5625,  -5913,  -6480,
+     -7163,  -7626,  -7819,  -8066,  -8639,  -9368,  -9852, -10007, -10210, -10797, -11583, -12086, -12190, -12341, -12953, -13812,
+    -14331, -14364, -14453, -15106, -16060, -16594, -16527, -16536, -17253, -18340, -18884, -18671, -18572, -19391, -20673, -21225,
+    -20779, -20515, -21510, -23123, -23676, -22800, -22229, -23593, -25907, -26445, -24485, -23085, -25663, -30644, -30923, -20181,
+         0,  30923,  25663,  24485,  25907,  22229,  23676,  21510,  20779,  20673,  18572,  18884,  17253,  16527,  16060,  14453,
+     14331,  12953,  12190,  11583,  10210,   9852,   8639,   7819,   7163,   5913,   5406,   4320,   3427,   2777,   1581,    981,
+         0,   -981,  -1581,  -2777,  -3427,  -4320,  -5406,  -5913,  -7163,  -7819,  -8639,  -9852, -10210, -11583, -12190, -12953,
+    -14331, -14453, -16060, -16527, -17253, -18884, -18572, -20673, -20779, -21510, -23676, -22229, -25907, -24485, -25663, -30923,
+         0,  24092,  31219,  25474,  21799,  23891,  24529,  21448,  19657,  20573,  20268,  17869,  16659,  17120,  16413,  14345,
+     13435,  13640,  12696,  10836,  10121,  10151,   9040,   7334,   6765,   6657,   5414,   3833,   3387,   3162,   1803,    335,
+         0,   -335,  -1803,  -3162,  -3387,  -3833,  -5414,  -6657,  -6765,  -7334,  -9040, -10151, -10121, -10836, -12696, -13640,
+    -13435, -14345, -16413, -17120, -16659, -17869, -20268, -20573, -19657, -21448, -24529, -23891, -21799, -25474, -31219, -24092,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 11
+         0,  14621,  25767,  31434,  31819,  28972,  25611,  23789,  24079,  25665,  27127,  27409,  26393,  24807,  23634,  23447,
+     24097,  24905,  25165,  24617,  23565,  22620,  22264,  22537,  23052,  23290,  22962,  22185,  21374,  20936,  20997,  21331,
+     21542,  21342,  20743,  20030,  19550,  19471,  19676,  19856,  19737,  19266,  18633,  18134,  17957,  18059,  18205,  18139,
+     17765,  17203,  16700,  16452,  16469,  16577,  16546,  16248,  15749,  15252,  14951,  14898,  14968,  14955,  14719,  14278,
+     13794,  13455,  13341,  13372,  13369,  13181,  12792,  12327,  11962,  11796,  11788,  11786,  11637,  11295,  10852,  10469,
+     10260,  10214,  10207,  10087,   9789,   9370,   8976,   8730,   8648,   8631,   8535,   8274,   7882,   7483,   7206,   7090,
+      7060,   6981,   6754,   6388,   5989,   5685,   5537,   5492,   5425,   5229,   4889,   4493,   4168,   3989,   3927,   3869,
+      3700,   3386,   2996,   2653,   2446,   2365,   2312,   2168,   1880,   1498,   1140,    905,    805,    754,    633,    371,
+         0,   -371,   -633,   -754,   -805,   -905,  -1140,  -1498,  -1880,  -2168,  -2312,  -2365,  -2446,  -2653,  -2996,  -3386,
+     -3700,  -3869,  -3927,  -3989,  -4168,  -4493,  -4889,  -5229,  -5425,  -5492,  -5537,  -5685,  -5989,  -6388,  -6754,  -6981,
+     -7060,  -7090,  -7206,  -7483,  -7882,  -8274,  -8535,  -8631,  -8648,  -8730,  -8976,  -9370,  -9789, -10087, -10207, -10214,
+    -10260, -10469, -10852, -11295, -11637, -11786, -11788, -11796, -11962, -12327, -12792, -13181, -13369, -13372, -13341, -13455,
+    -13794, -14278, -14719, -14955, -14968, -14898, -14951, -15252, -15749, -16248, -16546, -16577, -16469, -16452, -16700, -17203,
+    -17765, -18139, -18205, -18059, -17957, -18134, -18633, -19266, -19737, -19856, -19676, -19471, -19550, -20030, -20743, -21342,
+    -21542, -21331, -20997, -20936, -21374, -22185, -22962, -23290, -23052, -22537, -22264, -22620, -23565, -24617, -25165, -24905,
+    -24097, -23447, -23634, -24807, -26393, -27409, -27127, -25665, -24079, -23789, -25611, -28972, -31819, -31434, -25767, -14621,
+         0,  25767,  31819,  25611,  24079,  27127,  26393,  23634,  24097,  25165,  23565,  22264,  23052,  22962,  21374,  20997,
+     21542,  20743,  19550,  19676,  19737,  18633,  17957,  18205,  17765,  16700,  16469,  16546,  15749,  14951,  14968,  14719,
+     13794,  13341,  13369,  12792,  11962,  11788,  11637,  10852,  10260,  10207,   9789,   8976,   8648,   8535,   7882,   7206,
+      7060,   6754,   5989,   5537,   5425,   4889,   4168,   3927,   3700,   2996,   2446,   2312,   1880,   1140,    805,    633,
+         0,   -633,   -805,  -1140,  -1880,  -2312,  -2446,  -2996,  -3700,  -3927,  -4168,  -4889,  -5425,  -5537,  -5989,  -6754,
+     -7060,  -7206,  -7882,  -8535,  -8648,  -8976,  -9789, -10207, -10260, -10852, -11637, -11788, -11962, -12792, -13369, -13341,
+    -13794, -14719, -14968, -14951, -15749, -16546, -16469, -16700, -17765, -18205, -17957, -18633, -19737, -19676, -19550, -20743,
+    -21542, -20997, -21374, -22962, -23052, -22264, -23565, -25165, -24097, -23634, -26393, -27127, -24079, -25611, -31819, -25767,
+         0,  32107,  23520,  27193,  23099,  24709,  21820,  22633,  20314,  20696,  18716,  18824,  17071,  16987,  15399,  15170,
+     13711,  13367,  12012,  11572,  10306,   9784,   8595,   8000,   6879,   6220,   5162,   4441,   3442,   2664,   1721,    888,
+         0,   -888,  -1721,  -2664,  -3442,  -4441,  -5162,  -6220,  -6879,  -8000,  -8595,  -9784, -10306, -11572, -12012, -13367,
+    -13711, -15170, -15399, -16987, -17071, -18824, -18716, -20696, -20314, -22633, -21820, -24709, -23099, -27193, -23520, -32107,
+         0,  24092,  31219,  25474,  21799,  23891,  24529,  21448,  19657,  20573,  20268,  17869,  16659,  17120,  16413,  14345,
+     13435,  13640,  12696,  10836,  10121,  10151,   9040,   7334,   6765,   6657,   5414,   3833,   3387,   3162,   1803,    335,
+         0,   -335,  -1803,  -3162,  -3387,  -3833,  -5414,  -6657,  -6765,  -7334,  -9040, -10151, -10121, -10836, -12696, -13640,
+    -13435, -14345, -16413, -17120, -16659, -17869, -20268, -20573, -19657, -21448, -24529, -23891, -21799, -25474, -31219, -24092,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 12
+         0,  19452,  30729,  31826,  27516,  24305,  24908,  27259,  28061,  26538,  24662,  24402,  25523,  26241,  25518,  24149,
+     23581,  24132,  24753,  24432,  23390,  22689,  22879,  23385,  23302,  22515,  21771,  21707,  22083,  22142,  21567,  20837,
+     20588,  20826,  20961,  20566,  19888,  19509,  19608,  19769,  19522,  18922,  18459,  18426,  18573,  18441,  17936,  17429,
+     17276,  17380,  17332,  16927,  16411,  16157,  16197,  16199,  15893,  15398,  15064,  15028,  15052,  14834,  14382,  13993,
+     13876,  13895,  13752,  13358,  12940,  12745,  12737,  12648,  12322,  11898,  11634,  11581,  11528,  11269,  10861,  10543,
+     10435,  10394,  10199,   9824,   9469,   9301,   9253,   9111,   8782,   8408,   8182,   8110,   8006,   7730,   7357,   7080,
+      6969,   6888,   6665,   6310,   5993,   5836,   5759,   5586,   5262,   4920,   4713,   4624,   4491,   4209,   3859,   3604,
+      3488,   3383,   3147,   2804,   2509,   2355,   2262,   2073,   1753,   1428,   1230,   1133,    986,    700,    359,    116,
+         0,   -116,   -359,   -700,   -986,  -1133,  -1230,  -1428,  -1753,  -2073,  -2262,  -2355,  -2509,  -2804,  -3147,  -3383,
+     -3488,  -3604,  -3859,  -4209,  -4491,  -4624,  -4713,  -4920,  -5262,  -5586,  -5759,  -5836,  -5993,  -6310,  -6665,  -6888,
+     -6969,  -7080,  -7357,  -7730,  -8006,  -8110,  -8182,  -8408,  -8782,  -9111,  -9253,  -9301,  -9469,  -9824, -10199, -10394,
+    -10435, -10543, -10861, -11269, -11528, -11581, -11634, -11898, -12322, -12648, -12737, -12745, -12940, -13358, -13752, -13895,
+    -13876, -13993, -14382, -14834, -15052, -15028, -15064, -15398, -15893, -16199, -16197, -16157, -16411, -16927, -17332, -17380,
+    -17276, -17429, -17936, -18441, -18573, -18426, -18459, -18922, -19522, -19769, -19608, -19509, -19888, -20566, -20961, -20826,
+    -20588, -20837, -21567, -22142, -22083, -21707, -21771, -22515, -23302, -23385, -22879, -22689, -23390, -24432, -24753, -24132,
+    -23581, -24149, -25518, -26241, -25523, -24402, -24662, -26538, -28061, -27259, -24908, -24305, -27516, -31826, -30729, -19452,
+         0,  30729,  27516,  24908,  28061,  24662,  25523,  25518,  23581,  24753,  23390,  22879,  23302,  21771,  22083,  21567,
+     20588,  20961,  19888,  19608,  19522,  18459,  18573,  17936,  17276,  17332,  16411,  16197,  15893,  15064,  15052,  14382,
+     13876,  13752,  12940,  12737,  12322,  11634,  11528,  10861,  10435,  10199,   9469,   9253,   8782,   8182,   8006,   7357,
+      6969,   6665,   5993,   5759,   5262,   4713,   4491,   3859,   3488,   3147,   2509,   2262,   1753,   1230,    986,    359,
+         0,   -359,   -986,  -1230,  -1753,  -2262,  -2509,  -3147,  -3488,  -3859,  -4491,  -4713,  -5262,  -5759,  -5993,  -6665,
+     -6969,  -7357,  -8006,  -8182,  -8782,  -9253,  -9469, -10199, -10435, -10861, -11528, -11634, -12322, -12737, -12940, -13752,
+    -13876, -14382, -15052, -15064, -15893, -16197, -16411, -17332, -17276, -17936, -18573, -18459, -19522, -19608, -19888, -20961,
+    -20588, -21567, -22083, -21771, -23302, -22879, -23390, -24753, -23581, -25518, -25523, -24662, -28061, -24908, -27516, -30729,
+         0,  32107,  23520,  27193,  23099,  24709,  21820,  22633,  20314,  20696,  18716,  18824,  17071,  16987,  15399,  15170,
+     13711,  13367,  12012,  11572,  10306,   9784,   8595,   8000,   6879,   6220,   5162,   4441,   3442,   2664,   1721,    888,
+         0,   -888,  -1721,  -2664,  -3442,  -4441,  -5162,  -6220,  -6879,  -8000,  -8595,  -9784, -10306, -11572, -12012, -13367,
+    -13711, -15170, -15399, -16987, -17071, -18824, -18716, -20696, -20314, -22633, -21820, -24709, -23099, -27193, -23520, -32107,
+         0,  24092,  31219,  25474,  21799,  23891,  24529,  21448,  19657,  20573,  20268,  17869,  16659,  17120,  16413,  14345,
+     13435,  13640,  12696,  10836,  10121,  10151,   9040,   7334,   6765,   6657,   5414,   3833,   3387,   3162,   1803,    335,
+         0,   -335,  -1803,  -3162,  -3387,  -3833,  -5414,  -6657,  -6765,  -7334,  -9040, -10151, -10121, -10836, -12696, -13640,
+    -13435, -14345, -16413, -17120, -16659, -17869, -20268, -20573, -19657, -21448, -24529, -23891, -21799, -25474, -31219, -24092,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 13
+         0,  25031,  32485,  27164,  24511,  27433,  28332,  25794,  25075,  26695,  26616,  24893,  24770,  25798,  25323,  24068,
+     24220,  24856,  24189,  23275,  23557,  23892,  23141,  22498,  22825,  22915,  22151,  21728,  22042,  21935,  21206,  20959,
+     21219,  20958,  20298,  20184,  20364,  19988,  19419,  19400,  19482,  19031,  18563,  18600,  18580,  18090,  17724,  17784,
+     17664,  17166,  16896,  16950,  16740,  16261,  16073,  16098,  15814,  15373,  15250,  15228,  14890,  14502,  14423,  14345,
+     13972,  13643,  13588,  13450,  13063,  12793,  12743,  12548,  12165,  11949,  11886,  11642,  11279,  11107,  11018,  10735,
+     10403,  10263,  10141,   9832,   9537,   9415,   9255,   8935,   8677,   8560,   8363,   8045,   7822,   7698,   7468,   7162,
+      6969,   6828,   6573,   6287,   6114,   5951,   5681,   5419,   5256,   5068,   4792,   4556,   4393,   4181,   3909,   3695,
+      3524,   3293,   3033,   2835,   2650,   2405,   2161,   1973,   1770,   1520,   1295,   1107,    886,    639,    431,    237,
+         0,   -237,   -431,   -639,   -886,  -1107,  -1295,  -1520,  -1770,  -1973,  -2161,  -2405,  -2650,  -2835,  -3033,  -3293,
+     -3524,  -3695,  -3909,  -4181,  -4393,  -4556,  -4792,  -5068,  -5256,  -5419,  -5681,  -5951,  -6114,  -6287,  -6573,  -6828,
+     -6969,  -7162,  -7468,  -7698,  -7822,  -8045,  -8363,  -8560,  -8677,  -8935,  -9255,  -9415,  -9537,  -9832, -10141, -10263,
+    -10403, -10735, -11018, -11107, -11279, -11642, -11886, -11949, -12165, -12548, -12743, -12793, -13063, -13450, -13588, -13643,
+    -13972, -14345, -14423, -14502, -14890, -15228, -15250, -15373, -15814, -16098, -16073, -16261, -16740, -16950, -16896, -17166,
+    -17664, -17784, -17724, -18090, -18580, -18600, -18563, -19031, -19482, -19400, -19419, -19988, -20364, -20184, -20298, -20958,
+    -21219, -20959, -21206, -21935, -22042, -21728, -22151, -22915, -22825, -22498, -23141, -23892, -23557, -23275, -24189, -24856,
+    -24220, -24068, -25323, -25798, -24770, -24893, -26616, -26695, -25075, -25794, -28332, -27433, -24511, -27164, -32485, -25031,
+         0,  32548,  24387,  28515,  24834,  26912,  24422,  25717,  23784,  24662,  23052,  23672,  22274,  22716,  21470,  21781,
+     20648,  20860,  19815,  19949,  18975,  19043,  18129,  18143,  17278,  17247,  16425,  16353,  15568,  15462,  14710,  14572,
+     13850,  13684,  12989,  12798,  12126,  11912,  11263,  11027,  10399,  10143,   9534,   9259,   8669,   8376,   7803,   7493,
+      6937,   6611,   6070,   5729,   5204,   4847,   4337,   3966,   3470,   3084,   2602,   2203,   1735,   1322,    867,    441,
+         0,   -441,   -867,  -1322,  -1735,  -2203,  -2602,  -3084,  -3470,  -3966,  -4337,  -4847,  -5204,  -5729,  -6070,  -6611,
+     -6937,  -7493,  -7803,  -8376,  -8669,  -9259,  -9534, -10143, -10399, -11027, -11263, -11912, -12126, -12798, -12989, -13684,
+    -13850, -14572, -14710, -15462, -15568, -16353, -16425, -17247, -17278, -18143, -18129, -19043, -18975, -19949, -19815, -20860,
+    -20648, -21781, -21470, -22716, -22274, -23672, -23052, -24662, -23784, -25717, -24422, -26912, -24834, -28515, -24387, -32548,
+         0,  32107,  23520,  27193,  23099,  24709,  21820,  22633,  20314,  20696,  18716,  18824,  17071,  16987,  15399,  15170,
+     13711,  13367,  12012,  11572,  10306,   9784,   8595,   8000,   6879,   6220,   5162,   4441,   3442,   2664,   1721,    888,
+         0,   -888,  -1721,  -2664,  -3442,  -4441,  -5162,  -6220,  -6879,  -8000,  -8595,  -9784, -10306, -11572, -12012, -13367,
+    -13711, -15170, -15399, -16987, -17071, -18824, -18716, -20696, -20314, -22633, -21820, -24709, -23099, -27193, -23520, -32107,
+         0,  24092,  31219,  25474,  21799,  23891,  24529,  21448,  19657,  20573,  20268,  17869,  16659,  17120,  16413,  14345,
+     13435,  13640,  12696,  10836,  10121,  10151,   9040,   7334,   6765,   6657,   5414,   3833,   3387,   3162,   1803,    335,
+         0,   -335,  -1803,  -3162,  -3387,  -3833,  -5414,  -6657,  -6765,  -7334,  -9040, -10151, -10121, -10836, -12696, -13640,
+    -13435, -14345, -16413, -17120, -16659, -17869, -20268, -20573, -19657, -21448, -24529, -23891, -21799, -25474, -31219, -24092,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 14
+         0,  30274,  28878,  24964,  28840,  26480,  25939,  27557,  25515,  25970,  26413,  24877,  25662,  25361,  24386,  25146,
+     24408,  23957,  24481,  23565,  23531,  23716,  22835,  23064,  22901,  22202,  22526,  22080,  21640,  21908,  21291,  21113,
+     21217,  20557,  20586,  20475,  19888,  20029,  19709,  19276,  19423,  18949,  18703,  18763,  18220,  18143,  18057,  17536,
+     17572,  17323,  16898,  16969,  16583,  16297,  16326,  15859,  15715,  15642,  15167,  15132,  14929,  14513,  14530,  14204,
+     13892,  13897,  13486,  13295,  13229,  12789,  12703,  12532,  12123,  12100,  11818,  11489,  11473,  11105,  10879,  10817,
+     10406,  10279,  10132,   9732,   9675,   9428,   9087,   9053,   8719,   8466,   8405,   8019,   7860,   7730,   7339,   7254,
+      7035,   6685,   6635,   6330,   6055,   5994,   5629,   5442,   5328,   4944,   4835,   4640,   4282,   4218,   3939,   3645,
+      3584,   3238,   3027,   2925,   2549,   2417,   2244,   1880,   1803,   1547,   1236,   1174,    846,    612,    522,    152,
+         0,   -152,   -522,   -612,   -846,  -1174,  -1236,  -1547,  -1803,  -1880,  -2244,  -2417,  -2549,  -2925,  -3027,  -3238,
+     -3584,  -3645,  -3939,  -4218,  -4282,  -4640,  -4835,  -4944,  -5328,  -5442,  -5629,  -5994,  -6055,  -6330,  -6635,  -6685,
+     -7035,  -7254,  -7339,  -7730,  -7860,  -8019,  -8405,  -8466,  -8719,  -9053,  -9087,  -9428,  -9675,  -9732, -10132, -10279,
+    -10406, -10817, -10879, -11105, -11473, -11489, -11818, -12100, -12123, -12532, -12703, -12789, -13229, -13295, -13486, -13897,
+    -13892, -14204, -14530, -14513, -14929, -15132, -15167, -15642, -15715, -15859, -16326, -16297, -16583, -16969, -16898, -17323,
+    -17572, -17536, -18057, -18143, -18220, -18763, -18703, -18949, -19423, -19276, -19709, -20029, -19888, -20475, -20586, -20557,
+    -21217, -21113, -21291, -21908, -21640, -22080, -22526, -22202, -22901, -23064, -22835, -23716, -23531, -23565, -24481, -23957,
+    -24408, -25146, -24386, -25361, -25662, -24877, -26413, -25970, -25515, -27557, -25939, -26480, -28840, -24964, -28878, -30274,
+         0,  32548,  24387,  28515,  24834,  26912,  24422,  25717,  23784,  24662,  23052,  23672,  22274,  22716,  21470,  21781,
+     20648,  20860,  19815,  19949,  18975,  19043,  18129,  18143,  17278,  17247,  16425,  16353,  15568,  15462,  14710,  14572,
+     13850,  13684,  12989,  12798,  12126,  11912,  11263,  11027,  10399,  10143,   9534,   9259,   8669,   8376,   7803,   7493,
+      6937,   6611,   6070,   5729,   5204,   4847,   4337,   3966,   3470,   3084,   2602,   2203,   1735,   1322,    867,    441,
+         0,   -441,   -867,  -1322,  -1735,  -2203,  -2602,  -3084,  -3470,  -3966,  -4337,  -4847,  -5204,  -5729,  -6070,  -6611,
+     -6937,  -7493,  -7803,  -8376,  -8669,  -9259,  -9534, -10143, -10399, -11027, -11263, -11912, -12126, -12798, -12989, -13684,
+    -13850, -14572, -14710, -15462, -15568, -16353, -16425, -17247, -17278, -18143, -18129, -19043, -18975, -19949, -19815, -20860,
+    -20648, -21781, -21470, -22716, -22274, -23672, -23052, -24662, -23784, -25717, -24422, -26912, -24834, -28515, -24387, -32548,
+         0,  32107,  23520,  27193,  23099,  24709,  21820,  22633,  20314,  20696,  18716,  18824,  17071,  16987,  15399,  15170,
+     13711,  13367,  12012,  11572,  10306,   9784,   8595,   8000,   6879,   6220,   5162,   4441,   3442,   2664,   1721,    888,
+         0,   -888,  -1721,  -2664,  -3442,  -4441,  -5162,  -6220,  -6879,  -8000,  -8595,  -9784, -10306, -11572, -12012, -13367,
+    -13711, -15170, -15399, -16987, -17071, -18824, -18716, -20696, -20314, -22633, -21820, -24709, -23099, -27193, -23520, -32107,
+         0,  24092,  31219,  25474,  21799,  23891,  24529,  21448,  19657,  20573,  20268,  17869,  16659,  17120,  16413,  14345,
+     13435,  13640,  12696,  10836,  10121,  10151,   9040,   7334,   6765,   6657,   5414,   3833,   3387,   3162,   1803,    335,
+         0,   -335,  -1803,  -3162,  -3387,  -3833,  -5414,  -6657,  -6765,  -7334,  -9040, -10151, -10121, -10836, -12696, -13640,
+    -13435, -14345, -16413, -17120, -16659, -17869, -20268, -20573, -19657, -21448, -24529, -23891, -21799, -25474, -31219, -24092,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+    // Frame 15
+         0,  32767,  24823,  29174,  25705,  28009,  25729,  27253,  25525,  26637,  25230,  26085,  24887,  25569,  24518,  25073,
+     24132,  24591,  23734,  24118,  23329,  23652,  22918,  23191,  22503,  22733,  22085,  22279,  21664,  21827,  21241,  21376,
+     20816,  20927,  20390,  20480,  19962,  20033,  19534,  19588,  19105,  19143,  18675,  18699,  18245,  18255,  17814,  17812,
+     17382,  17369,  16951,  16927,  16518,  16485,  16086,  16043,  15653,  15602,  15220,  15161,  14787,  14720,  14353,  14279,
+     13920,  13838,  13486,  13398,  13052,  12958,  12618,  12518,  12183,  12078,  11749,  11638,  11315,  11198,  10880,  10758,
+     10445,  10319,  10011,   9879,   9576,   9440,   9141,   9000,   8706,   8561,   8271,   8121,   7836,   7682,   7401,   7243,
+      6966,   6804,   6531,   6365,   6095,   5926,   5660,   5487,   5225,   5048,   4790,   4609,   4354,   4170,   3919,   3731,
+      3483,   3292,   3048,   2853,   2613,   2414,   2177,   1975,   1742,   1536,   1306,   1097,    871,    658,    435,    219,
+         0,   -219,   -435,   -658,   -871,  -1097,  -1306,  -1536,  -1742,  -1975,  -2177,  -2414,  -2613,  -2853,  -3048,  -3292,
+     -3483,  -3731,  -3919,  -4170,  -4354,  -4609,  -4790,  -5048,  -5225,  -5487,  -5660,  -5926,  -6095,  -6365,  -6531,  -6804,
+     -6966,  -7243,  -7401,  -7682,  -7836,  -8121,  -8271,  -8561,  -8706,  -9000,  -9141,  -9440,  -9576,  -9879, -10011, -10319,
+    -10445, -10758, -10880, -11198, -11315, -11638, -11749, -12078, -12183, -12518, -12618, -12958, -13052, -13398, -13486, -13838,
+    -13920, -14279, -14353, -14720, -14787, -15161, -15220, -15602, -15653, -16043, -16086, -16485, -16518, -16927, -16951, -17369,
+    -17382, -17812, -17814, -18255, -18245, -18699, -18675, -19143, -19105, -19588, -19534, -20033, -19962, -20480, -20390, -20927,
+    -20816, -21376, -21241, -21827, -21664, -22279, -22085, -22733, -22503, -23191, -22918, -23652, -23329, -24118, -23734, -24591,
+    -24132, -25073, -24518, -25569, -24887, -26085, -25230, -26637, -25525, -27253, -25729, -28009, -25705, -29174, -24823, -32767,
+         0,  32548,  24387,  28515,  24834,  26912,  24422,  25717,  23784,  24662,  23052,  23672,  22274,  22716,  21470,  21781,
+     20648,  20860,  19815,  19949,  18975,  19043,  18129,  18143,  17278,  17247,  16425,  16353,  15568,  15462,  14710,  14572,
+     13850,  13684,  12989,  12798,  12126,  11912,  11263,  11027,  10399,  10143,   9534,   9259,   8669,   8376,   7803,   7493,
+      6937,   6611,   6070,   5729,   5204,   4847,   4337,   3966,   3470,   3084,   2602,   2203,   1735,   1322,    867,    441,
+         0,   -441,   -867,  -1322,  -1735,  -2203,  -2602,  -3084,  -3470,  -3966,  -4337,  -4847,  -5204,  -5729,  -6070,  -6611,
+     -6937,  -7493,  -7803,  -8376,  -8669,  -9259,  -9534, -10143, -10399, -11027, -11263, -11912, -12126, -12798, -12989, -13684,
+    -13850, -14572, -14710, -15462, -15568, -16353, -16425, -17247, -17278, -18143, -18129, -19043, -18975, -19949, -19815, -20860,
+    -20648, -21781, -21470, -22716, -22274, -23672, -23052, -24662, -23784, -25717, -24422, -26912, -24834, -28515, -24387, -32548,
+         0,  32107,  23520,  27193,  23099,  24709,  21820,  22633,  20314,  20696,  18716,  18824,  17071,  16987,  15399,  15170,
+     13711,  13367,  12012,  11572,  10306,   9784,   8595,   8000,   6879,   6220,   5162,   4441,   3442,   2664,   1721,    888,
+         0,   -888,  -1721,  -2664,  -3442,  -4441,  -5162,  -6220,  -6879,  -8000,  -8595,  -9784, -10306, -11572, -12012, -13367,
+    -13711, -15170, -15399, -16987, -17071, -18824, -18716, -20696, -20314, -22633, -21820, -24709, -23099, -27193, -23520, -32107,
+         0,  24092,  31219,  25474,  21799,  23891,  24529,  21448,  19657,  20573,  20268,  17869,  16659,  17120,  16413,  14345,
+     13435,  13640,  12696,  10836,  10121,  10151,   9040,   7334,   6765,   6657,   5414,   3833,   3387,   3162,   1803,    335,
+         0,   -335,  -1803,  -3162,  -3387,  -3833,  -5414,  -6657,  -6765,  -7334,  -9040, -10151, -10121, -10836, -12696, -13640,
+    -13435, -14345, -16413, -17120, -16659, -17869, -20268, -20573, -19657, -21448, -24529, -23891, -21799, -25474, -31219, -24092,
+         0,  13428,  23757,  29097,  29416,  26350,  22312,  19365,  18412,  19046,  20057,  20252,  19115,  16998,  14791,  13327,
+     12892,  13111,  13240,  12656,  11228,   9363,   7718,   6772,   6538,   6573,   6284,   5303,   3717,   2002,    705,     98,
+         0,    -98,   -705,  -2002,  -3717,  -5303,  -6284,  -6573,  -6538,  -6772,  -7718,  -9363, -11228, -12656, -13240, -13111,
+    -12892, -13327, -14791, -16998, -19115, -20252, -20057, -19046, -18412, -19365, -22312, -26350, -29416, -29097, -23757, -13428,
+         0,   6911,  13330,  18822,  23052,  25824,  27095,  26974,  25699,  23598,  21047,  18417,  16028,  14112,  12792,  12078,
+     11874,  12011,  12273,  12444,  12339,  11835,  10889,   9537,   7887,   6097,   4342,   2786,   1551,    698,    217,     28,
+         0,    -28,   -217,   -698,  -1551,  -2786,  -4342,  -6097,  -7887,  -9537, -10889, -11835, -12339, -12444, -12273, -12011,
+    -11874, -12078, -12792, -14112, -16028, -18417, -21047, -23598, -25699, -26974, -27095, -25824, -23052, -18822, -13330,  -6911,
+         0,   3483,   6883,  10118,  13114,  15801,  18123,  20034,  21500,  22503,  23038,  23113,  22753,  21992,  20877,  19463,
+     17812,  15988,  14061,  12097,  10158,   8304,   6582,   5034,   3689,   2565,   1668,    991,    519,    223,     67,      8,
+         0,     -8,    -67,   -223,   -519,   -991,  -1668,  -2565,  -3689,  -5034,  -6582,  -8304, -10158, -12097, -14061, -15988,
+    -17812, -19463, -20877, -21992, -22753, -23113, -23038, -22503, -21500, -20034, -18123, -15801, -13114, -10118,  -6883,  -3483,
+         0,   1746,   3475,   5170,   6816,   8396,   9896,  11300,  12595,  13769,  14810,  15708,  16456,  17045,  17469,  17726,
+     17812,  17726,  17469,  17045,  16456,  15708,  14810,  13769,  12595,  11300,   9896,   8396,   6816,   5170,   3475,   1746,
+         0,  -1746,  -3475,  -5170,  -6816,  -8396,  -9896, -11300, -12595, -13769, -14810, -15708, -16456, -17045, -17469, -17726,
+    -17812, -17726, -17469, -17045, -16456, -15708, -14810, -13769, -12595, -11300,  -9896,  -8396,  -6816,  -5170,  -3475,  -1746,
+    
+};
+
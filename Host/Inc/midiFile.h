@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Channel message from a Standard MIDI File, already placed on the audio sample clock
+struct MidiFileEvent {
+    uint64_t frame;
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+};
+
+class MidiFile {
+public:
+    MidiFile() = default;
+
+    // Parses a format 0 or 1 SMF. Returns 0 on success, non-zero on a malformed or unreadable file.
+    uint8_t load(const std::string& path, uint32_t sampleRate);
+
+    [[nodiscard]] const std::vector<MidiFileEvent>& events() const noexcept { return _events; }
+    [[nodiscard]] uint64_t lengthFrames() const noexcept { return _events.empty() ? 0 : _events.back().frame; }
+
+private:
+    struct TrackEvent {
+        uint64_t tick;
+        uint32_t order;    // Keeps file order stable for events on the same tick
+        bool isTempo;
+        uint32_t tempo;    // Microseconds per quarter note
+        uint8_t status, data1, data2;
+    };
+
+    uint8_t parseTrack(const uint8_t* data, size_t size, std::vector<TrackEvent>& out);
+
+    std::vector<MidiFileEvent> _events;
+    uint16_t _division{480};
+    bool _smpte{false};
+    uint32_t _orderCount{0};
+};
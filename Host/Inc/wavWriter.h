@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+// Streams interleaved 16-bit PCM to a RIFF/WAVE file, sizes are patched on close()
+class WavWriter {
+public:
+    WavWriter() = default;
+    ~WavWriter() { close(); }
+
+    uint8_t open(const std::string& path, uint32_t sampleRate, uint16_t channels);
+    void write(const int16_t* samples, size_t count);
+    void close();
+
+private:
+    void writeHeader();
+
+    FILE* _file{nullptr};
+    uint32_t _sampleRate{0};
+    uint16_t _channels{0};
+    uint32_t _dataBytes{0};
+};
@@ -0,0 +1,141 @@
+#include "midiFile.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+    uint32_t readBE(const uint8_t* p, uint8_t bytes) {
+        uint32_t v = 0;
+        for (uint8_t i = 0; i < bytes; ++i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    // Variable length quantity, max 4 bytes. Returns false if it runs off the end.
+    bool readVarLen(const uint8_t* data, size_t size, size_t& pos, uint32_t& out) {
+        out = 0;
+        for (int i = 0; i < 4; ++i) {
+            if (pos >= size) return false;
+            uint8_t b = data[pos++];
+            out = (out << 7) | (b & 0x7F);
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+}
+
+uint8_t MidiFile::load(const std::string& path, uint32_t sampleRate) {
+    FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return 1;
+
+    std::vector<uint8_t> file;
+    uint8_t chunk[4096];
+    size_t n;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), f)) > 0) file.insert(file.end(), chunk, chunk + n);
+    std::fclose(f);
+
+    if (file.size() < 14 || std::string(file.begin(), file.begin() + 4) != "MThd") return 2;
+
+    const uint32_t headerLen = readBE(&file[4], 4);
+    const uint16_t format = readBE(&file[8], 2);
+    const uint16_t numTracks = readBE(&file[10], 2);
+    const uint16_t division = readBE(&file[12], 2);
+    if (format > 1 || headerLen < 6) return 3;
+
+    _smpte = (division & 0x8000) != 0;
+    _division = division;
+
+    std::vector<TrackEvent> merged;
+    size_t pos = 8 + headerLen;
+    for (uint16_t t = 0; t < numTracks; ++t) {
+        if (pos + 8 > file.size()) return 4;
+        const uint32_t len = readBE(&file[pos + 4], 4);
+        const bool isTrack = std::string(file.begin() + pos, file.begin() + pos + 4) == "MTrk";
+        pos += 8;
+        if (pos + len > file.size()) return 4;
+        if (isTrack && parseTrack(&file[pos], len, merged) != 0) return 5;
+        pos += len;
+    }
+
+    std::stable_sort(merged.begin(), merged.end(), [](const TrackEvent& a, const TrackEvent& b) {
+        return (a.tick != b.tick) ? a.tick < b.tick : a.order < b.order;
+    });
+
+    // Walk the merged list once, integrating the tempo map into seconds
+    double seconds = 0.0;
+    uint64_t lastTick = 0;
+    double secondsPerTick;
+    if (_smpte) {
+        const int fps = -static_cast<int8_t>(division >> 8);
+        const int ticksPerFrame = division & 0xFF;
+        secondsPerTick = 1.0 / (static_cast<double>(fps) * ticksPerFrame);
+    } else {
+        secondsPerTick = 0.5 / _division; // Default 120 BPM
+    }
+
+    _events.clear();
+    for (const auto& e : merged) {
+        seconds += static_cast<double>(e.tick - lastTick) * secondsPerTick;
+        lastTick = e.tick;
+
+        if (e.isTempo) {
+            if (!_smpte) secondsPerTick = (e.tempo * 1e-6) / _division;
+            continue;
+        }
+        _events.push_back({static_cast<uint64_t>(seconds * sampleRate + 0.5), e.status, e.data1, e.data2});
+    }
+    return 0;
+}
+
+uint8_t MidiFile::parseTrack(const uint8_t* data, size_t size, std::vector<TrackEvent>& out) {
+    size_t pos = 0;
+    uint64_t tick = 0;
+    uint8_t runningStatus = 0;
+
+    while (pos < size) {
+        uint32_t delta;
+        if (!readVarLen(data, size, pos, delta)) return 1;
+        tick += delta;
+        if (pos >= size) return 1;
+
+        uint8_t status = data[pos];
+        if (status == 0xFF) { // Meta event
+            if (pos + 2 > size) return 1;
+            const uint8_t type = data[pos + 1];
+            pos += 2;
+            uint32_t len;
+            if (!readVarLen(data, size, pos, len) || pos + len > size) return 1;
+            if (type == 0x51 && len == 3) {
+                out.push_back({tick, _orderCount++, true, readBE(&data[pos], 3), 0, 0, 0});
+            }
+            pos += len;
+            if (type == 0x2F) break; // End of track
+            continue;
+        }
+        if (status == 0xF0 || status == 0xF7) { // SysEx, skipped
+            ++pos;
+            uint32_t len;
+            if (!readVarLen(data, size, pos, len) || pos + len > size) return 1;
+            pos += len;
+            continue;
+        }
+
+        if (status & 0x80) {
+            runningStatus = status;
+            ++pos;
+        } else if (runningStatus == 0) {
+            return 1;
+        } else {
+            status = runningStatus;
+        }
+
+        // Program change and channel pressure carry one data byte, everything else two
+        const uint8_t message = status & 0xF0;
+        const uint8_t dataBytes = (message == 0xC0 || message == 0xD0) ? 1 : 2;
+        if (pos + dataBytes > size) return 1;
+        const uint8_t d1 = data[pos];
+        const uint8_t d2 = (dataBytes == 2) ? data[pos + 1] : 0;
+        pos += dataBytes;
+
+        out.push_back({tick, _orderCount++, false, 0, status, d1, d2});
+    }
+    return 0;
+}
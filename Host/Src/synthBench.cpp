@@ -0,0 +1,29 @@
+// Host runner for the DSP microbenchmark suite. Prints one JSON object per
+// benchmark so results can be appended to a file and compared across commits:
+//   synthBench --blocks 20000 --label $(git rev-parse --short HEAD) >> bench.jsonl
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "benchSuite.h"
+
+int main(int argc, char** argv) {
+    uint32_t blocks = 20000;
+    const char* label = "";
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--blocks") && i + 1 < argc) {
+            blocks = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (!std::strcmp(argv[i], "--label") && i + 1 < argc) {
+            label = argv[++i];
+        } else {
+            std::fprintf(stderr, "usage: synthBench [--blocks N] [--label name]\n");
+            return 1;
+        }
+    }
+    if (blocks == 0) blocks = 1;
+
+    Bench::runAll(blocks, Bench::printJson, const_cast<char*>(label));
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Runs recorded USB-MIDI packet streams through MidiParser, the decoder the firmware uses, and
+// prints every event it produces. The stream is hex bytes, four per packet, '#' starts a comment:
+//   synthMidiDump capture.txt
+//   synthMidiDump - < capture.txt
+// Lines are not significant, so a dump of the raw OUT endpoint transfers works as it is.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "midiParser.h"
+
+namespace {
+    const char* typeName(MidiEvent::Type type) {
+        switch (type) {
+            case MidiEvent::Type::NOTE_OFF: return "note-off";
+            case MidiEvent::Type::NOTE_ON: return "note-on";
+            case MidiEvent::Type::POLY_PRESSURE: return "poly-pressure";
+            case MidiEvent::Type::CONTROL_CHANGE: return "cc";
+            case MidiEvent::Type::PROGRAM_CHANGE: return "program";
+            case MidiEvent::Type::CHANNEL_PRESSURE: return "pressure";
+            case MidiEvent::Type::PITCH_BEND: return "bend";
+            case MidiEvent::Type::SYSEX: return "sysex";
+            case MidiEvent::Type::SYSTEM_COMMON: return "common";
+            case MidiEvent::Type::REALTIME: return "realtime";
+            default: return "none";
+        }
+    }
+
+    bool readPackets(FILE* in, std::vector<MidiPacket>& packets) {
+        std::vector<uint8_t> bytes;
+        char token[64];
+        while (std::fscanf(in, "%63s", token) == 1) {
+            if (token[0] == '#') {
+                int c;
+                while ((c = std::fgetc(in)) != EOF && c != '\n') {}
+                continue;
+            }
+            char* end = nullptr;
+            const unsigned long value = std::strtoul(token, &end, 16);
+            if (end == token || *end != '\0' || value > 0xFF) {
+                std::fprintf(stderr, "not a hex byte: %s\n", token);
+                return false;
+            }
+            bytes.push_back(static_cast<uint8_t>(value));
+        }
+        if (bytes.size() % 4) std::fprintf(stderr, "ignoring %zu trailing bytes\n", bytes.size() % 4);
+
+        for (size_t i = 0; i + 4 <= bytes.size(); i += 4) {
+            MidiPacket p{{bytes[i], bytes[i + 1], bytes[i + 2], bytes[i + 3]}, static_cast<uint32_t>(i / 4)};
+            packets.push_back(p);
+        }
+        return true;
+    }
+
+    void printEvent(const MidiEvent& e, const MidiParser& parser) {
+        std::printf("%6u  cable %u  %-13s", e.stamp, e.cable, typeName(e.type));
+        switch (e.type) {
+            case MidiEvent::Type::SYSEX:
+                for (uint32_t i = 0; i < parser.sysexLength(); ++i) std::printf(" %02X", parser.sysex()[i]);
+                break;
+            case MidiEvent::Type::PITCH_BEND:
+                std::printf(" ch %2u  %d", e.channel + 1, e.bend());
+                break;
+            case MidiEvent::Type::SYSTEM_COMMON:
+            case MidiEvent::Type::REALTIME:
+                std::printf(" %02X %u %u", e.status, e.data1, e.data2);
+                break;
+            default:
+                std::printf(" ch %2u  %u %u", e.channel + 1, e.data1, e.data2);
+                break;
+        }
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: synthMidiDump <packets.txt | ->\n");
+        return 1;
+    }
+
+    FILE* in = std::strcmp(argv[1], "-") ? std::fopen(argv[1], "r") : stdin;
+    if (!in) {
+        std::fprintf(stderr, "failed to open %s\n", argv[1]);
+        return 1;
+    }
+    std::vector<MidiPacket> packets;
+    const bool ok = readPackets(in, packets);
+    if (in != stdin) std::fclose(in);
+    if (!ok) return 1;
+
+    // Stamps are packet indices
+    MidiParser parser;
+    uint32_t events = 0;
+    for (const MidiPacket& p : packets) {
+        MidiEvent e;
+        if (!parser.feed(p, e)) continue;
+        printEvent(e, parser);
+        ++events;
+    }
+
+    // Decode cost on its own, the stream repeated until it has run for a while
+    constexpr uint32_t TARGET_PACKETS = 1000000;
+    volatile uint32_t sink = 0;
+    uint64_t decoded = 0;
+    const auto start = std::chrono::steady_clock::now();
+    if (!packets.empty()) {
+        while (decoded < TARGET_PACKETS) {
+            MidiParser timed;
+            for (const MidiPacket& p : packets) {
+                MidiEvent e;
+                if (timed.feed(p, e)) sink += e.data1;
+            }
+            decoded += packets.size();
+        }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+
+    std::printf("\n%zu packets, %u events, %u malformed, %u sysex overflows, %.1f ns/packet\n",
+        packets.size(), events, parser.errors(), parser.sysexOverflows(),
+        decoded ? ns / static_cast<double>(decoded) : 0.0);
+    return 0;
+}
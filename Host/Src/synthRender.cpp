@@ -0,0 +1,248 @@
+// Offline render engine: drives VoiceManager::process() block by block from a
+// Standard MIDI File and writes the result as a 48 kHz stereo WAV, reporting
+// how long each block took against the DMA half-buffer deadline.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "constants.h"
+#include "midiFile.h"
+#include "midiParser.h"
+#include "osc.h"
+#include "voiceManager.h"
+#include "wavWriter.h"
+
+namespace {
+    VoiceManager voiceManager;
+
+    struct Options {
+        std::string midiPath;
+        std::string wavPath;
+        float cutoff{20000.0f};
+        float resonance{0.0f};
+        float morph{0.0f};
+        int set{-1};
+        float bpm{120.0f};
+        int unison{1};
+        float detune{0.15f};
+        float spread{0.7f};
+        float deadlineUs{0.0f};
+        int mpe{0};
+        VoiceAllocator::StealPolicy steal{VoiceAllocator::StealPolicy::OLDEST};
+        float tailSeconds{5.0f};
+    };
+
+    void printUsage() {
+        std::fprintf(stderr,
+            "usage: synthRender <in.mid> <out.wav> [options]\n"
+            "  --cutoff <hz>       filter cutoff (default 20000)\n"
+            "  --resonance <0..1>  filter resonance (default 0)\n"
+            "  --morph <0..1>      wavetable morph, scan position with --set (default 0)\n"
+            "  --set <index>       scanning wavetable set (default: A/B slots)\n"
+            "  --bpm <bpm>         tempo for synced LFOs (default 120)\n"
+            "  --unison <1..7>     oscillator copies per voice, 1 only in SoA builds (default 1)\n"
+            "  --detune <semis>    detune of the outermost unison copies (default 0.15)\n"
+            "  --spread <0..1>     stereo width of the unison copies (default 0.7)\n"
+            "  --deadline <us>     run the load governor against this block deadline (default off)\n"
+            "  --mpe <channels>    MPE lower zone with this many member channels (default off)\n"
+            "  --steal <policy>    voice stealing: oldest, quietest or same-note (default oldest)\n"
+            "  --tail <seconds>    max render time after the last event (default 5)\n");
+    }
+
+    bool parseOptions(int argc, char** argv, Options& opt) {
+        if (argc < 3) return false;
+        opt.midiPath = argv[1];
+        opt.wavPath = argv[2];
+        for (int i = 3; i < argc; ++i) {
+            if (i + 1 >= argc) return false;
+            if (!std::strcmp(argv[i], "--steal")) {
+                const char* name = argv[++i];
+                if (!std::strcmp(name, "oldest")) opt.steal = VoiceAllocator::StealPolicy::OLDEST;
+                else if (!std::strcmp(name, "quietest")) opt.steal = VoiceAllocator::StealPolicy::QUIETEST;
+                else if (!std::strcmp(name, "same-note")) opt.steal = VoiceAllocator::StealPolicy::SAME_NOTE;
+                else return false;
+                continue;
+            }
+            const float value = std::strtof(argv[i + 1], nullptr);
+            if (!std::strcmp(argv[i], "--cutoff")) opt.cutoff = value;
+            else if (!std::strcmp(argv[i], "--resonance")) opt.resonance = value;
+            else if (!std::strcmp(argv[i], "--morph")) opt.morph = value;
+            else if (!std::strcmp(argv[i], "--set")) opt.set = static_cast<int>(value);
+            else if (!std::strcmp(argv[i], "--bpm")) opt.bpm = value;
+            else if (!std::strcmp(argv[i], "--unison")) opt.unison = static_cast<int>(value);
+            else if (!std::strcmp(argv[i], "--detune")) opt.detune = value;
+            else if (!std::strcmp(argv[i], "--spread")) opt.spread = value;
+            else if (!std::strcmp(argv[i], "--deadline")) opt.deadlineUs = value;
+            else if (!std::strcmp(argv[i], "--mpe")) opt.mpe = static_cast<int>(value);
+            else if (!std::strcmp(argv[i], "--tail")) opt.tailSeconds = value;
+            else return false;
+            ++i;
+        }
+        return true;
+    }
+
+    // Notes are scheduled on their exact frame, a full queue plays its backlog early
+    void playNote(uint8_t note, uint8_t velocity, uint64_t frame, uint8_t channel) {
+        voiceManager.scheduleNote(note, velocity, static_cast<uint32_t>(frame), channel);
+    }
+
+    void playPedal(VoiceManager::Pedal pedal, bool down, uint64_t frame) {
+        voiceManager.schedulePedal(pedal, down, static_cast<uint32_t>(frame));
+    }
+
+    // MPE Configuration Message, RPN 6 on channel 1
+    void applyRpn(const MidiEvent& e) {
+        static uint8_t rpnMsb = 0x7F;
+        static uint8_t rpnLsb = 0x7F;
+        if (e.channel != 0) return;
+        if (e.data1 == 101) rpnMsb = e.data2;
+        else if (e.data1 == 100) rpnLsb = e.data2;
+        else if (e.data1 == 6 && rpnMsb == 0 && rpnLsb == 6) voiceManager.setMpe(e.data2);
+    }
+
+    // File events go through the same parser as USB packets on the board. Mirrors
+    // dispatchEvent() and handleMidi() in app.cpp.
+    MidiParser parser;
+
+    void applyEvent(const MidiFileEvent& f) {
+        const MidiPacket packet{{static_cast<uint8_t>(f.status >> 4), f.status, f.data1, f.data2}, 0};
+        MidiEvent e;
+        if (!parser.feed(packet, e)) return;
+
+        switch (e.type) {
+            case MidiEvent::Type::NOTE_ON:
+                playNote(e.data1, e.data2, f.frame, e.channel);
+                break;
+            case MidiEvent::Type::NOTE_OFF:
+                playNote(e.data1, 0, f.frame, e.channel);
+                break;
+            case MidiEvent::Type::CONTROL_CHANGE:
+                if (e.data1 == 1) voiceManager.setModWheel(e.data2);
+                else if (e.data1 == 74) voiceManager.setTimbre(e.data2, e.channel);
+                else if (e.data1 == 64) playPedal(VoiceManager::Pedal::SUSTAIN, e.data2 >= 64, f.frame);
+                else if (e.data1 == 66) playPedal(VoiceManager::Pedal::SOSTENUTO, e.data2 >= 64, f.frame);
+                else if (e.data1 == 16) voiceManager.setUnisonVoices(e.data2);
+                else if (e.data1 == 17) voiceManager.setUnisonDetune(e.data2);
+                else if (e.data1 == 18) voiceManager.setUnisonSpread(e.data2);
+                else if (e.data1 == 123) voiceManager.scheduleAllNotesOff(static_cast<uint32_t>(f.frame));
+                else applyRpn(e);
+                break;
+            case MidiEvent::Type::PROGRAM_CHANGE:
+                Osc::requestWavetableSet(e.data1);
+                break;
+            case MidiEvent::Type::CHANNEL_PRESSURE:
+                voiceManager.setAftertouch(e.data1, e.channel);
+                break;
+            case MidiEvent::Type::PITCH_BEND:
+                voiceManager.setPitchBend(e.data1, e.data2, e.channel);
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool anyVoiceActive() {
+        for (uint8_t i = 0; i < Constants::NUM_VOICES; ++i) {
+            if (voiceManager.getVoiceLevel(i) > 0.0f) return true;
+        }
+        return false;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseOptions(argc, argv, opt)) {
+        printUsage();
+        return 1;
+    }
+
+    MidiFile midi;
+    if (auto status = midi.load(opt.midiPath, Constants::SAMPLE_RATE)) {
+        std::fprintf(stderr, "failed to read %s (error %u)\n", opt.midiPath.c_str(), status);
+        return 1;
+    }
+
+    WavWriter wav;
+    if (wav.open(opt.wavPath, Constants::SAMPLE_RATE, 2) != 0) {
+        std::fprintf(stderr, "failed to open %s\n", opt.wavPath.c_str());
+        return 1;
+    }
+
+    voiceManager.setCutoff(opt.cutoff);
+    voiceManager.setResonance(opt.resonance);
+    voiceManager.setMorph(opt.morph);
+    voiceManager.setTempo(opt.bpm);
+    if (opt.unison > VoiceManager::MAX_UNISON) {
+        std::fprintf(stderr, "--unison: this build renders at most %u copies per voice\n", static_cast<unsigned>(VoiceManager::MAX_UNISON));
+        return 1;
+    }
+    voiceManager.setUnison(static_cast<uint8_t>(std::max(opt.unison, 1)), opt.detune, opt.spread);
+    voiceManager.setStealPolicy(opt.steal);
+    if (opt.mpe > 0) voiceManager.setMpe(static_cast<uint8_t>(std::min(opt.mpe, 15)));
+    if (opt.set >= 0) Osc::requestWavetableSet(static_cast<uint8_t>(opt.set));
+    // A deadline far below the real one stands in for a slower CPU
+    voiceManager.setLoadDeadline(static_cast<uint32_t>(opt.deadlineUs * 1000.0f));
+    uint32_t maxLevel = 0;
+
+    const auto& events = midi.events();
+    const uint64_t tailFrames = static_cast<uint64_t>(opt.tailSeconds * Constants::SAMPLE_RATE);
+    const uint64_t lastEventFrame = midi.lengthFrames();
+
+    int16_t block[Constants::BUFFER_SIZE];
+    std::vector<uint32_t> blockNs;
+    size_t next = 0;
+    uint64_t frame = 0;
+
+    while (true) {
+        // Notes play on their own frame, everything else lands on the block boundary like on the firmware
+        const uint64_t blockEnd = frame + Constants::NUM_FRAMES;
+        while (next < events.size() && events[next].frame < blockEnd) applyEvent(events[next++]);
+
+        if (next == events.size() && frame > lastEventFrame &&
+            (!anyVoiceActive() || frame - lastEventFrame >= tailFrames)) break;
+
+        const auto start = std::chrono::steady_clock::now();
+        voiceManager.process(block);
+        const auto stop = std::chrono::steady_clock::now();
+
+        blockNs.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()));
+        voiceManager.reportRenderTime(blockNs.back());
+        maxLevel = std::max(maxLevel, voiceManager.getGovernor().level());
+        wav.write(block, Constants::BUFFER_SIZE);
+        frame = blockEnd;
+    }
+    wav.close();
+
+    if (blockNs.empty()) {
+        std::fprintf(stderr, "nothing rendered\n");
+        return 1;
+    }
+
+    double totalNs = 0.0;
+    for (uint32_t ns : blockNs) totalNs += ns;
+    std::vector<uint32_t> sorted = blockNs;
+    std::sort(sorted.begin(), sorted.end());
+
+    const double audioSeconds = static_cast<double>(frame) / Constants::SAMPLE_RATE;
+    const double renderSeconds = totalNs * 1e-9;
+    const double budgetUs = Constants::BLOCK_PERIOD_US;
+    const auto percentileUs = [&](double p) {
+        return sorted[static_cast<size_t>(p * (sorted.size() - 1))] * 1e-3;
+    };
+
+    std::printf("rendered     %.2f s of audio in %zu blocks of %d frames\n", audioSeconds, blockNs.size(), Constants::NUM_FRAMES);
+    std::printf("render time  %.3f ms\n", renderSeconds * 1e3);
+    std::printf("RTF          %.5f (%.1fx faster than real time)\n", renderSeconds / audioSeconds, audioSeconds / renderSeconds);
+    std::printf("block cost   min %.2f us  mean %.2f us  p99 %.2f us  max %.2f us  (budget %.1f us)\n",
+        sorted.front() * 1e-3, totalNs * 1e-3 / blockNs.size(), percentileUs(0.99), sorted.back() * 1e-3, budgetUs);
+    if (voiceManager.getGovernor().isEnabled()) {
+        std::printf("governor     max level %u, %u overruns of %.1f us\n",
+            maxLevel, voiceManager.getGovernor().overruns(), opt.deadlineUs);
+    }
+    return 0;
+}
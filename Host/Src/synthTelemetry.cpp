@@ -0,0 +1,137 @@
+// Telemetry decoder: asks the synth for its render-time reports over USB MIDI and prints them.
+// Talks to an ALSA raw MIDI device directly, or decodes a hex dump from stdin:
+//   synthTelemetry /dev/snd/midiC1D0
+//   amidi -p hw:1,0,0 -S 'F0 7D 53 02 F7' -d | synthTelemetry -
+
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "midiBuffer.h"
+#include "telemetry.h"
+
+namespace {
+    volatile std::sig_atomic_t stop = 0;
+
+    void onSignal(int) { stop = 1; }
+
+    bool sendCommand(int fd, Telemetry::Command cmd) {
+        const uint8_t msg[] = {0xF0, Telemetry::MANUFACTURER, Telemetry::DEVICE, static_cast<uint8_t>(cmd), 0xF7};
+        return write(fd, msg, sizeof(msg)) == static_cast<ssize_t>(sizeof(msg));
+    }
+
+    void printReport(const Telemetry::Report& r) {
+        const double usPerTick = (r.tickRateKhz > 0) ? 1000.0 / r.tickRateKhz : 0.0;
+        const double deadlineUs = r.deadlineTicks * usPerTick;
+        static const char* const NAMES[] = {"half", "full"};
+
+        for (uint32_t i = 0; i < Telemetry::CALLBACKS; ++i) {
+            const Telemetry::Timing& t = r.timing[i];
+            const double meanTicks = t.blocks ? static_cast<double>(t.sumTicks) / t.blocks : 0.0;
+            std::printf("%s  %5u blocks  min %7.1f us  mean %7.1f us  max %7.1f us  (%5.1f%% of %.1f us)  |",
+                NAMES[i], t.blocks, t.minTicks * usPerTick, meanTicks * usPerTick, t.maxTicks * usPerTick,
+                deadlineUs > 0.0 ? 100.0 * t.maxTicks * usPerTick / deadlineUs : 0.0, deadlineUs);
+            // Bins are 1/BINS_PER_DEADLINE of the deadline wide, a '|' marks where it falls
+            for (uint32_t b = 0; b < Telemetry::BINS; ++b) {
+                if (b == Telemetry::BINS_PER_DEADLINE) std::printf(" |");
+                std::printf(" %u", t.histogram[b]);
+            }
+            std::printf("\n");
+        }
+        std::printf("underruns %u  midi overflows %u  midi high water %u/%u  active voices %u  governor level %u\n\n",
+            r.underruns, r.midiOverflows, r.midiHighWater, MidiBuffer::SIZE, r.activeVoices, r.governorLevel);
+        std::fflush(stdout);
+    }
+
+    // Collects SysEx from a byte stream and prints every report in it
+    struct Assembler {
+        std::vector<uint8_t> msg;
+        bool inSysex{false};
+
+        void feed(uint8_t byte) {
+            if (byte == 0xF0) {
+                msg.clear();
+                inSysex = true;
+            }
+            if (!inSysex) return;
+            if (byte >= 0xF8) return; // Real-time bytes may sit inside SysEx
+            msg.push_back(byte);
+            if (byte == 0xF7) {
+                inSysex = false;
+                Telemetry::Report report;
+                if (Telemetry::decode(msg.data(), static_cast<uint32_t>(msg.size()), report)) printReport(report);
+            }
+        }
+    };
+
+    int decodeHex(FILE* in) {
+        Assembler assembler;
+        char token[16];
+        while (std::fscanf(in, "%15s", token) == 1) {
+            char* end = nullptr;
+            const unsigned long value = std::strtoul(token, &end, 16);
+            if (end != token && *end == '\0' && value <= 0xFF) assembler.feed(static_cast<uint8_t>(value));
+        }
+        return 0;
+    }
+
+    int streamDevice(const char* path, bool once) {
+        const int fd = open(path, O_RDWR);
+        if (fd < 0) {
+            std::fprintf(stderr, "failed to open %s\n", path);
+            return 1;
+        }
+        if (!sendCommand(fd, once ? Telemetry::Command::SEND : Telemetry::Command::STREAM_ON)) {
+            std::fprintf(stderr, "failed to send the request to %s\n", path);
+            close(fd);
+            return 1;
+        }
+
+        std::signal(SIGINT, onSignal);
+        std::signal(SIGTERM, onSignal);
+
+        Assembler assembler;
+        uint8_t chunk[256];
+        while (!stop) {
+            const ssize_t n = read(fd, chunk, sizeof(chunk));
+            if (n <= 0) break;
+            for (ssize_t i = 0; i < n; ++i) {
+                const bool wasIn = assembler.inSysex;
+                assembler.feed(chunk[i]);
+                if (once && wasIn && !assembler.inSysex) stop = 1;
+            }
+        }
+
+        if (!once) sendCommand(fd, Telemetry::Command::STREAM_OFF);
+        close(fd);
+        return 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    bool once = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--once")) once = true;
+        else if (!path) path = argv[i];
+        else {
+            path = nullptr;
+            break;
+        }
+    }
+    if (!path) {
+        std::fprintf(stderr,
+            "usage: synthTelemetry <raw midi device> [--once]\n"
+            "       synthTelemetry -    (hex bytes on stdin, e.g. from amidi -d)\n");
+        return 1;
+    }
+
+    if (!std::strcmp(path, "-")) return decodeHex(stdin);
+    return streamDevice(path, once);
+}
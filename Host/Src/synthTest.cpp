@@ -0,0 +1,407 @@
+// Regression checks for the voice engine, run by ctest. Each check renders through VoiceManager
+// the way the firmware does and compares against a render that can't be affected by the bug.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "adsr.h"
+#include "lfo.h"
+#include "loadGovernor.h"
+#include "svf.h"
+#include "voiceManager.h"
+
+namespace {
+    using Block = int16_t[Constants::BUFFER_SIZE];
+
+    int failures = 0;
+
+    void check(bool ok, const char* name, const char* detail) {
+        std::printf("%s  %s%s%s\n", ok ? "ok  " : "FAIL", name, ok ? "" : ": ", ok ? "" : detail);
+        if (!ok) ++failures;
+    }
+
+    // Renders until every voice is idle and back on the free list
+    bool renderUntilSilent(VoiceManager& vm) {
+        Block block;
+        for (int i = 0; i < 10000; ++i) {
+            vm.process(block);
+            bool silent = true;
+            for (uint8_t v = 0; v < Constants::NUM_VOICES; ++v) silent &= (vm.getVoiceLevel(v) == 0.0f);
+            if (silent) return true;
+        }
+        return false;
+    }
+
+    // Largest sample difference over the block a note starts in, partway through, and the next
+    int startDifference(VoiceManager& used, VoiceManager& fresh, uint8_t note, uint8_t channel) {
+        constexpr uint32_t OFFSET = 8;
+        used.scheduleNote(note, 127, used.getFrame() + OFFSET, channel);
+        fresh.scheduleNote(note, 127, fresh.getFrame() + OFFSET, channel);
+
+        int worst = 0;
+        for (int b = 0; b < 2; ++b) {
+            Block a, r;
+            used.process(a);
+            fresh.process(r);
+            for (int i = 0; i < Constants::BUFFER_SIZE; ++i) worst = std::max(worst, std::abs(a[i] - r[i]));
+        }
+        return worst;
+    }
+
+    // Renders blocks of a stereo interleaved stream onto the end of out
+    void renderInto(VoiceManager& vm, std::vector<int16_t>& out, int blocks) {
+        Block block;
+        for (int b = 0; b < blocks; ++b) {
+            vm.process(block);
+            out.insert(out.end(), block, block + Constants::BUFFER_SIZE);
+        }
+    }
+
+    // A note scheduled partway through a block starts on that frame, so it renders like the same
+    // note started on a block boundary moved along by the offset. The SoA bank renders its lanes
+    // in lockstep and starts notes on the first frame of their block.
+    void scheduledFrameOffset() {
+        for (uint32_t offset : {1u, 13u, static_cast<uint32_t>(Constants::NUM_FRAMES - 1)}) {
+            auto timed = std::make_unique<VoiceManager>();
+            auto aligned = std::make_unique<VoiceManager>();
+            timed->scheduleNote(60, 127, timed->getFrame() + Constants::NUM_FRAMES + offset);
+            aligned->scheduleNote(60, 127, aligned->getFrame() + Constants::NUM_FRAMES);
+
+            std::vector<int16_t> a, r;
+            renderInto(*timed, a, 6);
+            renderInto(*aligned, r, 6);
+
+            // Two samples per frame, the note's block is the second one rendered
+            const uint32_t delay = SYNTH_SOA_VOICES ? 0 : 2 * offset;
+            const uint32_t start = 2 * Constants::NUM_FRAMES + delay;
+            int early = 0, worst = 0;
+            for (uint32_t i = 0; i < start; ++i) early = std::max(early, std::abs(a[i]));
+            for (uint32_t i = start; i < a.size(); ++i) worst = std::max(worst, std::abs(a[i] - r[i - delay]));
+
+            char detail[96];
+            std::snprintf(detail, sizeof(detail), "offset %u: %d before its frame, differs by up to %d", offset, early, worst);
+            check(early == 0 && worst <= 2, "scheduled frame offset", detail);
+        }
+    }
+
+    // A note whose frame was already rendered plays on the first frame of the next block
+    void lateEvent() {
+        auto late = std::make_unique<VoiceManager>();
+        auto onTime = std::make_unique<VoiceManager>();
+        std::vector<int16_t> a, r;
+        renderInto(*late, a, 2);
+        renderInto(*onTime, r, 2);
+        late->scheduleNote(60, 127, late->getFrame() - 10);
+        onTime->scheduleNote(60, 127, onTime->getFrame());
+        a.clear();
+        r.clear();
+        renderInto(*late, a, 4);
+        renderInto(*onTime, r, 4);
+
+        int worst = 0, first = 0;
+        for (size_t i = 0; i < a.size(); ++i) worst = std::max(worst, std::abs(a[i] - r[i]));
+        for (int i = 0; i < Constants::BUFFER_SIZE; ++i) first = std::max(first, std::abs(a[i]));
+        char detail[80];
+        std::snprintf(detail, sizeof(detail), "peak %d in its block, differs by up to %d from the block start", first, worst);
+        check(first > 0 && worst == 0, "late event", detail);
+    }
+
+    // A voice reused by a scheduled note renders its first, partial block with the new note's
+    // modulation and not with what the previous note on that voice left behind
+    void scheduledNoteModulation() {
+        // Note number to pitch, so every voice's last note leaves a large pitch modulation
+        const ModMatrix::Route noteToPitch{ModMatrix::Source::NOTE, ModMatrix::Dest::PITCH, ModMatrix::Source::NONE, 24.0f};
+        auto used = std::make_unique<VoiceManager>();
+        auto fresh = std::make_unique<VoiceManager>();
+        used->setModRoute(2, noteToPitch);
+        fresh->setModRoute(2, noteToPitch);
+
+        Block block;
+        for (uint8_t v = 0; v < Constants::NUM_VOICES; ++v) used->noteOn(static_cast<uint8_t>(120 + v), 127);
+        for (int i = 0; i < 8; ++i) used->process(block);
+        for (uint8_t v = 0; v < Constants::NUM_VOICES; ++v) used->noteOff(static_cast<uint8_t>(120 + v));
+        if (!renderUntilSilent(*used) || !renderUntilSilent(*fresh)) {
+            check(false, "scheduled note modulation", "voices never went idle");
+            return;
+        }
+
+        const int worst = startDifference(*used, *fresh, 48, 0);
+        char detail[64];
+        std::snprintf(detail, sizeof(detail), "differs by up to %d from a fresh voice", worst);
+        check(worst <= 2, "scheduled note modulation", detail);
+    }
+
+    // Member channel bends reach ±48 semitones, so a voice left by a bent note is far off pitch.
+    // A scheduled note on an unbent channel has to start from that channel's own state.
+    void scheduledMpeNote() {
+        auto used = std::make_unique<VoiceManager>();
+        auto fresh = std::make_unique<VoiceManager>();
+        used->setMpe(15);
+        fresh->setMpe(15);
+
+        Block block;
+        used->process(block);
+        for (uint8_t v = 0; v < Constants::NUM_VOICES; ++v) {
+            const uint8_t channel = static_cast<uint8_t>(1 + v);
+            used->setPitchBend(0x7F, 0x7F, channel);
+            used->noteOn(48, 127, channel);
+        }
+        for (int i = 0; i < 8; ++i) used->process(block);
+        for (uint8_t v = 0; v < Constants::NUM_VOICES; ++v) used->noteOff(48, static_cast<uint8_t>(1 + v));
+        if (!renderUntilSilent(*used) || !renderUntilSilent(*fresh)) {
+            check(false, "scheduled MPE note", "voices never went idle");
+            return;
+        }
+
+        const int worst = startDifference(*used, *fresh, 48, 9);
+        char detail[64];
+        std::snprintf(detail, sizeof(detail), "differs by up to %d from a fresh voice", worst);
+        check(worst <= 2, "scheduled MPE note", detail);
+    }
+
+    // Turning MPE on fills in its default routes but leaves a route set by hand in their slot
+    void mpeKeepsRoutes() {
+        const ModMatrix::Route noteToPitch{ModMatrix::Source::NOTE, ModMatrix::Dest::PITCH, ModMatrix::Source::NONE, 24.0f};
+        auto before = std::make_unique<VoiceManager>();
+        auto after = std::make_unique<VoiceManager>();
+        before->setModRoute(2, noteToPitch);
+        before->setMpe(15);
+        after->setMpe(15);
+        after->setModRoute(2, noteToPitch);
+
+        int worst = 0;
+        before->noteOn(84, 127, 1);
+        after->noteOn(84, 127, 1);
+        for (int b = 0; b < 8; ++b) {
+            Block x, y;
+            before->process(x);
+            after->process(y);
+            for (int i = 0; i < Constants::BUFFER_SIZE; ++i) worst = std::max(worst, std::abs(x[i] - y[i]));
+        }
+        char detail[64];
+        std::snprintf(detail, sizeof(detail), "differs by up to %d with the route set first", worst);
+        check(worst == 0, "MPE keeps routes", detail);
+    }
+
+    // A note off that finds the queue full must not overtake its own note on still in there
+    void fullQueueKeepsOrder() {
+        auto vm = std::make_unique<VoiceManager>();
+        const uint32_t later = vm->getFrame() + 1000;
+        // Note offs for a key that isn't down fill all but the last slot
+        for (uint32_t i = 0; i + 1 < VoiceManager::EVENT_QUEUE_SIZE; ++i) vm->scheduleNote(10, 0, later);
+        vm->scheduleNote(60, 127, later);
+        vm->scheduleNote(60, 0, later + 100);
+
+        Block block;
+        for (int i = 0; i < 100; ++i) vm->process(block);
+        check(renderUntilSilent(*vm), "full event queue", "a voice was left held");
+    }
+
+    // A key let go before its attack has moved off zero goes idle instead of releasing forever
+    void releaseFromSilence() {
+        Adsr adsr;
+        adsr.init();
+        adsr.gate(true);
+        adsr.gate(false);
+        float env[Constants::NUM_FRAMES];
+        adsr.renderBlock(env, Constants::NUM_FRAMES);
+        check(!adsr.isActive(), "release from silence", "the envelope is still active");
+    }
+
+    // A panic is queued behind a note that came in just before it, so that note goes off too
+    void panicAfterNote() {
+        auto vm = std::make_unique<VoiceManager>();
+        const uint32_t frame = vm->getFrame() + Constants::NUM_FRAMES;
+        vm->scheduleNote(60, 127, frame);
+        vm->scheduleAllNotesOff(frame + 4);
+
+        Block block;
+        for (int i = 0; i < 4; ++i) vm->process(block);
+        check(renderUntilSilent(*vm), "panic after a queued note", "a voice was left held");
+    }
+
+    // A released voice the load governor cheapens keeps its filter running, so the block it
+    // switches in follows on from the one before instead of stepping
+    void governedBlockContinuous() {
+        auto governed = std::make_unique<VoiceManager>();
+        auto plain = std::make_unique<VoiceManager>();
+        for (VoiceManager* vm : {governed.get(), plain.get()}) {
+            vm->setCutoff(300.0f);
+            vm->setResonance(0.5f);
+            vm->noteOn(48, 127);
+        }
+        governed->setLoadDeadline(1000);
+
+        Block a, r;
+        int peak = 0;
+        for (int b = 0; b < 24; ++b) {
+            if (b == 20) {
+                governed->noteOff(48);
+                plain->noteOff(48);
+            }
+            governed->process(a);
+            plain->process(r);
+            for (int i = 0; i < Constants::BUFFER_SIZE; ++i) peak = std::max(peak, std::abs(r[i]));
+        }
+
+        // One overrun steps the governor up a level right away
+        governed->reportRenderTime(2000);
+        int worst = 0;
+        for (int b = 0; b < 4; ++b) {
+            governed->process(a);
+            plain->process(r);
+            for (int i = 0; i < Constants::BUFFER_SIZE; ++i) worst = std::max(worst, std::abs(a[i] - r[i]));
+        }
+        char detail[80];
+        std::snprintf(detail, sizeof(detail), "differs by up to %d from the ungoverned voice, peak %d", worst, peak);
+        check(worst * 50 <= peak, "governed block continuous", detail);
+    }
+
+    // The SoA bank has no per-voice kernels to cheapen, its first level already sheds a voice
+    void governorLevels() {
+        LoadGovernor governor;
+        governor.setDeadline(1000);
+        governor.update(2000);
+#if SYNTH_SOA_VOICES
+        const bool ok = !governor.cheapReleased() && governor.voiceLimit() == Constants::NUM_VOICES - 1;
+#else
+        const bool ok = governor.cheapReleased() && governor.voiceLimit() == Constants::NUM_VOICES;
+#endif
+        check(ok, "governor levels", "the first level does the wrong thing for this build");
+    }
+
+    // A key whose voice was stolen is still let go, so a later sostenuto doesn't latch it
+    void stolenKeySostenuto() {
+        auto vm = std::make_unique<VoiceManager>();
+        Block block;
+        // One note more than there are voices, the last steals the first one's voice
+        for (uint8_t n = 0; n <= Constants::NUM_VOICES; ++n) vm->noteOn(static_cast<uint8_t>(60 + n), 127);
+        vm->process(block);
+        for (uint8_t n = 0; n <= Constants::NUM_VOICES; ++n) vm->noteOff(static_cast<uint8_t>(60 + n));
+        vm->setPedal(VoiceManager::Pedal::SOSTENUTO, true);
+
+        vm->noteOn(60, 127);
+        for (int i = 0; i < 8; ++i) vm->process(block);
+        vm->noteOff(60);
+        check(renderUntilSilent(*vm), "stolen key under sostenuto", "the key was latched by the pedal");
+    }
+
+    // The main oscillator keeps time while unison copies play, so a voice leaving unison carries
+    // on in phase with one that never used it
+    void unisonKeepsPhase() {
+        auto stacked = std::make_unique<VoiceManager>();
+        auto single = std::make_unique<VoiceManager>();
+        for (VoiceManager* vm : {stacked.get(), single.get()}) {
+            vm->setCutoff(20000.0f);    // Filter bypassed, no state to tell the two apart
+            vm->noteOn(57, 127);
+        }
+        stacked->setUnison(VoiceManager::MAX_UNISON, 0.3f, 0.7f);
+
+        std::vector<int16_t> a, r;
+        renderInto(*stacked, a, 10);
+        renderInto(*single, r, 10);
+        stacked->setUnison(1, 0.3f, 0.7f);
+        a.clear();
+        r.clear();
+        renderInto(*stacked, a, 4);
+        renderInto(*single, r, 4);
+
+        int worst = 0;
+        for (size_t i = 0; i < a.size(); ++i) worst = std::max(worst, std::abs(a[i] - r[i]));
+        char detail[64];
+        std::snprintf(detail, sizeof(detail), "differs by up to %d after leaving unison", worst);
+        check(worst <= 2, "unison keeps phase", detail);
+    }
+
+    // A filter reset partway through a block runs the rest of it on its tuning, the same as
+    // one that started there, not on the tail of the ramp the block began with
+    void filterResetDropsRamp() {
+        SVF ramped, fresh;
+        ramped.init();
+        ramped.setCutoff(200.0f);
+        ramped.beginBlock();
+        ramped.setCutoff(8000.0f);
+        ramped.beginBlock();
+        fresh.init();
+        fresh.setCutoff(8000.0f);
+        fresh.reset();
+
+        bool same = true;
+        for (uint32_t i = 0; i < Constants::NUM_FRAMES; ++i) {
+            const float in = (i & 4) ? 0.5f : -0.5f;
+            if (i < 8) {
+                (void)ramped.process(in);
+                if (i == 7) ramped.reset();
+                continue;
+            }
+            same &= ramped.process(in) == fresh.process(in);
+        }
+        check(same, "filter reset drops ramp", "a filter reset mid-block kept ramping its coefficients");
+    }
+
+    // Closing the cutoff below the bypass picks the filter up from the signal it was passing,
+    // not from silence, so the output lines up with a voice that filtered all along
+    void bypassExitContinuous() {
+        auto opened = std::make_unique<VoiceManager>();
+        auto closed = std::make_unique<VoiceManager>();
+        opened->setCutoff(20000.0f);
+        closed->setCutoff(12000.0f);
+        for (VoiceManager* vm : {opened.get(), closed.get()}) vm->noteOn(45, 127);
+
+        std::vector<int16_t> a, r;
+        renderInto(*opened, a, 20);
+        renderInto(*closed, r, 20);
+        opened->setCutoff(12000.0f);
+        a.clear();
+        r.clear();
+        renderInto(*opened, a, 2);
+        renderInto(*closed, r, 2);
+
+        int worst = 0, peak = 0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            worst = std::max(worst, std::abs(a[i] - r[i]));
+            peak = std::max(peak, std::abs(static_cast<int>(r[i])));
+        }
+        char detail[64];
+        std::snprintf(detail, sizeof(detail), "differs by up to %d of %d leaving bypass", worst, peak);
+        check(worst * 8 < peak, "bypass exit continuous", detail);
+    }
+
+    // Rates outside what a block-rate LFO can step come back to its limits instead of wrapping
+    void lfoRateLimits() {
+        const float blockRate = static_cast<float>(Constants::SAMPLE_RATE) / Constants::NUM_FRAMES;
+        auto run = [](float rate, float bpm, bool sync) {
+            Lfo lfo;
+            lfo.configure({rate, 1.0f / 16.0f, 0, sync, false}, bpm);
+            float sum = 0.0f;
+            for (int i = 0; i < 7; ++i) sum += lfo.tick();
+            return sum;
+        };
+        const bool ok = run(1.0e9f, 120.0f, false) == run(blockRate * 0.5f, 120.0f, false) &&
+                        run(-3.0f, 120.0f, false) == run(0.0f, 120.0f, false) &&
+                        run(0.0f, 1.0e9f, true) == run(blockRate * 0.5f, 120.0f, false);
+        check(ok, "LFO rate limits", "an out of range rate didn't land on the nearest limit");
+    }
+}
+
+int main() {
+    scheduledFrameOffset();
+    lateEvent();
+    scheduledNoteModulation();
+    scheduledMpeNote();
+    mpeKeepsRoutes();
+    fullQueueKeepsOrder();
+    releaseFromSilence();
+    panicAfterNote();
+    governedBlockContinuous();
+    governorLevels();
+    stolenKeySostenuto();
+    unisonKeepsPhase();
+    lfoRateLimits();
+    filterResetDropsRamp();
+    bypassExitContinuous();
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
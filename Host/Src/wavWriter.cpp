@@ -0,0 +1,60 @@
+#include "wavWriter.h"
+
+namespace {
+    void put16(uint8_t* p, uint16_t v) { p[0] = v & 0xFF; p[1] = v >> 8; }
+    void put32(uint8_t* p, uint32_t v) { for (int i = 0; i < 4; ++i) p[i] = (v >> (8 * i)) & 0xFF; }
+}
+
+uint8_t WavWriter::open(const std::string& path, uint32_t sampleRate, uint16_t channels) {
+    close();
+    _file = std::fopen(path.c_str(), "wb");
+    if (!_file) return 1;
+    _sampleRate = sampleRate;
+    _channels = channels;
+    _dataBytes = 0;
+    writeHeader();
+    return 0;
+}
+
+void WavWriter::write(const int16_t* samples, size_t count) {
+    if (!_file) return;
+    uint8_t bytes[256];
+    size_t n = 0;
+    for (size_t i = 0; i < count; ++i) {
+        put16(&bytes[n], static_cast<uint16_t>(samples[i]));
+        n += 2;
+        if (n == sizeof(bytes)) {
+            std::fwrite(bytes, 1, n, _file);
+            n = 0;
+        }
+    }
+    std::fwrite(bytes, 1, n, _file);
+    _dataBytes += static_cast<uint32_t>(count * 2);
+}
+
+void WavWriter::close() {
+    if (!_file) return;
+    std::fseek(_file, 0, SEEK_SET);
+    writeHeader();
+    std::fclose(_file);
+    _file = nullptr;
+}
+
+void WavWriter::writeHeader() {
+    uint8_t h[44];
+    const uint16_t blockAlign = _channels * 2;
+    h[0] = 'R'; h[1] = 'I'; h[2] = 'F'; h[3] = 'F';
+    put32(&h[4], 36 + _dataBytes);
+    h[8] = 'W'; h[9] = 'A'; h[10] = 'V'; h[11] = 'E';
+    h[12] = 'f'; h[13] = 'm'; h[14] = 't'; h[15] = ' ';
+    put32(&h[16], 16);
+    put16(&h[20], 1); // PCM
+    put16(&h[22], _channels);
+    put32(&h[24], _sampleRate);
+    put32(&h[28], _sampleRate * blockAlign);
+    put16(&h[32], blockAlign);
+    put16(&h[34], 16);
+    h[36] = 'd'; h[37] = 'a'; h[38] = 't'; h[39] = 'a';
+    put32(&h[40], _dataBytes);
+    std::fwrite(h, 1, sizeof(h), _file);
+}
@@ -131,7 +131,8 @@ static void AUDIO_REQ_GetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef
 static void AUDIO_REQ_SetCurrent(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
 static void *USBD_AUDIO_GetAudioHeaderDesc(uint8_t *pConfDesc);
 
-extern void Midi_Push_To_Buffer(uint8_t* raw);
+extern void Midi_Push_Packets(uint8_t* raw, uint32_t length);
+extern void Midi_Tx_Complete(void);
 
 /**
   * @}
@@ -221,6 +222,7 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIE
 #endif /* USE_USBD_COMPOSITE  */
 
 static uint8_t AUDIOOutEpAdd = AUDIO_OUT_EP;
+static volatile uint8_t MidiInBusy = 0U;
 /**
   * @}
   */
@@ -271,6 +273,11 @@ static uint8_t USBD_AUDIO_Init(USBD_HandleTypeDef *pdev, uint8_t cfgidx)
   (void)USBD_LL_OpenEP(pdev, 0x01, USBD_EP_TYPE_BULK, 0x40);
   pdev->ep_out[AUDIOOutEpAdd & 0xFU].is_used = 1U;
 
+  /* Open EP IN for MIDI (Bulk), device to host messages such as telemetry */
+  (void)USBD_LL_OpenEP(pdev, MIDI_IN_EP, USBD_EP_TYPE_BULK, MIDI_PACKET_SIZE);
+  pdev->ep_in[MIDI_IN_EP & 0xFU].is_used = 1U;
+  MidiInBusy = 0U;
+
   haudio->alt_setting = 0U;
   haudio->offset = AUDIO_OFFSET_UNKNOWN;
   haudio->wr_ptr = 0U;
@@ -312,6 +319,11 @@ static uint8_t USBD_AUDIO_DeInit(USBD_HandleTypeDef *pdev, uint8_t cfgidx)
   pdev->ep_out[AUDIOOutEpAdd & 0xFU].is_used = 0U;
   pdev->ep_out[AUDIOOutEpAdd & 0xFU].bInterval = 0U;
 
+  /* Close EP IN */
+  (void)USBD_LL_CloseEP(pdev, MIDI_IN_EP);
+  pdev->ep_in[MIDI_IN_EP & 0xFU].is_used = 0U;
+  MidiInBusy = 0U;
+
   /* DeInit  physical Interface components */
   if (pdev->pClassDataCmsit[pdev->classId] != NULL)
   {
@@ -474,9 +486,36 @@ static uint8_t *USBD_AUDIO_GetCfgDesc(uint16_t *length)
 static uint8_t USBD_AUDIO_DataIn(USBD_HandleTypeDef *pdev, uint8_t epnum)
 {
   UNUSED(pdev);
-  UNUSED(epnum);
 
-  /* Only OUT data are processed */
+  if (epnum == (MIDI_IN_EP & 0x7FU)) // MIDI IN endpoint
+  {
+    MidiInBusy = 0U;
+    Midi_Tx_Complete();
+  }
+  return (uint8_t)USBD_OK;
+}
+
+/**
+  * @brief  USBD_MIDI_Transmit
+  *         Starts sending USB-MIDI event packets on the MIDI IN endpoint
+  * @param  pdev: device instance
+  * @param  pbuf: whole 4-byte packets, must stay valid until the transfer completes
+  * @param  length: bytes to send, at most MIDI_PACKET_SIZE
+  * @retval USBD_BUSY while the previous transfer is still in flight
+  */
+uint8_t USBD_MIDI_Transmit(USBD_HandleTypeDef *pdev, uint8_t *pbuf, uint16_t length)
+{
+  if (pdev->dev_state != USBD_STATE_CONFIGURED)
+  {
+    return (uint8_t)USBD_FAIL;
+  }
+  if (MidiInBusy != 0U)
+  {
+    return (uint8_t)USBD_BUSY;
+  }
+
+  MidiInBusy = 1U;
+  (void)USBD_LL_Transmit(pdev, MIDI_IN_EP, pbuf, MIN(length, MIDI_PACKET_SIZE));
   return (uint8_t)USBD_OK;
 }
 
@@ -658,10 +697,8 @@ static uint8_t USBD_AUDIO_DataOut(USBD_HandleTypeDef *pdev, uint8_t epnum)
     uint32_t length = USBD_LL_GetRxDataSize(pdev, epnum);
     USBD_AUDIO_HandleTypeDef *haudio = (USBD_AUDIO_HandleTypeDef *)pdev->pClassData;
 
-    // Standard USB MIDI packets are 4 bytes long 
-    for (uint32_t i = 0; i < length; i += 4) {
-      Midi_Push_To_Buffer(&haudio->buffer[i]);
-    }
+    // Standard USB MIDI packets are 4 bytes long, the whole transfer goes into the buffer at once
+    Midi_Push_Packets(haudio->buffer, length);
 
     // Crucial: Re-prime the endpoint to listen for the next packet
     USBD_LL_PrepareReceive(pdev, 0x01, haudio->buffer, 64);